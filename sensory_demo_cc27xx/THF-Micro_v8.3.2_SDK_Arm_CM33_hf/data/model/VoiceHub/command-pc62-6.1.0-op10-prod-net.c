@@ -1,33769 +0,0 @@
-/* DNN data file V20 for pc62 platform
- * Copyright (C) 2003-2022 Sensory, Inc. All Rights Reserved.
- * 
- *
- *            source: /tmp/tmp.hWpn9Ggwdv/trecs-en_US_12-13-6-0_0ffbd4a9d7b83946eebed70b249cfa4ebb845373.snsr
- *           created: Tue Nov 26 22:03:50 2024
- *   min lib version: 6.1.0
- *   operating point: 10
- *  production ready: yes
- *       license key: no
- *
- * Created by VoiceHub 2.11.3
- * Project: Toggle_on_and_off_LEDs_on_Launchpad_Example_command
- */
-
-#ifndef ALIGNED
-#ifndef _MSC_VER
-#define ALIGNED(x) __attribute__ ((aligned (x)))
-#else
-#define ALIGNED(x)
-#endif
-#endif
-
-const unsigned short dnn_en_command_netLabel[] ALIGNED(4) = {
-   20,	 // 0x0014
-    1,	 // 0x0001
-23045,	 // 0x5a05
-64512,	 // 0xfc00
-  444,	 // 0x01bc
-   58,	 // 0x003a
-    4,	 // 0x0004
- 5210,	 // 0x145a
-    1,	 // 0x0001
-    0,	 // 0x0000
-   24, 	 // 0x0018
-    0, 	 // 0x0000
-   18,	 // 0x0012
-    6,	 // 0x0006
-28771,	 // 0x7063
-    0,	 // 0x0000
-    5,	 // 0x0005
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   48, 	 // 0x0030
-    0, 	 // 0x0000
-   60, 	 // 0x003c
-    0, 	 // 0x0000
-  114, 	 // 0x0072
-    0, 	 // 0x0000
-  936, 	 // 0x03a8
-    0, 	 // 0x0000
-   72, 	 // 0x0048
-    0, 	 // 0x0000
-   84, 	 // 0x0054
-    0, 	 // 0x0000
-   94, 	 // 0x005e
-    0, 	 // 0x0000
-  104, 	 // 0x0068
-    0, 	 // 0x0000
-  441,	 // 0x01b9
-   88,	 // 0x0058
-   88,	 // 0x0058
-   88,	 // 0x0058
-   88,	 // 0x0058
-   58,	 // 0x003a
-  131,	 // 0x0083
-  130,	 // 0x0082
-  130,	 // 0x0082
-  130,	 // 0x0082
-  130,	 // 0x0082
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    2,	 // 0x0002
-    3,	 // 0x0003
-    4,	 // 0x0004
-    5,	 // 0x0005
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  442,	 // 0x01ba
-   88,	 // 0x0058
-   88,	 // 0x0058
-   88,	 // 0x0058
-   88,	 // 0x0058
-  819,	 // 0x0333
-  910,	 // 0x038e
- 3143,	 // 0x0c47
-  930,	 // 0x03a2
-  886,	 // 0x0376
- 1151,	 // 0x047f
-  847,	 // 0x034f
-  540,	 // 0x021c
-  706,	 // 0x02c2
- 1426,	 // 0x0592
-  530,	 // 0x0212
-  408,	 // 0x0198
-  528,	 // 0x0210
-  856,	 // 0x0358
-  441,	 // 0x01b9
- 1200,	 // 0x04b0
-  678,	 // 0x02a6
-  924,	 // 0x039c
- 1010,	 // 0x03f2
- 1403,	 // 0x057b
-  422,	 // 0x01a6
-  694,	 // 0x02b6
-  651,	 // 0x028b
-  435,	 // 0x01b3
-  619,	 // 0x026b
-  677,	 // 0x02a5
- 3835,	 // 0x0efb
- 3467,	 // 0x0d8b
- 1305,	 // 0x0519
-  490,	 // 0x01ea
- 1255,	 // 0x04e7
-  555,	 // 0x022b
-  689,	 // 0x02b1
- 1215,	 // 0x04bf
-  638,	 // 0x027e
-  494,	 // 0x01ee
-  635,	 // 0x027b
-  497,	 // 0x01f1
- 1364,	 // 0x0554
-  767,	 // 0x02ff
-  845,	 // 0x034d
-  239,	 // 0x00ef
- 1341,	 // 0x053d
-  545,	 // 0x0221
-  561,	 // 0x0231
-  696,	 // 0x02b8
-  553,	 // 0x0229
- 1697,	 // 0x06a1
-  522,	 // 0x020a
- 1010,	 // 0x03f2
- 1684,	 // 0x0694
-  695,	 // 0x02b7
-  528,	 // 0x0210
- 1618,	 // 0x0652
-  670,	 // 0x029e
- 1075,	 // 0x0433
-  721,	 // 0x02d1
- 1449,	 // 0x05a9
-  662,	 // 0x0296
-  766,	 // 0x02fe
-  755,	 // 0x02f3
-  489,	 // 0x01e9
-  646,	 // 0x0286
- 1092,	 // 0x0444
-  766,	 // 0x02fe
-  936,	 // 0x03a8
-  762,	 // 0x02fa
-  396,	 // 0x018c
- 3032,	 // 0x0bd8
-  634,	 // 0x027a
-  713,	 // 0x02c9
-  780,	 // 0x030c
- 2910,	 // 0x0b5e
-  753,	 // 0x02f1
- 1570,	 // 0x0622
- 1360,	 // 0x0550
-  533,	 // 0x0215
-  880,	 // 0x0370
-  419,	 // 0x01a3
- 3086,	 // 0x0c0e
-  593,	 // 0x0251
- 1081,	 // 0x0439
-  292,	 // 0x0124
-  863,	 // 0x035f
-  908,	 // 0x038c
-  483,	 // 0x01e3
-  356,	 // 0x0164
-    0,	 // 0x0000
-  264,	 // 0x0108
-  502,	 // 0x01f6
-  402,	 // 0x0192
-  405,	 // 0x0195
-  307,	 // 0x0133
-  298,	 // 0x012a
-  676,	 // 0x02a4
-  347,	 // 0x015b
-  358,	 // 0x0166
-  510,	 // 0x01fe
-  574,	 // 0x023e
-  541,	 // 0x021d
-  337,	 // 0x0151
-  480,	 // 0x01e0
-  510,	 // 0x01fe
-  661,	 // 0x0295
-  504,	 // 0x01f8
-  368,	 // 0x0170
-  589,	 // 0x024d
-  298,	 // 0x012a
-  312,	 // 0x0138
-  499,	 // 0x01f3
-  274,	 // 0x0112
-  415,	 // 0x019f
-  456,	 // 0x01c8
-  487,	 // 0x01e7
-  467,	 // 0x01d3
-  332,	 // 0x014c
-  462,	 // 0x01ce
-  420,	 // 0x01a4
-  227,	 // 0x00e3
-  534,	 // 0x0216
-  254,	 // 0x00fe
-  501,	 // 0x01f5
-  573,	 // 0x023d
-  431,	 // 0x01af
-  564,	 // 0x0234
-  496,	 // 0x01f0
-  586,	 // 0x024a
- 1157,	 // 0x0485
- 3738,	 // 0x0e9a
-  294,	 // 0x0126
-  532,	 // 0x0214
-  313,	 // 0x0139
-  484,	 // 0x01e4
-  434,	 // 0x01b2
-  244,	 // 0x00f4
-  324,	 // 0x0144
-  212,	 // 0x00d4
-  358,	 // 0x0166
-  400,	 // 0x0190
-  309,	 // 0x0135
-  257,	 // 0x0101
-  561,	 // 0x0231
-  905,	 // 0x0389
-  267,	 // 0x010b
-  746,	 // 0x02ea
-  314,	 // 0x013a
-  391,	 // 0x0187
-  483,	 // 0x01e3
-  403,	 // 0x0193
-  839,	 // 0x0347
-  472,	 // 0x01d8
-  357,	 // 0x0165
-  477,	 // 0x01dd
-  352,	 // 0x0160
-  388,	 // 0x0184
-  722,	 // 0x02d2
-  380,	 // 0x017c
-  247,	 // 0x00f7
-  380,	 // 0x017c
-  334,	 // 0x014e
-  476,	 // 0x01dc
-  274,	 // 0x0112
-  378,	 // 0x017a
-  760,	 // 0x02f8
-  258,	 // 0x0102
-  328,	 // 0x0148
-  391,	 // 0x0187
-  406,	 // 0x0196
-  361,	 // 0x0169
-  479,	 // 0x01df
-  410,	 // 0x019a
- 5263,	 // 0x148f
-  531,	 // 0x0213
-  361,	 // 0x0169
-  346,	 // 0x015a
-    0,	 // 0x0000
- 1579,	 // 0x062b
- 1138,	 // 0x0472
-  317,	 // 0x013d
-  970,	 // 0x03ca
- 2215,	 // 0x08a7
-  191,	 // 0x00bf
-  391,	 // 0x0187
-  826,	 // 0x033a
- 1017,	 // 0x03f9
-  562,	 // 0x0232
-  710,	 // 0x02c6
-  447,	 // 0x01bf
- 1492,	 // 0x05d4
-  697,	 // 0x02b9
-  771,	 // 0x0303
- 1434,	 // 0x059a
-  816,	 // 0x0330
-  334,	 // 0x014e
- 1933,	 // 0x078d
-  588,	 // 0x024c
-  385,	 // 0x0181
-  577,	 // 0x0241
-  826,	 // 0x033a
- 1026,	 // 0x0402
- 1288,	 // 0x0508
- 1033,	 // 0x0409
-  890,	 // 0x037a
- 1230,	 // 0x04ce
- 1485,	 // 0x05cd
- 1512,	 // 0x05e8
-  384,	 // 0x0180
-  917,	 // 0x0395
- 2071,	 // 0x0817
-  938,	 // 0x03aa
-  425,	 // 0x01a9
-  592,	 // 0x0250
-  396,	 // 0x018c
-  726,	 // 0x02d6
- 1458,	 // 0x05b2
-  474,	 // 0x01da
-  742,	 // 0x02e6
-  272,	 // 0x0110
- 1441,	 // 0x05a1
- 1005,	 // 0x03ed
- 1259,	 // 0x04eb
- 1001,	 // 0x03e9
-  333,	 // 0x014d
- 1023,	 // 0x03ff
- 1978,	 // 0x07ba
- 1194,	 // 0x04aa
-  643,	 // 0x0283
-  507,	 // 0x01fb
- 1204,	 // 0x04b4
-  653,	 // 0x028d
-  334,	 // 0x014e
-  245,	 // 0x00f5
-  185,	 // 0x00b9
- 1120,	 // 0x0460
- 1370,	 // 0x055a
- 1634,	 // 0x0662
-  991,	 // 0x03df
- 1606,	 // 0x0646
- 1785,	 // 0x06f9
- 3890,	 // 0x0f32
-  971,	 // 0x03cb
- 1122,	 // 0x0462
-  967,	 // 0x03c7
- 1491,	 // 0x05d3
-  374,	 // 0x0176
-  370,	 // 0x0172
- 1624,	 // 0x0658
-  481,	 // 0x01e1
- 1524,	 // 0x05f4
-  732,	 // 0x02dc
- 1208,	 // 0x04b8
-  539,	 // 0x021b
- 1010,	 // 0x03f2
- 2261,	 // 0x08d5
-  340,	 // 0x0154
- 1778,	 // 0x06f2
- 1942,	 // 0x0796
- 1130,	 // 0x046a
-  781,	 // 0x030d
- 4800,	 // 0x12c0
-  587,	 // 0x024b
- 3352,	 // 0x0d18
-  578,	 // 0x0242
-    0,	 // 0x0000
-  624,	 // 0x0270
-  487,	 // 0x01e7
-  472,	 // 0x01d8
- 1387,	 // 0x056b
-  864,	 // 0x0360
-  906,	 // 0x038a
- 2268,	 // 0x08dc
-  328,	 // 0x0148
-  324,	 // 0x0144
-  534,	 // 0x0216
- 1342,	 // 0x053e
- 2193,	 // 0x0891
- 1433,	 // 0x0599
-  834,	 // 0x0342
- 3639,	 // 0x0e37
-  963,	 // 0x03c3
-  627,	 // 0x0273
-  460,	 // 0x01cc
-  788,	 // 0x0314
-  354,	 // 0x0162
-  934,	 // 0x03a6
-  903,	 // 0x0387
-  470,	 // 0x01d6
- 1042,	 // 0x0412
-  411,	 // 0x019b
-  523,	 // 0x020b
- 1121,	 // 0x0461
- 1562,	 // 0x061a
-  724,	 // 0x02d4
- 1337,	 // 0x0539
-  413,	 // 0x019d
- 1446,	 // 0x05a6
- 1699,	 // 0x06a3
- 1432,	 // 0x0598
-  564,	 // 0x0234
-  899,	 // 0x0383
- 1058,	 // 0x0422
-  909,	 // 0x038d
-  642,	 // 0x0282
-  590,	 // 0x024e
-  954,	 // 0x03ba
- 1140,	 // 0x0474
-  861,	 // 0x035d
- 1125,	 // 0x0465
-  553,	 // 0x0229
-  750,	 // 0x02ee
-  874,	 // 0x036a
-  701,	 // 0x02bd
- 1028,	 // 0x0404
- 1538,	 // 0x0602
- 1125,	 // 0x0465
-  818,	 // 0x0332
-  437,	 // 0x01b5
-  599,	 // 0x0257
- 1519,	 // 0x05ef
-  496,	 // 0x01f0
-  615,	 // 0x0267
-  663,	 // 0x0297
-  795,	 // 0x031b
-  296,	 // 0x0128
-  325,	 // 0x0145
- 1104,	 // 0x0450
-  670,	 // 0x029e
- 1026,	 // 0x0402
-  880,	 // 0x0370
- 1413,	 // 0x0585
-  426,	 // 0x01aa
-  968,	 // 0x03c8
- 1905,	 // 0x0771
-  666,	 // 0x029a
- 1048,	 // 0x0418
-  850,	 // 0x0352
- 1055,	 // 0x041f
-  864,	 // 0x0360
-  933,	 // 0x03a5
-  983,	 // 0x03d7
-  246,	 // 0x00f6
-  390,	 // 0x0186
- 1122,	 // 0x0462
-  327,	 // 0x0147
- 3077,	 // 0x0c05
-  717,	 // 0x02cd
-  577,	 // 0x0241
-  750,	 // 0x02ee
- 1115,	 // 0x045b
- 1378,	 // 0x0562
-  433,	 // 0x01b1
-    0,	 // 0x0000
-  378,	 // 0x017a
-  758,	 // 0x02f6
-  943,	 // 0x03af
-  637,	 // 0x027d
- 1013,	 // 0x03f5
- 1404,	 // 0x057c
- 1271,	 // 0x04f7
-  888,	 // 0x0378
-  935,	 // 0x03a7
-  808,	 // 0x0328
- 1155,	 // 0x0483
-  979,	 // 0x03d3
-  843,	 // 0x034b
-  834,	 // 0x0342
-  965,	 // 0x03c5
-  940,	 // 0x03ac
-  805,	 // 0x0325
-  802,	 // 0x0322
-  820,	 // 0x0334
-  619,	 // 0x026b
-  586,	 // 0x024a
-  510,	 // 0x01fe
- 1169,	 // 0x0491
-  997,	 // 0x03e5
- 1236,	 // 0x04d4
- 1238,	 // 0x04d6
- 1382,	 // 0x0566
- 1321,	 // 0x0529
- 1154,	 // 0x0482
- 1216,	 // 0x04c0
- 1098,	 // 0x044a
-  799,	 // 0x031f
-  722,	 // 0x02d2
- 1769,	 // 0x06e9
-  843,	 // 0x034b
- 1151,	 // 0x047f
-  977,	 // 0x03d1
-  807,	 // 0x0327
-  883,	 // 0x0373
-  934,	 // 0x03a6
-  944,	 // 0x03b0
-  818,	 // 0x0332
-  963,	 // 0x03c3
- 1241,	 // 0x04d9
- 1161,	 // 0x0489
- 1008,	 // 0x03f0
-  792,	 // 0x0318
-  885,	 // 0x0375
-  934,	 // 0x03a6
-  905,	 // 0x0389
-  842,	 // 0x034a
-  984,	 // 0x03d8
-  662,	 // 0x0296
-  731,	 // 0x02db
-  926,	 // 0x039e
-  825,	 // 0x0339
-  791,	 // 0x0317
-  790,	 // 0x0316
-    0,	 // 0x0000
-61406,	 // 0xefde
-  231,	 // 0x00e7
-64761,	 // 0xfcf9
- 1018,	 // 0x03fa
-  767,	 // 0x02ff
-65533,	 // 0xfffd
-65020,	 // 0xfdfc
-  253,	 // 0x00fd
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  510,	 // 0x01fe
-  510,	 // 0x01fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 7166,	 // 0x1bfe
-  757,	 // 0x02f5
-65529,	 // 0xfff9
-  257,	 // 0x0101
-  765,	 // 0x02fd
-65283,	 // 0xff03
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-14575,	 // 0x38ef
-  515,	 // 0x0203
-65269,	 // 0xfef5
-  518,	 // 0x0206
-  762,	 // 0x02fa
-65027,	 // 0xfe03
-  510,	 // 0x01fe
-    1,	 // 0x0001
-  766,	 // 0x02fe
-  256,	 // 0x0100
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-59923,	 // 0xea13
- 3087,	 // 0x0c0f
-63723,	 // 0xf8eb
- 1037,	 // 0x040d
- 1016,	 // 0x03f8
-65027,	 // 0xfe03
-  767,	 // 0x02ff
-65281,	 // 0xff01
-  256,	 // 0x0100
-    2,	 // 0x0002
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65281,	 // 0xff01
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-33112,	 // 0x8158
- 8466,	 // 0x2112
-61163,	 // 0xeeeb
-  264,	 // 0x0108
- 2297,	 // 0x08f9
-    1,	 // 0x0001
- 1276,	 // 0x04fc
-65026,	 // 0xfe02
-  513,	 // 0x0201
-  258,	 // 0x0102
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-57627,	 // 0xe11b
- 8187,	 // 0x1ffb
-61960,	 // 0xf208
-  765,	 // 0x02fd
- 2814,	 // 0x0afe
-  260,	 // 0x0104
- 1274,	 // 0x04fa
-64261,	 // 0xfb05
-  767,	 // 0x02ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 8173,	 // 0x1fed
-  756,	 // 0x02f4
-  531,	 // 0x0213
- 1531,	 // 0x05fb
-  765,	 // 0x02fd
- 1030,	 // 0x0406
-65275,	 // 0xfefb
-65027,	 // 0xfe03
-  767,	 // 0x02ff
-  253,	 // 0x00fd
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
- 3311,	 // 0x0cef
-62226,	 // 0xf312
- 2314,	 // 0x090a
- 1787,	 // 0x06fb
-64765,	 // 0xfcfd
-  773,	 // 0x0305
-65278,	 // 0xfefe
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  765,	 // 0x02fd
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3822,	 // 0x0eee
-61959,	 // 0xf207
- 1280,	 // 0x0500
- 1020,	 // 0x03fc
-64768,	 // 0xfd00
-  258,	 // 0x0102
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3323,	 // 0x0cfb
-63738,	 // 0xf8fa
-65276,	 // 0xfefc
-  765,	 // 0x02fd
-65026,	 // 0xfe02
-  257,	 // 0x0101
-  511,	 // 0x01ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4844,	 // 0x12ec
-63717,	 // 0xf8e5
-64246,	 // 0xfaf6
-  762,	 // 0x02fa
-    5,	 // 0x0005
-  257,	 // 0x0101
- 1023,	 // 0x03ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  766,	 // 0x02fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  104,	 // 0x0068
- 4103,	 // 0x1007
- 1789,	 // 0x06fd
-  774,	 // 0x0306
-  778,	 // 0x030a
-64254,	 // 0xfafe
-  253,	 // 0x00fd
-65023,	 // 0xfdff
-65026,	 // 0xfe02
-    0,	 // 0x0000
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61948,	 // 0xf1fc
- 1278,	 // 0x04fe
-  772,	 // 0x0304
-65534,	 // 0xfffe
-64506,	 // 0xfbfa
-65277,	 // 0xfefd
-  253,	 // 0x00fd
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65024,	 // 0xfe00
-63738,	 // 0xf8fa
-65534,	 // 0xfffe
-  253,	 // 0x00fd
-65534,	 // 0xfffe
-65025,	 // 0xfe01
-  510,	 // 0x01fe
-65024,	 // 0xfe00
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-62205,	 // 0xf2fd
-62205,	 // 0xf2fd
-63993,	 // 0xf9f9
- 1021,	 // 0x03fd
-  769,	 // 0x0301
-65028,	 // 0xfe04
-  514,	 // 0x0202
-    3,	 // 0x0003
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-60427,	 // 0xec0b
-62461,	 // 0xf3fd
-61419,	 // 0xefeb
-64507,	 // 0xfbfb
- 1280,	 // 0x0500
-    0,	 // 0x0000
-  778,	 // 0x030a
-  772,	 // 0x0304
-  513,	 // 0x0201
-  510,	 // 0x01fe
-  257,	 // 0x0101
-    0,	 // 0x0000
-65281,	 // 0xff01
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-56560,	 // 0xdcf0
-59358,	 // 0xe7de
-60122,	 // 0xeada
-61186,	 // 0xef02
- 2565,	 // 0x0a05
-  765,	 // 0x02fd
-  525,	 // 0x020d
- 1536,	 // 0x0600
-    5,	 // 0x0005
-  510,	 // 0x01fe
-    3,	 // 0x0003
-  257,	 // 0x0101
-65281,	 // 0xff01
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65535,	 // 0xffff
-47329,	 // 0xb8e1
-62659,	 // 0xf4c3
-64231,	 // 0xfae7
-61201,	 // 0xef11
- 3596,	 // 0x0e0c
-  250,	 // 0x00fa
-  262,	 // 0x0106
- 1790,	 // 0x06fe
-65027,	 // 0xfe03
-  513,	 // 0x0201
-65283,	 // 0xff03
-  258,	 // 0x0102
-65024,	 // 0xfe00
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-65024,	 // 0xfe00
-65535,	 // 0xffff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
- 4861,	 // 0x12fd
-10278,	 // 0x2826
- 5924,	 // 0x1724
- 1550,	 // 0x060e
-62465,	 // 0xf401
-63988,	 // 0xf9f4
-63987,	 // 0xf9f3
-  252,	 // 0x00fc
-64765,	 // 0xfcfd
-    0,	 // 0x0000
-65024,	 // 0xfe00
-  256,	 // 0x0100
-65279,	 // 0xfeff
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-32539,	 // 0x7f1b
-19544,	 // 0x4c58
- 8776,	 // 0x2248
- 4356,	 // 0x1104
-57842,	 // 0xe1f2
-62194,	 // 0xf2f2
-63208,	 // 0xf6e8
-64509,	 // 0xfbfd
-64505,	 // 0xfbf9
-65278,	 // 0xfefe
-65022,	 // 0xfdfe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-  258,	 // 0x0102
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-24071,	 // 0x5e07
-15664,	 // 0x3d30
- 7480,	 // 0x1d38
- 3845,	 // 0x0f05
-60147,	 // 0xeaf3
-62458,	 // 0xf3fa
-64495,	 // 0xfbef
-64253,	 // 0xfafd
-65019,	 // 0xfdfb
-65278,	 // 0xfefe
-65022,	 // 0xfdfe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  258,	 // 0x0102
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-59908,	 // 0xea04
- 2326,	 // 0x0916
- 1807,	 // 0x070f
-65028,	 // 0xfe04
-62451,	 // 0xf3f3
-63489,	 // 0xf801
-65017,	 // 0xfdf9
-64766,	 // 0xfcfe
-65534,	 // 0xfffe
-65282,	 // 0xff02
-65024,	 // 0xfe00
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-   25,	 // 0x0019
-  641,	 // 0x0281
-64480,	 // 0xfbe0
-62455,	 // 0xf3f7
-62969,	 // 0xf5f9
-65277,	 // 0xfefd
-  516,	 // 0x0204
-65023,	 // 0xfdff
-    2,	 // 0x0002
-  257,	 // 0x0101
-    2,	 // 0x0002
-    3,	 // 0x0003
-  512,	 // 0x0200
-  771,	 // 0x0303
-  255,	 // 0x00ff
-  260,	 // 0x0104
- 1025,	 // 0x0401
-  512,	 // 0x0200
-    4,	 // 0x0004
-  258,	 // 0x0102
- 1278,	 // 0x04fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64768,	 // 0xfd00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  768,	 // 0x0300
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64768,	 // 0xfd00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64244,	 // 0xfaf4
-63221,	 // 0xf6f5
-65531,	 // 0xfffb
-64247,	 // 0xfaf7
-  250,	 // 0x00fa
-  259,	 // 0x0103
-  765,	 // 0x02fd
-  252,	 // 0x00fc
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-62464,	 // 0xf400
-    1,	 // 0x0001
- 1024,	 // 0x0400
-  513,	 // 0x0201
-65533,	 // 0xfffd
-  767,	 // 0x02ff
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64513,	 // 0xfc01
- 1284,	 // 0x0504
- 1284,	 // 0x0504
- 1540,	 // 0x0604
-65024,	 // 0xfe00
-  512,	 // 0x0200
-65283,	 // 0xff03
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
- 4612,	 // 0x1204
- 1030,	 // 0x0406
-64001,	 // 0xfa01
- 1279,	 // 0x04ff
-  259,	 // 0x0103
-  518,	 // 0x0206
-  516,	 // 0x0204
-    1,	 // 0x0001
-  508,	 // 0x01fc
-    1,	 // 0x0001
-65534,	 // 0xfffe
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4853,	 // 0x12f5
- 1295,	 // 0x050f
-63227,	 // 0xf6fb
- 1275,	 // 0x04fb
-    2,	 // 0x0002
- 1545,	 // 0x0609
-  771,	 // 0x0303
-65279,	 // 0xfeff
-  253,	 // 0x00fd
-65280,	 // 0xff00
-65535,	 // 0xffff
-  253,	 // 0x00fd
-65278,	 // 0xfefe
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-59388,	 // 0xe7fc
- 3326,	 // 0x0cfe
-62970,	 // 0xf5fa
-65009,	 // 0xfdf1
-64768,	 // 0xfd00
- 1797,	 // 0x0705
- 1028,	 // 0x0404
-65533,	 // 0xfffd
-65534,	 // 0xfffe
-    0,	 // 0x0000
-    1,	 // 0x0001
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-61176,	 // 0xeef8
- 4611,	 // 0x1203
-61705,	 // 0xf109
-63982,	 // 0xf9ee
-64258,	 // 0xfb02
- 1791,	 // 0x06ff
- 1281,	 // 0x0501
-64767,	 // 0xfcff
-  252,	 // 0x00fc
-  258,	 // 0x0102
-  256,	 // 0x0100
-65280,	 // 0xff00
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 1521,	 // 0x05f1
- 3320,	 // 0x0cf8
-  524,	 // 0x020c
-65031,	 // 0xfe07
-63230,	 // 0xf6fe
-  506,	 // 0x01fa
-  765,	 // 0x02fd
-64002,	 // 0xfa02
-  508,	 // 0x01fc
-  258,	 // 0x0102
-  256,	 // 0x0100
-65025,	 // 0xfe01
-  254,	 // 0x00fe
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-55305,	 // 0xd809
-62180,	 // 0xf2e4
- 9476,	 // 0x2504
- 1825,	 // 0x0721
-63986,	 // 0xf9f2
-64505,	 // 0xfbf9
-65526,	 // 0xfff6
-65285,	 // 0xff05
- 1026,	 // 0x0402
-  511,	 // 0x01ff
-  767,	 // 0x02ff
-  258,	 // 0x0102
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-59656,	 // 0xe908
-56009,	 // 0xdac9
-13049,	 // 0x32f9
- 5419,	 // 0x152b
- 1267,	 // 0x04f3
-62455,	 // 0xf3f7
-65524,	 // 0xfff4
-  777,	 // 0x0309
- 1029,	 // 0x0405
-  761,	 // 0x02f9
- 1278,	 // 0x04fe
- 1023,	 // 0x03ff
-  511,	 // 0x01ff
-65277,	 // 0xfefd
-  252,	 // 0x00fc
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-32542,	 // 0x7f1e
-39608,	 // 0x9ab8
-13516,	 // 0x34cc
-15434,	 // 0x3c4a
- 6160,	 // 0x1810
-58597,	 // 0xe4e5
-63473,	 // 0xf7f1
-64775,	 // 0xfd07
- 1541,	 // 0x0605
-  246,	 // 0x00f6
-  248,	 // 0x00f8
- 1789,	 // 0x06fd
-  511,	 // 0x01ff
-65531,	 // 0xfffb
-65276,	 // 0xfefc
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  235,	 // 0x00eb
- 2297,	 // 0x08f9
-61713,	 // 0xf111
-62210,	 // 0xf302
- 3320,	 // 0x0cf8
- 1808,	 // 0x0710
- 1293,	 // 0x050d
- 1281,	 // 0x0501
-65032,	 // 0xfe08
-64764,	 // 0xfcfc
-64257,	 // 0xfb01
-  512,	 // 0x0200
-  511,	 // 0x01ff
-    3,	 // 0x0003
-65281,	 // 0xff01
-  258,	 // 0x0102
-65280,	 // 0xff00
-65282,	 // 0xff02
-    1,	 // 0x0001
-    2,	 // 0x0002
-    1,	 // 0x0001
-56312,	 // 0xdbf8
-60669,	 // 0xecfd
-63480,	 // 0xf7f8
-62699,	 // 0xf4eb
-  247,	 // 0x00f7
- 1290,	 // 0x050a
- 2050,	 // 0x0802
- 1293,	 // 0x050d
-65534,	 // 0xfffe
-65025,	 // 0xfe01
-  768,	 // 0x0300
-  258,	 // 0x0102
-  257,	 // 0x0101
-    1,	 // 0x0001
-  514,	 // 0x0202
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  257,	 // 0x0101
-62977,	 // 0xf601
- 3603,	 // 0x0e13
-61431,	 // 0xeff7
-54492,	 // 0xd4dc
-61138,	 // 0xeed2
- 1278,	 // 0x04fe
- 4876,	 // 0x130c
- 2836,	 // 0x0b14
-  260,	 // 0x0104
-65281,	 // 0xff01
- 1280,	 // 0x0500
-  517,	 // 0x0205
-    2,	 // 0x0002
-    1,	 // 0x0001
-  514,	 // 0x0202
-  514,	 // 0x0202
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-14115,	 // 0x3723
-17198,	 // 0x432e
-56060,	 // 0xdafc
-49363,	 // 0xc0d3
-58309,	 // 0xe3c5
-65521,	 // 0xfff1
- 5903,	 // 0x170f
- 2577,	 // 0x0a11
-    5,	 // 0x0005
-  256,	 // 0x0100
-  770,	 // 0x0302
-  516,	 // 0x0204
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-  258,	 // 0x0102
-  514,	 // 0x0202
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-32516,	 // 0x7f04
- 9518,	 // 0x252e
-60674,	 // 0xed02
-56058,	 // 0xdafa
-63980,	 // 0xf9ec
-64254,	 // 0xfafe
- 2821,	 // 0x0b05
-65031,	 // 0xfe07
-64256,	 // 0xfb00
-  771,	 // 0x0303
-64513,	 // 0xfc01
-  514,	 // 0x0202
-64256,	 // 0xfb00
-  255,	 // 0x00ff
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
- 5866,	 // 0x16ea
-59670,	 // 0xe916
- 3073,	 // 0x0c01
- 2580,	 // 0x0a14
- 4885,	 // 0x1315
-64270,	 // 0xfb0e
-65024,	 // 0xfe00
-63999,	 // 0xf9ff
-64509,	 // 0xfbfd
-  257,	 // 0x0101
-64766,	 // 0xfcfe
-  255,	 // 0x00ff
-64768,	 // 0xfd00
-  257,	 // 0x0101
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    1,	 // 0x0001
-65281,	 // 0xff01
-65535,	 // 0xffff
-60419,	 // 0xec03
-60155,	 // 0xeafb
- 3338,	 // 0x0d0a
- 5127,	 // 0x1407
- 3349,	 // 0x0d15
-   15,	 // 0x000f
-64770,	 // 0xfd02
-64509,	 // 0xfbfd
-64767,	 // 0xfcff
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  257,	 // 0x0101
-    1,	 // 0x0001
-  256,	 // 0x0100
-65535,	 // 0xffff
-  256,	 // 0x0100
-    1,	 // 0x0001
-  255,	 // 0x00ff
-59141,	 // 0xe705
- 1523,	 // 0x05f3
- 1551,	 // 0x060f
- 3842,	 // 0x0f02
-  515,	 // 0x0203
-  777,	 // 0x0309
-65281,	 // 0xff01
-65022,	 // 0xfdfe
-64512,	 // 0xfc00
-  254,	 // 0x00fe
-65280,	 // 0xff00
-  254,	 // 0x00fe
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-61699,	 // 0xf103
- 4347,	 // 0x10fb
-  522,	 // 0x020a
- 2821,	 // 0x0b05
-  249,	 // 0x00f9
-  771,	 // 0x0303
-65022,	 // 0xfdfe
-65022,	 // 0xfdfe
-65023,	 // 0xfdff
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-  257,	 // 0x0101
-  256,	 // 0x0100
-    1,	 // 0x0001
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-    1,	 // 0x0001
-64512,	 // 0xfc00
-  759,	 // 0x02f7
-  766,	 // 0x02fe
- 1287,	 // 0x0507
-  508,	 // 0x01fc
-  257,	 // 0x0101
-65022,	 // 0xfdfe
-65278,	 // 0xfefe
-65279,	 // 0xfeff
-    0,	 // 0x0000
-65281,	 // 0xff01
-65280,	 // 0xff00
-  257,	 // 0x0101
-    1,	 // 0x0001
-  257,	 // 0x0101
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-60145,	 // 0xeaf1
-58085,	 // 0xe2e5
- 3060,	 // 0x0bf4
-  780,	 // 0x030c
- 1279,	 // 0x04ff
-  510,	 // 0x01fe
-65027,	 // 0xfe03
-  767,	 // 0x02ff
-  258,	 // 0x0102
-  515,	 // 0x0203
-65282,	 // 0xff02
-    1,	 // 0x0001
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-   27,	 // 0x001b
-  487,	 // 0x01e7
- 3595,	 // 0x0e0b
-    3,	 // 0x0003
-65280,	 // 0xff00
-  255,	 // 0x00ff
- 1023,	 // 0x03ff
-65025,	 // 0xfe01
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-64012,	 // 0xfa0c
-  765,	 // 0x02fd
-64253,	 // 0xfafd
-  513,	 // 0x0201
- 1028,	 // 0x0404
-  513,	 // 0x0201
-    2,	 // 0x0002
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65021,	 // 0xfdfd
-62957,	 // 0xf5ed
-64245,	 // 0xfaf5
-  773,	 // 0x0305
- 2313,	 // 0x0909
-  259,	 // 0x0103
-  259,	 // 0x0103
-  510,	 // 0x01fe
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-55785,	 // 0xd9e9
-62700,	 // 0xf4ec
- 1526,	 // 0x05f6
-  777,	 // 0x0309
- 1543,	 // 0x0607
-64765,	 // 0xfcfd
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  257,	 // 0x0101
-    2,	 // 0x0002
-  257,	 // 0x0101
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5376,	 // 0x1500
- 3621,	 // 0x0e25
-  772,	 // 0x0304
-64254,	 // 0xfafe
-62710,	 // 0xf4f6
-63222,	 // 0xf6f6
-  763,	 // 0x02fb
-65280,	 // 0xff00
-65535,	 // 0xffff
-65281,	 // 0xff01
-  256,	 // 0x0100
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-32556,	 // 0x7f2c
- 7487,	 // 0x1d3f
-64269,	 // 0xfb0d
-62194,	 // 0xf2f2
-60397,	 // 0xebed
-62966,	 // 0xf5f6
- 1017,	 // 0x03f9
-    0,	 // 0x0000
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-  257,	 // 0x0101
-  257,	 // 0x0101
-  258,	 // 0x0102
-    1,	 // 0x0001
-  256,	 // 0x0100
-  257,	 // 0x0101
-28203,	 // 0x6e2b
- 5143,	 // 0x1417
-64261,	 // 0xfb05
-63479,	 // 0xf7f7
-62711,	 // 0xf4f7
-63996,	 // 0xf9fc
-  253,	 // 0x00fd
-  766,	 // 0x02fe
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
- 1534,	 // 0x05fe
- 1008,	 // 0x03f0
-65021,	 // 0xfdfd
-  770,	 // 0x0302
-  260,	 // 0x0104
-65024,	 // 0xfe00
-65279,	 // 0xfeff
- 1277,	 // 0x04fd
-  256,	 // 0x0100
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-57067,	 // 0xdeeb
-63970,	 // 0xf9e2
-65019,	 // 0xfdfb
- 1285,	 // 0x0505
- 1540,	 // 0x0604
-  256,	 // 0x0100
-65023,	 // 0xfdff
-  767,	 // 0x02ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-58616,	 // 0xe4f8
-64238,	 // 0xfaee
-64762,	 // 0xfcfa
-  259,	 // 0x0103
- 1025,	 // 0x0401
-  512,	 // 0x0200
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-56560,	 // 0xdcf0
-63221,	 // 0xf6f5
- 1011,	 // 0x03f3
-65280,	 // 0xff00
- 1277,	 // 0x04fd
- 1281,	 // 0x0501
- 1025,	 // 0x0401
-65282,	 // 0xff02
-  512,	 // 0x0200
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-   36,	 // 0x0024
-54502,	 // 0xd4e6
- 4915,	 // 0x1333
-62464,	 // 0xf400
-62964,	 // 0xf5f4
-65019,	 // 0xfdfb
-    0,	 // 0x0000
- 1285,	 // 0x0505
-65278,	 // 0xfefe
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    2,	 // 0x0002
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-14640,	 // 0x3930
- 1279,	 // 0x04ff
-61427,	 // 0xeff3
-64762,	 // 0xfcfa
-  511,	 // 0x01ff
-65281,	 // 0xff01
-65023,	 // 0xfdff
-65277,	 // 0xfefd
-  510,	 // 0x01fe
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32608,	 // 0x7f60
-64755,	 // 0xfcf3
-63226,	 // 0xf6fa
-  763,	 // 0x02fb
-    4,	 // 0x0004
-65023,	 // 0xfdff
-64250,	 // 0xfafa
-65534,	 // 0xfffe
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
- 9257,	 // 0x2429
-  253,	 // 0x00fd
- 4109,	 // 0x100d
- 2048,	 // 0x0800
-65030,	 // 0xfe06
-65018,	 // 0xfdfa
-65274,	 // 0xfefa
-  258,	 // 0x0102
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58064,	 // 0xe2d0
- 1049,	 // 0x0419
- 5394,	 // 0x1512
- 2043,	 // 0x07fb
-64768,	 // 0xfd00
-65533,	 // 0xfffd
- 1021,	 // 0x03fd
-65285,	 // 0xff05
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-54225,	 // 0xd3d1
- 1273,	 // 0x04f9
-65027,	 // 0xfe03
-  250,	 // 0x00fa
-  253,	 // 0x00fd
-65283,	 // 0xff03
- 1022,	 // 0x03fe
-65026,	 // 0xfe02
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-54257,	 // 0xd3f1
-  994,	 // 0x03e2
-63227,	 // 0xf6fb
-65284,	 // 0xff04
- 1793,	 // 0x0701
-65285,	 // 0xff05
-  257,	 // 0x0101
-65024,	 // 0xfe00
-  258,	 // 0x0102
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-59624,	 // 0xe8e8
- 1784,	 // 0x06f8
-64512,	 // 0xfc00
-65286,	 // 0xff06
- 1792,	 // 0x0700
-    2,	 // 0x0002
-    1,	 // 0x0001
-65279,	 // 0xfeff
-  257,	 // 0x0101
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-65272,	 // 0xfef8
-63493,	 // 0xf805
-  256,	 // 0x0100
-65282,	 // 0xff02
-  510,	 // 0x01fe
-65283,	 // 0xff03
-    0,	 // 0x0000
-65280,	 // 0xff00
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-62726,	 // 0xf506
- 1277,	 // 0x04fd
-    2,	 // 0x0002
-  511,	 // 0x01ff
-  259,	 // 0x0103
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2801,	 // 0x0af1
-61946,	 // 0xf1fa
-  495,	 // 0x01ef
-65283,	 // 0xff03
-  253,	 // 0x00fd
-  260,	 // 0x0104
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    1,	 // 0x0001
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   33,	 // 0x0021
- 5874,	 // 0x16f2
-65023,	 // 0xfdff
-64798,	 // 0xfd1e
-64499,	 // 0xfbf3
-   13,	 // 0x000d
- 1023,	 // 0x03ff
-64768,	 // 0xfd00
-    4,	 // 0x0004
-65277,	 // 0xfefd
-    4,	 // 0x0004
-65282,	 // 0xff02
-    1,	 // 0x0001
-65535,	 // 0xffff
-64769,	 // 0xfd01
-    1,	 // 0x0001
-65281,	 // 0xff01
-65280,	 // 0xff00
-65024,	 // 0xfe00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  507,	 // 0x01fb
-62215,	 // 0xf307
- 1786,	 // 0x06fa
-63239,	 // 0xf707
- 1275,	 // 0x04fb
-65029,	 // 0xfe05
-65532,	 // 0xfffc
-    2,	 // 0x0002
-65022,	 // 0xfdfe
-    2,	 // 0x0002
-65280,	 // 0xff00
-65280,	 // 0xff00
-65534,	 // 0xfffe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-58367,	 // 0xe3ff
-57869,	 // 0xe20d
- 3801,	 // 0x0ed9
-60960,	 // 0xee20
- 4074,	 // 0x0fea
-63243,	 // 0xf70b
-  761,	 // 0x02f9
-  517,	 // 0x0205
-64766,	 // 0xfcfe
-    3,	 // 0x0003
-65278,	 // 0xfefe
-    1,	 // 0x0001
-65535,	 // 0xffff
-    2,	 // 0x0002
-65535,	 // 0xffff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  256,	 // 0x0100
-56574,	 // 0xdcfe
-64040,	 // 0xfa28
-  446,	 // 0x01be
- 1596,	 // 0x063c
-  466,	 // 0x01d2
-63775,	 // 0xf91f
-65266,	 // 0xfef2
-  260,	 // 0x0104
-64254,	 // 0xfafe
-  515,	 // 0x0203
-65022,	 // 0xfdfe
-    1,	 // 0x0001
-65024,	 // 0xfe00
-    0,	 // 0x0000
-65279,	 // 0xfeff
-    1,	 // 0x0001
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
- 1020,	 // 0x03fc
-13874,	 // 0x3632
-48069,	 // 0xbbc5
-19002,	 // 0x4a3a
-51418,	 // 0xc8da
- 5414,	 // 0x1526
-58870,	 // 0xe5f6
- 1014,	 // 0x03f6
-64004,	 // 0xfa04
-  765,	 // 0x02fd
-65534,	 // 0xfffe
-  253,	 // 0x00fd
-64769,	 // 0xfd01
-    1,	 // 0x0001
-64769,	 // 0xfd01
-65280,	 // 0xff00
-65027,	 // 0xfe03
-65025,	 // 0xfe01
-65281,	 // 0xff01
-65535,	 // 0xffff
-55824,	 // 0xda10
-32742,	 // 0x7fe6
-34313,	 // 0x8609
-27111,	 // 0x69e7
-43040,	 // 0xa820
- 9968,	 // 0x26f0
-58897,	 // 0xe611
- 1252,	 // 0x04e4
-   13,	 // 0x000d
-  501,	 // 0x01f5
-  511,	 // 0x01ff
-65532,	 // 0xfffc
-64770,	 // 0xfd02
-    0,	 // 0x0000
-65027,	 // 0xfe03
-65535,	 // 0xffff
-    3,	 // 0x0003
-65025,	 // 0xfe01
-  256,	 // 0x0100
-65280,	 // 0xff00
- 4623,	 // 0x120f
-19139,	 // 0x4ac3
-51561,	 // 0xc969
- 6278,	 // 0x1886
-60006,	 // 0xea66
- 1972,	 // 0x07b4
- 3623,	 // 0x0e27
-60907,	 // 0xedeb
- 3597,	 // 0x0e0d
-65014,	 // 0xfdf6
-    5,	 // 0x0005
-65533,	 // 0xfffd
-65029,	 // 0xfe05
-65534,	 // 0xfffe
-  258,	 // 0x0102
-65024,	 // 0xfe00
-  257,	 // 0x0101
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-65281,	 // 0xff01
-17930,	 // 0x460a
-52134,	 // 0xcba6
-15992,	 // 0x3e78
-46483,	 // 0xb593
-15448,	 // 0x3c58
-58565,	 // 0xe4c5
- 8470,	 // 0x2116
-59649,	 // 0xe901
- 3586,	 // 0x0e02
-64763,	 // 0xfcfb
-65031,	 // 0xfe07
-  254,	 // 0x00fe
-65285,	 // 0xff05
-65535,	 // 0xffff
-  512,	 // 0x0200
-65280,	 // 0xff00
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    1,	 // 0x0001
- 1038,	 // 0x040e
-36809,	 // 0x8fc9
-29236,	 // 0x7234
-41955,	 // 0xa3e3
-17941,	 // 0x4615
-57344,	 // 0xe000
- 5369,	 // 0x14f9
-61967,	 // 0xf20f
- 2554,	 // 0x09fa
-64514,	 // 0xfc02
-  515,	 // 0x0203
-64512,	 // 0xfc00
-  514,	 // 0x0202
-65280,	 // 0xff00
-  767,	 // 0x02ff
-  258,	 // 0x0102
-65534,	 // 0xfffe
-  256,	 // 0x0100
-65024,	 // 0xfe00
-    0,	 // 0x0000
-64503,	 // 0xfbf7
-51708,	 // 0xc9fc
-19975,	 // 0x4e07
-55064,	 // 0xd718
- 7397,	 // 0x1ce5
-61981,	 // 0xf21d
-  237,	 // 0x00ed
-65293,	 // 0xff0d
- 1272,	 // 0x04f8
-65028,	 // 0xfe04
- 1278,	 // 0x04fe
-65024,	 // 0xfe00
-  767,	 // 0x02ff
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-  257,	 // 0x0101
-65535,	 // 0xffff
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-61425,	 // 0xeff1
- 3360,	 // 0x0d20
- 6365,	 // 0x18dd
-65336,	 // 0xff38
-64978,	 // 0xfdd2
-  542,	 // 0x021e
-61678,	 // 0xf0ee
- 1541,	 // 0x0605
- 1020,	 // 0x03fc
-65282,	 // 0xff02
- 1021,	 // 0x03fd
-65025,	 // 0xfe01
-  256,	 // 0x0100
-  257,	 // 0x0101
-65535,	 // 0xffff
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  249,	 // 0x00f9
-  237,	 // 0x00ed
-64268,	 // 0xfb0c
-63991,	 // 0xf9f7
-62709,	 // 0xf4f5
-  770,	 // 0x0302
- 1032,	 // 0x0408
-  258,	 // 0x0102
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65281,	 // 0xff01
-65534,	 // 0xfffe
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-60417,	 // 0xec01
-  774,	 // 0x0306
-65021,	 // 0xfdfd
-64247,	 // 0xfaf7
- 1286,	 // 0x0506
-  517,	 // 0x0205
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-  512,	 // 0x0200
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
- 3569,	 // 0x0df1
- 3081,	 // 0x0c09
-63997,	 // 0xf9fd
-  766,	 // 0x02fe
- 1802,	 // 0x070a
-65283,	 // 0xff03
-  249,	 // 0x00f9
-    1,	 // 0x0001
-  513,	 // 0x0201
-    0,	 // 0x0000
-65281,	 // 0xff01
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-60679,	 // 0xed07
- 4361,	 // 0x1109
-61428,	 // 0xeff4
- 3075,	 // 0x0c03
-  266,	 // 0x010a
-64762,	 // 0xfcfa
- 1531,	 // 0x05fb
-  263,	 // 0x0107
-  258,	 // 0x0102
-  511,	 // 0x01ff
-65281,	 // 0xff01
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-56049,	 // 0xdaf1
- 3867,	 // 0x0f1b
-64508,	 // 0xfbfc
- 3589,	 // 0x0e05
-63482,	 // 0xf7fa
-65524,	 // 0xfff4
- 2560,	 // 0x0a00
-64522,	 // 0xfc0a
-  511,	 // 0x01ff
-  253,	 // 0x00fd
-  254,	 // 0x00fe
-  257,	 // 0x0101
-65535,	 // 0xffff
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  512,	 // 0x0200
-  256,	 // 0x0100
-  257,	 // 0x0101
-  256,	 // 0x0100
-  257,	 // 0x0101
- 7362,	 // 0x1cc2
-52455,	 // 0xcce7
- 7695,	 // 0x1e0f
- 1546,	 // 0x060a
-64256,	 // 0xfb00
-  508,	 // 0x01fc
-  514,	 // 0x0202
-63491,	 // 0xf803
- 1025,	 // 0x0401
-65275,	 // 0xfefb
-  766,	 // 0x02fe
-65282,	 // 0xff02
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-17953,	 // 0x4621
-43393,	 // 0xa981
- 6410,	 // 0x190a
-65032,	 // 0xfe08
-63768,	 // 0xf918
-   10,	 // 0x000a
-62728,	 // 0xf508
-65271,	 // 0xfef7
-  772,	 // 0x0304
-  508,	 // 0x01fc
-  765,	 // 0x02fd
-64768,	 // 0xfd00
-  254,	 // 0x00fe
-    0,	 // 0x0000
-65534,	 // 0xfffe
-65279,	 // 0xfeff
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
- 9339,	 // 0x247b
-58586,	 // 0xe4da
-62461,	 // 0xf3fd
-64504,	 // 0xfbf8
-60690,	 // 0xed12
- 1033,	 // 0x0409
-63497,	 // 0xf809
- 1525,	 // 0x05f5
-    2,	 // 0x0002
-  767,	 // 0x02ff
-  508,	 // 0x01fc
-65023,	 // 0xfdff
-  254,	 // 0x00fe
-65281,	 // 0xff01
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-65281,	 // 0xff01
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-65290,	 // 0xff0a
-19022,	 // 0x4a4e
-59399,	 // 0xe807
-65526,	 // 0xfff6
-61429,	 // 0xeff5
- 1536,	 // 0x0600
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65022,	 // 0xfdfe
-  514,	 // 0x0202
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65281,	 // 0xff01
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-58324,	 // 0xe3d4
-13598,	 // 0x351e
-64769,	 // 0xfd01
-  769,	 // 0x0301
-63983,	 // 0xf9ef
-  767,	 // 0x02ff
- 1016,	 // 0x03f8
-65029,	 // 0xfe05
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  256,	 // 0x0100
-    1,	 // 0x0001
-65535,	 // 0xffff
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
- 4085,	 // 0x0ff5
-62199,	 // 0xf2f7
- 2022,	 // 0x07e6
-65290,	 // 0xff0a
-  757,	 // 0x02f5
-  257,	 // 0x0101
-  763,	 // 0x02fb
-65280,	 // 0xff00
- 1022,	 // 0x03fe
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-65534,	 // 0xfffe
-65278,	 // 0xfefe
-65535,	 // 0xffff
-  510,	 // 0x01fe
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-   27,	 // 0x001b
-55557,	 // 0xd905
-32744,	 // 0x7fe8
-47356,	 // 0xb8fc
- 7934,	 // 0x1efe
-60920,	 // 0xedf8
- 2312,	 // 0x0908
-64769,	 // 0xfd01
- 1786,	 // 0x06fa
-63746,	 // 0xf902
- 1027,	 // 0x0403
-65533,	 // 0xfffd
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-  257,	 // 0x0101
-65535,	 // 0xffff
-65280,	 // 0xff00
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-61440,	 // 0xf000
-14336,	 // 0x3800
-56822,	 // 0xddf6
- 4617,	 // 0x1209
-63221,	 // 0xf6f5
-  521,	 // 0x0209
-65534,	 // 0xfffe
- 1021,	 // 0x03fd
-64513,	 // 0xfc01
-  512,	 // 0x0200
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-61957,	 // 0xf205
- 6654,	 // 0x19fe
-61691,	 // 0xf0fb
- 2313,	 // 0x0909
-  245,	 // 0x00f5
-64775,	 // 0xfd07
-  764,	 // 0x02fc
-  256,	 // 0x0100
-65025,	 // 0xfe01
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65532,	 // 0xfffc
-62468,	 // 0xf404
- 1026,	 // 0x0402
- 1539,	 // 0x0603
- 1530,	 // 0x05fa
-64770,	 // 0xfd02
-  767,	 // 0x02ff
-  256,	 // 0x0100
-65281,	 // 0xff01
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2816,	 // 0x0b00
-62729,	 // 0xf509
-  518,	 // 0x0206
- 1791,	 // 0x06ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  515,	 // 0x0203
-64511,	 // 0xfbff
-64771,	 // 0xfd03
-  769,	 // 0x0301
-    0,	 // 0x0000
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1020,	 // 0x03fc
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-  259,	 // 0x0103
-  510,	 // 0x01fe
-    1,	 // 0x0001
-  254,	 // 0x00fe
-  257,	 // 0x0101
-  767,	 // 0x02ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65278,	 // 0xfefe
-64511,	 // 0xfbff
- 1533,	 // 0x05fd
-65280,	 // 0xff00
-  510,	 // 0x01fe
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65278,	 // 0xfefe
-65534,	 // 0xfffe
- 1279,	 // 0x04ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  509,	 // 0x01fd
- 1023,	 // 0x03ff
-  255,	 // 0x00ff
-    3,	 // 0x0003
-  511,	 // 0x01ff
-    1,	 // 0x0001
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  769,	 // 0x0301
-62720,	 // 0xf500
- 2560,	 // 0x0a00
-65280,	 // 0xff00
-    4,	 // 0x0004
-  509,	 // 0x01fd
-65281,	 // 0xff01
-65281,	 // 0xff01
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  252,	 // 0x00fc
-44347,	 // 0xad3b
-64262,	 // 0xfb06
-58874,	 // 0xe5fa
-65259,	 // 0xfeeb
-64515,	 // 0xfc03
- 2058,	 // 0x080a
- 1021,	 // 0x03fd
-  509,	 // 0x01fd
-65281,	 // 0xff01
-  768,	 // 0x0300
-  512,	 // 0x0200
-    1,	 // 0x0001
-  511,	 // 0x01ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-65280,	 // 0xff00
-51444,	 // 0xc8f4
-  254,	 // 0x00fe
- 1783,	 // 0x06f7
- 2302,	 // 0x08fe
- 1024,	 // 0x0400
-    1,	 // 0x0001
-64506,	 // 0xfbfa
-  513,	 // 0x0201
-  510,	 // 0x01fe
-  257,	 // 0x0101
-  512,	 // 0x0200
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-54983,	 // 0xd6c7
- 4892,	 // 0x131c
- 5368,	 // 0x14f8
- 3093,	 // 0x0c15
- 2044,	 // 0x07fc
-63479,	 // 0xf7f7
-63995,	 // 0xf9fb
-  770,	 // 0x0302
-  765,	 // 0x02fd
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-62713,	 // 0xf4f9
-10747,	 // 0x29fb
-65521,	 // 0xfff1
-64811,	 // 0xfd2b
- 3323,	 // 0x0cfb
-63221,	 // 0xf6f5
-65281,	 // 0xff01
-  516,	 // 0x0204
- 1019,	 // 0x03fb
-64513,	 // 0xfc01
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-65279,	 // 0xfeff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  256,	 // 0x0100
-55307,	 // 0xd80b
- 4572,	 // 0x11dc
-61154,	 // 0xeee2
-61993,	 // 0xf229
- 1532,	 // 0x05fc
-65526,	 // 0xfff6
- 1032,	 // 0x0408
-  516,	 // 0x0204
- 1022,	 // 0x03fe
-64002,	 // 0xfa02
-    0,	 // 0x0000
-  257,	 // 0x0101
-65281,	 // 0xff01
-65281,	 // 0xff01
-65024,	 // 0xfe00
-65281,	 // 0xff01
-65281,	 // 0xff01
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-50451,	 // 0xc513
-62707,	 // 0xf4f3
-63990,	 // 0xf9f6
-61194,	 // 0xef0a
-63736,	 // 0xf8f8
- 1009,	 // 0x03f1
-65282,	 // 0xff02
- 1026,	 // 0x0402
-  255,	 // 0x00ff
-64261,	 // 0xfb05
-    1,	 // 0x0001
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 8483,	 // 0x2123
-58642,	 // 0xe512
-64528,	 // 0xfc10
-62963,	 // 0xf5f3
-60906,	 // 0xedea
- 1787,	 // 0x06fb
-63991,	 // 0xf9f7
- 1026,	 // 0x0402
-65277,	 // 0xfefd
-64772,	 // 0xfd04
-65535,	 // 0xffff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  257,	 // 0x0101
-    1,	 // 0x0001
-  257,	 // 0x0101
-  257,	 // 0x0101
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-30463,	 // 0x76ff
-56337,	 // 0xdc11
- 1038,	 // 0x040e
- 2811,	 // 0x0afb
-60140,	 // 0xeaec
- 2054,	 // 0x0806
-62711,	 // 0xf4f7
- 1791,	 // 0x06ff
-65534,	 // 0xfffe
-65283,	 // 0xff03
-65535,	 // 0xffff
-    0,	 // 0x0000
-  510,	 // 0x01fe
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-  513,	 // 0x0201
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-27869,	 // 0x6cdd
-55035,	 // 0xd6fb
- 1539,	 // 0x0603
- 4611,	 // 0x1203
-61434,	 // 0xeffa
- 1023,	 // 0x03ff
-63232,	 // 0xf700
- 1275,	 // 0x04fb
-  257,	 // 0x0101
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-65280,	 // 0xff00
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-23786,	 // 0x5cea
-57840,	 // 0xe1f0
-64004,	 // 0xfa04
- 1787,	 // 0x06fb
-61699,	 // 0xf103
-65016,	 // 0xfdf8
-65028,	 // 0xfe04
-  506,	 // 0x01fa
-    4,	 // 0x0004
-  255,	 // 0x00ff
-65024,	 // 0xfe00
-    3,	 // 0x0003
-  512,	 // 0x0200
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  512,	 // 0x0200
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-10504,	 // 0x2908
-59370,	 // 0xe7ea
-64797,	 // 0xfd1d
-65503,	 // 0xffdf
-64532,	 // 0xfc14
-64245,	 // 0xfaf5
-  775,	 // 0x0307
-65017,	 // 0xfdf9
-    8,	 // 0x0008
-  510,	 // 0x01fe
-64514,	 // 0xfc02
-    4,	 // 0x0004
-  513,	 // 0x0201
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-65281,	 // 0xff01
-  767,	 // 0x02ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-  127,	 // 0x007f
-54770,	 // 0xd5f2
-61926,	 // 0xf1e6
- 3321,	 // 0x0cf9
-63244,	 // 0xf70c
-    5,	 // 0x0005
-  500,	 // 0x01f4
-62204,	 // 0xf2fc
- 2817,	 // 0x0b01
-64763,	 // 0xfcfb
-64770,	 // 0xfd02
-    0,	 // 0x0000
- 1019,	 // 0x03fb
-64765,	 // 0xfcfd
-  255,	 // 0x00ff
-65021,	 // 0xfdfd
-    0,	 // 0x0000
-  254,	 // 0x00fe
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
- 5903,	 // 0x170f
- 3323,	 // 0x0cfb
- 1547,	 // 0x060b
-65270,	 // 0xfef6
-64002,	 // 0xfa02
-65012,	 // 0xfdf4
-65534,	 // 0xfffe
- 1283,	 // 0x0503
-64766,	 // 0xfcfe
-65024,	 // 0xfe00
-  508,	 // 0x01fc
-  764,	 // 0x02fc
-65276,	 // 0xfefc
-  254,	 // 0x00fe
-65532,	 // 0xfffc
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
- 9964,	 // 0x26ec
- 2306,	 // 0x0902
-64525,	 // 0xfc0d
- 1001,	 // 0x03e9
-65273,	 // 0xfef9
-64512,	 // 0xfc00
- 1787,	 // 0x06fb
-64258,	 // 0xfb02
-64251,	 // 0xfafb
-65281,	 // 0xff01
- 1275,	 // 0x04fb
-  508,	 // 0x01fc
-65532,	 // 0xfffc
-  254,	 // 0x00fe
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-59097,	 // 0xe6d9
- 7186,	 // 0x1c12
-  263,	 // 0x0107
- 2560,	 // 0x0a00
-  230,	 // 0x00e6
-64784,	 // 0xfd10
- 1016,	 // 0x03f8
-63741,	 // 0xf8fd
-63997,	 // 0xf9fd
-  262,	 // 0x0106
- 1021,	 // 0x03fd
-65276,	 // 0xfefc
-64508,	 // 0xfbfc
-65280,	 // 0xff00
-64768,	 // 0xfd00
-  254,	 // 0x00fe
-65534,	 // 0xfffe
-65280,	 // 0xff00
-65535,	 // 0xffff
-  254,	 // 0x00fe
-43280,	 // 0xa910
- 8676,	 // 0x21e4
- 5125,	 // 0x1405
-59667,	 // 0xe913
- 2520,	 // 0x09d8
-64802,	 // 0xfd22
-63478,	 // 0xf7f6
-65521,	 // 0xfff1
-62478,	 // 0xf40e
- 1789,	 // 0x06fd
- 1025,	 // 0x0401
-64760,	 // 0xfcf8
-64255,	 // 0xfaff
-  766,	 // 0x02fe
-64513,	 // 0xfc01
- 1022,	 // 0x03fe
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65278,	 // 0xfefe
-65533,	 // 0xfffd
- 7457,	 // 0x1d21
-54461,	 // 0xd4bd
-13867,	 // 0x362b
-40198,	 // 0x9d06
- 7897,	 // 0x1ed9
-  319,	 // 0x013f
-61427,	 // 0xeff3
- 3836,	 // 0x0efc
-59671,	 // 0xe917
- 3829,	 // 0x0ef5
-  266,	 // 0x010a
-65267,	 // 0xfef3
-64260,	 // 0xfb04
-65532,	 // 0xfffc
-65027,	 // 0xfe03
-  767,	 // 0x02ff
-65278,	 // 0xfefe
-65025,	 // 0xfe01
-65535,	 // 0xffff
-65278,	 // 0xfefe
- 8956,	 // 0x22fc
-47077,	 // 0xb7e5
-24380,	 // 0x5f3c
-33026,	 // 0x8102
-11466,	 // 0x2cca
- 2112,	 // 0x0840
-58349,	 // 0xe3ed
- 9227,	 // 0x240b
-57101,	 // 0xdf0d
- 5106,	 // 0x13f2
-  269,	 // 0x010d
-  755,	 // 0x02f3
-64260,	 // 0xfb04
-    0,	 // 0x0000
-    1,	 // 0x0001
-  514,	 // 0x0202
-65021,	 // 0xfdfd
-65281,	 // 0xff01
-65280,	 // 0xff00
-65024,	 // 0xfe00
-   23,	 // 0x0017
-51735,	 // 0xca17
-27720,	 // 0x6c48
-40970,	 // 0xa00a
- 7103,	 // 0x1bbf
-  810,	 // 0x032a
-59118,	 // 0xe6ee
- 8211,	 // 0x2013
-58109,	 // 0xe2fd
- 3832,	 // 0x0ef8
-  265,	 // 0x0109
- 1016,	 // 0x03f8
-65024,	 // 0xfe00
-65280,	 // 0xff00
-    0,	 // 0x0000
-  517,	 // 0x0205
-65277,	 // 0xfefd
-    1,	 // 0x0001
-  257,	 // 0x0101
-65281,	 // 0xff01
-   46,	 // 0x002e
-51679,	 // 0xc9df
-24874,	 // 0x612a
-49699,	 // 0xc223
- 5841,	 // 0x16d1
-65303,	 // 0xff17
-62458,	 // 0xf3fa
- 3847,	 // 0x0f07
-63480,	 // 0xf7f8
-65531,	 // 0xfffb
- 2048,	 // 0x0800
-  254,	 // 0x00fe
-  506,	 // 0x01fa
-65282,	 // 0xff02
-  509,	 // 0x01fd
-    3,	 // 0x0003
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  512,	 // 0x0200
-65280,	 // 0xff00
- 8978,	 // 0x2312
-54744,	 // 0xd5d8
-19223,	 // 0x4b17
-54046,	 // 0xd31e
- 6635,	 // 0x19eb
-65032,	 // 0xfe08
-64515,	 // 0xfc03
- 1531,	 // 0x05fb
-  506,	 // 0x01fa
-65017,	 // 0xfdf9
- 1793,	 // 0x0701
-65020,	 // 0xfdfc
-  762,	 // 0x02fa
-65280,	 // 0xff00
-  252,	 // 0x00fc
-65281,	 // 0xff01
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  767,	 // 0x02ff
-  511,	 // 0x01ff
- 1724,	 // 0x06bc
- 7078,	 // 0x1ba6
-12342,	 // 0x3036
-57606,	 // 0xe106
- 2311,	 // 0x0907
-65530,	 // 0xfffa
-64000,	 // 0xfa00
-  500,	 // 0x01f4
- 1018,	 // 0x03fa
-65264,	 // 0xfef0
-  767,	 // 0x02ff
-65022,	 // 0xfdfe
-  508,	 // 0x01fc
-65531,	 // 0xfffb
-65533,	 // 0xfffd
-  255,	 // 0x00ff
-  253,	 // 0x00fd
-  255,	 // 0x00ff
-  256,	 // 0x0100
-65535,	 // 0xffff
-   23,	 // 0x0017
-44285,	 // 0xacfd
- 7103,	 // 0x1bbf
-57869,	 // 0xe20d
-10470,	 // 0x28e6
-61466,	 // 0xf01a
- 2294,	 // 0x08f6
-65534,	 // 0xfffe
-65029,	 // 0xfe05
- 2812,	 // 0x0afc
-  504,	 // 0x01f8
-65022,	 // 0xfdfe
-  768,	 // 0x0300
-65533,	 // 0xfffd
-  257,	 // 0x0101
-  765,	 // 0x02fd
-  253,	 // 0x00fd
-    0,	 // 0x0000
-  766,	 // 0x02fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
- 9740,	 // 0x260c
- 3518,	 // 0x0dbe
- 2365,	 // 0x093d
- 2270,	 // 0x08de
-59419,	 // 0xe81b
- 1778,	 // 0x06f2
-63752,	 // 0xf908
-  513,	 // 0x0201
- 1022,	 // 0x03fe
-  251,	 // 0x00fb
-65024,	 // 0xfe00
-  513,	 // 0x0201
-64767,	 // 0xfcff
-  256,	 // 0x0100
-  765,	 // 0x02fd
-65024,	 // 0xfe00
-    2,	 // 0x0002
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
- 9981,	 // 0x26fd
-53697,	 // 0xd1c1
-15951,	 // 0x3e4f
-58072,	 // 0xe2d8
-59424,	 // 0xe820
- 3294,	 // 0x0cde
-62741,	 // 0xf515
- 3324,	 // 0x0cfc
- 1279,	 // 0x04ff
-  253,	 // 0x00fd
-  256,	 // 0x0100
-  513,	 // 0x0201
-65019,	 // 0xfdfb
-  767,	 // 0x02ff
-  764,	 // 0x02fc
-65280,	 // 0xff00
-    2,	 // 0x0002
-65535,	 // 0xffff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-15089,	 // 0x3af1
-38115,	 // 0x94e3
-27453,	 // 0x6b3d
-48103,	 // 0xbbe7
-61976,	 // 0xf218
- 2009,	 // 0x07d9
-63525,	 // 0xf825
- 3316,	 // 0x0cf4
-65028,	 // 0xfe04
-  766,	 // 0x02fe
-    2,	 // 0x0002
-  513,	 // 0x0201
-65019,	 // 0xfdfb
-  764,	 // 0x02fc
-  254,	 // 0x00fe
-65025,	 // 0xfe01
-  257,	 // 0x0101
-65535,	 // 0xffff
-  256,	 // 0x0100
-  257,	 // 0x0101
- 8724,	 // 0x2214
-33257,	 // 0x81e9
-21011,	 // 0x5213
-47868,	 // 0xbafc
-63504,	 // 0xf810
-63981,	 // 0xf9ed
-  547,	 // 0x0223
- 1265,	 // 0x04f1
-    5,	 // 0x0005
-  256,	 // 0x0100
-    1,	 // 0x0001
-  767,	 // 0x02ff
-65276,	 // 0xfefc
-65531,	 // 0xfffb
-65534,	 // 0xfffe
-65023,	 // 0xfdff
-    1,	 // 0x0001
-65535,	 // 0xffff
-    0,	 // 0x0000
-  513,	 // 0x0201
-15355,	 // 0x3bfb
-49141,	 // 0xbff5
- 7933,	 // 0x1efd
-57880,	 // 0xe218
-64255,	 // 0xfaff
-61435,	 // 0xeffb
-    5,	 // 0x0005
-  253,	 // 0x00fd
- 1272,	 // 0x04f8
-65285,	 // 0xff05
-  253,	 // 0x00fd
-  765,	 // 0x02fd
-65021,	 // 0xfdfd
-65021,	 // 0xfdfd
-65535,	 // 0xffff
-65279,	 // 0xfeff
-65283,	 // 0xff03
-65280,	 // 0xff00
-65279,	 // 0xfeff
-  512,	 // 0x0200
-62218,	 // 0xf30a
- 1014,	 // 0x03f6
- 4091,	 // 0x0ffb
-61721,	 // 0xf119
- 1275,	 // 0x04fb
-60669,	 // 0xecfd
- 1010,	 // 0x03f2
-  261,	 // 0x0105
- 1011,	 // 0x03f3
-65031,	 // 0xfe07
-    0,	 // 0x0000
-  765,	 // 0x02fd
-  254,	 // 0x00fe
-65023,	 // 0xfdff
-  511,	 // 0x01ff
-65535,	 // 0xffff
-65281,	 // 0xff01
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  767,	 // 0x02ff
-48653,	 // 0xbe0d
- 4132,	 // 0x1024
- 6139,	 // 0x17fb
-62219,	 // 0xf30b
- 4862,	 // 0x12fe
-64508,	 // 0xfbfc
- 1783,	 // 0x06f7
- 1282,	 // 0x0502
-  504,	 // 0x01f8
-65029,	 // 0xfe05
-  516,	 // 0x0204
-  767,	 // 0x02ff
-  513,	 // 0x0201
-65025,	 // 0xfe01
- 1024,	 // 0x0400
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  511,	 // 0x01ff
- 5873,	 // 0x16f1
- 6935,	 // 0x1b17
- 1269,	 // 0x04f5
-64511,	 // 0xfbff
- 2557,	 // 0x09fd
- 2557,	 // 0x09fd
-  254,	 // 0x00fe
- 1278,	 // 0x04fe
-  766,	 // 0x02fe
-65284,	 // 0xff04
-  769,	 // 0x0301
-  256,	 // 0x0100
-  258,	 // 0x0102
-  257,	 // 0x0101
-  513,	 // 0x0201
-  256,	 // 0x0100
-  257,	 // 0x0101
-  766,	 // 0x02fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
- 8434,	 // 0x20f2
- 1535,	 // 0x05ff
-63725,	 // 0xf8ed
-  257,	 // 0x0101
- 1021,	 // 0x03fd
- 2563,	 // 0x0a03
-65279,	 // 0xfeff
- 1021,	 // 0x03fd
-  767,	 // 0x02ff
-    2,	 // 0x0002
-  768,	 // 0x0300
-65535,	 // 0xffff
-  258,	 // 0x0102
-    1,	 // 0x0001
-  768,	 // 0x0300
-  512,	 // 0x0200
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  259,	 // 0x0103
- 2569,	 // 0x0a09
-61930,	 // 0xf1ea
- 5381,	 // 0x1505
-  250,	 // 0x00fa
- 1802,	 // 0x070a
-65525,	 // 0xfff5
-65283,	 // 0xff03
- 1281,	 // 0x0501
-  513,	 // 0x0201
- 1022,	 // 0x03fe
-65280,	 // 0xff00
-  258,	 // 0x0102
-    1,	 // 0x0001
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-   41,	 // 0x0029
-32535,	 // 0x7f17
-57596,	 // 0xe0fc
-54482,	 // 0xd4d2
-57301,	 // 0xdfd5
- 5648,	 // 0x1610
-  516,	 // 0x0204
- 1284,	 // 0x0504
-65020,	 // 0xfdfc
- 1279,	 // 0x04ff
-  256,	 // 0x0100
-65535,	 // 0xffff
-65533,	 // 0xfffd
-65023,	 // 0xfdff
-  255,	 // 0x00ff
-65023,	 // 0xfdff
-65278,	 // 0xfefe
-65279,	 // 0xfeff
-65281,	 // 0xff01
-    0,	 // 0x0000
-  255,	 // 0x00ff
-31303,	 // 0x7a47
-64235,	 // 0xfaeb
-63486,	 // 0xf7fe
-59110,	 // 0xe6e6
- 5380,	 // 0x1504
-63999,	 // 0xf9ff
- 1534,	 // 0x05fe
-65020,	 // 0xfdfc
-  765,	 // 0x02fd
-    1,	 // 0x0001
-  256,	 // 0x0100
-65277,	 // 0xfefd
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65280,	 // 0xff00
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-10758,	 // 0x2a06
- 3083,	 // 0x0c0b
- 3610,	 // 0x0e1a
-63733,	 // 0xf8f5
- 2556,	 // 0x09fc
-63740,	 // 0xf8fc
- 2049,	 // 0x0801
-64764,	 // 0xfcfc
-  507,	 // 0x01fb
-65025,	 // 0xfe01
-  512,	 // 0x0200
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-65533,	 // 0xfffd
-65535,	 // 0xffff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-60360,	 // 0xebc8
- 8491,	 // 0x212b
- 6953,	 // 0x1b29
- 3590,	 // 0x0e06
-64504,	 // 0xfbf8
-64513,	 // 0xfc01
- 2051,	 // 0x0803
-63996,	 // 0xf9fc
-65531,	 // 0xfffb
-65021,	 // 0xfdfd
-  767,	 // 0x02ff
-  510,	 // 0x01fe
-65534,	 // 0xfffe
-  253,	 // 0x00fd
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-61181,	 // 0xeefd
- 4094,	 // 0x0ffe
- 2829,	 // 0x0b0d
- 2571,	 // 0x0a0b
-64762,	 // 0xfcfa
-  772,	 // 0x0304
-  260,	 // 0x0104
-65273,	 // 0xfef9
-65024,	 // 0xfe00
-65531,	 // 0xfffb
-  511,	 // 0x01ff
-  509,	 // 0x01fd
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  512,	 // 0x0200
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
- 5127,	 // 0x1407
- 1499,	 // 0x05db
-63996,	 // 0xf9fc
-  523,	 // 0x020b
-    0,	 // 0x0000
- 1282,	 // 0x0502
-64514,	 // 0xfc02
- 1274,	 // 0x04fa
-64513,	 // 0xfc01
-  765,	 // 0x02fd
-65280,	 // 0xff00
-  253,	 // 0x00fd
-65535,	 // 0xffff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65021,	 // 0xfdfd
-  751,	 // 0x02ef
-63735,	 // 0xf8f7
-  265,	 // 0x0109
-  511,	 // 0x01ff
- 1021,	 // 0x03fd
-64511,	 // 0xfbff
- 1534,	 // 0x05fe
-65021,	 // 0xfdfd
-  770,	 // 0x0302
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-61175,	 // 0xeef7
-64772,	 // 0xfd04
-64763,	 // 0xfcfb
- 2565,	 // 0x0a05
-65534,	 // 0xfffe
- 1020,	 // 0x03fc
-64766,	 // 0xfcfe
-  766,	 // 0x02fe
-65534,	 // 0xfffe
-  514,	 // 0x0202
-65280,	 // 0xff00
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-63476,	 // 0xf7f4
-63223,	 // 0xf6f7
-    0,	 // 0x0000
- 2560,	 // 0x0a00
-65279,	 // 0xfeff
-  253,	 // 0x00fd
-65278,	 // 0xfefe
-  253,	 // 0x00fd
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-64510,	 // 0xfbfe
-63992,	 // 0xf9f8
-65283,	 // 0xff03
- 1021,	 // 0x03fd
-65279,	 // 0xfeff
-65533,	 // 0xfffd
-  511,	 // 0x01ff
-  252,	 // 0x00fc
-    2,	 // 0x0002
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-54259,	 // 0xd3f3
- 1782,	 // 0x06f6
- 1025,	 // 0x0401
- 1017,	 // 0x03f9
-  510,	 // 0x01fe
-65531,	 // 0xfffb
- 1022,	 // 0x03fe
-  509,	 // 0x01fd
-  513,	 // 0x0201
-  766,	 // 0x02fe
-  256,	 // 0x0100
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-65535,	 // 0xffff
-    5,	 // 0x0005
-  535,	 // 0x0217
-60491,	 // 0xec4b
- 5660,	 // 0x161c
-63740,	 // 0xf8fc
-64768,	 // 0xfd00
-65530,	 // 0xfffa
- 1027,	 // 0x0403
- 1543,	 // 0x0607
-    2,	 // 0x0002
- 1032,	 // 0x0408
-  261,	 // 0x0105
-    5,	 // 0x0005
-  769,	 // 0x0301
-  259,	 // 0x0103
-65282,	 // 0xff02
-  259,	 // 0x0103
-  513,	 // 0x0201
-  258,	 // 0x0102
-    2,	 // 0x0002
-    1,	 // 0x0001
-64763,	 // 0xfcfb
- 2834,	 // 0x0b12
- 3339,	 // 0x0d0b
-64780,	 // 0xfd0c
- 2298,	 // 0x08fa
-64776,	 // 0xfd08
-  516,	 // 0x0204
-  769,	 // 0x0301
- 1279,	 // 0x04ff
-    7,	 // 0x0007
-65281,	 // 0xff01
-65028,	 // 0xfe04
-  511,	 // 0x01ff
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-  510,	 // 0x01fe
-  258,	 // 0x0102
-    1,	 // 0x0001
-    0,	 // 0x0000
- 3077,	 // 0x0c05
- 6894,	 // 0x1aee
- 3336,	 // 0x0d08
-65313,	 // 0xff21
- 6917,	 // 0x1b05
-65037,	 // 0xfe0d
-64776,	 // 0xfd08
-64759,	 // 0xfcf7
-  767,	 // 0x02ff
-    6,	 // 0x0006
-65027,	 // 0xfe03
-65283,	 // 0xff03
-    0,	 // 0x0000
-    0,	 // 0x0000
-65025,	 // 0xfe01
-65280,	 // 0xff00
-65534,	 // 0xfffe
-  514,	 // 0x0202
-  258,	 // 0x0102
-    1,	 // 0x0001
- 8440,	 // 0x20f8
-17152,	 // 0x4300
-11292,	 // 0x2c1c
- 7739,	 // 0x1e3b
-10257,	 // 0x2811
-65297,	 // 0xff11
-61444,	 // 0xf004
-62189,	 // 0xf2ed
-64247,	 // 0xfaf7
-64768,	 // 0xfd00
-64257,	 // 0xfb01
-65280,	 // 0xff00
-65278,	 // 0xfefe
-  257,	 // 0x0101
-65024,	 // 0xfe00
-  257,	 // 0x0101
-  252,	 // 0x00fc
-  256,	 // 0x0100
-  514,	 // 0x0202
-  259,	 // 0x0103
-25843,	 // 0x64f3
-23390,	 // 0x5b5e
-20045,	 // 0x4e4d
-16704,	 // 0x4140
- 9245,	 // 0x241d
-  539,	 // 0x021b
-59643,	 // 0xe8fb
-58601,	 // 0xe4e9
-61676,	 // 0xf0ec
-63735,	 // 0xf8f7
-63482,	 // 0xf7fa
-65274,	 // 0xfefa
-65532,	 // 0xfffc
-  256,	 // 0x0100
-  256,	 // 0x0100
-  512,	 // 0x0200
-  510,	 // 0x01fe
-  513,	 // 0x0201
- 1028,	 // 0x0404
-  517,	 // 0x0205
-15617,	 // 0x3d01
-19327,	 // 0x4b7f
-21342,	 // 0x535e
-22336,	 // 0x5740
-11058,	 // 0x2b32
- 2850,	 // 0x0b22
-60155,	 // 0xeafb
-59887,	 // 0xe9ef
-61424,	 // 0xeff0
-63989,	 // 0xf9f5
-63227,	 // 0xf6fb
-65016,	 // 0xfdf8
-  766,	 // 0x02fe
-  769,	 // 0x0301
-  512,	 // 0x0200
-  512,	 // 0x0200
-  766,	 // 0x02fe
-  256,	 // 0x0100
-  772,	 // 0x0304
-  259,	 // 0x0103
-13309,	 // 0x33fd
-13113,	 // 0x3339
-16191,	 // 0x3f3f
-18239,	 // 0x473f
-13625,	 // 0x3539
- 3354,	 // 0x0d1a
-60931,	 // 0xee03
-63219,	 // 0xf6f3
-62711,	 // 0xf4f7
-65533,	 // 0xfffd
-64001,	 // 0xfa01
-65275,	 // 0xfefb
-  257,	 // 0x0101
- 1283,	 // 0x0503
-  770,	 // 0x0302
-  257,	 // 0x0101
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  771,	 // 0x0303
-    3,	 // 0x0003
-10503,	 // 0x2907
- 6654,	 // 0x19fe
- 7960,	 // 0x1f18
- 8487,	 // 0x2127
- 8739,	 // 0x2223
- 3086,	 // 0x0c0e
-62983,	 // 0xf607
-65016,	 // 0xfdf8
-64252,	 // 0xfafc
-    2,	 // 0x0002
-64768,	 // 0xfd00
-65534,	 // 0xfffe
-  258,	 // 0x0102
- 1794,	 // 0x0702
-  515,	 // 0x0203
-  515,	 // 0x0203
-  256,	 // 0x0100
-  515,	 // 0x0203
-  771,	 // 0x0303
-    3,	 // 0x0003
- 7688,	 // 0x1e08
- 8703,	 // 0x21ff
- 4371,	 // 0x1113
- 4370,	 // 0x1112
- 3595,	 // 0x0e0b
- 1547,	 // 0x060b
-64262,	 // 0xfb06
-65276,	 // 0xfefc
-64766,	 // 0xfcfe
-    2,	 // 0x0002
-    2,	 // 0x0002
-65279,	 // 0xfeff
-    3,	 // 0x0003
-  771,	 // 0x0303
-  258,	 // 0x0102
-    5,	 // 0x0005
-  513,	 // 0x0201
-  258,	 // 0x0102
-  514,	 // 0x0202
-  258,	 // 0x0102
-62722,	 // 0xf502
- 6926,	 // 0x1b0e
- 2834,	 // 0x0b12
- 4883,	 // 0x1313
-  516,	 // 0x0204
-  778,	 // 0x030a
-64772,	 // 0xfd04
-65023,	 // 0xfdff
-65277,	 // 0xfefd
-64770,	 // 0xfd02
-65282,	 // 0xff02
-65024,	 // 0xfe00
-65026,	 // 0xfe02
-  258,	 // 0x0102
-65283,	 // 0xff03
-  261,	 // 0x0105
-  258,	 // 0x0102
-  258,	 // 0x0102
-  258,	 // 0x0102
-  257,	 // 0x0101
- 9453,	 // 0x24ed
-64547,	 // 0xfc23
- 9500,	 // 0x251c
- 4882,	 // 0x1312
- 1035,	 // 0x040b
-62211,	 // 0xf303
-64508,	 // 0xfbfc
-63739,	 // 0xf8fb
-63997,	 // 0xf9fd
-64512,	 // 0xfc00
-64768,	 // 0xfd00
-64511,	 // 0xfbff
-64257,	 // 0xfb01
-65025,	 // 0xfe01
-64768,	 // 0xfd00
-    4,	 // 0x0004
-    1,	 // 0x0001
-    2,	 // 0x0002
-  514,	 // 0x0202
-  513,	 // 0x0201
-   74,	 // 0x004a
-59655,	 // 0xe907
-63715,	 // 0xf8e3
-65281,	 // 0xff01
- 1542,	 // 0x0606
- 2826,	 // 0x0b0a
-65279,	 // 0xfeff
-65022,	 // 0xfdfe
-  254,	 // 0x00fe
-  513,	 // 0x0201
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-57584,	 // 0xe0f0
-  500,	 // 0x01f4
- 1792,	 // 0x0700
- 1027,	 // 0x0403
- 1028,	 // 0x0404
-64764,	 // 0xfcfc
-  508,	 // 0x01fc
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 3567,	 // 0x0def
- 2833,	 // 0x0b11
- 2563,	 // 0x0a03
-  257,	 // 0x0101
-65021,	 // 0xfdfd
-63995,	 // 0xf9fb
-  762,	 // 0x02fa
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32544,	 // 0x7f20
- 5166,	 // 0x142e
-64775,	 // 0xfd07
-64247,	 // 0xfaf7
-62709,	 // 0xf4f5
-63998,	 // 0xf9fe
-  505,	 // 0x01f9
-64767,	 // 0xfcff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65024,	 // 0xfe00
-65535,	 // 0xffff
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-30014,	 // 0x753e
- 3861,	 // 0x0f15
-62979,	 // 0xf603
-64762,	 // 0xfcfa
-63737,	 // 0xf8f9
-64258,	 // 0xfb02
-65275,	 // 0xfefb
-65278,	 // 0xfefe
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-65024,	 // 0xfe00
-65535,	 // 0xffff
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-61699,	 // 0xf103
- 1274,	 // 0x04fa
-65024,	 // 0xfe00
- 1541,	 // 0x0605
-  770,	 // 0x0302
-65284,	 // 0xff04
-65280,	 // 0xff00
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  513,	 // 0x0201
-    0,	 // 0x0000
-65281,	 // 0xff01
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-53731,	 // 0xd1e3
- 1264,	 // 0x04f0
-63744,	 // 0xf900
-  514,	 // 0x0202
- 1281,	 // 0x0501
-  514,	 // 0x0202
-  257,	 // 0x0101
-65279,	 // 0xfeff
-65280,	 // 0xff00
-  513,	 // 0x0201
-    1,	 // 0x0001
-    1,	 // 0x0001
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58358,	 // 0xe3f6
-  240,	 // 0x00f0
-63229,	 // 0xf6fd
-  255,	 // 0x00ff
- 1025,	 // 0x0401
-  770,	 // 0x0302
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63999,	 // 0xf9ff
-63478,	 // 0xf7f6
-64766,	 // 0xfcfe
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  514,	 // 0x0202
-65279,	 // 0xfeff
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63996,	 // 0xf9fc
-62972,	 // 0xf5fc
-  768,	 // 0x0300
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  257,	 // 0x0101
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58857,	 // 0xe5e9
-62969,	 // 0xf5f9
- 2044,	 // 0x07fc
-65279,	 // 0xfeff
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  513,	 // 0x0201
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   23,	 // 0x0017
-65527,	 // 0xfff7
- 3095,	 // 0x0c17
- 2061,	 // 0x080d
- 1031,	 // 0x0407
-65276,	 // 0xfefc
-64000,	 // 0xfa00
-64758,	 // 0xfcf6
-65021,	 // 0xfdfd
-  514,	 // 0x0202
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65278,	 // 0xfefe
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 8434,	 // 0x20f2
- 4089,	 // 0x0ff9
- 1041,	 // 0x0411
- 6166,	 // 0x1816
- 2577,	 // 0x0a11
-63743,	 // 0xf8ff
-61937,	 // 0xf1f1
-64246,	 // 0xfaf6
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65022,	 // 0xfdfe
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-53983,	 // 0xd2df
-61155,	 // 0xeee3
- 5375,	 // 0x14ff
-11819,	 // 0x2e2b
- 5673,	 // 0x1629
-62974,	 // 0xf5fe
-60909,	 // 0xeded
-64249,	 // 0xfaf9
-  510,	 // 0x01fe
-  515,	 // 0x0203
-64770,	 // 0xfd02
-65534,	 // 0xfffe
-    0,	 // 0x0000
-    0,	 // 0x0000
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  513,	 // 0x0201
-65025,	 // 0xfe01
-  255,	 // 0x00ff
-52460,	 // 0xccec
-56562,	 // 0xdcf2
-  478,	 // 0x01de
- 2049,	 // 0x0801
- 5654,	 // 0x1616
- 3080,	 // 0x0c08
- 2057,	 // 0x0809
-64261,	 // 0xfb05
-64762,	 // 0xfcfa
-65280,	 // 0xff00
-65534,	 // 0xfffe
-  512,	 // 0x0200
-    0,	 // 0x0000
-  768,	 // 0x0300
-  259,	 // 0x0103
-  514,	 // 0x0202
-  257,	 // 0x0101
-  513,	 // 0x0201
-  514,	 // 0x0202
-    1,	 // 0x0001
-32567,	 // 0x7f37
- 1327,	 // 0x052f
-45518,	 // 0xb1ce
-46233,	 // 0xb499
-62929,	 // 0xf5d1
-14372,	 // 0x3824
-12599,	 // 0x3137
- 1562,	 // 0x061a
-63478,	 // 0xf7f6
-63991,	 // 0xf9f7
- 1274,	 // 0x04fa
- 1026,	 // 0x0402
-  259,	 // 0x0103
-  768,	 // 0x0300
- 1799,	 // 0x0707
- 1029,	 // 0x0405
-65282,	 // 0xff02
-  512,	 // 0x0200
- 1283,	 // 0x0503
-  515,	 // 0x0203
-29775,	 // 0x744f
- 8477,	 // 0x211d
-52985,	 // 0xcef9
-46000,	 // 0xb3b0
-56510,	 // 0xdcbe
- 8206,	 // 0x200e
- 8735,	 // 0x221f
- 3865,	 // 0x0f19
-  254,	 // 0x00fe
-  252,	 // 0x00fc
- 1791,	 // 0x06ff
-  514,	 // 0x0202
-  515,	 // 0x0203
-  256,	 // 0x0100
- 1029,	 // 0x0405
-  515,	 // 0x0203
-65283,	 // 0xff03
-65535,	 // 0xffff
-  513,	 // 0x0201
-    1,	 // 0x0001
-53483,	 // 0xd0eb
- 1521,	 // 0x05f1
- 7449,	 // 0x1d19
-63242,	 // 0xf70a
-62192,	 // 0xf2f0
-65530,	 // 0xfffa
- 1026,	 // 0x0402
- 1290,	 // 0x050a
-  769,	 // 0x0301
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  258,	 // 0x0102
-  258,	 // 0x0102
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-    1,	 // 0x0001
-65535,	 // 0xffff
-65281,	 // 0xff01
-65535,	 // 0xffff
-55279,	 // 0xd7ef
-64754,	 // 0xfcf2
- 6417,	 // 0x1911
- 3865,	 // 0x0f19
-65287,	 // 0xff07
-63733,	 // 0xf8f5
-64766,	 // 0xfcfe
-65280,	 // 0xff00
-  258,	 // 0x0102
-    0,	 // 0x0000
-65535,	 // 0xffff
-  257,	 // 0x0101
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-65535,	 // 0xffff
-    1,	 // 0x0001
-65280,	 // 0xff00
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65277,	 // 0xfefd
- 1029,	 // 0x0405
-  774,	 // 0x0306
- 1803,	 // 0x070b
- 1027,	 // 0x0403
-65273,	 // 0xfef9
-65025,	 // 0xfe01
-  254,	 // 0x00fe
-65282,	 // 0xff02
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65281,	 // 0xff01
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
- 3841,	 // 0x0f01
-  773,	 // 0x0305
-    1,	 // 0x0001
-    7,	 // 0x0007
- 1025,	 // 0x0401
-  252,	 // 0x00fc
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65280,	 // 0xff00
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65024,	 // 0xfe00
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-61939,	 // 0xf1f3
- 1279,	 // 0x04ff
-  766,	 // 0x02fe
-  253,	 // 0x00fd
- 1538,	 // 0x0602
-  509,	 // 0x01fd
-  258,	 // 0x0102
-65530,	 // 0xfffa
-65280,	 // 0xff00
-  512,	 // 0x0200
-65280,	 // 0xff00
-  767,	 // 0x02ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  246,	 // 0x00f6
- 6155,	 // 0x180b
-  262,	 // 0x0106
-65027,	 // 0xfe03
-65023,	 // 0xfdff
-64515,	 // 0xfc03
-  513,	 // 0x0201
-  514,	 // 0x0202
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-50490,	 // 0xc53a
- 2302,	 // 0x08fe
-65020,	 // 0xfdfc
-65022,	 // 0xfdfe
-65281,	 // 0xff01
-    1,	 // 0x0001
-  512,	 // 0x0200
-  510,	 // 0x01fe
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65260,	 // 0xfeec
-  527,	 // 0x020f
-  768,	 // 0x0300
-  510,	 // 0x01fe
- 1022,	 // 0x03fe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-25217,	 // 0x6281
-63999,	 // 0xf9ff
-  774,	 // 0x0306
- 1793,	 // 0x0701
- 1787,	 // 0x06fb
-  253,	 // 0x00fd
-65278,	 // 0xfefe
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-59418,	 // 0xe81a
-64477,	 // 0xfbdd
-65276,	 // 0xfefc
-  770,	 // 0x0302
-  256,	 // 0x0100
-  254,	 // 0x00fe
-64769,	 // 0xfd01
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-54086,	 // 0xd346
-  261,	 // 0x0105
-  253,	 // 0x00fd
-64769,	 // 0xfd01
-65027,	 // 0xfe03
-    2,	 // 0x0002
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4083,	 // 0x0ff3
- 1036,	 // 0x040c
-  258,	 // 0x0102
-64766,	 // 0xfcfe
-65024,	 // 0xfe00
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  248,	 // 0x00f8
- 1022,	 // 0x03fe
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63748,	 // 0xf904
-65279,	 // 0xfeff
-    0,	 // 0x0000
-    1,	 // 0x0001
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1281,	 // 0x0501
-65281,	 // 0xff01
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  509,	 // 0x01fd
-65027,	 // 0xfe03
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-    2,	 // 0x0002
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    2,	 // 0x0002
-61696,	 // 0xf100
- 4879,	 // 0x130f
-63483,	 // 0xf7fb
-  512,	 // 0x0200
-64254,	 // 0xfafe
-    5,	 // 0x0005
-65281,	 // 0xff01
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-64002,	 // 0xfa02
-  764,	 // 0x02fc
-64765,	 // 0xfcfd
-  511,	 // 0x01ff
-64768,	 // 0xfd00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65279,	 // 0xfeff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65532,	 // 0xfffc
-65026,	 // 0xfe02
-  512,	 // 0x0200
-65027,	 // 0xfe03
-  256,	 // 0x0100
-    0,	 // 0x0000
-  257,	 // 0x0101
-  254,	 // 0x00fe
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3586,	 // 0x0e02
-63991,	 // 0xf9f7
-64518,	 // 0xfc06
- 1276,	 // 0x04fc
-64776,	 // 0xfd08
-  512,	 // 0x0200
-    0,	 // 0x0000
-  257,	 // 0x0101
-  509,	 // 0x01fd
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4609,	 // 0x1201
-60410,	 // 0xebfa
-  266,	 // 0x010a
- 1781,	 // 0x06f5
-63501,	 // 0xf80d
- 1534,	 // 0x05fe
-65026,	 // 0xfe02
-  514,	 // 0x0202
-  254,	 // 0x00fe
-  257,	 // 0x0101
-65281,	 // 0xff01
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6391,	 // 0x18f7
-55803,	 // 0xd9fb
- 3079,	 // 0x0c07
-  245,	 // 0x00f5
-64521,	 // 0xfc09
- 1275,	 // 0x04fb
-    4,	 // 0x0004
-  514,	 // 0x0202
-  257,	 // 0x0101
-  257,	 // 0x0101
-    3,	 // 0x0003
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  500,	 // 0x01f4
-57593,	 // 0xe0f9
- 4856,	 // 0x12f8
-62720,	 // 0xf500
- 2813,	 // 0x0afd
-65281,	 // 0xff01
- 1028,	 // 0x0404
-  257,	 // 0x0101
-  257,	 // 0x0101
-    3,	 // 0x0003
-    3,	 // 0x0003
-    1,	 // 0x0001
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  257,	 // 0x0101
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-54271,	 // 0xd3ff
- 5133,	 // 0x140d
-63705,	 // 0xf8d9
-64023,	 // 0xfa17
- 3814,	 // 0x0ee6
-63756,	 // 0xf90c
- 1534,	 // 0x05fe
-  514,	 // 0x0202
-65278,	 // 0xfefe
-  261,	 // 0x0105
-  510,	 // 0x01fe
-  258,	 // 0x0102
-  510,	 // 0x01fe
-65025,	 // 0xfe01
-  257,	 // 0x0101
-65535,	 // 0xffff
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-50438,	 // 0xc506
-20501,	 // 0x5015
-55503,	 // 0xd8cf
- 4388,	 // 0x1124
- 1246,	 // 0x04de
-64018,	 // 0xfa12
-  502,	 // 0x01f6
- 1027,	 // 0x0403
-64765,	 // 0xfcfd
- 1029,	 // 0x0405
-  251,	 // 0x00fb
-  258,	 // 0x0102
-  253,	 // 0x00fd
-65026,	 // 0xfe02
-  256,	 // 0x0100
-65535,	 // 0xffff
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-58121,	 // 0xe309
-23053,	 // 0x5a0d
-51429,	 // 0xc8e5
- 8220,	 // 0x201c
-64744,	 // 0xfce8
-65291,	 // 0xff0b
-64757,	 // 0xfcf5
- 1536,	 // 0x0600
-64510,	 // 0xfbfe
- 1539,	 // 0x0603
-  250,	 // 0x00fa
-  770,	 // 0x0302
-  254,	 // 0x00fe
-65025,	 // 0xfe01
-    0,	 // 0x0000
-  254,	 // 0x00fe
-    0,	 // 0x0000
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-59400,	 // 0xe808
-32518,	 // 0x7f06
-46350,	 // 0xb50e
- 8968,	 // 0x2308
-63990,	 // 0xf9f6
-64510,	 // 0xfbfe
-63734,	 // 0xf8f6
-  762,	 // 0x02fa
-64767,	 // 0xfcff
- 1280,	 // 0x0500
-65532,	 // 0xfffc
-  513,	 // 0x0201
-  767,	 // 0x02ff
-65535,	 // 0xffff
-    1,	 // 0x0001
-65534,	 // 0xfffe
-65281,	 // 0xff01
-65025,	 // 0xfe01
-    0,	 // 0x0000
-    0,	 // 0x0000
-  240,	 // 0x00f0
-32523,	 // 0x7f0b
- 7234,	 // 0x1c42
- 9247,	 // 0x241f
- 5650,	 // 0x1612
- 1557,	 // 0x0615
-64266,	 // 0xfb0a
-64762,	 // 0xfcfa
-62964,	 // 0xf5f4
-63994,	 // 0xf9fa
-64766,	 // 0xfcfe
-64768,	 // 0xfd00
-65278,	 // 0xfefe
-65535,	 // 0xffff
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  514,	 // 0x0202
-  258,	 // 0x0102
- 7156,	 // 0x1bf4
- 5168,	 // 0x1430
- 8481,	 // 0x2121
- 7433,	 // 0x1d09
-65286,	 // 0xff06
-64778,	 // 0xfd0a
-65529,	 // 0xfff9
-63995,	 // 0xf9fb
-64506,	 // 0xfbfa
-64765,	 // 0xfcfd
-65279,	 // 0xfeff
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  257,	 // 0x0101
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  513,	 // 0x0201
-  257,	 // 0x0101
- 8959,	 // 0x22ff
- 6685,	 // 0x1a1d
- 4379,	 // 0x111b
- 5635,	 // 0x1603
-  254,	 // 0x00fe
-  265,	 // 0x0109
- 1276,	 // 0x04fc
-65279,	 // 0xfeff
-64764,	 // 0xfcfc
-64766,	 // 0xfcfe
-65278,	 // 0xfefe
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  513,	 // 0x0201
-  513,	 // 0x0201
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  257,	 // 0x0101
-  257,	 // 0x0101
- 2823,	 // 0x0b07
- 6138,	 // 0x17fa
-64521,	 // 0xfc09
- 1537,	 // 0x0601
- 2045,	 // 0x07fd
-  515,	 // 0x0203
- 1794,	 // 0x0702
-  512,	 // 0x0200
-65534,	 // 0xfffe
-65024,	 // 0xfe00
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  513,	 // 0x0201
-  256,	 // 0x0100
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-64250,	 // 0xfafa
-64226,	 // 0xfae2
-65016,	 // 0xfdf8
-65035,	 // 0xfe0b
- 2050,	 // 0x0802
-    0,	 // 0x0000
-  775,	 // 0x0307
-  515,	 // 0x0203
-    0,	 // 0x0000
-    2,	 // 0x0002
-65282,	 // 0xff02
-    3,	 // 0x0003
-65282,	 // 0xff02
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-59655,	 // 0xe907
-63483,	 // 0xf7fb
-65523,	 // 0xfff3
-64262,	 // 0xfb06
-  512,	 // 0x0200
-  251,	 // 0x00fb
-65026,	 // 0xfe02
-  258,	 // 0x0102
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-  512,	 // 0x0200
-63749,	 // 0xf905
-65275,	 // 0xfefb
-64511,	 // 0xfbff
-65024,	 // 0xfe00
-65532,	 // 0xfffc
-65281,	 // 0xff01
-    3,	 // 0x0003
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-64769,	 // 0xfd01
-65280,	 // 0xff00
-  511,	 // 0x01ff
-65025,	 // 0xfe01
-65533,	 // 0xfffd
-    0,	 // 0x0000
-    3,	 // 0x0003
-  256,	 // 0x0100
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-62973,	 // 0xf5fd
-65535,	 // 0xffff
-  257,	 // 0x0101
-  768,	 // 0x0300
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    2,	 // 0x0002
-  256,	 // 0x0100
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-65280,	 // 0xff00
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2308,	 // 0x0904
-65531,	 // 0xfffb
-65024,	 // 0xfe00
-65278,	 // 0xfefe
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-60408,	 // 0xebf8
-62209,	 // 0xf301
-  511,	 // 0x01ff
-64510,	 // 0xfbfe
-  258,	 // 0x0102
-65281,	 // 0xff01
-65281,	 // 0xff01
-  259,	 // 0x0103
-  257,	 // 0x0101
-  258,	 // 0x0102
-    2,	 // 0x0002
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-65280,	 // 0xff00
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-  251,	 // 0x00fb
-63756,	 // 0xf90c
-18949,	 // 0x4a05
-60941,	 // 0xee0d
- 4089,	 // 0x0ff9
-  514,	 // 0x0202
-62736,	 // 0xf510
- 3319,	 // 0x0cf7
-62983,	 // 0xf607
- 2300,	 // 0x08fc
-63237,	 // 0xf705
-  520,	 // 0x0208
-65025,	 // 0xfe01
-  259,	 // 0x0103
-64768,	 // 0xfd00
-    0,	 // 0x0000
-65535,	 // 0xffff
-65278,	 // 0xfefe
-65535,	 // 0xffff
-65280,	 // 0xff00
-65281,	 // 0xff01
-60659,	 // 0xecf3
- 8187,	 // 0x1ffb
-62198,	 // 0xf2f6
-  504,	 // 0x01f8
-  760,	 // 0x02f8
-64015,	 // 0xfa0f
- 3061,	 // 0x0bf5
-63494,	 // 0xf806
- 1274,	 // 0x04fa
-64255,	 // 0xfaff
-  515,	 // 0x0203
-65277,	 // 0xfefd
-  769,	 // 0x0301
-65280,	 // 0xff00
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4072,	 // 0x0fe8
- 1526,	 // 0x05f6
-60921,	 // 0xedf9
- 2541,	 // 0x09ed
-65530,	 // 0xfffa
-64016,	 // 0xfa10
- 3320,	 // 0x0cf8
-61445,	 // 0xf005
-  508,	 // 0x01fc
-64763,	 // 0xfcfb
-65281,	 // 0xff01
-65024,	 // 0xfe00
-  771,	 // 0x0303
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
- 4844,	 // 0x12ec
-60159,	 // 0xeaff
-61966,	 // 0xf20e
- 6633,	 // 0x19e9
-60679,	 // 0xed07
-65294,	 // 0xff0e
- 1269,	 // 0x04f5
-59911,	 // 0xea07
- 1275,	 // 0x04fb
-  503,	 // 0x01f7
-64254,	 // 0xfafe
-    3,	 // 0x0003
-  515,	 // 0x0203
-  770,	 // 0x0302
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    1,	 // 0x0001
-65024,	 // 0xfe00
-    1,	 // 0x0001
-13043,	 // 0x32f3
-54053,	 // 0xd325
- 1331,	 // 0x0533
- 6881,	 // 0x1ae1
-53787,	 // 0xd21b
- 1285,	 // 0x0505
-65011,	 // 0xfdf3
-60690,	 // 0xed12
-  255,	 // 0x00ff
- 2293,	 // 0x08f5
-62466,	 // 0xf402
-  264,	 // 0x0108
-65027,	 // 0xfe03
-  773,	 // 0x0305
-65282,	 // 0xff02
-    1,	 // 0x0001
-64768,	 // 0xfd00
-65281,	 // 0xff01
-65025,	 // 0xfe01
-64769,	 // 0xfd01
-13044,	 // 0x32f4
-47683,	 // 0xba43
-  578,	 // 0x0242
- 4561,	 // 0x11d1
-51228,	 // 0xc81c
- 4347,	 // 0x10fb
- 1015,	 // 0x03f7
-61464,	 // 0xf018
-64769,	 // 0xfd01
- 3057,	 // 0x0bf1
-61445,	 // 0xf005
-  779,	 // 0x030b
-    3,	 // 0x0003
- 1542,	 // 0x0606
-    3,	 // 0x0003
-    3,	 // 0x0003
-64768,	 // 0xfd00
-65282,	 // 0xff02
-65280,	 // 0xff00
-65025,	 // 0xfe01
-60957,	 // 0xee1d
-40319,	 // 0x9d7f
-60996,	 // 0xee44
- 5836,	 // 0x16cc
-54554,	 // 0xd51a
- 4346,	 // 0x10fa
- 2559,	 // 0x09ff
-59166,	 // 0xe71e
-65285,	 // 0xff05
- 2548,	 // 0x09f4
-60936,	 // 0xee08
-  523,	 // 0x020b
-65284,	 // 0xff04
- 1286,	 // 0x0506
-    5,	 // 0x0005
-  258,	 // 0x0102
-64768,	 // 0xfd00
-65026,	 // 0xfe02
-65281,	 // 0xff01
-65281,	 // 0xff01
- 7705,	 // 0x1e19
-47958,	 // 0xbb56
-58416,	 // 0xe430
- 5320,	 // 0x14c8
-58131,	 // 0xe313
-    3,	 // 0x0003
- 4346,	 // 0x10fa
-58140,	 // 0xe31c
-65028,	 // 0xfe04
- 1273,	 // 0x04f9
-61190,	 // 0xef06
-    8,	 // 0x0008
-65027,	 // 0xfe03
- 1028,	 // 0x0404
-    6,	 // 0x0006
-  260,	 // 0x0104
-65281,	 // 0xff01
-65027,	 // 0xfe03
-    2,	 // 0x0002
-    1,	 // 0x0001
-64542,	 // 0xfc1e
-56351,	 // 0xdc1f
-61967,	 // 0xf20f
- 6619,	 // 0x19db
-65302,	 // 0xff16
-63505,	 // 0xf811
- 4341,	 // 0x10f5
-60692,	 // 0xed14
-    2,	 // 0x0002
- 1019,	 // 0x03fb
-62471,	 // 0xf407
-  514,	 // 0x0202
-    1,	 // 0x0001
-  514,	 // 0x0202
-    3,	 // 0x0003
-  258,	 // 0x0102
-    0,	 // 0x0000
-    3,	 // 0x0003
-65282,	 // 0xff02
-    1,	 // 0x0001
- 1031,	 // 0x0407
-  784,	 // 0x0310
-  267,	 // 0x010b
- 8432,	 // 0x20f0
- 3100,	 // 0x0c1c
-63247,	 // 0xf70f
- 2546,	 // 0x09f2
-62987,	 // 0xf60b
-65534,	 // 0xfffe
- 1022,	 // 0x03fe
-63239,	 // 0xf707
- 1791,	 // 0x06ff
-    0,	 // 0x0000
-  259,	 // 0x0103
-    3,	 // 0x0003
-  514,	 // 0x0202
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-16368,	 // 0x3ff0
-13796,	 // 0x35e4
- 5907,	 // 0x1713
- 7932,	 // 0x1efc
- 4886,	 // 0x1316
-62223,	 // 0xf30f
- 2801,	 // 0x0af1
-64255,	 // 0xfaff
-65016,	 // 0xfdf8
-  258,	 // 0x0102
-63753,	 // 0xf909
- 2811,	 // 0x0afb
-  255,	 // 0x00ff
-  771,	 // 0x0303
-  516,	 // 0x0204
-  770,	 // 0x0302
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  512,	 // 0x0200
-  256,	 // 0x0100
-  125,	 // 0x007d
-50538,	 // 0xc56a
- 2314,	 // 0x090a
-65533,	 // 0xfffd
-65278,	 // 0xfefe
-  262,	 // 0x0106
-    2,	 // 0x0002
-  513,	 // 0x0201
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65281,	 // 0xff01
-    2,	 // 0x0002
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-13978,	 // 0x369a
-   12,	 // 0x000c
- 1798,	 // 0x0706
- 2043,	 // 0x07fb
-  507,	 // 0x01fb
-  767,	 // 0x02ff
-65534,	 // 0xfffe
-65025,	 // 0xfe01
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-23937,	 // 0x5d81
-63737,	 // 0xf8f9
- 1036,	 // 0x040c
- 2305,	 // 0x0901
-65273,	 // 0xfef9
-  256,	 // 0x0100
-65021,	 // 0xfdfd
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-53322,	 // 0xd04a
-65000,	 // 0xfde8
-65021,	 // 0xfdfd
-64772,	 // 0xfd04
-65025,	 // 0xfe01
-65282,	 // 0xff02
-65281,	 // 0xff01
-  765,	 // 0x02fd
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-53585,	 // 0xd151
-65289,	 // 0xff09
-65018,	 // 0xfdfa
-63234,	 // 0xf702
-65286,	 // 0xff06
-65284,	 // 0xff04
-  515,	 // 0x0203
-  254,	 // 0x00fe
-65282,	 // 0xff02
-65281,	 // 0xff01
-65280,	 // 0xff00
-65281,	 // 0xff01
-65280,	 // 0xff00
-65281,	 // 0xff01
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4328,	 // 0x10e8
- 1285,	 // 0x0505
-  509,	 // 0x01fd
-65534,	 // 0xfffe
-  512,	 // 0x0200
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64759,	 // 0xfcf7
- 1278,	 // 0x04fe
-  256,	 // 0x0100
-  512,	 // 0x0200
-  510,	 // 0x01fe
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64770,	 // 0xfd02
-65277,	 // 0xfefd
-65281,	 // 0xff01
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65278,	 // 0xfefe
-65280,	 // 0xff00
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  766,	 // 0x02fe
-65284,	 // 0xff04
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-65282,	 // 0xff02
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    2,	 // 0x0002
-64005,	 // 0xfa05
-14358,	 // 0x3816
-61178,	 // 0xeefa
-65024,	 // 0xfe00
- 2818,	 // 0x0b02
-61435,	 // 0xeffb
- 2809,	 // 0x0af9
-65531,	 // 0xfffb
-65285,	 // 0xff05
-  508,	 // 0x01fc
-64515,	 // 0xfc03
-    0,	 // 0x0000
-65024,	 // 0xfe00
-65535,	 // 0xffff
-65279,	 // 0xfeff
-    1,	 // 0x0001
-  510,	 // 0x01fe
-    1,	 // 0x0001
-  256,	 // 0x0100
-  511,	 // 0x01ff
-61684,	 // 0xf0f4
- 4378,	 // 0x111a
-  496,	 // 0x01f0
- 1287,	 // 0x0507
- 4613,	 // 0x1205
-62715,	 // 0xf4fb
- 1528,	 // 0x05f8
-  253,	 // 0x00fd
-    6,	 // 0x0006
-  251,	 // 0x00fb
-65028,	 // 0xfe04
-  255,	 // 0x00ff
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-59638,	 // 0xe8f6
- 1563,	 // 0x061b
- 2771,	 // 0x0ad3
-  270,	 // 0x010e
- 5132,	 // 0x140c
-63474,	 // 0xf7f2
- 1015,	 // 0x03f7
- 1024,	 // 0x0400
-  262,	 // 0x0106
-  762,	 // 0x02fa
-65283,	 // 0xff03
-  255,	 // 0x00ff
-65281,	 // 0xff01
-  256,	 // 0x0100
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-  512,	 // 0x0200
-  511,	 // 0x01ff
-  255,	 // 0x00ff
- 3835,	 // 0x0efb
-62255,	 // 0xf32f
- 6320,	 // 0x18b0
-62482,	 // 0xf412
- 4622,	 // 0x120e
-64229,	 // 0xfae5
- 1020,	 // 0x03fc
- 1543,	 // 0x0607
-    3,	 // 0x0003
-  763,	 // 0x02fb
-65282,	 // 0xff02
-  256,	 // 0x0100
-65282,	 // 0xff02
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-59227,	 // 0xe75b
- 8833,	 // 0x2281
-59414,	 // 0xe816
- 4870,	 // 0x1306
-  734,	 // 0x02de
- 2054,	 // 0x0806
- 1547,	 // 0x060b
-64770,	 // 0xfd02
-  765,	 // 0x02fd
-    2,	 // 0x0002
-    2,	 // 0x0002
-65026,	 // 0xfe02
-    1,	 // 0x0001
-  767,	 // 0x02ff
-    0,	 // 0x0000
-  510,	 // 0x01fe
-  257,	 // 0x0101
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-50959,	 // 0xc70f
-62052,	 // 0xf264
- 9092,	 // 0x2384
-59922,	 // 0xea12
- 5640,	 // 0x1608
- 1244,	 // 0x04dc
- 4873,	 // 0x1309
-64261,	 // 0xfb05
-  516,	 // 0x0204
-  253,	 // 0x00fd
-65283,	 // 0xff03
-65028,	 // 0xfe04
-65025,	 // 0xfe01
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  509,	 // 0x01fd
-  257,	 // 0x0101
-    0,	 // 0x0000
-  511,	 // 0x01ff
- 8197,	 // 0x2005
-  802,	 // 0x0322
- 3531,	 // 0x0dcb
-62471,	 // 0xf407
- 3844,	 // 0x0f04
- 1007,	 // 0x03ef
- 4098,	 // 0x1002
-63229,	 // 0xf6fd
-  775,	 // 0x0307
-65529,	 // 0xfff9
-65285,	 // 0xff05
-64258,	 // 0xfb02
-65282,	 // 0xff02
-  257,	 // 0x0101
-    0,	 // 0x0000
-  257,	 // 0x0101
-  509,	 // 0x01fd
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
- 6652,	 // 0x19fc
- 2295,	 // 0x08f7
-64496,	 // 0xfbf0
- 1287,	 // 0x0507
- 2560,	 // 0x0a00
- 2046,	 // 0x07fe
- 1533,	 // 0x05fd
-65532,	 // 0xfffc
-65285,	 // 0xff05
- 1275,	 // 0x04fb
-65029,	 // 0xfe05
-64512,	 // 0xfc00
-  258,	 // 0x0102
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-65535,	 // 0xffff
-58372,	 // 0xe404
- 4082,	 // 0x0ff2
-63485,	 // 0xf7fd
- 2819,	 // 0x0b03
- 2045,	 // 0x07fd
- 2303,	 // 0x08ff
-65276,	 // 0xfefc
-  253,	 // 0x00fd
-  256,	 // 0x0100
- 1278,	 // 0x04fe
-65026,	 // 0xfe02
-65281,	 // 0xff01
-    2,	 // 0x0002
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-62978,	 // 0xf602
- 4074,	 // 0x0fea
-64520,	 // 0xfc08
-  771,	 // 0x0303
- 1789,	 // 0x06fd
-  516,	 // 0x0204
-64765,	 // 0xfcfd
-65280,	 // 0xff00
-  509,	 // 0x01fd
- 1022,	 // 0x03fe
-    1,	 // 0x0001
-65280,	 // 0xff00
-  257,	 // 0x0101
-65280,	 // 0xff00
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-61952,	 // 0xf200
- 5082,	 // 0x13da
- 1334,	 // 0x0536
-    4,	 // 0x0004
-65279,	 // 0xfeff
-64260,	 // 0xfb04
-62975,	 // 0xf5ff
-65279,	 // 0xfeff
-  251,	 // 0x00fb
- 1022,	 // 0x03fe
-    0,	 // 0x0000
-65025,	 // 0xfe01
-    1,	 // 0x0001
-65024,	 // 0xfe00
-65280,	 // 0xff00
-65026,	 // 0xfe02
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-15782,	 // 0x3da6
-62733,	 // 0xf50d
-62201,	 // 0xf2f9
- 2285,	 // 0x08ed
- 5906,	 // 0x1712
-   18,	 // 0x0012
- 4343,	 // 0x10f7
- 1807,	 // 0x070f
- 1283,	 // 0x0503
-    5,	 // 0x0005
-  255,	 // 0x00ff
-  258,	 // 0x0102
-65280,	 // 0xff00
-65280,	 // 0xff00
-64513,	 // 0xfc01
-65280,	 // 0xff00
-65021,	 // 0xfdfd
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  255,	 // 0x00ff
- 3107,	 // 0x0c23
-57095,	 // 0xdf07
-54231,	 // 0xd3d7
- 8158,	 // 0x1fde
-12853,	 // 0x3235
- 2857,	 // 0x0b29
-65269,	 // 0xfef5
-64253,	 // 0xfafd
- 1788,	 // 0x06fc
-  521,	 // 0x0209
-65276,	 // 0xfefc
-65277,	 // 0xfefd
-  512,	 // 0x0200
-  258,	 // 0x0102
-64768,	 // 0xfd00
-65278,	 // 0xfefe
-64766,	 // 0xfcfe
-  256,	 // 0x0100
-65025,	 // 0xfe01
-  254,	 // 0x00fe
-16683,	 // 0x412b
-45562,	 // 0xb1fa
-43677,	 // 0xaa9d
-14799,	 // 0x39cf
-19799,	 // 0x4d57
- 1852,	 // 0x073c
-59122,	 // 0xe6f2
-62189,	 // 0xf2ed
- 4092,	 // 0x0ffc
- 1034,	 // 0x040a
-64761,	 // 0xfcf9
-65015,	 // 0xfdf7
- 1278,	 // 0x04fe
-  259,	 // 0x0103
-64511,	 // 0xfbff
-65020,	 // 0xfdfc
-64510,	 // 0xfbfe
-  769,	 // 0x0301
-64513,	 // 0xfc01
-65277,	 // 0xfefd
-32601,	 // 0x7f59
-43728,	 // 0xaad0
-36994,	 // 0x9082
-12507,	 // 0x30db
-17236,	 // 0x4354
- 2606,	 // 0x0a2e
-55800,	 // 0xd9f8
-65516,	 // 0xffec
- 4091,	 // 0x0ffb
- 1295,	 // 0x050f
-63995,	 // 0xf9fb
-65014,	 // 0xfdf6
- 1279,	 // 0x04ff
-  773,	 // 0x0305
-64513,	 // 0xfc01
-65021,	 // 0xfdfd
-64768,	 // 0xfd00
-  515,	 // 0x0203
-64768,	 // 0xfd00
-  254,	 // 0x00fe
-22822,	 // 0x5926
-64258,	 // 0xfb02
-49610,	 // 0xc1ca
-61427,	 // 0xeff3
- 6423,	 // 0x1917
-  766,	 // 0x02fe
-60676,	 // 0xed04
- 2032,	 // 0x07f0
- 1274,	 // 0x04fa
-  272,	 // 0x0110
-63489,	 // 0xf801
-65534,	 // 0xfffe
-    0,	 // 0x0000
-  258,	 // 0x0102
-64769,	 // 0xfd01
-65281,	 // 0xff01
-65282,	 // 0xff02
-    3,	 // 0x0003
-65535,	 // 0xffff
-    0,	 // 0x0000
- 7394,	 // 0x1ce2
-12322,	 // 0x3022
- 1319,	 // 0x0527
-56575,	 // 0xdcff
-65268,	 // 0xfef4
-  760,	 // 0x02f8
- 1284,	 // 0x0504
-65017,	 // 0xfdf9
-64761,	 // 0xfcf9
-64521,	 // 0xfc09
-64513,	 // 0xfc01
-    2,	 // 0x0002
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    3,	 // 0x0003
-  257,	 // 0x0101
-  258,	 // 0x0102
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  257,	 // 0x0101
-63728,	 // 0xf8f0
- 6125,	 // 0x17ed
-  551,	 // 0x0227
-61433,	 // 0xeff9
-62967,	 // 0xf5f7
- 2310,	 // 0x0906
- 1284,	 // 0x0504
-65533,	 // 0xfffd
-64512,	 // 0xfc00
-    0,	 // 0x0000
-65026,	 // 0xfe02
-65535,	 // 0xffff
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  257,	 // 0x0101
-  512,	 // 0x0200
-    1,	 // 0x0001
-65279,	 // 0xfeff
-  256,	 // 0x0100
-    2,	 // 0x0002
- 5617,	 // 0x15f1
- 4327,	 // 0x10e7
- 1806,	 // 0x070e
- 2054,	 // 0x0806
-63993,	 // 0xf9f9
- 1794,	 // 0x0702
-65022,	 // 0xfdfe
- 1278,	 // 0x04fe
-64769,	 // 0xfd01
-  509,	 // 0x01fd
-65281,	 // 0xff01
-  511,	 // 0x01ff
-65278,	 // 0xfefe
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  257,	 // 0x0101
-    2,	 // 0x0002
-62951,	 // 0xf5e7
- 1012,	 // 0x03f4
- 3061,	 // 0x0bf5
- 5650,	 // 0x1612
- 1019,	 // 0x03fb
-  762,	 // 0x02fa
-64510,	 // 0xfbfe
-  765,	 // 0x02fd
-65279,	 // 0xfeff
-65535,	 // 0xffff
-  256,	 // 0x0100
-  512,	 // 0x0200
-65534,	 // 0xfffe
-65025,	 // 0xfe01
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-62979,	 // 0xf603
-65009,	 // 0xfdf1
- 1262,	 // 0x04ee
- 1545,	 // 0x0609
- 1276,	 // 0x04fc
-65269,	 // 0xfef5
-64512,	 // 0xfc00
-65273,	 // 0xfef9
-64768,	 // 0xfd00
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  254,	 // 0x00fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-  511,	 // 0x01ff
-    0,	 // 0x0000
-46058,	 // 0xb3ea
- 5403,	 // 0x151b
- 4106,	 // 0x100a
-59639,	 // 0xe8f7
-63216,	 // 0xf6f0
-64238,	 // 0xfaee
-65285,	 // 0xff05
-64760,	 // 0xfcf8
-64516,	 // 0xfc04
-65535,	 // 0xffff
-65025,	 // 0xfe01
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65282,	 // 0xff02
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-65281,	 // 0xff01
-  236,	 // 0x00ec
-26631,	 // 0x6807
- 7975,	 // 0x1f27
-62212,	 // 0xf304
-62958,	 // 0xf5ee
-  770,	 // 0x0302
-  775,	 // 0x0307
-  254,	 // 0x00fe
-63483,	 // 0xf7fb
-  250,	 // 0x00fa
-64768,	 // 0xfd00
-65535,	 // 0xffff
-65533,	 // 0xfffd
-65024,	 // 0xfe00
-    1,	 // 0x0001
-65280,	 // 0xff00
-65534,	 // 0xfffe
-65024,	 // 0xfe00
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-63183,	 // 0xf6cf
- 1803,	 // 0x070b
-64774,	 // 0xfd06
-  251,	 // 0x00fb
-  764,	 // 0x02fc
- 1031,	 // 0x0407
-65531,	 // 0xfffb
-63997,	 // 0xf9fd
-  762,	 // 0x02fa
-65281,	 // 0xff01
-65280,	 // 0xff00
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-57564,	 // 0xe0dc
-60901,	 // 0xede5
-  254,	 // 0x00fe
-  258,	 // 0x0102
- 1531,	 // 0x05fb
-  775,	 // 0x0307
-  251,	 // 0x00fb
-63742,	 // 0xf8fe
-  768,	 // 0x0300
-  256,	 // 0x0100
-65280,	 // 0xff00
-  257,	 // 0x0101
-  512,	 // 0x0200
-  256,	 // 0x0100
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-61193,	 // 0xef09
-63186,	 // 0xf6d2
- 1546,	 // 0x060a
-  509,	 // 0x01fd
-  242,	 // 0x00f2
-65282,	 // 0xff02
-  250,	 // 0x00fa
-63744,	 // 0xf900
- 1282,	 // 0x0502
-  508,	 // 0x01fc
-  255,	 // 0x00ff
-  257,	 // 0x0101
- 1025,	 // 0x0401
-  513,	 // 0x0201
-    0,	 // 0x0000
-  510,	 // 0x01fe
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-27398,	 // 0x6b06
- 6617,	 // 0x19d9
- 1824,	 // 0x0720
- 2041,	 // 0x07f9
-63468,	 // 0xf7ec
-64768,	 // 0xfd00
-  505,	 // 0x01f9
-63749,	 // 0xf905
-  765,	 // 0x02fd
-  503,	 // 0x01f7
-  250,	 // 0x00fa
-  257,	 // 0x0101
-  768,	 // 0x0300
-  256,	 // 0x0100
-  256,	 // 0x0100
-  510,	 // 0x01fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
- 1300,	 // 0x0514
-11716,	 // 0x2dc4
- 1037,	 // 0x040d
- 4869,	 // 0x1305
-  249,	 // 0x00f9
-65280,	 // 0xff00
- 1023,	 // 0x03ff
-64519,	 // 0xfc07
-  508,	 // 0x01fc
- 1527,	 // 0x05f7
-65528,	 // 0xfff8
-  258,	 // 0x0102
-  767,	 // 0x02ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  509,	 // 0x01fd
-65280,	 // 0xff00
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-38434,	 // 0x9622
-11986,	 // 0x2ed2
- 2046,	 // 0x07fe
- 5899,	 // 0x170b
- 4875,	 // 0x130b
-  766,	 // 0x02fe
- 2305,	 // 0x0901
-64519,	 // 0xfc07
-  512,	 // 0x0200
- 1532,	 // 0x05fc
-65531,	 // 0xfffb
-  513,	 // 0x0201
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  509,	 // 0x01fd
-65534,	 // 0xfffe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65535,	 // 0xffff
-63501,	 // 0xf80d
- 9205,	 // 0x23f5
-  772,	 // 0x0304
- 3328,	 // 0x0d00
- 6154,	 // 0x180a
-  254,	 // 0x00fe
- 2810,	 // 0x0afa
-63749,	 // 0xf905
-  510,	 // 0x01fe
-  765,	 // 0x02fd
-65021,	 // 0xfdfd
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  511,	 // 0x01ff
-  766,	 // 0x02fe
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  256,	 // 0x0100
-  255,	 // 0x00ff
-12809,	 // 0x3209
-  785,	 // 0x0311
- 1791,	 // 0x06ff
- 2558,	 // 0x09fe
- 4872,	 // 0x1308
-65281,	 // 0xff01
- 1529,	 // 0x05f9
-63746,	 // 0xf902
-  510,	 // 0x01fe
-65532,	 // 0xfffc
-65278,	 // 0xfefe
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
- 7436,	 // 0x1d0c
-64278,	 // 0xfb16
- 2559,	 // 0x09ff
- 2816,	 // 0x0b00
- 3592,	 // 0x0e08
-65027,	 // 0xfe03
-  505,	 // 0x01f9
-64767,	 // 0xfcff
-  511,	 // 0x01ff
-65277,	 // 0xfefd
-65024,	 // 0xfe00
-  766,	 // 0x02fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-56559,	 // 0xdcef
-65307,	 // 0xff1b
-65524,	 // 0xfff4
- 2548,	 // 0x09f4
- 3596,	 // 0x0e0c
-64516,	 // 0xfc04
- 1785,	 // 0x06f9
-  249,	 // 0x00f9
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65024,	 // 0xfe00
- 1277,	 // 0x04fd
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-  767,	 // 0x02ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-  127,	 // 0x007f
-63744,	 // 0xf900
-  521,	 // 0x0209
-63471,	 // 0xf7ef
-63484,	 // 0xf7fc
-65529,	 // 0xfff9
-    4,	 // 0x0004
- 1025,	 // 0x0401
-64765,	 // 0xfcfd
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-65279,	 // 0xfeff
-65280,	 // 0xff00
-65281,	 // 0xff01
-65280,	 // 0xff00
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    4,	 // 0x0004
- 3055,	 // 0x0bef
-64258,	 // 0xfb02
-64764,	 // 0xfcfc
-63224,	 // 0xf6f8
-  255,	 // 0x00ff
-  769,	 // 0x0301
-65280,	 // 0xff00
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  767,	 // 0x02ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-57569,	 // 0xe0e1
- 2547,	 // 0x09f3
- 1298,	 // 0x0512
-65015,	 // 0xfdf7
-60914,	 // 0xedf2
- 1275,	 // 0x04fb
-  771,	 // 0x0303
-  772,	 // 0x0304
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  512,	 // 0x0200
-    2,	 // 0x0002
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-59847,	 // 0xe9c7
-64774,	 // 0xfd06
- 1045,	 // 0x0415
-  755,	 // 0x02f3
-63994,	 // 0xf9fa
- 1281,	 // 0x0501
-65278,	 // 0xfefe
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  257,	 // 0x0101
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
- 6674,	 // 0x1a12
-52453,	 // 0xcce5
-60649,	 // 0xece9
- 2812,	 // 0x0afc
- 7194,	 // 0x1c1a
-65040,	 // 0xfe10
-61685,	 // 0xf0f5
-64761,	 // 0xfcf9
-  511,	 // 0x01ff
-  771,	 // 0x0303
-65280,	 // 0xff00
-65022,	 // 0xfdfe
-    0,	 // 0x0000
-65280,	 // 0xff00
-65535,	 // 0xffff
-65278,	 // 0xfefe
-65023,	 // 0xfdff
-  257,	 // 0x0101
-65025,	 // 0xfe01
-  255,	 // 0x00ff
-25441,	 // 0x6361
-51413,	 // 0xc8d5
-51387,	 // 0xc8bb
- 3832,	 // 0x0ef8
- 7975,	 // 0x1f27
-64018,	 // 0xfa12
-61689,	 // 0xf0f9
-64247,	 // 0xfaf7
- 1277,	 // 0x04fd
-  771,	 // 0x0303
-65276,	 // 0xfefc
-65020,	 // 0xfdfc
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65280,	 // 0xff00
-65278,	 // 0xfefe
-65024,	 // 0xfe00
-  257,	 // 0x0101
-65281,	 // 0xff01
-    0,	 // 0x0000
-32593,	 // 0x7f51
- 6949,	 // 0x1b25
-54228,	 // 0xd3d4
-65262,	 // 0xfeee
- 1540,	 // 0x0604
-  517,	 // 0x0205
-65024,	 // 0xfe00
-64762,	 // 0xfcfa
-  764,	 // 0x02fc
-  257,	 // 0x0101
-  252,	 // 0x00fc
-65021,	 // 0xfdfd
-65533,	 // 0xfffd
-65534,	 // 0xfffe
-    0,	 // 0x0000
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  513,	 // 0x0201
-  257,	 // 0x0101
-  257,	 // 0x0101
- 4573,	 // 0x11dd
-15420,	 // 0x3c3c
- 1810,	 // 0x0712
-63989,	 // 0xf9f5
-65523,	 // 0xfff3
- 1281,	 // 0x0501
- 1535,	 // 0x05ff
-65277,	 // 0xfefd
-65534,	 // 0xfffe
-  510,	 // 0x01fe
-  513,	 // 0x0201
-65535,	 // 0xffff
-65534,	 // 0xfffe
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-  257,	 // 0x0101
-62930,	 // 0xf5d2
- 4848,	 // 0x12f0
- 5917,	 // 0x171d
-65019,	 // 0xfdfb
-  508,	 // 0x01fc
-  257,	 // 0x0101
- 1023,	 // 0x03ff
-65281,	 // 0xff01
-65535,	 // 0xffff
-  510,	 // 0x01fe
-  513,	 // 0x0201
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65521,	 // 0xfff1
-64740,	 // 0xfce4
- 2570,	 // 0x0a0a
-  260,	 // 0x0104
-  770,	 // 0x0302
-  259,	 // 0x0103
-  256,	 // 0x0100
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-54773,	 // 0xd5f5
-63991,	 // 0xf9f7
-65262,	 // 0xfeee
-  779,	 // 0x030b
- 2047,	 // 0x07ff
-  514,	 // 0x0202
-  768,	 // 0x0300
-  257,	 // 0x0101
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  254,	 // 0x00fe
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-   32,	 // 0x0020
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-33027,	 // 0x8103
-56624,	 // 0xdd30
-  776,	 // 0x0308
-63744,	 // 0xf900
-  262,	 // 0x0106
-  254,	 // 0x00fe
-64514,	 // 0xfc02
-    2,	 // 0x0002
-    1,	 // 0x0001
-64512,	 // 0xfc00
-65026,	 // 0xfe02
-65025,	 // 0xfe01
-65280,	 // 0xff00
-65280,	 // 0xff00
-65024,	 // 0xfe00
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-33025,	 // 0x8101
-56872,	 // 0xde28
- 1787,	 // 0x06fb
-  256,	 // 0x0100
-  775,	 // 0x0307
-  768,	 // 0x0300
-    1,	 // 0x0001
-    4,	 // 0x0004
-  513,	 // 0x0201
-64770,	 // 0xfd02
-    2,	 // 0x0002
-  256,	 // 0x0100
-    1,	 // 0x0001
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-64768,	 // 0xfd00
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  512,	 // 0x0200
-  511,	 // 0x01ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  510,	 // 0x01fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32578,	 // 0x7f42
-13893,	 // 0x3645
- 6692,	 // 0x1a24
- 2062,	 // 0x080e
-65282,	 // 0xff02
-65025,	 // 0xfe01
-64251,	 // 0xfafb
-63995,	 // 0xf9fb
-64249,	 // 0xfaf9
-64763,	 // 0xfcfb
-65020,	 // 0xfdfc
-65278,	 // 0xfefe
-65535,	 // 0xffff
-65535,	 // 0xffff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-59120,	 // 0xe6f0
-64246,	 // 0xfaf6
-  767,	 // 0x02ff
- 2054,	 // 0x0806
- 2057,	 // 0x0809
- 1285,	 // 0x0505
-  516,	 // 0x0204
-  515,	 // 0x0203
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-48348,	 // 0xbcdc
-59867,	 // 0xe9db
-63987,	 // 0xf9f3
-  257,	 // 0x0101
- 2054,	 // 0x0806
- 1284,	 // 0x0504
- 1030,	 // 0x0406
- 1028,	 // 0x0404
-  772,	 // 0x0304
-  514,	 // 0x0202
-  258,	 // 0x0102
-  257,	 // 0x0101
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-65280,	 // 0xff00
-  255,	 // 0x00ff
-53479,	 // 0xd0e7
-60386,	 // 0xebe2
-62447,	 // 0xf3ef
-62967,	 // 0xf5f7
-65018,	 // 0xfdfa
-  253,	 // 0x00fd
-  515,	 // 0x0203
-  771,	 // 0x0303
-  772,	 // 0x0304
-  514,	 // 0x0202
-  258,	 // 0x0102
-  258,	 // 0x0102
-  257,	 // 0x0101
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-64776,	 // 0xfd08
-64001,	 // 0xfa01
-63483,	 // 0xf7fb
-62966,	 // 0xf5f6
-63478,	 // 0xf7f6
-64506,	 // 0xfbfa
-65277,	 // 0xfefd
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2816,	 // 0x0b00
- 1030,	 // 0x0406
-  516,	 // 0x0204
-    1,	 // 0x0001
-65024,	 // 0xfe00
-64768,	 // 0xfd00
-65534,	 // 0xfffe
-65279,	 // 0xfeff
-65280,	 // 0xff00
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64768,	 // 0xfd00
-  767,	 // 0x02ff
-  513,	 // 0x0201
- 1027,	 // 0x0403
-  259,	 // 0x0103
-65282,	 // 0xff02
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64769,	 // 0xfd01
-65283,	 // 0xff03
-  255,	 // 0x00ff
-  513,	 // 0x0201
-  257,	 // 0x0101
-    1,	 // 0x0001
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  514,	 // 0x0202
-  509,	 // 0x01fd
-    1,	 // 0x0001
-    2,	 // 0x0002
-65280,	 // 0xff00
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  254,	 // 0x00fe
-39857,	 // 0x9bb1
-63213,	 // 0xf6ed
-63200,	 // 0xf6e0
-65004,	 // 0xfdec
- 2302,	 // 0x08fe
- 1023,	 // 0x03ff
- 2818,	 // 0x0b02
- 1537,	 // 0x0601
- 1793,	 // 0x0701
-  254,	 // 0x00fe
- 1535,	 // 0x05ff
- 1276,	 // 0x04fc
-  767,	 // 0x02ff
-  765,	 // 0x02fd
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  510,	 // 0x01fe
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-10187,	 // 0x27cb
- 1781,	 // 0x06f5
-65532,	 // 0xfffc
-64763,	 // 0xfcfb
- 2048,	 // 0x0800
- 1028,	 // 0x0404
- 1025,	 // 0x0401
-  254,	 // 0x00fe
-  514,	 // 0x0202
-  512,	 // 0x0200
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-63693,	 // 0xf8cd
-64236,	 // 0xfaec
-65527,	 // 0xfff7
-64764,	 // 0xfcfc
- 2563,	 // 0x0a03
- 1290,	 // 0x050a
-  763,	 // 0x02fb
-65535,	 // 0xffff
-  769,	 // 0x0301
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
- 2495,	 // 0x09bf
-60908,	 // 0xedec
- 1022,	 // 0x03fe
-65018,	 // 0xfdfa
- 1545,	 // 0x0609
- 1547,	 // 0x060b
-65534,	 // 0xfffe
-64771,	 // 0xfd03
-  769,	 // 0x0301
-  766,	 // 0x02fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65280,	 // 0xff00
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-60117,	 // 0xead5
-60926,	 // 0xedfe
- 1793,	 // 0x0701
-64502,	 // 0xfbf6
-64770,	 // 0xfd02
- 2053,	 // 0x0805
-64769,	 // 0xfd01
-65283,	 // 0xff03
-  511,	 // 0x01ff
-  508,	 // 0x01fc
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-56874,	 // 0xde2a
-64008,	 // 0xfa08
-65016,	 // 0xfdf8
-65025,	 // 0xfe01
-63739,	 // 0xf8fb
- 1793,	 // 0x0701
-64771,	 // 0xfd03
-65535,	 // 0xffff
-    0,	 // 0x0000
-  510,	 // 0x01fe
-  509,	 // 0x01fd
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  563,	 // 0x0233
- 2562,	 // 0x0a02
-62958,	 // 0xf5ee
- 1808,	 // 0x0710
-63482,	 // 0xf7fa
-  766,	 // 0x02fe
-64770,	 // 0xfd02
-64507,	 // 0xfbfb
-  511,	 // 0x01ff
-  508,	 // 0x01fc
-  764,	 // 0x02fc
-65533,	 // 0xfffd
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
- 1842,	 // 0x0732
- 3593,	 // 0x0e09
-64253,	 // 0xfafd
- 2316,	 // 0x090c
-63484,	 // 0xf7fc
-64504,	 // 0xfbf8
-65021,	 // 0xfdfd
-64507,	 // 0xfbfb
-  254,	 // 0x00fe
-  507,	 // 0x01fb
-  251,	 // 0x00fb
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
- 3368,	 // 0x0d28
- 1531,	 // 0x05fb
-  269,	 // 0x010d
-  255,	 // 0x00ff
-64000,	 // 0xfa00
-63224,	 // 0xf6f8
-65276,	 // 0xfefc
-64766,	 // 0xfcfe
-65277,	 // 0xfefd
-  508,	 // 0x01fc
-65531,	 // 0xfffb
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
- 3825,	 // 0x0ef1
-63468,	 // 0xf7ec
-64779,	 // 0xfd0b
-63993,	 // 0xf9f9
-63999,	 // 0xf9ff
-63997,	 // 0xf9fd
-65278,	 // 0xfefe
-65277,	 // 0xfefd
-65533,	 // 0xfffd
-  509,	 // 0x01fd
-  252,	 // 0x00fc
-65280,	 // 0xff00
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-13695,	 // 0x357f
-  516,	 // 0x0204
-60413,	 // 0xebfd
-63477,	 // 0xf7f5
-60410,	 // 0xebfa
-64765,	 // 0xfcfd
-64508,	 // 0xfbfc
-  508,	 // 0x01fc
-65532,	 // 0xfffc
-  510,	 // 0x01fe
-  765,	 // 0x02fd
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-   40,	 // 0x0028
- 2045,	 // 0x07fd
-  761,	 // 0x02f9
-  509,	 // 0x01fd
-  512,	 // 0x0200
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63739,	 // 0xf8fb
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  257,	 // 0x0101
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63742,	 // 0xf8fe
-  766,	 // 0x02fe
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    2,	 // 0x0002
-  256,	 // 0x0100
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1536,	 // 0x0600
-  253,	 // 0x00fd
-64260,	 // 0xfb04
- 1279,	 // 0x04ff
- 1028,	 // 0x0404
-    4,	 // 0x0004
-65535,	 // 0xffff
-65534,	 // 0xfffe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2547,	 // 0x09f3
-64506,	 // 0xfbfa
-  259,	 // 0x0103
- 1798,	 // 0x0706
- 1800,	 // 0x0708
-65283,	 // 0xff03
-65022,	 // 0xfdfe
-65533,	 // 0xfffd
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-50156,	 // 0xc3ec
-60915,	 // 0xedf3
- 3836,	 // 0x0efc
- 1033,	 // 0x0409
-  773,	 // 0x0305
-    1,	 // 0x0001
-65027,	 // 0xfe03
-  511,	 // 0x01ff
-    2,	 // 0x0002
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61186,	 // 0xef02
- 2320,	 // 0x0910
- 3080,	 // 0x0c08
-63226,	 // 0xf6fa
-64245,	 // 0xfaf5
-  507,	 // 0x01fb
-  773,	 // 0x0305
-  258,	 // 0x0102
-65282,	 // 0xff02
-  257,	 // 0x0101
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-29214,	 // 0x721e
- 9263,	 // 0x242f
-62738,	 // 0xf512
-58598,	 // 0xe4e6
-61159,	 // 0xeee7
-  507,	 // 0x01fb
- 2051,	 // 0x0803
-  259,	 // 0x0103
-65024,	 // 0xfe00
-65280,	 // 0xff00
-  254,	 // 0x00fe
-    0,	 // 0x0000
-65280,	 // 0xff00
-  256,	 // 0x0100
-  258,	 // 0x0102
-  514,	 // 0x0202
-  258,	 // 0x0102
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-32556,	 // 0x7f2c
- 6950,	 // 0x1b26
-60929,	 // 0xee01
-60649,	 // 0xece9
-63475,	 // 0xf7f3
-    2,	 // 0x0002
-  768,	 // 0x0300
-    1,	 // 0x0001
-65278,	 // 0xfefe
-65535,	 // 0xffff
-  253,	 // 0x00fd
-65535,	 // 0xffff
-65280,	 // 0xff00
-  256,	 // 0x0100
-  258,	 // 0x0102
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-64007,	 // 0xfa07
-63477,	 // 0xf7f5
-64499,	 // 0xfbf3
- 1535,	 // 0x05ff
- 1544,	 // 0x0608
-65285,	 // 0xff05
-65278,	 // 0xfefe
-65280,	 // 0xff00
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-42460,	 // 0xa5dc
-58064,	 // 0xe2d0
- 1772,	 // 0x06ec
- 5389,	 // 0x150d
- 2829,	 // 0x0b0d
-    4,	 // 0x0004
-  253,	 // 0x00fd
-65279,	 // 0xfeff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  513,	 // 0x0201
-  256,	 // 0x0100
-  256,	 // 0x0100
-65535,	 // 0xffff
-65535,	 // 0xffff
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-57856,	 // 0xe200
-10790,	 // 0x2a26
-62478,	 // 0xf40e
-50671,	 // 0xc5ef
-61151,	 // 0xeedf
-65525,	 // 0xfff5
-  780,	 // 0x030c
- 1538,	 // 0x0602
-65282,	 // 0xff02
-  260,	 // 0x0104
-65280,	 // 0xff00
-65029,	 // 0xfe05
-64770,	 // 0xfd02
-64768,	 // 0xfd00
-65534,	 // 0xfffe
-65024,	 // 0xfe00
-    2,	 // 0x0002
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-  257,	 // 0x0101
-19991,	 // 0x4e17
-11026,	 // 0x2b12
- 7460,	 // 0x1d24
-62224,	 // 0xf310
-61421,	 // 0xefed
-60912,	 // 0xedf0
-61676,	 // 0xf0ec
-64503,	 // 0xfbf7
-  253,	 // 0x00fd
-    1,	 // 0x0001
-  510,	 // 0x01fe
-65284,	 // 0xff04
-    0,	 // 0x0000
-65279,	 // 0xfeff
-65533,	 // 0xfffd
-65535,	 // 0xffff
-  259,	 // 0x0103
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  257,	 // 0x0101
-18170,	 // 0x46fa
-21576,	 // 0x5448
-23637,	 // 0x5c55
-10289,	 // 0x2831
-53745,	 // 0xd1f1
-55773,	 // 0xd9dd
-57294,	 // 0xdfce
-62709,	 // 0xf4f5
-  250,	 // 0x00fa
-65534,	 // 0xfffe
-  252,	 // 0x00fc
-  258,	 // 0x0102
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-  256,	 // 0x0100
-  516,	 // 0x0204
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-  258,	 // 0x0102
- 8178,	 // 0x1ff2
-32621,	 // 0x7f6d
-26488,	 // 0x6778
-11823,	 // 0x2e2f
-47847,	 // 0xbae7
-56786,	 // 0xddd2
-59344,	 // 0xe7d0
-64255,	 // 0xfaff
-64764,	 // 0xfcfc
-64764,	 // 0xfcfc
-65020,	 // 0xfdfc
-  770,	 // 0x0302
-  766,	 // 0x02fe
-65280,	 // 0xff00
-  513,	 // 0x0201
-  514,	 // 0x0202
-  774,	 // 0x0306
-    0,	 // 0x0000
-  510,	 // 0x01fe
-  514,	 // 0x0202
- 7453,	 // 0x1d1d
-14639,	 // 0x392f
- 6705,	 // 0x1a31
-62212,	 // 0xf304
-61166,	 // 0xeeee
-  242,	 // 0x00f2
- 1276,	 // 0x04fc
- 1545,	 // 0x0609
-63741,	 // 0xf8fd
-  255,	 // 0x00ff
-64768,	 // 0xfd00
- 1028,	 // 0x0404
-  515,	 // 0x0203
-  256,	 // 0x0100
-  771,	 // 0x0303
-  516,	 // 0x0204
-    4,	 // 0x0004
-  257,	 // 0x0101
-  256,	 // 0x0100
-  258,	 // 0x0102
- 9215,	 // 0x23ff
-56523,	 // 0xdccb
-56292,	 // 0xdbe4
-55014,	 // 0xd6e6
- 4347,	 // 0x10fb
- 2828,	 // 0x0b0c
- 3349,	 // 0x0d15
- 2055,	 // 0x0807
-  255,	 // 0x00ff
-  770,	 // 0x0302
-  511,	 // 0x01ff
-  514,	 // 0x0202
-  259,	 // 0x0103
-  257,	 // 0x0101
-  258,	 // 0x0102
-    3,	 // 0x0003
-65282,	 // 0xff02
-  258,	 // 0x0102
-    1,	 // 0x0001
-    1,	 // 0x0001
-55525,	 // 0xd8e5
-53200,	 // 0xcfd0
-56787,	 // 0xddd3
-61685,	 // 0xf0f5
- 2305,	 // 0x0901
-  518,	 // 0x0206
- 1042,	 // 0x0412
- 1792,	 // 0x0700
-  516,	 // 0x0204
-65535,	 // 0xffff
-  765,	 // 0x02fd
-    0,	 // 0x0000
-65024,	 // 0xfe00
-    0,	 // 0x0000
-65279,	 // 0xfeff
-65280,	 // 0xff00
-65280,	 // 0xff00
-    1,	 // 0x0001
-65280,	 // 0xff00
-65279,	 // 0xfeff
-51708,	 // 0xc9fc
-60170,	 // 0xeb0a
-62185,	 // 0xf2e9
-  511,	 // 0x01ff
-    1,	 // 0x0001
-64768,	 // 0xfd00
-  777,	 // 0x0309
- 1023,	 // 0x03ff
-    7,	 // 0x0007
-65534,	 // 0xfffe
-  256,	 // 0x0100
-  254,	 // 0x00fe
-65280,	 // 0xff00
-65280,	 // 0xff00
-65278,	 // 0xfefe
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65535,	 // 0xffff
-63505,	 // 0xf811
-64517,	 // 0xfc05
-63483,	 // 0xf7fb
-  250,	 // 0x00fa
-65023,	 // 0xfdff
-64513,	 // 0xfc01
- 2052,	 // 0x0804
-    1,	 // 0x0001
-65029,	 // 0xfe05
-65535,	 // 0xffff
-    0,	 // 0x0000
-  766,	 // 0x02fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  263,	 // 0x0107
-64751,	 // 0xfcef
-64247,	 // 0xfaf7
- 2046,	 // 0x07fe
-  770,	 // 0x0302
-    3,	 // 0x0003
- 1538,	 // 0x0602
-    1,	 // 0x0001
-65283,	 // 0xff03
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65280,	 // 0xff00
-58855,	 // 0xe5e7
-52674,	 // 0xcdc2
-64236,	 // 0xfaec
- 6154,	 // 0x180a
- 3601,	 // 0x0e11
-  518,	 // 0x0206
-  515,	 // 0x0203
-  257,	 // 0x0101
-65026,	 // 0xfe02
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-   37,	 // 0x0025
- 7148,	 // 0x1bec
-65516,	 // 0xffec
-65275,	 // 0xfefb
-65530,	 // 0xfffa
-65019,	 // 0xfdfb
-  255,	 // 0x00ff
-  250,	 // 0x00fa
-65020,	 // 0xfdfc
-  255,	 // 0x00ff
-  253,	 // 0x00fd
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-61954,	 // 0xf202
- 1795,	 // 0x0703
-65020,	 // 0xfdfc
-  508,	 // 0x01fc
-65279,	 // 0xfeff
-65281,	 // 0xff01
-  508,	 // 0x01fc
-65277,	 // 0xfefd
-  256,	 // 0x0100
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
- 3850,	 // 0x0f0a
-65529,	 // 0xfff9
-    0,	 // 0x0000
-  769,	 // 0x0301
-65025,	 // 0xfe01
- 1021,	 // 0x03fd
-65277,	 // 0xfefd
-  257,	 // 0x0101
-65533,	 // 0xfffd
-  511,	 // 0x01ff
-  766,	 // 0x02fe
-  257,	 // 0x0101
-  256,	 // 0x0100
-  256,	 // 0x0100
-  510,	 // 0x01fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-61965,	 // 0xf20d
- 4608,	 // 0x1200
-65008,	 // 0xfdf0
-65282,	 // 0xff02
- 2307,	 // 0x0903
-65281,	 // 0xff01
- 1279,	 // 0x04ff
-65278,	 // 0xfefe
-  514,	 // 0x0202
-  253,	 // 0x00fd
-  256,	 // 0x0100
-  767,	 // 0x02ff
-  257,	 // 0x0101
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-57324,	 // 0xdfec
- 3578,	 // 0x0dfa
-  500,	 // 0x01f4
- 1793,	 // 0x0701
- 2821,	 // 0x0b05
-  257,	 // 0x0101
-  765,	 // 0x02fd
-64768,	 // 0xfd00
- 1024,	 // 0x0400
-  253,	 // 0x00fd
-  512,	 // 0x0200
-  511,	 // 0x01ff
-  512,	 // 0x0200
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-11439,	 // 0x2caf
- 2300,	 // 0x08fc
- 1542,	 // 0x0606
- 3326,	 // 0x0cfe
- 1287,	 // 0x0507
-  255,	 // 0x00ff
-65016,	 // 0xfdf8
-64257,	 // 0xfb01
-  764,	 // 0x02fc
-65532,	 // 0xfffc
-  253,	 // 0x00fd
-  510,	 // 0x01fe
-  512,	 // 0x0200
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-12514,	 // 0x30e2
- 1247,	 // 0x04df
- 1289,	 // 0x0509
-  760,	 // 0x02f8
-65288,	 // 0xff08
-65280,	 // 0xff00
-64763,	 // 0xfcfb
-    0,	 // 0x0000
-  508,	 // 0x01fc
-65277,	 // 0xfefd
-65532,	 // 0xfffc
-  510,	 // 0x01fe
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-54801,	 // 0xd611
-63737,	 // 0xf8f9
- 3597,	 // 0x0e0d
-64761,	 // 0xfcf9
-  777,	 // 0x0309
-  261,	 // 0x0105
-65278,	 // 0xfefe
-  513,	 // 0x0201
-  765,	 // 0x02fd
-    0,	 // 0x0000
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-51197,	 // 0xc7fd
-61944,	 // 0xf1f8
- 4113,	 // 0x1011
-64762,	 // 0xfcfa
-  518,	 // 0x0206
-  775,	 // 0x0307
-  256,	 // 0x0100
-    2,	 // 0x0002
- 1278,	 // 0x04fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-54778,	 // 0xd5fa
-61172,	 // 0xeef4
- 1546,	 // 0x060a
-64249,	 // 0xfaf9
-  258,	 // 0x0102
- 1029,	 // 0x0405
-  514,	 // 0x0202
-65283,	 // 0xff03
- 1023,	 // 0x03ff
-65535,	 // 0xffff
-  257,	 // 0x0101
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-27007,	 // 0x697f
-62983,	 // 0xf607
-65025,	 // 0xfe01
-  505,	 // 0x01f9
-  517,	 // 0x0205
- 1283,	 // 0x0503
-  259,	 // 0x0103
-65026,	 // 0xfe02
- 1277,	 // 0x04fd
-65534,	 // 0xfffe
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    1,	 // 0x0001
-  257,	 // 0x0101
-    0,	 // 0x0000
-  116,	 // 0x0074
- 8188,	 // 0x1ffc
- 7192,	 // 0x1c18
- 6176,	 // 0x1820
-62462,	 // 0xf3fe
-59881,	 // 0xe9e9
-63986,	 // 0xf9f2
-  763,	 // 0x02fb
-  516,	 // 0x0204
-65283,	 // 0xff03
-  514,	 // 0x0202
-  513,	 // 0x0201
-    3,	 // 0x0003
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-  257,	 // 0x0101
-  258,	 // 0x0102
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  257,	 // 0x0101
-13077,	 // 0x3315
-12855,	 // 0x3237
- 2072,	 // 0x0818
-61176,	 // 0xeef8
-60648,	 // 0xece8
-64246,	 // 0xfaf6
- 1277,	 // 0x04fd
-  258,	 // 0x0102
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-  257,	 // 0x0101
-65280,	 // 0xff00
-  256,	 // 0x0100
-  257,	 // 0x0101
-32548,	 // 0x7f24
- 6701,	 // 0x1a2d
-62211,	 // 0xf303
-61175,	 // 0xeef7
-65527,	 // 0xfff7
-    4,	 // 0x0004
-  770,	 // 0x0302
-65022,	 // 0xfdfe
-65021,	 // 0xfdfd
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-63243,	 // 0xf70b
-59123,	 // 0xe6f3
-62949,	 // 0xf5e5
-    8,	 // 0x0008
- 6159,	 // 0x180f
- 1294,	 // 0x050e
-65030,	 // 0xfe06
-65531,	 // 0xfffb
-65533,	 // 0xfffd
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-37603,	 // 0x92e3
-58346,	 // 0xe3ea
-64490,	 // 0xfbea
- 2310,	 // 0x0906
- 4622,	 // 0x120e
-  518,	 // 0x0206
-64771,	 // 0xfd03
-  253,	 // 0x00fd
-  513,	 // 0x0201
-65282,	 // 0xff02
-  256,	 // 0x0100
-  256,	 // 0x0100
-  257,	 // 0x0101
-    1,	 // 0x0001
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-57846,	 // 0xe1f6
-63728,	 // 0xf8f0
-64255,	 // 0xfaff
-  761,	 // 0x02f9
-65535,	 // 0xffff
-65277,	 // 0xfefd
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  257,	 // 0x0101
-65280,	 // 0xff00
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  513,	 // 0x0201
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
- 2563,	 // 0x0a03
-64753,	 // 0xfcf1
-  260,	 // 0x0104
-  766,	 // 0x02fe
-65023,	 // 0xfdff
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1532,	 // 0x05fc
-65279,	 // 0xfeff
-  767,	 // 0x02ff
-  771,	 // 0x0303
-  257,	 // 0x0101
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64503,	 // 0xfbf7
-65015,	 // 0xfdf7
-  251,	 // 0x00fb
-  771,	 // 0x0303
-  770,	 // 0x0302
-  258,	 // 0x0102
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64510,	 // 0xfbfe
-65529,	 // 0xfff9
-65277,	 // 0xfefd
-  768,	 // 0x0300
-  515,	 // 0x0203
-  515,	 // 0x0203
-  257,	 // 0x0101
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-60660,	 // 0xecf4
-64246,	 // 0xfaf6
-63993,	 // 0xf9f9
- 1279,	 // 0x04ff
-  518,	 // 0x0206
-  259,	 // 0x0103
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    9,	 // 0x0009
-53749,	 // 0xd1f5
-63442,	 // 0xf7d2
-64501,	 // 0xfbf5
- 1271,	 // 0x04f7
- 1025,	 // 0x0401
-  253,	 // 0x00fd
- 1025,	 // 0x0401
-  256,	 // 0x0100
-  514,	 // 0x0202
-  254,	 // 0x00fe
-  256,	 // 0x0100
- 1023,	 // 0x03ff
-  513,	 // 0x0201
-  767,	 // 0x02ff
-65280,	 // 0xff00
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-63735,	 // 0xf8f7
- 1007,	 // 0x03ef
-  513,	 // 0x0201
- 1019,	 // 0x03fb
- 1025,	 // 0x0401
-65535,	 // 0xffff
-  770,	 // 0x0302
-65534,	 // 0xfffe
-  258,	 // 0x0102
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  512,	 // 0x0200
-  257,	 // 0x0101
-  256,	 // 0x0100
-65280,	 // 0xff00
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 9451,	 // 0x24eb
- 3324,	 // 0x0cfc
-  266,	 // 0x010a
- 1790,	 // 0x06fe
- 1535,	 // 0x05ff
-    0,	 // 0x0000
-  513,	 // 0x0201
-65276,	 // 0xfefc
-    0,	 // 0x0000
-65532,	 // 0xfffc
-  255,	 // 0x00ff
-  767,	 // 0x02ff
-  513,	 // 0x0201
-  256,	 // 0x0100
-    0,	 // 0x0000
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
- 5890,	 // 0x1702
- 2302,	 // 0x08fe
-64777,	 // 0xfd09
- 2048,	 // 0x0800
- 2561,	 // 0x0a01
- 1029,	 // 0x0405
-  256,	 // 0x0100
-65277,	 // 0xfefd
-65280,	 // 0xff00
-65020,	 // 0xfdfc
-65534,	 // 0xfffe
-  767,	 // 0x02ff
-  770,	 // 0x0302
-  258,	 // 0x0102
-    0,	 // 0x0000
-  510,	 // 0x01fe
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-40697,	 // 0x9ef9
- 3317,	 // 0x0cf5
-64260,	 // 0xfb04
- 5376,	 // 0x1500
- 4362,	 // 0x110a
- 1539,	 // 0x0603
-65276,	 // 0xfefc
-65278,	 // 0xfefe
-65280,	 // 0xff00
-65021,	 // 0xfdfd
-65278,	 // 0xfefe
- 1023,	 // 0x03ff
- 1027,	 // 0x0403
-  515,	 // 0x0203
-65280,	 // 0xff00
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-55223,	 // 0xd7b7
- 7178,	 // 0x1c0a
-64012,	 // 0xfa0c
- 6143,	 // 0x17ff
- 3587,	 // 0x0e03
-  763,	 // 0x02fb
-64500,	 // 0xfbf4
-64002,	 // 0xfa02
-65277,	 // 0xfefd
-65021,	 // 0xfdfd
-64765,	 // 0xfcfd
- 1279,	 // 0x04ff
- 1028,	 // 0x0404
-  515,	 // 0x0203
-65280,	 // 0xff00
-  510,	 // 0x01fe
-    0,	 // 0x0000
-65279,	 // 0xfeff
-65279,	 // 0xfeff
-65534,	 // 0xfffe
-17950,	 // 0x461e
- 8981,	 // 0x2315
-60417,	 // 0xec01
-65012,	 // 0xfdf4
-  756,	 // 0x02f4
-65016,	 // 0xfdf8
-64244,	 // 0xfaf4
-64258,	 // 0xfb02
-65021,	 // 0xfdfd
-64765,	 // 0xfcfd
-64763,	 // 0xfcfb
-  510,	 // 0x01fe
- 1027,	 // 0x0403
-  772,	 // 0x0304
-    2,	 // 0x0002
-  512,	 // 0x0200
-    2,	 // 0x0002
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-15738,	 // 0x3d7a
- 4639,	 // 0x121f
-63224,	 // 0xf6f8
-59894,	 // 0xe9f6
-65524,	 // 0xfff4
-65277,	 // 0xfefd
-65532,	 // 0xfffc
-65282,	 // 0xff02
-    1,	 // 0x0001
-65022,	 // 0xfdfe
-65022,	 // 0xfdfe
-  255,	 // 0x00ff
-  515,	 // 0x0203
-  771,	 // 0x0303
-  258,	 // 0x0102
-  513,	 // 0x0201
-  258,	 // 0x0102
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5167,	 // 0x142f
-64786,	 // 0xfd12
- 3837,	 // 0x0efd
-59648,	 // 0xe900
-65527,	 // 0xfff7
-  769,	 // 0x0301
- 1283,	 // 0x0503
-  257,	 // 0x0101
-  514,	 // 0x0202
-65279,	 // 0xfeff
-65280,	 // 0xff00
-  256,	 // 0x0100
-  257,	 // 0x0101
-  513,	 // 0x0201
-  257,	 // 0x0101
-  257,	 // 0x0101
-    1,	 // 0x0001
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-60396,	 // 0xebec
-61957,	 // 0xf205
- 5892,	 // 0x1704
-62979,	 // 0xf603
-  506,	 // 0x01fa
- 1280,	 // 0x0500
- 1031,	 // 0x0407
-  769,	 // 0x0301
-  257,	 // 0x0101
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  512,	 // 0x0200
-  256,	 // 0x0100
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-64206,	 // 0xface
-57283,	 // 0xdfc3
- 4345,	 // 0x10f9
- 1281,	 // 0x0501
- 2313,	 // 0x0909
- 1023,	 // 0x03ff
- 1286,	 // 0x0506
-  506,	 // 0x01fa
-  509,	 // 0x01fd
-  766,	 // 0x02fe
-  509,	 // 0x01fd
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  127,	 // 0x007f
- 1779,	 // 0x06f3
-64510,	 // 0xfbfe
-  738,	 // 0x02e2
- 2337,	 // 0x0921
-65017,	 // 0xfdf9
- 2046,	 // 0x07fe
-63491,	 // 0xf803
- 1797,	 // 0x0705
-65284,	 // 0xff04
- 1536,	 // 0x0600
-  508,	 // 0x01fc
-  259,	 // 0x0103
-    2,	 // 0x0002
-  513,	 // 0x0201
-  513,	 // 0x0201
-  254,	 // 0x00fe
-65282,	 // 0xff02
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
- 1022,	 // 0x03fe
- 4593,	 // 0x11f1
-64528,	 // 0xfc10
-65526,	 // 0xfff6
-64006,	 // 0xfa06
-65022,	 // 0xfdfe
-64251,	 // 0xfafb
- 1797,	 // 0x0705
-64259,	 // 0xfb03
- 1533,	 // 0x05fd
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  257,	 // 0x0101
-65280,	 // 0xff00
-  512,	 // 0x0200
-    0,	 // 0x0000
-65282,	 // 0xff02
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
- 4614,	 // 0x1206
-64284,	 // 0xfb1c
-64998,	 // 0xfde6
-63502,	 // 0xf80e
-64512,	 // 0xfc00
-64252,	 // 0xfafc
- 2307,	 // 0x0903
-64000,	 // 0xfa00
-  765,	 // 0x02fd
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  256,	 // 0x0100
-65025,	 // 0xfe01
-  512,	 // 0x0200
-65281,	 // 0xff01
-65282,	 // 0xff02
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-63220,	 // 0xf6f4
-  517,	 // 0x0205
-64797,	 // 0xfd1d
-63979,	 // 0xf9eb
-63756,	 // 0xf90c
- 1029,	 // 0x0405
-63749,	 // 0xf905
- 1783,	 // 0x06f7
-64770,	 // 0xfd02
-65279,	 // 0xfeff
-    3,	 // 0x0003
-  257,	 // 0x0101
-65534,	 // 0xfffe
-65282,	 // 0xff02
-  256,	 // 0x0100
-65024,	 // 0xfe00
-65026,	 // 0xfe02
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-61705,	 // 0xf109
-59372,	 // 0xe7ec
- 3092,	 // 0x0c14
-62468,	 // 0xf404
-63735,	 // 0xf8f7
- 5136,	 // 0x1410
-62736,	 // 0xf510
-  999,	 // 0x03e7
- 1287,	 // 0x0507
-63999,	 // 0xf9ff
-  261,	 // 0x0105
-65283,	 // 0xff03
-  254,	 // 0x00fe
-65285,	 // 0xff05
-    0,	 // 0x0000
-65025,	 // 0xfe01
-65281,	 // 0xff01
-65535,	 // 0xffff
-    1,	 // 0x0001
-65279,	 // 0xfeff
-63517,	 // 0xf81d
-50909,	 // 0xc6dd
- 7401,	 // 0x1ce9
-63282,	 // 0xf732
-58319,	 // 0xe3cf
-11540,	 // 0x2d14
-62751,	 // 0xf51f
-65247,	 // 0xfedf
- 3853,	 // 0x0f0d
-63231,	 // 0xf6ff
- 1283,	 // 0x0503
-65285,	 // 0xff05
-  253,	 // 0x00fd
-  518,	 // 0x0206
-65282,	 // 0xff02
-65280,	 // 0xff00
-    3,	 // 0x0003
-65024,	 // 0xfe00
-    1,	 // 0x0001
-65280,	 // 0xff00
-14596,	 // 0x3904
-48667,	 // 0xbe1b
- 4779,	 // 0x12ab
- 4946,	 // 0x1352
-53699,	 // 0xd1c3
-14077,	 // 0x36fd
-65331,	 // 0xff33
-61401,	 // 0xefd9
- 5896,	 // 0x1708
-62980,	 // 0xf604
- 1534,	 // 0x05fe
-    7,	 // 0x0007
-65533,	 // 0xfffd
-  516,	 // 0x0204
-    4,	 // 0x0004
-65024,	 // 0xfe00
-  771,	 // 0x0303
-65279,	 // 0xfeff
-  256,	 // 0x0100
-  256,	 // 0x0100
-20721,	 // 0x50f1
-48200,	 // 0xbc48
-64897,	 // 0xfd81
-12373,	 // 0x3055
-52441,	 // 0xccd9
-12770,	 // 0x31e2
- 1854,	 // 0x073e
-59352,	 // 0xe7d8
- 6153,	 // 0x1809
-63494,	 // 0xf806
- 1276,	 // 0x04fc
-  262,	 // 0x0106
-65532,	 // 0xfffc
-  773,	 // 0x0305
-65284,	 // 0xff04
-65280,	 // 0xff00
-  771,	 // 0x0303
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-10998,	 // 0x2af6
-47677,	 // 0xba3d
-64392,	 // 0xfb88
-13128,	 // 0x3348
-55275,	 // 0xd7eb
-11240,	 // 0x2be8
-65330,	 // 0xff32
-62429,	 // 0xf3dd
- 3855,	 // 0x0f0f
-63746,	 // 0xf902
- 1022,	 // 0x03fe
-65288,	 // 0xff08
-65534,	 // 0xfffe
- 1029,	 // 0x0405
-65027,	 // 0xfe03
-    1,	 // 0x0001
-  769,	 // 0x0301
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
- 3073,	 // 0x0c01
-48427,	 // 0xbd2b
-  175,	 // 0x00af
- 5935,	 // 0x172f
-61166,	 // 0xeeee
- 8961,	 // 0x2301
-64280,	 // 0xfb18
- 1518,	 // 0x05ee
- 1292,	 // 0x050c
-65279,	 // 0xfeff
-  514,	 // 0x0202
-65285,	 // 0xff05
-  254,	 // 0x00fe
- 1028,	 // 0x0404
-65282,	 // 0xff02
-  259,	 // 0x0103
-  513,	 // 0x0201
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-30478,	 // 0x770e
-52535,	 // 0xcd37
-62165,	 // 0xf2d5
-64785,	 // 0xfd11
- 1530,	 // 0x05fa
- 8185,	 // 0x1ff9
-  526,	 // 0x020e
- 2807,	 // 0x0af7
-  259,	 // 0x0103
-    2,	 // 0x0002
-  514,	 // 0x0202
-65284,	 // 0xff04
-  515,	 // 0x0203
- 1031,	 // 0x0407
- 1028,	 // 0x0404
-    3,	 // 0x0003
-  513,	 // 0x0201
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-  202,	 // 0x00ca
-65013,	 // 0xfdf5
-  768,	 // 0x0300
-65014,	 // 0xfdf6
-64253,	 // 0xfafd
-65275,	 // 0xfefb
-  258,	 // 0x0102
-65533,	 // 0xfffd
-65277,	 // 0xfefd
-65534,	 // 0xfffe
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64013,	 // 0xfa0d
- 1015,	 // 0x03f7
-65275,	 // 0xfefb
-  254,	 // 0x00fe
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1520,	 // 0x05f0
-  766,	 // 0x02fe
-  512,	 // 0x0200
-  512,	 // 0x0200
-65279,	 // 0xfeff
-65532,	 // 0xfffc
-65024,	 // 0xfe00
-  258,	 // 0x0102
- 1023,	 // 0x03ff
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-59386,	 // 0xe7fa
-    7,	 // 0x0007
-65272,	 // 0xfef8
-64770,	 // 0xfd02
-  514,	 // 0x0202
-  249,	 // 0x00f9
-65280,	 // 0xff00
-  771,	 // 0x0303
-  257,	 // 0x0101
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-52778,	 // 0xce2a
-64505,	 // 0xfbf9
-62960,	 // 0xf5f0
-62467,	 // 0xf403
- 2054,	 // 0x0806
-65275,	 // 0xfefb
-  768,	 // 0x0300
-  516,	 // 0x0204
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
- 8126,	 // 0x1fbe
-62715,	 // 0xf4fb
-    1,	 // 0x0001
-64771,	 // 0xfd03
-  517,	 // 0x0205
-64765,	 // 0xfcfd
-  765,	 // 0x02fd
-65027,	 // 0xfe03
-  764,	 // 0x02fc
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2689,	 // 0x0a81
-  255,	 // 0x00ff
- 4373,	 // 0x1115
- 2555,	 // 0x09fb
-63998,	 // 0xf9fe
-65279,	 // 0xfeff
-65533,	 // 0xfffd
-65535,	 // 0xffff
-  252,	 // 0x00fc
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  256,	 // 0x0100
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-48402,	 // 0xbd12
- 1526,	 // 0x05f6
-   11,	 // 0x000b
- 2290,	 // 0x08f2
-  259,	 // 0x0103
-  774,	 // 0x0306
-64768,	 // 0xfd00
-  508,	 // 0x01fc
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  254,	 // 0x00fe
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-11386,	 // 0x2c7a
- 2774,	 // 0x0ad6
-59128,	 // 0xe6f8
-  240,	 // 0x00f0
- 1545,	 // 0x0609
-  778,	 // 0x030a
-64768,	 // 0xfd00
-  252,	 // 0x00fc
-  256,	 // 0x0100
-65281,	 // 0xff01
-  510,	 // 0x01fe
-  253,	 // 0x00fd
-    1,	 // 0x0001
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32082,	 // 0x7d52
- 3816,	 // 0x0ee8
-58860,	 // 0xe5ec
-64509,	 // 0xfbfd
- 1029,	 // 0x0405
-  264,	 // 0x0108
-65023,	 // 0xfdff
-  509,	 // 0x01fd
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  509,	 // 0x01fd
-65533,	 // 0xfffd
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 7117,	 // 0x1bcd
-  590,	 // 0x024e
- 2301,	 // 0x08fd
-    8,	 // 0x0008
-65021,	 // 0xfdfd
-64770,	 // 0xfd02
-  252,	 // 0x00fc
-65026,	 // 0xfe02
-  254,	 // 0x00fe
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  256,	 // 0x0100
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
-   63,	 // 0x003f
-64490,	 // 0xfbea
- 4883,	 // 0x1313
-56333,	 // 0xdc0d
- 8169,	 // 0x1fe9
-59930,	 // 0xea1a
-  489,	 // 0x01e9
-  287,	 // 0x011f
-  742,	 // 0x02e6
-63488,	 // 0xf800
-64265,	 // 0xfb09
-65534,	 // 0xfffe
-  509,	 // 0x01fd
-64515,	 // 0xfc03
-  509,	 // 0x01fd
-64772,	 // 0xfd04
-65280,	 // 0xff00
-  512,	 // 0x0200
-65026,	 // 0xfe02
-  257,	 // 0x0101
-  256,	 // 0x0100
-48903,	 // 0xbf07
- 8680,	 // 0x21e8
-59952,	 // 0xea30
- 1983,	 // 0x07bf
- 2885,	 // 0x0b45
-58833,	 // 0xe5d1
- 7454,	 // 0x1d1e
-61932,	 // 0xf1ec
-  517,	 // 0x0205
-  263,	 // 0x0107
-65532,	 // 0xfffc
-  765,	 // 0x02fd
-65028,	 // 0xfe04
-  252,	 // 0x00fc
-65285,	 // 0xff05
-  510,	 // 0x01fe
-    0,	 // 0x0000
-65282,	 // 0xff02
-  255,	 // 0x00ff
-  512,	 // 0x0200
- 3340,	 // 0x0d0c
- 6065,	 // 0x17b1
- 3670,	 // 0x0e56
-50084,	 // 0xc3a4
-20047,	 // 0x4e4f
-47073,	 // 0xb7e1
-14836,	 // 0x39f4
-56849,	 // 0xde11
- 2554,	 // 0x09fa
- 1541,	 // 0x0605
-65275,	 // 0xfefb
-  252,	 // 0x00fc
-  263,	 // 0x0107
-65020,	 // 0xfdfc
-  259,	 // 0x0103
-  254,	 // 0x00fe
-65535,	 // 0xffff
-  260,	 // 0x0104
-65535,	 // 0xffff
-  513,	 // 0x0201
-20743,	 // 0x5107
-50629,	 // 0xc5c5
-22584,	 // 0x5838
-35298,	 // 0x89e2
-32767,	 // 0x7fff
-46385,	 // 0xb531
- 8366,	 // 0x20ae
-62020,	 // 0xf244
- 1250,	 // 0x04e2
- 3076,	 // 0x0c04
-65274,	 // 0xfefa
-64764,	 // 0xfcfc
- 1539,	 // 0x0603
-64256,	 // 0xfb00
- 1021,	 // 0x03fd
-  515,	 // 0x0203
-65277,	 // 0xfefd
- 1027,	 // 0x0403
-65023,	 // 0xfdff
-  513,	 // 0x0201
-13076,	 // 0x3314
-45080,	 // 0xb018
-27384,	 // 0x6af8
-46910,	 // 0xb73e
-17828,	 // 0x45a4
-  102,	 // 0x0066
-56220,	 // 0xdb9c
- 8258,	 // 0x2042
-62438,	 // 0xf3e6
- 3838,	 // 0x0efe
-65021,	 // 0xfdfd
-    1,	 // 0x0001
- 1020,	 // 0x03fc
-  262,	 // 0x0106
-65530,	 // 0xfffa
- 1540,	 // 0x0604
-65023,	 // 0xfdff
- 1024,	 // 0x0400
-65025,	 // 0xfe01
-  511,	 // 0x01ff
- 4872,	 // 0x1308
-60197,	 // 0xeb25
-14566,	 // 0x38e6
- 1354,	 // 0x054a
-62632,	 // 0xf4a8
-15685,	 // 0x3d45
-49360,	 // 0xc0d0
-11280,	 // 0x2c10
-61697,	 // 0xf101
- 2553,	 // 0x09f9
-    1,	 // 0x0001
- 1282,	 // 0x0502
-  253,	 // 0x00fd
- 1795,	 // 0x0703
-65023,	 // 0xfdff
- 1537,	 // 0x0601
-    0,	 // 0x0000
- 1021,	 // 0x03fd
-  256,	 // 0x0100
-65280,	 // 0xff00
- 7676,	 // 0x1dfc
- 1790,	 // 0x06fe
-  491,	 // 0x01eb
- 8481,	 // 0x2121
-55774,	 // 0xd9de
-13328,	 // 0x3410
-55299,	 // 0xd803
- 5874,	 // 0x16f2
-65035,	 // 0xfe0b
-  504,	 // 0x01f8
- 1023,	 // 0x03ff
- 1023,	 // 0x03ff
-    0,	 // 0x0000
- 1025,	 // 0x0401
-    0,	 // 0x0000
- 1022,	 // 0x03fe
-  514,	 // 0x0202
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65024,	 // 0xfe00
-65019,	 // 0xfdfb
- 1786,	 // 0x06fa
-59620,	 // 0xe8e4
- 7687,	 // 0x1e07
-57858,	 // 0xe202
- 5112,	 // 0x13f8
-63249,	 // 0xf711
-  754,	 // 0x02f2
- 1029,	 // 0x0405
-  255,	 // 0x00ff
-  507,	 // 0x01fb
-  509,	 // 0x01fd
-65282,	 // 0xff02
-  766,	 // 0x02fe
-    1,	 // 0x0001
-65534,	 // 0xfffe
-  513,	 // 0x0201
-65280,	 // 0xff00
-  256,	 // 0x0100
-65024,	 // 0xfe00
-56569,	 // 0xdcf9
- 1031,	 // 0x0407
-61674,	 // 0xf0ea
- 4093,	 // 0x0ffd
-63240,	 // 0xf708
-65013,	 // 0xfdf5
- 1546,	 // 0x060a
-65016,	 // 0xfdf8
-65281,	 // 0xff01
-  514,	 // 0x0202
-  252,	 // 0x00fc
-  253,	 // 0x00fd
-65535,	 // 0xffff
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65281,	 // 0xff01
-  518,	 // 0x0206
-64769,	 // 0xfd01
-  248,	 // 0x00f8
-    1,	 // 0x0001
-63996,	 // 0xf9fc
- 1284,	 // 0x0504
-65275,	 // 0xfefb
-64511,	 // 0xfbff
-  770,	 // 0x0302
-65533,	 // 0xfffd
-  510,	 // 0x01fe
-65534,	 // 0xfffe
-  510,	 // 0x01fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-59375,	 // 0xe7ef
-    8,	 // 0x0008
-64008,	 // 0xfa08
-64243,	 // 0xfaf3
-64516,	 // 0xfc04
-64253,	 // 0xfafd
-  261,	 // 0x0105
-  252,	 // 0x00fc
-64000,	 // 0xfa00
-65280,	 // 0xff00
-65023,	 // 0xfdff
-  256,	 // 0x0100
-65533,	 // 0xfffd
-  255,	 // 0x00ff
-65023,	 // 0xfdff
-65281,	 // 0xff01
-  767,	 // 0x02ff
-65535,	 // 0xffff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  254,	 // 0x00fe
-63997,	 // 0xf9fd
-65282,	 // 0xff02
-65278,	 // 0xfefe
-  767,	 // 0x02ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1026,	 // 0x0402
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  766,	 // 0x02fe
- 1020,	 // 0x03fc
-  512,	 // 0x0200
-  257,	 // 0x0101
-  257,	 // 0x0101
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63494,	 // 0xf806
- 1276,	 // 0x04fc
-  512,	 // 0x0200
-  256,	 // 0x0100
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5885,	 // 0x16fd
-  759,	 // 0x02f7
-    2,	 // 0x0002
-65278,	 // 0xfefe
-65282,	 // 0xff02
-    2,	 // 0x0002
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-19168,	 // 0x4ae0
-64237,	 // 0xfaed
-64519,	 // 0xfc07
-64771,	 // 0xfd03
-  255,	 // 0x00ff
-65283,	 // 0xff03
-65535,	 // 0xffff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-56825,	 // 0xddf9
-62235,	 // 0xf31b
-65278,	 // 0xfefe
-  266,	 // 0x010a
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-64513,	 // 0xfc01
-  256,	 // 0x0100
-65280,	 // 0xff00
-    1,	 // 0x0001
-65280,	 // 0xff00
-    1,	 // 0x0001
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-33062,	 // 0x8126
-64559,	 // 0xfc2f
-  761,	 // 0x02f9
-  514,	 // 0x0202
-  512,	 // 0x0200
-  506,	 // 0x01fa
-65025,	 // 0xfe01
-65280,	 // 0xff00
-65282,	 // 0xff02
-65281,	 // 0xff01
-65282,	 // 0xff02
-    2,	 // 0x0002
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-50207,	 // 0xc41f
-  780,	 // 0x030c
-    3,	 // 0x0003
-65530,	 // 0xfffa
-  513,	 // 0x0201
-  254,	 // 0x00fe
-  767,	 // 0x02ff
-65280,	 // 0xff00
-    2,	 // 0x0002
-65280,	 // 0xff00
-65282,	 // 0xff02
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-29665,	 // 0x73e1
- 4045,	 // 0x0fcd
-  519,	 // 0x0207
-65015,	 // 0xfdf7
-  766,	 // 0x02fe
-    3,	 // 0x0003
- 1023,	 // 0x03ff
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  251,	 // 0x00fb
-54740,	 // 0xd5d4
- 3815,	 // 0x0ee7
-60154,	 // 0xeafa
- 1524,	 // 0x05f4
-  763,	 // 0x02fb
- 1026,	 // 0x0402
-  507,	 // 0x01fb
-65279,	 // 0xfeff
-  511,	 // 0x01ff
-65535,	 // 0xffff
-  253,	 // 0x00fd
- 1024,	 // 0x0400
- 1026,	 // 0x0402
-  769,	 // 0x0301
-65535,	 // 0xffff
-65276,	 // 0xfefc
-  253,	 // 0x00fd
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-59143,	 // 0xe707
- 4099,	 // 0x1003
-62469,	 // 0xf405
- 1275,	 // 0x04fb
-65027,	 // 0xfe03
-65282,	 // 0xff02
-  766,	 // 0x02fe
-  255,	 // 0x00ff
-65281,	 // 0xff01
-65024,	 // 0xfe00
-65535,	 // 0xffff
- 1025,	 // 0x0401
-  515,	 // 0x0203
-  258,	 // 0x0102
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-60437,	 // 0xec15
- 4361,	 // 0x1109
-64511,	 // 0xfbff
- 2554,	 // 0x09fa
-64519,	 // 0xfc07
-  252,	 // 0x00fc
-  769,	 // 0x0301
-  512,	 // 0x0200
-    0,	 // 0x0000
-64766,	 // 0xfcfe
-  511,	 // 0x01ff
- 1537,	 // 0x0601
- 1028,	 // 0x0404
-  771,	 // 0x0303
-65024,	 // 0xfe00
-  254,	 // 0x00fe
-  256,	 // 0x0100
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 8962,	 // 0x2302
-65040,	 // 0xfe10
-  749,	 // 0x02ed
- 3837,	 // 0x0efd
-  269,	 // 0x010d
- 1019,	 // 0x03fb
- 1285,	 // 0x0505
-  771,	 // 0x0303
-64765,	 // 0xfcfd
-64250,	 // 0xfafa
-65277,	 // 0xfefd
- 2048,	 // 0x0800
- 1542,	 // 0x0606
- 1028,	 // 0x0404
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-  513,	 // 0x0201
-65279,	 // 0xfeff
-65533,	 // 0xfffd
-  255,	 // 0x00ff
-23316,	 // 0x5b14
-60681,	 // 0xed09
- 1502,	 // 0x05de
- 4612,	 // 0x1204
- 1810,	 // 0x0712
- 1019,	 // 0x03fb
- 1286,	 // 0x0506
-  515,	 // 0x0203
-64248,	 // 0xfaf8
-63479,	 // 0xf7f7
-64505,	 // 0xfbf9
- 2813,	 // 0x0afd
- 2311,	 // 0x0907
- 1286,	 // 0x0506
-    0,	 // 0x0000
- 1023,	 // 0x03ff
-  257,	 // 0x0101
-65278,	 // 0xfefe
-65277,	 // 0xfefd
-65278,	 // 0xfefe
-12820,	 // 0x3214
-55551,	 // 0xd8ff
- 6117,	 // 0x17e5
- 5903,	 // 0x170f
- 3610,	 // 0x0e1a
-65275,	 // 0xfefb
- 1028,	 // 0x0404
-  514,	 // 0x0202
-64762,	 // 0xfcfa
-62966,	 // 0xf5f6
-64249,	 // 0xfaf9
- 2299,	 // 0x08fb
- 2312,	 // 0x0908
- 1543,	 // 0x0607
-65280,	 // 0xff00
-  511,	 // 0x01ff
-    1,	 // 0x0001
-65021,	 // 0xfdfd
-65533,	 // 0xfffd
-64764,	 // 0xfcfc
-64754,	 // 0xfcf2
-56060,	 // 0xdafc
- 9726,	 // 0x25fe
- 4880,	 // 0x1310
- 2840,	 // 0x0b18
-64253,	 // 0xfafd
-  513,	 // 0x0201
- 1022,	 // 0x03fe
-65020,	 // 0xfdfc
-62967,	 // 0xf5f7
-64506,	 // 0xfbfa
- 1530,	 // 0x05fa
- 2054,	 // 0x0806
- 1286,	 // 0x0506
-65281,	 // 0xff01
-  510,	 // 0x01fe
-65280,	 // 0xff00
-65277,	 // 0xfefd
-65534,	 // 0xfffe
-65020,	 // 0xfdfc
-59145,	 // 0xe709
-61700,	 // 0xf104
- 4613,	 // 0x1205
- 3331,	 // 0x0d03
- 1296,	 // 0x0510
-65278,	 // 0xfefe
-65281,	 // 0xff01
- 1019,	 // 0x03fb
-65021,	 // 0xfdfd
-64250,	 // 0xfafa
-65019,	 // 0xfdfb
- 1275,	 // 0x04fb
- 1540,	 // 0x0604
-  772,	 // 0x0304
-    2,	 // 0x0002
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65278,	 // 0xfefe
-65534,	 // 0xfffe
-65277,	 // 0xfefd
-61451,	 // 0xf00b
- 5629,	 // 0x15fd
-63748,	 // 0xf904
- 2299,	 // 0x08fb
-  518,	 // 0x0206
-  256,	 // 0x0100
-65022,	 // 0xfdfe
-  252,	 // 0x00fc
-65021,	 // 0xfdfd
-65022,	 // 0xfdfe
-65020,	 // 0xfdfc
-  766,	 // 0x02fe
-  771,	 // 0x0303
-  514,	 // 0x0202
-  258,	 // 0x0102
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-62976,	 // 0xf600
- 6889,	 // 0x1ae9
-62465,	 // 0xf401
- 1278,	 // 0x04fe
-  256,	 // 0x0100
-  512,	 // 0x0200
-64508,	 // 0xfbfc
-65533,	 // 0xfffd
-65533,	 // 0xfffd
-65535,	 // 0xffff
-65276,	 // 0xfefc
-  510,	 // 0x01fe
-  258,	 // 0x0102
-  257,	 // 0x0101
-  257,	 // 0x0101
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-54501,	 // 0xd4e5
- 5071,	 // 0x13cf
-63996,	 // 0xf9fc
-65278,	 // 0xfefe
- 1020,	 // 0x03fc
-  768,	 // 0x0300
-63993,	 // 0xf9f9
-65021,	 // 0xfdfd
- 1022,	 // 0x03fe
-  512,	 // 0x0200
-  252,	 // 0x00fc
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  127,	 // 0x007f
-62980,	 // 0xf604
-64504,	 // 0xfbf8
-65284,	 // 0xff04
-  256,	 // 0x0100
-    6,	 // 0x0006
-  256,	 // 0x0100
-    2,	 // 0x0002
-  258,	 // 0x0102
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65272,	 // 0xfef8
-63746,	 // 0xf902
-  770,	 // 0x0302
-  256,	 // 0x0100
-65535,	 // 0xffff
-  512,	 // 0x0200
-  257,	 // 0x0101
-    2,	 // 0x0002
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65278,	 // 0xfefe
-64510,	 // 0xfbfe
-65286,	 // 0xff06
-  255,	 // 0x00ff
-65276,	 // 0xfefc
-  258,	 // 0x0102
-  257,	 // 0x0101
-65025,	 // 0xfe01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65024,	 // 0xfe00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4119,	 // 0x1017
- 1017,	 // 0x03f9
-64265,	 // 0xfb09
-65026,	 // 0xfe02
-65022,	 // 0xfdfe
-    4,	 // 0x0004
-  254,	 // 0x00fe
-65023,	 // 0xfdff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-54080,	 // 0xd340
- 3344,	 // 0x0d10
-64519,	 // 0xfc07
-65028,	 // 0xfe04
-65282,	 // 0xff02
-  258,	 // 0x0102
-65535,	 // 0xffff
-  253,	 // 0x00fd
-65282,	 // 0xff02
-    1,	 // 0x0001
-65280,	 // 0xff00
-65025,	 // 0xfe01
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-41998,	 // 0xa40e
- 3108,	 // 0x0c24
- 1022,	 // 0x03fe
-65531,	 // 0xfffb
- 1538,	 // 0x0602
- 1021,	 // 0x03fd
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-64770,	 // 0xfd02
-  256,	 // 0x0100
-65282,	 // 0xff02
-    1,	 // 0x0001
-65280,	 // 0xff00
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-11412,	 // 0x2c94
- 1806,	 // 0x070e
- 2554,	 // 0x09fa
- 1787,	 // 0x06fb
- 2301,	 // 0x08fd
-  249,	 // 0x00f9
-  507,	 // 0x01fb
-65283,	 // 0xff03
-65278,	 // 0xfefe
-  768,	 // 0x0300
-    0,	 // 0x0000
-  513,	 // 0x0201
-    0,	 // 0x0000
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-32721,	 // 0x7fd1
-63169,	 // 0xf6c1
- 1523,	 // 0x05f3
- 1027,	 // 0x0403
-64769,	 // 0xfd01
-64252,	 // 0xfafc
-65532,	 // 0xfffc
-65025,	 // 0xfe01
-  510,	 // 0x01fe
-  766,	 // 0x02fe
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-10272,	 // 0x2820
-62688,	 // 0xf4e0
- 1006,	 // 0x03ee
-64264,	 // 0xfb08
-63746,	 // 0xf902
-64764,	 // 0xfcfc
-  514,	 // 0x0202
-  510,	 // 0x01fe
-  258,	 // 0x0102
-  509,	 // 0x01fd
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-58644,	 // 0xe514
- 1809,	 // 0x0711
- 1786,	 // 0x06fa
-64006,	 // 0xfa06
-64509,	 // 0xfbfd
-65529,	 // 0xfff9
- 1284,	 // 0x0504
-  511,	 // 0x01ff
-65282,	 // 0xff02
-  511,	 // 0x01ff
-65282,	 // 0xff02
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-54540,	 // 0xd50c
- 4358,	 // 0x1106
- 4100,	 // 0x1004
-64515,	 // 0xfc03
-65526,	 // 0xfff6
-  759,	 // 0x02f7
- 1541,	 // 0x0605
-  252,	 // 0x00fc
-65022,	 // 0xfdfe
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-   21,	 // 0x0015
-  258,	 // 0x0102
-  757,	 // 0x02f5
-62978,	 // 0xf602
- 1795,	 // 0x0703
- 1545,	 // 0x0609
- 4359,	 // 0x1107
- 1036,	 // 0x040c
-    3,	 // 0x0003
-62972,	 // 0xf5fc
-61425,	 // 0xeff1
-  502,	 // 0x01f6
-10269,	 // 0x281d
-12082,	 // 0x2f32
- 5418,	 // 0x152a
-58622,	 // 0xe4fe
-54482,	 // 0xd4d2
-62177,	 // 0xf2e1
- 1021,	 // 0x03fd
-63228,	 // 0xf6fc
-63730,	 // 0xf8f2
-  769,	 // 0x0301
-  519,	 // 0x0207
-65027,	 // 0xfe03
- 1542,	 // 0x0606
- 1287,	 // 0x0507
- 2823,	 // 0x0b07
- 1801,	 // 0x0709
-64257,	 // 0xfb01
-62200,	 // 0xf2f8
-60909,	 // 0xeded
-  502,	 // 0x01f6
- 9752,	 // 0x2618
-11569,	 // 0x2d31
- 4644,	 // 0x1224
-59650,	 // 0xe902
-57052,	 // 0xdedc
-62443,	 // 0xf3eb
-  764,	 // 0x02fc
-63997,	 // 0xf9fd
-64247,	 // 0xfaf7
-  506,	 // 0x01fa
-65021,	 // 0xfdfd
-  257,	 // 0x0101
- 2563,	 // 0x0a03
- 1537,	 // 0x0601
- 3085,	 // 0x0c0d
- 1801,	 // 0x0709
-62722,	 // 0xf502
-58858,	 // 0xe5ea
-56535,	 // 0xdcd7
-  236,	 // 0x00ec
-14622,	 // 0x391e
-17733,	 // 0x4545
- 7222,	 // 0x1c36
-58881,	 // 0xe601
-57818,	 // 0xe1da
-62189,	 // 0xf2ed
-64758,	 // 0xfcf6
-63226,	 // 0xf6fa
-63218,	 // 0xf6f2
-60667,	 // 0xecfb
-61169,	 // 0xeef1
- 1023,	 // 0x03ff
- 3587,	 // 0x0e03
- 1793,	 // 0x0701
- 4373,	 // 0x1115
- 2573,	 // 0x0a0d
-61183,	 // 0xeeff
-51676,	 // 0xc9dc
-48825,	 // 0xbeb9
-62421,	 // 0xf3d5
-18976,	 // 0x4a20
-25699,	 // 0x6463
-11343,	 // 0x2c4f
-59142,	 // 0xe706
-58587,	 // 0xe4db
-59113,	 // 0xe6e9
-62443,	 // 0xf3eb
-61686,	 // 0xf0f6
-60136,	 // 0xeae8
-61433,	 // 0xeff9
-62445,	 // 0xf3ed
-  766,	 // 0x02fe
- 3587,	 // 0x0e03
- 2311,	 // 0x0907
- 5395,	 // 0x1513
- 3092,	 // 0x0c14
-59132,	 // 0xe6fc
-45517,	 // 0xb1cd
-39317,	 // 0x9995
-56501,	 // 0xdcb5
-21014,	 // 0x5216
-32629,	 // 0x7f75
-15718,	 // 0x3d66
-61710,	 // 0xf10e
-58595,	 // 0xe4e3
-53981,	 // 0xd2dd
-63963,	 // 0xf9db
-63750,	 // 0xf906
-54231,	 // 0xd3d7
-58629,	 // 0xe505
-63465,	 // 0xf7e9
-64247,	 // 0xfaf7
- 3333,	 // 0x0d05
- 2058,	 // 0x080a
- 4106,	 // 0x100a
- 3093,	 // 0x0c15
-60414,	 // 0xebfe
-42697,	 // 0xa6c9
-35212,	 // 0x898c
-50335,	 // 0xc49f
-17155,	 // 0x4303
-31342,	 // 0x7a6e
-15718,	 // 0x3d66
-64273,	 // 0xfb11
-59890,	 // 0xe9f2
-51159,	 // 0xc7d7
-65493,	 // 0xffd5
- 1302,	 // 0x0516
-52436,	 // 0xccd4
-  774,	 // 0x0306
-64000,	 // 0xfa00
-  248,	 // 0x00f8
- 3333,	 // 0x0d05
- 2311,	 // 0x0907
- 2307,	 // 0x0903
- 3092,	 // 0x0c14
-62465,	 // 0xf401
-45524,	 // 0xb1d4
-39075,	 // 0x98a3
-47778,	 // 0xbaa2
- 9967,	 // 0x26ef
-24143,	 // 0x5e4f
-12623,	 // 0x314f
-  272,	 // 0x0110
-63228,	 // 0xf6fc
-54756,	 // 0xd5e4
-65248,	 // 0xfee0
- 1298,	 // 0x0512
-56033,	 // 0xdae1
- 2816,	 // 0x0b00
-64006,	 // 0xfa06
- 1276,	 // 0x04fc
- 2054,	 // 0x0806
- 1282,	 // 0x0502
- 2820,	 // 0x0b04
- 1806,	 // 0x070e
-63230,	 // 0xf6fe
-52452,	 // 0xcce4
-46016,	 // 0xb3c0
-52153,	 // 0xcbb9
- 5105,	 // 0x13f1
-15154,	 // 0x3b32
- 8497,	 // 0x2131
-  782,	 // 0x030e
-65023,	 // 0xfdff
-59634,	 // 0xe8f2
-65261,	 // 0xfeed
-    7,	 // 0x0007
-61166,	 // 0xeeee
-63750,	 // 0xf906
-64761,	 // 0xfcf9
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  260,	 // 0x0104
- 1291,	 // 0x050b
- 1287,	 // 0x0507
-62460,	 // 0xf3fc
-57583,	 // 0xe0ef
-52182,	 // 0xcbd6
-57555,	 // 0xe0d3
- 2807,	 // 0x0af7
- 8221,	 // 0x201d
- 5147,	 // 0x141b
- 1550,	 // 0x060e
-64769,	 // 0xfd01
-61689,	 // 0xf0f9
-65271,	 // 0xfef7
-65025,	 // 0xfe01
-63736,	 // 0xf8f8
-64510,	 // 0xfbfe
-  245,	 // 0x00f5
-64762,	 // 0xfcfa
-  764,	 // 0x02fc
-64772,	 // 0xfd04
-65287,	 // 0xff07
- 1028,	 // 0x0404
-63228,	 // 0xf6fc
-61428,	 // 0xeff4
-57831,	 // 0xe1e7
-60643,	 // 0xece3
- 1530,	 // 0x05fa
- 3853,	 // 0x0f0d
- 3087,	 // 0x0c0f
- 2062,	 // 0x080e
-64769,	 // 0xfd01
-63226,	 // 0xf6fa
-65531,	 // 0xfffb
-65027,	 // 0xfe03
-65021,	 // 0xfdfd
-59650,	 // 0xe902
- 1026,	 // 0x0402
- 2554,	 // 0x09fa
-  267,	 // 0x010b
-64508,	 // 0xfbfc
-64001,	 // 0xfa01
-65279,	 // 0xfeff
-63482,	 // 0xf7fa
-63741,	 // 0xf8fd
-61685,	 // 0xf0f5
-62191,	 // 0xf2ef
-65273,	 // 0xfef9
- 1540,	 // 0x0604
- 1802,	 // 0x070a
- 2832,	 // 0x0b10
-64771,	 // 0xfd03
-63485,	 // 0xf7fd
-65533,	 // 0xfffd
-65284,	 // 0xff04
-    2,	 // 0x0002
-  234,	 // 0x00ea
-63743,	 // 0xf8ff
- 1021,	 // 0x03fd
-65024,	 // 0xfe00
-65022,	 // 0xfdfe
-65280,	 // 0xff00
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1026,	 // 0x0402
-    0,	 // 0x0000
-  258,	 // 0x0102
-65026,	 // 0xfe02
-    0,	 // 0x0000
-65280,	 // 0xff00
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65282,	 // 0xff02
-65030,	 // 0xfe06
-  259,	 // 0x0103
-  513,	 // 0x0201
-  256,	 // 0x0100
-65281,	 // 0xff01
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-62217,	 // 0xf309
-  514,	 // 0x0202
-65025,	 // 0xfe01
-  512,	 // 0x0200
-  257,	 // 0x0101
-65281,	 // 0xff01
-    1,	 // 0x0001
-65279,	 // 0xfeff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 8951,	 // 0x22f7
- 1010,	 // 0x03f2
-64516,	 // 0xfc04
-65278,	 // 0xfefe
-  514,	 // 0x0202
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-21215,	 // 0x52df
-63220,	 // 0xf6f4
-    1,	 // 0x0001
-64773,	 // 0xfd05
-  255,	 // 0x00ff
-  259,	 // 0x0103
-64766,	 // 0xfcfe
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-41238,	 // 0xa116
-61225,	 // 0xef29
- 1774,	 // 0x06ee
- 1289,	 // 0x0509
-    0,	 // 0x0000
- 1278,	 // 0x04fe
-64001,	 // 0xfa01
-  512,	 // 0x0200
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-33063,	 // 0x8127
- 1057,	 // 0x0421
- 2294,	 // 0x08f6
- 1276,	 // 0x04fc
-  256,	 // 0x0100
-  506,	 // 0x01fa
-    0,	 // 0x0000
-    1,	 // 0x0001
-    3,	 // 0x0003
-    1,	 // 0x0001
-    2,	 // 0x0002
-    2,	 // 0x0002
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-13035,	 // 0x32eb
- 4061,	 // 0x0fdd
-  525,	 // 0x020d
-65015,	 // 0xfdf7
-  253,	 // 0x00fd
-65024,	 // 0xfe00
- 1278,	 // 0x04fe
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-21994,	 // 0x55ea
- 2781,	 // 0x0add
-65032,	 // 0xfe08
-65022,	 // 0xfdfe
-65532,	 // 0xfffc
-    2,	 // 0x0002
-  767,	 // 0x02ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-60685,	 // 0xed0d
-64525,	 // 0xfc0d
-65279,	 // 0xfeff
-  258,	 // 0x0102
-65535,	 // 0xffff
-  257,	 // 0x0101
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-63740,	 // 0xf8fc
- 3071,	 // 0x0bff
-  802,	 // 0x0322
-63725,	 // 0xf8ed
-  519,	 // 0x0207
-64266,	 // 0xfb0a
-65532,	 // 0xfffc
-65283,	 // 0xff03
-65023,	 // 0xfdff
-65282,	 // 0xff02
-  767,	 // 0x02ff
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-  257,	 // 0x0101
-65025,	 // 0xfe01
-65281,	 // 0xff01
-65281,	 // 0xff01
-    0,	 // 0x0000
-60406,	 // 0xebf6
-  247,	 // 0x00f7
-  773,	 // 0x0305
-64247,	 // 0xfaf7
- 2059,	 // 0x080b
-64255,	 // 0xfaff
-  255,	 // 0x00ff
-  510,	 // 0x01fe
-65024,	 // 0xfe00
-65277,	 // 0xfefd
-  513,	 // 0x0201
-65535,	 // 0xffff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-  257,	 // 0x0101
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-59142,	 // 0xe706
- 2046,	 // 0x07fe
-62718,	 // 0xf4fe
- 1269,	 // 0x04f5
- 1558,	 // 0x0616
-63217,	 // 0xf6f1
- 2312,	 // 0x0908
-65021,	 // 0xfdfd
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-  259,	 // 0x0103
-65280,	 // 0xff00
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65281,	 // 0xff01
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1788,	 // 0x06fc
- 1292,	 // 0x050c
-59872,	 // 0xe9e0
- 8466,	 // 0x2112
-57863,	 // 0xe207
- 2534,	 // 0x09e6
- 1564,	 // 0x061c
-64242,	 // 0xfaf2
-  263,	 // 0x0107
-  255,	 // 0x00ff
-  513,	 // 0x0201
-65280,	 // 0xff00
-65280,	 // 0xff00
-  256,	 // 0x0100
-65281,	 // 0xff01
-  256,	 // 0x0100
-  257,	 // 0x0101
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-12017,	 // 0x2ef1
-54300,	 // 0xd41c
- 5051,	 // 0x13bb
- 8793,	 // 0x2259
-47291,	 // 0xb8bb
-15634,	 // 0x3d12
-56340,	 // 0xdc14
- 4072,	 // 0x0fe8
-64273,	 // 0xfb11
-  508,	 // 0x01fc
- 1026,	 // 0x0402
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  514,	 // 0x0202
-65279,	 // 0xfeff
-  511,	 // 0x01ff
-    1,	 // 0x0001
-65535,	 // 0xffff
-  258,	 // 0x0102
-65280,	 // 0xff00
-13073,	 // 0x3311
-43007,	 // 0xa7ff
-26333,	 // 0x66dd
-48982,	 // 0xbf56
-64392,	 // 0xfb88
-15203,	 // 0x3b63
-49355,	 // 0xc0cb
-12557,	 // 0x310d
-60673,	 // 0xed01
- 1791,	 // 0x06ff
-  513,	 // 0x0201
-  256,	 // 0x0100
-65277,	 // 0xfefd
-  517,	 // 0x0205
-65275,	 // 0xfefb
- 1026,	 // 0x0402
-64769,	 // 0xfd01
-  765,	 // 0x02fd
-  257,	 // 0x0101
-65535,	 // 0xffff
-12831,	 // 0x321f
-50139,	 // 0xc3db
-25664,	 // 0x6440
-33248,	 // 0x81e0
-28131,	 // 0x6de3
-56912,	 // 0xde50
-63137,	 // 0xf6a1
- 7232,	 // 0x1c40
-61917,	 // 0xf1dd
- 3079,	 // 0x0c07
-65281,	 // 0xff01
-65530,	 // 0xfffa
-  514,	 // 0x0202
-64517,	 // 0xfc05
- 1019,	 // 0x03fb
-  260,	 // 0x0104
-64511,	 // 0xfbff
-  768,	 // 0x0300
-64769,	 // 0xfd01
-  256,	 // 0x0100
- 4877,	 // 0x130d
-10425,	 // 0x28b9
-  359,	 // 0x0167
-54938,	 // 0xd69a
-21833,	 // 0x5549
-46064,	 // 0xb3f0
-11992,	 // 0x2ed8
-58413,	 // 0xe42d
- 2265,	 // 0x08d9
- 1809,	 // 0x0711
-63991,	 // 0xf9f7
- 1535,	 // 0x05ff
-65283,	 // 0xff03
-65022,	 // 0xfdfe
-  769,	 // 0x0301
-    1,	 // 0x0001
-65279,	 // 0xfeff
-  516,	 // 0x0204
-65277,	 // 0xfefd
-  513,	 // 0x0201
-53750,	 // 0xd1f6
-18157,	 // 0x46ed
-54305,	 // 0xd421
-10456,	 // 0x28d8
-63536,	 // 0xf830
-59092,	 // 0xe6d4
- 7441,	 // 0x1d11
-59130,	 // 0xe6fa
- 3581,	 // 0x0dfd
-64261,	 // 0xfb05
-  504,	 // 0x01f8
-    3,	 // 0x0003
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-    3,	 // 0x0003
-65024,	 // 0xfe00
-  767,	 // 0x02ff
-65027,	 // 0xfe03
-  255,	 // 0x00ff
-  257,	 // 0x0101
-60922,	 // 0xedfa
- 4377,	 // 0x1119
-62972,	 // 0xf5fc
- 6152,	 // 0x1808
-59389,	 // 0xe7fd
- 1266,	 // 0x04f2
- 1808,	 // 0x0710
-63986,	 // 0xf9f2
- 1290,	 // 0x050a
-64767,	 // 0xfcff
-  768,	 // 0x0300
-65281,	 // 0xff01
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-  512,	 // 0x0200
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-60657,	 // 0xecf1
-65010,	 // 0xfdf2
-63506,	 // 0xf812
-  235,	 // 0x00eb
-65033,	 // 0xfe09
-64505,	 // 0xfbf9
-  785,	 // 0x0311
-64242,	 // 0xfaf2
-  523,	 // 0x020b
-65533,	 // 0xfffd
-  258,	 // 0x0102
-65023,	 // 0xfdff
-  513,	 // 0x0201
-  510,	 // 0x01fe
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-  226,	 // 0x00e2
- 7684,	 // 0x1e04
-53377,	 // 0xd081
-23545,	 // 0x5bf9
-15971,	 // 0x3e63
-  248,	 // 0x00f8
-54232,	 // 0xd3d8
- 2262,	 // 0x08d6
-62738,	 // 0xf512
- 1802,	 // 0x070a
-65272,	 // 0xfef8
- 1013,	 // 0x03f5
- 2042,	 // 0x07fa
-  252,	 // 0x00fc
-64500,	 // 0xfbf4
-64762,	 // 0xfcfa
-  762,	 // 0x02fa
-  510,	 // 0x01fe
-  513,	 // 0x0201
-  508,	 // 0x01fc
-  768,	 // 0x0300
- 4354,	 // 0x1102
-54430,	 // 0xd49e
-17917,	 // 0x45fd
-12622,	 // 0x314e
-63737,	 // 0xf8f9
-55502,	 // 0xd8ce
- 2284,	 // 0x08ec
-   19,	 // 0x0013
- 1035,	 // 0x040b
-64497,	 // 0xfbf1
- 1783,	 // 0x06f7
- 2047,	 // 0x07ff
-65534,	 // 0xfffe
-65014,	 // 0xfdf6
-65532,	 // 0xfffc
- 1020,	 // 0x03fc
-  511,	 // 0x01ff
-  511,	 // 0x01ff
- 1020,	 // 0x03fc
-  512,	 // 0x0200
- 1282,	 // 0x0502
-53661,	 // 0xd19d
-19211,	 // 0x4b0b
-12612,	 // 0x3144
-62713,	 // 0xf4f9
-54468,	 // 0xd4c4
- 2545,	 // 0x09f1
- 1050,	 // 0x041a
-  781,	 // 0x030d
-64751,	 // 0xfcef
- 1529,	 // 0x05f9
- 2050,	 // 0x0802
-65278,	 // 0xfefe
-65014,	 // 0xfdf6
-65532,	 // 0xfffc
- 1021,	 // 0x03fd
-  511,	 // 0x01ff
-  256,	 // 0x0100
- 1021,	 // 0x03fd
-  513,	 // 0x0201
-59137,	 // 0xe701
-57761,	 // 0xe1a1
-16145,	 // 0x3f11
-11323,	 // 0x2c3b
-62465,	 // 0xf401
-57297,	 // 0xdfd1
- 2038,	 // 0x07f6
- 1046,	 // 0x0416
-  520,	 // 0x0208
-65265,	 // 0xfef1
-  761,	 // 0x02f9
- 2050,	 // 0x0802
-65021,	 // 0xfdfd
-65016,	 // 0xfdf8
-65532,	 // 0xfffc
-  765,	 // 0x02fd
-  256,	 // 0x0100
-  256,	 // 0x0100
-  765,	 // 0x02fd
-  513,	 // 0x0201
-53773,	 // 0xd20d
-60625,	 // 0xecd1
- 5128,	 // 0x1408
- 9238,	 // 0x2416
-64014,	 // 0xfa0e
-62965,	 // 0xf5f5
-64506,	 // 0xfbfa
-  775,	 // 0x0307
-    4,	 // 0x0004
-  505,	 // 0x01f9
-  250,	 // 0x00fa
- 1279,	 // 0x04ff
-65277,	 // 0xfefd
-65275,	 // 0xfefb
-  253,	 // 0x00fd
-  254,	 // 0x00fe
-65280,	 // 0xff00
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  257,	 // 0x0101
-64524,	 // 0xfc0c
-62219,	 // 0xf30b
-59895,	 // 0xe9f7
- 3820,	 // 0x0eec
- 1042,	 // 0x0412
-   10,	 // 0x000a
-62200,	 // 0xf2f8
-  506,	 // 0x01fa
-  764,	 // 0x02fc
-  257,	 // 0x0101
-65531,	 // 0xfffb
-  508,	 // 0x01fc
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  253,	 // 0x00fd
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
- 5630,	 // 0x15fe
- 1319,	 // 0x0527
-59118,	 // 0xe6ee
-  233,	 // 0x00e9
- 2824,	 // 0x0b08
- 1292,	 // 0x050c
-61945,	 // 0xf1f9
-  758,	 // 0x02f6
- 1019,	 // 0x03fb
-    3,	 // 0x0003
-65534,	 // 0xfffe
-  253,	 // 0x00fd
-65534,	 // 0xfffe
-  256,	 // 0x0100
-65534,	 // 0xfffe
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4093,	 // 0x0ffd
- 4119,	 // 0x1017
-61422,	 // 0xefee
-64245,	 // 0xfaf5
- 2049,	 // 0x0801
-  520,	 // 0x0208
-63483,	 // 0xf7fb
-  251,	 // 0x00fb
- 1534,	 // 0x05fe
-    2,	 // 0x0002
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  256,	 // 0x0100
-65534,	 // 0xfffe
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  252,	 // 0x00fc
- 1270,	 // 0x04f6
-63481,	 // 0xf7f9
-63740,	 // 0xf8fc
-  769,	 // 0x0301
-65029,	 // 0xfe05
-  255,	 // 0x00ff
-  767,	 // 0x02ff
- 1791,	 // 0x06ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-65534,	 // 0xfffe
-65280,	 // 0xff00
-  256,	 // 0x0100
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65535,	 // 0xffff
- 1022,	 // 0x03fe
-65531,	 // 0xfffb
-62458,	 // 0xf3fa
-64505,	 // 0xfbf9
-65282,	 // 0xff02
-  772,	 // 0x0304
- 1286,	 // 0x0506
-  509,	 // 0x01fd
- 1277,	 // 0x04fd
-65535,	 // 0xffff
-  256,	 // 0x0100
-65279,	 // 0xfeff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-60658,	 // 0xecf2
- 3128,	 // 0x0c38
-59910,	 // 0xea06
-61661,	 // 0xf0dd
-  255,	 // 0x00ff
- 3844,	 // 0x0f04
- 1550,	 // 0x060e
-  246,	 // 0x00f6
-  504,	 // 0x01f8
-65279,	 // 0xfeff
-  258,	 // 0x0102
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  258,	 // 0x0102
-65280,	 // 0xff00
-  767,	 // 0x02ff
-    0,	 // 0x0000
-  257,	 // 0x0101
-65280,	 // 0xff00
-  210,	 // 0x00d2
-  507,	 // 0x01fb
- 3072,	 // 0x0c00
-61720,	 // 0xf118
- 2024,	 // 0x07e8
-63502,	 // 0xf80e
- 1526,	 // 0x05f6
-  515,	 // 0x0203
-  254,	 // 0x00fe
-64257,	 // 0xfb01
- 1279,	 // 0x04ff
-65280,	 // 0xff00
-  513,	 // 0x0201
-65280,	 // 0xff00
-65281,	 // 0xff01
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-59388,	 // 0xe7fc
- 4605,	 // 0x11fd
-60409,	 // 0xebf9
- 4359,	 // 0x1107
-63231,	 // 0xf6ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  512,	 // 0x0200
-64767,	 // 0xfcff
- 1281,	 // 0x0501
-65024,	 // 0xfe00
-  512,	 // 0x0200
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-59646,	 // 0xe8fe
- 2574,	 // 0x0a0e
-64213,	 // 0xfad5
- 2348,	 // 0x092c
-64990,	 // 0xfdde
-63505,	 // 0xf811
- 1788,	 // 0x06fc
-64517,	 // 0xfc05
-  252,	 // 0x00fc
-    4,	 // 0x0004
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-65280,	 // 0xff00
-  257,	 // 0x0101
- 8177,	 // 0x1ff1
-54285,	 // 0xd40d
-15060,	 // 0x3ad4
-54584,	 // 0xd538
- 6855,	 // 0x1ac7
-60438,	 // 0xec16
- 4861,	 // 0x12fd
-62213,	 // 0xf305
- 3838,	 // 0x0efe
-62466,	 // 0xf402
- 1538,	 // 0x0602
-64512,	 // 0xfc00
-  766,	 // 0x02fe
-65535,	 // 0xffff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-15621,	 // 0x3d05
-33261,	 // 0x81ed
-28696,	 // 0x7018
-42235,	 // 0xa4fb
-15100,	 // 0x3afc
-59129,	 // 0xe6f9
- 6154,	 // 0x180a
-61947,	 // 0xf1fb
- 4104,	 // 0x1008
-63222,	 // 0xf6f6
- 1036,	 // 0x040c
-65017,	 // 0xfdf9
-  513,	 // 0x0201
-65533,	 // 0xfffd
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-65280,	 // 0xff00
-13086,	 // 0x331e
-46271,	 // 0xb4bf
-12135,	 // 0x2f67
-52388,	 // 0xcca4
- 7508,	 // 0x1d54
-63696,	 // 0xf8d0
- 4130,	 // 0x1022
-63468,	 // 0xf7ec
-  783,	 // 0x030f
-  759,	 // 0x02f7
-64520,	 // 0xfc08
-  508,	 // 0x01fc
-65281,	 // 0xff01
-  511,	 // 0x01ff
-65282,	 // 0xff02
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  767,	 // 0x02ff
-65280,	 // 0xff00
-64273,	 // 0xfb11
-16100,	 // 0x3ee4
-46410,	 // 0xb54a
-12462,	 // 0x30ae
-54848,	 // 0xd640
- 7640,	 // 0x1dd8
-62492,	 // 0xf41c
- 1004,	 // 0x03ec
-64265,	 // 0xfb09
- 1276,	 // 0x04fc
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-    3,	 // 0x0003
-    0,	 // 0x0000
-    0,	 // 0x0000
-65025,	 // 0xfe01
-  256,	 // 0x0100
-65281,	 // 0xff01
-57335,	 // 0xdff7
-26898,	 // 0x6912
-43517,	 // 0xa9fd
-18429,	 // 0x47fd
-53496,	 // 0xd0f8
- 7687,	 // 0x1e07
-59638,	 // 0xe8f6
- 2308,	 // 0x0904
-64766,	 // 0xfcfe
-  512,	 // 0x0200
-  253,	 // 0x00fd
-  256,	 // 0x0100
-65027,	 // 0xfe03
-    2,	 // 0x0002
-65281,	 // 0xff01
-    0,	 // 0x0000
-65281,	 // 0xff01
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-63482,	 // 0xf7fa
-10233,	 // 0x27f9
-60382,	 // 0xebde
- 7453,	 // 0x1d1d
-62698,	 // 0xf4ea
-  532,	 // 0x0214
-63979,	 // 0xf9eb
-   12,	 // 0x000c
- 1275,	 // 0x04fb
-65535,	 // 0xffff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-65535,	 // 0xffff
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
- 5897,	 // 0x1709
-  757,	 // 0x02f5
- 1517,	 // 0x05ed
-65035,	 // 0xfe0b
-65527,	 // 0xfff7
-63751,	 // 0xf907
- 1017,	 // 0x03f9
-64516,	 // 0xfc04
-  769,	 // 0x0301
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-57327,	 // 0xdfef
-63504,	 // 0xf810
-65018,	 // 0xfdfa
-65016,	 // 0xfdf8
-64257,	 // 0xfb01
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65281,	 // 0xff01
-    2,	 // 0x0002
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65281,	 // 0xff01
-65535,	 // 0xffff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  251,	 // 0x00fb
-65009,	 // 0xfdf1
-  516,	 // 0x0204
-65037,	 // 0xfe0d
-  513,	 // 0x0201
-64003,	 // 0xfa03
-65281,	 // 0xff01
-64512,	 // 0xfc00
-  258,	 // 0x0102
-64769,	 // 0xfd01
-    2,	 // 0x0002
-65280,	 // 0xff00
-  257,	 // 0x0101
-65281,	 // 0xff01
-65281,	 // 0xff01
-    0,	 // 0x0000
-65281,	 // 0xff01
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-  257,	 // 0x0101
-61949,	 // 0xf1fd
-  765,	 // 0x02fd
-65034,	 // 0xfe0a
-65278,	 // 0xfefe
-64771,	 // 0xfd03
-65021,	 // 0xfdfd
-    1,	 // 0x0001
-  254,	 // 0x00fe
-65026,	 // 0xfe02
-  257,	 // 0x0101
-65280,	 // 0xff00
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-65027,	 // 0xfe03
-  243,	 // 0x00f3
-  520,	 // 0x0208
-62973,	 // 0xf5fd
-  769,	 // 0x0301
-64514,	 // 0xfc02
-  513,	 // 0x0201
-  255,	 // 0x00ff
-65282,	 // 0xff02
-    0,	 // 0x0000
-65282,	 // 0xff02
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3328,	 // 0x0d00
-63479,	 // 0xf7f7
- 1796,	 // 0x0704
-62197,	 // 0xf2f5
- 3329,	 // 0x0d01
-62472,	 // 0xf408
- 1785,	 // 0x06f9
-65286,	 // 0xff06
-  766,	 // 0x02fe
-    1,	 // 0x0001
-    2,	 // 0x0002
-  255,	 // 0x00ff
-65281,	 // 0xff01
-65280,	 // 0xff00
-    1,	 // 0x0001
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-64504,	 // 0xfbf8
- 4350,	 // 0x10fe
-58877,	 // 0xe5fd
- 5352,	 // 0x14e8
- 1059,	 // 0x0423
-60646,	 // 0xece6
- 5639,	 // 0x1607
-62727,	 // 0xf507
- 2044,	 // 0x07fc
-65282,	 // 0xff02
-  511,	 // 0x01ff
-  256,	 // 0x0100
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    2,	 // 0x0002
-65535,	 // 0xffff
-  256,	 // 0x0100
-65281,	 // 0xff01
-  255,	 // 0x00ff
-    0,	 // 0x0000
-57594,	 // 0xe0fa
- 9244,	 // 0x241c
-49618,	 // 0xc1d2
-19734,	 // 0x4d16
-51741,	 // 0xca1d
- 5063,	 // 0x13c7
- 4147,	 // 0x1033
-61165,	 // 0xeeed
- 2312,	 // 0x0908
-65027,	 // 0xfe03
-  767,	 // 0x02ff
-  259,	 // 0x0103
-65025,	 // 0xfe01
-  766,	 // 0x02fe
-65284,	 // 0xff04
-65534,	 // 0xfffe
-  770,	 // 0x0302
-65535,	 // 0xffff
-  256,	 // 0x0100
-    1,	 // 0x0001
- 4858,	 // 0x12fa
-56637,	 // 0xdd3d
-64420,	 // 0xfba4
-13167,	 // 0x336f
-44214,	 // 0xacb6
-22023,	 // 0x5607
-54815,	 // 0xd61f
- 3807,	 // 0x0edf
-65046,	 // 0xfe16
-65023,	 // 0xfdff
- 1026,	 // 0x0402
-    3,	 // 0x0003
-65534,	 // 0xfffe
-  770,	 // 0x0302
-65281,	 // 0xff01
-  511,	 // 0x01ff
-  514,	 // 0x0202
-65535,	 // 0xffff
-  257,	 // 0x0101
-65280,	 // 0xff00
-22527,	 // 0x57ff
-33545,	 // 0x8309
-29143,	 // 0x71d7
-46437,	 // 0xb565
-  641,	 // 0x0281
-15718,	 // 0x3d66
-49106,	 // 0xbfd2
-10244,	 // 0x2804
-62727,	 // 0xf507
-65274,	 // 0xfefa
- 1536,	 // 0x0600
-64516,	 // 0xfc04
-65532,	 // 0xfffc
-  519,	 // 0x0207
-65532,	 // 0xfffc
-  771,	 // 0x0303
-65026,	 // 0xfe02
-  510,	 // 0x01fe
-  259,	 // 0x0103
-65280,	 // 0xff00
-16681,	 // 0x4129
-39085,	 // 0x98ad
-32075,	 // 0x7d4b
-34015,	 // 0x84df
-23016,	 // 0x59e8
-58443,	 // 0xe44b
-60866,	 // 0xedc2
- 5407,	 // 0x151f
-64504,	 // 0xfbf8
-  501,	 // 0x01f5
- 1284,	 // 0x0504
-63738,	 // 0xf8fa
- 1024,	 // 0x0400
-64261,	 // 0xfb05
-  762,	 // 0x02fa
-  261,	 // 0x0105
-64767,	 // 0xfcff
-  769,	 // 0x0301
-65281,	 // 0xff01
-    0,	 // 0x0000
- 5395,	 // 0x1513
- 5832,	 // 0x16c8
- 3937,	 // 0x0f61
-56225,	 // 0xdba1
-13626,	 // 0x353a
-53491,	 // 0xd0f3
- 4336,	 // 0x10f0
-64015,	 // 0xfa0f
-  248,	 // 0x00f8
- 1277,	 // 0x04fd
-64768,	 // 0xfd00
-65531,	 // 0xfffb
-  513,	 // 0x0201
-64767,	 // 0xfcff
-  513,	 // 0x0201
-65281,	 // 0xff01
-65535,	 // 0xffff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-41454,	 // 0xa1ee
-27384,	 // 0x6af8
-46123,	 // 0xb42b
- 9929,	 // 0x26c9
-62261,	 // 0xf335
-62684,	 // 0xf4dc
- 2571,	 // 0x0a0b
-63482,	 // 0xf7fa
-  253,	 // 0x00fd
-  260,	 // 0x0104
-64767,	 // 0xfcff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65278,	 // 0xfefe
-65282,	 // 0xff02
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65026,	 // 0xfe02
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  228,	 // 0x00e4
-64768,	 // 0xfd00
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-38836,	 // 0x97b4
-55937,	 // 0xda81
-61413,	 // 0xefe5
- 3863,	 // 0x0f17
- 2247,	 // 0x08c7
-13341,	 // 0x341d
- 8717,	 // 0x220d
- 7741,	 // 0x1e3d
- 9242,	 // 0x241a
- 5652,	 // 0x1614
- 4126,	 // 0x101e
- 7444,	 // 0x1d14
- 5392,	 // 0x1510
- 4110,	 // 0x100e
- 2318,	 // 0x090e
- 1025,	 // 0x0401
- 2565,	 // 0x0a05
-  770,	 // 0x0302
-65281,	 // 0xff01
-64002,	 // 0xfa02
-  255,	 // 0x00ff
-65517,	 // 0xffed
- 7999,	 // 0x1f3f
-49111,	 // 0xbfd7
- 8430,	 // 0x20ee
-65069,	 // 0xfe2d
-62176,	 // 0xf2e0
- 3350,	 // 0x0d16
-65532,	 // 0xfffc
-  774,	 // 0x0306
-64768,	 // 0xfd00
-65281,	 // 0xff01
-  770,	 // 0x0302
-65027,	 // 0xfe03
-  514,	 // 0x0202
-  516,	 // 0x0204
-65281,	 // 0xff01
-  515,	 // 0x0203
-65282,	 // 0xff02
-    1,	 // 0x0001
-65280,	 // 0xff00
- 8172,	 // 0x1fec
-63297,	 // 0xf741
-56758,	 // 0xddb6
-12058,	 // 0x2f1a
-56337,	 // 0xdc11
- 4059,	 // 0x0fdb
- 1064,	 // 0x0428
-64752,	 // 0xfcf0
- 2826,	 // 0x0b0a
-64509,	 // 0xfbfd
-  512,	 // 0x0200
-  260,	 // 0x0104
-65024,	 // 0xfe00
-  769,	 // 0x0301
-  260,	 // 0x0104
-65535,	 // 0xffff
-  515,	 // 0x0203
-65024,	 // 0xfe00
-  257,	 // 0x0101
-    0,	 // 0x0000
-22510,	 // 0x57ee
-48441,	 // 0xbd39
- 2475,	 // 0x09ab
- 9290,	 // 0x244a
-47831,	 // 0xbad7
-16378,	 // 0x3ffa
-59185,	 // 0xe731
- 3043,	 // 0x0be3
- 1302,	 // 0x0516
-64756,	 // 0xfcf4
- 1032,	 // 0x0408
-64772,	 // 0xfd04
-65533,	 // 0xfffd
-  771,	 // 0x0303
-65282,	 // 0xff02
-65535,	 // 0xffff
-    4,	 // 0x0004
-65278,	 // 0xfefe
-  256,	 // 0x0100
-65025,	 // 0xfe01
-25114,	 // 0x621a
-33273,	 // 0x81f9
-15578,	 // 0x3cda
-59978,	 // 0xea4a
-54194,	 // 0xd3b2
-21293,	 // 0x532d
-52752,	 // 0xce10
- 8166,	 // 0x1fe6
-62738,	 // 0xf512
- 2033,	 // 0x07f1
-65290,	 // 0xff0a
-65023,	 // 0xfdff
-  769,	 // 0x0301
-  261,	 // 0x0105
-65280,	 // 0xff00
-  258,	 // 0x0102
-    2,	 // 0x0002
-65534,	 // 0xfffe
-    3,	 // 0x0003
-65025,	 // 0xfe01
-14109,	 // 0x371d
-38327,	 // 0x95b7
-15910,	 // 0x3e26
-49939,	 // 0xc313
- 4303,	 // 0x10cf
-10813,	 // 0x2a3d
-55015,	 // 0xd6e7
- 8188,	 // 0x1ffc
-61700,	 // 0xf104
- 2814,	 // 0x0afe
-64005,	 // 0xfa05
-65282,	 // 0xff02
-  514,	 // 0x0202
-65030,	 // 0xfe06
-65281,	 // 0xff01
-65283,	 // 0xff03
-65025,	 // 0xfe01
-    1,	 // 0x0001
-65282,	 // 0xff02
-65280,	 // 0xff00
-65287,	 // 0xff07
-62420,	 // 0xf3d4
- 2347,	 // 0x092b
-58868,	 // 0xe5f4
- 6897,	 // 0x1af1
-64541,	 // 0xfc1d
-64231,	 // 0xfae7
- 1284,	 // 0x0504
-65529,	 // 0xfff9
-  774,	 // 0x0306
-64512,	 // 0xfc00
-  256,	 // 0x0100
-  259,	 // 0x0103
-65283,	 // 0xff03
-    2,	 // 0x0002
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-65282,	 // 0xff02
-    1,	 // 0x0001
-59383,	 // 0xe7f7
-11264,	 // 0x2c00
-64518,	 // 0xfc06
-  508,	 // 0x01fc
- 1005,	 // 0x03ed
-63244,	 // 0xf70c
- 1785,	 // 0x06f9
-64508,	 // 0xfbfc
- 1280,	 // 0x0500
-64514,	 // 0xfc02
-  765,	 // 0x02fd
-  257,	 // 0x0101
-  512,	 // 0x0200
-  258,	 // 0x0102
-    1,	 // 0x0001
-  256,	 // 0x0100
-    2,	 // 0x0002
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-58877,	 // 0xe5fd
- 8698,	 // 0x21fa
-  246,	 // 0x00f6
-63745,	 // 0xf901
-65264,	 // 0xfef0
-65035,	 // 0xfe0b
-  510,	 // 0x01fe
- 1020,	 // 0x03fc
-65286,	 // 0xff06
-65024,	 // 0xfe00
-  769,	 // 0x0301
-65278,	 // 0xfefe
-  514,	 // 0x0202
-65281,	 // 0xff01
-  512,	 // 0x0200
-  257,	 // 0x0101
-  257,	 // 0x0101
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    7,	 // 0x0007
- 4089,	 // 0x0ff9
-64768,	 // 0xfd00
-63227,	 // 0xf6fb
- 1275,	 // 0x04fb
-    8,	 // 0x0008
-  510,	 // 0x01fe
-  770,	 // 0x0302
-64257,	 // 0xfb01
-  770,	 // 0x0302
-65280,	 // 0xff00
-  254,	 // 0x00fe
-    2,	 // 0x0002
-  512,	 // 0x0200
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-  772,	 // 0x0304
- 3322,	 // 0x0cfa
-65032,	 // 0xfe08
-64506,	 // 0xfbfa
- 1792,	 // 0x0700
-  770,	 // 0x0302
-  253,	 // 0x00fd
- 1028,	 // 0x0404
-64764,	 // 0xfcfc
-  770,	 // 0x0302
-65535,	 // 0xffff
-  511,	 // 0x01ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-58881,	 // 0xe601
- 8174,	 // 0x1fee
- 2073,	 // 0x0819
-62445,	 // 0xf3ed
- 4106,	 // 0x100a
-64257,	 // 0xfb01
-  504,	 // 0x01f8
-  519,	 // 0x0207
-65016,	 // 0xfdf8
-  512,	 // 0x0200
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-    1,	 // 0x0001
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  216,	 // 0x00d8
-33037,	 // 0x810d
-  230,	 // 0x00e6
-62193,	 // 0xf2f1
- 1795,	 // 0x0703
-    0,	 // 0x0000
-64252,	 // 0xfafc
-65017,	 // 0xfdf9
-  257,	 // 0x0101
-  257,	 // 0x0101
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-10774,	 // 0x2a16
- 1262,	 // 0x04ee
-64251,	 // 0xfafb
-  251,	 // 0x00fb
-64259,	 // 0xfb03
-65277,	 // 0xfefd
-65022,	 // 0xfdfe
-  514,	 // 0x0202
-  512,	 // 0x0200
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-28419,	 // 0x6f03
-62982,	 // 0xf606
- 1022,	 // 0x03fe
-65269,	 // 0xfef5
-63493,	 // 0xf805
-65532,	 // 0xfffc
-64512,	 // 0xfc00
-  516,	 // 0x0204
- 1022,	 // 0x03fe
-  509,	 // 0x01fd
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65281,	 // 0xff01
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-26573,	 // 0x67cd
-61982,	 // 0xf21e
- 2553,	 // 0x09f9
-65530,	 // 0xfffa
-64774,	 // 0xfd06
-  509,	 // 0x01fd
-65277,	 // 0xfefd
-  773,	 // 0x0305
-  252,	 // 0x00fc
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6356,	 // 0x18d4
- 1309,	 // 0x051d
-65262,	 // 0xfeee
-64512,	 // 0xfc00
- 1543,	 // 0x0607
-  253,	 // 0x00fd
-  764,	 // 0x02fc
-  260,	 // 0x0104
-65277,	 // 0xfefd
-  515,	 // 0x0203
-65024,	 // 0xfe00
-    1,	 // 0x0001
-65279,	 // 0xfeff
-65280,	 // 0xff00
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-53014,	 // 0xcf16
- 2801,	 // 0x0af1
-62708,	 // 0xf4f4
-63226,	 // 0xf6fa
- 1798,	 // 0x0706
-65281,	 // 0xff01
- 1790,	 // 0x06fe
-65027,	 // 0xfe03
-  511,	 // 0x01ff
-    3,	 // 0x0003
-    1,	 // 0x0001
-65282,	 // 0xff02
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-  257,	 // 0x0101
-58141,	 // 0xe31d
-65015,	 // 0xfdf7
-65289,	 // 0xff09
-65019,	 // 0xfdfb
-  513,	 // 0x0201
-  263,	 // 0x0107
-  768,	 // 0x0300
-65024,	 // 0xfe00
-  769,	 // 0x0301
-  256,	 // 0x0100
-  513,	 // 0x0201
-65025,	 // 0xfe01
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65535,	 // 0xffff
- 1017,	 // 0x03f9
- 1806,	 // 0x070e
- 1276,	 // 0x04fc
-65021,	 // 0xfdfd
-  516,	 // 0x0204
-65282,	 // 0xff02
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  765,	 // 0x02fd
-  512,	 // 0x0200
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63489,	 // 0xf801
- 1021,	 // 0x03fd
-  260,	 // 0x0104
- 1025,	 // 0x0401
-65278,	 // 0xfefe
-65534,	 // 0xfffe
-65026,	 // 0xfe02
-    0,	 // 0x0000
-65280,	 // 0xff00
-  766,	 // 0x02fe
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61705,	 // 0xf109
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-65286,	 // 0xff06
-  255,	 // 0x00ff
-65530,	 // 0xfffa
-    2,	 // 0x0002
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2046,	 // 0x07fe
-64501,	 // 0xfbf5
- 2556,	 // 0x09fc
-63492,	 // 0xf804
-  248,	 // 0x00f8
-  506,	 // 0x01fa
-  513,	 // 0x0201
-65277,	 // 0xfefd
-65535,	 // 0xffff
-  257,	 // 0x0101
-    1,	 // 0x0001
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-   40,	 // 0x0028
-65281,	 // 0xff01
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-65279,	 // 0xfeff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-  255,	 // 0x00ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1026,	 // 0x0402
-  771,	 // 0x0303
-  258,	 // 0x0102
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1531,	 // 0x05fb
-65275,	 // 0xfefb
-  771,	 // 0x0303
-    4,	 // 0x0004
-  514,	 // 0x0202
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-55287,	 // 0xd7f7
-62961,	 // 0xf5f1
- 1020,	 // 0x03fc
-  516,	 // 0x0204
-  771,	 // 0x0303
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4101,	 // 0x1005
- 2323,	 // 0x0913
-65283,	 // 0xff03
-65019,	 // 0xfdfb
-64251,	 // 0xfafb
-65019,	 // 0xfdfb
-  254,	 // 0x00fe
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32549,	 // 0x7f25
- 6700,	 // 0x1a2c
-62212,	 // 0xf304
-62193,	 // 0xf2f1
-62450,	 // 0xf3f2
-64763,	 // 0xfcfb
-  508,	 // 0x01fc
-    1,	 // 0x0001
-65278,	 // 0xfefe
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  258,	 // 0x0102
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
- 3089,	 // 0x0c11
-64249,	 // 0xfaf9
-65527,	 // 0xfff7
-  512,	 // 0x0200
-  516,	 // 0x0204
-    4,	 // 0x0004
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-42981,	 // 0xa7e5
-60891,	 // 0xeddb
- 2298,	 // 0x08fa
- 2569,	 // 0x0a09
- 2314,	 // 0x090a
-  515,	 // 0x0203
-65281,	 // 0xff01
-  256,	 // 0x0100
-  514,	 // 0x0202
-  257,	 // 0x0101
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-53739,	 // 0xd1eb
-64498,	 // 0xfbf2
-  256,	 // 0x0100
-  515,	 // 0x0203
- 1027,	 // 0x0403
-  512,	 // 0x0200
-  258,	 // 0x0102
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4098,	 // 0x1002
- 1546,	 // 0x060a
-  259,	 // 0x0103
-65025,	 // 0xfe01
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  257,	 // 0x0101
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61231,	 // 0xef2f
-63731,	 // 0xf8f3
-  532,	 // 0x0214
-  520,	 // 0x0208
-64515,	 // 0xfc03
-  515,	 // 0x0203
-   12,	 // 0x000c
- 1292,	 // 0x050c
-    3,	 // 0x0003
-  263,	 // 0x0107
-  261,	 // 0x0105
-  263,	 // 0x0107
-  517,	 // 0x0205
-  262,	 // 0x0106
-  516,	 // 0x0204
-    5,	 // 0x0005
-65283,	 // 0xff03
-    1,	 // 0x0001
-65281,	 // 0xff01
-    1,	 // 0x0001
- 3315,	 // 0x0cf3
-64235,	 // 0xfaeb
-    2,	 // 0x0002
-63753,	 // 0xf909
-65022,	 // 0xfdfe
-65018,	 // 0xfdfa
-65285,	 // 0xff05
-    2,	 // 0x0002
-65283,	 // 0xff03
-65282,	 // 0xff02
-65283,	 // 0xff03
-    4,	 // 0x0004
-  259,	 // 0x0103
-  259,	 // 0x0103
-    2,	 // 0x0002
-    3,	 // 0x0003
-    2,	 // 0x0002
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-59392,	 // 0xe800
-63741,	 // 0xf8fd
- 1808,	 // 0x0710
-65042,	 // 0xfe12
-64512,	 // 0xfc00
-64249,	 // 0xfaf9
-65024,	 // 0xfe00
-65022,	 // 0xfdfe
-64771,	 // 0xfd03
-65024,	 // 0xfe00
-65027,	 // 0xfe03
-65283,	 // 0xff03
-    3,	 // 0x0003
-65283,	 // 0xff03
-65283,	 // 0xff03
-    4,	 // 0x0004
-    2,	 // 0x0002
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-40975,	 // 0xa00f
-62488,	 // 0xf418
- 3354,	 // 0x0d1a
- 1809,	 // 0x0711
-64001,	 // 0xfa01
-64248,	 // 0xfaf8
-  515,	 // 0x0203
-65280,	 // 0xff00
-64517,	 // 0xfc05
-65023,	 // 0xfdff
-65027,	 // 0xfe03
-65283,	 // 0xff03
-    3,	 // 0x0003
-65283,	 // 0xff03
-65284,	 // 0xff04
-65284,	 // 0xff04
-65282,	 // 0xff02
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-44554,	 // 0xae0a
-63006,	 // 0xf61e
-  537,	 // 0x0219
-    5,	 // 0x0005
-63992,	 // 0xf9f8
-65532,	 // 0xfffc
- 2313,	 // 0x0909
-    6,	 // 0x0006
-64774,	 // 0xfd06
-65281,	 // 0xff01
-65285,	 // 0xff05
-65284,	 // 0xff04
-    4,	 // 0x0004
-65282,	 // 0xff02
-65029,	 // 0xfe05
-65284,	 // 0xff04
-65282,	 // 0xff02
-65281,	 // 0xff01
-65281,	 // 0xff01
-    0,	 // 0x0000
-57564,	 // 0xe0dc
-57055,	 // 0xdedf
-63232,	 // 0xf700
-63494,	 // 0xf806
-65011,	 // 0xfdf3
-  255,	 // 0x00ff
- 1545,	 // 0x0609
-  262,	 // 0x0106
-65028,	 // 0xfe04
-    1,	 // 0x0001
-    4,	 // 0x0004
-65284,	 // 0xff04
-    4,	 // 0x0004
-65282,	 // 0xff02
-65284,	 // 0xff04
-65283,	 // 0xff03
-65281,	 // 0xff01
-65281,	 // 0xff01
-65025,	 // 0xfe01
-65281,	 // 0xff01
-38883,	 // 0x97e3
-54456,	 // 0xd4b8
-63725,	 // 0xf8ed
-65043,	 // 0xfe13
- 1278,	 // 0x04fe
-  512,	 // 0x0200
-  522,	 // 0x020a
-  772,	 // 0x0304
-65283,	 // 0xff03
-    2,	 // 0x0002
-65284,	 // 0xff04
-65027,	 // 0xfe03
-65282,	 // 0xff02
-65026,	 // 0xfe02
-65026,	 // 0xfe02
-65027,	 // 0xfe03
-65281,	 // 0xff01
-65281,	 // 0xff01
-65024,	 // 0xfe00
-65280,	 // 0xff00
-33278,	 // 0x81fe
-60652,	 // 0xecec
-64761,	 // 0xfcf9
-  527,	 // 0x020f
-  258,	 // 0x0102
- 1273,	 // 0x04f9
-  265,	 // 0x0109
-  512,	 // 0x0200
-65283,	 // 0xff03
-    2,	 // 0x0002
-65029,	 // 0xfe05
-65027,	 // 0xfe03
-65282,	 // 0xff02
-65026,	 // 0xfe02
-65025,	 // 0xfe01
-65026,	 // 0xfe02
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-65024,	 // 0xfe00
-45331,	 // 0xb113
-62725,	 // 0xf505
-  521,	 // 0x0209
-  513,	 // 0x0201
-64766,	 // 0xfcfe
- 2040,	 // 0x07f8
-  518,	 // 0x0206
-  256,	 // 0x0100
-65027,	 // 0xfe03
-    2,	 // 0x0002
-65029,	 // 0xfe05
-65283,	 // 0xff03
-  258,	 // 0x0102
-    2,	 // 0x0002
-    3,	 // 0x0003
-65282,	 // 0xff02
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-51977,	 // 0xcb09
-63230,	 // 0xf6fe
- 2060,	 // 0x080c
- 1278,	 // 0x04fe
-  767,	 // 0x02ff
- 1789,	 // 0x06fd
- 1029,	 // 0x0405
-    2,	 // 0x0002
-65026,	 // 0xfe02
-  258,	 // 0x0102
-65285,	 // 0xff05
-65283,	 // 0xff03
-  258,	 // 0x0102
-    2,	 // 0x0002
-  259,	 // 0x0103
-    3,	 // 0x0003
-  256,	 // 0x0100
-    1,	 // 0x0001
-65280,	 // 0xff00
-    1,	 // 0x0001
-10976,	 // 0x2ae0
-59846,	 // 0xe9c6
-64758,	 // 0xfcf6
- 2569,	 // 0x0a09
- 1539,	 // 0x0603
- 1791,	 // 0x06ff
-  264,	 // 0x0108
-  772,	 // 0x0304
-65026,	 // 0xfe02
-  516,	 // 0x0204
-    4,	 // 0x0004
-65029,	 // 0xfe05
-  514,	 // 0x0202
-    3,	 // 0x0003
-  516,	 // 0x0204
-    3,	 // 0x0003
-  256,	 // 0x0100
-  257,	 // 0x0101
-65280,	 // 0xff00
-    0,	 // 0x0000
-   79,	 // 0x004f
- 2783,	 // 0x0adf
-59894,	 // 0xe9f6
-63975,	 // 0xf9e7
-    1,	 // 0x0001
- 2557,	 // 0x09fd
- 1547,	 // 0x060b
- 1020,	 // 0x03fc
-65276,	 // 0xfefc
-  511,	 // 0x01ff
-64513,	 // 0xfc01
-65025,	 // 0xfe01
-  252,	 // 0x00fc
-65534,	 // 0xfffe
-65279,	 // 0xfeff
-64768,	 // 0xfd00
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-60948,	 // 0xee14
-    6,	 // 0x0006
-62708,	 // 0xf4f4
- 1791,	 // 0x06ff
- 1026,	 // 0x0402
- 1806,	 // 0x070e
-  767,	 // 0x02ff
-65020,	 // 0xfdfc
-  254,	 // 0x00fe
-65026,	 // 0xfe02
-65534,	 // 0xfffe
-65533,	 // 0xfffd
-  254,	 // 0x00fe
-65280,	 // 0xff00
-64769,	 // 0xfd01
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65024,	 // 0xfe00
-65279,	 // 0xfeff
- 1274,	 // 0x04fa
- 5406,	 // 0x151e
-63497,	 // 0xf809
- 2294,	 // 0x08f6
-65024,	 // 0xfe00
- 1808,	 // 0x0710
-    0,	 // 0x0000
-64508,	 // 0xfbfc
-65277,	 // 0xfefd
-  260,	 // 0x0104
-65279,	 // 0xfeff
-64764,	 // 0xfcfc
-65535,	 // 0xffff
-65280,	 // 0xff00
-65024,	 // 0xfe00
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
- 8944,	 // 0x22f0
- 5410,	 // 0x1522
-61969,	 // 0xf211
-  230,	 // 0x00e6
- 2317,	 // 0x090d
- 2830,	 // 0x0b0e
-  510,	 // 0x01fe
-63738,	 // 0xf8fa
-65014,	 // 0xfdf6
-  520,	 // 0x0208
-65023,	 // 0xfdff
-65276,	 // 0xfefc
-65533,	 // 0xfffd
-65534,	 // 0xfffe
-    0,	 // 0x0000
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  522,	 // 0x020a
-62685,	 // 0xf4dd
-63739,	 // 0xf8fb
- 4611,	 // 0x1203
- 5933,	 // 0x172d
-62721,	 // 0xf501
-63985,	 // 0xf9f1
-65021,	 // 0xfdfd
- 1528,	 // 0x05f8
- 1032,	 // 0x0408
-64765,	 // 0xfcfd
-  509,	 // 0x01fd
-65278,	 // 0xfefe
-65532,	 // 0xfffc
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  254,	 // 0x00fe
-  256,	 // 0x0100
-56577,	 // 0xdd01
-54971,	 // 0xd6bb
-11512,	 // 0x2cf8
-15170,	 // 0x3b42
- 2081,	 // 0x0821
-52948,	 // 0xced4
-61916,	 // 0xf1dc
- 1560,	 // 0x0618
- 3592,	 // 0x0e08
-65276,	 // 0xfefc
-65017,	 // 0xfdf9
- 1794,	 // 0x0702
-65283,	 // 0xff03
-65018,	 // 0xfdfa
-65020,	 // 0xfdfc
-  766,	 // 0x02fe
-  513,	 // 0x0201
-  257,	 // 0x0101
-  253,	 // 0x00fd
-  257,	 // 0x0101
-63753,	 // 0xf909
-50067,	 // 0xc393
-20975,	 // 0x51ef
-19304,	 // 0x4b68
-60418,	 // 0xec02
-46514,	 // 0xb5b2
-63446,	 // 0xf7d6
- 2341,	 // 0x0925
- 2835,	 // 0x0b13
-63722,	 // 0xf8ea
- 1010,	 // 0x03f2
- 2564,	 // 0x0a04
-    4,	 // 0x0004
-64503,	 // 0xfbf7
-65017,	 // 0xfdf9
- 1533,	 // 0x05fd
-  257,	 // 0x0101
-  256,	 // 0x0100
-  252,	 // 0x00fc
-  770,	 // 0x0302
- 4122,	 // 0x101a
-46209,	 // 0xb481
-22510,	 // 0x57ee
-19293,	 // 0x4b5d
-61698,	 // 0xf102
-48310,	 // 0xbcb6
-62945,	 // 0xf5e1
- 2071,	 // 0x0817
- 1556,	 // 0x0614
-63979,	 // 0xf9eb
- 1265,	 // 0x04f1
- 2307,	 // 0x0903
-    1,	 // 0x0001
-64757,	 // 0xfcf5
-64762,	 // 0xfcfa
- 1278,	 // 0x04fe
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  764,	 // 0x02fc
-  513,	 // 0x0201
- 2832,	 // 0x0b10
-46999,	 // 0xb797
-12268,	 // 0x2fec
-13359,	 // 0x342f
-  785,	 // 0x0311
-56026,	 // 0xdada
-62191,	 // 0xf2ef
- 1026,	 // 0x0402
-  266,	 // 0x010a
-  245,	 // 0x00f5
- 1013,	 // 0x03f5
- 1021,	 // 0x03fd
- 1022,	 // 0x03fe
-65270,	 // 0xfef6
-64762,	 // 0xfcfa
-  509,	 // 0x01fd
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  508,	 // 0x01fc
-  511,	 // 0x01ff
- 8729,	 // 0x2219
-61158,	 // 0xeee6
- 1781,	 // 0x06f5
- 5638,	 // 0x1606
- 1809,	 // 0x0711
-62195,	 // 0xf2f3
-62713,	 // 0xf4f9
-64501,	 // 0xfbf5
-    3,	 // 0x0003
-  254,	 // 0x00fe
-65271,	 // 0xfef7
-  249,	 // 0x00f9
-  510,	 // 0x01fe
-65530,	 // 0xfffa
-64765,	 // 0xfcfd
-65532,	 // 0xfffc
-65534,	 // 0xfffe
-  256,	 // 0x0100
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-57811,	 // 0xe1d3
-13844,	 // 0x3614
-60927,	 // 0xedff
-60634,	 // 0xecda
-  765,	 // 0x02fd
-65287,	 // 0xff07
-  253,	 // 0x00fd
-63985,	 // 0xf9f1
-  514,	 // 0x0202
-64257,	 // 0xfb01
-65533,	 // 0xfffd
-65532,	 // 0xfffc
- 1022,	 // 0x03fe
-  507,	 // 0x01fb
-65022,	 // 0xfdfe
-65532,	 // 0xfffc
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-  224,	 // 0x00e0
- 3832,	 // 0x0ef8
- 2294,	 // 0x08f6
- 1016,	 // 0x03f8
- 1022,	 // 0x03fe
-65277,	 // 0xfefd
-  511,	 // 0x01ff
-  253,	 // 0x00fd
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  515,	 // 0x0203
- 2554,	 // 0x09fa
-  256,	 // 0x0100
- 1020,	 // 0x03fc
-65534,	 // 0xfffe
-    0,	 // 0x0000
-  510,	 // 0x01fe
-  253,	 // 0x00fd
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 8183,	 // 0x1ff7
- 3053,	 // 0x0bed
-    2,	 // 0x0002
-65533,	 // 0xfffd
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-11752,	 // 0x2de8
-  496,	 // 0x01f0
-65285,	 // 0xff05
-64257,	 // 0xfb01
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58366,	 // 0xe3fe
-59926,	 // 0xea16
-65283,	 // 0xff03
-64261,	 // 0xfb05
-    1,	 // 0x0001
-  256,	 // 0x0100
-64772,	 // 0xfd04
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65024,	 // 0xfe00
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-33065,	 // 0x8129
-58425,	 // 0xe439
-65280,	 // 0xff00
-65280,	 // 0xff00
-  259,	 // 0x0103
-  765,	 // 0x02fd
-65028,	 // 0xfe04
-65281,	 // 0xff01
-65283,	 // 0xff03
-65026,	 // 0xfe02
-65283,	 // 0xff03
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-51984,	 // 0xcb10
-64021,	 // 0xfa15
-64522,	 // 0xfc0a
-65532,	 // 0xfffc
-    2,	 // 0x0002
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65025,	 // 0xfe01
-65282,	 // 0xff02
-65025,	 // 0xfe01
-65282,	 // 0xff02
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6651,	 // 0x19fb
- 1000,	 // 0x03e8
-64010,	 // 0xfa0a
-  256,	 // 0x0100
-65281,	 // 0xff01
-    4,	 // 0x0004
-65533,	 // 0xfffd
-  257,	 // 0x0101
-  255,	 // 0x00ff
-65281,	 // 0xff01
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5885,	 // 0x16fd
- 1016,	 // 0x03f8
-64768,	 // 0xfd00
-  259,	 // 0x0103
-  256,	 // 0x0100
-  258,	 // 0x0102
-65279,	 // 0xfeff
-  512,	 // 0x0200
-  510,	 // 0x01fe
-65281,	 // 0xff01
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63996,	 // 0xf9fc
-  258,	 // 0x0102
-  253,	 // 0x00fd
-    2,	 // 0x0002
-  511,	 // 0x01ff
-  256,	 // 0x0100
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6398,	 // 0x18fe
- 2047,	 // 0x07ff
- 1019,	 // 0x03fb
-65276,	 // 0xfefc
-  508,	 // 0x01fc
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    3,	 // 0x0003
- 3833,	 // 0x0ef9
- 3339,	 // 0x0d0b
-61714,	 // 0xf112
- 3067,	 // 0x0bfb
-63758,	 // 0xf90e
- 1792,	 // 0x0700
-    0,	 // 0x0000
-64771,	 // 0xfd03
- 1022,	 // 0x03fe
-65281,	 // 0xff01
-65284,	 // 0xff04
-    0,	 // 0x0000
-    0,	 // 0x0000
-65025,	 // 0xfe01
-    2,	 // 0x0002
-    1,	 // 0x0001
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65280,	 // 0xff00
-65281,	 // 0xff01
- 1021,	 // 0x03fd
-63487,	 // 0xf7ff
-65283,	 // 0xff03
-  766,	 // 0x02fe
-  774,	 // 0x0306
-  767,	 // 0x02ff
-  253,	 // 0x00fd
-65026,	 // 0xfe02
-  511,	 // 0x01ff
-65281,	 // 0xff01
-65282,	 // 0xff02
-  255,	 // 0x00ff
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-63234,	 // 0xf702
-61950,	 // 0xf1fe
- 1533,	 // 0x05fd
-65023,	 // 0xfdff
- 1026,	 // 0x0402
-  509,	 // 0x01fd
-  767,	 // 0x02ff
-64771,	 // 0xfd03
-  257,	 // 0x0101
-    1,	 // 0x0001
-65026,	 // 0xfe02
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-  505,	 // 0x01f9
-59645,	 // 0xe8fd
- 5111,	 // 0x13f7
-62978,	 // 0xf602
- 2559,	 // 0x09ff
-64767,	 // 0xfcff
-  764,	 // 0x02fc
-64261,	 // 0xfb05
- 1022,	 // 0x03fe
-65280,	 // 0xff00
-65024,	 // 0xfe00
-65281,	 // 0xff01
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
- 1284,	 // 0x0504
-54278,	 // 0xd406
- 9446,	 // 0x24e6
-59409,	 // 0xe811
- 4601,	 // 0x11f9
-61197,	 // 0xef0d
- 1271,	 // 0x04f7
-64007,	 // 0xfa07
- 1275,	 // 0x04fb
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  254,	 // 0x00fe
-65282,	 // 0xff02
-65534,	 // 0xfffe
-    1,	 // 0x0001
-65280,	 // 0xff00
-    1,	 // 0x0001
-65535,	 // 0xffff
-    0,	 // 0x0000
-61947,	 // 0xf1fb
-64546,	 // 0xfc22
- 1988,	 // 0x07c4
-63281,	 // 0xf731
-  993,	 // 0x03e1
-61477,	 // 0xf025
-  494,	 // 0x01ee
-64776,	 // 0xfd08
-65530,	 // 0xfffa
-  258,	 // 0x0102
-65277,	 // 0xfefd
-    2,	 // 0x0002
-65533,	 // 0xfffd
-65283,	 // 0xff03
-65280,	 // 0xff00
-  257,	 // 0x0101
-65535,	 // 0xffff
-65281,	 // 0xff01
-65535,	 // 0xffff
-  255,	 // 0x00ff
-54528,	 // 0xd500
-21283,	 // 0x5323
-46275,	 // 0xb4c3
- 9783,	 // 0x2637
-55254,	 // 0xd7d6
- 1578,	 // 0x062a
-62701,	 // 0xf4ed
- 1024,	 // 0x0400
-63742,	 // 0xf8fe
- 2047,	 // 0x07ff
-65276,	 // 0xfefc
-  768,	 // 0x0300
-64766,	 // 0xfcfe
-65282,	 // 0xff02
-65024,	 // 0xfe00
-65280,	 // 0xff00
-65025,	 // 0xfe01
-64770,	 // 0xfd02
-  256,	 // 0x0100
-65535,	 // 0xffff
-61198,	 // 0xef0e
-30964,	 // 0x78f4
-33033,	 // 0x8109
-18937,	 // 0x49f9
-46089,	 // 0xb409
- 7430,	 // 0x1d06
-59905,	 // 0xea01
- 2545,	 // 0x09f1
-62729,	 // 0xf509
- 2807,	 // 0x0af7
-64767,	 // 0xfcff
-  765,	 // 0x02fd
-64257,	 // 0xfb01
-    0,	 // 0x0000
-65027,	 // 0xfe03
-65280,	 // 0xff00
-65282,	 // 0xff02
-64770,	 // 0xfd02
-  256,	 // 0x0100
-65535,	 // 0xffff
-60693,	 // 0xed15
-19406,	 // 0x4bce
-43592,	 // 0xaa48
-14786,	 // 0x39c2
-52795,	 // 0xce3b
- 7902,	 // 0x1ede
-61715,	 // 0xf113
- 2035,	 // 0x07f3
-64267,	 // 0xfb0b
- 2293,	 // 0x08f5
-64259,	 // 0xfb03
-  252,	 // 0x00fc
-64515,	 // 0xfc03
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65279,	 // 0xfeff
-65281,	 // 0xff01
-65026,	 // 0xfe02
-  256,	 // 0x0100
-65280,	 // 0xff00
- 4106,	 // 0x100a
-  975,	 // 0x03cf
-63567,	 // 0xf84f
- 4027,	 // 0x0fbb
-63549,	 // 0xf83d
- 4057,	 // 0x0fd9
-65042,	 // 0xfe12
-  250,	 // 0x00fa
-  773,	 // 0x0305
- 1019,	 // 0x03fb
-64770,	 // 0xfd02
-  511,	 // 0x01ff
-65027,	 // 0xfe03
-  254,	 // 0x00fe
-  256,	 // 0x0100
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-  511,	 // 0x01ff
-65535,	 // 0xffff
-11496,	 // 0x2ce8
-34515,	 // 0x86d3
-21837,	 // 0x554d
-59338,	 // 0xe7ca
- 5425,	 // 0x1531
- 1254,	 // 0x04e6
-  522,	 // 0x020a
-65024,	 // 0xfe00
- 2053,	 // 0x0805
-65018,	 // 0xfdfa
-65286,	 // 0xff06
-65280,	 // 0xff00
-    2,	 // 0x0002
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  242,	 // 0x00f2
- 1025,	 // 0x0401
- 1027,	 // 0x0403
-65280,	 // 0xff00
-65277,	 // 0xfefd
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3580,	 // 0x0dfc
-65533,	 // 0xfffd
-  253,	 // 0x00fd
-65535,	 // 0xffff
-  257,	 // 0x0101
-  256,	 // 0x0100
-    1,	 // 0x0001
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4616,	 // 0x1208
-65277,	 // 0xfefd
-65020,	 // 0xfdfc
-65025,	 // 0xfe01
-  514,	 // 0x0202
-  257,	 // 0x0101
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-57885,	 // 0xe21d
-63467,	 // 0xf7eb
-62709,	 // 0xf4f5
-65022,	 // 0xfdfe
- 1283,	 // 0x0503
-  772,	 // 0x0304
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    2,	 // 0x0002
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-33243,	 // 0x81db
-64486,	 // 0xfbe6
- 2303,	 // 0x08ff
- 2566,	 // 0x0a06
- 1028,	 // 0x0404
-  515,	 // 0x0203
-  767,	 // 0x02ff
-  515,	 // 0x0203
-  258,	 // 0x0102
-  257,	 // 0x0101
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-56751,	 // 0xddaf
- 1290,	 // 0x050a
- 6676,	 // 0x1a14
- 3594,	 // 0x0e0a
-65023,	 // 0xfdff
-65535,	 // 0xffff
-  765,	 // 0x02fd
-65284,	 // 0xff04
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-30750,	 // 0x781e
- 2339,	 // 0x0923
-65034,	 // 0xfe0a
-65019,	 // 0xfdfb
-64764,	 // 0xfcfc
-65278,	 // 0xfefe
-    1,	 // 0x0001
-65023,	 // 0xfdff
-65276,	 // 0xfefc
-65533,	 // 0xfffd
-  253,	 // 0x00fd
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-17716,	 // 0x4534
- 2833,	 // 0x0b11
-62463,	 // 0xf3ff
-63995,	 // 0xf9fb
-  257,	 // 0x0101
-65535,	 // 0xffff
-65281,	 // 0xff01
-65533,	 // 0xfffd
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-  256,	 // 0x0100
-    1,	 // 0x0001
-62214,	 // 0xf306
-  248,	 // 0x00f8
-64766,	 // 0xfcfe
-65025,	 // 0xfe01
-  257,	 // 0x0101
-65024,	 // 0xfe00
-65535,	 // 0xffff
-  511,	 // 0x01ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61947,	 // 0xf1fb
-64764,	 // 0xfcfc
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  514,	 // 0x0202
-64514,	 // 0xfc02
- 1023,	 // 0x03ff
-65279,	 // 0xfeff
-65277,	 // 0xfefd
-65535,	 // 0xffff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  252,	 // 0x00fc
- 1787,	 // 0x06fb
- 1030,	 // 0x0406
-64769,	 // 0xfd01
- 1541,	 // 0x0605
-65284,	 // 0xff04
-65279,	 // 0xfeff
-65024,	 // 0xfe00
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-63229,	 // 0xf6fd
-  255,	 // 0x00ff
-65286,	 // 0xff06
-  255,	 // 0x00ff
-65284,	 // 0xff04
-65535,	 // 0xffff
-65280,	 // 0xff00
-65535,	 // 0xffff
-    2,	 // 0x0002
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64770,	 // 0xfd02
-64508,	 // 0xfbfc
-  522,	 // 0x020a
-63740,	 // 0xf8fc
-  258,	 // 0x0102
-    0,	 // 0x0000
-65281,	 // 0xff01
-65535,	 // 0xffff
-    2,	 // 0x0002
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-64513,	 // 0xfc01
-64768,	 // 0xfd00
- 2315,	 // 0x090b
-62206,	 // 0xf2fe
-  762,	 // 0x02fa
-  773,	 // 0x0305
-64767,	 // 0xfcff
-  508,	 // 0x01fc
-  260,	 // 0x0104
-65280,	 // 0xff00
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63490,	 // 0xf802
- 2297,	 // 0x08f9
- 3342,	 // 0x0d0e
-61947,	 // 0xf1fb
- 2040,	 // 0x07f8
-  269,	 // 0x010d
-63990,	 // 0xf9f6
- 1023,	 // 0x03ff
-  774,	 // 0x0306
-65019,	 // 0xfdfb
-  257,	 // 0x0101
-65280,	 // 0xff00
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-64768,	 // 0xfd00
- 6132,	 // 0x17f4
-64528,	 // 0xfc10
-63468,	 // 0xf7ec
- 5645,	 // 0x160d
-61191,	 // 0xef07
-  747,	 // 0x02eb
- 1040,	 // 0x0410
-  256,	 // 0x0100
-  506,	 // 0x01fa
-    2,	 // 0x0002
-  511,	 // 0x01ff
-    2,	 // 0x0002
-65535,	 // 0xffff
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-59896,	 // 0xe9f8
- 7700,	 // 0x1e14
-54766,	 // 0xd5ee
- 6892,	 // 0x1aec
- 4652,	 // 0x122c
-58080,	 // 0xe2e0
- 7165,	 // 0x1bfd
-63513,	 // 0xf819
-  249,	 // 0x00f9
- 1278,	 // 0x04fe
-    1,	 // 0x0001
-  511,	 // 0x01ff
-65283,	 // 0xff03
-65534,	 // 0xfffe
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-64751,	 // 0xfcef
-  834,	 // 0x0342
-50866,	 // 0xc6b2
-16157,	 // 0x3f1d
-56600,	 // 0xdd18
- 1226,	 // 0x04ca
- 6690,	 // 0x1a22
-61187,	 // 0xef03
- 1022,	 // 0x03fe
-  259,	 // 0x0103
- 1022,	 // 0x03fe
-  515,	 // 0x0203
-65024,	 // 0xfe00
-  510,	 // 0x01fe
-  259,	 // 0x0103
-65535,	 // 0xffff
-  512,	 // 0x0200
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-19716,	 // 0x4d04
-46907,	 // 0xb73b
-  424,	 // 0x01a8
- 7757,	 // 0x1e4d
-50140,	 // 0xc3dc
-10997,	 // 0x2af5
-64801,	 // 0xfd21
-64752,	 // 0xfcf0
-65284,	 // 0xff04
-65280,	 // 0xff00
- 1280,	 // 0x0500
-64515,	 // 0xfc03
-  252,	 // 0x00fc
-  770,	 // 0x0302
-65281,	 // 0xff01
-    0,	 // 0x0000
-  257,	 // 0x0101
-65535,	 // 0xffff
-  257,	 // 0x0101
-    0,	 // 0x0000
-24102,	 // 0x5e26
-43496,	 // 0xa9e8
-16892,	 // 0x41fc
-56366,	 // 0xdc2e
-59850,	 // 0xe9ca
- 9254,	 // 0x2426
-61192,	 // 0xef08
-  241,	 // 0x00f1
-  768,	 // 0x0300
-  258,	 // 0x0102
-  252,	 // 0x00fc
-64769,	 // 0xfd01
-  253,	 // 0x00fd
-  515,	 // 0x0203
-65280,	 // 0xff00
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-47095,	 // 0xb7f7
- 6796,	 // 0x1a8c
-14463,	 // 0x387f
-50372,	 // 0xc4c4
- 5372,	 // 0x14fc
-   34,	 // 0x0022
-62452,	 // 0xf3f4
- 1275,	 // 0x04fb
-  258,	 // 0x0102
-  253,	 // 0x00fd
-  512,	 // 0x0200
-64512,	 // 0xfc00
-  510,	 // 0x01fe
-64770,	 // 0xfd02
-65534,	 // 0xfffe
-    0,	 // 0x0000
-65024,	 // 0xfe00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  233,	 // 0x00e9
-64516,	 // 0xfc04
-64770,	 // 0xfd02
-65020,	 // 0xfdfc
-65276,	 // 0xfefc
-65278,	 // 0xfefe
-    0,	 // 0x0000
-  513,	 // 0x0201
-  258,	 // 0x0102
-  257,	 // 0x0101
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3838,	 // 0x0efe
-65281,	 // 0xff01
-64766,	 // 0xfcfe
-64763,	 // 0xfcfb
-65276,	 // 0xfefc
-  514,	 // 0x0202
-  514,	 // 0x0202
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58879,	 // 0xe5ff
-62436,	 // 0xf3e4
-64249,	 // 0xfaf9
-  768,	 // 0x0300
- 1798,	 // 0x0706
- 1031,	 // 0x0407
-  259,	 // 0x0103
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-39905,	 // 0x9be1
-63457,	 // 0xf7e1
- 3843,	 // 0x0f03
- 4114,	 // 0x1012
- 2830,	 // 0x0b0e
-  257,	 // 0x0101
-    1,	 // 0x0001
-  513,	 // 0x0201
-  257,	 // 0x0101
-  257,	 // 0x0101
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
- 3812,	 // 0x0ee4
- 6435,	 // 0x1923
- 4630,	 // 0x1216
- 1547,	 // 0x060b
-64510,	 // 0xfbfe
-64759,	 // 0xfcf7
-  253,	 // 0x00fd
-65026,	 // 0xfe02
-65278,	 // 0xfefe
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-32563,	 // 0x7f33
- 4908,	 // 0x132c
-62467,	 // 0xf403
-61937,	 // 0xf1f1
-63218,	 // 0xf6f2
-65277,	 // 0xfefd
-  254,	 // 0x00fe
-65023,	 // 0xfdff
-65533,	 // 0xfffd
-65535,	 // 0xffff
-  254,	 // 0x00fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-  257,	 // 0x0101
-  533,	 // 0x0215
-63732,	 // 0xf8f4
-64759,	 // 0xfcf7
-65533,	 // 0xfffd
-  514,	 // 0x0202
-  260,	 // 0x0104
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-59639,	 // 0xe8f7
-64244,	 // 0xfaf4
-  508,	 // 0x01fc
-  256,	 // 0x0100
-    1,	 // 0x0001
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65277,	 // 0xfefd
-    1,	 // 0x0001
-65535,	 // 0xffff
-  254,	 // 0x00fe
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1794,	 // 0x0702
-  259,	 // 0x0103
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65022,	 // 0xfdfe
-  253,	 // 0x00fd
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
- 3556,	 // 0x0de4
-57394,	 // 0xe032
- 9416,	 // 0x24c8
-65335,	 // 0xff37
- 5859,	 // 0x16e3
-62995,	 // 0xf613
-  238,	 // 0x00ee
-64256,	 // 0xfb00
-    2,	 // 0x0002
-65023,	 // 0xfdff
-65282,	 // 0xff02
-  255,	 // 0x00ff
-    1,	 // 0x0001
-65024,	 // 0xfe00
-64769,	 // 0xfd01
-  511,	 // 0x01ff
-65024,	 // 0xfe00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-58887,	 // 0xe607
-14092,	 // 0x370c
-56527,	 // 0xdccf
- 4908,	 // 0x132c
- 3041,	 // 0x0be1
-65045,	 // 0xfe15
-  243,	 // 0x00f3
-64769,	 // 0xfd01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65025,	 // 0xfe01
-65025,	 // 0xfe01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65026,	 // 0xfe02
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-54303,	 // 0xd41f
-26858,	 // 0x68ea
-43012,	 // 0xa804
-13581,	 // 0x350d
-59888,	 // 0xe9f0
- 3345,	 // 0x0d11
-63481,	 // 0xf7f9
- 1024,	 // 0x0400
-  255,	 // 0x00ff
-  766,	 // 0x02fe
-65280,	 // 0xff00
-65025,	 // 0xfe01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65282,	 // 0xff02
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-50454,	 // 0xc516
-22239,	 // 0x56df
-45134,	 // 0xb04e
-12989,	 // 0x32bd
-56107,	 // 0xdb2b
- 6889,	 // 0x1ae9
-62986,	 // 0xf60a
- 1019,	 // 0x03fb
- 1022,	 // 0x03fe
-  252,	 // 0x00fc
-    1,	 // 0x0001
-65280,	 // 0xff00
-    3,	 // 0x0003
-  256,	 // 0x0100
-  258,	 // 0x0102
-    0,	 // 0x0000
-65282,	 // 0xff02
-65282,	 // 0xff02
-    1,	 // 0x0001
-65280,	 // 0xff00
-11270,	 // 0x2c06
-56496,	 // 0xdcb0
- 2918,	 // 0x0b66
-61848,	 // 0xf198
- 1616,	 // 0x0650
- 2771,	 // 0x0ad3
-63511,	 // 0xf817
- 1018,	 // 0x03fa
- 1277,	 // 0x04fd
-  511,	 // 0x01ff
-64770,	 // 0xfd02
-    0,	 // 0x0000
-65282,	 // 0xff02
-  767,	 // 0x02ff
-  512,	 // 0x0200
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-26622,	 // 0x67fe
-33234,	 // 0x81d2
-24359,	 // 0x5f27
-49617,	 // 0xc1d1
-10535,	 // 0x2927
-63472,	 // 0xf7f0
-64016,	 // 0xfa10
- 1280,	 // 0x0500
- 1279,	 // 0x04ff
-  256,	 // 0x0100
-65026,	 // 0xfe02
-65280,	 // 0xff00
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  252,	 // 0x00fc
-65025,	 // 0xfe01
-  256,	 // 0x0100
-  767,	 // 0x02ff
-65281,	 // 0xff01
-  255,	 // 0x00ff
- 5104,	 // 0x13f0
-47130,	 // 0xb81a
-17899,	 // 0x45eb
-54538,	 // 0xd50a
- 6386,	 // 0x18f2
-62474,	 // 0xf40a
-    3,	 // 0x0003
-  515,	 // 0x0203
-  510,	 // 0x01fe
-65284,	 // 0xff04
-  511,	 // 0x01ff
-65282,	 // 0xff02
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  254,	 // 0x00fe
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-  255,	 // 0x00ff
-61687,	 // 0xf0f7
- 2333,	 // 0x091d
- 2532,	 // 0x09e4
-63516,	 // 0xf81c
-  231,	 // 0x00e7
-63241,	 // 0xf709
- 1277,	 // 0x04fd
-64769,	 // 0xfd01
-  255,	 // 0x00ff
-65026,	 // 0xfe02
-  510,	 // 0x01fe
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-60160,	 // 0xeb00
- 5636,	 // 0x1604
-63469,	 // 0xf7ed
- 1304,	 // 0x0518
-64755,	 // 0xfcf3
-64002,	 // 0xfa02
- 1020,	 // 0x03fc
-65023,	 // 0xfdff
-    1,	 // 0x0001
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65283,	 // 0xff03
- 1032,	 // 0x0408
-  506,	 // 0x01fa
-  266,	 // 0x010a
- 1278,	 // 0x04fe
-65021,	 // 0xfdfd
-  256,	 // 0x0100
-65535,	 // 0xffff
-65282,	 // 0xff02
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-  245,	 // 0x00f5
-62976,	 // 0xf600
- 1021,	 // 0x03fd
-62716,	 // 0xf4fc
- 2822,	 // 0x0b06
-64251,	 // 0xfafb
-  772,	 // 0x0304
-  255,	 // 0x00ff
-65027,	 // 0xfe03
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  243,	 // 0x00f3
-65512,	 // 0xffe8
- 3322,	 // 0x0cfa
-64002,	 // 0xfa02
-64251,	 // 0xfafb
-  768,	 // 0x0300
-  772,	 // 0x0304
-    1,	 // 0x0001
-65280,	 // 0xff00
-  509,	 // 0x01fd
-65281,	 // 0xff01
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61444,	 // 0xf004
- 1277,	 // 0x04fd
-65535,	 // 0xffff
-65534,	 // 0xfffe
-  515,	 // 0x0203
-  770,	 // 0x0302
-  515,	 // 0x0203
-  513,	 // 0x0201
-  767,	 // 0x02ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  771,	 // 0x0303
-64508,	 // 0xfbfc
- 1275,	 // 0x04fb
- 1030,	 // 0x0406
-  773,	 // 0x0305
-  513,	 // 0x0201
- 1028,	 // 0x0404
-  770,	 // 0x0302
-  257,	 // 0x0101
-    1,	 // 0x0001
-  257,	 // 0x0101
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-62196,	 // 0xf2f4
-62964,	 // 0xf5f4
- 2809,	 // 0x0af9
- 3086,	 // 0x0c0e
-  775,	 // 0x0307
-65534,	 // 0xfffe
- 1283,	 // 0x0503
-  256,	 // 0x0100
-65281,	 // 0xff01
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-64239,	 // 0xfaef
-64247,	 // 0xfaf7
- 3841,	 // 0x0f01
- 5135,	 // 0x140f
-  773,	 // 0x0305
-65026,	 // 0xfe02
- 1024,	 // 0x0400
-65279,	 // 0xfeff
-64766,	 // 0xfcfe
-65277,	 // 0xfefd
-65534,	 // 0xfffe
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
-63988,	 // 0xf9f4
-64738,	 // 0xfce2
- 1542,	 // 0x0606
- 6407,	 // 0x1907
- 1540,	 // 0x0604
-    6,	 // 0x0006
-  250,	 // 0x00fa
-  255,	 // 0x00ff
-65021,	 // 0xfdfd
-  253,	 // 0x00fd
-65533,	 // 0xfffd
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-51668,	 // 0xc9d4
-62188,	 // 0xf2ec
-  266,	 // 0x010a
- 7430,	 // 0x1d06
- 1799,	 // 0x0707
-    2,	 // 0x0002
-64759,	 // 0xfcf7
-    0,	 // 0x0000
-  252,	 // 0x00fc
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  510,	 // 0x01fe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  510,	 // 0x01fe
-65535,	 // 0xffff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-46562,	 // 0xb5e2
-62718,	 // 0xf4fe
-62966,	 // 0xf5f6
- 2300,	 // 0x08fc
- 2819,	 // 0x0b03
-65276,	 // 0xfefc
-65532,	 // 0xfffc
-64511,	 // 0xfbff
-  510,	 // 0x01fe
-    1,	 // 0x0001
-65282,	 // 0xff02
-  256,	 // 0x0100
-  258,	 // 0x0102
-  256,	 // 0x0100
-65280,	 // 0xff00
-  254,	 // 0x00fe
-65280,	 // 0xff00
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-16926,	 // 0x421e
- 2585,	 // 0x0a19
-59892,	 // 0xe9f4
-56041,	 // 0xdae9
-  233,	 // 0x00e9
-65269,	 // 0xfef5
- 1024,	 // 0x0400
-64767,	 // 0xfcff
-    3,	 // 0x0003
-65281,	 // 0xff01
-  259,	 // 0x0103
-    0,	 // 0x0000
-    3,	 // 0x0003
-  256,	 // 0x0100
-    2,	 // 0x0002
-  256,	 // 0x0100
-    1,	 // 0x0001
-65281,	 // 0xff01
-  255,	 // 0x00ff
-    0,	 // 0x0000
-32576,	 // 0x7f40
- 5672,	 // 0x1628
-61435,	 // 0xeffb
-50914,	 // 0xc6e2
-62175,	 // 0xf2df
-65268,	 // 0xfef4
- 1026,	 // 0x0402
-  256,	 // 0x0100
-    7,	 // 0x0007
-65534,	 // 0xfffe
-    2,	 // 0x0002
-65280,	 // 0xff00
-65026,	 // 0xfe02
-  256,	 // 0x0100
-    2,	 // 0x0002
-  258,	 // 0x0102
-  259,	 // 0x0103
-65281,	 // 0xff01
-    1,	 // 0x0001
-  257,	 // 0x0101
-25900,	 // 0x652c
- 8484,	 // 0x2124
-64272,	 // 0xfb10
-51418,	 // 0xc8da
-60644,	 // 0xece4
-  244,	 // 0x00f4
-  261,	 // 0x0105
- 1285,	 // 0x0505
-  518,	 // 0x0206
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65280,	 // 0xff00
-65026,	 // 0xfe02
-  256,	 // 0x0100
-    1,	 // 0x0001
-  257,	 // 0x0101
-    3,	 // 0x0003
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-   19,	 // 0x0013
-10729,	 // 0x29e9
-63239,	 // 0xf707
-61937,	 // 0xf1f1
-64500,	 // 0xfbf4
-62970,	 // 0xf5fa
-  509,	 // 0x01fd
-64505,	 // 0xfbf9
-  506,	 // 0x01fa
-65023,	 // 0xfdff
-  769,	 // 0x0301
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-65532,	 // 0xfffc
-65278,	 // 0xfefe
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  250,	 // 0x00fa
-64285,	 // 0xfb1d
-  240,	 // 0x00f0
-64770,	 // 0xfd02
-63481,	 // 0xf7f9
-65027,	 // 0xfe03
-65018,	 // 0xfdfa
-  509,	 // 0x01fd
-65278,	 // 0xfefe
-  514,	 // 0x0202
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65533,	 // 0xfffd
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-63009,	 // 0xf621
-   25,	 // 0x0019
- 1503,	 // 0x05df
-64009,	 // 0xfa09
-65529,	 // 0xfff9
-64516,	 // 0xfc04
-65534,	 // 0xfffe
- 1021,	 // 0x03fd
-  255,	 // 0x00ff
-  515,	 // 0x0203
-  767,	 // 0x02ff
-65534,	 // 0xfffe
-65533,	 // 0xfffd
-65534,	 // 0xfffe
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3363,	 // 0x0d23
- 3071,	 // 0x0bff
-  477,	 // 0x01dd
-62734,	 // 0xf50e
- 2553,	 // 0x09f9
-64516,	 // 0xfc04
-  770,	 // 0x0302
- 1791,	 // 0x06ff
-  768,	 // 0x0300
-  259,	 // 0x0103
-  769,	 // 0x0301
-65277,	 // 0xfefd
-65021,	 // 0xfdfd
-65277,	 // 0xfefd
-  256,	 // 0x0100
-65280,	 // 0xff00
-65535,	 // 0xffff
-  512,	 // 0x0200
-  257,	 // 0x0101
-    0,	 // 0x0000
-11743,	 // 0x2ddf
- 2278,	 // 0x08e6
-65252,	 // 0xfee4
-63760,	 // 0xf910
- 3577,	 // 0x0df9
-  257,	 // 0x0101
- 1540,	 // 0x0604
- 1283,	 // 0x0503
- 1791,	 // 0x06ff
-  259,	 // 0x0103
- 1539,	 // 0x0603
-65022,	 // 0xfdfe
-64764,	 // 0xfcfc
-65275,	 // 0xfefb
-  511,	 // 0x01ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  513,	 // 0x0201
-  257,	 // 0x0101
-  257,	 // 0x0101
- 2758,	 // 0x0ac6
-61939,	 // 0xf1f3
-  497,	 // 0x01f1
-65293,	 // 0xff0d
- 2046,	 // 0x07fe
- 2043,	 // 0x07fb
-  772,	 // 0x0304
-  514,	 // 0x0202
- 1534,	 // 0x05fe
-  261,	 // 0x0105
- 1028,	 // 0x0404
-65024,	 // 0xfe00
-64764,	 // 0xfcfc
-65019,	 // 0xfdfb
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  513,	 // 0x0201
-  257,	 // 0x0101
-  514,	 // 0x0202
-57613,	 // 0xe10d
-56615,	 // 0xdd27
-    5,	 // 0x0005
-  515,	 // 0x0203
-65021,	 // 0xfdfd
- 3067,	 // 0x0bfb
-65027,	 // 0xfe03
-  254,	 // 0x00fe
-  512,	 // 0x0200
-    5,	 // 0x0005
-  773,	 // 0x0305
-64768,	 // 0xfd00
-65021,	 // 0xfdfd
-65020,	 // 0xfdfc
-    0,	 // 0x0000
-65280,	 // 0xff00
-  256,	 // 0x0100
-  257,	 // 0x0101
-  257,	 // 0x0101
-  514,	 // 0x0202
-64309,	 // 0xfb35
-59452,	 // 0xe83c
-64779,	 // 0xfd0b
-  760,	 // 0x02f8
-63742,	 // 0xf8fe
- 2558,	 // 0x09fe
-64513,	 // 0xfc01
-  509,	 // 0x01fd
-65283,	 // 0xff03
-    4,	 // 0x0004
-  261,	 // 0x0105
-65024,	 // 0xfe00
-65278,	 // 0xfefe
-65534,	 // 0xfffe
-    1,	 // 0x0001
-    1,	 // 0x0001
-  256,	 // 0x0100
-    1,	 // 0x0001
-  257,	 // 0x0101
-  257,	 // 0x0101
- 6178,	 // 0x1822
-64028,	 // 0xfa1c
-64520,	 // 0xfc08
- 1015,	 // 0x03f7
-64000,	 // 0xfa00
- 1021,	 // 0x03fd
-65282,	 // 0xff02
-  765,	 // 0x02fd
-65283,	 // 0xff03
-    1,	 // 0x0001
-  515,	 // 0x0203
-65535,	 // 0xffff
-65535,	 // 0xffff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    1,	 // 0x0001
-  257,	 // 0x0101
-  256,	 // 0x0100
- 2055,	 // 0x0807
- 2049,	 // 0x0801
-65029,	 // 0xfe05
- 2046,	 // 0x07fe
-64770,	 // 0xfd02
-  251,	 // 0x00fb
-  515,	 // 0x0203
-  766,	 // 0x02fe
-    2,	 // 0x0002
-  256,	 // 0x0100
-  513,	 // 0x0201
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-59088,	 // 0xe6d0
- 4306,	 // 0x10d2
-64518,	 // 0xfc06
- 3575,	 // 0x0df7
- 1546,	 // 0x060a
-65273,	 // 0xfef9
- 1538,	 // 0x0602
-  249,	 // 0x00f9
-    1,	 // 0x0001
- 1022,	 // 0x03fe
- 1022,	 // 0x03fe
-  509,	 // 0x01fd
-  254,	 // 0x00fe
-  253,	 // 0x00fd
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  127,	 // 0x007f
-53484,	 // 0xd0ec
-57858,	 // 0xe202
-63248,	 // 0xf710
-59662,	 // 0xe90e
-61448,	 // 0xf008
-61689,	 // 0xf0f9
-62992,	 // 0xf610
-62988,	 // 0xf60c
-61704,	 // 0xf108
-62724,	 // 0xf504
-62988,	 // 0xf60c
-62473,	 // 0xf409
-63497,	 // 0xf809
-63239,	 // 0xf707
-63497,	 // 0xf809
-64267,	 // 0xfb0b
-64260,	 // 0xfb04
-64517,	 // 0xfc05
-64771,	 // 0xfd03
-65284,	 // 0xff04
-10230,	 // 0x27f6
- 2546,	 // 0x09f2
-  765,	 // 0x02fd
-64510,	 // 0xfbfe
-63229,	 // 0xf6fd
-65271,	 // 0xfef7
-64261,	 // 0xfb05
-64771,	 // 0xfd03
-63747,	 // 0xf903
-64766,	 // 0xfcfe
-64772,	 // 0xfd04
-64258,	 // 0xfb02
-65026,	 // 0xfe02
-64770,	 // 0xfd02
-65283,	 // 0xff03
-65029,	 // 0xfe05
-65282,	 // 0xff02
-65026,	 // 0xfe02
-65025,	 // 0xfe01
-65027,	 // 0xfe03
-64741,	 // 0xfce5
-64499,	 // 0xfbf3
-65269,	 // 0xfef5
-64761,	 // 0xfcf9
-65532,	 // 0xfffc
-65535,	 // 0xffff
-65281,	 // 0xff01
-64513,	 // 0xfc01
-64260,	 // 0xfb04
-65532,	 // 0xfffc
-64515,	 // 0xfc03
-64257,	 // 0xfb01
-    1,	 // 0x0001
-65025,	 // 0xfe01
-65028,	 // 0xfe04
-65284,	 // 0xff04
-65280,	 // 0xff00
-65026,	 // 0xfe02
-64768,	 // 0xfd00
-64771,	 // 0xfd03
-59108,	 // 0xe6e4
-62944,	 // 0xf5e0
-64759,	 // 0xfcf7
-64250,	 // 0xfafa
- 1022,	 // 0x03fe
-64515,	 // 0xfc03
-64764,	 // 0xfcfc
-63232,	 // 0xf700
-64771,	 // 0xfd03
-  764,	 // 0x02fc
-64515,	 // 0xfc03
-64258,	 // 0xfb02
-    3,	 // 0x0003
-65026,	 // 0xfe02
-64771,	 // 0xfd03
-64773,	 // 0xfd05
-65279,	 // 0xfeff
-64770,	 // 0xfd02
-65023,	 // 0xfdff
-65026,	 // 0xfe02
- 8417,	 // 0x20e1
-61422,	 // 0xefee
-62976,	 // 0xf600
-62712,	 // 0xf4f8
-65025,	 // 0xfe01
-63744,	 // 0xf900
-63995,	 // 0xf9fb
-63233,	 // 0xf701
-64767,	 // 0xfcff
-  253,	 // 0x00fd
-64258,	 // 0xfb02
-64258,	 // 0xfb02
-65284,	 // 0xff04
-65282,	 // 0xff02
-64770,	 // 0xfd02
-64772,	 // 0xfd04
-65280,	 // 0xff00
-65282,	 // 0xff02
-64513,	 // 0xfc01
-64769,	 // 0xfd01
- 4061,	 // 0x0fdd
-60437,	 // 0xec15
-63477,	 // 0xf7f5
-64001,	 // 0xfa01
-63230,	 // 0xf6fe
-64511,	 // 0xfbff
-63997,	 // 0xf9fd
-62976,	 // 0xf600
-63745,	 // 0xf901
-  255,	 // 0x00ff
-63490,	 // 0xf802
-64516,	 // 0xfc04
-64771,	 // 0xfd03
-65281,	 // 0xff01
-64771,	 // 0xfd03
-64772,	 // 0xfd04
-64769,	 // 0xfd01
-65025,	 // 0xfe01
-64511,	 // 0xfbff
-65025,	 // 0xfe01
-60145,	 // 0xeaf1
-65006,	 // 0xfdee
-62706,	 // 0xf4f2
-  779,	 // 0x030b
-64768,	 // 0xfd00
-64253,	 // 0xfafd
-64511,	 // 0xfbff
-62977,	 // 0xf601
-64000,	 // 0xfa00
-  255,	 // 0x00ff
-63746,	 // 0xf902
-64516,	 // 0xfc04
-65027,	 // 0xfe03
-65281,	 // 0xff01
-64769,	 // 0xfd01
-64515,	 // 0xfc03
-65024,	 // 0xfe00
-    2,	 // 0x0002
-65023,	 // 0xfdff
-65026,	 // 0xfe02
-56298,	 // 0xdbea
-65251,	 // 0xfee3
-62714,	 // 0xf4fa
-  268,	 // 0x010c
-    0,	 // 0x0000
-63737,	 // 0xf8f9
-64512,	 // 0xfc00
-63491,	 // 0xf803
-64259,	 // 0xfb03
-  254,	 // 0x00fe
-64001,	 // 0xfa01
-64770,	 // 0xfd02
-65026,	 // 0xfe02
-65024,	 // 0xfe00
-64769,	 // 0xfd01
-64769,	 // 0xfd01
-  255,	 // 0x00ff
-  257,	 // 0x0101
-64512,	 // 0xfc00
-65026,	 // 0xfe02
-55271,	 // 0xd7e7
-63992,	 // 0xf9f8
-  249,	 // 0x00f9
-    5,	 // 0x0005
- 1021,	 // 0x03fd
-64761,	 // 0xfcf9
-65535,	 // 0xffff
-64258,	 // 0xfb02
-64514,	 // 0xfc02
-  254,	 // 0x00fe
-64259,	 // 0xfb03
-65025,	 // 0xfe01
-65026,	 // 0xfe02
-65281,	 // 0xff01
-65025,	 // 0xfe01
-65282,	 // 0xff02
-65280,	 // 0xff00
-    2,	 // 0x0002
-65279,	 // 0xfeff
-65026,	 // 0xfe02
-58626,	 // 0xe502
-65533,	 // 0xfffd
- 1021,	 // 0x03fd
-64512,	 // 0xfc00
- 1536,	 // 0x0600
-64509,	 // 0xfbfd
-65278,	 // 0xfefe
-65023,	 // 0xfdff
-64515,	 // 0xfc03
-  254,	 // 0x00fe
-64258,	 // 0xfb02
-65024,	 // 0xfe00
-65025,	 // 0xfe01
-65025,	 // 0xfe01
-65025,	 // 0xfe01
-65283,	 // 0xff03
-    0,	 // 0x0000
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-46209,	 // 0xb481
-57064,	 // 0xdee8
-61434,	 // 0xeffa
-   14,	 // 0x000e
- 1014,	 // 0x03f6
- 2065,	 // 0x0811
- 1029,	 // 0x0405
- 1556,	 // 0x0614
- 1294,	 // 0x050e
-  777,	 // 0x0309
-65038,	 // 0xfe0e
- 1031,	 // 0x0407
-  518,	 // 0x0206
-  261,	 // 0x0105
-65287,	 // 0xff07
-    3,	 // 0x0003
-  513,	 // 0x0201
-65281,	 // 0xff01
-64514,	 // 0xfc02
-65283,	 // 0xff03
-   75,	 // 0x004b
- 7210,	 // 0x1c2a
- 4630,	 // 0x1216
-61443,	 // 0xf003
-61160,	 // 0xeee8
-64260,	 // 0xfb04
-  256,	 // 0x0100
- 1029,	 // 0x0405
-  507,	 // 0x01fb
-64771,	 // 0xfd03
-  512,	 // 0x0200
-    1,	 // 0x0001
-65024,	 // 0xfe00
-65535,	 // 0xffff
-  254,	 // 0x00fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2769,	 // 0x0ad1
- 1299,	 // 0x0513
-  773,	 // 0x0305
-64245,	 // 0xfaf5
-65533,	 // 0xfffd
-  509,	 // 0x01fd
-    0,	 // 0x0000
-  251,	 // 0x00fb
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-  510,	 // 0x01fe
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 9127,	 // 0x23a7
-62476,	 // 0xf40c
- 1283,	 // 0x0503
- 1790,	 // 0x06fe
- 1282,	 // 0x0502
-    0,	 // 0x0000
-65276,	 // 0xfefc
-  253,	 // 0x00fd
-65024,	 // 0xfe00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65265,	 // 0xfef1
-60908,	 // 0xedec
-65273,	 // 0xfef9
- 2565,	 // 0x0a05
- 3337,	 // 0x0d09
-65279,	 // 0xfeff
-65022,	 // 0xfdfe
- 1023,	 // 0x03ff
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
- 2646,	 // 0x0a56
-65503,	 // 0xffdf
-64247,	 // 0xfaf7
- 1028,	 // 0x0404
- 2567,	 // 0x0a07
-65533,	 // 0xfffd
-65280,	 // 0xff00
- 1793,	 // 0x0701
-  256,	 // 0x0100
-65027,	 // 0xfe03
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-  256,	 // 0x0100
- 9500,	 // 0x251c
- 1028,	 // 0x0404
- 1534,	 // 0x05fe
- 1035,	 // 0x040b
- 2304,	 // 0x0900
-  513,	 // 0x0201
-  255,	 // 0x00ff
- 1539,	 // 0x0603
- 1021,	 // 0x03fd
-64771,	 // 0xfd03
-  512,	 // 0x0200
-  255,	 // 0x00ff
-65535,	 // 0xffff
-65278,	 // 0xfefe
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  257,	 // 0x0101
-57044,	 // 0xded4
-61713,	 // 0xf111
- 4863,	 // 0x12ff
- 2068,	 // 0x0814
- 3072,	 // 0x0c00
- 1024,	 // 0x0400
-64513,	 // 0xfc01
-  770,	 // 0x0302
-  766,	 // 0x02fe
-64772,	 // 0xfd04
-  515,	 // 0x0203
-65535,	 // 0xffff
-65280,	 // 0xff00
-65279,	 // 0xfeff
-65280,	 // 0xff00
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-46585,	 // 0xb5f9
-59666,	 // 0xe912
- 4091,	 // 0x0ffb
-  269,	 // 0x010d
- 2305,	 // 0x0901
- 1021,	 // 0x03fd
-64260,	 // 0xfb04
-  766,	 // 0x02fe
-  258,	 // 0x0102
-64771,	 // 0xfd03
-    4,	 // 0x0004
-65535,	 // 0xffff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-55066,	 // 0xd71a
-59413,	 // 0xe815
- 2813,	 // 0x0afd
-63747,	 // 0xf903
-  512,	 // 0x0200
-  765,	 // 0x02fd
-65286,	 // 0xff06
-  764,	 // 0x02fc
-    4,	 // 0x0004
-64770,	 // 0xfd02
-    3,	 // 0x0003
-65535,	 // 0xffff
-65281,	 // 0xff01
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-63243,	 // 0xf70b
-61719,	 // 0xf117
- 2302,	 // 0x08fe
-64000,	 // 0xfa00
-65279,	 // 0xfeff
-  256,	 // 0x0100
-  517,	 // 0x0205
-  764,	 // 0x02fc
-65282,	 // 0xff02
-65026,	 // 0xfe02
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-16910,	 // 0x420e
-  791,	 // 0x0317
- 1025,	 // 0x0401
-65022,	 // 0xfdfe
-65277,	 // 0xfefd
-65025,	 // 0xfe01
- 1025,	 // 0x0401
-65527,	 // 0xfff7
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-  127,	 // 0x007f
-10223,	 // 0x27ef
- 5369,	 // 0x14f9
-65028,	 // 0xfe04
-64506,	 // 0xfbfa
- 1269,	 // 0x04f5
-64257,	 // 0xfb01
- 1533,	 // 0x05fd
-65529,	 // 0xfff9
-65534,	 // 0xfffe
-65276,	 // 0xfefc
-65280,	 // 0xff00
-  253,	 // 0x00fd
-65534,	 // 0xfffe
-  253,	 // 0x00fd
-65535,	 // 0xffff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-63992,	 // 0xf9f8
-62475,	 // 0xf40b
-65289,	 // 0xff09
-65030,	 // 0xfe06
-  257,	 // 0x0101
-  258,	 // 0x0102
-65024,	 // 0xfe00
-65281,	 // 0xff01
-  511,	 // 0x01ff
-65279,	 // 0xfeff
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-52222,	 // 0xcbfe
-54310,	 // 0xd426
-65292,	 // 0xff0c
-64774,	 // 0xfd06
-64519,	 // 0xfc07
- 1281,	 // 0x0501
-63746,	 // 0xf902
-65285,	 // 0xff05
-  767,	 // 0x02ff
-64769,	 // 0xfd01
-64770,	 // 0xfd02
-65281,	 // 0xff01
-65025,	 // 0xfe01
-    1,	 // 0x0001
-65280,	 // 0xff00
-65025,	 // 0xfe01
-65281,	 // 0xff01
-    0,	 // 0x0000
-65281,	 // 0xff01
-65280,	 // 0xff00
-33061,	 // 0x8125
-51275,	 // 0xc84b
- 1282,	 // 0x0502
-65018,	 // 0xfdfa
-64520,	 // 0xfc08
- 2299,	 // 0x08fb
-63748,	 // 0xf904
-    4,	 // 0x0004
-  256,	 // 0x0100
-64771,	 // 0xfd03
-64772,	 // 0xfd04
-    1,	 // 0x0001
-65281,	 // 0xff01
-    1,	 // 0x0001
-65281,	 // 0xff01
-65026,	 // 0xfe02
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-37670,	 // 0x9326
-57658,	 // 0xe13a
- 2823,	 // 0x0b07
-65523,	 // 0xfff3
-65031,	 // 0xfe07
- 1788,	 // 0x06fc
-64516,	 // 0xfc04
-65282,	 // 0xff02
-  259,	 // 0x0103
-65283,	 // 0xff03
-65029,	 // 0xfe05
-    0,	 // 0x0000
-65281,	 // 0xff01
-  257,	 // 0x0101
-65281,	 // 0xff01
-65282,	 // 0xff02
-    0,	 // 0x0000
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-14830,	 // 0x39ee
- 3298,	 // 0x0ce2
-65289,	 // 0xff09
-65022,	 // 0xfdfe
-65534,	 // 0xfffe
-  773,	 // 0x0305
-65534,	 // 0xfffe
-  254,	 // 0x00fe
-    1,	 // 0x0001
-65281,	 // 0xff01
-    2,	 // 0x0002
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-65281,	 // 0xff01
-    1,	 // 0x0001
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-19953,	 // 0x4df1
- 5341,	 // 0x14dd
-63738,	 // 0xf8fa
-65285,	 // 0xff05
-  761,	 // 0x02f9
-  772,	 // 0x0304
-  256,	 // 0x0100
-  764,	 // 0x02fc
-    0,	 // 0x0000
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2046,	 // 0x07fe
- 3333,	 // 0x0d05
-65529,	 // 0xfff9
-  516,	 // 0x0204
-  763,	 // 0x02fb
-  510,	 // 0x01fe
-  513,	 // 0x0201
-  508,	 // 0x01fc
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-64761,	 // 0xfcf9
-  769,	 // 0x0301
-  767,	 // 0x02ff
-  512,	 // 0x0200
-  508,	 // 0x01fc
-65277,	 // 0xfefd
-  767,	 // 0x02ff
-  254,	 // 0x00fe
-65281,	 // 0xff01
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-63744,	 // 0xf900
-65280,	 // 0xff00
-  767,	 // 0x02ff
-  510,	 // 0x01fe
-  765,	 // 0x02fd
-65278,	 // 0xfefe
-  767,	 // 0x02ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 5633,	 // 0x1601
- 2787,	 // 0x0ae3
-64762,	 // 0xfcfa
-  763,	 // 0x02fb
-  512,	 // 0x0200
-65278,	 // 0xfefe
-  767,	 // 0x02ff
-  254,	 // 0x00fe
-65280,	 // 0xff00
-  767,	 // 0x02ff
-  765,	 // 0x02fd
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  237,	 // 0x00ed
-  499,	 // 0x01f3
-63189,	 // 0xf6d5
-64248,	 // 0xfaf8
- 4098,	 // 0x1002
- 2571,	 // 0x0a0b
-65276,	 // 0xfefc
-64000,	 // 0xfa00
-  509,	 // 0x01fd
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  252,	 // 0x00fc
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65278,	 // 0xfefe
-65278,	 // 0xfefe
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6147,	 // 0x1803
-  238,	 // 0x00ee
-64769,	 // 0xfd01
- 1539,	 // 0x0603
- 1026,	 // 0x0402
-65280,	 // 0xff00
-64509,	 // 0xfbfd
-  509,	 // 0x01fd
-65533,	 // 0xfffd
-65281,	 // 0xff01
-  253,	 // 0x00fd
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61713,	 // 0xf111
- 2557,	 // 0x09fd
- 1029,	 // 0x0405
- 1027,	 // 0x0403
-65020,	 // 0xfdfc
-  767,	 // 0x02ff
-64509,	 // 0xfbfd
- 1275,	 // 0x04fb
-65277,	 // 0xfefd
-65282,	 // 0xff02
-  254,	 // 0x00fe
-  513,	 // 0x0201
-  767,	 // 0x02ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65280,	 // 0xff00
-  511,	 // 0x01ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-60912,	 // 0xedf0
- 5666,	 // 0x1622
- 3082,	 // 0x0c0a
-  513,	 // 0x0201
-64244,	 // 0xfaf4
- 1277,	 // 0x04fd
-65280,	 // 0xff00
- 1275,	 // 0x04fb
-64508,	 // 0xfbfc
-64770,	 // 0xfd02
-65535,	 // 0xffff
-  769,	 // 0x0301
-  512,	 // 0x0200
-  257,	 // 0x0101
-65280,	 // 0xff00
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 4563,	 // 0x11d3
- 6702,	 // 0x1a2e
-  260,	 // 0x0104
-  510,	 // 0x01fe
- 1265,	 // 0x04f1
-  508,	 // 0x01fc
-  770,	 // 0x0302
- 1020,	 // 0x03fc
-64251,	 // 0xfafb
-64514,	 // 0xfc02
-65278,	 // 0xfefe
- 1279,	 // 0x04ff
-  770,	 // 0x0302
-  514,	 // 0x0202
-65281,	 // 0xff01
-  256,	 // 0x0100
-  767,	 // 0x02ff
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-62206,	 // 0xf2fe
- 3073,	 // 0x0c01
-63729,	 // 0xf8f1
-  777,	 // 0x0309
- 4859,	 // 0x12fb
-65023,	 // 0xfdff
- 1285,	 // 0x0505
-  765,	 // 0x02fd
-64766,	 // 0xfcfe
-64514,	 // 0xfc02
-65024,	 // 0xfe00
- 1021,	 // 0x03fd
-  772,	 // 0x0304
-  514,	 // 0x0202
-65281,	 // 0xff01
-    0,	 // 0x0000
-  256,	 // 0x0100
-65535,	 // 0xffff
-    0,	 // 0x0000
-65535,	 // 0xffff
-57900,	 // 0xe22c
-62711,	 // 0xf4f7
-65504,	 // 0xffe0
-  787,	 // 0x0313
- 5632,	 // 0x1600
-65027,	 // 0xfe03
- 1543,	 // 0x0607
- 1276,	 // 0x04fc
-65026,	 // 0xfe02
-64002,	 // 0xfa02
-65281,	 // 0xff01
-  765,	 // 0x02fd
-  514,	 // 0x0202
-  514,	 // 0x0202
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65279,	 // 0xfeff
- 3844,	 // 0x0f04
-58912,	 // 0xe620
- 2528,	 // 0x09e0
- 1041,	 // 0x0411
- 4094,	 // 0x0ffe
-  771,	 // 0x0303
- 1544,	 // 0x0608
- 1275,	 // 0x04fb
-65282,	 // 0xff02
-64257,	 // 0xfb01
-65281,	 // 0xff01
-  765,	 // 0x02fd
-  257,	 // 0x0101
-  512,	 // 0x0200
-65281,	 // 0xff01
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
- 8432,	 // 0x20f0
-58922,	 // 0xe62a
- 1769,	 // 0x06e9
- 2056,	 // 0x0808
- 1537,	 // 0x0601
-  770,	 // 0x0302
-  773,	 // 0x0305
-  506,	 // 0x01fa
-65025,	 // 0xfe01
-64512,	 // 0xfc00
-65280,	 // 0xff00
-  766,	 // 0x02fe
-    1,	 // 0x0001
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2309,	 // 0x0905
-61472,	 // 0xf020
-65526,	 // 0xfff6
- 2049,	 // 0x0801
-  774,	 // 0x0306
-    2,	 // 0x0002
-  257,	 // 0x0101
-65530,	 // 0xfffa
-64769,	 // 0xfd01
-64769,	 // 0xfd01
-65280,	 // 0xff00
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  257,	 // 0x0101
-65281,	 // 0xff01
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
- 5650,	 // 0x1612
- 1296,	 // 0x0510
-64257,	 // 0xfb01
- 1018,	 // 0x03fa
-  776,	 // 0x0308
-64772,	 // 0xfd04
-  762,	 // 0x02fa
-65021,	 // 0xfdfd
-64769,	 // 0xfd01
-65282,	 // 0xff02
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-65282,	 // 0xff02
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-  127,	 // 0x007f
-29567,	 // 0x737f
-  247,	 // 0x00f7
-63228,	 // 0xf6fc
- 3075,	 // 0x0c03
- 1035,	 // 0x040b
-64514,	 // 0xfc02
-65018,	 // 0xfdfa
-65535,	 // 0xffff
-  769,	 // 0x0301
-65281,	 // 0xff01
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5365,	 // 0x14f5
- 1304,	 // 0x0518
- 1543,	 // 0x0607
- 1534,	 // 0x05fe
-64512,	 // 0xfc00
-65280,	 // 0xff00
-65532,	 // 0xfffc
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58604,	 // 0xe4ec
- 1052,	 // 0x041c
- 2301,	 // 0x08fd
-  509,	 // 0x01fd
-65280,	 // 0xff00
-  771,	 // 0x0303
-  254,	 // 0x00fe
-65533,	 // 0xfffd
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-53504,	 // 0xd100
-  785,	 // 0x0311
-  757,	 // 0x02f5
-64508,	 // 0xfbfc
- 1283,	 // 0x0503
-  774,	 // 0x0306
-65280,	 // 0xff00
-65533,	 // 0xfffd
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61701,	 // 0xf105
- 1533,	 // 0x05fd
-63994,	 // 0xf9fa
-63994,	 // 0xf9fa
- 1282,	 // 0x0502
-    2,	 // 0x0002
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  239,	 // 0x00ef
-65526,	 // 0xfff6
-65282,	 // 0xff02
-    0,	 // 0x0000
-  513,	 // 0x0201
-65535,	 // 0xffff
-65278,	 // 0xfefe
-65280,	 // 0xff00
-  767,	 // 0x02ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-63467,	 // 0xf7eb
-64239,	 // 0xfaef
- 1027,	 // 0x0403
-  772,	 // 0x0304
-  257,	 // 0x0101
-  256,	 // 0x0100
-65281,	 // 0xff01
-65535,	 // 0xffff
-  767,	 // 0x02ff
-65535,	 // 0xffff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-61433,	 // 0xeff9
-64000,	 // 0xfa00
-  769,	 // 0x0301
-  514,	 // 0x0202
-  513,	 // 0x0201
-  512,	 // 0x0200
-65281,	 // 0xff01
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1016,	 // 0x03f8
-65272,	 // 0xfef8
-  254,	 // 0x00fe
-  510,	 // 0x01fe
-  512,	 // 0x0200
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  504,	 // 0x01f8
-  243,	 // 0x00f3
-  509,	 // 0x01fd
-  767,	 // 0x02ff
-  257,	 // 0x0101
-  258,	 // 0x0102
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-58844,	 // 0xe5dc
-62954,	 // 0xf5ea
-65532,	 // 0xfffc
-65275,	 // 0xfefb
-    4,	 // 0x0004
-  256,	 // 0x0100
-  258,	 // 0x0102
-  257,	 // 0x0101
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   33,	 // 0x0021
-61964,	 // 0xf20c
- 3849,	 // 0x0f09
-63235,	 // 0xf703
-63744,	 // 0xf900
-64514,	 // 0xfc02
-  256,	 // 0x0100
-65278,	 // 0xfefe
-65533,	 // 0xfffd
-64512,	 // 0xfc00
-  511,	 // 0x01ff
-65024,	 // 0xfe00
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-61702,	 // 0xf106
-65528,	 // 0xfff8
-  510,	 // 0x01fe
-  256,	 // 0x0100
-64513,	 // 0xfc01
-65023,	 // 0xfdff
-  257,	 // 0x0101
-  254,	 // 0x00fe
-65282,	 // 0xff02
-  510,	 // 0x01fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2819,	 // 0x0b03
-60930,	 // 0xee02
- 1784,	 // 0x06f8
- 1282,	 // 0x0502
-65022,	 // 0xfdfe
-64511,	 // 0xfbff
-  258,	 // 0x0102
-    0,	 // 0x0000
-    1,	 // 0x0001
-  253,	 // 0x00fd
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6411,	 // 0x190b
-59648,	 // 0xe900
- 1015,	 // 0x03f7
-  770,	 // 0x0302
-65276,	 // 0xfefc
-63998,	 // 0xf9fe
-  513,	 // 0x0201
-    2,	 // 0x0002
-  258,	 // 0x0102
-65534,	 // 0xfffe
-  257,	 // 0x0101
-    0,	 // 0x0000
-  258,	 // 0x0102
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5116,	 // 0x13fc
-61684,	 // 0xf0f4
-65273,	 // 0xfef9
-65283,	 // 0xff03
-  765,	 // 0x02fd
-65022,	 // 0xfdfe
-  256,	 // 0x0100
-65535,	 // 0xffff
-  258,	 // 0x0102
-65278,	 // 0xfefe
-    0,	 // 0x0000
-    2,	 // 0x0002
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-62130,	 // 0xf2b2
-61176,	 // 0xeef8
- 1534,	 // 0x05fe
-65026,	 // 0xfe02
-  768,	 // 0x0300
-  765,	 // 0x02fd
-65020,	 // 0xfdfc
-65022,	 // 0xfdfe
-  257,	 // 0x0101
-65279,	 // 0xfeff
-65280,	 // 0xff00
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-58820,	 // 0xe5c4
-64520,	 // 0xfc08
-64515,	 // 0xfc03
-63987,	 // 0xf9f3
- 1275,	 // 0x04fb
- 1790,	 // 0x06fe
-64252,	 // 0xfafc
-65533,	 // 0xfffd
-    1,	 // 0x0001
-65025,	 // 0xfe01
-65025,	 // 0xfe01
-  255,	 // 0x00ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1025,	 // 0x0401
- 5406,	 // 0x151e
-60157,	 // 0xeafd
-63212,	 // 0xf6ec
- 2041,	 // 0x07f9
- 2561,	 // 0x0a01
-64254,	 // 0xfafe
-  507,	 // 0x01fb
-  259,	 // 0x0103
-65283,	 // 0xff03
-65025,	 // 0xfe01
-  254,	 // 0x00fe
-  257,	 // 0x0101
-    0,	 // 0x0000
-65281,	 // 0xff01
-  256,	 // 0x0100
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
- 7415,	 // 0x1cf7
- 6665,	 // 0x1a09
-60662,	 // 0xecf6
-65015,	 // 0xfdf7
- 3578,	 // 0x0dfa
- 2821,	 // 0x0b05
-64511,	 // 0xfbff
-  508,	 // 0x01fc
-  772,	 // 0x0304
-65027,	 // 0xfe03
-    2,	 // 0x0002
-  255,	 // 0x00ff
-    1,	 // 0x0001
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-64503,	 // 0xfbf7
- 3062,	 // 0x0bf6
-64247,	 // 0xfaf7
-  770,	 // 0x0302
- 3073,	 // 0x0c01
- 1797,	 // 0x0705
-64768,	 // 0xfd00
- 1279,	 // 0x04ff
- 1028,	 // 0x0404
-    0,	 // 0x0000
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
- 5247,	 // 0x147f
- 3595,	 // 0x0e0b
-64766,	 // 0xfcfe
- 3599,	 // 0x0e0f
- 4109,	 // 0x100d
-  515,	 // 0x0203
-64771,	 // 0xfd03
-  763,	 // 0x02fb
- 1026,	 // 0x0402
-  254,	 // 0x00fe
-65533,	 // 0xfffd
-65533,	 // 0xfffd
-    0,	 // 0x0000
-  512,	 // 0x0200
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-  258,	 // 0x0102
-  258,	 // 0x0102
-    0,	 // 0x0000
-   19,	 // 0x0013
- 1271,	 // 0x04f7
- 6902,	 // 0x1af6
- 1270,	 // 0x04f6
-62485,	 // 0xf415
- 8178,	 // 0x1ff2
-59920,	 // 0xea10
- 4866,	 // 0x1302
-62469,	 // 0xf405
- 3066,	 // 0x0bfa
-62726,	 // 0xf506
- 2557,	 // 0x09fd
-62465,	 // 0xf401
- 1028,	 // 0x0404
-65276,	 // 0xfefc
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-  256,	 // 0x0100
-60927,	 // 0xedff
- 3557,	 // 0x0de5
-  266,	 // 0x010a
-65513,	 // 0xffe9
- 4358,	 // 0x1106
-63997,	 // 0xf9fd
- 2310,	 // 0x0906
-64255,	 // 0xfaff
- 2812,	 // 0x0afc
-64002,	 // 0xfa02
- 2300,	 // 0x08fc
-63745,	 // 0xf901
- 1282,	 // 0x0502
-65278,	 // 0xfefe
-  768,	 // 0x0300
-65279,	 // 0xfeff
-  511,	 // 0x01ff
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  250,	 // 0x00fa
-16091,	 // 0x3edb
-58646,	 // 0xe516
- 3552,	 // 0x0de0
-62729,	 // 0xf509
- 4079,	 // 0x0fef
-63752,	 // 0xf908
- 1531,	 // 0x05fb
- 1531,	 // 0x05fb
-64514,	 // 0xfc02
- 1787,	 // 0x06fb
-64257,	 // 0xfb01
-  515,	 // 0x0203
-65534,	 // 0xfffe
-65280,	 // 0xff00
-65280,	 // 0xff00
-  256,	 // 0x0100
-65025,	 // 0xfe01
-  511,	 // 0x01ff
-65280,	 // 0xff00
-65282,	 // 0xff02
-29920,	 // 0x74e0
-49181,	 // 0xc01d
- 9950,	 // 0x26de
-56846,	 // 0xde0e
-10209,	 // 0x27e1
-58375,	 // 0xe407
- 6387,	 // 0x18f3
-63232,	 // 0xf700
- 1540,	 // 0x0604
-65020,	 // 0xfdfc
-  512,	 // 0x0200
-64514,	 // 0xfc02
-  766,	 // 0x02fe
-64510,	 // 0xfbfe
-65282,	 // 0xff02
-65533,	 // 0xfffd
-64769,	 // 0xfd01
-  255,	 // 0x00ff
-65535,	 // 0xffff
-39447,	 // 0x9a17
-32747,	 // 0x7feb
-47387,	 // 0xb91b
-16354,	 // 0x3fe2
-55338,	 // 0xd82a
-14799,	 // 0x39cf
-52751,	 // 0xce0f
-10470,	 // 0x28e6
-59663,	 // 0xe90f
- 5375,	 // 0x14ff
-63236,	 // 0xf704
- 1789,	 // 0x06fd
-63235,	 // 0xf703
-  764,	 // 0x02fc
-63487,	 // 0xf7ff
-65282,	 // 0xff02
-  250,	 // 0x00fa
-64514,	 // 0xfc02
-  511,	 // 0x01ff
-65023,	 // 0xfdff
-44555,	 // 0xae0b
-26353,	 // 0x66f1
-52007,	 // 0xcb27
-13000,	 // 0x32c8
-54325,	 // 0xd435
-13506,	 // 0x34c2
-53790,	 // 0xd21e
-12248,	 // 0x2fd8
-58141,	 // 0xe31d
- 5364,	 // 0x14f4
-62987,	 // 0xf60b
- 2294,	 // 0x08f6
-63240,	 // 0xf708
- 1273,	 // 0x04f9
-63745,	 // 0xf901
-  258,	 // 0x0102
-  762,	 // 0x02fa
-64001,	 // 0xfa01
- 1023,	 // 0x03ff
-65023,	 // 0xfdff
- 8453,	 // 0x2105
-19433,	 // 0x4be9
-56353,	 // 0xdc21
- 6080,	 // 0x17c0
-55846,	 // 0xda26
- 8399,	 // 0x20cf
-58663,	 // 0xe527
-10968,	 // 0x2ad8
-59153,	 // 0xe711
- 2296,	 // 0x08f8
-64004,	 // 0xfa04
- 1527,	 // 0x05f7
-63495,	 // 0xf807
- 1783,	 // 0x06f7
-63490,	 // 0xf802
-  258,	 // 0x0102
- 1020,	 // 0x03fc
-64512,	 // 0xfc00
- 1024,	 // 0x0400
-65023,	 // 0xfdff
- 8440,	 // 0x20f8
-14584,	 // 0x38f8
-57620,	 // 0xe114
- 4558,	 // 0x11ce
-59414,	 // 0xe816
- 3815,	 // 0x0ee7
-63517,	 // 0xf81d
- 7397,	 // 0x1ce5
-62465,	 // 0xf401
-65280,	 // 0xff00
-    0,	 // 0x0000
-  249,	 // 0x00f9
-65027,	 // 0xfe03
- 1014,	 // 0x03f6
-64513,	 // 0xfc01
-    1,	 // 0x0001
-  763,	 // 0x02fb
-65022,	 // 0xfdfe
- 1024,	 // 0x0400
-65278,	 // 0xfefe
-60159,	 // 0xeaff
-11762,	 // 0x2df2
-60416,	 // 0xec00
- 4840,	 // 0x12e8
-  277,	 // 0x0115
- 1272,	 // 0x04f8
-  524,	 // 0x020c
- 3312,	 // 0x0cf0
-65529,	 // 0xfff9
-64257,	 // 0xfb01
-  257,	 // 0x0101
-65532,	 // 0xfffc
-    1,	 // 0x0001
-  506,	 // 0x01fa
-65278,	 // 0xfefe
-  255,	 // 0x00ff
-  508,	 // 0x01fc
-65534,	 // 0xfffe
- 1023,	 // 0x03ff
-65535,	 // 0xffff
- 9223,	 // 0x2407
- 8946,	 // 0x22f2
-62714,	 // 0xf4fa
- 2296,	 // 0x08f8
- 3344,	 // 0x0d10
-65281,	 // 0xff01
- 1023,	 // 0x03ff
- 1271,	 // 0x04f7
-  504,	 // 0x01f8
-64511,	 // 0xfbff
-    2,	 // 0x0002
-65534,	 // 0xfffe
-    0,	 // 0x0000
-  510,	 // 0x01fe
-65278,	 // 0xfefe
-    1,	 // 0x0001
-  253,	 // 0x00fd
-65280,	 // 0xff00
-  256,	 // 0x0100
-  255,	 // 0x00ff
-62950,	 // 0xf5e6
-60958,	 // 0xee1e
- 5604,	 // 0x15e4
-  274,	 // 0x0112
- 3326,	 // 0x0cfe
-  521,	 // 0x0209
- 1785,	 // 0x06f9
- 1030,	 // 0x0406
- 2043,	 // 0x07fb
-65019,	 // 0xfdfb
-65288,	 // 0xff08
-  257,	 // 0x0101
-  258,	 // 0x0102
- 1022,	 // 0x03fe
-65534,	 // 0xfffe
-    2,	 // 0x0002
-65535,	 // 0xffff
-65282,	 // 0xff02
-  256,	 // 0x0100
-    1,	 // 0x0001
-   36,	 // 0x0024
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32532,	 // 0x7f14
- 7116,	 // 0x1bcc
-60139,	 // 0xeaeb
-64756,	 // 0xfcf4
-  265,	 // 0x0109
-64767,	 // 0xfcff
-65535,	 // 0xffff
-65523,	 // 0xfff3
-64762,	 // 0xfcfa
-  253,	 // 0x00fd
-  503,	 // 0x01f7
-64506,	 // 0xfbfa
-64764,	 // 0xfcfc
-65021,	 // 0xfdfd
-  253,	 // 0x00fd
-  254,	 // 0x00fe
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
- 4100,	 // 0x1004
-62220,	 // 0xf30c
- 2840,	 // 0x0b18
-62464,	 // 0xf400
-65283,	 // 0xff03
- 3588,	 // 0x0e04
-  765,	 // 0x02fd
-65299,	 // 0xff13
- 1791,	 // 0x06ff
-  259,	 // 0x0103
-65284,	 // 0xff04
-    2,	 // 0x0002
-65285,	 // 0xff05
-    6,	 // 0x0006
-  516,	 // 0x0204
-  514,	 // 0x0202
-65284,	 // 0xff04
-    1,	 // 0x0001
-    1,	 // 0x0001
-    1,	 // 0x0001
- 3319,	 // 0x0cf7
-63741,	 // 0xf8fd
-64268,	 // 0xfb0c
-  520,	 // 0x0208
-65277,	 // 0xfefd
- 2565,	 // 0x0a05
-  764,	 // 0x02fc
-65040,	 // 0xfe10
- 1794,	 // 0x0702
-  769,	 // 0x0301
-65281,	 // 0xff01
-    2,	 // 0x0002
-65284,	 // 0xff04
-    4,	 // 0x0004
-  258,	 // 0x0102
-  257,	 // 0x0101
-65283,	 // 0xff03
-    1,	 // 0x0001
-65280,	 // 0xff00
-    1,	 // 0x0001
-63230,	 // 0xf6fe
-64757,	 // 0xfcf5
-65290,	 // 0xff0a
- 1027,	 // 0x0403
-64248,	 // 0xfaf8
- 2566,	 // 0x0a06
-  505,	 // 0x01f9
-64271,	 // 0xfb0f
- 2052,	 // 0x0804
- 1535,	 // 0x05ff
-65281,	 // 0xff01
-65283,	 // 0xff03
-65027,	 // 0xfe03
-    3,	 // 0x0003
-    0,	 // 0x0000
-    1,	 // 0x0001
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3075,	 // 0x0c03
- 3299,	 // 0x0ce3
- 2819,	 // 0x0b03
- 1782,	 // 0x06f6
-62460,	 // 0xf3fc
-    9,	 // 0x0009
-  499,	 // 0x01f3
-64008,	 // 0xfa08
- 1794,	 // 0x0702
- 1532,	 // 0x05fc
-  253,	 // 0x00fd
-    2,	 // 0x0002
-65025,	 // 0xfe01
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-  767,	 // 0x02ff
-  256,	 // 0x0100
-64768,	 // 0xfd00
- 7646,	 // 0x1dde
- 7909,	 // 0x1ee5
-65267,	 // 0xfef3
-61954,	 // 0xf202
-61711,	 // 0xf10f
- 1270,	 // 0x04f6
-63743,	 // 0xf8ff
- 1279,	 // 0x04ff
- 1531,	 // 0x05fb
-  250,	 // 0x00fa
-    0,	 // 0x0000
-65535,	 // 0xffff
-    1,	 // 0x0001
-  509,	 // 0x01fd
-  511,	 // 0x01ff
-65279,	 // 0xfeff
- 1023,	 // 0x03ff
-  767,	 // 0x02ff
-  511,	 // 0x01ff
-57609,	 // 0xe109
-15352,	 // 0x3bf8
-15267,	 // 0x3ba3
-61416,	 // 0xefe8
-62468,	 // 0xf404
-57101,	 // 0xdf0d
- 1538,	 // 0x0602
-64755,	 // 0xfcf3
- 1277,	 // 0x04fd
-  761,	 // 0x02f9
- 1526,	 // 0x05f6
-  765,	 // 0x02fd
-65531,	 // 0xfffb
-  256,	 // 0x0100
- 1018,	 // 0x03fa
- 1022,	 // 0x03fe
-65533,	 // 0xfffd
- 1279,	 // 0x04ff
- 1279,	 // 0x04ff
-  767,	 // 0x02ff
-62221,	 // 0xf30d
-22276,	 // 0x5704
-17025,	 // 0x4281
-56301,	 // 0xdbed
-64268,	 // 0xfb0c
-54789,	 // 0xd605
- 2824,	 // 0x0b08
-  236,	 // 0x00ec
-  764,	 // 0x02fc
-  506,	 // 0x01fa
- 2037,	 // 0x07f5
- 1276,	 // 0x04fc
-65275,	 // 0xfefb
-  255,	 // 0x00ff
-  762,	 // 0x02fa
-  765,	 // 0x02fd
-65022,	 // 0xfdfe
- 1022,	 // 0x03fe
- 1279,	 // 0x04ff
-  767,	 // 0x02ff
-65027,	 // 0xfe03
-20721,	 // 0x50f1
-12451,	 // 0x30a3
-56569,	 // 0xdcf9
- 1555,	 // 0x0613
-56064,	 // 0xdb00
- 2818,	 // 0x0b02
-65265,	 // 0xfef1
-65527,	 // 0xfff7
-  761,	 // 0x02f9
- 2038,	 // 0x07f6
- 1019,	 // 0x03fb
-65531,	 // 0xfffb
-65280,	 // 0xff00
-  504,	 // 0x01f8
-  509,	 // 0x01fd
-65278,	 // 0xfefe
- 1277,	 // 0x04fd
- 1022,	 // 0x03fe
-  767,	 // 0x02ff
-61437,	 // 0xeffd
-13544,	 // 0x34e8
- 7120,	 // 0x1bd0
-60169,	 // 0xeb09
- 2062,	 // 0x080e
-60930,	 // 0xee02
-  760,	 // 0x02f8
-64254,	 // 0xfafe
-  759,	 // 0x02f7
-  506,	 // 0x01fa
- 1017,	 // 0x03f9
-  255,	 // 0x00ff
-65021,	 // 0xfdfd
-65024,	 // 0xfe00
-  506,	 // 0x01fa
-  252,	 // 0x00fc
-65023,	 // 0xfdff
-  766,	 // 0x02fe
-  766,	 // 0x02fe
-  255,	 // 0x00ff
-    3,	 // 0x0003
- 4586,	 // 0x11ea
- 2030,	 // 0x07ee
-61712,	 // 0xf110
-  512,	 // 0x0200
-65029,	 // 0xfe05
-63989,	 // 0xf9f5
-64517,	 // 0xfc05
-  505,	 // 0x01f9
-  508,	 // 0x01fc
-  508,	 // 0x01fc
-64768,	 // 0xfd00
-65278,	 // 0xfefe
-65025,	 // 0xfe01
-  251,	 // 0x00fb
-  253,	 // 0x00fd
-65023,	 // 0xfdff
-  766,	 // 0x02fe
-  510,	 // 0x01fe
-  255,	 // 0x00ff
- 8686,	 // 0x21ee
-65253,	 // 0xfee5
- 1263,	 // 0x04ef
-61723,	 // 0xf11b
-63214,	 // 0xf6ee
- 3075,	 // 0x0c03
-61436,	 // 0xeffc
-65291,	 // 0xff0b
-  760,	 // 0x02f8
-  508,	 // 0x01fc
-  768,	 // 0x0300
-64769,	 // 0xfd01
-65279,	 // 0xfeff
-65282,	 // 0xff02
-  508,	 // 0x01fc
-65534,	 // 0xfffe
-65025,	 // 0xfe01
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-   13,	 // 0x000d
-  763,	 // 0x02fb
-60660,	 // 0xecf4
-61908,	 // 0xf1d4
- 5643,	 // 0x160b
- 3343,	 // 0x0d0f
- 1801,	 // 0x0709
- 1032,	 // 0x0408
-65276,	 // 0xfefc
-65279,	 // 0xfeff
-65531,	 // 0xfffb
-  255,	 // 0x00ff
-  252,	 // 0x00fc
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-65534,	 // 0xfffe
-  511,	 // 0x01ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-63224,	 // 0xf6f8
-56309,	 // 0xdbf5
-62172,	 // 0xf2dc
-65013,	 // 0xfdf5
- 2567,	 // 0x0a07
- 3075,	 // 0x0c03
- 2830,	 // 0x0b0e
- 1025,	 // 0x0401
-65281,	 // 0xff01
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  510,	 // 0x01fe
-65024,	 // 0xfe00
-  254,	 // 0x00fe
-  257,	 // 0x0101
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-60658,	 // 0xecf2
-56033,	 // 0xdae1
-59107,	 // 0xe6e3
-58583,	 // 0xe4d7
-63982,	 // 0xf9ee
- 4354,	 // 0x1102
- 4373,	 // 0x1115
- 2306,	 // 0x0902
-  515,	 // 0x0203
-  513,	 // 0x0201
-  769,	 // 0x0301
-  513,	 // 0x0201
-    0,	 // 0x0000
-  511,	 // 0x01ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
- 7948,	 // 0x1f0c
- 3067,	 // 0x0bfb
-61199,	 // 0xef0f
-55246,	 // 0xd7ce
-56013,	 // 0xdacd
- 1783,	 // 0x06f7
- 1794,	 // 0x0702
- 3074,	 // 0x0c02
-  514,	 // 0x0202
- 1025,	 // 0x0401
- 1795,	 // 0x0703
-  512,	 // 0x0200
-  257,	 // 0x0101
-  256,	 // 0x0100
-  257,	 // 0x0101
-  256,	 // 0x0100
-  514,	 // 0x0202
-65279,	 // 0xfeff
-  254,	 // 0x00fe
-  256,	 // 0x0100
-26148,	 // 0x6624
-32595,	 // 0x7f53
- 7773,	 // 0x1e5d
-61428,	 // 0xeff4
-48328,	 // 0xbcc8
-58836,	 // 0xe5d4
-62175,	 // 0xf2df
- 1019,	 // 0x03fb
-  764,	 // 0x02fc
-65534,	 // 0xfffe
- 1024,	 // 0x0400
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  772,	 // 0x0304
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-  257,	 // 0x0101
-13319,	 // 0x3407
-30809,	 // 0x7859
-15714,	 // 0x3d62
- 2854,	 // 0x0b26
-57079,	 // 0xdef7
-59605,	 // 0xe8d5
-60127,	 // 0xeadf
-63992,	 // 0xf9f8
-65530,	 // 0xfffa
-64507,	 // 0xfbfb
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-65022,	 // 0xfdfe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  515,	 // 0x0203
-65024,	 // 0xfe00
-65535,	 // 0xffff
-  258,	 // 0x0102
-51453,	 // 0xc8fd
- 2306,	 // 0x0902
- 8987,	 // 0x231b
- 2853,	 // 0x0b25
- 4115,	 // 0x1013
-  498,	 // 0x01f2
-61689,	 // 0xf0f9
-65276,	 // 0xfefc
-  767,	 // 0x02ff
-65024,	 // 0xfe00
-65282,	 // 0xff02
-  256,	 // 0x0100
-  256,	 // 0x0100
-65535,	 // 0xffff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-61176,	 // 0xeef8
-56548,	 // 0xdce4
-  501,	 // 0x01f5
-65295,	 // 0xff0f
- 5388,	 // 0x150c
- 1792,	 // 0x0700
-63493,	 // 0xf805
- 1025,	 // 0x0401
-  768,	 // 0x0300
-    2,	 // 0x0002
-65024,	 // 0xfe00
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
- 3575,	 // 0x0df7
-58615,	 // 0xe4f7
-63462,	 // 0xf7e6
-  260,	 // 0x0104
- 3076,	 // 0x0c04
- 1027,	 // 0x0403
-64517,	 // 0xfc05
-  769,	 // 0x0301
-  768,	 // 0x0300
-65280,	 // 0xff00
-  254,	 // 0x00fe
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-58369,	 // 0xe401
-64520,	 // 0xfc08
-64752,	 // 0xfcf0
- 2050,	 // 0x0802
- 1285,	 // 0x0505
-    0,	 // 0x0000
-65281,	 // 0xff01
-  512,	 // 0x0200
-  512,	 // 0x0200
-    0,	 // 0x0000
-  256,	 // 0x0100
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-64505,	 // 0xfbf9
- 2285,	 // 0x08ed
-65527,	 // 0xfff7
- 1783,	 // 0x06f7
-  515,	 // 0x0203
-65023,	 // 0xfdff
- 2302,	 // 0x08fe
-  255,	 // 0x00ff
-  513,	 // 0x0201
-  767,	 // 0x02ff
-  766,	 // 0x02fe
-  765,	 // 0x02fd
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-   20,	 // 0x0014
- 2051,	 // 0x0803
- 1013,	 // 0x03f5
-  265,	 // 0x0109
-65282,	 // 0xff02
-65532,	 // 0xfffc
-65027,	 // 0xfe03
-  256,	 // 0x0100
-65283,	 // 0xff03
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-61177,	 // 0xeef9
-62980,	 // 0xf604
-  250,	 // 0x00fa
-65284,	 // 0xff04
-  257,	 // 0x0101
-    1,	 // 0x0001
-65281,	 // 0xff01
-  516,	 // 0x0204
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-65280,	 // 0xff00
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61693,	 // 0xf0fd
-65038,	 // 0xfe0e
-  239,	 // 0x00ef
-65033,	 // 0xfe09
- 1544,	 // 0x0608
-  506,	 // 0x01fa
-65033,	 // 0xfe09
- 1540,	 // 0x0604
-  257,	 // 0x0101
-65280,	 // 0xff00
-65281,	 // 0xff01
-  257,	 // 0x0101
-65280,	 // 0xff00
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-61446,	 // 0xf006
-63226,	 // 0xf6fa
-61408,	 // 0xefe0
-61180,	 // 0xeefc
- 4110,	 // 0x100e
- 2548,	 // 0x09f4
- 1299,	 // 0x0513
- 1792,	 // 0x0700
-    6,	 // 0x0006
-65026,	 // 0xfe02
-65026,	 // 0xfe02
-    1,	 // 0x0001
-65280,	 // 0xff00
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-50683,	 // 0xc5fb
-58806,	 // 0xe5b6
-59103,	 // 0xe6df
-61429,	 // 0xeff5
- 5647,	 // 0x160f
- 3587,	 // 0x0e03
- 2316,	 // 0x090c
-  765,	 // 0x02fd
-64773,	 // 0xfd05
-  260,	 // 0x0104
-65283,	 // 0xff03
-  258,	 // 0x0102
-65025,	 // 0xfe01
-65281,	 // 0xff01
-65535,	 // 0xffff
-65535,	 // 0xffff
-  254,	 // 0x00fe
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-64489,	 // 0xfbe9
- 4829,	 // 0x12dd
- 3866,	 // 0x0f1a
- 6145,	 // 0x1801
-60921,	 // 0xedf9
-64772,	 // 0xfd04
-64235,	 // 0xfaeb
-63740,	 // 0xf8fc
-65274,	 // 0xfefa
-  260,	 // 0x0104
-  254,	 // 0x00fe
-65281,	 // 0xff01
-  255,	 // 0x00ff
-65024,	 // 0xfe00
-65535,	 // 0xffff
-65535,	 // 0xffff
-  256,	 // 0x0100
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-23810,	 // 0x5d02
-22628,	 // 0x5864
-16486,	 // 0x4066
-13315,	 // 0x3403
-47831,	 // 0xbad7
-60922,	 // 0xedfa
-61139,	 // 0xeed3
-61177,	 // 0xeef9
-65012,	 // 0xfdf4
-64762,	 // 0xfcfa
-  250,	 // 0x00fa
-65023,	 // 0xfdff
-  765,	 // 0x02fd
-65279,	 // 0xfeff
-    0,	 // 0x0000
-  767,	 // 0x02ff
-  514,	 // 0x0202
-65280,	 // 0xff00
-  256,	 // 0x0100
-  257,	 // 0x0101
-32541,	 // 0x7f1d
-21114,	 // 0x527a
-13652,	 // 0x3554
- 6398,	 // 0x18fe
-54494,	 // 0xd4de
-60665,	 // 0xecf9
-63459,	 // 0xf7e3
-61689,	 // 0xf0f9
-64502,	 // 0xfbf6
-64761,	 // 0xfcf9
-65532,	 // 0xfffc
-65023,	 // 0xfdff
-  510,	 // 0x01fe
-65535,	 // 0xffff
-  512,	 // 0x0200
-  513,	 // 0x0201
-  514,	 // 0x0202
-65280,	 // 0xff00
-  256,	 // 0x0100
-  257,	 // 0x0101
-11791,	 // 0x2e0f
- 3860,	 // 0x0f14
- 1801,	 // 0x0709
-62973,	 // 0xf5fd
-  764,	 // 0x02fc
-64508,	 // 0xfbfc
-  258,	 // 0x0102
-64761,	 // 0xfcf9
-65277,	 // 0xfefd
-65277,	 // 0xfefd
-    0,	 // 0x0000
-65280,	 // 0xff00
-  255,	 // 0x00ff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-63492,	 // 0xf804
-58347,	 // 0xe3eb
-60892,	 // 0xeddc
-60670,	 // 0xecfe
- 4873,	 // 0x1309
- 1279,	 // 0x04ff
-  269,	 // 0x010d
- 1018,	 // 0x03fa
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    1,	 // 0x0001
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-65535,	 // 0xffff
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-65280,	 // 0xff00
-    0,	 // 0x0000
-65535,	 // 0xffff
-45032,	 // 0xafe8
-50102,	 // 0xc3b6
-57280,	 // 0xdfc0
-61703,	 // 0xf107
- 8209,	 // 0x2011
- 2308,	 // 0x0904
-   16,	 // 0x0010
- 2043,	 // 0x07fb
-  773,	 // 0x0305
-  770,	 // 0x0302
-    0,	 // 0x0000
-  256,	 // 0x0100
-65281,	 // 0xff01
-    1,	 // 0x0001
-65535,	 // 0xffff
-65023,	 // 0xfdff
-65533,	 // 0xfffd
-    0,	 // 0x0000
-65535,	 // 0xffff
-65535,	 // 0xffff
-    4,	 // 0x0004
-49025,	 // 0xbf81
-60914,	 // 0xedf2
-62449,	 // 0xf3f1
-63481,	 // 0xf7f9
-    0,	 // 0x0000
- 1027,	 // 0x0403
-64767,	 // 0xfcff
-    3,	 // 0x0003
-  513,	 // 0x0201
-65282,	 // 0xff02
-    4,	 // 0x0004
- 1023,	 // 0x03ff
-  770,	 // 0x0302
-  511,	 // 0x01ff
-  260,	 // 0x0104
-  769,	 // 0x0301
-  767,	 // 0x02ff
-    4,	 // 0x0004
-  258,	 // 0x0102
- 1278,	 // 0x04fe
-  256,	 // 0x0100
-  257,	 // 0x0101
-    1,	 // 0x0001
-  258,	 // 0x0102
-65281,	 // 0xff01
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-65281,	 // 0xff01
-65281,	 // 0xff01
-65281,	 // 0xff01
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  258,	 // 0x0102
-  258,	 // 0x0102
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1024,	 // 0x0400
-    1,	 // 0x0001
-  255,	 // 0x00ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-  257,	 // 0x0101
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-65535,	 // 0xffff
-  255,	 // 0x00ff
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65278,	 // 0xfefe
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65281,	 // 0xff01
-  256,	 // 0x0100
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65535,	 // 0xffff
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   17,	 // 0x0011
-61691,	 // 0xf0fb
-65014,	 // 0xfdf6
-62465,	 // 0xf401
- 1021,	 // 0x03fd
-65283,	 // 0xff03
-  509,	 // 0x01fd
-  259,	 // 0x0103
-  765,	 // 0x02fd
-65282,	 // 0xff02
-  257,	 // 0x0101
-65282,	 // 0xff02
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 3583,	 // 0x0dff
-65278,	 // 0xfefe
-    5,	 // 0x0005
-65530,	 // 0xfffa
-64770,	 // 0xfd02
-  509,	 // 0x01fd
-  258,	 // 0x0102
-  509,	 // 0x01fd
-65282,	 // 0xff02
-  513,	 // 0x0201
-65281,	 // 0xff01
-  256,	 // 0x0100
-65280,	 // 0xff00
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
- 1797,	 // 0x0705
-64512,	 // 0xfc00
- 1288,	 // 0x0508
-  249,	 // 0x00f9
-65282,	 // 0xff02
- 1020,	 // 0x03fc
-65026,	 // 0xfe02
-  765,	 // 0x02fd
-    3,	 // 0x0003
-  768,	 // 0x0300
-65280,	 // 0xff00
-  256,	 // 0x0100
-65535,	 // 0xffff
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-62979,	 // 0xf603
- 1799,	 // 0x0707
-65283,	 // 0xff03
- 2309,	 // 0x0905
-65530,	 // 0xfffa
- 1285,	 // 0x0505
-64764,	 // 0xfcfc
- 1024,	 // 0x0400
-64769,	 // 0xfd01
- 1024,	 // 0x0400
-65024,	 // 0xfe00
-  767,	 // 0x02ff
-  255,	 // 0x00ff
-65281,	 // 0xff01
-65281,	 // 0xff01
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-60669,	 // 0xecfd
- 9219,	 // 0x2403
-62186,	 // 0xf2ea
- 3098,	 // 0x0c1a
-  999,	 // 0x03e7
-64784,	 // 0xfd10
- 1267,	 // 0x04f3
-64778,	 // 0xfd0a
-  759,	 // 0x02f7
-    6,	 // 0x0006
-  508,	 // 0x01fc
-  513,	 // 0x0201
-  255,	 // 0x00ff
-65024,	 // 0xfe00
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
-  257,	 // 0x0101
-61162,	 // 0xeeea
- 4103,	 // 0x1007
- 3291,	 // 0x0cdb
-61732,	 // 0xf124
- 5853,	 // 0x16dd
-60171,	 // 0xeb0b
- 6643,	 // 0x19f3
-59920,	 // 0xea10
- 4341,	 // 0x10f5
-62982,	 // 0xf606
- 1279,	 // 0x04ff
-65282,	 // 0xff02
-  510,	 // 0x01fe
-65024,	 // 0xfe00
-  512,	 // 0x0200
-  255,	 // 0x00ff
-  256,	 // 0x0100
-  256,	 // 0x0100
-65535,	 // 0xffff
-  257,	 // 0x0101
-  996,	 // 0x03e4
-49188,	 // 0xc024
-15878,	 // 0x3e06
-49665,	 // 0xc201
-10486,	 // 0x28f6
-58352,	 // 0xe3f0
- 9483,	 // 0x250b
-58113,	 // 0xe301
- 4357,	 // 0x1105
-62458,	 // 0xf3fa
- 1032,	 // 0x0408
-65022,	 // 0xfdfe
-  512,	 // 0x0200
-65277,	 // 0xfefd
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-16131,	 // 0x3f03
-35582,	 // 0x8afe
-14910,	 // 0x3a3e
-51908,	 // 0xcac4
- 5423,	 // 0x152f
-63958,	 // 0xf9d6
- 3880,	 // 0x0f28
-62951,	 // 0xf5e7
-  534,	 // 0x0216
-65522,	 // 0xfff2
-64778,	 // 0xfd0a
-65532,	 // 0xfffc
-    0,	 // 0x0000
-  509,	 // 0x01fd
-    1,	 // 0x0001
-  256,	 // 0x0100
-  256,	 // 0x0100
-65535,	 // 0xffff
-  257,	 // 0x0101
-65281,	 // 0xff01
-15915,	 // 0x3e2b
-50121,	 // 0xc3c9
-63812,	 // 0xf944
- 1722,	 // 0x06ba
-61760,	 // 0xf140
- 4319,	 // 0x10df
-61731,	 // 0xf123
- 2536,	 // 0x09e8
-63248,	 // 0xf710
- 2039,	 // 0x07f7
-64514,	 // 0xfc02
-65277,	 // 0xfefd
-    1,	 // 0x0001
-  253,	 // 0x00fd
-65282,	 // 0xff02
-65535,	 // 0xffff
-    0,	 // 0x0000
-65279,	 // 0xfeff
-  258,	 // 0x0102
-65280,	 // 0xff00
- 5913,	 // 0x1719
- 9926,	 // 0x26c6
-52510,	 // 0xcd1e
-12010,	 // 0x2eea
-58655,	 // 0xe51f
- 4857,	 // 0x12f9
-59911,	 // 0xea07
- 3575,	 // 0x0df7
-63745,	 // 0xf901
- 1536,	 // 0x0600
-65276,	 // 0xfefc
-  253,	 // 0x00fd
-65026,	 // 0xfe02
-  509,	 // 0x01fd
-64770,	 // 0xfd02
-65534,	 // 0xfffe
-65280,	 // 0xff00
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-41713,	 // 0xa2f1
-32526,	 // 0x7f0e
-51157,	 // 0xc7d5
-14891,	 // 0x3a2b
-58358,	 // 0xe3f6
- 2062,	 // 0x080e
-61418,	 // 0xefea
- 1797,	 // 0x0705
-65016,	 // 0xfdf8
-  515,	 // 0x0203
-65530,	 // 0xfffa
-  767,	 // 0x02ff
-64768,	 // 0xfd00
-    0,	 // 0x0000
-65023,	 // 0xfdff
-65534,	 // 0xfffe
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  246,	 // 0x00f6
-32515,	 // 0x7f03
- 3062,	 // 0x0bf6
-65296,	 // 0xff10
-65527,	 // 0xfff7
-65025,	 // 0xfe01
-    0,	 // 0x0000
-  254,	 // 0x00fe
-65535,	 // 0xffff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
- 7641,	 // 0x1dd9
-59921,	 // 0xea11
- 1284,	 // 0x0504
- 1026,	 // 0x0402
-65283,	 // 0xff03
-  256,	 // 0x0100
-65279,	 // 0xfeff
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-38423,	 // 0x9617
-63254,	 // 0xf716
- 1779,	 // 0x06f3
-  515,	 // 0x0203
-    4,	 // 0x0004
-  765,	 // 0x02fd
-65282,	 // 0xff02
-  512,	 // 0x0200
-65026,	 // 0xfe02
-    2,	 // 0x0002
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-48662,	 // 0xbe16
- 2570,	 // 0x0a0a
-65525,	 // 0xfff5
-65025,	 // 0xfe01
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  513,	 // 0x0201
-65281,	 // 0xff01
-    2,	 // 0x0002
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 5626,	 // 0x15fa
- 3565,	 // 0x0ded
-64767,	 // 0xfcff
-65281,	 // 0xff01
-  765,	 // 0x02fd
-65026,	 // 0xfe02
-  256,	 // 0x0100
-65281,	 // 0xff01
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65027,	 // 0xfe03
- 1270,	 // 0x04f6
-64514,	 // 0xfc02
-    2,	 // 0x0002
-  512,	 // 0x0200
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63487,	 // 0xf7ff
-64774,	 // 0xfd06
-65283,	 // 0xff03
-65282,	 // 0xff02
-  256,	 // 0x0100
-65535,	 // 0xffff
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2045,	 // 0x07fd
-63746,	 // 0xf902
-  770,	 // 0x0302
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1791,	 // 0x06ff
-64766,	 // 0xfcfe
-  514,	 // 0x0202
-  255,	 // 0x00ff
-65280,	 // 0xff00
-  256,	 // 0x0100
-65281,	 // 0xff01
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65279,	 // 0xfeff
-  509,	 // 0x01fd
-    1,	 // 0x0001
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-  512,	 // 0x0200
-65533,	 // 0xfffd
-    3,	 // 0x0003
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    5,	 // 0x0005
- 9419,	 // 0x24cb
-65293,	 // 0xff0d
- 1539,	 // 0x0603
-65293,	 // 0xff0d
- 2047,	 // 0x07ff
- 1538,	 // 0x0602
-  515,	 // 0x0203
-  258,	 // 0x0102
-65280,	 // 0xff00
-65280,	 // 0xff00
-65281,	 // 0xff01
-65280,	 // 0xff00
-65281,	 // 0xff01
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-33071,	 // 0x812f
-63741,	 // 0xf8fd
-  503,	 // 0x01f7
-  772,	 // 0x0304
- 1282,	 // 0x0502
- 2048,	 // 0x0800
-  261,	 // 0x0105
- 1279,	 // 0x04ff
-    2,	 // 0x0002
-  257,	 // 0x0101
-  257,	 // 0x0101
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-45086,	 // 0xb01e
- 1263,	 // 0x04ef
- 1025,	 // 0x0401
- 1022,	 // 0x03fe
-  507,	 // 0x01fb
- 1026,	 // 0x0402
-  515,	 // 0x0203
-  770,	 // 0x0302
-  515,	 // 0x0203
-  257,	 // 0x0101
-  514,	 // 0x0202
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 7147,	 // 0x1beb
- 2298,	 // 0x08fa
- 1289,	 // 0x0509
-65531,	 // 0xfffb
-65527,	 // 0xfff7
-    2,	 // 0x0002
-    0,	 // 0x0000
-  258,	 // 0x0102
-  512,	 // 0x0200
-  511,	 // 0x01ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-15611,	 // 0x3cfb
-65029,	 // 0xfe05
-64768,	 // 0xfd00
-65020,	 // 0xfdfc
-  255,	 // 0x00ff
-65279,	 // 0xfeff
-  255,	 // 0x00ff
-65534,	 // 0xfffe
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 4099,	 // 0x1003
-65032,	 // 0xfe08
-65022,	 // 0xfdfe
-65282,	 // 0xff02
-    6,	 // 0x0006
-65020,	 // 0xfdfc
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-    1,	 // 0x0001
-    0,	 // 0x0000
-65535,	 // 0xffff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  254,	 // 0x00fe
-65289,	 // 0xff09
-65024,	 // 0xfe00
-65282,	 // 0xff02
-65282,	 // 0xff02
-65277,	 // 0xfefd
-65534,	 // 0xfffe
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65026,	 // 0xfe02
-64002,	 // 0xfa02
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-65535,	 // 0xffff
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  772,	 // 0x0304
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    2,	 // 0x0002
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  769,	 // 0x0301
-  510,	 // 0x01fe
-65277,	 // 0xfefd
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    2,	 // 0x0002
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 2298,	 // 0x08fa
-65022,	 // 0xfdfe
-65530,	 // 0xfffa
-  512,	 // 0x0200
-65281,	 // 0xff01
-65282,	 // 0xff02
-65534,	 // 0xfffe
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  250,	 // 0x00fa
-40943,	 // 0x9fef
- 9425,	 // 0x24d1
- 6767,	 // 0x1a6f
-50591,	 // 0xc59f
-10546,	 // 0x2932
-56584,	 // 0xdd08
- 3305,	 // 0x0ce9
-64263,	 // 0xfb07
-64770,	 // 0xfd02
- 1786,	 // 0x06fa
-65282,	 // 0xff02
-65021,	 // 0xfdfd
-  513,	 // 0x0201
-64769,	 // 0xfd01
-  256,	 // 0x0100
-    2,	 // 0x0002
-65024,	 // 0xfe00
-    1,	 // 0x0001
-    1,	 // 0x0001
-65535,	 // 0xffff
- 7712,	 // 0x1e20
-48278,	 // 0xbc96
-19485,	 // 0x4c1d
-42488,	 // 0xa5f8
-15579,	 // 0x3cdb
-  577,	 // 0x0241
-59861,	 // 0xe9d5
- 3600,	 // 0x0e10
- 1525,	 // 0x05f5
-  503,	 // 0x01f7
- 1534,	 // 0x05fe
-64765,	 // 0xfcfd
- 1274,	 // 0x04fa
-    1,	 // 0x0001
-  251,	 // 0x00fb
-  257,	 // 0x0101
-65022,	 // 0xfdfe
-  768,	 // 0x0300
-  257,	 // 0x0101
-65534,	 // 0xfffe
-32534,	 // 0x7f16
-38368,	 // 0x95e0
-23527,	 // 0x5be7
-52307,	 // 0xcc53
- 1929,	 // 0x0789
-17507,	 // 0x4463
-48865,	 // 0xbee1
-10243,	 // 0x2803
-  508,	 // 0x01fc
-65528,	 // 0xfff8
- 1538,	 // 0x0602
-65278,	 // 0xfefe
-  761,	 // 0x02f9
-  513,	 // 0x0201
-65274,	 // 0xfefa
-  512,	 // 0x0200
-65535,	 // 0xffff
-  765,	 // 0x02fd
-  513,	 // 0x0201
-65535,	 // 0xffff
-14830,	 // 0x39ee
-55085,	 // 0xd72d
-10703,	 // 0x29cf
- 6505,	 // 0x1969
-51097,	 // 0xc799
-25133,	 // 0x622d
-50196,	 // 0xc414
- 8161,	 // 0x1fe1
-  780,	 // 0x030c
-64249,	 // 0xfaf9
- 2311,	 // 0x0907
-65277,	 // 0xfefd
-  764,	 // 0x02fc
-  513,	 // 0x0201
-65279,	 // 0xfeff
-  768,	 // 0x0300
-  256,	 // 0x0100
-  253,	 // 0x00fd
-  514,	 // 0x0202
-65024,	 // 0xfe00
-58372,	 // 0xe404
- 3374,	 // 0x0d2e
-60880,	 // 0xedd0
-12347,	 // 0x303b
-52195,	 // 0xcbe3
-15589,	 // 0x3ce5
-61746,	 // 0xf132
-64731,	 // 0xfcdb
- 2826,	 // 0x0b0a
-62981,	 // 0xf605
- 1790,	 // 0x06fe
-65281,	 // 0xff01
-    0,	 // 0x0000
-  768,	 // 0x0300
-65028,	 // 0xfe04
-  512,	 // 0x0200
- 1026,	 // 0x0402
-65535,	 // 0xffff
-  512,	 // 0x0200
-    0,	 // 0x0000
- 4101,	 // 0x1005
- 3339,	 // 0x0d0b
-59116,	 // 0xe6ec
- 7178,	 // 0x1c0a
-61967,	 // 0xf20f
- 2778,	 // 0x0ada
- 4641,	 // 0x1221
-61170,	 // 0xeef2
- 2812,	 // 0x0afc
-64267,	 // 0xfb0b
- 1018,	 // 0x03fa
-65281,	 // 0xff01
-    2,	 // 0x0002
-  767,	 // 0x02ff
-65283,	 // 0xff03
-  511,	 // 0x01ff
- 1024,	 // 0x0400
-65025,	 // 0xfe01
-  256,	 // 0x0100
-  512,	 // 0x0200
- 3320,	 // 0x0cf8
-64766,	 // 0xfcfe
-63993,	 // 0xf9f9
- 3837,	 // 0x0efd
-65295,	 // 0xff0f
-64494,	 // 0xfbee
- 3338,	 // 0x0d0a
-63235,	 // 0xf703
- 1017,	 // 0x03f9
-    6,	 // 0x0006
-  764,	 // 0x02fc
-65278,	 // 0xfefe
-    3,	 // 0x0003
-  766,	 // 0x02fe
-65282,	 // 0xff02
-    1,	 // 0x0001
-  512,	 // 0x0200
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-62715,	 // 0xf4fb
-63991,	 // 0xf9f7
-  509,	 // 0x01fd
- 1530,	 // 0x05fa
-65030,	 // 0xfe06
-65020,	 // 0xfdfc
- 1028,	 // 0x0404
-  772,	 // 0x0304
-65276,	 // 0xfefc
-    3,	 // 0x0003
-  767,	 // 0x02ff
-  253,	 // 0x00fd
-65282,	 // 0xff02
-  511,	 // 0x01ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-  257,	 // 0x0101
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-58875,	 // 0xe5fb
-64769,	 // 0xfd01
-  260,	 // 0x0104
-  252,	 // 0x00fc
-  256,	 // 0x0100
-  261,	 // 0x0105
-    0,	 // 0x0000
-  771,	 // 0x0303
-65024,	 // 0xfe00
-    1,	 // 0x0001
-  513,	 // 0x0201
-  253,	 // 0x00fd
-65281,	 // 0xff01
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-63229,	 // 0xf6fd
-  511,	 // 0x01ff
-65029,	 // 0xfe05
-  253,	 // 0x00fd
-  767,	 // 0x02ff
-65029,	 // 0xfe05
-65530,	 // 0xfffa
-  515,	 // 0x0203
-65023,	 // 0xfdff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-65280,	 // 0xff00
-  506,	 // 0x01fa
- 2320,	 // 0x0910
-64507,	 // 0xfbfb
-64759,	 // 0xfcf7
- 1035,	 // 0x040b
-61692,	 // 0xf0fc
- 1783,	 // 0x06f7
-64516,	 // 0xfc04
-65280,	 // 0xff00
-65279,	 // 0xfeff
-65024,	 // 0xfe00
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-  239,	 // 0x00ef
-24854,	 // 0x6116
-33277,	 // 0x81fd
- 9918,	 // 0x26be
-63548,	 // 0xf83c
-61912,	 // 0xf1d8
-10769,	 // 0x2a11
-63506,	 // 0xf812
- 2562,	 // 0x0a02
- 1022,	 // 0x03fe
-  255,	 // 0x00ff
- 1793,	 // 0x0701
-65282,	 // 0xff02
-  256,	 // 0x0100
-  770,	 // 0x0302
-  515,	 // 0x0203
-  258,	 // 0x0102
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-17656,	 // 0x44f8
-56366,	 // 0xdc2e
-62905,	 // 0xf5b9
- 8238,	 // 0x202e
-57582,	 // 0xe0ee
- 7410,	 // 0x1cf2
-   32,	 // 0x0020
-  249,	 // 0x00f9
- 1029,	 // 0x0405
-65282,	 // 0xff02
-  768,	 // 0x0300
-    5,	 // 0x0005
-65280,	 // 0xff00
-  513,	 // 0x0201
-  260,	 // 0x0104
-65281,	 // 0xff01
-  258,	 // 0x0102
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
- 4333,	 // 0x10ed
-65333,	 // 0xff35
-58058,	 // 0xe2ca
- 9244,	 // 0x241c
-59145,	 // 0xe709
- 1502,	 // 0x05de
- 3357,	 // 0x0d1d
-63485,	 // 0xf7fd
-  769,	 // 0x0301
-  261,	 // 0x0105
-65279,	 // 0xfeff
-    4,	 // 0x0004
-65027,	 // 0xfe03
-  512,	 // 0x0200
-  260,	 // 0x0104
-65281,	 // 0xff01
-  514,	 // 0x0202
-65281,	 // 0xff01
-    0,	 // 0x0000
-  257,	 // 0x0101
-65531,	 // 0xfffb
- 3874,	 // 0x0f22
-58340,	 // 0xe3e4
- 5127,	 // 0x1407
-64018,	 // 0xfa12
-62688,	 // 0xf4e0
- 4107,	 // 0x100b
-63494,	 // 0xf806
-  253,	 // 0x00fd
-  259,	 // 0x0103
-64766,	 // 0xfcfe
-65284,	 // 0xff04
-65283,	 // 0xff03
-    0,	 // 0x0000
-    3,	 // 0x0003
-65282,	 // 0xff02
-  514,	 // 0x0202
-65282,	 // 0xff02
-65280,	 // 0xff00
-    1,	 // 0x0001
-64521,	 // 0xfc09
-64517,	 // 0xfc05
-62205,	 // 0xf2fd
- 3070,	 // 0x0bfe
- 1549,	 // 0x060d
-63223,	 // 0xf6f7
- 2815,	 // 0x0aff
-    9,	 // 0x0009
-65534,	 // 0xfffe
-  512,	 // 0x0200
-65281,	 // 0xff01
-65282,	 // 0xff02
-    2,	 // 0x0002
-    1,	 // 0x0001
-  257,	 // 0x0101
-    1,	 // 0x0001
-    1,	 // 0x0001
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
- 1028,	 // 0x0404
-63223,	 // 0xf6f7
-64774,	 // 0xfd06
- 2054,	 // 0x0806
-  514,	 // 0x0202
-64259,	 // 0xfb03
-  256,	 // 0x0100
-  772,	 // 0x0304
-65283,	 // 0xff03
-  511,	 // 0x01ff
-  260,	 // 0x0104
-65280,	 // 0xff00
-    1,	 // 0x0001
-65282,	 // 0xff02
-    1,	 // 0x0001
-    2,	 // 0x0002
-    1,	 // 0x0001
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
- 1535,	 // 0x05ff
-64757,	 // 0xfcf5
-  509,	 // 0x01fd
- 1545,	 // 0x0609
-65533,	 // 0xfffd
-65026,	 // 0xfe02
-65285,	 // 0xff05
-  765,	 // 0x02fd
-  259,	 // 0x0103
-65024,	 // 0xfe00
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-63744,	 // 0xf900
-63997,	 // 0xf9fd
- 1023,	 // 0x03ff
-    4,	 // 0x0004
-65025,	 // 0xfe01
-    1,	 // 0x0001
-65287,	 // 0xff07
-  764,	 // 0x02fc
-65283,	 // 0xff03
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-61438,	 // 0xeffe
-64002,	 // 0xfa02
-  263,	 // 0x0107
-65534,	 // 0xfffe
-65283,	 // 0xff03
-    2,	 // 0x0002
-65284,	 // 0xff04
-  509,	 // 0x01fd
-65281,	 // 0xff01
-65282,	 // 0xff02
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-64768,	 // 0xfd00
-  510,	 // 0x01fe
-  265,	 // 0x0109
-  252,	 // 0x00fc
-65282,	 // 0xff02
-65283,	 // 0xff03
-65022,	 // 0xfdfe
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-62723,	 // 0xf503
- 4090,	 // 0x0ffa
- 1298,	 // 0x0512
-65276,	 // 0xfefc
-65025,	 // 0xfe01
-64518,	 // 0xfc06
-64762,	 // 0xfcfa
-65281,	 // 0xff01
-    0,	 // 0x0000
-65024,	 // 0xfe00
-65281,	 // 0xff01
-    0,	 // 0x0000
-65280,	 // 0xff00
-65281,	 // 0xff01
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-  241,	 // 0x00f1
- 1741,	 // 0x06cd
- 6951,	 // 0x1b27
-63774,	 // 0xf91e
-63748,	 // 0xf904
-    3,	 // 0x0003
-65024,	 // 0xfe00
-  775,	 // 0x0307
-65032,	 // 0xfe08
-64522,	 // 0xfc0a
-  768,	 // 0x0300
-65026,	 // 0xfe02
-65284,	 // 0xff04
-65028,	 // 0xfe04
-65280,	 // 0xff00
-65282,	 // 0xff02
-    1,	 // 0x0001
-65282,	 // 0xff02
-65282,	 // 0xff02
-65281,	 // 0xff01
-  256,	 // 0x0100
-56561,	 // 0xdcf1
-64241,	 // 0xfaf1
-61184,	 // 0xef00
-62981,	 // 0xf605
-  266,	 // 0x010a
-  255,	 // 0x00ff
-  775,	 // 0x0307
-    2,	 // 0x0002
-65287,	 // 0xff07
-  256,	 // 0x0100
-65027,	 // 0xfe03
-65026,	 // 0xfe02
-65026,	 // 0xfe02
-65280,	 // 0xff00
-65281,	 // 0xff01
-    1,	 // 0x0001
-65281,	 // 0xff01
-    2,	 // 0x0002
-    0,	 // 0x0000
-    0,	 // 0x0000
-  275,	 // 0x0113
-51683,	 // 0xc9e3
-64768,	 // 0xfd00
-61957,	 // 0xf205
-63503,	 // 0xf80f
-65026,	 // 0xfe02
-  771,	 // 0x0303
-  772,	 // 0x0304
-  516,	 // 0x0204
-    3,	 // 0x0003
-65284,	 // 0xff04
-65028,	 // 0xfe04
-65025,	 // 0xfe01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-12564,	 // 0x3114
-42279,	 // 0xa527
- 8462,	 // 0x210e
-62962,	 // 0xf5f2
-59654,	 // 0xe906
-65533,	 // 0xfffd
-    0,	 // 0x0000
- 1032,	 // 0x0408
-  772,	 // 0x0304
-65028,	 // 0xfe04
-  517,	 // 0x0205
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-  513,	 // 0x0201
-  257,	 // 0x0101
-  256,	 // 0x0100
-  257,	 // 0x0101
-    1,	 // 0x0001
-    0,	 // 0x0000
- 4383,	 // 0x111f
-53119,	 // 0xcf7f
- 8725,	 // 0x2215
- 2015,	 // 0x07df
-59138,	 // 0xe702
- 2292,	 // 0x08f4
-65025,	 // 0xfe01
- 1539,	 // 0x0603
-65026,	 // 0xfe02
-64258,	 // 0xfb02
-  773,	 // 0x0305
-  256,	 // 0x0100
-  765,	 // 0x02fd
-  509,	 // 0x01fd
-  769,	 // 0x0301
-  512,	 // 0x0200
-  256,	 // 0x0100
-  257,	 // 0x0101
-  258,	 // 0x0102
-  256,	 // 0x0100
-43292,	 // 0xa91c
-11049,	 // 0x2b29
- 2032,	 // 0x07f0
- 7650,	 // 0x1de2
- 2072,	 // 0x0818
- 1778,	 // 0x06f2
- 1286,	 // 0x0506
- 2047,	 // 0x07ff
-65020,	 // 0xfdfc
-64774,	 // 0xfd06
- 1026,	 // 0x0402
- 1023,	 // 0x03ff
-  252,	 // 0x00fc
-  509,	 // 0x01fd
-  767,	 // 0x02ff
- 1023,	 // 0x03ff
-  766,	 // 0x02fe
-  768,	 // 0x0300
-  514,	 // 0x0202
-  512,	 // 0x0200
-58626,	 // 0xe502
-21128,	 // 0x5288
-65241,	 // 0xfed9
- 6908,	 // 0x1afc
- 9505,	 // 0x2521
-63484,	 // 0xf7fc
- 3583,	 // 0x0dff
- 1536,	 // 0x0600
-  762,	 // 0x02fa
-    7,	 // 0x0007
- 1535,	 // 0x05ff
- 1277,	 // 0x04fd
-  252,	 // 0x00fc
-  252,	 // 0x00fc
-  508,	 // 0x01fc
-  766,	 // 0x02fe
-  507,	 // 0x01fb
-  768,	 // 0x0300
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-29409,	 // 0x72e1
- 8100,	 // 0x1fa4
- 6627,	 // 0x19e3
-63255,	 // 0xf717
-11025,	 // 0x2b11
-60416,	 // 0xec00
- 4349,	 // 0x10fd
-65022,	 // 0xfdfe
- 1531,	 // 0x05fb
-64514,	 // 0xfc02
- 1022,	 // 0x03fe
- 1020,	 // 0x03fc
-65277,	 // 0xfefd
-  509,	 // 0x01fd
-  252,	 // 0x00fc
-  766,	 // 0x02fe
-  252,	 // 0x00fc
-  512,	 // 0x0200
-  511,	 // 0x01ff
-  511,	 // 0x01ff
-17645,	 // 0x44ed
-51204,	 // 0xc804
-16132,	 // 0x3f04
-57866,	 // 0xe20a
- 7437,	 // 0x1d0d
-61175,	 // 0xeef7
- 3082,	 // 0x0c0a
-63992,	 // 0xf9f8
- 1026,	 // 0x0402
-64506,	 // 0xfbfa
-65028,	 // 0xfe04
-  253,	 // 0x00fd
-65534,	 // 0xfffe
-  511,	 // 0x01ff
-65534,	 // 0xfffe
-  513,	 // 0x0201
-  509,	 // 0x01fd
-  257,	 // 0x0101
-  510,	 // 0x01fe
-    0,	 // 0x0000
-12538,	 // 0x30fa
-41999,	 // 0xa40f
-15144,	 // 0x3b28
-60142,	 // 0xeaee
- 2581,	 // 0x0a15
-63986,	 // 0xf9f2
-  277,	 // 0x0115
-64502,	 // 0xfbf6
-  771,	 // 0x0303
-65532,	 // 0xfffc
-64262,	 // 0xfb06
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  258,	 // 0x0102
-  510,	 // 0x01fe
-65281,	 // 0xff01
-  256,	 // 0x0100
-    1,	 // 0x0001
-49935,	 // 0xc30f
-35018,	 // 0x88ca
- 5449,	 // 0x1549
-61144,	 // 0xeed8
-  561,	 // 0x0231
- 2795,	 // 0x0aeb
-60963,	 // 0xee23
-  501,	 // 0x01f5
-  517,	 // 0x0205
-65279,	 // 0xfeff
-63753,	 // 0xf909
-65030,	 // 0xfe06
-    1,	 // 0x0001
-    2,	 // 0x0002
-65025,	 // 0xfe01
-64771,	 // 0xfd03
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-65280,	 // 0xff00
-  121,	 // 0x0079
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-32517,	 // 0x7f05
-13615,	 // 0x352f
- 8995,	 // 0x2323
- 3336,	 // 0x0d08
-63748,	 // 0xf904
-62457,	 // 0xf3f9
-64244,	 // 0xfaf4
-63220,	 // 0xf6f4
-63480,	 // 0xf7f8
-65018,	 // 0xfdfa
-65275,	 // 0xfefb
-65534,	 // 0xfffe
-65534,	 // 0xfffe
-65535,	 // 0xffff
-  510,	 // 0x01fe
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  512,	 // 0x0200
-  513,	 // 0x0201
-    0,	 // 0x0000
-65019,	 // 0xfdfb
-10279,	 // 0x2827
-60638,	 // 0xecde
- 2870,	 // 0x0b36
-62929,	 // 0xf5d1
-62759,	 // 0xf527
- 2543,	 // 0x09ef
-63499,	 // 0xf80b
-  757,	 // 0x02f5
-64265,	 // 0xfb09
-  760,	 // 0x02f8
-64772,	 // 0xfd04
-  767,	 // 0x02ff
-  254,	 // 0x00fe
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    1,	 // 0x0001
-  256,	 // 0x0100
-    1,	 // 0x0001
-  512,	 // 0x0200
- 2802,	 // 0x0af2
-44048,	 // 0xac10
-21476,	 // 0x53e4
-53023,	 // 0xcf1f
-12511,	 // 0x30df
-57104,	 // 0xdf10
- 5632,	 // 0x1600
-61444,	 // 0xf004
- 4093,	 // 0x0ffd
-61952,	 // 0xf200
- 1795,	 // 0x0703
-64255,	 // 0xfaff
-  513,	 // 0x0201
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-  512,	 // 0x0200
-    0,	 // 0x0000
-  257,	 // 0x0101
-14350,	 // 0x380e
-33251,	 // 0x81e3
-29228,	 // 0x722c
-44752,	 // 0xaed0
-17956,	 // 0x4624
-57305,	 // 0xdfd9
- 6941,	 // 0x1b1d
-61938,	 // 0xf1f2
- 4878,	 // 0x130e
-62960,	 // 0xf5f0
-  528,	 // 0x0210
-65015,	 // 0xfdf7
-    6,	 // 0x0006
-  253,	 // 0x00fd
-65281,	 // 0xff01
-65280,	 // 0xff00
-  256,	 // 0x0100
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65280,	 // 0xff00
-13084,	 // 0x331c
-51365,	 // 0xc8a5
- 8313,	 // 0x2079
-57230,	 // 0xdf8e
- 3184,	 // 0x0c70
-  431,	 // 0x01af
-  814,	 // 0x032e
-65508,	 // 0xffe4
- 1559,	 // 0x0617
- 1003,	 // 0x03eb
-63759,	 // 0xf90f
-  760,	 // 0x02f8
-64517,	 // 0xfc05
-  510,	 // 0x01fe
-65281,	 // 0xff01
-65281,	 // 0xff01
-  256,	 // 0x0100
-65281,	 // 0xff01
-  511,	 // 0x01ff
-65024,	 // 0xfe00
-  502,	 // 0x01f6
-19917,	 // 0x4dcd
-41821,	 // 0xa35d
-15291,	 // 0x3bbb
-47951,	 // 0xbb4f
-11728,	 // 0x2dd0
-57888,	 // 0xe220
- 4077,	 // 0x0fed
-62992,	 // 0xf610
- 2550,	 // 0x09f6
-63494,	 // 0xf806
- 1022,	 // 0x03fe
-64002,	 // 0xfa02
-    2,	 // 0x0002
-65281,	 // 0xff01
-65281,	 // 0xff01
-    1,	 // 0x0001
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65024,	 // 0xfe00
-48895,	 // 0xbeff
-30746,	 // 0x781a
-37863,	 // 0x93e7
-19740,	 // 0x4d1c
-48618,	 // 0xbdea
-11029,	 // 0x2b15
-57337,	 // 0xdff9
- 3332,	 // 0x0d04
-62976,	 // 0xf600
- 1792,	 // 0x0700
-64768,	 // 0xfd00
-  513,	 // 0x0201
-64512,	 // 0xfc00
-    3,	 // 0x0003
-65281,	 // 0xff01
-    0,	 // 0x0000
-    2,	 // 0x0002
-65281,	 // 0xff01
-65280,	 // 0xff00
-    1,	 // 0x0001
-61437,	 // 0xeffd
-12574,	 // 0x311e
-56255,	 // 0xdbbf
- 6707,	 // 0x1a33
-60112,	 // 0xead0
- 2340,	 // 0x0924
-63463,	 // 0xf7e7
-65037,	 // 0xfe0d
-65276,	 // 0xfefc
- 1024,	 // 0x0400
-  254,	 // 0x00fe
-  513,	 // 0x0201
-65023,	 // 0xfdff
-    4,	 // 0x0004
-    0,	 // 0x0000
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-65024,	 // 0xfe00
-    0,	 // 0x0000
- 5379,	 // 0x1503
-63495,	 // 0xf807
- 3552,	 // 0x0de0
-  532,	 // 0x0214
-64750,	 // 0xfcee
-63761,	 // 0xf911
- 1265,	 // 0x04f1
-64262,	 // 0xfb06
-  254,	 // 0x00fe
-  769,	 // 0x0301
-  509,	 // 0x01fd
-  512,	 // 0x0200
-  510,	 // 0x01fe
-65282,	 // 0xff02
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65535,	 // 0xffff
-  255,	 // 0x00ff
- 1276,	 // 0x04fc
-63995,	 // 0xf9fb
- 2551,	 // 0x09f7
- 1541,	 // 0x0605
-65278,	 // 0xfefe
-64772,	 // 0xfd04
-  763,	 // 0x02fb
-65280,	 // 0xff00
-65534,	 // 0xfffe
-  258,	 // 0x0102
-  510,	 // 0x01fe
-  513,	 // 0x0201
-  510,	 // 0x01fe
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
- 1542,	 // 0x0606
-  504,	 // 0x01f8
-65273,	 // 0xfef9
-  256,	 // 0x0100
-65533,	 // 0xfffd
-  514,	 // 0x0202
-  252,	 // 0x00fc
-  512,	 // 0x0200
-65277,	 // 0xfefd
-65282,	 // 0xff02
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-61430,	 // 0xeff6
-62985,	 // 0xf609
-65533,	 // 0xfffd
-64257,	 // 0xfb01
-  510,	 // 0x01fe
-65285,	 // 0xff05
-65532,	 // 0xfffc
-  258,	 // 0x0102
-65534,	 // 0xfffe
-64769,	 // 0xfd01
-    0,	 // 0x0000
-    0,	 // 0x0000
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65535,	 // 0xffff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-65280,	 // 0xff00
-  236,	 // 0x00ec
- 2816,	 // 0x0b00
-   13,	 // 0x000d
-  518,	 // 0x0206
-65290,	 // 0xff0a
-64513,	 // 0xfc01
-65281,	 // 0xff01
-    2,	 // 0x0002
-    4,	 // 0x0004
-65535,	 // 0xffff
-    1,	 // 0x0001
-    1,	 // 0x0001
-  257,	 // 0x0101
-65281,	 // 0xff01
-65281,	 // 0xff01
-  257,	 // 0x0101
-    0,	 // 0x0000
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-59904,	 // 0xea00
-  252,	 // 0x00fc
-    7,	 // 0x0007
-65025,	 // 0xfe01
-64771,	 // 0xfd03
-65279,	 // 0xfeff
-  257,	 // 0x0101
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65281,	 // 0xff01
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-65280,	 // 0xff00
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-61186,	 // 0xef02
-65525,	 // 0xfff5
-    9,	 // 0x0009
-64256,	 // 0xfb00
-65282,	 // 0xff02
-65279,	 // 0xfeff
-  770,	 // 0x0302
-65025,	 // 0xfe01
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    3,	 // 0x0003
-63219,	 // 0xf6f3
-  519,	 // 0x0207
-63746,	 // 0xf902
-  509,	 // 0x01fd
-65283,	 // 0xff03
-  512,	 // 0x0200
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-  258,	 // 0x0102
-65535,	 // 0xffff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  256,	 // 0x0100
-64516,	 // 0xfc04
-63999,	 // 0xf9ff
-  770,	 // 0x0302
-65029,	 // 0xfe05
-  251,	 // 0x00fb
-  256,	 // 0x0100
-  514,	 // 0x0202
-65024,	 // 0xfe00
-  258,	 // 0x0102
-  255,	 // 0x00ff
-  513,	 // 0x0201
-65535,	 // 0xffff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 4604,	 // 0x11fc
-    7,	 // 0x0007
-  250,	 // 0x00fa
-  773,	 // 0x0305
-64765,	 // 0xfcfd
- 1023,	 // 0x03ff
-  259,	 // 0x0103
-64768,	 // 0xfd00
-  514,	 // 0x0202
-  256,	 // 0x0100
-  256,	 // 0x0100
-65280,	 // 0xff00
-    2,	 // 0x0002
-  257,	 // 0x0101
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
- 4611,	 // 0x1203
-64770,	 // 0xfd02
- 1269,	 // 0x04f5
-64259,	 // 0xfb03
- 1024,	 // 0x0400
-  263,	 // 0x0107
-64763,	 // 0xfcfb
-  771,	 // 0x0303
-  516,	 // 0x0204
-  253,	 // 0x00fd
-  767,	 // 0x02ff
-65280,	 // 0xff00
-  258,	 // 0x0102
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-  255,	 // 0x00ff
-65280,	 // 0xff00
-64259,	 // 0xfb03
- 2822,	 // 0x0b06
-  251,	 // 0x00fb
-63475,	 // 0xf7f3
- 4879,	 // 0x130f
-61956,	 // 0xf204
-65265,	 // 0xfef1
- 2316,	 // 0x090c
-65283,	 // 0xff03
-  760,	 // 0x02f8
-  257,	 // 0x0101
-65535,	 // 0xffff
-  258,	 // 0x0102
-65281,	 // 0xff01
-  511,	 // 0x01ff
-    1,	 // 0x0001
-65280,	 // 0xff00
-  257,	 // 0x0101
-    0,	 // 0x0000
-    0,	 // 0x0000
-61169,	 // 0xeef1
- 8989,	 // 0x231d
-58350,	 // 0xe3ee
- 4586,	 // 0x11ea
- 4390,	 // 0x1126
-59111,	 // 0xe6e7
- 3833,	 // 0x0ef9
- 1301,	 // 0x0515
-65022,	 // 0xfdfe
- 1275,	 // 0x04fb
-    1,	 // 0x0001
-  256,	 // 0x0100
-    2,	 // 0x0002
-65024,	 // 0xfe00
-  512,	 // 0x0200
-    1,	 // 0x0001
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
- 6636,	 // 0x19ec
- 4927,	 // 0x133f
-54218,	 // 0xd3ca
-10246,	 // 0x2806
-62235,	 // 0xf31b
-63192,	 // 0xf6d8
- 4877,	 // 0x130d
-64780,	 // 0xfd0c
-65533,	 // 0xfffd
- 1025,	 // 0x0401
-65024,	 // 0xfe00
-  257,	 // 0x0101
-65282,	 // 0xff02
-    0,	 // 0x0000
-  257,	 // 0x0101
-    1,	 // 0x0001
-  256,	 // 0x0100
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  256,	 // 0x0100
-32537,	 // 0x7f19
-42557,	 // 0xa63d
-59798,	 // 0xe996
- 4149,	 // 0x1035
-59388,	 // 0xe7fc
- 4075,	 // 0x0feb
- 1553,	 // 0x0611
- 1288,	 // 0x0508
-65281,	 // 0xff01
-65535,	 // 0xffff
-  257,	 // 0x0101
-    6,	 // 0x0006
-65281,	 // 0xff01
-  514,	 // 0x0202
-    2,	 // 0x0002
-    2,	 // 0x0002
-    2,	 // 0x0002
-65280,	 // 0xff00
-    1,	 // 0x0001
-  257,	 // 0x0101
-  239,	 // 0x00ef
-56816,	 // 0xddf0
-  254,	 // 0x00fe
- 2321,	 // 0x0911
- 1775,	 // 0x06ef
-62750,	 // 0xf51e
- 3304,	 // 0x0ce8
-59904,	 // 0xea00
-  757,	 // 0x02f5
-64017,	 // 0xfa11
- 3307,	 // 0x0ceb
-60681,	 // 0xed09
- 3065,	 // 0x0bf9
-63236,	 // 0xf704
- 1026,	 // 0x0402
-64512,	 // 0xfc00
-    1,	 // 0x0001
-65279,	 // 0xfeff
-  259,	 // 0x0103
-  766,	 // 0x02fe
-    0,	 // 0x0000
-56072,	 // 0xdb08
-64762,	 // 0xfcfa
-65298,	 // 0xff12
- 5333,	 // 0x14d5
-62779,	 // 0xf53b
- 2518,	 // 0x09d6
-63262,	 // 0xf71e
-  478,	 // 0x01de
-  280,	 // 0x0118
-  742,	 // 0x02e6
-62992,	 // 0xf610
- 2550,	 // 0x09f6
-64004,	 // 0xfa04
- 1533,	 // 0x05fd
-64256,	 // 0xfb00
-65281,	 // 0xff01
-65534,	 // 0xfffe
-65283,	 // 0xff03
-  512,	 // 0x0200
-65535,	 // 0xffff
- 4593,	 // 0x11f1
-63204,	 // 0xf6e4
-59935,	 // 0xea1f
- 7365,	 // 0x1cc5
-61013,	 // 0xee55
-  435,	 // 0x01b3
- 3401,	 // 0x0d49
-63156,	 // 0xf6b4
- 2613,	 // 0x0a35
-62939,	 // 0xf5db
-65052,	 // 0xfe1c
- 2544,	 // 0x09f0
-64776,	 // 0xfd08
- 1531,	 // 0x05fb
-64005,	 // 0xfa05
-65535,	 // 0xffff
-  766,	 // 0x02fe
-64259,	 // 0xfb03
- 1024,	 // 0x0400
-65023,	 // 0xfdff
-17921,	 // 0x4601
-60835,	 // 0xeda3
-60971,	 // 0xee2b
-63426,	 // 0xf7c2
- 2405,	 // 0x0965
-56210,	 // 0xdb92
-14178,	 // 0x3762
-53649,	 // 0xd191
- 7512,	 // 0x1d58
-58579,	 // 0xe4d3
- 2594,	 // 0x0a22
-  492,	 // 0x01ec
-    9,	 // 0x0009
-  505,	 // 0x01f9
-63750,	 // 0xf906
-  253,	 // 0x00fd
- 1278,	 // 0x04fe
-63746,	 // 0xf902
- 1790,	 // 0x06fe
-64512,	 // 0xfc00
-12821,	 // 0x3215
-57041,	 // 0xded1
- 9030,	 // 0x2346
-52425,	 // 0xccc9
-14931,	 // 0x3a53
-42908,	 // 0xa79c
-27976,	 // 0x6d48
-40098,	 // 0x9ca2
-14679,	 // 0x3957
-54489,	 // 0xd4d9
- 5143,	 // 0x1417
-63474,	 // 0xf7f2
- 1290,	 // 0x050a
-65019,	 // 0xfdfb
-64006,	 // 0xfa06
-  763,	 // 0x02fb
-  507,	 // 0x01fb
-64260,	 // 0xfb04
- 1021,	 // 0x03fd
-65279,	 // 0xfeff
- 7946,	 // 0x1f0a
-59945,	 // 0xea29
-16989,	 // 0x425d
-47317,	 // 0xb8d5
-22054,	 // 0x5626
-40408,	 // 0x9dd8
-32527,	 // 0x7f0f
-33501,	 // 0x82dd
-15917,	 // 0x3e2d
-54770,	 // 0xd5f2
- 5633,	 // 0x1601
-63486,	 // 0xf7fe
- 1539,	 // 0x0603
-65023,	 // 0xfdff
-65029,	 // 0xfe05
-  763,	 // 0x02fb
-65534,	 // 0xfffe
-65283,	 // 0xff03
-  511,	 // 0x01ff
-  512,	 // 0x0200
-19710,	 // 0x4cfe
- 2820,	 // 0x0b04
- 9545,	 // 0x2549
-53990,	 // 0xd2e6
-20236,	 // 0x4f0c
-45577,	 // 0xb209
-27887,	 // 0x6cef
-38398,	 // 0x95fe
-13586,	 // 0x3512
-58877,	 // 0xe5fd
- 5878,	 // 0x16f6
-62723,	 // 0xf503
- 2305,	 // 0x0901
-64260,	 // 0xfb04
- 1287,	 // 0x0507
-  767,	 // 0x02ff
-65535,	 // 0xffff
-  259,	 // 0x0103
-65535,	 // 0xffff
- 1023,	 // 0x03ff
- 4611,	 // 0x1203
- 3817,	 // 0x0ee9
- 5407,	 // 0x151f
-60148,	 // 0xeaf4
-15880,	 // 0x3e08
-52254,	 // 0xcc1e
-19172,	 // 0x4ae4
-47638,	 // 0xba16
- 9985,	 // 0x2701
-64001,	 // 0xfa01
- 3573,	 // 0x0df5
-63747,	 // 0xf903
- 1537,	 // 0x0601
-65031,	 // 0xfe07
-  770,	 // 0x0302
- 1025,	 // 0x0401
-65280,	 // 0xff00
-  773,	 // 0x0305
-  254,	 // 0x00fe
- 1022,	 // 0x03fe
- 4861,	 // 0x12fd
-65496,	 // 0xffd8
- 5400,	 // 0x1518
-60156,	 // 0xeafc
-12554,	 // 0x310a
-57367,	 // 0xe017
-10723,	 // 0x29e3
-55838,	 // 0xda1e
- 6907,	 // 0x1afb
- 1024,	 // 0x0400
- 1787,	 // 0x06fb
-  517,	 // 0x0205
-  768,	 // 0x0300
-    8,	 // 0x0008
-  770,	 // 0x0302
-  514,	 // 0x0202
-65024,	 // 0xfe00
-  515,	 // 0x0203
-65280,	 // 0xff00
- 1023,	 // 0x03ff
-  773,	 // 0x0305
-64726,	 // 0xfcd6
- 5141,	 // 0x1415
-60419,	 // 0xec03
- 8196,	 // 0x2004
-63498,	 // 0xf80a
- 5099,	 // 0x13eb
-60696,	 // 0xed18
- 4349,	 // 0x10fd
- 1025,	 // 0x0401
-65283,	 // 0xff03
- 1028,	 // 0x0404
-  513,	 // 0x0201
-   10,	 // 0x000a
-  515,	 // 0x0203
-  515,	 // 0x0203
-65280,	 // 0xff00
-  514,	 // 0x0202
-    0,	 // 0x0000
-    0,	 // 0x0000
-64244,	 // 0xfaf4
-56572,	 // 0xdcfc
- 6675,	 // 0x1a13
-60413,	 // 0xebfd
- 9199,	 // 0x23ef
- 4885,	 // 0x1315
-64737,	 // 0xfce1
-62758,	 // 0xf526
- 5876,	 // 0x16f4
-65284,	 // 0xff04
-65287,	 // 0xff07
-  518,	 // 0x0206
- 1282,	 // 0x0502
-65035,	 // 0xfe0b
-  771,	 // 0x0303
-  773,	 // 0x0305
-    1,	 // 0x0001
-  512,	 // 0x0200
-65024,	 // 0xfe00
-65282,	 // 0xff02
-  247,	 // 0x00f7
-63991,	 // 0xf9f7
-65020,	 // 0xfdfc
-  255,	 // 0x00ff
- 1027,	 // 0x0403
-65285,	 // 0xff05
-65275,	 // 0xfefb
-  255,	 // 0x00ff
-65022,	 // 0xfdfe
-65280,	 // 0xff00
-  510,	 // 0x01fe
-65535,	 // 0xffff
-  257,	 // 0x0101
-65535,	 // 0xffff
-    0,	 // 0x0000
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63737,	 // 0xf8f9
-64004,	 // 0xfa04
-65529,	 // 0xfff9
-  256,	 // 0x0100
-  769,	 // 0x0301
-65531,	 // 0xfffb
-  512,	 // 0x0200
-65534,	 // 0xfffe
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-62699,	 // 0xf4eb
-64514,	 // 0xfc02
-  761,	 // 0x02f9
-64513,	 // 0xfc01
- 1278,	 // 0x04fe
-65278,	 // 0xfefe
- 1026,	 // 0x0402
-  255,	 // 0x00ff
-  516,	 // 0x0204
-  511,	 // 0x01ff
-    2,	 // 0x0002
-  256,	 // 0x0100
-65281,	 // 0xff01
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-65261,	 // 0xfeed
- 4098,	 // 0x1002
- 1797,	 // 0x0705
-62206,	 // 0xf2fe
-65014,	 // 0xfdf6
-    1,	 // 0x0001
- 1284,	 // 0x0504
-  768,	 // 0x0300
-  771,	 // 0x0303
-  254,	 // 0x00fe
-  259,	 // 0x0103
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-65275,	 // 0xfefb
- 6923,	 // 0x1b0b
-65291,	 // 0xff0b
-60399,	 // 0xebef
-64757,	 // 0xfcf5
- 2055,	 // 0x0807
- 1285,	 // 0x0505
- 1277,	 // 0x04fd
-  257,	 // 0x0101
-65279,	 // 0xfeff
-  516,	 // 0x0204
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  257,	 // 0x0101
-    0,	 // 0x0000
-61176,	 // 0xeef8
- 2555,	 // 0x09fb
-62717,	 // 0xf4fd
-62439,	 // 0xf3e7
- 3334,	 // 0x0d06
- 3345,	 // 0x0d11
-64769,	 // 0xfd01
- 1272,	 // 0x04f8
-65532,	 // 0xfffc
-65028,	 // 0xfe04
-  260,	 // 0x0104
-65278,	 // 0xfefe
-  254,	 // 0x00fe
-65280,	 // 0xff00
-    0,	 // 0x0000
-65280,	 // 0xff00
-65280,	 // 0xff00
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
- 4599,	 // 0x11f7
-60665,	 // 0xecf9
-60398,	 // 0xebee
- 2541,	 // 0x09ed
- 7194,	 // 0x1c1a
- 2321,	 // 0x0911
-62201,	 // 0xf2f9
-  246,	 // 0x00f6
-  759,	 // 0x02f7
-65031,	 // 0xfe07
-65281,	 // 0xff01
-65278,	 // 0xfefe
-  254,	 // 0x00fe
-65281,	 // 0xff01
-65535,	 // 0xffff
-65024,	 // 0xfe00
-65535,	 // 0xffff
-  511,	 // 0x01ff
-65281,	 // 0xff01
-  255,	 // 0x00ff
-29991,	 // 0x7527
-56567,	 // 0xdcf7
-57056,	 // 0xdee0
- 4850,	 // 0x12f2
- 6178,	 // 0x1822
-  271,	 // 0x010f
-60659,	 // 0xecf3
-65529,	 // 0xfff9
- 1270,	 // 0x04f6
-65029,	 // 0xfe05
-65278,	 // 0xfefe
-65022,	 // 0xfdfe
-  511,	 // 0x01ff
-65282,	 // 0xff02
-65535,	 // 0xffff
-64768,	 // 0xfd00
-65025,	 // 0xfe01
-  256,	 // 0x0100
-65280,	 // 0xff00
-    0,	 // 0x0000
-32575,	 // 0x7f3f
-59124,	 // 0xe6f4
-58848,	 // 0xe5e0
- 3838,	 // 0x0efe
- 2071,	 // 0x0817
-64261,	 // 0xfb05
-62454,	 // 0xf3f6
-  512,	 // 0x0200
- 1274,	 // 0x04fa
-65025,	 // 0xfe01
-65532,	 // 0xfffc
-65024,	 // 0xfe00
-  256,	 // 0x0100
-65281,	 // 0xff01
-65280,	 // 0xff00
-65024,	 // 0xfe00
-65281,	 // 0xff01
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
- 1816,	 // 0x0718
-  505,	 // 0x01f9
-63223,	 // 0xf6f7
-  517,	 // 0x0205
-64518,	 // 0xfc06
-65024,	 // 0xfe00
-65533,	 // 0xfffd
-    2,	 // 0x0002
-  510,	 // 0x01fe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65025,	 // 0xfe01
-    0,	 // 0x0000
-65280,	 // 0xff00
-65535,	 // 0xffff
-65280,	 // 0xff00
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-45016,	 // 0xafd8
- 7930,	 // 0x1efa
- 2320,	 // 0x0910
-62453,	 // 0xf3f5
-62969,	 // 0xf5f9
-  252,	 // 0x00fc
- 2306,	 // 0x0902
-65023,	 // 0xfdff
-64769,	 // 0xfd01
- 1277,	 // 0x04fd
-  511,	 // 0x01ff
-65025,	 // 0xfe01
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-65535,	 // 0xffff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    7,	 // 0x0007
- 6387,	 // 0x18f3
-33031,	 // 0x8107
-23071,	 // 0x5a1f
-51680,	 // 0xc9e0
-12309,	 // 0x3015
-62955,	 // 0xf5eb
- 2318,	 // 0x090e
-63997,	 // 0xf9fd
- 1289,	 // 0x0509
-65015,	 // 0xfdf7
-64778,	 // 0xfd0a
-  253,	 // 0x00fd
-64772,	 // 0xfd04
-  256,	 // 0x0100
-65280,	 // 0xff00
-  258,	 // 0x0102
-  254,	 // 0x00fe
-    1,	 // 0x0001
-  256,	 // 0x0100
-65280,	 // 0xff00
- 3861,	 // 0x0f15
-  445,	 // 0x01bd
-63809,	 // 0xf941
-64187,	 // 0xfabb
-  572,	 // 0x023c
- 2778,	 // 0x0ada
-64784,	 // 0xfd10
- 1016,	 // 0x03f8
-65287,	 // 0xff07
- 1274,	 // 0x04fa
-64515,	 // 0xfc03
-  766,	 // 0x02fe
-64770,	 // 0xfd02
-  256,	 // 0x0100
-    1,	 // 0x0001
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
-  512,	 // 0x0200
-    0,	 // 0x0000
-63509,	 // 0xf815
-17616,	 // 0x44d0
-47414,	 // 0xb936
-11992,	 // 0x2ed8
-53805,	 // 0xd22d
- 5872,	 // 0x16f0
-61188,	 // 0xef04
- 1790,	 // 0x06fe
-64260,	 // 0xfb04
- 1790,	 // 0x06fe
-65023,	 // 0xfdff
-  512,	 // 0x0200
-65024,	 // 0xfe00
-    1,	 // 0x0001
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-65025,	 // 0xfe01
-  256,	 // 0x0100
-    0,	 // 0x0000
-57845,	 // 0xe1f5
-18706,	 // 0x4912
-47348,	 // 0xb8f4
-13332,	 // 0x3414
-54008,	 // 0xd2f8
- 3862,	 // 0x0f16
-61937,	 // 0xf1f1
- 1032,	 // 0x0408
-64766,	 // 0xfcfe
-  514,	 // 0x0202
-65533,	 // 0xfffd
-  513,	 // 0x0201
-65534,	 // 0xfffe
-65282,	 // 0xff02
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-65025,	 // 0xfe01
-    0,	 // 0x0000
-  255,	 // 0x00ff
-61929,	 // 0xf1e9
- 7716,	 // 0x1e24
-60117,	 // 0xead5
- 4647,	 // 0x1227
-62942,	 // 0xf5de
-  539,	 // 0x021b
-64748,	 // 0xfcec
-    9,	 // 0x0009
-65278,	 // 0xfefe
-    1,	 // 0x0001
-  254,	 // 0x00fe
-  514,	 // 0x0202
-  254,	 // 0x00fe
-65282,	 // 0xff02
-    0,	 // 0x0000
-  256,	 // 0x0100
-65281,	 // 0xff01
-65280,	 // 0xff00
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1294,	 // 0x050e
-61179,	 // 0xeefb
- 5098,	 // 0x13ea
-63247,	 // 0xf70f
- 1523,	 // 0x05f3
-65031,	 // 0xfe07
- 1016,	 // 0x03f8
-65026,	 // 0xfe02
-  258,	 // 0x0102
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  513,	 // 0x0201
-  510,	 // 0x01fe
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    6,	 // 0x0006
-61451,	 // 0xf00b
- 5119,	 // 0x13ff
-64770,	 // 0xfd02
-  765,	 // 0x02fd
-  767,	 // 0x02ff
-  766,	 // 0x02fe
-  511,	 // 0x01ff
-  257,	 // 0x0101
-  256,	 // 0x0100
-  512,	 // 0x0200
-  257,	 // 0x0101
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    1,	 // 0x0001
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  503,	 // 0x01f7
- 1797,	 // 0x0705
-  258,	 // 0x0102
- 1279,	 // 0x04ff
-65274,	 // 0xfefa
-  768,	 // 0x0300
-  256,	 // 0x0100
-  511,	 // 0x01ff
-  510,	 // 0x01fe
-65280,	 // 0xff00
-  256,	 // 0x0100
-  255,	 // 0x00ff
-  256,	 // 0x0100
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
- 1025,	 // 0x0401
- 2301,	 // 0x08fd
-64764,	 // 0xfcfc
-  256,	 // 0x0100
-  254,	 // 0x00fe
-  256,	 // 0x0100
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65281,	 // 0xff01
-  255,	 // 0x00ff
-  255,	 // 0x00ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
- 1797,	 // 0x0705
-  508,	 // 0x01fc
-65020,	 // 0xfdfc
-64768,	 // 0xfd00
-  768,	 // 0x0300
-    0,	 // 0x0000
-65281,	 // 0xff01
-  511,	 // 0x01ff
-  255,	 // 0x00ff
-65280,	 // 0xff00
-65535,	 // 0xffff
-    0,	 // 0x0000
-  511,	 // 0x01ff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-63224,	 // 0xf6f8
-62725,	 // 0xf505
- 1534,	 // 0x05fe
-64513,	 // 0xfc01
- 1535,	 // 0x05ff
-65281,	 // 0xff01
-    1,	 // 0x0001
-    0,	 // 0x0000
-  511,	 // 0x01ff
-65281,	 // 0xff01
-65281,	 // 0xff01
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-  241,	 // 0x00f1
- 9458,	 // 0x24f2
- 2304,	 // 0x0900
-63996,	 // 0xf9fc
-63999,	 // 0xf9ff
-65534,	 // 0xfffe
-65290,	 // 0xff0a
- 1271,	 // 0x04f7
-64777,	 // 0xfd09
-65534,	 // 0xfffe
-  508,	 // 0x01fc
-65532,	 // 0xfffc
-64770,	 // 0xfd02
-65535,	 // 0xffff
-    0,	 // 0x0000
-65278,	 // 0xfefe
-  257,	 // 0x0101
-  255,	 // 0x00ff
-    1,	 // 0x0001
-    0,	 // 0x0000
-  256,	 // 0x0100
-58879,	 // 0xe5ff
-61714,	 // 0xf112
-64513,	 // 0xfc01
- 3582,	 // 0x0dfe
-61702,	 // 0xf106
-  771,	 // 0x0303
-64767,	 // 0xfcff
-    1,	 // 0x0001
-65535,	 // 0xffff
-65534,	 // 0xfffe
-65535,	 // 0xffff
-65281,	 // 0xff01
-  510,	 // 0x01fe
-  767,	 // 0x02ff
-65535,	 // 0xffff
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  256,	 // 0x0100
-65535,	 // 0xffff
-56061,	 // 0xdafd
-59687,	 // 0xe927
-64754,	 // 0xfcf2
- 9469,	 // 0x24fd
-57872,	 // 0xe210
- 1022,	 // 0x03fe
-64272,	 // 0xfb10
-65529,	 // 0xfff9
-  513,	 // 0x0201
-64260,	 // 0xfb04
-  511,	 // 0x01ff
-    0,	 // 0x0000
-  765,	 // 0x02fd
-  510,	 // 0x01fe
-65280,	 // 0xff00
-65281,	 // 0xff01
-  256,	 // 0x0100
-65024,	 // 0xfe00
-    1,	 // 0x0001
-65280,	 // 0xff00
-60914,	 // 0xedf2
- 1293,	 // 0x050d
-62190,	 // 0xf2ee
-12013,	 // 0x2eed
-58926,	 // 0xe62e
-63464,	 // 0xf7e8
- 3100,	 // 0x0c1c
-62961,	 // 0xf5f1
- 2049,	 // 0x0801
-63497,	 // 0xf809
- 1276,	 // 0x04fc
-  768,	 // 0x0300
-65533,	 // 0xfffd
-  254,	 // 0x00fe
-65282,	 // 0xff02
-  253,	 // 0x00fd
-    1,	 // 0x0001
-65025,	 // 0xfe01
-    0,	 // 0x0000
-  256,	 // 0x0100
-59643,	 // 0xe8fb
-18150,	 // 0x46e6
-58377,	 // 0xe409
- 2252,	 // 0x08cc
- 6230,	 // 0x1856
-53713,	 // 0xd1d1
-11529,	 // 0x2d09
-57598,	 // 0xe0fe
- 4083,	 // 0x0ff3
-64270,	 // 0xfb0e
-  501,	 // 0x01f5
- 1277,	 // 0x04fd
-    1,	 // 0x0001
-  252,	 // 0x00fc
-    2,	 // 0x0002
-65532,	 // 0xfffc
-  255,	 // 0x00ff
-    2,	 // 0x0002
-  253,	 // 0x00fd
-  513,	 // 0x0201
-61450,	 // 0xf00a
-17357,	 // 0x43cd
- 1082,	 // 0x043a
-46015,	 // 0xb3bf
-26172,	 // 0x663c
-45561,	 // 0xb1f9
-13765,	 // 0x35c5
-56630,	 // 0xdd36
- 2262,	 // 0x08d6
- 2070,	 // 0x0816
-63988,	 // 0xf9f4
- 1277,	 // 0x04fd
-    6,	 // 0x0006
-65022,	 // 0xfdfe
-  767,	 // 0x02ff
-  512,	 // 0x0200
-65278,	 // 0xfefe
-  514,	 // 0x0202
-65533,	 // 0xfffd
-  512,	 // 0x0200
- 5398,	 // 0x1516
-63158,	 // 0xf6b6
-14385,	 // 0x3831
-33262,	 // 0x81ee
-29916,	 // 0x74dc
-56652,	 // 0xdd4c
-  149,	 // 0x0095
- 4943,	 // 0x134f
-61653,	 // 0xf0d5
- 3599,	 // 0x0e0f
-64509,	 // 0xfbfd
-65277,	 // 0xfefd
-  770,	 // 0x0302
-65285,	 // 0xff05
-  508,	 // 0x01fc
- 1283,	 // 0x0503
-64253,	 // 0xfafd
- 1279,	 // 0x04ff
-64768,	 // 0xfd00
-  256,	 // 0x0100
-20501,	 // 0x5015
-49876,	 // 0xc2d4
-20233,	 // 0x4f09
-46389,	 // 0xb535
- 8349,	 // 0x209d
-11872,	 // 0x2e60
-48565,	 // 0xbdb5
-14117,	 // 0x3725
-59122,	 // 0xe6f2
- 3845,	 // 0x0f05
-64766,	 // 0xfcfe
-  514,	 // 0x0202
-64765,	 // 0xfcfd
-  773,	 // 0x0305
-65021,	 // 0xfdfd
- 1280,	 // 0x0500
-64513,	 // 0xfc01
-  766,	 // 0x02fe
-65026,	 // 0xfe02
-    0,	 // 0x0000
- 4109,	 // 0x100d
-49919,	 // 0xc2ff
-14329,	 // 0x37f9
- 2107,	 // 0x083b
-53438,	 // 0xd0be
-19499,	 // 0x4c2b
-47103,	 // 0xb7ff
-12527,	 // 0x30ef
-61193,	 // 0xef09
- 2811,	 // 0x0afb
-65025,	 // 0xfe01
-  767,	 // 0x02ff
-65025,	 // 0xfe01
-  769,	 // 0x0301
-65024,	 // 0xfe00
-    0,	 // 0x0000
-65026,	 // 0xfe02
-65534,	 // 0xfffe
-    0,	 // 0x0000
-64768,	 // 0xfd00
- 3325,	 // 0x0cfd
-59902,	 // 0xe9fe
- 2559,	 // 0x09ff
- 8724,	 // 0x2214
-52461,	 // 0xcced
-12799,	 // 0x31ff
-56349,	 // 0xdc1d
- 5859,	 // 0x16e3
-64264,	 // 0xfb08
- 1788,	 // 0x06fc
-65024,	 // 0xfe00
-  510,	 // 0x01fe
-65281,	 // 0xff01
-  512,	 // 0x0200
-    1,	 // 0x0001
-65535,	 // 0xffff
-  258,	 // 0x0102
-65534,	 // 0xfffe
-    1,	 // 0x0001
-65280,	 // 0xff00
- 4584,	 // 0x11e8
-  556,	 // 0x022c
-54493,	 // 0xd4dd
-14862,	 // 0x3a0e
-56330,	 // 0xdc0a
- 6384,	 // 0x18f0
-61732,	 // 0xf124
- 1758,	 // 0x06de
-64512,	 // 0xfc00
-  513,	 // 0x0201
-65534,	 // 0xfffe
-    1,	 // 0x0001
-  511,	 // 0x01ff
-  513,	 // 0x0201
-    3,	 // 0x0003
-65023,	 // 0xfdff
-  515,	 // 0x0203
-65024,	 // 0xfe00
-    1,	 // 0x0001
-65280,	 // 0xff00
-  225,	 // 0x00e1
- 6102,	 // 0x17d6
-42546,	 // 0xa632
-16318,	 // 0x3fbe
-64829,	 // 0xfd3d
-54718,	 // 0xd5be
-14375,	 // 0x3827
-54025,	 // 0xd309
- 8180,	 // 0x1ff4
-62456,	 // 0xf3f8
- 2045,	 // 0x07fd
-64768,	 // 0xfd00
-65281,	 // 0xff01
-65532,	 // 0xfffc
- 1024,	 // 0x0400
-65280,	 // 0xff00
-  770,	 // 0x0302
-64770,	 // 0xfd02
-  255,	 // 0x00ff
-  258,	 // 0x0102
-    0,	 // 0x0000
-14097,	 // 0x3711
-40423,	 // 0x9de7
-24315,	 // 0x5efb
-53298,	 // 0xd032
-65198,	 // 0xfeae
-14670,	 // 0x394e
-49889,	 // 0xc2e1
-10759,	 // 0x2a07
-61177,	 // 0xeef9
- 4607,	 // 0x11ff
-63995,	 // 0xf9fb
-  772,	 // 0x0304
-65276,	 // 0xfefc
- 1285,	 // 0x0505
-65277,	 // 0xfefd
- 1537,	 // 0x0601
-64257,	 // 0xfb01
-  257,	 // 0x0101
-65282,	 // 0xff02
-  256,	 // 0x0100
-32536,	 // 0x7f18
-43188,	 // 0xa8b4
-28230,	 // 0x6e46
-35072,	 // 0x8900
-18628,	 // 0x48c4
- 4205,	 // 0x106d
-52129,	 // 0xcba1
-11572,	 // 0x2d34
-59878,	 // 0xe9e6
- 5643,	 // 0x160b
-63734,	 // 0xf8f6
-    4,	 // 0x0004
- 1022,	 // 0x03fe
-65289,	 // 0xff09
-  762,	 // 0x02fa
- 1540,	 // 0x0604
-64255,	 // 0xfaff
-  515,	 // 0x0203
-65027,	 // 0xfe03
-  512,	 // 0x0200
-20781,	 // 0x512d
-61079,	 // 0xee97
-15213,	 // 0x3b6d
-34747,	 // 0x87bb
-32279,	 // 0x7e17
-51774,	 // 0xca3e
- 1177,	 // 0x0499
- 3147,	 // 0x0c4b
-64204,	 // 0xfacc
- 2585,	 // 0x0a19
-64502,	 // 0xfbf6
-64512,	 // 0xfc00
- 1796,	 // 0x0704
-64006,	 // 0xfa06
- 1535,	 // 0x05ff
-  514,	 // 0x0202
-64511,	 // 0xfbff
- 1026,	 // 0x0402
-65023,	 // 0xfdff
- 1024,	 // 0x0400
-59408,	 // 0xe810
-18627,	 // 0x48c3
-63034,	 // 0xf63a
-52918,	 // 0xceb6
-24902,	 // 0x6146
-46836,	 // 0xb6f4
-12502,	 // 0x30d6
-57899,	 // 0xe22b
- 5582,	 // 0x15ce
-64030,	 // 0xfa1e
-  238,	 // 0x00ee
-  262,	 // 0x0106
- 1280,	 // 0x0500
-65280,	 // 0xff00
-  513,	 // 0x0201
-  766,	 // 0x02fe
-65026,	 // 0xfe02
-  257,	 // 0x0101
-65533,	 // 0xfffd
- 1279,	 // 0x04ff
-52737,	 // 0xce01
-12546,	 // 0x3102
-65041,	 // 0xfe11
-62682,	 // 0xf4da
- 8747,	 // 0x222b
-57571,	 // 0xe0e3
- 6146,	 // 0x1802
-60421,	 // 0xec05
- 5357,	 // 0x14ed
-62474,	 // 0xf40a
- 2296,	 // 0x08f8
-65025,	 // 0xfe01
- 1792,	 // 0x0700
-65533,	 // 0xfffd
-65282,	 // 0xff02
-  510,	 // 0x01fe
-65025,	 // 0xfe01
-65277,	 // 0xfefd
-    0,	 // 0x0000
-65535,	 // 0xffff
-63990,	 // 0xf9f6
-63494,	 // 0xf806
- 5396,	 // 0x1514
- 1004,	 // 0x03ec
-  786,	 // 0x0312
-64755,	 // 0xfcf3
- 1808,	 // 0x0710
-64240,	 // 0xfaf0
- 2815,	 // 0x0aff
-62977,	 // 0xf601
- 2301,	 // 0x08fd
-64765,	 // 0xfcfd
- 1792,	 // 0x0700
-  762,	 // 0x02fa
-    0,	 // 0x0000
-  255,	 // 0x00ff
-  257,	 // 0x0101
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-    0,	 // 0x0000
-58364,	 // 0xe3fc
-65252,	 // 0xfee4
-  271,	 // 0x010f
- 1263,	 // 0x04ef
-64018,	 // 0xfa12
-  757,	 // 0x02f5
- 1560,	 // 0x0618
-65255,	 // 0xfee7
- 1031,	 // 0x0407
-63999,	 // 0xf9ff
- 1534,	 // 0x05fe
-64509,	 // 0xfbfd
-  768,	 // 0x0300
-  250,	 // 0x00fa
-65024,	 // 0xfe00
-  255,	 // 0x00ff
-  511,	 // 0x01ff
-65278,	 // 0xfefe
-  510,	 // 0x01fe
-65535,	 // 0xffff
-55290,	 // 0xd7fa
- 7925,	 // 0x1ef5
-60675,	 // 0xed03
-  755,	 // 0x02f3
-65291,	 // 0xff0b
-65523,	 // 0xfff3
-  782,	 // 0x030e
-  239,	 // 0x00ef
-63495,	 // 0xf807
-  511,	 // 0x01ff
-  509,	 // 0x01fd
-65276,	 // 0xfefc
-    1,	 // 0x0001
-  251,	 // 0x00fb
-65279,	 // 0xfeff
-  510,	 // 0x01fe
-65534,	 // 0xfffe
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-60405,	 // 0xebf5
- 6131,	 // 0x17f3
-61947,	 // 0xf1fb
- 2812,	 // 0x0afc
-65286,	 // 0xff06
-63991,	 // 0xf9f7
-  767,	 // 0x02ff
-64760,	 // 0xfcf8
-64004,	 // 0xfa04
- 1535,	 // 0x05ff
-65018,	 // 0xfdfa
-65024,	 // 0xfe00
-65534,	 // 0xfffe
-  507,	 // 0x01fb
-65021,	 // 0xfdfd
-65534,	 // 0xfffe
-  254,	 // 0x00fe
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  255,	 // 0x00ff
-65001,	 // 0xfde9
- 6154,	 // 0x180a
-61407,	 // 0xefdf
- 6142,	 // 0x17fe
-64261,	 // 0xfb05
-61931,	 // 0xf1eb
- 2557,	 // 0x09fd
-63226,	 // 0xf6fa
-64514,	 // 0xfc02
- 1786,	 // 0x06fa
-64758,	 // 0xfcf6
-65282,	 // 0xff02
-65533,	 // 0xfffd
-  507,	 // 0x01fb
-65275,	 // 0xfefb
-65534,	 // 0xfffe
-  508,	 // 0x01fc
-  511,	 // 0x01ff
-65280,	 // 0xff00
-    0,	 // 0x0000
-  222,	 // 0x00de
- 3331,	 // 0x0d03
- 1824,	 // 0x0720
-57254,	 // 0xdfa6
- 2044,	 // 0x07fc
- 5462,	 // 0x1556
-63480,	 // 0xf7f8
-10261,	 // 0x2815
-  311,	 // 0x0137
- 4993,	 // 0x1381
-10748,	 // 0x29fc
- 6632,	 // 0x19e8
- 6647,	 // 0x19f7
-28206,	 // 0x6e2e
- 1264,	 // 0x04f0
-11289,	 // 0x2c19
-46581,	 // 0xb5f5
-56811,	 // 0xddeb
- 5066,	 // 0x13ca
- 1015,	 // 0x03f7
-29440,	 // 0x7300
-57919,	 // 0xe23f
- 1544,	 // 0x0608
- 6986,	 // 0x1b4a
- 1531,	 // 0x05fb
-61453,	 // 0xf00d
-19656,	 // 0x4cc8
-52025,	 // 0xcb39
- 4859,	 // 0x12fb
-46555,	 // 0xb5db
-22257,	 // 0x56f1
-64786,	 // 0xfd12
-48935,	 // 0xbf27
-62505,	 // 0xf429
-55820,	 // 0xda0c
-65523,	 // 0xfff3
-65175,	 // 0xfe97
-64495,	 // 0xfbef
-64502,	 // 0xfbf6
-60403,	 // 0xebf3
-60165,	 // 0xeb05
-60696,	 // 0xed18
- 4612,	 // 0x1204
- 1057,	 // 0x0421
- 5159,	 // 0x1427
-65067,	 // 0xfe2b
- 1796,	 // 0x0704
- 8705,	 // 0x2201
-65260,	 // 0xfeec
-65527,	 // 0xfff7
-63495,	 // 0xf807
-64771,	 // 0xfd03
-63233,	 // 0xf701
-61720,	 // 0xf118
-  253,	 // 0x00fd
-57336,	 // 0xdff8
-64515,	 // 0xfc03
-13312,	 // 0x3400
-  769,	 // 0x0301
-65520,	 // 0xfff0
-  764,	 // 0x02fc
-63316,	 // 0xf754
-63392,	 // 0xf7a0
-  641,	 // 0x0281
-  814,	 // 0x032e
- 1797,	 // 0x0705
-   16,	 // 0x0010
-    1,	 // 0x0001
-63736,	 // 0xf8f8
- 3072,	 // 0x0c00
-  575,	 // 0x023f
-63714,	 // 0xf8e2
-10486,	 // 0x28f6
-63994,	 // 0xf9fa
- 1025,	 // 0x0401
-64207,	 // 0xfacf
- 2595,	 // 0x0a23
-  259,	 // 0x0103
-65288,	 // 0xff08
-62729,	 // 0xf509
- 5639,	 // 0x1607
-65023,	 // 0xfdff
-64754,	 // 0xfcf2
-  251,	 // 0x00fb
-64756,	 // 0xfcf4
-  514,	 // 0x0202
-52736,	 // 0xce00
-  249,	 // 0x00f9
-17410,	 // 0x4402
-51728,	 // 0xca10
-49914,	 // 0xc2fa
- 4071,	 // 0x0fe7
-57105,	 // 0xdf11
-63464,	 // 0xf7e8
-   18,	 // 0x0012
- 4881,	 // 0x1311
-57620,	 // 0xe114
-12507,	 // 0x30db
-14538,	 // 0x38ca
-15599,	 // 0x3cef
-52189,	 // 0xcbdd
-60688,	 // 0xed10
-63737,	 // 0xf8f9
-32547,	 // 0x7f23
-63120,	 // 0xf690
-61910,	 // 0xf1d6
-56134,	 // 0xdb46
-59612,	 // 0xe8dc
-18753,	 // 0x4941
-57180,	 // 0xdf5c
-54300,	 // 0xd41c
-60394,	 // 0xebea
-  188,	 // 0x00bc
-13780,	 // 0x35d4
- 7851,	 // 0x1eab
- 1494,	 // 0x05d6
- 2504,	 // 0x09c8
-59073,	 // 0xe6c1
-40943,	 // 0x9fef
-62282,	 // 0xf34a
-58039,	 // 0xe2b7
-14032,	 // 0x36d0
-58424,	 // 0xe438
- 4094,	 // 0x0ffe
-57822,	 // 0xe1de
-55565,	 // 0xd90d
-13598,	 // 0x351e
- 2039,	 // 0x07f7
- 2078,	 // 0x081e
-60153,	 // 0xeaf9
-44766,	 // 0xaede
-56572,	 // 0xdcfc
-60644,	 // 0xece4
- 4600,	 // 0x11f8
- 1578,	 // 0x062a
-65030,	 // 0xfe06
-61938,	 // 0xf1f2
- 9198,	 // 0x23ee
-59852,	 // 0xe9cc
-65037,	 // 0xfe0d
- 7155,	 // 0x1bf3
- 1523,	 // 0x05f3
-65026,	 // 0xfe02
- 9476,	 // 0x2504
- 3078,	 // 0x0c06
-59176,	 // 0xe728
- 6659,	 // 0x1a03
- 1575,	 // 0x0627
-61431,	 // 0xeff7
- 6321,	 // 0x18b1
-  795,	 // 0x031b
- 6213,	 // 0x1845
-61055,	 // 0xee7f
- 2318,	 // 0x090e
-58443,	 // 0xe44b
-61444,	 // 0xf004
- 1776,	 // 0x06f0
-61156,	 // 0xeee4
- 2588,	 // 0x0a1c
-22291,	 // 0x5713
- 4101,	 // 0x1005
- 3567,	 // 0x0def
-61701,	 // 0xf105
- 1068,	 // 0x042c
-13059,	 // 0x3303
- 1312,	 // 0x0520
-63286,	 // 0xf736
- 1273,	 // 0x04f9
-65006,	 // 0xfdee
-62694,	 // 0xf4e6
- 9480,	 // 0x2508
-61967,	 // 0xf20f
-64267,	 // 0xfb0b
-64750,	 // 0xfcee
- 2299,	 // 0x08fb
-64514,	 // 0xfc02
-16096,	 // 0x3ee0
-64068,	 // 0xfa44
-62698,	 // 0xf4ea
-15682,	 // 0x3d42
-59263,	 // 0xe77f
- 4836,	 // 0x12e4
- 1763,	 // 0x06e3
-64780,	 // 0xfd0c
-13312,	 // 0x3400
-39910,	 // 0x9be6
-62985,	 // 0xf609
-52459,	 // 0xcceb
-18180,	 // 0x4704
-51938,	 // 0xcae2
- 2822,	 // 0x0b06
-64418,	 // 0xfba2
-  470,	 // 0x01d6
-49703,	 // 0xc227
- 1817,	 // 0x0719
- 3803,	 // 0x0edb
-61431,	 // 0xeff7
-10244,	 // 0x2804
-63482,	 // 0xf7fa
-61217,	 // 0xef21
-62969,	 // 0xf5f9
-40971,	 // 0xa00b
-48318,	 // 0xbcbe
- 1307,	 // 0x051b
-57086,	 // 0xdefe
-56821,	 // 0xddf5
-55294,	 // 0xd7fe
-63843,	 // 0xf963
- 5344,	 // 0x14e0
-40408,	 // 0x9dd8
-13786,	 // 0x35da
- 1279,	 // 0x04ff
- 3586,	 // 0x0e02
- 1034,	 // 0x040a
-33436,	 // 0x829c
- 3064,	 // 0x0bf8
-   17,	 // 0x0011
- 1259,	 // 0x04eb
- 3883,	 // 0x0f2b
-65534,	 // 0xfffe
- 7966,	 // 0x1f1e
-49702,	 // 0xc226
- 1789,	 // 0x06fd
-17650,	 // 0x44f2
- 1011,	 // 0x03f3
-64690,	 // 0xfcb2
-  535,	 // 0x0217
-63215,	 // 0xf6ef
-32513,	 // 0x7f01
-18959,	 // 0x4a0f
- 3078,	 // 0x0c06
- 1546,	 // 0x060a
-62719,	 // 0xf4ff
- 1769,	 // 0x06e9
-64537,	 // 0xfc19
-56325,	 // 0xdc05
- 5075,	 // 0x13d3
- 4384,	 // 0x1120
-64398,	 // 0xfb8e
- 2585,	 // 0x0a19
-14067,	 // 0x36f3
-  275,	 // 0x0113
- 6885,	 // 0x1ae5
-  498,	 // 0x01f2
-  767,	 // 0x02ff
-59647,	 // 0xe8ff
- 3734,	 // 0x0e96
-  738,	 // 0x02e2
-60936,	 // 0xee08
- 9464,	 // 0x24f8
- 9448,	 // 0x24e8
- 2003,	 // 0x07d3
- 1852,	 // 0x073c
- 6867,	 // 0x1ad3
- 3035,	 // 0x0bdb
- 2305,	 // 0x0901
-47411,	 // 0xb933
-62979,	 // 0xf603
- 7455,	 // 0x1d1f
- 2831,	 // 0x0b0f
-60657,	 // 0xecf1
-  777,	 // 0x0309
-51470,	 // 0xc90e
- 2562,	 // 0x0a02
-16138,	 // 0x3f0a
-  988,	 // 0x03dc
- 2304,	 // 0x0900
-58112,	 // 0xe300
-62727,	 // 0xf507
- 1775,	 // 0x06ef
- 1060,	 // 0x0424
-63494,	 // 0xf806
- 5377,	 // 0x1501
-44559,	 // 0xae0f
-63240,	 // 0xf708
-33030,	 // 0x8106
- 4102,	 // 0x1006
- 2819,	 // 0x0b03
- 3586,	 // 0x0e02
-56593,	 // 0xdd11
-65019,	 // 0xfdfb
-   20,	 // 0x0014
-63766,	 // 0xf916
- 5386,	 // 0x150a
- 2815,	 // 0x0aff
-64510,	 // 0xfbfe
-60162,	 // 0xeb02
-61697,	 // 0xf101
- 1265,	 // 0x04f1
-64992,	 // 0xfde0
-63741,	 // 0xf8fd
-60411,	 // 0xebfb
-61185,	 // 0xef01
- 4856,	 // 0x12f8
-64249,	 // 0xfaf9
- 1279,	 // 0x04ff
- 2576,	 // 0x0a10
-65008,	 // 0xfdf0
- 4345,	 // 0x10f9
- 1282,	 // 0x0502
- 1546,	 // 0x060a
-  766,	 // 0x02fe
-  729,	 // 0x02d9
- 4381,	 // 0x111d
-64770,	 // 0xfd02
-65245,	 // 0xfedd
- 1805,	 // 0x070d
-65246,	 // 0xfede
-15843,	 // 0x3de3
-65507,	 // 0xffe3
-59910,	 // 0xea06
-62778,	 // 0xf53a
-61977,	 // 0xf219
-64722,	 // 0xfcd2
- 4350,	 // 0x10fe
-63483,	 // 0xf7fb
- 3557,	 // 0x0de5
- 5153,	 // 0x1421
-64247,	 // 0xfaf7
- 6114,	 // 0x17e2
- 5886,	 // 0x16fe
-58618,	 // 0xe4fa
-65278,	 // 0xfefe
- 2309,	 // 0x0905
- 1295,	 // 0x050f
- 5061,	 // 0x13c5
-64330,	 // 0xfb4a
- 6911,	 // 0x1aff
- 6443,	 // 0x192b
-52503,	 // 0xcd17
- 1039,	 // 0x040f
-60897,	 // 0xede1
-64279,	 // 0xfb17
-62476,	 // 0xf40c
-   20,	 // 0x0014
- 3557,	 // 0x0de5
- 8174,	 // 0x1fee
- 5640,	 // 0x1608
-12532,	 // 0x30f4
- 3822,	 // 0x0eee
-58119,	 // 0xe307
- 5757,	 // 0x167d
-62224,	 // 0xf310
-64003,	 // 0xfa03
- 1790,	 // 0x06fe
- 2040,	 // 0x07f8
- 4624,	 // 0x1210
-  753,	 // 0x02f1
- 1294,	 // 0x050e
-65527,	 // 0xfff7
-38197,	 // 0x9535
-63740,	 // 0xf8fc
-33042,	 // 0x8112
-44981,	 // 0xafb5
- 2558,	 // 0x09fe
-15102,	 // 0x3afe
-65253,	 // 0xfee5
-61695,	 // 0xf0ff
- 3022,	 // 0x0bce
- 7144,	 // 0x1be8
- 2563,	 // 0x0a03
-47905,	 // 0xbb21
-62003,	 // 0xf233
-50930,	 // 0xc6f2
-62967,	 // 0xf5f7
-15349,	 // 0x3bf5
-65288,	 // 0xff08
-11066,	 // 0x2b3a
- 3324,	 // 0x0cfc
- 3390,	 // 0x0d3e
- 1079,	 // 0x0437
-64479,	 // 0xfbdf
- 9817,	 // 0x2659
-64895,	 // 0xfd7f
-64482,	 // 0xfbe2
-57078,	 // 0xdef6
- 2555,	 // 0x09fb
- 3077,	 // 0x0c05
-15350,	 // 0x3bf6
- 2532,	 // 0x09e4
-60420,	 // 0xec04
-58118,	 // 0xe306
-44271,	 // 0xacef
- 4909,	 // 0x132d
- 1556,	 // 0x0614
- 2734,	 // 0x0aae
-60425,	 // 0xec09
-59863,	 // 0xe9d7
- 3335,	 // 0x0d07
-59904,	 // 0xea00
-64500,	 // 0xfbf4
-60931,	 // 0xee03
-10467,	 // 0x28e3
- 2267,	 // 0x08db
-64502,	 // 0xfbf6
- 4837,	 // 0x12e5
- 2827,	 // 0x0b0b
-52959,	 // 0xcedf
- 3329,	 // 0x0d01
-57860,	 // 0xe204
- 2289,	 // 0x08f1
-  506,	 // 0x01fa
-    2,	 // 0x0002
-63989,	 // 0xf9f5
-57303,	 // 0xdfd7
- 4865,	 // 0x1301
-62482,	 // 0xf412
- 6393,	 // 0x18f9
- 3080,	 // 0x0c08
-62981,	 // 0xf605
- 1284,	 // 0x0504
- 5348,	 // 0x14e4
-61358,	 // 0xefae
- 2396,	 // 0x095c
- 2255,	 // 0x08cf
-  274,	 // 0x0112
-57840,	 // 0xe1f0
-62982,	 // 0xf606
- 1278,	 // 0x04fe
-  771,	 // 0x0303
- 3578,	 // 0x0dfa
-62985,	 // 0xf609
-58306,	 // 0xe3c2
- 3847,	 // 0x0f07
-64784,	 // 0xfd10
-62956,	 // 0xf5ec
-62715,	 // 0xf4fb
-62919,	 // 0xf5c7
-63735,	 // 0xf8f7
-56880,	 // 0xde30
- 1318,	 // 0x0526
-63239,	 // 0xf707
-53990,	 // 0xd2e6
-  255,	 // 0x00ff
-61702,	 // 0xf106
- 1023,	 // 0x03ff
-21998,	 // 0x55ee
- 1282,	 // 0x0502
-59652,	 // 0xe904
- 2043,	 // 0x07fb
-32514,	 // 0x7f02
- 1833,	 // 0x0729
-64260,	 // 0xfb04
-  766,	 // 0x02fe
-64022,	 // 0xfa16
- 1790,	 // 0x06fe
-  788,	 // 0x0314
-    6,	 // 0x0006
- 4871,	 // 0x1307
-40444,	 // 0x9dfc
- 3583,	 // 0x0dff
-41479,	 // 0xa207
- 2303,	 // 0x08ff
- 2807,	 // 0x0af7
- 3586,	 // 0x0e02
-59393,	 // 0xe801
-61953,	 // 0xf201
- 5633,	 // 0x1601
-65243,	 // 0xfedb
-61199,	 // 0xef0f
-62495,	 // 0xf41f
- 5630,	 // 0x15fe
-64004,	 // 0xfa04
-64014,	 // 0xfa0e
- 1536,	 // 0x0600
-60191,	 // 0xeb1f
-65025,	 // 0xfe01
-  513,	 // 0x0201
-64257,	 // 0xfb01
-55810,	 // 0xda02
-65026,	 // 0xfe02
-  273,	 // 0x0111
-58119,	 // 0xe307
-55783,	 // 0xd9e7
-  502,	 // 0x01f6
- 2818,	 // 0x0b02
-63982,	 // 0xf9ee
-63739,	 // 0xf8fb
-61689,	 // 0xf0f9
- 1524,	 // 0x05f4
-63484,	 // 0xf7fc
-  270,	 // 0x010e
-63745,	 // 0xf901
-62742,	 // 0xf516
-32530,	 // 0x7f12
- 3346,	 // 0x0d12
-63711,	 // 0xf8df
-63746,	 // 0xf902
- 5368,	 // 0x14f8
-  262,	 // 0x0106
- 2850,	 // 0x0b22
-58153,	 // 0xe329
-64768,	 // 0xfd00
- 2553,	 // 0x09f9
- 1785,	 // 0x06f9
-61700,	 // 0xf104
-61711,	 // 0xf10f
-57892,	 // 0xe224
-63744,	 // 0xf900
- 8471,	 // 0x2117
-13816,	 // 0x35f8
- 9238,	 // 0x2416
- 3827,	 // 0x0ef3
- 4095,	 // 0x0fff
-59141,	 // 0xe705
-64545,	 // 0xfc21
- 5144,	 // 0x1418
- 3822,	 // 0x0eee
-64784,	 // 0xfd10
- 3330,	 // 0x0d02
- 1803,	 // 0x070b
-12532,	 // 0x30f4
- 4364,	 // 0x110c
-  527,	 // 0x020f
-64289,	 // 0xfb21
- 2295,	 // 0x08f7
-64243,	 // 0xfaf3
-64042,	 // 0xfa2a
- 1023,	 // 0x03ff
- 5886,	 // 0x16fe
- 2075,	 // 0x081b
-64279,	 // 0xfb17
- 6409,	 // 0x1909
- 2826,	 // 0x0b0a
- 3546,	 // 0x0dda
- 2313,	 // 0x0909
-58882,	 // 0xe602
-64781,	 // 0xfd0d
-33026,	 // 0x8102
-65244,	 // 0xfedc
- 1275,	 // 0x04fb
-10729,	 // 0x29e9
-58774,	 // 0xe596
-63294,	 // 0xf73e
- 2862,	 // 0x0b2e
-16070,	 // 0x3ec6
-40965,	 // 0xa005
-52466,	 // 0xccf2
- 2069,	 // 0x0815
-59145,	 // 0xe709
-64499,	 // 0xfbf3
-65305,	 // 0xff19
- 5126,	 // 0x1406
-52502,	 // 0xcd16
- 1571,	 // 0x0623
-47650,	 // 0xba22
- 1796,	 // 0x0704
-56892,	 // 0xde3c
-45087,	 // 0xb01f
- 5114,	 // 0x13fa
- 4631,	 // 0x1217
- 2321,	 // 0x0911
- 1046,	 // 0x0416
-25298,	 // 0x62d2
-64523,	 // 0xfc0b
-  756,	 // 0x02f4
-55793,	 // 0xd9f1
-55304,	 // 0xd808
-  479,	 // 0x01df
- 2724,	 // 0x0aa4
-22102,	 // 0x5656
-26371,	 // 0x6703
-62685,	 // 0xf4dd
- 1790,	 // 0x06fe
- 3319,	 // 0x0cf7
- 8198,	 // 0x2006
-52992,	 // 0xcf00
- 2553,	 // 0x09f9
-65037,	 // 0xfe0d
-59871,	 // 0xe9df
-63470,	 // 0xf7ee
-60887,	 // 0xedd7
-32726,	 // 0x7fd6
- 5408,	 // 0x1520
-61432,	 // 0xeff8
-60174,	 // 0xeb0e
-64774,	 // 0xfd06
-60388,	 // 0xebe4
-65025,	 // 0xfe01
- 5845,	 // 0x16d5
-  754,	 // 0x02f2
- 1034,	 // 0x040a
-65523,	 // 0xfff3
-64062,	 // 0xfa3e
-64571,	 // 0xfc3b
-64350,	 // 0xfb5e
-    3,	 // 0x0003
-61691,	 // 0xf0fb
- 6647,	 // 0x19f7
- 4893,	 // 0x131d
-11078,	 // 0x2b46
- 7427,	 // 0x1d03
-14616,	 // 0x3918
-42238,	 // 0xa4fe
-  270,	 // 0x010e
-61406,	 // 0xefde
-60169,	 // 0xeb09
-63520,	 // 0xf820
- 3320,	 // 0x0cf8
-60641,	 // 0xece1
-  506,	 // 0x01fa
- 5387,	 // 0x150b
- 6384,	 // 0x18f0
- 4481,	 // 0x1181
-60575,	 // 0xec9f
-64996,	 // 0xfde4
-48122,	 // 0xbbfa
-64251,	 // 0xfafb
- 4094,	 // 0x0ffe
-62211,	 // 0xf303
-64531,	 // 0xfc13
- 6934,	 // 0x1b16
-  200,	 // 0x00c8
- 3321,	 // 0x0cf9
-62991,	 // 0xf60f
- 6651,	 // 0x19fb
- 4388,	 // 0x1124
-64474,	 // 0xfbda
-62468,	 // 0xf404
- 9219,	 // 0x2403
-65242,	 // 0xfeda
-  753,	 // 0x02f1
- 1255,	 // 0x04e7
- 2558,	 // 0x09fe
-57855,	 // 0xe1ff
-56319,	 // 0xdbff
- 2822,	 // 0x0b06
-60680,	 // 0xed08
- 2553,	 // 0x09f9
- 2314,	 // 0x090a
- 3113,	 // 0x0c29
- 3050,	 // 0x0bea
- 1283,	 // 0x0503
-61006,	 // 0xee4e
-65508,	 // 0xffe4
- 2026,	 // 0x07ea
-62263,	 // 0xf337
- 2050,	 // 0x0802
-62849,	 // 0xf581
-61959,	 // 0xf207
- 1015,	 // 0x03f7
- 6401,	 // 0x1901
- 4060,	 // 0x0fdc
-42764,	 // 0xa70c
-53244,	 // 0xcffc
-56574,	 // 0xdcfe
- 2563,	 // 0x0a03
-65042,	 // 0xfe12
-59702,	 // 0xe936
-54800,	 // 0xd610
- 4111,	 // 0x100f
-65021,	 // 0xfdfd
- 1025,	 // 0x0401
-62209,	 // 0xf301
- 1013,	 // 0x03f5
-  514,	 // 0x0202
-64997,	 // 0xfde5
-65520,	 // 0xfff0
- 4360,	 // 0x1108
-65529,	 // 0xfff9
-60160,	 // 0xeb00
- 1757,	 // 0x06dd
- 2036,	 // 0x07f4
-62989,	 // 0xf60d
-  755,	 // 0x02f3
-64514,	 // 0xfc02
-65317,	 // 0xff25
-62967,	 // 0xf5f7
-63493,	 // 0xf805
-39936,	 // 0x9c00
- 5904,	 // 0x1710
-33025,	 // 0x8101
-60924,	 // 0xedfc
- 2552,	 // 0x09f8
-  773,	 // 0x0305
-61459,	 // 0xf013
-64005,	 // 0xfa05
-64240,	 // 0xfaf0
- 1545,	 // 0x0609
-62713,	 // 0xf4f9
-57601,	 // 0xe101
- 1282,	 // 0x0502
- 1537,	 // 0x0601
- 2815,	 // 0x0aff
-  779,	 // 0x030b
- 4091,	 // 0x0ffb
- 1038,	 // 0x040e
- 4618,	 // 0x120a
- 5903,	 // 0x170f
- 4613,	 // 0x1205
-64491,	 // 0xfbeb
-64973,	 // 0xfdcd
- 7212,	 // 0x1c2c
-21246,	 // 0x52fe
-64775,	 // 0xfd07
- 2821,	 // 0x0b05
- 1527,	 // 0x05f7
- 2059,	 // 0x080b
- 3292,	 // 0x0cdc
- 1272,	 // 0x04f8
-64767,	 // 0xfcff
- 2301,	 // 0x08fd
- 4353,	 // 0x1101
-  243,	 // 0x00f3
-25850,	 // 0x64fa
-64702,	 // 0xfcbe
- 1009,	 // 0x03f1
-  265,	 // 0x0109
-63246,	 // 0xf70e
-58094,	 // 0xe2ee
-  794,	 // 0x031a
-40164,	 // 0x9ce4
- 9979,	 // 0x26fb
-61706,	 // 0xf10a
- 4347,	 // 0x10fb
-60394,	 // 0xebea
-59886,	 // 0xe9ee
- 1073,	 // 0x0431
-12788,	 // 0x31f4
-59351,	 // 0xe7d7
-63758,	 // 0xf90e
- 3103,	 // 0x0c1f
- 1743,	 // 0x06cf
- 6115,	 // 0x17e3
- 8960,	 // 0x2300
-65268,	 // 0xfef4
-  217,	 // 0x00d9
-64485,	 // 0xfbe5
-65285,	 // 0xff05
-58104,	 // 0xe2f8
- 1030,	 // 0x0406
-36094,	 // 0x8cfe
- 3071,	 // 0x0bff
-63757,	 // 0xf90d
- 4096,	 // 0x1000
- 2871,	 // 0x0b37
-53753,	 // 0xd1f9
- 5591,	 // 0x15d7
- 3333,	 // 0x0d05
-65276,	 // 0xfefc
-  757,	 // 0x02f5
-63496,	 // 0xf808
-27007,	 // 0x697f
-58371,	 // 0xe403
- 3054,	 // 0x0bee
- 1793,	 // 0x0701
- 2570,	 // 0x0a0a
- 1252,	 // 0x04e4
- 2542,	 // 0x09ee
-64828,	 // 0xfd3c
-62201,	 // 0xf2f9
- 2318,	 // 0x090e
- 5379,	 // 0x1503
- 5665,	 // 0x1621
-59888,	 // 0xe9f0
-24562,	 // 0x5ff2
-60923,	 // 0xedfb
-43508,	 // 0xa9f4
- 4343,	 // 0x10f7
-54320,	 // 0xd430
- 6928,	 // 0x1b10
-57030,	 // 0xdec6
-57099,	 // 0xdf0b
- 5860,	 // 0x16e4
- 1305,	 // 0x0519
-65263,	 // 0xfeef
-62946,	 // 0xf5e2
-64269,	 // 0xfb0d
- 1543,	 // 0x0607
-  753,	 // 0x02f1
- 2576,	 // 0x0a10
-64768,	 // 0xfd00
-64774,	 // 0xfd06
- 1553,	 // 0x0611
- 6683,	 // 0x1a1b
-22528,	 // 0x5800
-61696,	 // 0xf100
-55298,	 // 0xd802
- 1537,	 // 0x0601
-63991,	 // 0xf9f7
-25420,	 // 0x634c
-57634,	 // 0xe122
-65509,	 // 0xffe5
-12798,	 // 0x31fe
- 1293,	 // 0x050d
-62978,	 // 0xf602
- 4880,	 // 0x1310
-62938,	 // 0xf5da
-63992,	 // 0xf9f8
-64257,	 // 0xfb01
- 1550,	 // 0x060e
- 5905,	 // 0x1711
-33044,	 // 0x8114
- 1781,	 // 0x06f5
-64505,	 // 0xfbf9
- 5634,	 // 0x1602
- 5875,	 // 0x16f3
-65034,	 // 0xfe0a
- 3850,	 // 0x0f0a
- 1291,	 // 0x050b
-52741,	 // 0xce05
- 7414,	 // 0x1cf6
-  530,	 // 0x0212
- 3847,	 // 0x0f07
- 1541,	 // 0x0605
-  773,	 // 0x0305
-64760,	 // 0xfcf8
- 8174,	 // 0x1fee
-64687,	 // 0xfcaf
- 1240,	 // 0x04d8
- 4922,	 // 0x133a
- 2582,	 // 0x0a16
-52714,	 // 0xcdea
- 5652,	 // 0x1614
-62409,	 // 0xf3c9
-64781,	 // 0xfd0d
- 1015,	 // 0x03f7
-  266,	 // 0x010a
-61825,	 // 0xf181
- 2072,	 // 0x0818
- 4114,	 // 0x1012
-61165,	 // 0xeeed
- 2583,	 // 0x0a17
-63282,	 // 0xf732
- 7397,	 // 0x1ce5
-61697,	 // 0xf101
- 6170,	 // 0x181a
- 5632,	 // 0x1600
-  245,	 // 0x00f5
- 1541,	 // 0x0605
-63492,	 // 0xf804
-  762,	 // 0x02fa
- 1786,	 // 0x06fa
- 1525,	 // 0x05f5
- 2064,	 // 0x0810
- 4596,	 // 0x11f4
- 2049,	 // 0x0801
- 5179,	 // 0x143b
-61160,	 // 0xeee8
-55567,	 // 0xd90f
- 2416,	 // 0x0970
-63873,	 // 0xf981
-60429,	 // 0xec0d
-60411,	 // 0xebfb
-16880,	 // 0x41f0
-26931,	 // 0x6933
-62705,	 // 0xf4f1
- 9718,	 // 0x25f6
-18431,	 // 0x47ff
-11475,	 // 0x2cd3
- 4853,	 // 0x12f5
-53217,	 // 0xcfe1
-59673,	 // 0xe919
-63763,	 // 0xf913
-58561,	 // 0xe4c1
- 6046,	 // 0x179e
-24408,	 // 0x5f58
-60951,	 // 0xee17
-61727,	 // 0xf11f
- 7453,	 // 0x1d1d
-65508,	 // 0xffe4
-45572,	 // 0xb204
- 6429,	 // 0x191d
- 5334,	 // 0x14d6
-14854,	 // 0x3a06
- 4849,	 // 0x12f1
-61225,	 // 0xef29
- 5370,	 // 0x14fa
-57426,	 // 0xe052
-36528,	 // 0x8eb0
-58896,	 // 0xe610
- 4611,	 // 0x1203
- 8475,	 // 0x211b
-58640,	 // 0xe510
-53803,	 // 0xd22b
-64538,	 // 0xfc1a
-  491,	 // 0x01eb
-64045,	 // 0xfa2d
-41717,	 // 0xa2f5
-62747,	 // 0xf51b
-51204,	 // 0xc804
- 4531,	 // 0x11b3
- 6142,	 // 0x17fe
-11518,	 // 0x2cfe
-56034,	 // 0xdae2
- 4440,	 // 0x1158
-56310,	 // 0xdbf6
-61974,	 // 0xf216
-62215,	 // 0xf307
-44290,	 // 0xad02
- 1549,	 // 0x060d
-57616,	 // 0xe110
-60157,	 // 0xeafd
-22277,	 // 0x5705
- 3328,	 // 0x0d00
-56802,	 // 0xdde2
-62968,	 // 0xf5f8
-60411,	 // 0xebfb
-65535,	 // 0xffff
-14404,	 // 0x3844
-48317,	 // 0xbcbd
-15949,	 // 0x3e4d
-10453,	 // 0x28d5
-57346,	 // 0xe002
- 1919,	 // 0x077f
- 1492,	 // 0x05d4
- 6930,	 // 0x1b12
-64018,	 // 0xfa12
-10746,	 // 0x29fa
-62053,	 // 0xf265
-60925,	 // 0xedfd
-60995,	 // 0xee43
-50461,	 // 0xc51d
-61426,	 // 0xeff2
-57256,	 // 0xdfa8
-12028,	 // 0x2efc
-59112,	 // 0xe6e8
- 7681,	 // 0x1e01
-11535,	 // 0x2d0f
-62267,	 // 0xf33b
-64496,	 // 0xfbf0
-51173,	 // 0xc7e5
-48640,	 // 0xbe00
-54778,	 // 0xd5fa
-  452,	 // 0x01c4
- 4863,	 // 0x12ff
-63979,	 // 0xf9eb
-52229,	 // 0xcc05
- 1967,	 // 0x07af
-61430,	 // 0xeff6
- 1012,	 // 0x03f4
-52729,	 // 0xcdf9
-32513,	 // 0x7f01
- 5138,	 // 0x1412
-12544,	 // 0x3100
-14074,	 // 0x36fa
-56043,	 // 0xdaeb
- 4831,	 // 0x12df
- 2813,	 // 0x0afd
- 3288,	 // 0x0cd8
- 5376,	 // 0x1500
-10741,	 // 0x29f5
- 2813,	 // 0x0afd
-65009,	 // 0xfdf1
- 3338,	 // 0x0d0a
-65035,	 // 0xfe0b
- 3088,	 // 0x0c10
- 3558,	 // 0x0de6
-64005,	 // 0xfa05
-15097,	 // 0x3af9
-63504,	 // 0xf810
-60931,	 // 0xee03
-12544,	 // 0x3100
-16891,	 // 0x41fb
- 3594,	 // 0x0e0a
- 1008,	 // 0x03f0
-60933,	 // 0xee05
-60192,	 // 0xeb20
-   17,	 // 0x0011
-    2,	 // 0x0002
- 3352,	 // 0x0d18
-64527,	 // 0xfc0f
-22303,	 // 0x571f
-61173,	 // 0xeef5
-  252,	 // 0x00fc
-  765,	 // 0x02fd
-63744,	 // 0xf900
- 1515,	 // 0x05eb
- 5367,	 // 0x14f7
-61895,	 // 0xf1c7
-52252,	 // 0xcc1c
- 5885,	 // 0x16fd
-60104,	 // 0xeac8
- 3069,	 // 0x0bfd
-63701,	 // 0xf8d5
-65005,	 // 0xfded
- 4086,	 // 0x0ff6
-50169,	 // 0xc3f9
- 7255,	 // 0x1c57
-50644,	 // 0xc5d4
-65303,	 // 0xff17
-59708,	 // 0xe93c
- 1535,	 // 0x05ff
-65292,	 // 0xff0c
- 1833,	 // 0x0729
-63759,	 // 0xf90f
-  639,	 // 0x027f
-58873,	 // 0xe5f9
- 2589,	 // 0x0a1d
-65246,	 // 0xfede
-10249,	 // 0x2809
-16123,	 // 0x3efb
-64758,	 // 0xfcf6
- 9207,	 // 0x23f7
- 4314,	 // 0x10da
-10257,	 // 0x2811
-52282,	 // 0xcc3a
-63166,	 // 0xf6be
-18899,	 // 0x49d3
-  308,	 // 0x0134
-10783,	 // 0x2a1f
- 1467,	 // 0x05bb
- 1261,	 // 0x04ed
-63985,	 // 0xf9f1
-62697,	 // 0xf4e9
- 1520,	 // 0x05f0
- 1251,	 // 0x04e3
-56556,	 // 0xdcec
-64997,	 // 0xfde5
-50978,	 // 0xc722
-64765,	 // 0xfcfd
-54546,	 // 0xd512
- 7928,	 // 0x1ef8
-58144,	 // 0xe320
-63996,	 // 0xf9fc
-61713,	 // 0xf111
-63773,	 // 0xf91d
-64771,	 // 0xfd03
- 3610,	 // 0x0e1a
-64530,	 // 0xfc12
-  252,	 // 0x00fc
-62211,	 // 0xf303
-63418,	 // 0xf7ba
-55288,	 // 0xd7f8
- 3304,	 // 0x0ce8
-63750,	 // 0xf906
- 1277,	 // 0x04fd
- 6105,	 // 0x17d9
-  500,	 // 0x01f4
-64584,	 // 0xfc48
-63445,	 // 0xf7d5
- 1726,	 // 0x06be
-59850,	 // 0xe9ca
-  457,	 // 0x01c9
-49793,	 // 0xc281
-62725,	 // 0xf505
-64958,	 // 0xfdbe
-63737,	 // 0xf8f9
- 3795,	 // 0x0ed3
-  506,	 // 0x01fa
-53712,	 // 0xd1d0
-   23,	 // 0x0017
- 2825,	 // 0x0b09
-  232,	 // 0x00e8
- 2597,	 // 0x0a25
- 3834,	 // 0x0efa
-  576,	 // 0x0240
-    7,	 // 0x0007
- 8953,	 // 0x22f9
-48389,	 // 0xbd05
-65287,	 // 0xff07
- 3845,	 // 0x0f05
- 5595,	 // 0x15db
-19703,	 // 0x4cf7
-58876,	 // 0xe5fc
-64253,	 // 0xfafd
-18945,	 // 0x4a01
- 4599,	 // 0x11f7
- 5418,	 // 0x152a
-10238,	 // 0x27fe
-55016,	 // 0xd6e8
-64268,	 // 0xfb0c
- 6636,	 // 0x19ec
-64523,	 // 0xfc0b
- 3836,	 // 0x0efc
- 2799,	 // 0x0aef
-  264,	 // 0x0108
- 6148,	 // 0x1804
-61702,	 // 0xf106
-  741,	 // 0x02e5
-10481,	 // 0x28f1
- 5880,	 // 0x16f8
-65276,	 // 0xfefc
-  786,	 // 0x0312
-  262,	 // 0x0106
- 1566,	 // 0x061e
-64718,	 // 0xfcce
- 3326,	 // 0x0cfe
- 7666,	 // 0x1df2
- 2802,	 // 0x0af2
- 1545,	 // 0x0609
-57065,	 // 0xdee9
-65274,	 // 0xfefa
- 4847,	 // 0x12ef
- 3558,	 // 0x0de6
- 1520,	 // 0x05f0
-62694,	 // 0xf4e6
-  295,	 // 0x0127
- 7704,	 // 0x1e18
-  266,	 // 0x010a
-61447,	 // 0xf007
- 5380,	 // 0x1504
- 5882,	 // 0x16fa
-  487,	 // 0x01e7
- 9232,	 // 0x2410
- 1820,	 // 0x071c
- 3094,	 // 0x0c16
-63238,	 // 0xf706
-51955,	 // 0xcaf3
-58882,	 // 0xe602
-32749,	 // 0x7fed
- 2826,	 // 0x0b0a
-64326,	 // 0xfb46
- 9971,	 // 0x26f3
-  220,	 // 0x00dc
-61680,	 // 0xf0f0
-64978,	 // 0xfdd2
-63483,	 // 0xf7fb
- 2027,	 // 0x07eb
-59930,	 // 0xea1a
- 2564,	 // 0x0a04
-49660,	 // 0xc1fc
- 6645,	 // 0x19f5
-55520,	 // 0xd8e0
-55550,	 // 0xd8fe
-50063,	 // 0xc38f
-47612,	 // 0xb9fc
-45078,	 // 0xb016
- 1300,	 // 0x0514
-  257,	 // 0x0101
-60427,	 // 0xec0b
-64002,	 // 0xfa02
-  523,	 // 0x020b
-64321,	 // 0xfb41
-65282,	 // 0xff02
- 2825,	 // 0x0b09
-62699,	 // 0xf4eb
-62177,	 // 0xf2e1
-63751,	 // 0xf907
-53759,	 // 0xd1ff
- 3083,	 // 0x0c0b
-65020,	 // 0xfdfc
-57013,	 // 0xdeb5
-32564,	 // 0x7f34
- 2279,	 // 0x08e7
-62472,	 // 0xf408
-    0,	 // 0x0000
-65476,	 // 0xffc4
-52174,	 // 0xcbce
- 5646,	 // 0x160e
-    1,	 // 0x0001
-64255,	 // 0xfaff
-60933,	 // 0xee05
-  512,	 // 0x0200
-22289,	 // 0x5711
-  503,	 // 0x01f7
-59907,	 // 0xea03
-20480,	 // 0x5000
-64985,	 // 0xfdd9
- 2306,	 // 0x0902
- 2830,	 // 0x0b0e
- 4115,	 // 0x1013
- 7922,	 // 0x1ef2
-62185,	 // 0xf2e9
- 2304,	 // 0x0900
- 4085,	 // 0x0ff5
-61695,	 // 0xf0ff
- 2814,	 // 0x0afe
- 2063,	 // 0x080f
-61693,	 // 0xf0fd
- 3301,	 // 0x0ce5
-56596,	 // 0xdd14
- 2879,	 // 0x0b3f
-63919,	 // 0xf9af
- 1769,	 // 0x06e9
- 2489,	 // 0x09b9
- 3033,	 // 0x0bd9
- 5892,	 // 0x1704
-62981,	 // 0xf605
- 6654,	 // 0x19fe
-60633,	 // 0xecd9
- 2306,	 // 0x0902
- 1782,	 // 0x06f6
-64267,	 // 0xfb0b
-58113,	 // 0xe301
-   24,	 // 0x0018
- 8675,	 // 0x21e3
-62449,	 // 0xf3f1
- 1201,	 // 0x04b1
-62716,	 // 0xf4fc
-61153,	 // 0xeee1
- 2558,	 // 0x09fe
- 1263,	 // 0x04ef
- 6411,	 // 0x190b
- 2290,	 // 0x08f2
- 3597,	 // 0x0e0d
- 1791,	 // 0x06ff
-63748,	 // 0xf904
-32520,	 // 0x7f08
-59850,	 // 0xe9ca
-27900,	 // 0x6cfc
- 9737,	 // 0x2609
-53780,	 // 0xd214
-65478,	 // 0xffc6
- 7967,	 // 0x1f1f
- 1786,	 // 0x06fa
-63501,	 // 0xf80d
- 2027,	 // 0x07eb
- 1506,	 // 0x05e2
- 2846,	 // 0x0b1e
- 6910,	 // 0x1afe
-53331,	 // 0xd053
- 1275,	 // 0x04fb
-15910,	 // 0x3e26
-60816,	 // 0xed90
-  796,	 // 0x031c
- 7927,	 // 0x1ef7
-65084,	 // 0xfe3c
- 6868,	 // 0x1ad4
-59105,	 // 0xe6e1
-64468,	 // 0xfbd4
-57612,	 // 0xe10c
- 2053,	 // 0x0805
-61953,	 // 0xf201
- 8686,	 // 0x21ee
-65326,	 // 0xff2e
-10709,	 // 0x29d5
-65270,	 // 0xfef6
-33259,	 // 0x81eb
-62978,	 // 0xf602
-62141,	 // 0xf2bd
-58896,	 // 0xe610
- 2149,	 // 0x0865
-64023,	 // 0xfa17
- 3070,	 // 0x0bfe
-62207,	 // 0xf2ff
-59125,	 // 0xe6f5
- 2566,	 // 0x0a06
-57864,	 // 0xe208
-62698,	 // 0xf4ea
-13826,	 // 0x3602
-59131,	 // 0xe6fb
- 5637,	 // 0x1605
-   44,	 // 0x002c
- 3530,	 // 0x0dca
-60394,	 // 0xebea
-61203,	 // 0xef13
-64740,	 // 0xfce4
-64986,	 // 0xfdda
- 6181,	 // 0x1825
-64778,	 // 0xfd0a
-19213,	 // 0x4b0d
-65282,	 // 0xff02
-32518,	 // 0x7f06
-56285,	 // 0xdbdd
- 4594,	 // 0x11f2
-61437,	 // 0xeffd
- 4831,	 // 0x12df
- 2527,	 // 0x09df
-63702,	 // 0xf8d6
-60453,	 // 0xec25
- 3583,	 // 0x0dff
-53614,	 // 0xd16e
- 2319,	 // 0x090f
-  815,	 // 0x032f
- 8423,	 // 0x20e7
-  753,	 // 0x02f1
- 1064,	 // 0x0428
- 5113,	 // 0x13f9
- 2072,	 // 0x0818
-12039,	 // 0x2f07
- 4579,	 // 0x11e3
-64757,	 // 0xfcf5
- 2550,	 // 0x09f6
- 1525,	 // 0x05f5
-63782,	 // 0xf926
-59187,	 // 0xe733
- 7424,	 // 0x1d00
- 6428,	 // 0x191c
-61989,	 // 0xf225
-16958,	 // 0x423e
- 2068,	 // 0x0814
-65298,	 // 0xff12
-59433,	 // 0xe829
- 3579,	 // 0x0dfb
-64508,	 // 0xfbfc
- 1563,	 // 0x061b
-63738,	 // 0xf8fa
- 3322,	 // 0x0cfa
-62207,	 // 0xf2ff
- 3830,	 // 0x0ef6
-10488,	 // 0x28f8
- 1519,	 // 0x05ef
-18425,	 // 0x47f9
-57314,	 // 0xdfe2
-60400,	 // 0xebf0
-10241,	 // 0x2801
-53245,	 // 0xcffd
-64253,	 // 0xfafd
-61725,	 // 0xf11d
-52216,	 // 0xcbf8
-60071,	 // 0xeaa7
- 1536,	 // 0x0600
-56821,	 // 0xddf5
-65241,	 // 0xfed9
- 1014,	 // 0x03f6
- 2302,	 // 0x08fe
- 1543,	 // 0x0607
-62724,	 // 0xf504
-65041,	 // 0xfe11
-65529,	 // 0xfff9
- 6652,	 // 0x19fc
-61192,	 // 0xef08
-  768,	 // 0x0300
- 1287,	 // 0x0507
-61174,	 // 0xeef6
-65017,	 // 0xfdf9
- 1292,	 // 0x050c
- 2328,	 // 0x0918
-27892,	 // 0x6cf4
-65292,	 // 0xff0c
- 1284,	 // 0x0504
-65525,	 // 0xfff5
-64260,	 // 0xfb04
-53964,	 // 0xd2cc
- 6659,	 // 0x1a03
-64256,	 // 0xfb00
-65024,	 // 0xfe00
- 1033,	 // 0x0409
- 3852,	 // 0x0f0c
-32765,	 // 0x7ffd
- 4782,	 // 0x12ae
-  308,	 // 0x0134
-12249,	 // 0x2fd9
- 7678,	 // 0x1dfe
-10535,	 // 0x2927
-64488,	 // 0xfbe8
-20474,	 // 0x4ffa
-61669,	 // 0xf0e5
- 6869,	 // 0x1ad5
-62763,	 // 0xf52b
- 7935,	 // 0x1eff
-59862,	 // 0xe9d6
-12594,	 // 0x3132
-12799,	 // 0x31ff
-65285,	 // 0xff05
-63462,	 // 0xf7e6
-57661,	 // 0xe13d
-59135,	 // 0xe6ff
-56267,	 // 0xdbcb
-54068,	 // 0xd334
-14147,	 // 0x3743
- 3891,	 // 0x0f33
-65326,	 // 0xff2e
- 2334,	 // 0x091e
-15601,	 // 0x3cf1
-33279,	 // 0x81ff
-27132,	 // 0x69fc
-15661,	 // 0x3d2d
-54051,	 // 0xd323
-13832,	 // 0x3608
-57428,	 // 0xe054
-21878,	 // 0x5576
-49511,	 // 0xc167
- 5794,	 // 0x16a2
-11012,	 // 0x2b04
-63721,	 // 0xf8e9
- 3289,	 // 0x0cd9
- 6662,	 // 0x1a06
-58337,	 // 0xe3e1
-65046,	 // 0xfe16
-64015,	 // 0xfa0f
- 5622,	 // 0x15f6
-64261,	 // 0xfb05
-37129,	 // 0x9109
-15155,	 // 0x3b33
- 2818,	 // 0x0b02
-50673,	 // 0xc5f1
- 1039,	 // 0x040f
-  237,	 // 0x00ed
- 1003,	 // 0x03eb
- 4105,	 // 0x1009
-45298,	 // 0xb0f2
- 8436,	 // 0x20f4
-65027,	 // 0xfe03
- 8945,	 // 0x22f1
-59379,	 // 0xe7f3
-49163,	 // 0xc00b
-  772,	 // 0x0304
-  520,	 // 0x0208
- 1606,	 // 0x0646
-61693,	 // 0xf0fd
- 1744,	 // 0x06d0
-62996,	 // 0xf614
-13565,	 // 0x34fd
-59154,	 // 0xe712
-62443,	 // 0xf3eb
-64751,	 // 0xfcef
-  768,	 // 0x0300
-65276,	 // 0xfefc
- 1407,	 // 0x057f
- 1520,	 // 0x05f0
- 6408,	 // 0x1908
-51225,	 // 0xc819
- 8190,	 // 0x1ffe
- 1009,	 // 0x03f1
- 1799,	 // 0x0707
-63480,	 // 0xf7f8
-59381,	 // 0xe7f5
-63745,	 // 0xf901
- 3812,	 // 0x0ee4
-64256,	 // 0xfb00
- 4343,	 // 0x10f7
-65532,	 // 0xfffc
- 2571,	 // 0x0a0b
- 3327,	 // 0x0cff
- 8945,	 // 0x22f1
-65281,	 // 0xff01
-63471,	 // 0xf7ef
- 7088,	 // 0x1bb0
- 2417,	 // 0x0971
- 6116,	 // 0x17e4
-14601,	 // 0x3909
-10036,	 // 0x2734
- 8957,	 // 0x22fd
- 1026,	 // 0x0402
-19445,	 // 0x4bf5
-18905,	 // 0x49d9
-62510,	 // 0xf42e
-12778,	 // 0x31ea
-46822,	 // 0xb6e6
-55340,	 // 0xd82c
-17413,	 // 0x4405
-63433,	 // 0xf7c9
-52465,	 // 0xccf1
-51721,	 // 0xca09
- 8368,	 // 0x20b0
-  522,	 // 0x020a
-64466,	 // 0xfbd2
-12543,	 // 0x30ff
-54011,	 // 0xd2fb
-27650,	 // 0x6c02
- 1725,	 // 0x06bd
- 5399,	 // 0x1517
-57334,	 // 0xdff6
-33074,	 // 0x8132
-12861,	 // 0x323d
- 1742,	 // 0x06ce
- 7927,	 // 0x1ef7
-   48,	 // 0x0030
-53360,	 // 0xd070
- 6175,	 // 0x181f
-56505,	 // 0xdcb9
- 5638,	 // 0x1606
- 5124,	 // 0x1404
-64949,	 // 0xfdb5
-18458,	 // 0x481a
-59894,	 // 0xe9f6
-62710,	 // 0xf4f6
- 2174,	 // 0x087e
- 2828,	 // 0x0b0c
- 6734,	 // 0x1a4e
-17432,	 // 0x4418
-63265,	 // 0xf721
- 1265,	 // 0x04f1
- 6121,	 // 0x17e9
-64281,	 // 0xfb19
-54560,	 // 0xd520
-63510,	 // 0xf816
-  507,	 // 0x01fb
- 5843,	 // 0x16d3
- 7913,	 // 0x1ee9
-51181,	 // 0xc7ed
- 8921,	 // 0x22d9
-54247,	 // 0xd3e7
- 2603,	 // 0x0a2b
-53492,	 // 0xd0f4
- 4563,	 // 0x11d3
- 1527,	 // 0x05f7
-63006,	 // 0xf61e
-58890,	 // 0xe60a
-60950,	 // 0xee16
-12359,	 // 0x3047
-60455,	 // 0xec27
-65376,	 // 0xff60
-65267,	 // 0xfef3
-61955,	 // 0xf203
- 4840,	 // 0x12e8
-42972,	 // 0xa7dc
-23279,	 // 0x5aef
- 1772,	 // 0x06ec
-  798,	 // 0x031e
-58891,	 // 0xe60b
-27914,	 // 0x6d0a
-32743,	 // 0x7fe7
-52240,	 // 0xcc10
-58364,	 // 0xe3fc
-62968,	 // 0xf5f8
-64510,	 // 0xfbfe
- 1793,	 // 0x0701
- 8746,	 // 0x222a
-58094,	 // 0xe2ee
-63477,	 // 0xf7f5
- 1531,	 // 0x05fb
-58347,	 // 0xe3eb
-60900,	 // 0xede4
-58344,	 // 0xe3e8
-64767,	 // 0xfcff
-    0,	 // 0x0000
-59115,	 // 0xe6eb
- 1603,	 // 0x0643
- 2298,	 // 0x08fa
-65017,	 // 0xfdf9
-10234,	 // 0x27fa
-  459,	 // 0x01cb
-59898,	 // 0xe9fa
-13829,	 // 0x3605
-58361,	 // 0xe3f9
-65274,	 // 0xfefa
-60899,	 // 0xede3
- 5373,	 // 0x14fd
-62847,	 // 0xf57f
- 8169,	 // 0x1fe9
-11537,	 // 0x2d11
-64528,	 // 0xfc10
-63727,	 // 0xf8ef
- 1779,	 // 0x06f3
-65291,	 // 0xff0b
- 1789,	 // 0x06fd
-65293,	 // 0xff0d
-64511,	 // 0xfbff
- 4107,	 // 0x100b
-60155,	 // 0xeafb
-64005,	 // 0xfa05
-59649,	 // 0xe901
-  760,	 // 0x02f8
-59396,	 // 0xe804
- 1034,	 // 0x040a
-62963,	 // 0xf5f3
- 8453,	 // 0x2105
-65281,	 // 0xff01
-65535,	 // 0xffff
-63965,	 // 0xf9dd
-  254,	 // 0x00fe
- 5878,	 // 0x16f6
- 1277,	 // 0x04fd
-  492,	 // 0x01ec
-64261,	 // 0xfb05
-65278,	 // 0xfefe
-  514,	 // 0x0202
-61705,	 // 0xf109
- 3871,	 // 0x0f1f
- 3569,	 // 0x0df1
-64257,	 // 0xfb01
- 3028,	 // 0x0bd4
- 5366,	 // 0x14f6
-63471,	 // 0xf7ef
-11781,	 // 0x2e05
-63248,	 // 0xf710
-64518,	 // 0xfc06
- 7683,	 // 0x1e03
-18687,	 // 0x48ff
-63235,	 // 0xf703
-62437,	 // 0xf3e5
- 2052,	 // 0x0804
-42010,	 // 0xa41a
- 3346,	 // 0x0d12
-65318,	 // 0xff26
-63231,	 // 0xf6ff
-  482,	 // 0x01e2
-60376,	 // 0xebd8
- 5884,	 // 0x16fc
-65270,	 // 0xfef6
- 3351,	 // 0x0d17
-  525,	 // 0x020d
- 1039,	 // 0x040f
-60667,	 // 0xecfb
-10244,	 // 0x2804
- 4105,	 // 0x1009
- 8994,	 // 0x2322
-65039,	 // 0xfe0f
-61963,	 // 0xf20b
-32556,	 // 0x7f2c
-19191,	 // 0x4af7
- 2791,	 // 0x0ae7
- 6919,	 // 0x1b07
- 2813,	 // 0x0afd
- 2573,	 // 0x0a0d
- 7452,	 // 0x1d1c
- 1268,	 // 0x04f4
-63230,	 // 0xf6fe
- 1576,	 // 0x0628
- 2821,	 // 0x0b05
- 2842,	 // 0x0b1a
-55572,	 // 0xd914
- 3374,	 // 0x0d2e
-62200,	 // 0xf2f8
-64264,	 // 0xfb08
-62980,	 // 0xf604
-63980,	 // 0xf9ec
-64282,	 // 0xfb1a
-63505,	 // 0xf811
-64518,	 // 0xfc06
- 8697,	 // 0x21f9
-62188,	 // 0xf2ec
-12288,	 // 0x3000
-63482,	 // 0xf7fa
-63731,	 // 0xf8f3
-63749,	 // 0xf905
- 2562,	 // 0x0a02
- 1799,	 // 0x0707
-  273,	 // 0x0111
-62159,	 // 0xf2cf
- 1173,	 // 0x0495
- 5761,	 // 0x1681
-65018,	 // 0xfdfa
-61130,	 // 0xeeca
-63484,	 // 0xf7fc
-64497,	 // 0xfbf1
-60159,	 // 0xeaff
-62973,	 // 0xf5fd
-52987,	 // 0xcefb
- 8429,	 // 0x20ed
- 5126,	 // 0x1406
- 2574,	 // 0x0a0e
- 3080,	 // 0x0c08
-  236,	 // 0x00ec
- 6396,	 // 0x18fc
-64852,	 // 0xfd54
-62968,	 // 0xf5f8
- 1534,	 // 0x05fe
-62985,	 // 0xf609
-64250,	 // 0xfafa
-63229,	 // 0xf6fd
- 4602,	 // 0x11fa
- 1288,	 // 0x0508
- 2815,	 // 0x0aff
-62215,	 // 0xf307
-19454,	 // 0x4bfe
-65017,	 // 0xfdf9
-65273,	 // 0xfef9
- 1538,	 // 0x0602
-64636,	 // 0xfc7c
- 1003,	 // 0x03eb
-62741,	 // 0xf515
-47110,	 // 0xb806
- 9736,	 // 0x2608
-43027,	 // 0xa813
- 2820,	 // 0x0b04
-52986,	 // 0xcefa
-11254,	 // 0x2bf6
-57851,	 // 0xe1fb
-65283,	 // 0xff03
- 4082,	 // 0x0ff2
-54277,	 // 0xd405
-17158,	 // 0x4306
-62225,	 // 0xf311
- 3571,	 // 0x0df3
- 6406,	 // 0x1906
-64277,	 // 0xfb15
-64763,	 // 0xfcfb
-  771,	 // 0x0303
-  256,	 // 0x0100
-52497,	 // 0xcd11
-62728,	 // 0xf508
- 9457,	 // 0x24f1
-64005,	 // 0xfa05
-65286,	 // 0xff06
- 1277,	 // 0x04fd
-64301,	 // 0xfb2d
-56051,	 // 0xdaf3
-33251,	 // 0x81e3
- 1531,	 // 0x05fb
- 2296,	 // 0x08f8
-65280,	 // 0xff00
-65286,	 // 0xff06
-57864,	 // 0xe208
-64782,	 // 0xfd0e
-  779,	 // 0x030b
- 2066,	 // 0x0812
-64772,	 // 0xfd04
-  276,	 // 0x0114
-56588,	 // 0xdd0c
- 3098,	 // 0x0c1a
- 1663,	 // 0x067f
-60687,	 // 0xed0f
- 4348,	 // 0x10fc
- 2028,	 // 0x07ec
-64254,	 // 0xfafe
-62224,	 // 0xf310
-59130,	 // 0xe6fa
- 8720,	 // 0x2210
- 6394,	 // 0x18fa
- 3323,	 // 0x0cfb
-  778,	 // 0x030a
-63729,	 // 0xf8f1
-27916,	 // 0x6d0c
- 7426,	 // 0x1d02
-64786,	 // 0xfd12
- 1031,	 // 0x0407
-62982,	 // 0xf606
-  997,	 // 0x03e5
-56290,	 // 0xdbe2
- 6410,	 // 0x190a
- 1521,	 // 0x05f1
- 3067,	 // 0x0bfb
-    4,	 // 0x0004
- 2825,	 // 0x0b09
- 9483,	 // 0x250b
-60669,	 // 0xecfd
-62209,	 // 0xf301
-64765,	 // 0xfcfd
-64796,	 // 0xfd1c
- 4147,	 // 0x1033
-58891,	 // 0xe60b
-59423,	 // 0xe81f
- 2831,	 // 0x0b0f
- 6137,	 // 0x17f9
- 1790,	 // 0x06fe
-  439,	 // 0x01b7
-  496,	 // 0x01f0
-64246,	 // 0xfaf6
-  507,	 // 0x01fb
-63760,	 // 0xf910
-64262,	 // 0xfb06
- 1034,	 // 0x040a
- 6140,	 // 0x17fc
-62217,	 // 0xf309
-  764,	 // 0x02fc
- 8448,	 // 0x2100
-59672,	 // 0xe918
- 3079,	 // 0x0c07
- 3074,	 // 0x0c02
- 1030,	 // 0x0406
-63750,	 // 0xf906
-64718,	 // 0xfcce
-65022,	 // 0xfdfe
-65285,	 // 0xff05
- 3846,	 // 0x0f06
- 1285,	 // 0x0505
- 2813,	 // 0x0afd
- 1243,	 // 0x04db
-56813,	 // 0xdded
- 7670,	 // 0x1df6
-  266,	 // 0x010a
-63223,	 // 0xf6f7
-64771,	 // 0xfd03
- 2809,	 // 0x0af9
-64512,	 // 0xfc00
-62459,	 // 0xf3fb
-  762,	 // 0x02fa
-62983,	 // 0xf607
-64473,	 // 0xfbd9
-64016,	 // 0xfa10
-38130,	 // 0x94f2
-33272,	 // 0x81f8
-64753,	 // 0xfcf1
- 2825,	 // 0x0b09
-61463,	 // 0xf017
-61150,	 // 0xeede
- 1789,	 // 0x06fd
-  252,	 // 0x00fc
-60642,	 // 0xece2
-64259,	 // 0xfb03
-58127,	 // 0xe30f
-63994,	 // 0xf9fa
-  257,	 // 0x0101
-63500,	 // 0xf80c
-60929,	 // 0xee01
-61718,	 // 0xf116
-64782,	 // 0xfd0e
-65282,	 // 0xff02
-    4,	 // 0x0004
-    0,	 // 0x0000
-65020,	 // 0xfdfc
-    0,	 // 0x0000
-65025,	 // 0xfe01
-  257,	 // 0x0101
-65280,	 // 0xff00
-    0,	 // 0x0000
-  508,	 // 0x01fc
-64767,	 // 0xfcff
-    1,	 // 0x0001
-    1,	 // 0x0001
-  129,	 // 0x0081
- 2049,	 // 0x0801
-  509,	 // 0x01fd
-  511,	 // 0x01ff
-64765,	 // 0xfcfd
-  258,	 // 0x0102
-  764,	 // 0x02fc
-65287,	 // 0xff07
-  255,	 // 0x00ff
-    0,	 // 0x0000
-39419,	 // 0x99fb
-    1,	 // 0x0001
-65531,	 // 0xfffb
-64506,	 // 0xfbfa
- 2553,	 // 0x09f9
-65270,	 // 0xfef6
-    0,	 // 0x0000
-  254,	 // 0x00fe
-  254,	 // 0x00fe
-    0,	 // 0x0000
-    1,	 // 0x0001
-65230,	 // 0xfece
-64256,	 // 0xfb00
-65020,	 // 0xfdfc
-  255,	 // 0x00ff
-  257,	 // 0x0101
-54016,	 // 0xd300
-64512,	 // 0xfc00
-65024,	 // 0xfe00
-65281,	 // 0xff01
- 3584,	 // 0x0e00
-65265,	 // 0xfef1
-12392,	 // 0x3068
-58659,	 // 0xe523
- 2321,	 // 0x0911
-21333,	 // 0x5355
- 2815,	 // 0x0aff
-13346,	 // 0x3422
- 7404,	 // 0x1cec
-32517,	 // 0x7f05
- 5401,	 // 0x1519
-25847,	 // 0x64f7
-10751,	 // 0x29ff
- 2317,	 // 0x090d
-19192,	 // 0x4af8
-60188,	 // 0xeb1c
-52943,	 // 0xcecf
- 1596,	 // 0x063c
-65423,	 // 0xff8f
-58175,	 // 0xe33f
-57586,	 // 0xe0f2
-12600,	 // 0x3138
-14910,	 // 0x3a3e
-14366,	 // 0x381e
- 2351,	 // 0x092f
-23293,	 // 0x5afd
- 7648,	 // 0x1de0
- 8445,	 // 0x20fd
-15351,	 // 0x3bf7
- 7986,	 // 0x1f32
-60462,	 // 0xec2e
- 2851,	 // 0x0b23
- 8714,	 // 0x220a
-14878,	 // 0x3a1e
- 5633,	 // 0x1601
- 1544,	 // 0x0608
- 1742,	 // 0x06ce
- 5828,	 // 0x16c4
-17197,	 // 0x432d
- 9711,	 // 0x25ef
- 3337,	 // 0x0d09
- 5130,	 // 0x140a
-53756,	 // 0xd1fc
-57617,	 // 0xe111
-  984,	 // 0x03d8
-62916,	 // 0xf5c4
-65258,	 // 0xfeea
- 8192,	 // 0x2000
- 1269,	 // 0x04f5
-13330,	 // 0x3412
-  806,	 // 0x0326
-56320,	 // 0xdc00
- 5124,	 // 0x1404
-32749,	 // 0x7fed
-60917,	 // 0xedf5
-22535,	 // 0x5807
-57088,	 // 0xdf00
- 1811,	 // 0x0713
- 4349,	 // 0x10fd
-58103,	 // 0xe2f7
-63494,	 // 0xf806
-10501,	 // 0x2905
-64997,	 // 0xfde5
- 2285,	 // 0x08ed
- 5654,	 // 0x1616
-  283,	 // 0x011b
-64022,	 // 0xfa16
- 3817,	 // 0x0ee9
-64755,	 // 0xfcf3
- 3587,	 // 0x0e03
- 3337,	 // 0x0d09
-57856,	 // 0xe200
- 4598,	 // 0x11f6
-59889,	 // 0xe9f1
- 3366,	 // 0x0d26
- 3354,	 // 0x0d1a
-65002,	 // 0xfdea
- 5381,	 // 0x1505
-60435,	 // 0xec13
-65025,	 // 0xfe01
-65262,	 // 0xfeee
- 1039,	 // 0x040f
- 9502,	 // 0x251e
-54266,	 // 0xd3fa
- 1042,	 // 0x0412
-64274,	 // 0xfb12
- 2799,	 // 0x0aef
-63024,	 // 0xf630
-47583,	 // 0xb9df
- 7145,	 // 0x1be9
- 2559,	 // 0x09ff
-60225,	 // 0xeb41
-60923,	 // 0xedfb
- 4568,	 // 0x11d8
-63734,	 // 0xf8f6
- 6926,	 // 0x1b0e
-58086,	 // 0xe2e6
- 6951,	 // 0x1b27
-51970,	 // 0xcb02
- 8173,	 // 0x1fed
-58060,	 // 0xe2cc
-54032,	 // 0xd310
- 6399,	 // 0x18ff
-57165,	 // 0xdf4d
- 2088,	 // 0x0828
-32558,	 // 0x7f2e
- 3357,	 // 0x0d1d
- 7419,	 // 0x1cfb
- 9715,	 // 0x25f3
-58919,	 // 0xe627
- 1023,	 // 0x03ff
- 7082,	 // 0x1baa
-62745,	 // 0xf519
-  786,	 // 0x0312
-59426,	 // 0xe822
- 1499,	 // 0x05db
- 5360,	 // 0x14f0
-59423,	 // 0xe81f
- 3327,	 // 0x0cff
- 2052,	 // 0x0804
-58835,	 // 0xe5d3
-64725,	 // 0xfcd5
-60652,	 // 0xecec
-58877,	 // 0xe5fd
-62958,	 // 0xf5ee
- 9211,	 // 0x23fb
- 2392,	 // 0x0958
- 4904,	 // 0x1328
- 1801,	 // 0x0709
- 3932,	 // 0x0f5c
-12038,	 // 0x2f06
- 1858,	 // 0x0742
- 4916,	 // 0x1334
-65144,	 // 0xfe78
-61687,	 // 0xf0f7
- 1268,	 // 0x04f4
- 2266,	 // 0x08da
-61229,	 // 0xef2d
- 3553,	 // 0x0de1
- 8180,	 // 0x1ff4
-48624,	 // 0xbdf0
-32756,	 // 0x7ff4
- 6395,	 // 0x18fb
-26093,	 // 0x65ed
-58884,	 // 0xe604
-60937,	 // 0xee09
-65277,	 // 0xfefd
-62208,	 // 0xf300
- 2080,	 // 0x0820
-65503,	 // 0xffdf
- 4073,	 // 0x0fe9
-65293,	 // 0xff0d
-63447,	 // 0xf7d7
-64271,	 // 0xfb0f
-  223,	 // 0x00df
- 2046,	 // 0x07fe
-65533,	 // 0xfffd
- 9987,	 // 0x2703
- 3893,	 // 0x0f35
-63755,	 // 0xf90b
- 7180,	 // 0x1c0c
-  500,	 // 0x01f4
-65035,	 // 0xfe0b
-65216,	 // 0xfec0
-15359,	 // 0x3bff
-64010,	 // 0xfa0a
-64248,	 // 0xfaf8
-62457,	 // 0xf3f9
- 2282,	 // 0x08ea
- 1031,	 // 0x0407
-62471,	 // 0xf407
-65530,	 // 0xfffa
- 2579,	 // 0x0a13
-65023,	 // 0xfdff
- 8188,	 // 0x1ffc
- 1521,	 // 0x05f1
-57851,	 // 0xe1fb
-64758,	 // 0xfcf6
- 7163,	 // 0x1bfb
- 4607,	 // 0x11ff
-62718,	 // 0xf4fe
- 6692,	 // 0x1a24
-13808,	 // 0x35f0
- 2583,	 // 0x0a17
- 4883,	 // 0x1313
- 3077,	 // 0x0c05
-  282,	 // 0x011a
-64487,	 // 0xfbe7
-55048,	 // 0xd708
-59396,	 // 0xe804
-63226,	 // 0xf6fa
-19443,	 // 0x4bf3
-64234,	 // 0xfaea
-63205,	 // 0xf6e5
-57547,	 // 0xe0cb
-60406,	 // 0xebf6
-38888,	 // 0x97e8
-23339,	 // 0x5b2b
-57829,	 // 0xe1e5
- 5654,	 // 0x1616
- 2544,	 // 0x09f0
-  986,	 // 0x03da
- 6896,	 // 0x1af0
-59411,	 // 0xe813
-59900,	 // 0xe9fc
-62214,	 // 0xf306
-59651,	 // 0xe903
- 1120,	 // 0x0460
-  252,	 // 0x00fc
-60653,	 // 0xeced
- 5862,	 // 0x16e6
- 1286,	 // 0x0506
- 7687,	 // 0x1e07
- 9220,	 // 0x2404
- 2795,	 // 0x0aeb
-61172,	 // 0xeef4
-65290,	 // 0xff0a
- 1050,	 // 0x041a
-48648,	 // 0xbe08
-57870,	 // 0xe20e
-32718,	 // 0x7fce
-59200,	 // 0xe740
- 9481,	 // 0x2509
-59108,	 // 0xe6e4
- 4916,	 // 0x1334
- 8221,	 // 0x201d
-49926,	 // 0xc306
-53089,	 // 0xcf61
- 2061,	 // 0x080d
- 2563,	 // 0x0a03
- 1811,	 // 0x0713
- 2827,	 // 0x0b0b
-12457,	 // 0x30a9
- 6192,	 // 0x1830
- 5135,	 // 0x140f
-53714,	 // 0xd1d2
-56040,	 // 0xdae8
-60149,	 // 0xeaf5
-43009,	 // 0xa801
-44545,	 // 0xae01
-42817,	 // 0xa741
-15596,	 // 0x3cec
-49430,	 // 0xc116
-59696,	 // 0xe930
- 3536,	 // 0x0dd0
-22440,	 // 0x57a8
-58628,	 // 0xe504
-64568,	 // 0xfc38
- 4374,	 // 0x1116
- 4833,	 // 0x12e1
-60241,	 // 0xeb51
-58850,	 // 0xe5e2
-62996,	 // 0xf614
- 8897,	 // 0x22c1
-27116,	 // 0x69ec
-61195,	 // 0xef0b
-61690,	 // 0xf0fa
- 3062,	 // 0x0bf6
-21065,	 // 0x5249
-36225,	 // 0x8d81
-64261,	 // 0xfb05
-46085,	 // 0xb405
-17601,	 // 0x44c1
-59181,	 // 0xe72d
-19157,	 // 0x4ad5
- 9407,	 // 0x24bf
- 5890,	 // 0x1702
-32542,	 // 0x7f1e
- 6097,	 // 0x17d1
-50739,	 // 0xc633
-29980,	 // 0x751c
-65076,	 // 0xfe34
-51156,	 // 0xc7d4
-50911,	 // 0xc6df
-61118,	 // 0xeebe
- 1561,	 // 0x0619
-62459,	 // 0xf3fb
-54312,	 // 0xd428
-63728,	 // 0xf8f0
-49669,	 // 0xc205
-64583,	 // 0xfc47
-63997,	 // 0xf9fd
-18669,	 // 0x48ed
-56304,	 // 0xdbf0
-20716,	 // 0x50ec
-53308,	 // 0xd03c
- 6377,	 // 0x18e9
-19956,	 // 0x4df4
-64507,	 // 0xfbfb
-60402,	 // 0xebf2
-56375,	 // 0xdc37
- 3247,	 // 0x0caf
- 9149,	 // 0x23bd
-50351,	 // 0xc4af
-   89,	 // 0x0059
-59037,	 // 0xe69d
-56052,	 // 0xdaf4
-61714,	 // 0xf112
- 7671,	 // 0x1df7
-48122,	 // 0xbbfa
-51382,	 // 0xc8b6
-26365,	 // 0x66fd
-65035,	 // 0xfe0b
- 9462,	 // 0x24f6
-61373,	 // 0xefbd
-58037,	 // 0xe2b5
-10203,	 // 0x27db
-52641,	 // 0xcda1
-28153,	 // 0x6df9
- 9855,	 // 0x267f
-22479,	 // 0x57cf
-11557,	 // 0x2d25
-15619,	 // 0x3d03
-57073,	 // 0xdef1
-60184,	 // 0xeb18
- 5574,	 // 0x15c6
-59689,	 // 0xe929
-17930,	 // 0x460a
- 1586,	 // 0x0632
-17126,	 // 0x42e6
-  996,	 // 0x03e4
-41911,	 // 0xa3b7
-57588,	 // 0xe0f4
-14067,	 // 0x36f3
-62188,	 // 0xf2ec
-54779,	 // 0xd5fb
-57429,	 // 0xe055
-43804,	 // 0xab1c
- 4889,	 // 0x1319
-50428,	 // 0xc4fc
- 9521,	 // 0x2531
-25824,	 // 0x64e0
-63019,	 // 0xf62b
- 9232,	 // 0x2410
-64016,	 // 0xfa10
-56046,	 // 0xdaee
-54586,	 // 0xd53a
-  325,	 // 0x0145
-51462,	 // 0xc906
- 4758,	 // 0x1296
-51478,	 // 0xc916
- 9593,	 // 0x2579
-23038,	 // 0x59fe
-63743,	 // 0xf8ff
-19971,	 // 0x4e03
-14622,	 // 0x391e
-63754,	 // 0xf90a
-63628,	 // 0xf88c
-  734,	 // 0x02de
- 8036,	 // 0x1f64
-  261,	 // 0x0105
- 4395,	 // 0x112b
-41778,	 // 0xa332
-54759,	 // 0xd5e7
-  248,	 // 0x00f8
-18940,	 // 0x49fc
- 3317,	 // 0x0cf5
-62976,	 // 0xf600
-  773,	 // 0x0305
-60169,	 // 0xeb09
- 7947,	 // 0x1f0b
-11740,	 // 0x2ddc
- 1561,	 // 0x0619
-12808,	 // 0x3208
-65276,	 // 0xfefc
-49173,	 // 0xc015
-65304,	 // 0xff18
-55268,	 // 0xd7e4
-60401,	 // 0xebf1
-  129,	 // 0x0081
-64344,	 // 0xfb58
-60280,	 // 0xeb78
- 2279,	 // 0x08e7
- 3077,	 // 0x0c05
- 9963,	 // 0x26eb
-62218,	 // 0xf30a
-   36,	 // 0x0024
-62984,	 // 0xf608
- 2317,	 // 0x090d
-57083,	 // 0xdefb
-12801,	 // 0x3201
- 1799,	 // 0x0707
-  789,	 // 0x0315
- 8778,	 // 0x224a
-56061,	 // 0xdafd
- 7139,	 // 0x1be3
- 5320,	 // 0x14c8
- 4331,	 // 0x10eb
-64494,	 // 0xfbee
- 1796,	 // 0x0704
- 8472,	 // 0x2118
-60137,	 // 0xeae9
-59945,	 // 0xea29
-  757,	 // 0x02f5
- 3074,	 // 0x0c02
-64255,	 // 0xfaff
-63252,	 // 0xf714
- 1824,	 // 0x0720
-62464,	 // 0xf400
-54799,	 // 0xd60f
-59656,	 // 0xe908
- 2753,	 // 0x0ac1
-61920,	 // 0xf1e0
- 2549,	 // 0x09f5
-61680,	 // 0xf0f0
-60446,	 // 0xec1e
- 5399,	 // 0x1517
- 4621,	 // 0x120d
- 2814,	 // 0x0afe
- 8959,	 // 0x22ff
- 2547,	 // 0x09f3
- 4095,	 // 0x0fff
-63765,	 // 0xf915
-62469,	 // 0xf405
-60933,	 // 0xee05
- 2790,	 // 0x0ae6
- 2994,	 // 0x0bb2
-61095,	 // 0xeea7
-58050,	 // 0xe2c2
- 3066,	 // 0x0bfa
-64438,	 // 0xfbb6
- 2326,	 // 0x0916
- 3118,	 // 0x0c2e
-58611,	 // 0xe4f3
-10236,	 // 0x27fc
-65237,	 // 0xfed5
- 5351,	 // 0x14e7
- 4587,	 // 0x11eb
-63783,	 // 0xf927
- 2573,	 // 0x0a0d
- 5891,	 // 0x1703
- 1291,	 // 0x050b
-57580,	 // 0xe0ec
-56833,	 // 0xde01
- 9469,	 // 0x24fd
- 1286,	 // 0x0506
- 2583,	 // 0x0a17
-13824,	 // 0x3600
- 3849,	 // 0x0f09
- 5617,	 // 0x15f1
-32546,	 // 0x7f22
- 1919,	 // 0x077f
-14601,	 // 0x3909
- 3600,	 // 0x0e10
-13875,	 // 0x3633
-65065,	 // 0xfe29
-56311,	 // 0xdbf7
-54820,	 // 0xd624
- 2054,	 // 0x0806
-49147,	 // 0xbffb
- 4114,	 // 0x1012
-    7,	 // 0x0007
-57290,	 // 0xdfca
-63446,	 // 0xf7d6
-   14,	 // 0x000e
- 9990,	 // 0x2706
-64484,	 // 0xfbe4
-63708,	 // 0xf8dc
-54995,	 // 0xd6d3
-17175,	 // 0x4317
-54255,	 // 0xd3ef
- 7723,	 // 0x1e2b
-60395,	 // 0xebeb
-56596,	 // 0xdd14
- 2287,	 // 0x08ef
- 7857,	 // 0x1eb1
-65019,	 // 0xfdfb
- 3881,	 // 0x0f29
-17921,	 // 0x4601
-13530,	 // 0x34da
-61241,	 // 0xef39
-61193,	 // 0xef09
-63540,	 // 0xf834
- 6451,	 // 0x1933
- 9994,	 // 0x270a
- 6155,	 // 0x180b
- 3305,	 // 0x0ce9
-61434,	 // 0xeffa
-16917,	 // 0x4215
-45026,	 // 0xafe2
-61403,	 // 0xefdb
-51617,	 // 0xc9a1
-64069,	 // 0xfa45
-18078,	 // 0x469e
-37783,	 // 0x9397
-49970,	 // 0xc332
- 2268,	 // 0x08dc
- 2993,	 // 0x0bb1
-64493,	 // 0xfbed
-51732,	 // 0xca14
-62701,	 // 0xf4ed
-51443,	 // 0xc8f3
-11862,	 // 0x2e56
- 7138,	 // 0x1be2
-64280,	 // 0xfb18
-26910,	 // 0x691e
-12271,	 // 0x2fef
-22475,	 // 0x57cb
-64508,	 // 0xfbfc
- 5505,	 // 0x1581
-38925,	 // 0x980d
-36896,	 // 0x9020
-62436,	 // 0xf3e4
- 5120,	 // 0x1400
-49125,	 // 0xbfe5
-15865,	 // 0x3df9
-62730,	 // 0xf50a
-64610,	 // 0xfc62
- 5361,	 // 0x14f1
- 4846,	 // 0x12ee
-15591,	 // 0x3ce7
-  812,	 // 0x032c
-60679,	 // 0xed07
-65515,	 // 0xffeb
- 4595,	 // 0x11f3
-64588,	 // 0xfc4c
- 3031,	 // 0x0bd7
-12041,	 // 0x2f09
-62754,	 // 0xf522
- 7174,	 // 0x1c06
-51859,	 // 0xca93
- 2336,	 // 0x0920
- 4107,	 // 0x100b
-56588,	 // 0xdd0c
-59922,	 // 0xea12
-63737,	 // 0xf8f9
-11006,	 // 0x2afe
- 3308,	 // 0x0cec
-26352,	 // 0x66f0
-  237,	 // 0x00ed
-60161,	 // 0xeb01
-62463,	 // 0xf3ff
-63519,	 // 0xf81f
- 1084,	 // 0x043c
-63230,	 // 0xf6fe
- 2828,	 // 0x0b0c
- 3845,	 // 0x0f05
-62718,	 // 0xf4fe
-60674,	 // 0xed02
- 5632,	 // 0x1600
-60159,	 // 0xeaff
- 6364,	 // 0x18dc
-   12,	 // 0x000c
-63274,	 // 0xf72a
-  765,	 // 0x02fd
- 4445,	 // 0x115d
-65069,	 // 0xfe2d
-64809,	 // 0xfd29
-60228,	 // 0xeb44
-64308,	 // 0xfb34
-64020,	 // 0xfa14
-64753,	 // 0xfcf1
-    2,	 // 0x0002
-57356,	 // 0xe00c
- 2294,	 // 0x08f6
-52216,	 // 0xcbf8
-46332,	 // 0xb4fc
-60931,	 // 0xee03
- 1527,	 // 0x05f7
-  269,	 // 0x010d
- 1495,	 // 0x05d7
- 3362,	 // 0x0d22
-62154,	 // 0xf2ca
-62716,	 // 0xf4fc
-64516,	 // 0xfc04
- 1536,	 // 0x0600
-61687,	 // 0xf0f7
-  253,	 // 0x00fd
-65034,	 // 0xfe0a
- 1804,	 // 0x070c
-54260,	 // 0xd3f4
-64779,	 // 0xfd0b
-33029,	 // 0x8105
-64272,	 // 0xfb10
- 1407,	 // 0x057f
-65274,	 // 0xfefa
-64522,	 // 0xfc0a
- 2814,	 // 0x0afe
-  766,	 // 0x02fe
- 3585,	 // 0x0e01
- 1014,	 // 0x03f6
-65275,	 // 0xfefb
-  265,	 // 0x0109
- 3068,	 // 0x0bfc
-64505,	 // 0xfbf9
-  266,	 // 0x010a
-28160,	 // 0x6e00
-62711,	 // 0xf4f7
-  759,	 // 0x02f7
-63500,	 // 0xf80c
-  266,	 // 0x010a
-65274,	 // 0xfefa
- 5125,	 // 0x1405
-63494,	 // 0xf806
-  255,	 // 0x00ff
- 2048,	 // 0x0800
-65025,	 // 0xfe01
-  515,	 // 0x0203
-64250,	 // 0xfafa
- 3073,	 // 0x0c01
- 1283,	 // 0x0503
- 1026,	 // 0x0402
- 1273,	 // 0x04f9
-  762,	 // 0x02fa
- 5632,	 // 0x1600
-   10,	 // 0x000a
-64517,	 // 0xfc05
- 1025,	 // 0x0401
-   12,	 // 0x000c
- 1712,	 // 0x06b0
- 3338,	 // 0x0d0a
- 3846,	 // 0x0f06
-65283,	 // 0xff03
-  775,	 // 0x0307
-65530,	 // 0xfffa
-64512,	 // 0xfc00
- 2313,	 // 0x0909
-26608,	 // 0x67f0
-61042,	 // 0xee72
-33256,	 // 0x81e8
- 1314,	 // 0x0522
- 9257,	 // 0x2429
- 6654,	 // 0x19fe
-64797,	 // 0xfd1d
- 1069,	 // 0x042d
- 6153,	 // 0x1809
-  502,	 // 0x01f6
-19780,	 // 0x4d44
- 6351,	 // 0x18cf
- 4607,	 // 0x11ff
-24602,	 // 0x601a
-13610,	 // 0x352a
-64237,	 // 0xfaed
-58887,	 // 0xe607
- 6174,	 // 0x181e
- 5246,	 // 0x147e
- 2074,	 // 0x081a
- 1532,	 // 0x05fc
-62750,	 // 0xf51e
-62718,	 // 0xf4fe
-63501,	 // 0xf80d
- 1531,	 // 0x05fb
-16414,	 // 0x401e
-21292,	 // 0x532c
-49389,	 // 0xc0ed
-63003,	 // 0xf61b
-20765,	 // 0x511d
-10593,	 // 0x2961
-64456,	 // 0xfbc8
-59876,	 // 0xe9e4
-59632,	 // 0xe8f0
- 2532,	 // 0x09e4
- 4667,	 // 0x123b
- 1471,	 // 0x05bf
-12822,	 // 0x3216
- 6174,	 // 0x181e
- 5400,	 // 0x1518
-63473,	 // 0xf7f1
- 4869,	 // 0x1305
-    0,	 // 0x0000
- 3305,	 // 0x0ce9
- 2815,	 // 0x0aff
- 2353,	 // 0x0931
- 5360,	 // 0x14f0
- 1271,	 // 0x04f7
- 5396,	 // 0x1514
- 1541,	 // 0x0605
- 5389,	 // 0x150d
- 1800,	 // 0x0708
- 3325,	 // 0x0cfd
- 5633,	 // 0x1601
- 6151,	 // 0x1807
-65010,	 // 0xfdf2
-  254,	 // 0x00fe
- 9468,	 // 0x24fc
- 5632,	 // 0x1600
-  262,	 // 0x0106
-60429,	 // 0xec0d
- 3303,	 // 0x0ce7
- 4851,	 // 0x12f3
-62990,	 // 0xf60e
- 3830,	 // 0x0ef6
-63254,	 // 0xf716
- 2822,	 // 0x0b06
-64777,	 // 0xfd09
- 1276,	 // 0x04fc
- 3338,	 // 0x0d0a
- 1275,	 // 0x04fb
-63748,	 // 0xf904
-64277,	 // 0xfb15
-63250,	 // 0xf712
- 1784,	 // 0x06f8
-65260,	 // 0xfeec
-65516,	 // 0xffec
-65524,	 // 0xfff4
-    2,	 // 0x0002
- 5382,	 // 0x1506
- 3555,	 // 0x0de3
-65027,	 // 0xfe03
-  266,	 // 0x010a
-65279,	 // 0xfeff
- 1289,	 // 0x0509
-61958,	 // 0xf206
-  777,	 // 0x0309
-32765,	 // 0x7ffd
-27064,	 // 0x69b8
-55573,	 // 0xd915
-63226,	 // 0xf6fa
- 5102,	 // 0x13ee
-65050,	 // 0xfe1a
- 2537,	 // 0x09e9
- 1286,	 // 0x0506
-57428,	 // 0xe054
-56353,	 // 0xdc21
-58424,	 // 0xe438
-50411,	 // 0xc4eb
- 9973,	 // 0x26f5
-27841,	 // 0x6cc1
-65268,	 // 0xfef4
- 6411,	 // 0x190b
- 2177,	 // 0x0881
- 5434,	 // 0x153a
-65320,	 // 0xff28
-58019,	 // 0xe2a3
-63753,	 // 0xf909
- 6489,	 // 0x1959
-54025,	 // 0xd309
-62238,	 // 0xf31e
- 2519,	 // 0x09d7
- 1542,	 // 0x0606
-64714,	 // 0xfcca
- 5464,	 // 0x1558
-56334,	 // 0xdc0e
-48632,	 // 0xbdf8
-22535,	 // 0x5807
- 1314,	 // 0x0522
- 4913,	 // 0x1331
- 5804,	 // 0x16ac
-61649,	 // 0xf0d1
-  751,	 // 0x02ef
-14640,	 // 0x3930
-  492,	 // 0x01ec
-65535,	 // 0xffff
-56792,	 // 0xddd8
-64253,	 // 0xfafd
- 4335,	 // 0x10ef
-53247,	 // 0xcfff
-  490,	 // 0x01ea
-20988,	 // 0x51fc
-  778,	 // 0x030a
- 1277,	 // 0x04fd
- 5901,	 // 0x170d
-    1,	 // 0x0001
-10804,	 // 0x2a34
-52448,	 // 0xcce0
-61430,	 // 0xeff6
- 3849,	 // 0x0f09
- 9713,	 // 0x25f1
-  323,	 // 0x0143
- 7667,	 // 0x1df3
-63965,	 // 0xf9dd
- 4558,	 // 0x11ce
-65523,	 // 0xfff3
-65265,	 // 0xfef1
-62448,	 // 0xf3f0
-64737,	 // 0xfce1
-38088,	 // 0x94c8
-11504,	 // 0x2cf0
-40948,	 // 0x9ff4
-20726,	 // 0x50f6
-54263,	 // 0xd3f7
-24869,	 // 0x6125
- 3224,	 // 0x0c98
- 2560,	 // 0x0a00
-64749,	 // 0xfced
-61744,	 // 0xf130
- 2078,	 // 0x081e
-  721,	 // 0x02d1
-64549,	 // 0xfc25
-60732,	 // 0xed3c
-62518,	 // 0xf436
-62506,	 // 0xf42a
- 9968,	 // 0x26f0
- 4101,	 // 0x1005
- 5349,	 // 0x14e5
-32514,	 // 0x7f02
- 4106,	 // 0x100a
-47090,	 // 0xb7f2
-62784,	 // 0xf540
-58398,	 // 0xe41e
-64541,	 // 0xfc1d
-   21,	 // 0x0015
-58368,	 // 0xe400
-65484,	 // 0xffcc
-12036,	 // 0x2f04
- 7424,	 // 0x1d00
-17175,	 // 0x4317
-63461,	 // 0xf7e5
-60159,	 // 0xeaff
-64512,	 // 0xfc00
- 6145,	 // 0x1801
- 4579,	 // 0x11e3
- 2040,	 // 0x07f8
- 6126,	 // 0x17ee
- 2062,	 // 0x080e
-54800,	 // 0xd610
- 1281,	 // 0x0501
-  504,	 // 0x01f8
-64592,	 // 0xfc50
-62182,	 // 0xf2e6
-62765,	 // 0xf52d
-63359,	 // 0xf77f
-59087,	 // 0xe6cf
-64706,	 // 0xfcc2
-65369,	 // 0xff59
-61439,	 // 0xefff
- 1509,	 // 0x05e5
-64275,	 // 0xfb13
- 1033,	 // 0x0409
-10708,	 // 0x29d4
- 3376,	 // 0x0d30
-  740,	 // 0x02e4
-65270,	 // 0xfef6
-63195,	 // 0xf6db
-63749,	 // 0xf905
-62734,	 // 0xf50e
-61157,	 // 0xeee5
-63762,	 // 0xf912
-  242,	 // 0x00f2
-56825,	 // 0xddf9
- 4364,	 // 0x110c
- 1530,	 // 0x05fa
-61218,	 // 0xef22
- 2552,	 // 0x09f8
-54773,	 // 0xd5f5
-11510,	 // 0x2cf6
-61442,	 // 0xf002
- 3864,	 // 0x0f18
- 9229,	 // 0x240d
- 7694,	 // 0x1e0e
-56833,	 // 0xde01
-64696,	 // 0xfcb8
-62497,	 // 0xf421
- 2050,	 // 0x0802
-58365,	 // 0xe3fd
-  755,	 // 0x02f3
- 1819,	 // 0x071b
- 2323,	 // 0x0913
-  523,	 // 0x020b
-62447,	 // 0xf3ef
-64986,	 // 0xfdda
-15615,	 // 0x3cff
-63212,	 // 0xf6ec
-62847,	 // 0xf57f
-61869,	 // 0xf1ad
-  983,	 // 0x03d7
-58392,	 // 0xe418
- 1768,	 // 0x06e8
-64493,	 // 0xfbed
-61955,	 // 0xf203
-62487,	 // 0xf417
-61700,	 // 0xf104
-61898,	 // 0xf1ca
-63488,	 // 0xf800
-60673,	 // 0xed01
-60182,	 // 0xeb16
-63491,	 // 0xf803
-62940,	 // 0xf5dc
-  777,	 // 0x0309
-61215,	 // 0xef1f
- 3646,	 // 0x0e3e
-   30,	 // 0x001e
- 2028,	 // 0x07ec
- 8955,	 // 0x22fb
-63211,	 // 0xf6eb
-64515,	 // 0xfc03
-63498,	 // 0xf80a
- 5110,	 // 0x13f6
-62210,	 // 0xf302
-61182,	 // 0xeefe
- 9472,	 // 0x2500
- 2798,	 // 0x0aee
-63739,	 // 0xf8fb
- 2302,	 // 0x08fe
- 1799,	 // 0x0707
-65070,	 // 0xfe2e
-65298,	 // 0xff12
- 1016,	 // 0x03f8
-57852,	 // 0xe1fc
-60912,	 // 0xedf0
-  766,	 // 0x02fe
- 4600,	 // 0x11f8
-63236,	 // 0xf704
- 4884,	 // 0x1314
-  510,	 // 0x01fe
-64002,	 // 0xfa02
-  524,	 // 0x020c
-  252,	 // 0x00fc
-  266,	 // 0x010a
-  641,	 // 0x0281
-61414,	 // 0xefe6
-  715,	 // 0x02cb
-  529,	 // 0x0211
- 1024,	 // 0x0400
-    3,	 // 0x0003
- 6142,	 // 0x17fe
-  529,	 // 0x0211
- 5126,	 // 0x1406
- 3080,	 // 0x0c08
-57090,	 // 0xdf02
-65535,	 // 0xffff
-65523,	 // 0xfff3
- 2775,	 // 0x0ad7
-62503,	 // 0xf427
-  774,	 // 0x0306
- 1023,	 // 0x03ff
-62211,	 // 0xf303
- 1541,	 // 0x0605
-63748,	 // 0xf904
-  766,	 // 0x02fe
- 1805,	 // 0x070d
-  258,	 // 0x0102
- 5630,	 // 0x15fe
- 3327,	 // 0x0cff
-13569,	 // 0x3501
-59857,	 // 0xe9d1
- 1036,	 // 0x040c
-64256,	 // 0xfb00
-63985,	 // 0xf9f1
-65496,	 // 0xffd8
-65019,	 // 0xfdfb
- 3335,	 // 0x0d07
-19964,	 // 0x4dfc
- 1025,	 // 0x0401
-65014,	 // 0xfdf6
- 2063,	 // 0x080f
- 1008,	 // 0x03f0
-59141,	 // 0xe705
-  530,	 // 0x0212
-64299,	 // 0xfb2b
-62655,	 // 0xf4bf
- 3135,	 // 0x0c3f
-65051,	 // 0xfe1b
-63223,	 // 0xf6f7
- 1576,	 // 0x0628
- 1153,	 // 0x0481
-   41,	 // 0x0029
-64764,	 // 0xfcfc
- 1009,	 // 0x03f1
- 4100,	 // 0x1004
- 9433,	 // 0x24d9
- 8435,	 // 0x20f3
-  757,	 // 0x02f5
- 4347,	 // 0x10fb
-64005,	 // 0xfa05
-63802,	 // 0xf93a
-59175,	 // 0xe727
-55037,	 // 0xd6fd
-65502,	 // 0xffde
- 9224,	 // 0x2408
-64260,	 // 0xfb04
-60154,	 // 0xeafa
- 7159,	 // 0x1bf7
-64756,	 // 0xfcf4
-  976,	 // 0x03d0
- 3583,	 // 0x0dff
-50427,	 // 0xc4fb
-62722,	 // 0xf502
-33539,	 // 0x8303
-60721,	 // 0xed31
-61433,	 // 0xeff9
- 3856,	 // 0x0f10
-63747,	 // 0xf903
-65030,	 // 0xfe06
- 2305,	 // 0x0901
-60682,	 // 0xed0a
-64757,	 // 0xfcf5
-37398,	 // 0x9216
-64787,	 // 0xfd13
-48378,	 // 0xbcfa
- 3081,	 // 0x0c09
- 8473,	 // 0x2119
-65282,	 // 0xff02
-58074,	 // 0xe2da
-59119,	 // 0xe6ef
-64211,	 // 0xfad3
- 2576,	 // 0x0a10
- 3718,	 // 0x0e86
- 7119,	 // 0x1bcf
- 1994,	 // 0x07ca
-63957,	 // 0xf9d5
-   17,	 // 0x0011
-  260,	 // 0x0104
-65276,	 // 0xfefc
-59897,	 // 0xe9f9
-62479,	 // 0xf40f
-33045,	 // 0x8115
-42513,	 // 0xa611
-63493,	 // 0xf805
-64759,	 // 0xfcf7
- 8820,	 // 0x2274
- 5303,	 // 0x14b7
- 9467,	 // 0x24fb
- 3832,	 // 0x0ef8
-58103,	 // 0xe2f7
-65029,	 // 0xfe05
- 4829,	 // 0x12dd
- 1044,	 // 0x0414
- 3314,	 // 0x0cf2
- 3047,	 // 0x0be7
- 7443,	 // 0x1d13
-63713,	 // 0xf8e1
-25086,	 // 0x61fe
- 7200,	 // 0x1c20
-64249,	 // 0xfaf9
-54299,	 // 0xd41b
- 3304,	 // 0x0ce8
-  779,	 // 0x030b
-64259,	 // 0xfb03
- 1806,	 // 0x070e
- 1482,	 // 0x05ca
-60454,	 // 0xec26
-  759,	 // 0x02f7
-59375,	 // 0xe7ef
- 3327,	 // 0x0cff
- 3618,	 // 0x0e22
- 1791,	 // 0x06ff
-60646,	 // 0xece6
-58110,	 // 0xe2fe
-64474,	 // 0xfbda
-  777,	 // 0x0309
-64257,	 // 0xfb01
-  267,	 // 0x010b
-64015,	 // 0xfa0f
-   15,	 // 0x000f
- 8691,	 // 0x21f3
-65284,	 // 0xff04
-61209,	 // 0xef19
- 3604,	 // 0x0e14
- 1796,	 // 0x0704
-11781,	 // 0x2e05
-13317,	 // 0x3405
-62207,	 // 0xf2ff
-  753,	 // 0x02f1
- 8213,	 // 0x2015
-59633,	 // 0xe8f1
-64546,	 // 0xfc22
- 2049,	 // 0x0801
- 2579,	 // 0x0a13
- 2053,	 // 0x0805
-10241,	 // 0x2801
-  503,	 // 0x01f7
- 7435,	 // 0x1d0b
- 2319,	 // 0x090f
-61185,	 // 0xef01
- 1787,	 // 0x06fb
-32529,	 // 0x7f11
-59429,	 // 0xe825
-11255,	 // 0x2bf7
-33060,	 // 0x8124
-59191,	 // 0xe737
- 4387,	 // 0x1123
- 3795,	 // 0x0ed3
-65036,	 // 0xfe0c
-25898,	 // 0x652a
-57400,	 // 0xe038
-59885,	 // 0xe9ed
-  263,	 // 0x0107
-62723,	 // 0xf503
-27123,	 // 0x69f3
-61692,	 // 0xf0fc
-  541,	 // 0x021d
-61094,	 // 0xeea6
-65508,	 // 0xffe4
-61342,	 // 0xef9e
-62476,	 // 0xf40c
- 2338,	 // 0x0922
- 8214,	 // 0x2016
-65527,	 // 0xfff7
-63227,	 // 0xf6fb
- 3847,	 // 0x0f07
-58351,	 // 0xe3ef
-10720,	 // 0x29e0
- 2623,	 // 0x0a3f
-10217,	 // 0x27e9
-19194,	 // 0x4afa
-56818,	 // 0xddf2
- 4431,	 // 0x114f
-62414,	 // 0xf3ce
-62221,	 // 0xf30d
-  604,	 // 0x025c
- 4597,	 // 0x11f5
-62718,	 // 0xf4fe
-63747,	 // 0xf903
-  509,	 // 0x01fd
-63736,	 // 0xf8f8
-  302,	 // 0x012e
-62480,	 // 0xf410
-26885,	 // 0x6905
-61215,	 // 0xef1f
-49924,	 // 0xc304
- 3091,	 // 0x0c13
- 6071,	 // 0x17b7
-62463,	 // 0xf3ff
- 1246,	 // 0x04de
- 3313,	 // 0x0cf1
-  469,	 // 0x01d5
-60211,	 // 0xeb33
-10501,	 // 0x2905
- 1523,	 // 0x05f3
-10293,	 // 0x2835
-14831,	 // 0x39ef
- 1788,	 // 0x06fc
-48643,	 // 0xbe03
-58644,	 // 0xe514
- 3531,	 // 0x0dcb
-64530,	 // 0xfc12
-57380,	 // 0xe024
- 3573,	 // 0x0df5
- 6163,	 // 0x1813
-56721,	 // 0xdd91
- 9495,	 // 0x2517
- 5833,	 // 0x16c9
-10755,	 // 0x2a03
-64806,	 // 0xfd26
-11250,	 // 0x2bf2
-11289,	 // 0x2c19
-58870,	 // 0xe5f6
- 2560,	 // 0x0a00
- 4643,	 // 0x1223
- 6445,	 // 0x192d
- 4654,	 // 0x122e
-65041,	 // 0xfe11
-57853,	 // 0xe1fd
- 7954,	 // 0x1f12
- 2300,	 // 0x08fc
- 2317,	 // 0x090d
- 7734,	 // 0x1e36
-19472,	 // 0x4c10
- 4887,	 // 0x1317
-  997,	 // 0x03e5
- 5652,	 // 0x1614
- 1292,	 // 0x050c
-62729,	 // 0xf509
-32763,	 // 0x7ffb
-62729,	 // 0xf509
-61440,	 // 0xf000
-63519,	 // 0xf81f
-  448,	 // 0x01c0
- 1541,	 // 0x0605
-  496,	 // 0x01f0
-63493,	 // 0xf805
- 6393,	 // 0x18f9
-59413,	 // 0xe815
- 2812,	 // 0x0afc
-61178,	 // 0xeefa
-60163,	 // 0xeb03
-14567,	 // 0x38e7
-64515,	 // 0xfc03
-59618,	 // 0xe8e2
- 4835,	 // 0x12e3
-  252,	 // 0x00fc
- 1033,	 // 0x0409
- 1251,	 // 0x04e3
- 3866,	 // 0x0f1a
-64506,	 // 0xfbfa
- 1031,	 // 0x0407
- 2291,	 // 0x08f3
-65025,	 // 0xfe01
-59397,	 // 0xe805
-60373,	 // 0xebd5
-63762,	 // 0xf912
-32522,	 // 0x7f0a
-19961,	 // 0x4df9
-64259,	 // 0xfb03
-63994,	 // 0xf9fa
-62473,	 // 0xf409
-    2,	 // 0x0002
- 1006,	 // 0x03ee
-65021,	 // 0xfdfd
- 1006,	 // 0x03ee
-63744,	 // 0xf900
- 3826,	 // 0x0ef2
- 1537,	 // 0x0601
- 1015,	 // 0x03f7
-64523,	 // 0xfc0b
- 4103,	 // 0x1007
-    8,	 // 0x0008
-10505,	 // 0x2909
-46351,	 // 0xb50f
-  518,	 // 0x0206
-59126,	 // 0xe6f6
- 3858,	 // 0x0f12
-   23,	 // 0x0017
-10236,	 // 0x27fc
- 2553,	 // 0x09f9
-59085,	 // 0xe6cd
-60944,	 // 0xee10
- 7698,	 // 0x1e12
-65306,	 // 0xff1a
-64510,	 // 0xfbfe
-  273,	 // 0x0111
- 1282,	 // 0x0502
-61972,	 // 0xf214
-63813,	 // 0xf945
-61946,	 // 0xf1fa
-13086,	 // 0x331e
-64818,	 // 0xfd32
-65014,	 // 0xfdf6
-  493,	 // 0x01ed
-61956,	 // 0xf204
-63496,	 // 0xf808
-65289,	 // 0xff09
-60443,	 // 0xec1b
-61745,	 // 0xf131
-63478,	 // 0xf7f6
-53519,	 // 0xd10f
-57625,	 // 0xe119
-14094,	 // 0x370e
-63773,	 // 0xf91d
- 2319,	 // 0x090f
-62720,	 // 0xf500
-  208,	 // 0x00d0
- 1281,	 // 0x0501
-48114,	 // 0xbbf2
- 1017,	 // 0x03f9
- 1019,	 // 0x03fb
- 1271,	 // 0x04f7
-60410,	 // 0xebfa
- 4864,	 // 0x1300
-14090,	 // 0x370a
- 4094,	 // 0x0ffe
-32526,	 // 0x7f0e
-56069,	 // 0xdb05
-13019,	 // 0x32db
-62457,	 // 0xf3f9
- 5125,	 // 0x1405
- 1093,	 // 0x0445
-10505,	 // 0x2909
- 6914,	 // 0x1b02
-21711,	 // 0x54cf
-58623,	 // 0xe4ff
- 8729,	 // 0x2219
-52067,	 // 0xcb63
-63167,	 // 0xf6bf
- 7142,	 // 0x1be6
-53528,	 // 0xd118
-59390,	 // 0xe7fe
-52940,	 // 0xcecc
-61311,	 // 0xef7f
- 6394,	 // 0x18fa
-55804,	 // 0xd9fc
- 9904,	 // 0x26b0
-   33,	 // 0x0021
-61703,	 // 0xf107
-19463,	 // 0x4c07
- 2043,	 // 0x07fb
- 2577,	 // 0x0a11
-16062,	 // 0x3ebe
-24577,	 // 0x6001
-   18,	 // 0x0012
-14606,	 // 0x390e
-53262,	 // 0xd00e
-  290,	 // 0x0122
-15434,	 // 0x3c4a
-51704,	 // 0xc9f8
-65260,	 // 0xfeec
- 4607,	 // 0x11ff
-  735,	 // 0x02df
-18967,	 // 0x4a17
-14856,	 // 0x3a08
-  226,	 // 0x00e2
-62066,	 // 0xf272
- 3372,	 // 0x0d2c
-59890,	 // 0xe9f2
-65043,	 // 0xfe13
-40190,	 // 0x9cfe
- 2482,	 // 0x09b2
-63747,	 // 0xf903
-59907,	 // 0xea03
-10452,	 // 0x28d4
-  466,	 // 0x01d2
- 2797,	 // 0x0aed
-10243,	 // 0x2803
-37387,	 // 0x920b
-27615,	 // 0x6bdf
-61453,	 // 0xf00d
-32534,	 // 0x7f16
-61947,	 // 0xf1fb
-53245,	 // 0xcffd
- 2296,	 // 0x08f8
-10275,	 // 0x2823
- 3321,	 // 0x0cf9
- 3103,	 // 0x0c1f
-63735,	 // 0xf8f7
- 5417,	 // 0x1529
- 3834,	 // 0x0efa
-61951,	 // 0xf1ff
-62414,	 // 0xf3ce
-59384,	 // 0xe7f8
-  481,	 // 0x01e1
-18161,	 // 0x46f1
- 1559,	 // 0x0617
- 4080,	 // 0x0ff0
- 1316,	 // 0x0524
-64492,	 // 0xfbec
-63002,	 // 0xf61a
-64830,	 // 0xfd3e
-  444,	 // 0x01bc
- 7207,	 // 0x1c27
-58127,	 // 0xe30f
-  271,	 // 0x010f
- 5084,	 // 0x13dc
-52478,	 // 0xccfe
- 1558,	 // 0x0616
- 2566,	 // 0x0a06
-62668,	 // 0xf4cc
-62441,	 // 0xf3e9
-60430,	 // 0xec0e
- 4108,	 // 0x100c
-16888,	 // 0x41f8
-61790,	 // 0xf15e
-62986,	 // 0xf60a
- 8961,	 // 0x2301
- 9857,	 // 0x2681
-58614,	 // 0xe4f6
-64771,	 // 0xfd03
-56581,	 // 0xdd05
-20975,	 // 0x51ef
-57109,	 // 0xdf15
- 5638,	 // 0x1606
-65266,	 // 0xfef2
-60927,	 // 0xedff
-15090,	 // 0x3af2
- 3842,	 // 0x0f02
-62881,	 // 0xf5a1
-64009,	 // 0xfa09
- 2339,	 // 0x0923
- 1729,	 // 0x06c1
-  506,	 // 0x01fa
- 9459,	 // 0x24f3
- 6689,	 // 0x1a21
-63737,	 // 0xf8f9
-63743,	 // 0xf8ff
-  754,	 // 0x02f2
-36130,	 // 0x8d22
-62681,	 // 0xf4d9
-57582,	 // 0xe0ee
-38914,	 // 0x9802
-63998,	 // 0xf9fe
-60735,	 // 0xed3f
-61007,	 // 0xee4f
-   62,	 // 0x003e
-42710,	 // 0xa6d6
- 2768,	 // 0x0ad0
- 2053,	 // 0x0805
-58887,	 // 0xe607
-59639,	 // 0xe8f7
- 2845,	 // 0x0b1d
-57807,	 // 0xe1cf
- 1777,	 // 0x06f1
- 2091,	 // 0x082b
-62736,	 // 0xf510
- 2865,	 // 0x0b31
-54558,	 // 0xd51e
- 1077,	 // 0x0435
-65268,	 // 0xfef4
-12211,	 // 0x2fb3
-63535,	 // 0xf82f
- 3574,	 // 0x0df6
-63489,	 // 0xf801
-10273,	 // 0x2821
-61687,	 // 0xf0f7
-48326,	 // 0xbcc6
- 9469,	 // 0x24fd
-38892,	 // 0x97ec
-60940,	 // 0xee0c
-50203,	 // 0xc41b
-57340,	 // 0xdffc
-50399,	 // 0xc4df
-50175,	 // 0xc3ff
-33031,	 // 0x8107
-63449,	 // 0xf7d9
-59631,	 // 0xe8ef
-63770,	 // 0xf91a
- 3348,	 // 0x0d14
-  792,	 // 0x0318
- 2083,	 // 0x0823
- 3080,	 // 0x0c08
- 1328,	 // 0x0530
- 6132,	 // 0x17f4
- 5624,	 // 0x15f8
-11772,	 // 0x2dfc
-58380,	 // 0xe40c
-62961,	 // 0xf5f1
-    7,	 // 0x0007
-60162,	 // 0xeb02
-25335,	 // 0x62f7
- 2575,	 // 0x0a0f
-63744,	 // 0xf900
-63440,	 // 0xf7d0
-64262,	 // 0xfb06
- 2023,	 // 0x07e7
-65516,	 // 0xffec
- 1016,	 // 0x03f8
-65531,	 // 0xfffb
-59127,	 // 0xe6f7
-60672,	 // 0xed00
-52245,	 // 0xcc15
-24190,	 // 0x5e7e
-62723,	 // 0xf503
-54275,	 // 0xd403
-56478,	 // 0xdc9e
- 4303,	 // 0x10cf
- 7203,	 // 0x1c23
-65302,	 // 0xff16
-42262,	 // 0xa516
-45335,	 // 0xb117
- 5837,	 // 0x16cd
-51991,	 // 0xcb17
- 5643,	 // 0x160b
-32516,	 // 0x7f04
-58879,	 // 0xe5ff
-20483,	 // 0x5003
-65352,	 // 0xff48
-50334,	 // 0xc49e
-60310,	 // 0xeb96
-65292,	 // 0xff0c
-56845,	 // 0xde0d
- 9782,	 // 0x2636
-63742,	 // 0xf8fe
-61449,	 // 0xf009
-65265,	 // 0xfef1
-16390,	 // 0x4006
-63751,	 // 0xf907
-17628,	 // 0x44dc
-41679,	 // 0xa2cf
-54780,	 // 0xd5fc
-58363,	 // 0xe3fb
-64795,	 // 0xfd1b
- 5402,	 // 0x151a
- 6893,	 // 0x1aed
-12056,	 // 0x2f18
- 1807,	 // 0x070f
-17882,	 // 0x45da
-64256,	 // 0xfb00
- 9441,	 // 0x24e1
-64262,	 // 0xfb06
-62738,	 // 0xf512
-59876,	 // 0xe9e4
-56601,	 // 0xdd19
-61696,	 // 0xf100
-    0,	 // 0x0000
-60898,	 // 0xede2
- 2562,	 // 0x0a02
-48116,	 // 0xbbf4
- 2687,	 // 0x0a7f
-63739,	 // 0xf8fb
-61237,	 // 0xef35
-24048,	 // 0x5df0
-47902,	 // 0xbb1e
-20162,	 // 0x4ec2
- 2316,	 // 0x090c
- 5612,	 // 0x15ec
-49400,	 // 0xc0f8
-56306,	 // 0xdbf2
- 3341,	 // 0x0d0d
- 3564,	 // 0x0dec
- 2374,	 // 0x0946
-12544,	 // 0x3100
-65296,	 // 0xff10
-63443,	 // 0xf7d3
-64046,	 // 0xfa2e
-64759,	 // 0xfcf7
- 2586,	 // 0x0a1a
- 4070,	 // 0x0fe6
- 2060,	 // 0x080c
-30970,	 // 0x78fa
-62029,	 // 0xf24d
-28667,	 // 0x6ffb
-62207,	 // 0xf2ff
-62206,	 // 0xf2fe
- 1545,	 // 0x0609
-65513,	 // 0xffe9
-58557,	 // 0xe4bd
-49678,	 // 0xc20e
-59384,	 // 0xe7f8
-65533,	 // 0xfffd
-64222,	 // 0xfade
- 5628,	 // 0x15fc
- 3604,	 // 0x0e14
- 2298,	 // 0x08fa
-  507,	 // 0x01fb
- 1795,	 // 0x0703
- 2802,	 // 0x0af2
- 1018,	 // 0x03fa
-15351,	 // 0x3bf7
-63251,	 // 0xf713
- 1516,	 // 0x05ec
-13311,	 // 0x33ff
- 2344,	 // 0x0928
- 4089,	 // 0x0ff9
-63724,	 // 0xf8ec
-64268,	 // 0xfb0c
-57859,	 // 0xe203
- 6393,	 // 0x18f9
- 3320,	 // 0x0cf8
-11012,	 // 0x2b04
-   18,	 // 0x0012
- 1270,	 // 0x04f6
-63998,	 // 0xf9fe
-65191,	 // 0xfea7
-  255,	 // 0x00ff
-64756,	 // 0xfcf4
-65279,	 // 0xfeff
- 2556,	 // 0x09fc
-62254,	 // 0xf32e
- 4091,	 // 0x0ffb
- 2082,	 // 0x0822
- 1537,	 // 0x0601
-    4,	 // 0x0004
- 2294,	 // 0x08f6
-  222,	 // 0x00de
-  263,	 // 0x0107
-40449,	 // 0x9e01
-33279,	 // 0x81ff
-   18,	 // 0x0012
- 1295,	 // 0x050f
-60131,	 // 0xeae3
- 1272,	 // 0x04f8
-65037,	 // 0xfe0d
-  511,	 // 0x01ff
-61961,	 // 0xf209
- 1294,	 // 0x050e
-56334,	 // 0xdc0e
- 2833,	 // 0x0b11
-65289,	 // 0xff09
-64267,	 // 0xfb0b
- 5371,	 // 0x14fb
- 2833,	 // 0x0b11
- 2554,	 // 0x09fa
-57857,	 // 0xe201
-61438,	 // 0xeffe
-53020,	 // 0xcf1c
-19195,	 // 0x4afb
-63638,	 // 0xf896
-13578,	 // 0x350a
-11003,	 // 0x2afb
- 6404,	 // 0x1904
- 8452,	 // 0x2104
- 3120,	 // 0x0c30
-21711,	 // 0x54cf
-  531,	 // 0x0213
-47866,	 // 0xbafa
- 3044,	 // 0x0be4
- 6406,	 // 0x1906
- 4622,	 // 0x120e
- 3199,	 // 0x0c7f
-13849,	 // 0x3619
-14678,	 // 0x3956
-61635,	 // 0xf0c3
-64675,	 // 0xfca3
-43784,	 // 0xab08
-40413,	 // 0x9ddd
-64673,	 // 0xfca1
-15066,	 // 0x3ada
-17421,	 // 0x440d
-61433,	 // 0xeff9
-64895,	 // 0xfd7f
-11191,	 // 0x2bb7
- 2057,	 // 0x0809
- 3844,	 // 0x0f04
-58052,	 // 0xe2c4
- 3568,	 // 0x0df0
-61355,	 // 0xefab
-57381,	 // 0xe025
-  524,	 // 0x020c
-38148,	 // 0x9504
- 6411,	 // 0x190b
-   36,	 // 0x0024
- 2141,	 // 0x085d
- 6857,	 // 0x1ac9
-63005,	 // 0xf61d
- 8152,	 // 0x1fd8
-64225,	 // 0xfae1
-53476,	 // 0xd0e4
-65407,	 // 0xff7f
- 2321,	 // 0x0911
- 1515,	 // 0x05eb
-62480,	 // 0xf410
- 2796,	 // 0x0aec
-57361,	 // 0xe011
-11303,	 // 0x2c27
-64013,	 // 0xfa0d
- 5885,	 // 0x16fd
-63513,	 // 0xf819
-  748,	 // 0x02ec
-63702,	 // 0xf8d6
-29687,	 // 0x73f7
- 1507,	 // 0x05e3
- 5595,	 // 0x15db
- 5616,	 // 0x15f0
-62212,	 // 0xf304
- 1129,	 // 0x0469
- 4093,	 // 0x0ffd
-60465,	 // 0xec31
-11059,	 // 0x2b33
-12010,	 // 0x2eea
-  796,	 // 0x031c
-58654,	 // 0xe51e
- 2522,	 // 0x09da
- 1783,	 // 0x06f7
- 8190,	 // 0x1ffe
-62747,	 // 0xf51b
-59661,	 // 0xe90d
- 4603,	 // 0x11fb
-54012,	 // 0xd2fc
- 1624,	 // 0x0658
-  489,	 // 0x01e9
- 2551,	 // 0x09f7
-63207,	 // 0xf6e7
- 1972,	 // 0x07b4
-61189,	 // 0xef05
-58078,	 // 0xe2de
- 3056,	 // 0x0bf0
- 5168,	 // 0x1430
- 7698,	 // 0x1e12
- 3090,	 // 0x0c12
-29991,	 // 0x7527
- 3054,	 // 0x0bee
-51733,	 // 0xca15
-11526,	 // 0x2d06
-60416,	 // 0xec00
-62989,	 // 0xf60d
-62523,	 // 0xf43b
- 4616,	 // 0x1208
- 1533,	 // 0x05fd
- 1544,	 // 0x0608
-65020,	 // 0xfdfc
- 3819,	 // 0x0eeb
-65012,	 // 0xfdf4
- 3871,	 // 0x0f1f
-  601,	 // 0x0259
-62963,	 // 0xf5f3
-62753,	 // 0xf521
- 6015,	 // 0x177f
-64734,	 // 0xfcde
-63444,	 // 0xf7d4
- 1180,	 // 0x049c
-63567,	 // 0xf84f
- 2268,	 // 0x08dc
-65023,	 // 0xfdff
- 1284,	 // 0x0504
- 5642,	 // 0x160a
-59616,	 // 0xe8e0
-57843,	 // 0xe1f3
- 5621,	 // 0x15f5
-63222,	 // 0xf6f6
-54017,	 // 0xd301
-  214,	 // 0x00d6
- 4853,	 // 0x12f5
-57358,	 // 0xe00e
-63751,	 // 0xf907
-62959,	 // 0xf5ef
-63229,	 // 0xf6fd
-62958,	 // 0xf5ee
-   11,	 // 0x000b
-  514,	 // 0x0202
-62705,	 // 0xf4f1
-62465,	 // 0xf401
-62197,	 // 0xf2f5
-59642,	 // 0xe8fa
-35584,	 // 0x8b00
- 1466,	 // 0x05ba
-59130,	 // 0xe6fa
- 9477,	 // 0x2505
-  496,	 // 0x01f0
-61111,	 // 0xeeb7
-58387,	 // 0xe413
- 2060,	 // 0x080c
-60641,	 // 0xece1
-58883,	 // 0xe603
- 1781,	 // 0x06f5
- 2577,	 // 0x0a11
- 4112,	 // 0x1010
- 8167,	 // 0x1fe7
-62447,	 // 0xf3ef
-   21,	 // 0x0015
- 3073,	 // 0x0c01
- 3037,	 // 0x0bdd
-45120,	 // 0xb040
-51199,	 // 0xc7ff
-27101,	 // 0x69dd
-50477,	 // 0xc52d
-43490,	 // 0xa9e2
-55011,	 // 0xd6e3
-62680,	 // 0xf4d8
-62411,	 // 0xf3cb
-61960,	 // 0xf208
-58103,	 // 0xe2f7
- 7166,	 // 0x1bfe
-60509,	 // 0xec5d
- 1240,	 // 0x04d8
- 2567,	 // 0x0a07
-59653,	 // 0xe905
-62766,	 // 0xf52e
-57115,	 // 0xdf1b
-57852,	 // 0xe1fc
-57597,	 // 0xe0fd
-52740,	 // 0xce04
-58343,	 // 0xe3e7
-17425,	 // 0x4411
-64518,	 // 0xfc06
-32516,	 // 0x7f04
- 1501,	 // 0x05dd
-55566,	 // 0xd90e
-41692,	 // 0xa2dc
-63720,	 // 0xf8e8
- 4597,	 // 0x11f5
- 2284,	 // 0x08ec
- 5089,	 // 0x13e1
-14626,	 // 0x3922
-54277,	 // 0xd405
-10723,	 // 0x29e3
-65287,	 // 0xff07
-19453,	 // 0x4bfd
- 3606,	 // 0x0e16
-13771,	 // 0x35cb
- 3266,	 // 0x0cc2
-  677,	 // 0x02a5
-63479,	 // 0xf7f7
-16910,	 // 0x420e
-62737,	 // 0xf511
- 3769,	 // 0x0eb9
-33210,	 // 0x81ba
-53510,	 // 0xd106
-63265,	 // 0xf721
-12794,	 // 0x31fa
-48931,	 // 0xbf23
-64808,	 // 0xfd28
- 2238,	 // 0x08be
-60878,	 // 0xedce
- 9239,	 // 0x2417
-56862,	 // 0xde1e
-60703,	 // 0xed1f
-62189,	 // 0xf2ed
-60408,	 // 0xebf8
-61293,	 // 0xef6d
- 8479,	 // 0x211f
-56900,	 // 0xde44
-17985,	 // 0x4641
- 4361,	 // 0x1109
-  523,	 // 0x020b
- 2314,	 // 0x090a
-62714,	 // 0xf4fa
-52424,	 // 0xccc8
- 2628,	 // 0x0a44
-56320,	 // 0xdc00
-62287,	 // 0xf34f
-43288,	 // 0xa918
-  759,	 // 0x02f7
-65514,	 // 0xffea
- 1264,	 // 0x04f0
-58631,	 // 0xe507
- 3872,	 // 0x0f20
- 2591,	 // 0x0a1f
-60635,	 // 0xecdb
-  255,	 // 0x00ff
-  248,	 // 0x00f8
-11521,	 // 0x2d01
-    3,	 // 0x0003
- 7156,	 // 0x1bf4
- 1515,	 // 0x05eb
-  775,	 // 0x0307
-63257,	 // 0xf719
-62217,	 // 0xf309
- 2073,	 // 0x0819
- 3090,	 // 0x0c12
-64556,	 // 0xfc2c
-59718,	 // 0xe946
-61145,	 // 0xeed9
-65011,	 // 0xfdf3
-11976,	 // 0x2ec8
- 5889,	 // 0x1701
-  800,	 // 0x0320
-15360,	 // 0x3c00
- 1798,	 // 0x0706
-61953,	 // 0xf201
-   26,	 // 0x001a
- 7216,	 // 0x1c30
-64003,	 // 0xfa03
-65525,	 // 0xfff5
-61495,	 // 0xf037
-59164,	 // 0xe71c
-64509,	 // 0xfbfd
- 1015,	 // 0x03f7
-65020,	 // 0xfdfc
-58379,	 // 0xe40b
- 7711,	 // 0x1e1f
-  249,	 // 0x00f9
-65258,	 // 0xfeea
- 6157,	 // 0x180d
-65018,	 // 0xfdfa
-60929,	 // 0xee01
-33278,	 // 0x81fe
-64848,	 // 0xfd50
-  252,	 // 0x00fc
- 9243,	 // 0x241b
- 3332,	 // 0x0d04
-19681,	 // 0x4ce1
-58867,	 // 0xe5f3
-57326,	 // 0xdfee
- 3866,	 // 0x0f1a
- 9959,	 // 0x26e7
-64846,	 // 0xfd4e
- 5035,	 // 0x13ab
- 3830,	 // 0x0ef6
-62223,	 // 0xf30f
-  245,	 // 0x00f5
- 8180,	 // 0x1ff4
-64521,	 // 0xfc09
-64215,	 // 0xfad7
-44288,	 // 0xad00
-50440,	 // 0xc508
-35846,	 // 0x8c06
-18440,	 // 0x4808
-54275,	 // 0xd403
-51468,	 // 0xc90c
- 4575,	 // 0x11df
-  186,	 // 0x00ba
-59906,	 // 0xea02
-61719,	 // 0xf117
- 1078,	 // 0x0436
-64242,	 // 0xfaf2
-59341,	 // 0xe7cd
-63037,	 // 0xf63d
-61453,	 // 0xf00d
-65330,	 // 0xff32
-33042,	 // 0x8112
- 5122,	 // 0x1402
-  487,	 // 0x01e7
-57349,	 // 0xe005
- 9988,	 // 0x2704
-54496,	 // 0xd4e0
-  748,	 // 0x02ec
-56337,	 // 0xdc11
-62374,	 // 0xf3a6
-44333,	 // 0xad2d
- 8609,	 // 0x21a1
-    0,	 // 0x0000
-65024,	 // 0xfe00
-65280,	 // 0xff00
-  255,	 // 0x00ff
-  257,	 // 0x0101
-    0,	 // 0x0000
-  256,	 // 0x0100
-    0,	 // 0x0000
-65280,	 // 0xff00
-  511,	 // 0x01ff
-  256,	 // 0x0100
-  257,	 // 0x0101
-  255,	 // 0x00ff
-  385,	 // 0x0181
-    1,	 // 0x0001
-  257,	 // 0x0101
-    0,	 // 0x0000
-  255,	 // 0x00ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-  511,	 // 0x01ff
-    1,	 // 0x0001
-    1,	 // 0x0001
-37120,	 // 0x9100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-    0,	 // 0x0000
-  256,	 // 0x0100
-  256,	 // 0x0100
-65535,	 // 0xffff
-  511,	 // 0x01ff
-65279,	 // 0xfeff
-    1,	 // 0x0001
-  186,	 // 0x00ba
-    1,	 // 0x0001
-    0,	 // 0x0000
-    1,	 // 0x0001
-  257,	 // 0x0101
-45824,	 // 0xb300
-65024,	 // 0xfe00
-  256,	 // 0x0100
-    0,	 // 0x0000
- 3072,	 // 0x0c00
- 3102,	 // 0x0c1e
- 1407,	 // 0x057f
- 1031,	 // 0x0407
- 6885,	 // 0x1ae5
- 5392,	 // 0x1510
-62991,	 // 0xf60f
-57626,	 // 0xe11a
-10516,	 // 0x2914
-58863,	 // 0xe5ef
- 9730,	 // 0x2602
-60927,	 // 0xedff
-  512,	 // 0x0200
-55320,	 // 0xd818
-25090,	 // 0x6202
- 8970,	 // 0x230a
- 4364,	 // 0x110c
- 8195,	 // 0x2003
- 1514,	 // 0x05ea
-65295,	 // 0xff0f
-63205,	 // 0xf6e5
- 5122,	 // 0x1402
- 2829,	 // 0x0b0d
- 2579,	 // 0x0a13
-65286,	 // 0xff06
-15358,	 // 0x3bfe
-  786,	 // 0x0312
- 5383,	 // 0x1507
- 5896,	 // 0x1708
- 4365,	 // 0x110d
-63014,	 // 0xf626
- 1288,	 // 0x0508
-63255,	 // 0xf717
-65529,	 // 0xfff9
- 2571,	 // 0x0a0b
-63235,	 // 0xf703
- 1773,	 // 0x06ed
-65206,	 // 0xfeb6
-14619,	 // 0x391b
- 6401,	 // 0x1901
-63997,	 // 0xf9fd
- 2813,	 // 0x0afd
- 1539,	 // 0x0603
-  515,	 // 0x0203
-49392,	 // 0xc0f0
-61411,	 // 0xefe3
- 6903,	 // 0x1af7
-52742,	 // 0xce06
- 4575,	 // 0x11df
-52747,	 // 0xce0b
-  774,	 // 0x0306
-61668,	 // 0xf0e4
-54247,	 // 0xd3e7
-30461,	 // 0x76fd
-64538,	 // 0xfc1a
-18157,	 // 0x46ed
-60172,	 // 0xeb0c
-57165,	 // 0xdf4d
-18398,	 // 0x47de
-64761,	 // 0xfcf9
- 3641,	 // 0x0e39
- 2530,	 // 0x09e2
- 2461,	 // 0x099d
- 3849,	 // 0x0f09
-10182,	 // 0x27c6
-61946,	 // 0xf1fa
-61016,	 // 0xee58
-  741,	 // 0x02e5
- 1786,	 // 0x06fa
- 6898,	 // 0x1af2
-64077,	 // 0xfa4d
-15578,	 // 0x3cda
- 4363,	 // 0x110b
-65027,	 // 0xfe03
- 5357,	 // 0x14ed
-  517,	 // 0x0205
- 9905,	 // 0x26b1
- 4860,	 // 0x12fc
-60896,	 // 0xede0
-64279,	 // 0xfb17
- 1785,	 // 0x06f9
-65024,	 // 0xfe00
-57597,	 // 0xe0fd
-65274,	 // 0xfefa
- 1071,	 // 0x042f
- 3337,	 // 0x0d09
-61176,	 // 0xeef8
- 9468,	 // 0x24fc
-32744,	 // 0x7fe8
- 1151,	 // 0x047f
- 4598,	 // 0x11f6
-53991,	 // 0xd2e7
-60903,	 // 0xede7
-60461,	 // 0xec2d
- 3398,	 // 0x0d46
-11236,	 // 0x2be4
-41461,	 // 0xa1f5
-39147,	 // 0x98eb
-64251,	 // 0xfafb
-45285,	 // 0xb0e5
-54044,	 // 0xd31c
-59963,	 // 0xea3b
- 2560,	 // 0x0a00
-63747,	 // 0xf903
-64281,	 // 0xfb19
-  778,	 // 0x030a
- 3089,	 // 0x0c11
-59444,	 // 0xe834
-45918,	 // 0xb35e
-63977,	 // 0xf9e9
-62836,	 // 0xf574
-59625,	 // 0xe8e9
-  254,	 // 0x00fe
- 3323,	 // 0x0cfb
- 8737,	 // 0x2221
-13806,	 // 0x35ee
- 3301,	 // 0x0ce5
-58372,	 // 0xe404
-61967,	 // 0xf20f
-62852,	 // 0xf584
-54273,	 // 0xd401
-13566,	 // 0x34fe
-63458,	 // 0xf7e2
-54803,	 // 0xd613
-64230,	 // 0xfae6
- 8195,	 // 0x2003
-25699,	 // 0x6463
-64754,	 // 0xfcf2
- 3334,	 // 0x0d06
-  993,	 // 0x03e1
- 6618,	 // 0x19da
-59867,	 // 0xe9db
-60653,	 // 0xeced
-  515,	 // 0x0203
- 2055,	 // 0x0807
-  768,	 // 0x0300
-63230,	 // 0xf6fe
- 4349,	 // 0x10fd
- 2302,	 // 0x08fe
- 1271,	 // 0x04f7
- 1789,	 // 0x06fd
-  517,	 // 0x0205
-  505,	 // 0x01f9
-63997,	 // 0xf9fd
-64515,	 // 0xfc03
- 5134,	 // 0x140e
-  259,	 // 0x0103
- 4350,	 // 0x10fe
- 2299,	 // 0x08fb
- 1803,	 // 0x070b
- 1541,	 // 0x0605
-  516,	 // 0x0204
-63753,	 // 0xf909
- 1921,	 // 0x0781
-64764,	 // 0xfcfc
-  257,	 // 0x0101
-65027,	 // 0xfe03
-65036,	 // 0xfe0c
-64770,	 // 0xfd02
-  774,	 // 0x0306
-  252,	 // 0x00fc
-65277,	 // 0xfefd
- 1023,	 // 0x03ff
- 1284,	 // 0x0504
- 1026,	 // 0x0402
-65290,	 // 0xff0a
-65021,	 // 0xfdfd
-63734,	 // 0xf8f6
-62212,	 // 0xf304
-  508,	 // 0x01fc
-65283,	 // 0xff03
- 2041,	 // 0x07f9
-64508,	 // 0xfbfc
- 1789,	 // 0x06fd
-38152,	 // 0x9508
-64749,	 // 0xfced
- 2300,	 // 0x08fc
-  246,	 // 0x00f6
-63750,	 // 0xf906
- 4879,	 // 0x130f
-  777,	 // 0x0309
-  260,	 // 0x0104
-64518,	 // 0xfc06
-  231,	 // 0x00e7
-64768,	 // 0xfd00
-65296,	 // 0xff10
-  760,	 // 0x02f8
-60402,	 // 0xebf2
- 1030,	 // 0x0406
- 5401,	 // 0x1519
-65523,	 // 0xfff3
- 1006,	 // 0x03ee
-  756,	 // 0x02f4
- 1534,	 // 0x05fe
- 5889,	 // 0x1701
-64508,	 // 0xfbfc
-60418,	 // 0xec02
-61057,	 // 0xee81
-63506,	 // 0xf812
-63500,	 // 0xf80c
- 1803,	 // 0x070b
-65524,	 // 0xfff4
-  763,	 // 0x02fb
- 5125,	 // 0x1405
- 2042,	 // 0x07fa
- 4377,	 // 0x1119
- 1802,	 // 0x070a
- 2051,	 // 0x0803
-62475,	 // 0xf40b
-  785,	 // 0x0311
-64778,	 // 0xfd0a
-62462,	 // 0xf3fe
-64008,	 // 0xfa08
- 2288,	 // 0x08f0
-64795,	 // 0xfd1b
- 1279,	 // 0x04ff
-62464,	 // 0xf400
- 1534,	 // 0x05fe
-49918,	 // 0xc2fe
-  502,	 // 0x01f6
- 7176,	 // 0x1c08
- 3365,	 // 0x0d25
- 2529,	 // 0x09e1
-10213,	 // 0x27e5
-63740,	 // 0xf8fc
-10794,	 // 0x2a2a
-64068,	 // 0xfa44
-64284,	 // 0xfb1c
-20228,	 // 0x4f04
-62709,	 // 0xf4f5
-51679,	 // 0xc9df
-65236,	 // 0xfed4
-64767,	 // 0xfcff
-45063,	 // 0xb007
- 2572,	 // 0x0a0c
-58883,	 // 0xe603
- 2099,	 // 0x0833
- 3011,	 // 0x0bc3
-55576,	 // 0xd918
-49176,	 // 0xc018
- 8259,	 // 0x2043
-46564,	 // 0xb5e4
- 1711,	 // 0x06af
- 4127,	 // 0x101f
-62197,	 // 0xf2f5
-60186,	 // 0xeb1a
-61188,	 // 0xef04
-58580,	 // 0xe4d4
-53941,	 // 0xd2b5
- 5644,	 // 0x160c
-57598,	 // 0xe0fe
-61172,	 // 0xeef4
-14286,	 // 0x37ce
- 6160,	 // 0x1810
- 2810,	 // 0x0afa
-12567,	 // 0x3117
-62228,	 // 0xf314
-56105,	 // 0xdb29
-52915,	 // 0xceb3
- 9978,	 // 0x26fa
-62410,	 // 0xf3ca
-64249,	 // 0xfaf9
-49400,	 // 0xc0f8
-15437,	 // 0x3c4d
-32739,	 // 0x7fe3
- 2562,	 // 0x0a02
-64771,	 // 0xfd03
-  505,	 // 0x01f9
- 3582,	 // 0x0dfe
-  258,	 // 0x0102
-60937,	 // 0xee09
- 1549,	 // 0x060d
- 2574,	 // 0x0a0e
-64258,	 // 0xfb02
-65271,	 // 0xfef7
- 1011,	 // 0x03f3
-62480,	 // 0xf410
-  534,	 // 0x0216
- 2313,	 // 0x0909
-63748,	 // 0xf904
-63229,	 // 0xf6fd
- 1273,	 // 0x04f9
- 1788,	 // 0x06fc
-  777,	 // 0x0309
- 1014,	 // 0x03f6
-61429,	 // 0xeff5
-64782,	 // 0xfd0e
- 1543,	 // 0x0607
- 2819,	 // 0x0b03
-60428,	 // 0xec0c
-62468,	 // 0xf404
-63223,	 // 0xf6f7
- 3058,	 // 0x0bf2
- 3850,	 // 0x0f0a
- 6921,	 // 0x1b09
-  274,	 // 0x0112
- 4348,	 // 0x10fc
- 1811,	 // 0x0713
-63991,	 // 0xf9f7
-63223,	 // 0xf6f7
-64245,	 // 0xfaf5
-65020,	 // 0xfdfc
- 2836,	 // 0x0b14
- 3073,	 // 0x0c01
-61957,	 // 0xf205
-63486,	 // 0xf7fe
-33272,	 // 0x81f8
-62223,	 // 0xf30f
- 9752,	 // 0x2618
-63230,	 // 0xf6fe
-65030,	 // 0xfe06
-  767,	 // 0x02ff
- 1274,	 // 0x04fa
-    3,	 // 0x0003
-65283,	 // 0xff03
- 1024,	 // 0x0400
- 2033,	 // 0x07f1
-65281,	 // 0xff01
-    5,	 // 0x0005
-63740,	 // 0xf8fc
-64250,	 // 0xfafa
-64515,	 // 0xfc03
-65287,	 // 0xff07
- 2301,	 // 0x08fd
- 1286,	 // 0x0506
-  257,	 // 0x0101
-64510,	 // 0xfbfe
-64512,	 // 0xfc00
- 1031,	 // 0x0407
-  897,	 // 0x0381
-  256,	 // 0x0100
-65034,	 // 0xfe0a
-65278,	 // 0xfefe
-  766,	 // 0x02fe
-  778,	 // 0x030a
- 1539,	 // 0x0603
- 1783,	 // 0x06f7
-64513,	 // 0xfc01
-63743,	 // 0xf8ff
-65006,	 // 0xfdee
- 1789,	 // 0x06fd
-65017,	 // 0xfdf9
- 1279,	 // 0x04ff
-65014,	 // 0xfdf6
-  500,	 // 0x01f4
-65282,	 // 0xff02
-64764,	 // 0xfcfc
-  516,	 // 0x0204
-  499,	 // 0x01f3
-63236,	 // 0xf704
- 7677,	 // 0x1dfd
- 1280,	 // 0x0500
- 5631,	 // 0x15ff
-35784,	 // 0x8bc8
-59465,	 // 0xe849
- 8919,	 // 0x22d7
-51169,	 // 0xc7e1
- 3752,	 // 0x0ea8
-11172,	 // 0x2ba4
-34804,	 // 0x87f4
-48047,	 // 0xbbaf
-10720,	 // 0x29e0
-48769,	 // 0xbe81
-12885,	 // 0x3255
-56105,	 // 0xdb29
-44976,	 // 0xafb0
-38438,	 // 0x9626
-63464,	 // 0xf7e8
-63478,	 // 0xf7f6
- 2735,	 // 0x0aaf
-12784,	 // 0x31f0
-45369,	 // 0xb139
-58799,	 // 0xe5af
- 1956,	 // 0x07a4
- 8237,	 // 0x202d
-43752,	 // 0xaae8
-17615,	 // 0x44cf
-53283,	 // 0xd023
-47142,	 // 0xb826
-12278,	 // 0x2ff6
-35537,	 // 0x8ad1
-10644,	 // 0x2994
-23852,	 // 0x5d2c
-36241,	 // 0x8d91
-  928,	 // 0x03a0
-40196,	 // 0x9d04
-49179,	 // 0xc01b
-55222,	 // 0xd7b6
-36748,	 // 0x8f8c
-44568,	 // 0xae18
-52269,	 // 0xcc2d
-57821,	 // 0xe1dd
-45442,	 // 0xb182
- 2750,	 // 0x0abe
-45720,	 // 0xb298
-56513,	 // 0xdcc1
-20793,	 // 0x5139
-64477,	 // 0xfbdd
-56301,	 // 0xdbed
-61407,	 // 0xefdf
- 5192,	 // 0x1448
-64742,	 // 0xfce6
-50743,	 // 0xc637
-  486,	 // 0x01e6
- 5342,	 // 0x14de
-17416,	 // 0x4408
- 3599,	 // 0x0e0f
-63996,	 // 0xf9fc
- 2835,	 // 0x0b13
-59627,	 // 0xe8eb
- 5402,	 // 0x151a
-45576,	 // 0xb208
-62469,	 // 0xf405
-60919,	 // 0xedf7
-21226,	 // 0x52ea
-54704,	 // 0xd5b0
-   12,	 // 0x000c
-62471,	 // 0xf407
-53631,	 // 0xd17f
- 2520,	 // 0x09d8
-63713,	 // 0xf8e1
-56568,	 // 0xdcf8
- 5118,	 // 0x13fe
-57095,	 // 0xdf07
- 2611,	 // 0x0a33
-62426,	 // 0xf3da
-62453,	 // 0xf3f5
-57582,	 // 0xe0ee
- 3548,	 // 0x0ddc
-58883,	 // 0xe603
-64283,	 // 0xfb1b
-56542,	 // 0xdcde
-49927,	 // 0xc307
-59171,	 // 0xe723
- 1002,	 // 0x03ea
-63996,	 // 0xf9fc
-57615,	 // 0xe10f
-10250,	 // 0x280a
-35310,	 // 0x89ee
-10984,	 // 0x2ae8
-18250,	 // 0x474a
-64757,	 // 0xfcf5
-64262,	 // 0xfb06
-63741,	 // 0xf8fd
-64528,	 // 0xfc10
- 1530,	 // 0x05fa
-58359,	 // 0xe3f7
-65279,	 // 0xfeff
- 2816,	 // 0x0b00
- 6124,	 // 0x17ec
- 4342,	 // 0x10f6
- 2077,	 // 0x081d
-64253,	 // 0xfafd
-61728,	 // 0xf120
-62982,	 // 0xf606
-64269,	 // 0xfb0d
- 3074,	 // 0x0c02
-65279,	 // 0xfeff
-55549,	 // 0xd8fd
-62731,	 // 0xf50b
-  761,	 // 0x02f9
- 9526,	 // 0x2536
-62961,	 // 0xf5f1
-63732,	 // 0xf8f4
-65249,	 // 0xfee1
-64533,	 // 0xfc15
-56033,	 // 0xdae1
- 1026,	 // 0x0402
-60902,	 // 0xede6
-65258,	 // 0xfeea
-62216,	 // 0xf308
-62217,	 // 0xf309
- 3327,	 // 0x0cff
- 1289,	 // 0x0509
-63215,	 // 0xf6ef
-64512,	 // 0xfc00
-  235,	 // 0x00eb
-60668,	 // 0xecfc
- 4352,	 // 0x1100
-59646,	 // 0xe8fe
- 6402,	 // 0x1902
- 6881,	 // 0x1ae1
-33261,	 // 0x81ed
- 3899,	 // 0x0f3b
-20721,	 // 0x50f1
-64765,	 // 0xfcfd
-  241,	 // 0x00f1
- 3075,	 // 0x0c03
- 3074,	 // 0x0c02
-60415,	 // 0xebff
-61175,	 // 0xeef7
- 3320,	 // 0x0cf8
-    1,	 // 0x0001
- 1812,	 // 0x0714
-63237,	 // 0xf705
- 2036,	 // 0x07f4
- 1035,	 // 0x040b
- 2573,	 // 0x0a0d
- 1285,	 // 0x0505
-63995,	 // 0xf9fb
-64775,	 // 0xfd07
-62699,	 // 0xf4eb
- 4104,	 // 0x1008
- 5361,	 // 0x14f1
- 1526,	 // 0x05f6
- 6241,	 // 0x1861
-  763,	 // 0x02fb
-65027,	 // 0xfe03
-65531,	 // 0xfffb
-64506,	 // 0xfbfa
- 2304,	 // 0x0900
-63245,	 // 0xf70d
-  257,	 // 0x0101
-  792,	 // 0x0318
-65035,	 // 0xfe0b
-65280,	 // 0xff00
- 3839,	 // 0x0eff
-63490,	 // 0xf802
-65517,	 // 0xffed
-64269,	 // 0xfb0d
- 3828,	 // 0x0ef4
-  526,	 // 0x020e
- 1539,	 // 0x0603
-64258,	 // 0xfb02
-63748,	 // 0xf904
-63235,	 // 0xf703
-33276,	 // 0x81fc
- 2797,	 // 0x0aed
-14598,	 // 0x3906
-64503,	 // 0xfbf7
-65019,	 // 0xfdfb
-64509,	 // 0xfbfd
-64782,	 // 0xfd0e
-  240,	 // 0x00f0
-59114,	 // 0xe6ea
- 5895,	 // 0x1707
- 1533,	 // 0x05fd
- 6907,	 // 0x1afb
-63499,	 // 0xf80b
- 9206,	 // 0x23f6
-62456,	 // 0xf3f8
-60186,	 // 0xeb1a
- 6438,	 // 0x1926
-59163,	 // 0xe71b
- 6119,	 // 0x17e7
-64286,	 // 0xfb1e
-61968,	 // 0xf210
- 6653,	 // 0x19fd
- 2552,	 // 0x09f8
-10052,	 // 0x2744
- 1752,	 // 0x06d8
-64755,	 // 0xfcf3
-  521,	 // 0x0209
- 3036,	 // 0x0bdc
- 3085,	 // 0x0c0d
-58623,	 // 0xe4ff
-58396,	 // 0xe41c
-  770,	 // 0x0302
-61448,	 // 0xf008
-63213,	 // 0xf6ed
-58598,	 // 0xe4e6
- 1520,	 // 0x05f0
-63252,	 // 0xf714
-61178,	 // 0xeefa
-61206,	 // 0xef16
- 2852,	 // 0x0b24
-64008,	 // 0xfa08
-  488,	 // 0x01e8
- 2036,	 // 0x07f4
- 2580,	 // 0x0a14
-57832,	 // 0xe1e8
-59853,	 // 0xe9cd
-32519,	 // 0x7f07
- 1797,	 // 0x0705
- 4862,	 // 0x12fe
- 1279,	 // 0x04ff
-61424,	 // 0xeff0
-65016,	 // 0xfdf8
- 6679,	 // 0x1a17
-63232,	 // 0xf700
-65016,	 // 0xfdf8
- 1002,	 // 0x03ea
-62225,	 // 0xf311
-58888,	 // 0xe608
- 4846,	 // 0x12ee
-14818,	 // 0x39e2
-59413,	 // 0xe815
-18130,	 // 0x46d2
-64247,	 // 0xfaf7
-  484,	 // 0x01e4
-63221,	 // 0xf6f5
-50949,	 // 0xc705
-64532,	 // 0xfc14
-49693,	 // 0xc21d
- 5956,	 // 0x1744
-65523,	 // 0xfff3
-63240,	 // 0xf708
-60705,	 // 0xed21
- 2284,	 // 0x08ec
- 6138,	 // 0x17fa
-62971,	 // 0xf5fb
- 5618,	 // 0x15f2
- 2542,	 // 0x09ee
- 1298,	 // 0x0512
-61711,	 // 0xf10f
- 5641,	 // 0x1609
-56058,	 // 0xdafa
- 1794,	 // 0x0702
-10750,	 // 0x29fe
-61667,	 // 0xf0e3
-  727,	 // 0x02d7
- 9497,	 // 0x2519
-57602,	 // 0xe102
-64770,	 // 0xfd02
-33063,	 // 0x8127
-62991,	 // 0xf60f
-53476,	 // 0xd0e4
-61177,	 // 0xeef9
- 4606,	 // 0x11fe
- 3372,	 // 0x0d2c
-64247,	 // 0xfaf7
- 6171,	 // 0x181b
-63824,	 // 0xf950
- 4861,	 // 0x12fd
-  238,	 // 0x00ee
-60902,	 // 0xede6
- 1279,	 // 0x04ff
-63980,	 // 0xf9ec
-63759,	 // 0xf90f
-58647,	 // 0xe517
- 5344,	 // 0x14e0
-19165,	 // 0x4add
-54259,	 // 0xd3f3
-63766,	 // 0xf916
-64261,	 // 0xfb05
-57061,	 // 0xdee5
- 1528,	 // 0x05f8
-56364,	 // 0xdc2c
-15343,	 // 0x3bef
- 3893,	 // 0x0f35
-62957,	 // 0xf5ed
-59882,	 // 0xe9ea
-  275,	 // 0x0113
-61952,	 // 0xf200
- 5392,	 // 0x1510
- 3526,	 // 0x0dc6
- 4084,	 // 0x0ff4
- 1050,	 // 0x041a
-   44,	 // 0x002c
-64238,	 // 0xfaee
-60966,	 // 0xee26
- 1798,	 // 0x0706
-61176,	 // 0xeef8
- 4616,	 // 0x1208
- 3347,	 // 0x0d13
-65303,	 // 0xff17
- 1263,	 // 0x04ef
- 2851,	 // 0x0b23
-33264,	 // 0x81f0
- 6151,	 // 0x1807
- 3599,	 // 0x0e0f
-  250,	 // 0x00fa
- 3316,	 // 0x0cf4
-63747,	 // 0xf903
- 2571,	 // 0x0a0b
-61186,	 // 0xef02
-    2,	 // 0x0002
-64258,	 // 0xfb02
-62727,	 // 0xf507
- 1793,	 // 0x0701
-  262,	 // 0x0106
-64005,	 // 0xfa05
-  510,	 // 0x01fe
-65279,	 // 0xfeff
-65029,	 // 0xfe05
-63749,	 // 0xf905
-64277,	 // 0xfb15
-61702,	 // 0xf106
- 2039,	 // 0x07f7
-  765,	 // 0x02fd
-  246,	 // 0x00f6
-  207,	 // 0x00cf
-64519,	 // 0xfc07
-63997,	 // 0xf9fd
- 1026,	 // 0x0402
-64005,	 // 0xfa05
-64760,	 // 0xfcf8
- 2816,	 // 0x0b00
-62213,	 // 0xf305
-    0,	 // 0x0000
-  252,	 // 0x00fc
-64767,	 // 0xfcff
-   17,	 // 0x0011
-65279,	 // 0xfeff
- 3074,	 // 0x0c02
- 1277,	 // 0x04fd
- 3068,	 // 0x0bfc
- 1291,	 // 0x050b
- 3583,	 // 0x0dff
-64252,	 // 0xfafc
-  530,	 // 0x0212
-64754,	 // 0xfcf2
-33027,	 // 0x8103
- 4619,	 // 0x120b
-  277,	 // 0x0115
-58636,	 // 0xe50c
-58584,	 // 0xe4d8
- 1569,	 // 0x0621
-63511,	 // 0xf817
- 5121,	 // 0x1401
-64551,	 // 0xfc27
- 1999,	 // 0x07cf
- 6936,	 // 0x1b18
-63221,	 // 0xf6f5
-40166,	 // 0x9ce6
-55522,	 // 0xd8e2
-58605,	 // 0xe4ed
-58139,	 // 0xe31b
-63256,	 // 0xf718
- 2285,	 // 0x08ed
-62995,	 // 0xf613
-61681,	 // 0xf0f1
- 1542,	 // 0x0606
-59871,	 // 0xe9df
-60950,	 // 0xee16
-51716,	 // 0xca04
- 1019,	 // 0x03fb
-  990,	 // 0x03de
-62232,	 // 0xf318
-57582,	 // 0xe0ee
-63231,	 // 0xf6ff
-58105,	 // 0xe2f9
-53503,	 // 0xd0ff
- 2066,	 // 0x0812
-60398,	 // 0xebee
-48841,	 // 0xbec9
- 6416,	 // 0x1910
- 6678,	 // 0x1a16
-63253,	 // 0xf715
- 2555,	 // 0x09fb
-54277,	 // 0xd405
-64761,	 // 0xfcf9
-48627,	 // 0xbdf3
-61406,	 // 0xefde
-65503,	 // 0xffdf
-  261,	 // 0x0105
-48398,	 // 0xbd0e
- 3096,	 // 0x0c18
-32741,	 // 0x7fe5
-13036,	 // 0x32ec
- 7937,	 // 0x1f01
-63237,	 // 0xf705
-65260,	 // 0xfeec
-  769,	 // 0x0301
-64496,	 // 0xfbf0
-  245,	 // 0x00f5
-61713,	 // 0xf111
-54535,	 // 0xd507
- 1019,	 // 0x03fb
-63488,	 // 0xf800
-64253,	 // 0xfafd
- 4340,	 // 0x10f4
-64507,	 // 0xfbfb
-  516,	 // 0x0204
- 5133,	 // 0x140d
-  770,	 // 0x0302
-64014,	 // 0xfa0e
- 5397,	 // 0x1515
-63459,	 // 0xf7e3
- 8655,	 // 0x21cf
-65018,	 // 0xfdfa
-63771,	 // 0xf91b
-  767,	 // 0x02ff
- 5129,	 // 0x1409
-  226,	 // 0x00e2
- 2583,	 // 0x0a17
- 4602,	 // 0x11fa
-63739,	 // 0xf8fb
- 5126,	 // 0x1406
-13052,	 // 0x32fc
-63490,	 // 0xf802
-65052,	 // 0xfe1c
- 2804,	 // 0x0af4
-60938,	 // 0xee0a
-65025,	 // 0xfe01
- 6640,	 // 0x19f0
- 1537,	 // 0x0601
- 7425,	 // 0x1d01
-65293,	 // 0xff0d
-62713,	 // 0xf4f9
-32760,	 // 0x7ff8
-  507,	 // 0x01fb
-48376,	 // 0xbcf8
-62984,	 // 0xf608
-60454,	 // 0xec26
- 1013,	 // 0x03f5
-63215,	 // 0xf6ef
-62443,	 // 0xf3eb
-61708,	 // 0xf10c
-63496,	 // 0xf808
- 7184,	 // 0x1c10
-62974,	 // 0xf5fe
-64491,	 // 0xfbeb
-62446,	 // 0xf3ee
-63743,	 // 0xf8ff
-60409,	 // 0xebf9
- 3328,	 // 0x0d00
-59635,	 // 0xe8f3
-62709,	 // 0xf4f5
-10228,	 // 0x27f4
-62729,	 // 0xf509
-65280,	 // 0xff00
-61469,	 // 0xf01d
-  897,	 // 0x0381
-63746,	 // 0xf902
-63243,	 // 0xf70b
-61696,	 // 0xf100
-64248,	 // 0xfaf8
-  775,	 // 0x0307
-  511,	 // 0x01ff
- 2036,	 // 0x07f4
-63759,	 // 0xf90f
-62970,	 // 0xf5fa
-63463,	 // 0xf7e7
- 2801,	 // 0x0af1
-64013,	 // 0xfa0d
-60960,	 // 0xee20
-63737,	 // 0xf8f9
-65285,	 // 0xff05
-63991,	 // 0xf9f7
-64260,	 // 0xfb04
- 3602,	 // 0x0e12
-64990,	 // 0xfdde
-61954,	 // 0xf202
- 7930,	 // 0x1efa
-63210,	 // 0xf6ea
-  744,	 // 0x02e8
-58346,	 // 0xe3ea
- 6127,	 // 0x17ef
-64733,	 // 0xfcdd
-59903,	 // 0xe9ff
-62456,	 // 0xf3f8
-55787,	 // 0xd9eb
- 4616,	 // 0x1208
-65260,	 // 0xfeec
-65297,	 // 0xff11
-61706,	 // 0xf10a
-57343,	 // 0xdfff
-  740,	 // 0x02e4
- 1275,	 // 0x04fb
-10805,	 // 0x2a35
-64798,	 // 0xfd1e
- 7692,	 // 0x1e0c
-62987,	 // 0xf60b
-60671,	 // 0xecff
-63732,	 // 0xf8f4
- 7949,	 // 0x1f0d
-65211,	 // 0xfebb
-60931,	 // 0xee03
- 1545,	 // 0x0609
-64003,	 // 0xfa03
-54788,	 // 0xd604
- 5121,	 // 0x1401
-56556,	 // 0xdcec
-57072,	 // 0xdef0
- 3543,	 // 0x0dd7
-59120,	 // 0xe6f0
-61675,	 // 0xf0eb
-62708,	 // 0xf4f4
- 4339,	 // 0x10f3
- 6416,	 // 0x1910
- 4627,	 // 0x1213
- 2056,	 // 0x0808
-57606,	 // 0xe106
- 3073,	 // 0x0c01
- 9990,	 // 0x2706
-60674,	 // 0xed02
-61972,	 // 0xf214
-33027,	 // 0x8103
-  278,	 // 0x0116
-57852,	 // 0xe1fc
-24553,	 // 0x5fe9
- 2074,	 // 0x081a
- 3317,	 // 0x0cf5
-60902,	 // 0xede6
-    4,	 // 0x0004
-19420,	 // 0x4bdc
-51465,	 // 0xc909
-58134,	 // 0xe316
-60653,	 // 0xeced
- 2257,	 // 0x08d1
- 3619,	 // 0x0e23
-55624,	 // 0xd948
-56256,	 // 0xdbc0
- 3068,	 // 0x0bfc
-61663,	 // 0xf0df
-54985,	 // 0xd6c9
-61923,	 // 0xf1e3
-55268,	 // 0xd7e4
-64269,	 // 0xfb0d
-65515,	 // 0xffeb
- 9343,	 // 0x247f
-10274,	 // 0x2822
- 8735,	 // 0x221f
- 1610,	 // 0x064a
-  536,	 // 0x0218
-62450,	 // 0xf3f2
- 8245,	 // 0x2035
- 1879,	 // 0x0757
-11239,	 // 0x2be7
- 3316,	 // 0x0cf4
-10767,	 // 0x2a0f
- 6879,	 // 0x1adf
- 6719,	 // 0x1a3f
-60685,	 // 0xed0d
- 1326,	 // 0x052e
- 1079,	 // 0x0437
-63269,	 // 0xf725
- 6903,	 // 0x1af7
- 2828,	 // 0x0b0c
- 1765,	 // 0x06e5
- 1514,	 // 0x05ea
-12366,	 // 0x304e
-60080,	 // 0xeab0
- 7191,	 // 0x1c17
-62979,	 // 0xf603
- 2817,	 // 0x0b01
-64771,	 // 0xfd03
-  252,	 // 0x00fc
-64257,	 // 0xfb01
-  258,	 // 0x0102
- 1022,	 // 0x03fe
- 2566,	 // 0x0a06
-    6,	 // 0x0006
-63746,	 // 0xf902
-  769,	 // 0x0301
- 2557,	 // 0x09fd
-64763,	 // 0xfcfb
-64246,	 // 0xfaf6
-  503,	 // 0x01f7
-64006,	 // 0xfa06
-  771,	 // 0x0303
-  508,	 // 0x01fc
-  263,	 // 0x0107
-64259,	 // 0xfb03
-64385,	 // 0xfb81
-64770,	 // 0xfd02
-64779,	 // 0xfd0b
-65276,	 // 0xfefc
-64765,	 // 0xfcfd
- 1289,	 // 0x0509
-65021,	 // 0xfdfd
-  760,	 // 0x02f8
- 1294,	 // 0x050e
- 1777,	 // 0x06f1
-64001,	 // 0xfa01
-    2,	 // 0x0002
-65018,	 // 0xfdfa
-64517,	 // 0xfc05
-65285,	 // 0xff05
-65270,	 // 0xfef6
-  256,	 // 0x0100
-  775,	 // 0x0307
-65028,	 // 0xfe04
- 3073,	 // 0x0c01
-63499,	 // 0xf80b
- 2563,	 // 0x0a03
- 2046,	 // 0x07fe
- 2812,	 // 0x0afc
-62471,	 // 0xf407
- 2038,	 // 0x07f6
- 5162,	 // 0x142a
-62689,	 // 0xf4e1
-57111,	 // 0xdf17
- 3060,	 // 0x0bf4
- 6640,	 // 0x19f0
-60688,	 // 0xed10
-55540,	 // 0xd8f4
-  235,	 // 0x00eb
-63731,	 // 0xf8f3
- 2813,	 // 0x0afd
-64519,	 // 0xfc07
- 3291,	 // 0x0cdb
- 3083,	 // 0x0c0b
-56605,	 // 0xdd1d
-59875,	 // 0xe9e3
-  762,	 // 0x02fa
- 7440,	 // 0x1d10
-63485,	 // 0xf7fd
- 6017,	 // 0x1781
-  269,	 // 0x010d
-64773,	 // 0xfd05
-59638,	 // 0xe8f6
-65055,	 // 0xfe1f
-65510,	 // 0xffe6
- 8687,	 // 0x21ef
-63737,	 // 0xf8f9
- 3352,	 // 0x0d18
- 6138,	 // 0x17fa
- 9734,	 // 0x2606
-62197,	 // 0xf2f5
-64802,	 // 0xfd22
- 4868,	 // 0x1304
-62493,	 // 0xf41d
- 7692,	 // 0x1e0c
-11266,	 // 0x2c02
-63741,	 // 0xf8fd
-60685,	 // 0xed0d
- 3571,	 // 0x0df3
-55053,	 // 0xd70d
- 3089,	 // 0x0c11
- 1288,	 // 0x0508
-21997,	 // 0x55ed
- 3857,	 // 0x0f11
-55779,	 // 0xd9e3
- 6992,	 // 0x1b50
-  876,	 // 0x036c
-57905,	 // 0xe231
- 7413,	 // 0x1cf5
-64259,	 // 0xfb03
-32760,	 // 0x7ff8
-64163,	 // 0xfaa3
-58324,	 // 0xe3d4
- 9713,	 // 0x25f1
- 6149,	 // 0x1805
- 1785,	 // 0x06f9
-63479,	 // 0xf7f7
-22719,	 // 0x58bf
-46638,	 // 0xb62e
-57398,	 // 0xe036
-56835,	 // 0xde03
-49889,	 // 0xc2e1
- 4901,	 // 0x1325
-58675,	 // 0xe533
-10273,	 // 0x2821
-62699,	 // 0xf4eb
-64039,	 // 0xfa27
-60884,	 // 0xedd4
-55260,	 // 0xd7dc
-21506,	 // 0x5402
-64219,	 // 0xfadb
- 3824,	 // 0x0ef0
- 7683,	 // 0x1e03
- 3340,	 // 0x0d0c
- 4161,	 // 0x1041
-56872,	 // 0xde28
-51423,	 // 0xc8df
-59875,	 // 0xe9e3
-44839,	 // 0xaf27
- 5149,	 // 0x141d
- 2309,	 // 0x0905
- 9672,	 // 0x25c8
-57848,	 // 0xe1f8
-11244,	 // 0x2bec
-61944,	 // 0xf1f8
-13825,	 // 0x3601
-11307,	 // 0x2c2b
-65312,	 // 0xff20
-62978,	 // 0xf602
- 2047,	 // 0x07ff
-  268,	 // 0x010c
- 2053,	 // 0x0805
-64785,	 // 0xfd11
-62483,	 // 0xf413
-62742,	 // 0xf516
-53193,	 // 0xcfc9
-55315,	 // 0xd813
- 8455,	 // 0x2107
-63743,	 // 0xf8ff
-  472,	 // 0x01d8
- 1775,	 // 0x06ef
- 7441,	 // 0x1d11
-64756,	 // 0xfcf4
- 2037,	 // 0x07f5
-53757,	 // 0xd1fd
- 6939,	 // 0x1b1b
-  513,	 // 0x0201
- 7710,	 // 0x1e1e
- 4601,	 // 0x11f9
- 3812,	 // 0x0ee4
- 3076,	 // 0x0c04
- 4608,	 // 0x1200
-62738,	 // 0xf512
- 6134,	 // 0x17f6
-60914,	 // 0xedf2
-61488,	 // 0xf030
- 3315,	 // 0x0cf3
- 4088,	 // 0x0ff8
-63192,	 // 0xf6d8
-60937,	 // 0xee09
-62959,	 // 0xf5ef
-59641,	 // 0xe8f9
- 9465,	 // 0x24f9
-65260,	 // 0xfeec
-65259,	 // 0xfeeb
-64252,	 // 0xfafc
- 4625,	 // 0x1211
- 8695,	 // 0x21f7
-14608,	 // 0x3910
-56576,	 // 0xdd00
-32517,	 // 0x7f05
-64759,	 // 0xfcf7
-11276,	 // 0x2c0c
- 3073,	 // 0x0c01
-61695,	 // 0xf0ff
- 1275,	 // 0x04fb
-63233,	 // 0xf701
-65256,	 // 0xfee8
-61942,	 // 0xf1f6
-58115,	 // 0xe303
- 3087,	 // 0x0c0f
- 1812,	 // 0x0714
-61456,	 // 0xf010
- 1313,	 // 0x0521
-63748,	 // 0xf904
- 2797,	 // 0x0aed
-61931,	 // 0xf1eb
-62995,	 // 0xf613
-63221,	 // 0xf6f5
- 6157,	 // 0x180d
-65014,	 // 0xfdf6
-  895,	 // 0x037f
- 4083,	 // 0x0ff3
-65299,	 // 0xff13
-  194,	 // 0x00c2
-60930,	 // 0xee02
-59133,	 // 0xe6fd
-62999,	 // 0xf617
- 2056,	 // 0x0808
-63486,	 // 0xf7fe
-  728,	 // 0x02d8
-  251,	 // 0x00fb
- 1028,	 // 0x0404
- 1269,	 // 0x04f5
- 4086,	 // 0x0ff6
-  521,	 // 0x0209
- 1776,	 // 0x06f0
- 1035,	 // 0x040b
- 4616,	 // 0x1208
-52224,	 // 0xcc00
-18950,	 // 0x4a06
-  207,	 // 0x00cf
-35313,	 // 0x89f1
- 2047,	 // 0x07ff
- 4603,	 // 0x11fb
- 2327,	 // 0x0917
- 3067,	 // 0x0bfb
-63985,	 // 0xf9f1
-61431,	 // 0xeff7
- 3083,	 // 0x0c0b
-64507,	 // 0xfbfb
-62215,	 // 0xf307
-65007,	 // 0xfdef
-  773,	 // 0x0305
-  275,	 // 0x0113
- 1025,	 // 0x0401
- 7901,	 // 0x1edd
-64510,	 // 0xfbfe
- 2830,	 // 0x0b0e
- 2806,	 // 0x0af6
- 1265,	 // 0x04f1
-  259,	 // 0x0103
- 1277,	 // 0x04fd
-  261,	 // 0x0105
- 4620,	 // 0x120c
-62188,	 // 0xf2ec
- 3333,	 // 0x0d05
- 1530,	 // 0x05fa
-62463,	 // 0xf3ff
-62972,	 // 0xf5fc
- 6626,	 // 0x19e2
-61435,	 // 0xeffb
- 1266,	 // 0x04f2
-63233,	 // 0xf701
-60414,	 // 0xebfe
- 1530,	 // 0x05fa
- 1792,	 // 0x0700
- 1279,	 // 0x04ff
- 3579,	 // 0x0dfb
-64285,	 // 0xfb1d
-65277,	 // 0xfefd
-  507,	 // 0x01fb
-64763,	 // 0xfcfb
- 3864,	 // 0x0f18
-63738,	 // 0xf8fa
- 2035,	 // 0x07f3
-33262,	 // 0x81ee
- 1022,	 // 0x03fe
- 3575,	 // 0x0df7
- 1020,	 // 0x03fc
-65279,	 // 0xfeff
-62201,	 // 0xf2f9
-62974,	 // 0xf5fe
- 1541,	 // 0x0605
- 1027,	 // 0x0403
-63232,	 // 0xf700
-59912,	 // 0xea08
-64767,	 // 0xfcff
-64255,	 // 0xfaff
- 5377,	 // 0x1501
-65287,	 // 0xff07
- 1285,	 // 0x0505
-63501,	 // 0xf80d
-  766,	 // 0x02fe
- 5869,	 // 0x16ed
-65021,	 // 0xfdfd
- 5872,	 // 0x16f0
- 6140,	 // 0x17fc
-61956,	 // 0xf204
-63226,	 // 0xf6fa
-65283,	 // 0xff03
-62971,	 // 0xf5fb
- 3070,	 // 0x0bfe
- 1039,	 // 0x040f
-63740,	 // 0xf8fc
-65017,	 // 0xfdf9
-64007,	 // 0xfa07
- 1306,	 // 0x051a
- 4607,	 // 0x11ff
-65273,	 // 0xfef9
-63234,	 // 0xf702
-59927,	 // 0xea17
-65256,	 // 0xfee8
- 1023,	 // 0x03ff
-64765,	 // 0xfcfd
- 2287,	 // 0x08ef
- 7422,	 // 0x1cfe
-60934,	 // 0xee06
-64021,	 // 0xfa15
-  514,	 // 0x0202
-33025,	 // 0x8101
-64753,	 // 0xfcf1
- 3835,	 // 0x0efb
-54004,	 // 0xd2f4
-63467,	 // 0xf7eb
-63483,	 // 0xf7fb
- 1786,	 // 0x06fa
-58863,	 // 0xe5ef
-65531,	 // 0xfffb
-64520,	 // 0xfc08
-  263,	 // 0x0107
- 1287,	 // 0x0507
-64787,	 // 0xfd13
-  523,	 // 0x020b
-64786,	 // 0xfd12
- 1556,	 // 0x0614
- 1556,	 // 0x0614
-  772,	 // 0x0304
-62739,	 // 0xf513
-62948,	 // 0xf5e4
-61678,	 // 0xf0ee
-64509,	 // 0xfbfd
- 2548,	 // 0x09f4
-62256,	 // 0xf330
- 2312,	 // 0x0908
-65282,	 // 0xff02
- 1037,	 // 0x040d
-  250,	 // 0x00fa
-  520,	 // 0x0208
-64777,	 // 0xfd09
-59649,	 // 0xe901
- 2071,	 // 0x0817
-    7,	 // 0x0007
-60669,	 // 0xecfd
-64754,	 // 0xfcf2
- 5390,	 // 0x150e
-64502,	 // 0xfbf6
-   21,	 // 0x0015
-    7,	 // 0x0007
-61699,	 // 0xf103
-  257,	 // 0x0101
- 1277,	 // 0x04fd
- 4620,	 // 0x120c
-65279,	 // 0xfeff
-33033,	 // 0x8109
-63248,	 // 0xf710
- 8703,	 // 0x21ff
- 2548,	 // 0x09f4
- 2062,	 // 0x080e
-54824,	 // 0xd628
-61198,	 // 0xef0e
-63495,	 // 0xf807
-61172,	 // 0xeef4
- 3083,	 // 0x0c0b
-60644,	 // 0xece4
-61945,	 // 0xf1f9
-62699,	 // 0xf4eb
- 2550,	 // 0x09f6
-  262,	 // 0x0106
-   12,	 // 0x000c
- 2546,	 // 0x09f2
- 3844,	 // 0x0f04
-63751,	 // 0xf907
-63498,	 // 0xf80a
- 1792,	 // 0x0700
-  989,	 // 0x03dd
-65027,	 // 0xfe03
- 1921,	 // 0x0781
-64504,	 // 0xfbf8
-60868,	 // 0xedc4
-62463,	 // 0xf3ff
- 3570,	 // 0x0df2
-62705,	 // 0xf4f1
- 4346,	 // 0x10fa
- 3819,	 // 0x0eeb
-  229,	 // 0x00e5
- 3086,	 // 0x0c0e
-13810,	 // 0x35f2
-53525,	 // 0xd115
-59405,	 // 0xe80d
-58656,	 // 0xe520
-60948,	 // 0xee14
-65264,	 // 0xfef0
-59391,	 // 0xe7ff
-63999,	 // 0xf9ff
- 7167,	 // 0x1bff
-64997,	 // 0xfde5
-62477,	 // 0xf40d
-54774,	 // 0xd5f6
- 2058,	 // 0x080a
-61200,	 // 0xef10
- 5886,	 // 0x16fe
-  265,	 // 0x0109
- 4856,	 // 0x12f8
- 2295,	 // 0x08f7
- 3834,	 // 0x0efa
- 4345,	 // 0x10f9
-62717,	 // 0xf4fd
-64767,	 // 0xfcff
-  509,	 // 0x01fd
-63741,	 // 0xf8fd
- 1805,	 // 0x070d
-65046,	 // 0xfe16
- 2031,	 // 0x07ef
- 2054,	 // 0x0806
- 1022,	 // 0x03fe
- 1770,	 // 0x06ea
-65268,	 // 0xfef4
-64517,	 // 0xfc05
-65271,	 // 0xfef7
- 1538,	 // 0x0602
-  843,	 // 0x034b
- 1781,	 // 0x06f5
- 2315,	 // 0x090b
- 2312,	 // 0x0908
- 2548,	 // 0x09f4
-    8,	 // 0x0008
-64268,	 // 0xfb0c
-63755,	 // 0xf90b
- 4082,	 // 0x0ff2
-64011,	 // 0xfa0b
- 1533,	 // 0x05fd
-62481,	 // 0xf411
- 5378,	 // 0x1502
-  763,	 // 0x02fb
-64801,	 // 0xfd21
-63732,	 // 0xf8f4
-60914,	 // 0xedf2
-  765,	 // 0x02fd
-63493,	 // 0xf805
-  252,	 // 0x00fc
- 1795,	 // 0x0703
-32764,	 // 0x7ffc
- 2819,	 // 0x0b03
- 4869,	 // 0x1305
- 1028,	 // 0x0404
- 2808,	 // 0x0af8
-62204,	 // 0xf2fc
- 2056,	 // 0x0808
-61952,	 // 0xf200
- 2058,	 // 0x080a
- 2313,	 // 0x0909
-63491,	 // 0xf803
-62213,	 // 0xf305
- 1017,	 // 0x03f9
- 2043,	 // 0x07fb
-64771,	 // 0xfd03
- 1015,	 // 0x03f7
-  773,	 // 0x0305
- 3842,	 // 0x0f02
-63996,	 // 0xf9fc
-63746,	 // 0xf902
- 4077,	 // 0x0fed
-  262,	 // 0x0106
- 1787,	 // 0x06fb
- 2943,	 // 0x0b7f
- 1785,	 // 0x06f9
- 1791,	 // 0x06ff
- 1550,	 // 0x060e
- 2033,	 // 0x07f1
-65278,	 // 0xfefe
-65275,	 // 0xfefb
-61442,	 // 0xf002
-65014,	 // 0xfdf6
-64253,	 // 0xfafd
- 1281,	 // 0x0501
- 1023,	 // 0x03ff
-65042,	 // 0xfe12
-  505,	 // 0x01f9
- 3327,	 // 0x0cff
-63473,	 // 0xf7f1
- 1284,	 // 0x0504
- 1798,	 // 0x0706
- 4863,	 // 0x12ff
- 1020,	 // 0x03fc
-64518,	 // 0xfc06
- 3580,	 // 0x0dfc
- 2044,	 // 0x07fc
- 1798,	 // 0x0706
- 3574,	 // 0x0df6
-65284,	 // 0xff04
- 2819,	 // 0x0b03
- 2294,	 // 0x08f6
-65277,	 // 0xfefd
- 2553,	 // 0x09f9
-64261,	 // 0xfb05
-62716,	 // 0xf4fc
-63240,	 // 0xf708
-65269,	 // 0xfef5
- 1796,	 // 0x0704
- 2054,	 // 0x0806
- 4094,	 // 0x0ffe
-64004,	 // 0xfa04
- 2566,	 // 0x0a06
-    3,	 // 0x0003
-63743,	 // 0xf8ff
- 3325,	 // 0x0cfd
- 2818,	 // 0x0b02
-  259,	 // 0x0103
-  261,	 // 0x0105
-65014,	 // 0xfdf6
-65031,	 // 0xfe07
- 1549,	 // 0x060d
-65010,	 // 0xfdf2
-65030,	 // 0xfe06
- 4099,	 // 0x1003
-63997,	 // 0xf9fd
- 2560,	 // 0x0a00
-64515,	 // 0xfc03
-  264,	 // 0x0108
-65022,	 // 0xfdfe
- 3086,	 // 0x0c0e
-63995,	 // 0xf9fb
-64533,	 // 0xfc15
-65279,	 // 0xfeff
-61939,	 // 0xf1f3
- 3592,	 // 0x0e08
-  773,	 // 0x0305
-  764,	 // 0x02fc
-  259,	 // 0x0103
-33278,	 // 0x81fe
- 1539,	 // 0x0603
- 3075,	 // 0x0c03
-49902,	 // 0xc2ee
-55821,	 // 0xda0d
- 5090,	 // 0x13e2
-65221,	 // 0xfec5
- 3300,	 // 0x0ce4
- 1314,	 // 0x0522
-57600,	 // 0xe100
- 5846,	 // 0x16d6
-59407,	 // 0xe80f
- 6175,	 // 0x181f
- 4359,	 // 0x1107
-61188,	 // 0xef04
-62502,	 // 0xf426
- 7408,	 // 0x1cf0
- 5848,	 // 0x16d8
- 8933,	 // 0x22e5
-63701,	 // 0xf8d5
- 3817,	 // 0x0ee9
-62773,	 // 0xf535
- 1242,	 // 0x04da
-   36,	 // 0x0024
- 2067,	 // 0x0813
-   35,	 // 0x0023
-63757,	 // 0xf90d
-61178,	 // 0xeefa
-  303,	 // 0x012f
-59127,	 // 0xe6f7
-63288,	 // 0xf738
- 8214,	 // 0x2016
-58375,	 // 0xe407
-63010,	 // 0xf622
- 3252,	 // 0x0cb4
-  760,	 // 0x02f8
-56345,	 // 0xdc19
- 4078,	 // 0x0fee
-62982,	 // 0xf606
-60653,	 // 0xeced
- 5866,	 // 0x16ea
- 4122,	 // 0x101a
- 2689,	 // 0x0a81
- 3310,	 // 0x0cee
-31764,	 // 0x7c14
-59352,	 // 0xe7d8
-30693,	 // 0x77e5
- 4887,	 // 0x1317
- 7162,	 // 0x1bfa
-63230,	 // 0xf6fe
-63501,	 // 0xf80d
-63496,	 // 0xf808
-59881,	 // 0xe9e9
- 4354,	 // 0x1102
-63734,	 // 0xf8f6
-63499,	 // 0xf80b
- 3881,	 // 0x0f29
- 7440,	 // 0x1d10
- 1263,	 // 0x04ef
- 4347,	 // 0x10fb
-54289,	 // 0xd411
-59388,	 // 0xe7fc
-57087,	 // 0xdeff
-64511,	 // 0xfbff
-62726,	 // 0xf506
- 4863,	 // 0x12ff
- 5128,	 // 0x1408
- 6692,	 // 0x1a24
- 9463,	 // 0x24f7
-65020,	 // 0xfdfc
-65534,	 // 0xfffe
-61972,	 // 0xf214
-  773,	 // 0x0305
-61708,	 // 0xf10c
- 3069,	 // 0x0bfd
-63981,	 // 0xf9ed
- 2804,	 // 0x0af4
- 6646,	 // 0x19f6
- 2026,	 // 0x07ea
-58092,	 // 0xe2ec
- 2536,	 // 0x09e8
- 3331,	 // 0x0d03
- 3857,	 // 0x0f11
- 1285,	 // 0x0505
- 3321,	 // 0x0cf9
-65014,	 // 0xfdf6
- 1043,	 // 0x0413
- 2314,	 // 0x090a
-33030,	 // 0x8106
-62187,	 // 0xf2eb
-49662,	 // 0xc1fe
- 1278,	 // 0x04fe
- 3584,	 // 0x0e00
-65276,	 // 0xfefc
-64759,	 // 0xfcf7
- 1534,	 // 0x05fe
-64771,	 // 0xfd03
-64248,	 // 0xfaf8
- 2812,	 // 0x0afc
-61182,	 // 0xeefe
-  762,	 // 0x02fa
-64768,	 // 0xfd00
-65279,	 // 0xfeff
-63749,	 // 0xf905
-63483,	 // 0xf7fb
- 2043,	 // 0x07fb
-  252,	 // 0x00fc
- 2830,	 // 0x0b0e
-61950,	 // 0xf1fe
-   10,	 // 0x000a
-63490,	 // 0xf802
-65085,	 // 0xfe3d
-62965,	 // 0xf5f5
-63750,	 // 0xf906
-65275,	 // 0xfefb
-  269,	 // 0x010d
- 2553,	 // 0x09f9
-  247,	 // 0x00f7
-  761,	 // 0x02f9
-64250,	 // 0xfafa
-64764,	 // 0xfcfc
-    3,	 // 0x0003
- 2559,	 // 0x09ff
-65273,	 // 0xfef9
-64246,	 // 0xfaf6
- 1025,	 // 0x0401
-64771,	 // 0xfd03
-  254,	 // 0x00fe
-63749,	 // 0xf905
- 2813,	 // 0x0afd
-65026,	 // 0xfe02
-64763,	 // 0xfcfb
-32762,	 // 0x7ffa
-  247,	 // 0x00f7
- 9984,	 // 0x2700
-  758,	 // 0x02f6
- 4378,	 // 0x111a
-    2,	 // 0x0002
-  765,	 // 0x02fd
- 2554,	 // 0x09fa
-64230,	 // 0xfae6
-64038,	 // 0xfa26
-61970,	 // 0xf212
-60428,	 // 0xec0c
- 6663,	 // 0x1a07
-  523,	 // 0x020b
-63751,	 // 0xf907
- 2034,	 // 0x07f2
- 3053,	 // 0x0bed
-63231,	 // 0xf6ff
- 2046,	 // 0x07fe
- 1296,	 // 0x0510
-  771,	 // 0x0303
- 4893,	 // 0x131d
-63219,	 // 0xf6f3
- 5047,	 // 0x13b7
-65289,	 // 0xff09
-65051,	 // 0xfe1b
- 2039,	 // 0x07f7
- 4864,	 // 0x1300
-64515,	 // 0xfc03
- 7689,	 // 0x1e09
- 4075,	 // 0x0feb
- 1041,	 // 0x0411
- 2814,	 // 0x0afe
- 6137,	 // 0x17f9
-59902,	 // 0xe9fe
- 1037,	 // 0x040d
-65522,	 // 0xfff2
-60678,	 // 0xed06
- 6148,	 // 0x1804
- 4345,	 // 0x10f9
- 3104,	 // 0x0c20
- 3328,	 // 0x0d00
- 3083,	 // 0x0c0b
-64765,	 // 0xfcfd
-32764,	 // 0x7ffc
- 1285,	 // 0x0505
-54781,	 // 0xd5fd
-64507,	 // 0xfbfb
- 2022,	 // 0x07e6
-64266,	 // 0xfb0a
-62238,	 // 0xf31e
-62722,	 // 0xf502
- 7680,	 // 0x1e00
- 5609,	 // 0x15e9
-63218,	 // 0xf6f2
-52729,	 // 0xcdf9
-10774,	 // 0x2a16
-60416,	 // 0xec00
-64473,	 // 0xfbd9
- 6177,	 // 0x1821
-63258,	 // 0xf71a
-64493,	 // 0xfbed
- 7399,	 // 0x1ce7
-64024,	 // 0xfa18
- 1014,	 // 0x03f6
-64240,	 // 0xfaf0
- 2049,	 // 0x0801
-13185,	 // 0x3381
-64747,	 // 0xfceb
-62978,	 // 0xf602
-61160,	 // 0xeee8
-14359,	 // 0x3817
-58920,	 // 0xe628
-62230,	 // 0xf316
-64778,	 // 0xfd0a
-54732,	 // 0xd5cc
-53270,	 // 0xd016
- 5844,	 // 0x16d4
-55066,	 // 0xd71a
-64991,	 // 0xfddf
- 5093,	 // 0x13e5
-11792,	 // 0x2e10
-60685,	 // 0xed0d
- 7675,	 // 0x1dfb
-63764,	 // 0xf914
-56063,	 // 0xdaff
-64556,	 // 0xfc2c
- 2566,	 // 0x0a06
-12292,	 // 0x3004
-  771,	 // 0x0303
-27624,	 // 0x6be8
-58338,	 // 0xe3e2
- 7150,	 // 0x1bee
-   27,	 // 0x001b
- 5123,	 // 0x1403
-55765,	 // 0xd9d5
- 1775,	 // 0x06ef
-65300,	 // 0xff14
-54009,	 // 0xd2f9
-61688,	 // 0xf0f8
- 2816,	 // 0x0b00
-58871,	 // 0xe5f7
-63483,	 // 0xf7fb
-57351,	 // 0xe007
-65530,	 // 0xfffa
- 3076,	 // 0x0c04
- 7142,	 // 0x1be6
-63511,	 // 0xf817
-  497,	 // 0x01f1
-65244,	 // 0xfedc
-64511,	 // 0xfbff
-47953,	 // 0xbb51
- 7941,	 // 0x1f05
-60940,	 // 0xee0c
- 5149,	 // 0x141d
-64509,	 // 0xfbfd
- 6434,	 // 0x1922
-62977,	 // 0xf601
-52492,	 // 0xcd0c
-11039,	 // 0x2b1f
-15072,	 // 0x3ae0
-61466,	 // 0xf01a
-57838,	 // 0xe1ee
-11280,	 // 0x2c10
-64272,	 // 0xfb10
- 2079,	 // 0x081f
- 1559,	 // 0x0617
-65288,	 // 0xff08
-63500,	 // 0xf80c
-63991,	 // 0xf9f7
-55053,	 // 0xd70d
-61476,	 // 0xf024
-33047,	 // 0x8117
- 5901,	 // 0x170d
- 1509,	 // 0x05e5
- 1294,	 // 0x050e
-52978,	 // 0xcef2
-65020,	 // 0xfdfc
-12077,	 // 0x2f2d
-63247,	 // 0xf70f
-62738,	 // 0xf512
-13853,	 // 0x361d
- 8215,	 // 0x2017
- 2551,	 // 0x09f7
-65326,	 // 0xff2e
- 1999,	 // 0x07cf
- 2257,	 // 0x08d1
-63825,	 // 0xf951
- 1032,	 // 0x0408
-54297,	 // 0xd419
- 6434,	 // 0x1922
- 3878,	 // 0x0f26
-64024,	 // 0xfa18
-64281,	 // 0xfb19
-63768,	 // 0xf918
- 4735,	 // 0x127f
-58366,	 // 0xe3fe
-52713,	 // 0xcde9
-11556,	 // 0x2d24
-14290,	 // 0x37d2
-61892,	 // 0xf1c4
- 4844,	 // 0x12ec
-59091,	 // 0xe6d3
-60715,	 // 0xed2b
-55095,	 // 0xd737
- 5355,	 // 0x14eb
-63185,	 // 0xf6d1
-58616,	 // 0xe4f8
-61189,	 // 0xef05
- 7408,	 // 0x1cf0
-63729,	 // 0xf8f1
-10287,	 // 0x282f
-10728,	 // 0x29e8
- 6157,	 // 0x180d
- 2807,	 // 0x0af7
-58610,	 // 0xe4f2
-43479,	 // 0xa9d7
-59131,	 // 0xe6fb
-60394,	 // 0xebea
- 1541,	 // 0x0605
- 1828,	 // 0x0724
- 8955,	 // 0x22fb
- 1781,	 // 0x06f5
- 7158,	 // 0x1bf6
-60673,	 // 0xed01
-  261,	 // 0x0105
-64000,	 // 0xfa00
-62725,	 // 0xf505
- 7169,	 // 0x1c01
-65295,	 // 0xff0f
-60183,	 // 0xeb17
- 2551,	 // 0x09f7
- 8444,	 // 0x20fc
-65035,	 // 0xfe0b
- 3291,	 // 0x0cdb
- 4601,	 // 0x11f9
-  535,	 // 0x0217
- 1042,	 // 0x0412
- 2072,	 // 0x0818
-64276,	 // 0xfb14
- 1028,	 // 0x0404
- 2065,	 // 0x0811
-64508,	 // 0xfbfc
- 6154,	 // 0x180a
-61714,	 // 0xf112
- 4349,	 // 0x10fd
- 1780,	 // 0x06f4
-64515,	 // 0xfc03
-65283,	 // 0xff03
- 4586,	 // 0x11ea
-63218,	 // 0xf6f2
-  483,	 // 0x01e3
- 1025,	 // 0x0401
- 8464,	 // 0x2110
-62214,	 // 0xf306
- 2047,	 // 0x07ff
-65033,	 // 0xfe09
-  501,	 // 0x01f5
-  744,	 // 0x02e8
-62981,	 // 0xf605
-32523,	 // 0x7f0b
- 2816,	 // 0x0b00
-17899,	 // 0x45eb
-62986,	 // 0xf60a
-65525,	 // 0xfff5
-64257,	 // 0xfb01
-64000,	 // 0xfa00
-62198,	 // 0xf2f6
-63232,	 // 0xf700
- 2049,	 // 0x0801
-63728,	 // 0xf8f0
- 4868,	 // 0x1304
-60688,	 // 0xed10
- 4114,	 // 0x1012
- 1280,	 // 0x0500
-64495,	 // 0xfbef
- 4613,	 // 0x1205
-61960,	 // 0xf208
- 5883,	 // 0x16fb
-64533,	 // 0xfc15
-65532,	 // 0xfffc
-65531,	 // 0xfffb
- 4090,	 // 0x0ffa
-64551,	 // 0xfc27
- 1014,	 // 0x03f6
- 6133,	 // 0x17f5
-   12,	 // 0x000c
-  513,	 // 0x0201
-  518,	 // 0x0206
-63735,	 // 0xf8f7
- 1030,	 // 0x0406
-61925,	 // 0xf1e5
-58345,	 // 0xe3e9
-60680,	 // 0xed08
-62453,	 // 0xf3f5
-61174,	 // 0xeef6
- 2546,	 // 0x09f2
- 4609,	 // 0x1201
-  521,	 // 0x0209
-63497,	 // 0xf809
- 3578,	 // 0x0dfa
-64534,	 // 0xfc16
-    7,	 // 0x0007
-64274,	 // 0xfb12
-33035,	 // 0x810b
-    7,	 // 0x0007
-65526,	 // 0xfff6
-  277,	 // 0x0115
- 9963,	 // 0x26eb
-58404,	 // 0xe424
- 3668,	 // 0x0e54
-64251,	 // 0xfafb
- 7901,	 // 0x1edd
-63686,	 // 0xf8c6
-62958,	 // 0xf5ee
-62156,	 // 0xf2cc
- 7685,	 // 0x1e05
-  244,	 // 0x00f4
- 1767,	 // 0x06e7
- 2302,	 // 0x08fe
-59384,	 // 0xe7f8
- 3786,	 // 0x0eca
-63244,	 // 0xf70c
-60384,	 // 0xebe0
-59389,	 // 0xe7fd
-55292,	 // 0xd7fc
-60929,	 // 0xee01
-59100,	 // 0xe6dc
- 9521,	 // 0x2531
-  748,	 // 0x02ec
-63518,	 // 0xf81e
-64181,	 // 0xfab5
-21238,	 // 0x52f6
- 1086,	 // 0x043e
-57597,	 // 0xe0fd
-61512,	 // 0xf048
-64495,	 // 0xfbef
-62722,	 // 0xf502
- 1771,	 // 0x06eb
-63505,	 // 0xf811
-42753,	 // 0xa701
-63474,	 // 0xf7f2
-13039,	 // 0x32ef
- 2313,	 // 0x0909
- 4860,	 // 0x12fc
- 7679,	 // 0x1dff
-55302,	 // 0xd806
- 9484,	 // 0x250c
-33242,	 // 0x81da
-64727,	 // 0xfcd7
-10722,	 // 0x29e2
-61466,	 // 0xf01a
-62724,	 // 0xf504
-61701,	 // 0xf105
- 2829,	 // 0x0b0d
-  521,	 // 0x0209
- 2291,	 // 0x08f3
-59915,	 // 0xea0b
-63490,	 // 0xf802
-57833,	 // 0xe1e9
-65527,	 // 0xfff7
- 2816,	 // 0x0b00
-63491,	 // 0xf803
- 4823,	 // 0x12d7
- 5371,	 // 0x14fb
- 5886,	 // 0x16fe
- 2548,	 // 0x09f4
- 1008,	 // 0x03f0
-61456,	 // 0xf010
- 6403,	 // 0x1903
- 2263,	 // 0x08d7
- 1992,	 // 0x07c8
- 2032,	 // 0x07f0
- 6409,	 // 0x1909
- 4113,	 // 0x1011
- 4088,	 // 0x0ff8
-65300,	 // 0xff14
-64510,	 // 0xfbfe
-63770,	 // 0xf91a
-63012,	 // 0xf624
-65522,	 // 0xfff2
-  254,	 // 0x00fe
-56850,	 // 0xde12
-65026,	 // 0xfe02
- 4621,	 // 0x120d
-63992,	 // 0xf9f8
- 4348,	 // 0x10fc
- 1030,	 // 0x0406
-64015,	 // 0xfa0f
-61940,	 // 0xf1f4
- 1032,	 // 0x0408
- 3825,	 // 0x0ef1
-33042,	 // 0x8112
-57865,	 // 0xe209
-31262,	 // 0x7a1e
- 7485,	 // 0x1d3d
-15394,	 // 0x3c22
-18486,	 // 0x4836
- 1745,	 // 0x06d1
-13821,	 // 0x35fd
- 3754,	 // 0x0eaa
- 4325,	 // 0x10e5
- 5916,	 // 0x171c
-65000,	 // 0xfde8
-60936,	 // 0xee08
-33048,	 // 0x8118
- 1011,	 // 0x03f3
-14598,	 // 0x3906
- 6862,	 // 0x1ace
-22783,	 // 0x58ff
-63677,	 // 0xf8bd
- 5651,	 // 0x1613
-  503,	 // 0x01f7
-52006,	 // 0xcb26
-57389,	 // 0xe02d
-22881,	 // 0x5961
-24231,	 // 0x5ea7
- 1548,	 // 0x060c
-62767,	 // 0xf52f
-14324,	 // 0x37f4
-54563,	 // 0xd523
-65291,	 // 0xff0b
-63679,	 // 0xf8bf
- 4088,	 // 0x0ff8
-  519,	 // 0x0207
-10464,	 // 0x28e0
-14320,	 // 0x37f0
-48854,	 // 0xbed6
-60821,	 // 0xed95
- 2828,	 // 0x0b0c
- 3896,	 // 0x0f38
- 2580,	 // 0x0a14
- 8675,	 // 0x21e3
-  239,	 // 0x00ef
-  243,	 // 0x00f3
- 3853,	 // 0x0f0d
-39718,	 // 0x9b26
-55258,	 // 0xd7da
- 1973,	 // 0x07b5
- 2549,	 // 0x09f5
-65273,	 // 0xfef9
-  770,	 // 0x0302
- 4346,	 // 0x10fa
-  503,	 // 0x01f7
-  771,	 // 0x0303
- 2312,	 // 0x0908
- 2554,	 // 0x09fa
-    3,	 // 0x0003
-64519,	 // 0xfc07
-63745,	 // 0xf901
- 2573,	 // 0x0a0d
-65027,	 // 0xfe03
-61943,	 // 0xf1f7
-65526,	 // 0xfff6
- 3852,	 // 0x0f0c
-64520,	 // 0xfc08
-64001,	 // 0xfa01
-64506,	 // 0xfbfa
-63480,	 // 0xf7f8
-64827,	 // 0xfd3b
- 2046,	 // 0x07fe
-64774,	 // 0xfd06
- 2822,	 // 0x0b06
-65281,	 // 0xff01
-   15,	 // 0x000f
-63496,	 // 0xf808
- 1284,	 // 0x0504
-  255,	 // 0x00ff
-    3,	 // 0x0003
-65524,	 // 0xfff4
-61692,	 // 0xf0fc
-  257,	 // 0x0101
-63498,	 // 0xf80a
-64515,	 // 0xfc03
-  246,	 // 0x00f6
-65276,	 // 0xfefc
-  254,	 // 0x00fe
-65261,	 // 0xfeed
-64771,	 // 0xfd03
- 1028,	 // 0x0404
-33032,	 // 0x8108
-65023,	 // 0xfdff
- 6390,	 // 0x18f6
- 2548,	 // 0x09f4
-61948,	 // 0xf1fc
-61191,	 // 0xef07
- 4049,	 // 0x0fd1
-60681,	 // 0xed09
- 2103,	 // 0x0837
-62207,	 // 0xf2ff
-61687,	 // 0xf0f7
-61431,	 // 0xeff7
-63221,	 // 0xf6f5
- 4077,	 // 0x0fed
- 2570,	 // 0x0a0a
-  227,	 // 0x00e3
- 3584,	 // 0x0e00
- 2055,	 // 0x0807
-60421,	 // 0xec05
-65283,	 // 0xff03
- 1276,	 // 0x04fc
-63227,	 // 0xf6fb
-61438,	 // 0xeffe
- 1409,	 // 0x0581
-61175,	 // 0xeef7
- 3837,	 // 0x0efd
-  234,	 // 0x00ea
- 1540,	 // 0x0604
-59906,	 // 0xea02
-  787,	 // 0x0313
- 4365,	 // 0x110d
-  223,	 // 0x00df
-  773,	 // 0x0305
- 1019,	 // 0x03fb
-65288,	 // 0xff08
-61959,	 // 0xf207
-53997,	 // 0xd2ed
- 3839,	 // 0x0eff
- 5599,	 // 0x15df
-  263,	 // 0x0107
- 2035,	 // 0x07f3
- 2036,	 // 0x07f4
-60673,	 // 0xed01
- 1015,	 // 0x03f7
-45570,	 // 0xb202
-  505,	 // 0x01f9
- 9973,	 // 0x26f5
-59385,	 // 0xe7f9
-57847,	 // 0xe1f7
-65278,	 // 0xfefe
-11521,	 // 0x2d01
-63991,	 // 0xf9f7
-64007,	 // 0xfa07
-58898,	 // 0xe612
-64245,	 // 0xfaf5
-60420,	 // 0xec04
-61443,	 // 0xf003
- 1540,	 // 0x0604
- 2554,	 // 0x09fa
-65518,	 // 0xffee
-61938,	 // 0xf1f2
-    1,	 // 0x0001
- 1315,	 // 0x0523
-64755,	 // 0xfcf3
- 1271,	 // 0x04f7
-    3,	 // 0x0003
-64779,	 // 0xfd0b
-63615,	 // 0xf87f
- 2048,	 // 0x0800
-60420,	 // 0xec04
- 3339,	 // 0x0d0b
- 4597,	 // 0x11f5
-59890,	 // 0xe9f2
-    8,	 // 0x0008
- 3315,	 // 0x0cf3
-62483,	 // 0xf413
-62217,	 // 0xf309
-62226,	 // 0xf312
-  775,	 // 0x0307
-63741,	 // 0xf8fd
- 1000,	 // 0x03e8
- 9211,	 // 0x23fb
- 2798,	 // 0x0aee
-62970,	 // 0xf5fa
- 2046,	 // 0x07fe
-60454,	 // 0xec26
- 3580,	 // 0x0dfc
-60908,	 // 0xedec
-60921,	 // 0xedf9
-   12,	 // 0x000c
-  271,	 // 0x010f
- 6140,	 // 0x17fc
- 4354,	 // 0x1102
- 1533,	 // 0x05fd
-65002,	 // 0xfdea
- 1780,	 // 0x06f4
- 2046,	 // 0x07fe
-63747,	 // 0xf903
-60419,	 // 0xec03
-60944,	 // 0xee10
- 1800,	 // 0x0708
- 1290,	 // 0x050a
-  263,	 // 0x0107
- 4628,	 // 0x1214
- 1538,	 // 0x0602
-11777,	 // 0x2e01
- 1532,	 // 0x05fc
-63727,	 // 0xf8ef
- 1782,	 // 0x06f6
-65535,	 // 0xffff
-64751,	 // 0xfcef
-64639,	 // 0xfc7f
- 1785,	 // 0x06f9
-  532,	 // 0x0214
-63227,	 // 0xf6fb
- 4865,	 // 0x1301
-  761,	 // 0x02f9
- 1015,	 // 0x03f7
- 4091,	 // 0x0ffb
-  264,	 // 0x0108
-   24,	 // 0x0018
- 5124,	 // 0x1404
-  511,	 // 0x01ff
- 2289,	 // 0x08f1
-63724,	 // 0xf8ec
-63506,	 // 0xf812
- 1529,	 // 0x05f9
-  502,	 // 0x01f6
- 4614,	 // 0x1206
-  516,	 // 0x0204
- 1806,	 // 0x070e
- 3317,	 // 0x0cf5
-48385,	 // 0xbd01
- 2566,	 // 0x0a06
- 2555,	 // 0x09fb
-58368,	 // 0xe400
- 7190,	 // 0x1c16
-41034,	 // 0xa04a
- 2596,	 // 0x0a24
-  517,	 // 0x0205
-10601,	 // 0x2969
-63981,	 // 0xf9ed
-56065,	 // 0xdb01
-64235,	 // 0xfaeb
-59377,	 // 0xe7f1
-21770,	 // 0x550a
-62985,	 // 0xf609
-41732,	 // 0xa304
-58334,	 // 0xe3de
- 8451,	 // 0x2103
-47834,	 // 0xbada
-60145,	 // 0xeaf1
- 2845,	 // 0x0b1d
- 1579,	 // 0x062b
-51696,	 // 0xc9f0
- 9539,	 // 0x2543
- 5637,	 // 0x1605
-61708,	 // 0xf10c
- 1019,	 // 0x03fb
-15086,	 // 0x3aee
-59105,	 // 0xe6e1
- 9453,	 // 0x24ed
-54038,	 // 0xd316
- 1040,	 // 0x0410
- 7426,	 // 0x1d02
-65265,	 // 0xfef1
-21034,	 // 0x522a
-64475,	 // 0xfbdb
-33240,	 // 0x81d8
-10452,	 // 0x28d4
- 4330,	 // 0x10ea
-63479,	 // 0xf7f7
-16155,	 // 0x3f1b
- 2285,	 // 0x08ed
- 7188,	 // 0x1c14
-64748,	 // 0xfcec
- 2307,	 // 0x0903
- 3827,	 // 0x0ef3
-26384,	 // 0x6710
- 1032,	 // 0x0408
- 3594,	 // 0x0e0a
- 2314,	 // 0x090a
- 1551,	 // 0x060f
- 1541,	 // 0x0605
-63505,	 // 0xf811
- 1278,	 // 0x04fe
- 4094,	 // 0x0ffe
- 3580,	 // 0x0dfc
-64254,	 // 0xfafe
-59381,	 // 0xe7f5
- 4835,	 // 0x12e3
-57593,	 // 0xe0f9
-60398,	 // 0xebee
- 6930,	 // 0x1b12
-60163,	 // 0xeb03
-  503,	 // 0x01f7
-63476,	 // 0xf7f4
-59148,	 // 0xe70c
-60168,	 // 0xeb08
-63741,	 // 0xf8fd
- 2810,	 // 0x0afa
-63739,	 // 0xf8fb
-65284,	 // 0xff04
- 3325,	 // 0x0cfd
-65264,	 // 0xfef0
-65528,	 // 0xfff8
- 4853,	 // 0x12f5
-64247,	 // 0xfaf7
-65018,	 // 0xfdfa
- 2574,	 // 0x0a0e
- 9221,	 // 0x2405
-61681,	 // 0xf0f1
-62476,	 // 0xf40c
-65527,	 // 0xfff7
-63471,	 // 0xf7ef
- 1283,	 // 0x0503
-63478,	 // 0xf7f6
-  527,	 // 0x020f
-  777,	 // 0x0309
-62981,	 // 0xf605
-32767,	 // 0x7fff
- 2063,	 // 0x080f
- 4876,	 // 0x130c
-  507,	 // 0x01fb
- 2040,	 // 0x07f8
-  258,	 // 0x0102
-  767,	 // 0x02ff
-  518,	 // 0x0206
-63231,	 // 0xf6ff
- 1027,	 // 0x0403
-61949,	 // 0xf1fd
-62224,	 // 0xf310
-  516,	 // 0x0204
-63487,	 // 0xf7ff
- 1015,	 // 0x03f7
-  520,	 // 0x0208
- 2820,	 // 0x0b04
- 2812,	 // 0x0afc
-64773,	 // 0xfd05
-65527,	 // 0xfff7
- 2043,	 // 0x07fb
-64260,	 // 0xfb04
-  773,	 // 0x0305
-65043,	 // 0xfe13
- 2815,	 // 0x0aff
-64777,	 // 0xfd09
-65280,	 // 0xff00
-65282,	 // 0xff02
-  257,	 // 0x0101
-65026,	 // 0xfe02
- 2298,	 // 0x08fa
-64514,	 // 0xfc02
-64259,	 // 0xfb03
-    8,	 // 0x0008
- 1025,	 // 0x0401
-  510,	 // 0x01fe
- 2048,	 // 0x0800
- 3070,	 // 0x0bfe
-  517,	 // 0x0205
-65281,	 // 0xff01
- 1538,	 // 0x0602
-    2,	 // 0x0002
- 1276,	 // 0x04fc
-64256,	 // 0xfb00
-33277,	 // 0x81fd
- 1024,	 // 0x0400
- 4862,	 // 0x12fe
- 1776,	 // 0x06f0
- 2556,	 // 0x09fc
-56321,	 // 0xdc01
-62720,	 // 0xf500
-  511,	 // 0x01ff
-57106,	 // 0xdf12
- 3823,	 // 0x0eef
-60671,	 // 0xecff
- 3325,	 // 0x0cfd
- 2325,	 // 0x0915
-65269,	 // 0xfef5
-  496,	 // 0x01f0
-  520,	 // 0x0208
-63750,	 // 0xf906
- 4362,	 // 0x110a
-55282,	 // 0xd7f2
-   19,	 // 0x0013
-65516,	 // 0xffec
- 5902,	 // 0x170e
-  248,	 // 0x00f8
- 3199,	 // 0x0c7f
-65307,	 // 0xff1b
-64241,	 // 0xfaf1
-62706,	 // 0xf4f2
- 3078,	 // 0x0c06
- 1007,	 // 0x03ef
- 2554,	 // 0x09fa
-63491,	 // 0xf803
-63746,	 // 0xf902
-65021,	 // 0xfdfd
-64252,	 // 0xfafc
-60413,	 // 0xebfd
-56796,	 // 0xdddc
- 1289,	 // 0x0509
-  495,	 // 0x01ef
-65257,	 // 0xfee9
- 3090,	 // 0x0c12
-63747,	 // 0xf903
- 1544,	 // 0x0608
-63751,	 // 0xf907
-61446,	 // 0xf006
-49654,	 // 0xc1f6
-64507,	 // 0xfbfb
- 7667,	 // 0x1df3
- 5612,	 // 0x15ec
-62192,	 // 0xf2f0
-60707,	 // 0xed23
- 3367,	 // 0x0d27
-53754,	 // 0xd1fa
-63772,	 // 0xf91c
- 3292,	 // 0x0cdc
-61175,	 // 0xeef7
- 1249,	 // 0x04e1
- 1291,	 // 0x050b
-56838,	 // 0xde06
-  758,	 // 0x02f6
- 5103,	 // 0x13ef
-   11,	 // 0x000b
- 2548,	 // 0x09f4
-55293,	 // 0xd7fd
-61960,	 // 0xf208
-61133,	 // 0xeecd
-63716,	 // 0xf8e4
-56055,	 // 0xdaf7
- 9450,	 // 0x24ea
- 1030,	 // 0x0406
-65030,	 // 0xfe06
-64522,	 // 0xfc0a
-  760,	 // 0x02f8
-  732,	 // 0x02dc
-62767,	 // 0xf52f
- 5661,	 // 0x161d
-62943,	 // 0xf5df
-64767,	 // 0xfcff
- 2057,	 // 0x0809
-65041,	 // 0xfe11
-57359,	 // 0xe00f
-53774,	 // 0xd20e
-62197,	 // 0xf2f5
-65013,	 // 0xfdf5
- 4604,	 // 0x11fc
- 4635,	 // 0x121b
- 4618,	 // 0x120a
- 1018,	 // 0x03fa
- 1545,	 // 0x0609
-33033,	 // 0x8109
- 1234,	 // 0x04d2
-13789,	 // 0x35dd
- 6645,	 // 0x19f5
-56581,	 // 0xdd05
- 3609,	 // 0x0e19
-58608,	 // 0xe4f0
- 7962,	 // 0x1f1a
-52693,	 // 0xcdd5
-59923,	 // 0xea13
-62436,	 // 0xf3e4
-  559,	 // 0x022f
-  266,	 // 0x010a
-64814,	 // 0xfd2e
-59640,	 // 0xe8f8
-  497,	 // 0x01f1
- 9937,	 // 0x26d1
- 6142,	 // 0x17fe
- 5116,	 // 0x13fc
- 3084,	 // 0x0c0c
-61678,	 // 0xf0ee
- 2864,	 // 0x0b30
- 7634,	 // 0x1dd2
- 3833,	 // 0x0ef9
- 2028,	 // 0x07ec
-62232,	 // 0xf318
-62207,	 // 0xf2ff
- 2819,	 // 0x0b03
-62973,	 // 0xf5fd
-18417,	 // 0x47f1
-64499,	 // 0xfbf3
- 1805,	 // 0x070d
-62716,	 // 0xf4fc
-15590,	 // 0x3ce6
-62402,	 // 0xf3c2
-60432,	 // 0xec10
- 6425,	 // 0x1919
- 2022,	 // 0x07e6
- 3605,	 // 0x0e15
-10502,	 // 0x2906
- 3573,	 // 0x0df5
-10255,	 // 0x280f
- 7644,	 // 0x1ddc
- 6126,	 // 0x17ee
-32538,	 // 0x7f1a
-63543,	 // 0xf837
-15575,	 // 0x3cd7
- 1027,	 // 0x0403
- 2302,	 // 0x08fe
-  513,	 // 0x0201
-63994,	 // 0xf9fa
-  771,	 // 0x0303
-65529,	 // 0xfff9
- 5117,	 // 0x13fd
-  256,	 // 0x0100
-    3,	 // 0x0003
- 4111,	 // 0x100f
- 2802,	 // 0x0af2
-64768,	 // 0xfd00
-65526,	 // 0xfff6
-64256,	 // 0xfb00
-  756,	 // 0x02f4
- 3081,	 // 0x0c09
-63754,	 // 0xf90a
- 1540,	 // 0x0604
- 2314,	 // 0x090a
-  768,	 // 0x0300
-62337,	 // 0xf381
-  764,	 // 0x02fc
- 1799,	 // 0x0707
-64779,	 // 0xfd0b
- 1542,	 // 0x0606
- 6408,	 // 0x1908
- 5883,	 // 0x16fb
-65029,	 // 0xfe05
-63740,	 // 0xf8fc
- 2284,	 // 0x08ec
- 3583,	 // 0x0dff
-62967,	 // 0xf5f7
-63996,	 // 0xf9fc
- 1017,	 // 0x03f9
- 5110,	 // 0x13f6
-   20,	 // 0x0014
- 1542,	 // 0x0606
-  512,	 // 0x0200
- 6659,	 // 0x1a03
-56836,	 // 0xde04
-63009,	 // 0xf621
-57108,	 // 0xdf14
- 3053,	 // 0x0bed
-62703,	 // 0xf4ef
- 6886,	 // 0x1ae6
-  798,	 // 0x031e
- 9738,	 // 0x260a
- 3594,	 // 0x0e0a
- 8695,	 // 0x21f7
-62464,	 // 0xf400
-  259,	 // 0x0103
- 2303,	 // 0x08ff
- 2808,	 // 0x0af8
- 1252,	 // 0x04e4
-65263,	 // 0xfeef
-61977,	 // 0xf219
- 7418,	 // 0x1cfa
- 6120,	 // 0x17e8
- 5887,	 // 0x16ff
-62700,	 // 0xf4ec
-    5,	 // 0x0005
-59916,	 // 0xea0c
-61687,	 // 0xf0f7
-65021,	 // 0xfdfd
-55169,	 // 0xd781
- 3329,	 // 0x0d01
-  768,	 // 0x0300
- 2556,	 // 0x09fc
- 6127,	 // 0x17ef
- 2552,	 // 0x09f8
- 2835,	 // 0x0b13
-61197,	 // 0xef0d
- 8185,	 // 0x1ff9
- 6657,	 // 0x1a01
-65267,	 // 0xfef3
-60175,	 // 0xeb0f
- 6917,	 // 0x1b05
-63508,	 // 0xf814
-63295,	 // 0xf73f
-61475,	 // 0xf023
- 5608,	 // 0x15e8
-63739,	 // 0xf8fb
-62967,	 // 0xf5f7
-58894,	 // 0xe60e
- 1822,	 // 0x071e
-64242,	 // 0xfaf2
- 3604,	 // 0x0e14
- 7926,	 // 0x1ef6
-56565,	 // 0xdcf5
-20277,	 // 0x4f35
- 3818,	 // 0x0eea
-60351,	 // 0xebbf
-13288,	 // 0x33e8
-57835,	 // 0xe1eb
-56100,	 // 0xdb24
- 2506,	 // 0x09ca
-55073,	 // 0xd721
-10741,	 // 0x29f5
- 2566,	 // 0x0a06
-13822,	 // 0x35fe
-16144,	 // 0x3f10
-11487,	 // 0x2cdf
-64998,	 // 0xfde6
- 8732,	 // 0x221c
- 1054,	 // 0x041e
-63509,	 // 0xf815
- 2809,	 // 0x0af9
- 4878,	 // 0x130e
-49793,	 // 0xc281
-   18,	 // 0x0012
- 6434,	 // 0x1922
-  495,	 // 0x01ef
-54312,	 // 0xd428
- 2037,	 // 0x07f5
- 7392,	 // 0x1ce0
-  752,	 // 0x02f0
- 1596,	 // 0x063c
-  246,	 // 0x00f6
-  549,	 // 0x0225
-54555,	 // 0xd51b
-64028,	 // 0xfa1c
- 6978,	 // 0x1b42
-65264,	 // 0xfef0
-60921,	 // 0xedf9
-65244,	 // 0xfedc
- 7184,	 // 0x1c10
- 1502,	 // 0x05de
- 8695,	 // 0x21f7
-27338,	 // 0x6aca
-60937,	 // 0xee09
- 6638,	 // 0x19ee
-56865,	 // 0xde21
- 5875,	 // 0x16f3
-61099,	 // 0xeeab
-11720,	 // 0x2dc8
- 6489,	 // 0x1959
-63481,	 // 0xf7f9
-63842,	 // 0xf962
- 6100,	 // 0x17d4
-50664,	 // 0xc5e8
-64955,	 // 0xfdbb
-58126,	 // 0xe30e
-62703,	 // 0xf4ef
- 5615,	 // 0x15ef
- 4919,	 // 0x1337
-16357,	 // 0x3fe5
- 4846,	 // 0x12ee
-10022,	 // 0x2726
-63937,	 // 0xf9c1
-60631,	 // 0xecd7
-49644,	 // 0xc1ec
-16112,	 // 0x3ef0
-37285,	 // 0x91a5
- 2563,	 // 0x0a03
- 9141,	 // 0x23b5
-51984,	 // 0xcb10
- 5594,	 // 0x15da
-  520,	 // 0x0208
-59148,	 // 0xe70c
-44107,	 // 0xac4b
- 1745,	 // 0x06d1
-50955,	 // 0xc70b
- 8413,	 // 0x20dd
-43772,	 // 0xaafc
-  331,	 // 0x014b
-13695,	 // 0x357f
-18927,	 // 0x49ef
-63203,	 // 0xf6e3
- 7869,	 // 0x1ebd
-11946,	 // 0x2eaa
-64016,	 // 0xfa10
-56767,	 // 0xddbf
- 1807,	 // 0x070f
- 1034,	 // 0x040a
-63809,	 // 0xf941
-14636,	 // 0x392c
- 2243,	 // 0x08c3
-46403,	 // 0xb543
-15779,	 // 0x3da3
- 3273,	 // 0x0cc9
-50087,	 // 0xc3a7
- 9934,	 // 0x26ce
-49164,	 // 0xc00c
-34982,	 // 0x88a6
- 3787,	 // 0x0ecb
-27553,	 // 0x6ba1
-43049,	 // 0xa829
-19454,	 // 0x4bfe
-22531,	 // 0x5803
-64535,	 // 0xfc17
-21563,	 // 0x543b
- 7308,	 // 0x1c8c
-59411,	 // 0xe813
- 2481,	 // 0x09b1
- 7667,	 // 0x1df3
-55019,	 // 0xd6eb
-37147,	 // 0x911b
-13463,	 // 0x3497
-39840,	 // 0x9ba0
-54340,	 // 0xd444
-42671,	 // 0xa6af
-52183,	 // 0xcbd7
-42772,	 // 0xa714
-53445,	 // 0xd0c5
-39061,	 // 0x9895
- 5706,	 // 0x164a
-48266,	 // 0xbc8a
-50917,	 // 0xc6e5
-51941,	 // 0xcae5
-20153,	 // 0x4eb9
-18260,	 // 0x4754
-33167,	 // 0x818f
-12275,	 // 0x2ff3
-35530,	 // 0x8aca
-47589,	 // 0xb9e5
- 5275,	 // 0x149b
-19264,	 // 0x4b40
- 3801,	 // 0x0ed9
-19115,	 // 0x4aab
-14043,	 // 0x36db
- 2562,	 // 0x0a02
-64267,	 // 0xfb0b
-64255,	 // 0xfaff
-  275,	 // 0x0113
-  501,	 // 0x01f5
-  266,	 // 0x010a
- 4371,	 // 0x1113
-62720,	 // 0xf500
- 7928,	 // 0x1ef8
- 1262,	 // 0x04ee
- 3063,	 // 0x0bf7
- 3313,	 // 0x0cf1
-63749,	 // 0xf905
-64271,	 // 0xfb0f
- 2574,	 // 0x0a0e
-  515,	 // 0x0203
-  513,	 // 0x0201
-  765,	 // 0x02fd
-63477,	 // 0xf7f5
- 4884,	 // 0x1314
-61567,	 // 0xf07f
-65530,	 // 0xfffa
-65013,	 // 0xfdf5
-65025,	 // 0xfe01
- 3043,	 // 0x0be3
- 4348,	 // 0x10fc
- 2049,	 // 0x0801
- 5617,	 // 0x15f1
-65261,	 // 0xfeed
- 2307,	 // 0x0903
-64513,	 // 0xfc01
-63768,	 // 0xf918
- 1804,	 // 0x070c
- 2030,	 // 0x07ee
-61448,	 // 0xf008
-63759,	 // 0xf90f
-62724,	 // 0xf504
-62714,	 // 0xf4fa
-  733,	 // 0x02dd
-60179,	 // 0xeb13
-62487,	 // 0xf417
- 5337,	 // 0x14d9
- 1027,	 // 0x0403
- 8696,	 // 0x21f8
-  236,	 // 0x00ec
- 4370,	 // 0x1112
-  509,	 // 0x01fd
-  258,	 // 0x0102
-65029,	 // 0xfe05
-61694,	 // 0xf0fe
- 1547,	 // 0x060b
- 1031,	 // 0x0407
-63744,	 // 0xf900
- 3319,	 // 0x0cf7
- 1296,	 // 0x0510
- 1274,	 // 0x04fa
- 5387,	 // 0x150b
-63486,	 // 0xf7fe
-  260,	 // 0x0104
- 1537,	 // 0x0601
- 1021,	 // 0x03fd
-65280,	 // 0xff00
- 1802,	 // 0x070a
-  762,	 // 0x02fa
- 1665,	 // 0x0681
-  770,	 // 0x0302
-63995,	 // 0xf9fb
-64756,	 // 0xfcf4
-    3,	 // 0x0003
-64503,	 // 0xfbf7
-62471,	 // 0xf407
-  772,	 // 0x0304
- 2300,	 // 0x08fc
- 3340,	 // 0x0d0c
- 1033,	 // 0x0409
-63756,	 // 0xf90c
-  246,	 // 0x00f6
-  264,	 // 0x0108
-62981,	 // 0xf605
-    4,	 // 0x0004
-  241,	 // 0x00f1
- 4358,	 // 0x1106
-  762,	 // 0x02fa
- 1277,	 // 0x04fd
-65531,	 // 0xfffb
- 2798,	 // 0x0aee
-64510,	 // 0xfbfe
-64270,	 // 0xfb0e
-  498,	 // 0x01f2
-64258,	 // 0xfb02
-62703,	 // 0xf4ef
-64753,	 // 0xfcf1
-64001,	 // 0xfa01
-61438,	 // 0xeffe
- 2044,	 // 0x07fc
- 1278,	 // 0x04fe
- 2810,	 // 0x0afa
-64274,	 // 0xfb12
- 4857,	 // 0x12f9
- 1789,	 // 0x06fd
- 1528,	 // 0x05f8
-  761,	 // 0x02f9
- 3841,	 // 0x0f01
-  776,	 // 0x0308
-64773,	 // 0xfd05
-63224,	 // 0xf6f8
- 3074,	 // 0x0c02
-62701,	 // 0xf4ed
-63940,	 // 0xf9c4
-60170,	 // 0xeb0a
- 1789,	 // 0x06fd
-65266,	 // 0xfef2
- 2551,	 // 0x09f7
-64508,	 // 0xfbfc
-  753,	 // 0x02f1
-  282,	 // 0x011a
-64273,	 // 0xfb11
- 1541,	 // 0x0605
- 3328,	 // 0x0d00
-63744,	 // 0xf900
-65502,	 // 0xffde
-64776,	 // 0xfd08
- 1784,	 // 0x06f8
-65270,	 // 0xfef6
- 3067,	 // 0x0bfb
- 5107,	 // 0x13f3
- 2051,	 // 0x0803
-64002,	 // 0xfa02
- 1795,	 // 0x0703
-33024,	 // 0x8100
- 1000,	 // 0x03e8
-15357,	 // 0x3bfd
-59910,	 // 0xea06
-59899,	 // 0xe9fb
-  512,	 // 0x0200
- 1295,	 // 0x050f
-64765,	 // 0xfcfd
-63239,	 // 0xf707
-  502,	 // 0x01f6
- 9219,	 // 0x2403
-63442,	 // 0xf7d2
- 3078,	 // 0x0c06
-62458,	 // 0xf3fa
-63998,	 // 0xf9fe
-63508,	 // 0xf814
-    1,	 // 0x0001
- 2040,	 // 0x07f8
-63236,	 // 0xf704
-64236,	 // 0xfaec
-65297,	 // 0xff11
-61190,	 // 0xef06
-64249,	 // 0xfaf9
-60404,	 // 0xebf4
-64260,	 // 0xfb04
- 2248,	 // 0x08c8
-  504,	 // 0x01f8
-61195,	 // 0xef0b
-64784,	 // 0xfd10
-65023,	 // 0xfdff
-63740,	 // 0xf8fc
- 1555,	 // 0x0613
-60674,	 // 0xed02
-58108,	 // 0xe2fc
- 1506,	 // 0x05e2
- 5143,	 // 0x1417
-58354,	 // 0xe3f2
-61968,	 // 0xf210
-  246,	 // 0x00f6
-61437,	 // 0xeffd
- 6647,	 // 0x19f7
- 3070,	 // 0x0bfe
-63245,	 // 0xf70d
-64772,	 // 0xfd04
-33276,	 // 0x81fc
- 1036,	 // 0x040c
- 9485,	 // 0x250d
-  260,	 // 0x0104
-63487,	 // 0xf7ff
-  520,	 // 0x0208
-  769,	 // 0x0301
-  258,	 // 0x0102
- 8448,	 // 0x2100
-  769,	 // 0x0301
-  765,	 // 0x02fd
- 1535,	 // 0x05ff
-64513,	 // 0xfc01
-65023,	 // 0xfdff
-  512,	 // 0x0200
-64503,	 // 0xfbf7
- 1283,	 // 0x0503
- 3615,	 // 0x0e1f
-65283,	 // 0xff03
- 3068,	 // 0x0bfc
- 2307,	 // 0x0903
-  256,	 // 0x0100
-  459,	 // 0x01cb
-63412,	 // 0xf7b4
- 1022,	 // 0x03fe
- 1533,	 // 0x05fd
-  258,	 // 0x0102
-65035,	 // 0xfe0b
-64514,	 // 0xfc02
- 1036,	 // 0x040c
-64897,	 // 0xfd81
-65513,	 // 0xffe9
-  256,	 // 0x0100
-  511,	 // 0x01ff
-65280,	 // 0xff00
-  258,	 // 0x0102
-   41,	 // 0x0029
- 6148,	 // 0x1804
-  511,	 // 0x01ff
-  253,	 // 0x00fd
-  770,	 // 0x0302
-57085,	 // 0xdefd
-  771,	 // 0x0303
-  258,	 // 0x0102
-64003,	 // 0xfa03
-65249,	 // 0xfee1
- 3839,	 // 0x0eff
-65029,	 // 0xfe05
-63995,	 // 0xf9fb
-65279,	 // 0xfeff
- 1793,	 // 0x0701
-64519,	 // 0xfc07
- 3835,	 // 0x0efb
- 2310,	 // 0x0906
- 1802,	 // 0x070a
- 3824,	 // 0x0ef0
-64265,	 // 0xfb09
-64768,	 // 0xfd00
-64256,	 // 0xfb00
-  268,	 // 0x010c
-  260,	 // 0x0104
-65028,	 // 0xfe04
- 1027,	 // 0x0403
-64769,	 // 0xfd01
-63225,	 // 0xf6f9
-65023,	 // 0xfdff
-64772,	 // 0xfd04
-64328,	 // 0xfb48
-65028,	 // 0xfe04
-  504,	 // 0x01f8
-  772,	 // 0x0304
- 1797,	 // 0x0705
-  522,	 // 0x020a
-64772,	 // 0xfd04
-61440,	 // 0xf000
-  767,	 // 0x02ff
-62979,	 // 0xf603
- 1527,	 // 0x05f7
-  778,	 // 0x030a
-  769,	 // 0x0301
-  242,	 // 0x00f2
-  263,	 // 0x0107
- 1014,	 // 0x03f6
- 2040,	 // 0x07f8
- 1018,	 // 0x03fa
-64257,	 // 0xfb01
-65024,	 // 0xfe00
- 1796,	 // 0x0704
-33026,	 // 0x8102
- 3336,	 // 0x0d08
-61439,	 // 0xefff
- 1789,	 // 0x06fd
-65029,	 // 0xfe05
-  762,	 // 0x02fa
-  515,	 // 0x0203
- 2305,	 // 0x0901
-64512,	 // 0xfc00
-  249,	 // 0x00f9
- 1025,	 // 0x0401
-  250,	 // 0x00fa
-  256,	 // 0x0100
-64767,	 // 0xfcff
-  515,	 // 0x0203
-62978,	 // 0xf602
-  251,	 // 0x00fb
- 1531,	 // 0x05fb
-    1,	 // 0x0001
- 1542,	 // 0x0606
-63483,	 // 0xf7fb
-63747,	 // 0xf903
-64773,	 // 0xfd05
-62687,	 // 0xf4df
-64511,	 // 0xfbff
-  517,	 // 0x0205
-    2,	 // 0x0002
-64261,	 // 0xfb05
-  507,	 // 0x01fb
-65029,	 // 0xfe05
- 2042,	 // 0x07fa
-65532,	 // 0xfffc
-65534,	 // 0xfffe
- 1028,	 // 0x0404
- 1789,	 // 0x06fd
-65028,	 // 0xfe04
-65284,	 // 0xff04
-65535,	 // 0xffff
-64257,	 // 0xfb01
-  264,	 // 0x0108
-65535,	 // 0xffff
- 2044,	 // 0x07fc
-    0,	 // 0x0000
- 1277,	 // 0x04fd
-33025,	 // 0x8101
-64000,	 // 0xfa00
-64510,	 // 0xfbfe
-65295,	 // 0xff0f
-  767,	 // 0x02ff
- 1796,	 // 0x0704
-65528,	 // 0xfff8
-  241,	 // 0x00f1
-64255,	 // 0xfaff
- 1540,	 // 0x0604
-63729,	 // 0xf8f1
-63234,	 // 0xf702
-64496,	 // 0xfbf0
- 4342,	 // 0x10f6
- 4867,	 // 0x1303
-64537,	 // 0xfc19
- 5111,	 // 0x13f7
- 3314,	 // 0x0cf2
-60403,	 // 0xebf3
-62713,	 // 0xf4f9
- 1538,	 // 0x0602
- 3566,	 // 0x0dee
-62972,	 // 0xf5fc
-61311,	 // 0xef7f
- 1282,	 // 0x0502
- 3581,	 // 0x0dfd
-62479,	 // 0xf40f
-  526,	 // 0x020e
-   11,	 // 0x000b
- 2294,	 // 0x08f6
-61197,	 // 0xef0d
- 5385,	 // 0x1509
- 2548,	 // 0x09f4
- 1818,	 // 0x071a
- 2533,	 // 0x09e5
-  517,	 // 0x0205
-57868,	 // 0xe20c
-  539,	 // 0x021b
-63258,	 // 0xf71a
- 1541,	 // 0x0605
- 3321,	 // 0x0cf9
- 1533,	 // 0x05fd
-64745,	 // 0xfce9
- 3848,	 // 0x0f08
-17944,	 // 0x4618
-64240,	 // 0xfaf0
-62703,	 // 0xf4ef
-64759,	 // 0xfcf7
-64531,	 // 0xfc13
-65029,	 // 0xfe05
- 3327,	 // 0x0cff
-  265,	 // 0x0109
- 3570,	 // 0x0df2
-   10,	 // 0x000a
-63495,	 // 0xf807
-65033,	 // 0xfe09
- 1535,	 // 0x05ff
-65275,	 // 0xfefb
-  774,	 // 0x0306
- 2311,	 // 0x0907
-  763,	 // 0x02fb
- 1277,	 // 0x04fd
-  248,	 // 0x00f8
- 1043,	 // 0x0413
- 2812,	 // 0x0afc
- 2044,	 // 0x07fc
-60180,	 // 0xeb14
-64050,	 // 0xfa32
-64505,	 // 0xfbf9
-62977,	 // 0xf601
- 3078,	 // 0x0c06
- 6409,	 // 0x1909
-  265,	 // 0x0109
- 1541,	 // 0x0605
- 2803,	 // 0x0af3
- 1820,	 // 0x071c
- 1276,	 // 0x04fc
-64508,	 // 0xfbfc
-  530,	 // 0x0212
- 1276,	 // 0x04fc
-62457,	 // 0xf3f9
-63481,	 // 0xf7f9
-  774,	 // 0x0306
-  489,	 // 0x01e9
- 3340,	 // 0x0d0c
-59133,	 // 0xe6fd
- 1031,	 // 0x0407
-63486,	 // 0xf7fe
-32522,	 // 0x7f0a
- 1781,	 // 0x06f5
- 9724,	 // 0x25fc
- 2058,	 // 0x080a
-62964,	 // 0xf5f4
-65287,	 // 0xff07
-62976,	 // 0xf600
- 6879,	 // 0x1adf
-63501,	 // 0xf80d
-  768,	 // 0x0300
- 4085,	 // 0x0ff5
- 1021,	 // 0x03fd
-56602,	 // 0xdd1a
-58364,	 // 0xe3fc
-62471,	 // 0xf407
- 2329,	 // 0x0919
- 1300,	 // 0x0514
- 1281,	 // 0x0501
-58638,	 // 0xe50e
-65262,	 // 0xfeee
-63494,	 // 0xf806
-56281,	 // 0xdbd9
-64795,	 // 0xfd1b
-55398,	 // 0xd866
-64785,	 // 0xfd11
- 2808,	 // 0x0af8
-64524,	 // 0xfc0c
-56583,	 // 0xdd07
-61720,	 // 0xf118
-61176,	 // 0xeef8
- 7397,	 // 0x1ce5
-62189,	 // 0xf2ed
-58353,	 // 0xe3f1
-60364,	 // 0xebcc
- 5339,	 // 0x14db
- 3851,	 // 0x0f0b
-58875,	 // 0xe5fb
-  778,	 // 0x030a
-63243,	 // 0xf70b
-56335,	 // 0xdc0f
-60405,	 // 0xebf5
-  781,	 // 0x030d
- 1303,	 // 0x0517
- 1294,	 // 0x050e
-32525,	 // 0x7f0d
-62487,	 // 0xf417
-63487,	 // 0xf7ff
-64252,	 // 0xfafc
-65271,	 // 0xfef7
-62726,	 // 0xf506
- 1014,	 // 0x03f6
-64513,	 // 0xfc01
- 2049,	 // 0x0801
-63492,	 // 0xf804
-64763,	 // 0xfcfb
-  509,	 // 0x01fd
-64770,	 // 0xfd02
- 1284,	 // 0x0504
-64776,	 // 0xfd08
-   14,	 // 0x000e
-64007,	 // 0xfa07
- 2822,	 // 0x0b06
-65030,	 // 0xfe06
-61691,	 // 0xf0fb
- 1535,	 // 0x05ff
-65283,	 // 0xff03
- 1784,	 // 0x06f8
-  260,	 // 0x0104
- 2562,	 // 0x0a02
-  254,	 // 0x00fe
- 1040,	 // 0x0410
-62978,	 // 0xf602
-  263,	 // 0x0107
-  255,	 // 0x00ff
-65290,	 // 0xff0a
-64257,	 // 0xfb01
-64002,	 // 0xfa02
-63235,	 // 0xf703
- 1283,	 // 0x0503
-  259,	 // 0x0103
-63995,	 // 0xf9fb
- 7421,	 // 0x1cfd
-65026,	 // 0xfe02
-63499,	 // 0xf80b
- 2561,	 // 0x0a01
-  501,	 // 0x01f5
-    1,	 // 0x0001
-  758,	 // 0x02f6
-33037,	 // 0x810d
- 1018,	 // 0x03fa
-65039,	 // 0xfe0f
- 3574,	 // 0x0df6
- 2053,	 // 0x0805
- 7933,	 // 0x1efd
-60728,	 // 0xed38
-61194,	 // 0xef0a
-11279,	 // 0x2c0f
-59927,	 // 0xea17
-19716,	 // 0x4d04
- 8697,	 // 0x21f9
-  756,	 // 0x02f4
-  778,	 // 0x030a
-15812,	 // 0x3dc4
-61736,	 // 0xf128
-13314,	 // 0x3402
-53263,	 // 0xd00f
-  832,	 // 0x0340
-62708,	 // 0xf4f4
-63776,	 // 0xf920
-60390,	 // 0xebe6
- 2568,	 // 0x0a08
-49537,	 // 0xc181
-64797,	 // 0xfd1d
- 2026,	 // 0x07ea
-62964,	 // 0xf5f4
-61988,	 // 0xf224
-58282,	 // 0xe3aa
-62455,	 // 0xf3f7
-65309,	 // 0xff1d
-61702,	 // 0xf106
-60468,	 // 0xec34
- 4131,	 // 0x1023
-65043,	 // 0xfe13
-62213,	 // 0xf305
- 3848,	 // 0x0f08
- 5363,	 // 0x14f3
-64242,	 // 0xfaf2
-  273,	 // 0x0111
-14577,	 // 0x38f1
-64001,	 // 0xfa01
- 5338,	 // 0x14da
-16836,	 // 0x41c4
-34037,	 // 0x84f5
-15358,	 // 0x3bfe
- 4627,	 // 0x1213
-53508,	 // 0xd104
-47068,	 // 0xb7dc
-   24,	 // 0x0018
- 5632,	 // 0x1600
-62723,	 // 0xf503
- 2620,	 // 0x0a3c
- 2275,	 // 0x08e3
-64470,	 // 0xfbd6
- 9752,	 // 0x2618
- 5640,	 // 0x1608
-60392,	 // 0xebe8
- 6189,	 // 0x182d
-19504,	 // 0x4c30
- 1524,	 // 0x05f4
-16872,	 // 0x41e8
- 1040,	 // 0x0410
-60141,	 // 0xeaed
- 8174,	 // 0x1fee
-57788,	 // 0xe1bc
-62262,	 // 0xf336
-58184,	 // 0xe348
-11788,	 // 0x2e0c
-60649,	 // 0xece9
-62490,	 // 0xf41a
-  746,	 // 0x02ea
- 7184,	 // 0x1c10
- 9504,	 // 0x2520
- 4361,	 // 0x1109
- 4351,	 // 0x10ff
-62983,	 // 0xf607
-57864,	 // 0xe208
-56085,	 // 0xdb15
- 4369,	 // 0x1111
- 6667,	 // 0x1a0b
-55893,	 // 0xda55
-49947,	 // 0xc31b
-63207,	 // 0xf6e7
-62722,	 // 0xf502
-46811,	 // 0xb6db
-63758,	 // 0xf90e
-60176,	 // 0xeb10
-33032,	 // 0x8108
-12011,	 // 0x2eeb
-21252,	 // 0x5304
-63995,	 // 0xf9fb
-63474,	 // 0xf7f2
-65034,	 // 0xfe0a
- 1544,	 // 0x0608
-  770,	 // 0x0302
-  262,	 // 0x0106
-65512,	 // 0xffe8
- 3073,	 // 0x0c01
- 1523,	 // 0x05f3
-  511,	 // 0x01ff
-62199,	 // 0xf2f7
-  766,	 // 0x02fe
- 1793,	 // 0x0701
- 1270,	 // 0x04f6
- 2801,	 // 0x0af1
-61962,	 // 0xf20a
-64770,	 // 0xfd02
-   10,	 // 0x000a
-65017,	 // 0xfdf9
-62974,	 // 0xf5fe
-63873,	 // 0xf981
- 1545,	 // 0x0609
-   11,	 // 0x000b
-64771,	 // 0xfd03
-64252,	 // 0xfafc
-  252,	 // 0x00fc
-  273,	 // 0x0111
- 5380,	 // 0x1504
-65530,	 // 0xfffa
-65277,	 // 0xfefd
-    3,	 // 0x0003
-61183,	 // 0xeeff
-63496,	 // 0xf808
-64523,	 // 0xfc0b
-63740,	 // 0xf8fc
-63244,	 // 0xf70c
-    7,	 // 0x0007
-61952,	 // 0xf200
-    5,	 // 0x0005
-64763,	 // 0xfcfb
-  513,	 // 0x0201
-60928,	 // 0xee00
-63990,	 // 0xf9f6
- 3847,	 // 0x0f07
-64791,	 // 0xfd17
-  228,	 // 0x00e4
- 5880,	 // 0x16f8
-62752,	 // 0xf520
- 7427,	 // 0x1d03
-57376,	 // 0xe020
-64005,	 // 0xfa05
-56315,	 // 0xdbfb
- 6155,	 // 0x180b
-63729,	 // 0xf8f1
-53497,	 // 0xd0f9
-60704,	 // 0xed20
-12800,	 // 0x3200
-57602,	 // 0xe102
-62236,	 // 0xf31c
-59140,	 // 0xe704
-61160,	 // 0xeee8
-65047,	 // 0xfe17
-57072,	 // 0xdef0
-55029,	 // 0xd6f5
-62725,	 // 0xf505
-59661,	 // 0xe90d
- 1018,	 // 0x03fa
- 3326,	 // 0x0cfe
-46561,	 // 0xb5e1
-  999,	 // 0x03e7
- 9243,	 // 0x241b
-61950,	 // 0xf1fe
- 3049,	 // 0x0be9
- 4342,	 // 0x10f6
-58615,	 // 0xe4f7
-11769,	 // 0x2df9
-61999,	 // 0xf22f
-59422,	 // 0xe81e
-60654,	 // 0xecee
-49715,	 // 0xc233
-64527,	 // 0xfc0f
-60933,	 // 0xee05
-  492,	 // 0x01ec
-  773,	 // 0x0305
-60149,	 // 0xeaf5
-60380,	 // 0xebdc
-62253,	 // 0xf32d
-32752,	 // 0x7ff0
-63484,	 // 0xf7fc
- 2801,	 // 0x0af1
-  245,	 // 0x00f5
- 3070,	 // 0x0bfe
-61186,	 // 0xef02
- 1045,	 // 0x0415
- 1546,	 // 0x060a
-63499,	 // 0xf80b
-62723,	 // 0xf503
-62214,	 // 0xf306
- 4596,	 // 0x11f4
- 1016,	 // 0x03f8
-  772,	 // 0x0304
-64008,	 // 0xfa08
-64759,	 // 0xfcf7
-57856,	 // 0xe200
-65289,	 // 0xff09
- 3307,	 // 0x0ceb
-    0,	 // 0x0000
- 1024,	 // 0x0400
-65407,	 // 0xff7f
- 1271,	 // 0x04f7
-64754,	 // 0xfcf2
-64517,	 // 0xfc05
-  779,	 // 0x030b
- 1291,	 // 0x050b
-64770,	 // 0xfd02
- 1023,	 // 0x03ff
-64013,	 // 0xfa0d
-63994,	 // 0xf9fa
-63227,	 // 0xf6fb
-  765,	 // 0x02fd
-65030,	 // 0xfe06
-62703,	 // 0xf4ef
-65527,	 // 0xfff7
- 2561,	 // 0x0a01
- 2821,	 // 0x0b05
- 2296,	 // 0x08f8
-62971,	 // 0xf5fb
-64018,	 // 0xfa12
-60676,	 // 0xed04
-36358,	 // 0x8e06
-  755,	 // 0x02f3
- 4090,	 // 0x0ffa
-61195,	 // 0xef0b
- 6398,	 // 0x18fe
-65285,	 // 0xff05
- 4607,	 // 0x11ff
-65039,	 // 0xfe0f
- 3064,	 // 0x0bf8
-11270,	 // 0x2c06
-64290,	 // 0xfb22
- 1029,	 // 0x0405
-65014,	 // 0xfdf6
-   11,	 // 0x000b
-63756,	 // 0xf90c
- 6935,	 // 0x1b17
- 4343,	 // 0x10f7
-65277,	 // 0xfefd
-  266,	 // 0x010a
- 2054,	 // 0x0806
- 5363,	 // 0x14f3
- 2076,	 // 0x081c
-62752,	 // 0xf520
-  641,	 // 0x0281
-59664,	 // 0xe910
-65290,	 // 0xff0a
- 5116,	 // 0x13fc
-62486,	 // 0xf416
- 2808,	 // 0x0af8
- 5367,	 // 0x14f7
-53765,	 // 0xd205
- 9461,	 // 0x24f5
- 1282,	 // 0x0502
-  246,	 // 0x00f6
-65044,	 // 0xfe14
- 2302,	 // 0x08fe
- 1289,	 // 0x0509
-64522,	 // 0xfc0a
-61421,	 // 0xefed
- 3048,	 // 0x0be8
- 1578,	 // 0x062a
- 1798,	 // 0x0706
-64513,	 // 0xfc01
-64018,	 // 0xfa12
-59881,	 // 0xe9e9
-62434,	 // 0xf3e2
-56095,	 // 0xdb1f
- 2866,	 // 0x0b32
-63989,	 // 0xf9f5
-  242,	 // 0x00f2
-64255,	 // 0xfaff
-62984,	 // 0xf608
- 4614,	 // 0x1206
-  758,	 // 0x02f6
- 1534,	 // 0x05fe
-65024,	 // 0xfe00
- 5895,	 // 0x1707
-63224,	 // 0xf6f8
-65015,	 // 0xfdf7
-60421,	 // 0xec05
- 2059,	 // 0x080b
- 1020,	 // 0x03fc
-62982,	 // 0xf606
-63494,	 // 0xf806
-62974,	 // 0xf5fe
-  261,	 // 0x0105
-64738,	 // 0xfce2
-64686,	 // 0xfcae
-63993,	 // 0xf9f9
-13572,	 // 0x3504
-63745,	 // 0xf901
- 4849,	 // 0x12f1
- 4593,	 // 0x11f1
-65024,	 // 0xfe00
- 5136,	 // 0x1410
-56805,	 // 0xdde5
-64527,	 // 0xfc0f
- 1028,	 // 0x0404
- 3321,	 // 0x0cf9
-57093,	 // 0xdf05
-63473,	 // 0xf7f1
-64248,	 // 0xfaf8
-  519,	 // 0x0207
-63246,	 // 0xf70e
- 1534,	 // 0x05fe
-63487,	 // 0xf7ff
-64517,	 // 0xfc05
-64254,	 // 0xfafe
-33260,	 // 0x81ec
-  262,	 // 0x0106
-60668,	 // 0xecfc
-47914,	 // 0xbb2a
-56324,	 // 0xdc04
-65240,	 // 0xfed8
-55520,	 // 0xd8e0
-58336,	 // 0xe3e0
- 3048,	 // 0x0be8
- 4341,	 // 0x10f5
- 2797,	 // 0x0aed
-60410,	 // 0xebfa
-60921,	 // 0xedf9
-11520,	 // 0x2d00
-61752,	 // 0xf138
- 1265,	 // 0x04f1
-12878,	 // 0x324e
-64772,	 // 0xfd04
-58378,	 // 0xe40a
-62155,	 // 0xf2cb
-65261,	 // 0xfeed
-10496,	 // 0x2900
- 7173,	 // 0x1c05
-13027,	 // 0x32e3
-61935,	 // 0xf1ef
-14100,	 // 0x3714
-62458,	 // 0xf3fa
-55514,	 // 0xd8da
-64257,	 // 0xfb01
-58601,	 // 0xe4e9
- 5156,	 // 0x1424
-54965,	 // 0xd6b5
-64820,	 // 0xfd34
-54818,	 // 0xd622
-65267,	 // 0xfef3
-60401,	 // 0xebf1
- 8156,	 // 0x1fdc
- 3813,	 // 0x0ee5
- 9975,	 // 0x26f7
-61722,	 // 0xf11a
- 5089,	 // 0x13e1
- 8452,	 // 0x2104
-62724,	 // 0xf504
- 9981,	 // 0x26fd
-33264,	 // 0x81f0
- 3522,	 // 0x0dc2
-23298,	 // 0x5b02
- 1262,	 // 0x04ee
- 3842,	 // 0x0f02
-  267,	 // 0x010b
- 2047,	 // 0x07ff
- 1542,	 // 0x0606
- 1791,	 // 0x06ff
-65274,	 // 0xfefa
- 1537,	 // 0x0601
- 3065,	 // 0x0bf9
-61952,	 // 0xf200
- 2828,	 // 0x0b0c
- 3592,	 // 0x0e08
-63219,	 // 0xf6f3
-64270,	 // 0xfb0e
-63978,	 // 0xf9ea
-65035,	 // 0xfe0b
-65281,	 // 0xff01
-63224,	 // 0xf6f8
-62227,	 // 0xf313
- 2311,	 // 0x0907
-64639,	 // 0xfc7f
- 4116,	 // 0x1014
-64766,	 // 0xfcfe
-64271,	 // 0xfb0f
-   14,	 // 0x000e
- 6663,	 // 0x1a07
- 3071,	 // 0x0bff
-64513,	 // 0xfc01
-  785,	 // 0x0311
- 2023,	 // 0x07e7
-64767,	 // 0xfcff
-61696,	 // 0xf100
- 2300,	 // 0x08fc
-62974,	 // 0xf5fe
- 1276,	 // 0x04fc
-    8,	 // 0x0008
-62979,	 // 0xf603
- 3062,	 // 0x0bf6
-  515,	 // 0x0203
- 1531,	 // 0x05fb
-63238,	 // 0xf706
-57101,	 // 0xdf0d
-59887,	 // 0xe9ef
- 4115,	 // 0x1013
-65534,	 // 0xfffe
- 1283,	 // 0x0503
- 1021,	 // 0x03fd
-  759,	 // 0x02f7
-  766,	 // 0x02fe
- 1023,	 // 0x03ff
-65019,	 // 0xfdfb
-64243,	 // 0xfaf3
-65528,	 // 0xfff8
-  758,	 // 0x02f6
-63743,	 // 0xf8ff
- 1799,	 // 0x0707
-64765,	 // 0xfcfd
-  503,	 // 0x01f7
- 2296,	 // 0x08f8
-63255,	 // 0xf717
-64253,	 // 0xfafd
-  767,	 // 0x02ff
-63471,	 // 0xf7ef
-   15,	 // 0x000f
-61569,	 // 0xf081
-  261,	 // 0x0105
-64524,	 // 0xfc0c
-65278,	 // 0xfefe
-  510,	 // 0x01fe
-  766,	 // 0x02fe
-    4,	 // 0x0004
-  255,	 // 0x00ff
-65013,	 // 0xfdf5
- 1023,	 // 0x03ff
-64509,	 // 0xfbfd
- 2569,	 // 0x0a09
-65281,	 // 0xff01
-  270,	 // 0x010e
- 1014,	 // 0x03f6
-63227,	 // 0xf6fb
- 1796,	 // 0x0704
-65283,	 // 0xff03
-63745,	 // 0xf901
-  252,	 // 0x00fc
-63484,	 // 0xf7fc
-55034,	 // 0xd6fa
- 4099,	 // 0x1003
- 4104,	 // 0x1008
- 5334,	 // 0x14d6
- 2575,	 // 0x0a0f
- 2865,	 // 0x0b31
- 3304,	 // 0x0ce8
-10758,	 // 0x2a06
-59865,	 // 0xe9d9
-62974,	 // 0xf5fe
-20233,	 // 0x4f09
- 3066,	 // 0x0bfa
- 4327,	 // 0x10e7
-10474,	 // 0x28ea
- 8441,	 // 0x20f9
-14858,	 // 0x3a0a
-21440,	 // 0x53c0
-17612,	 // 0x44cc
-58664,	 // 0xe528
-59648,	 // 0xe900
-63237,	 // 0xf705
-   34,	 // 0x0022
- 1254,	 // 0x04e6
-61311,	 // 0xef7f
-55548,	 // 0xd8fc
- 3111,	 // 0x0c27
-61675,	 // 0xf0eb
-64247,	 // 0xfaf7
-64497,	 // 0xfbf1
-16921,	 // 0x4219
-10255,	 // 0x280f
- 6643,	 // 0x19f3
- 4100,	 // 0x1004
-65233,	 // 0xfed1
-61391,	 // 0xefcf
-59438,	 // 0xe82e
- 5639,	 // 0x1607
- 2049,	 // 0x0801
- 1021,	 // 0x03fd
-  793,	 // 0x0319
-16622,	 // 0x40ee
- 1283,	 // 0x0503
- 2051,	 // 0x0803
-65523,	 // 0xfff3
-35063,	 // 0x88f7
-15352,	 // 0x3bf8
-10748,	 // 0x29fc
-  257,	 // 0x0101
-63491,	 // 0xf803
-64237,	 // 0xfaed
-  248,	 // 0x00f8
-  258,	 // 0x0102
-64772,	 // 0xfd04
- 1549,	 // 0x060d
-59129,	 // 0xe6f9
-  779,	 // 0x030b
-64778,	 // 0xfd0a
- 3322,	 // 0x0cfa
- 1528,	 // 0x05f8
-64506,	 // 0xfbfa
-63254,	 // 0xf716
-64244,	 // 0xfaf4
-  503,	 // 0x01f7
-  517,	 // 0x0205
- 2811,	 // 0x0afb
- 1791,	 // 0x06ff
- 3844,	 // 0x0f04
-  478,	 // 0x01de
-  508,	 // 0x01fc
-    8,	 // 0x0008
-64767,	 // 0xfcff
-  518,	 // 0x0206
- 3837,	 // 0x0efd
-  507,	 // 0x01fb
-64259,	 // 0xfb03
-65015,	 // 0xfdf7
-63492,	 // 0xf804
-  516,	 // 0x0204
-64754,	 // 0xfcf2
- 3332,	 // 0x0d04
-  768,	 // 0x0300
-65028,	 // 0xfe04
-    4,	 // 0x0004
-64512,	 // 0xfc00
- 1538,	 // 0x0602
-64521,	 // 0xfc09
-62979,	 // 0xf603
-64767,	 // 0xfcff
-33024,	 // 0x8100
-63747,	 // 0xf903
-   12,	 // 0x000c
-61948,	 // 0xf1fc
-65525,	 // 0xfff5
-61692,	 // 0xf0fc
-  510,	 // 0x01fe
-55030,	 // 0xd6f6
-65530,	 // 0xfffa
-  517,	 // 0x0205
-63235,	 // 0xf703
-    1,	 // 0x0001
-63483,	 // 0xf7fb
- 1794,	 // 0x0702
- 3076,	 // 0x0c04
-64772,	 // 0xfd04
- 4085,	 // 0x0ff5
-  767,	 // 0x02ff
- 1545,	 // 0x0609
-65018,	 // 0xfdfa
-  242,	 // 0x00f2
- 1283,	 // 0x0503
-63217,	 // 0xf6f1
-  466,	 // 0x01d2
- 1022,	 // 0x03fe
- 1279,	 // 0x04ff
-65023,	 // 0xfdff
- 5372,	 // 0x14fc
-  755,	 // 0x02f3
-64253,	 // 0xfafd
-61709,	 // 0xf10d
-  256,	 // 0x0100
-65036,	 // 0xfe0c
-  523,	 // 0x020b
-60403,	 // 0xebf3
-65532,	 // 0xfffc
- 1545,	 // 0x0609
-65034,	 // 0xfe0a
-64523,	 // 0xfc0b
- 1026,	 // 0x0402
-  253,	 // 0x00fd
-  249,	 // 0x00f9
-  510,	 // 0x01fe
- 1276,	 // 0x04fc
-33275,	 // 0x81fb
-  771,	 // 0x0303
- 1532,	 // 0x05fc
-64006,	 // 0xfa06
-59905,	 // 0xea01
-63741,	 // 0xf8fd
- 3594,	 // 0x0e0a
-65273,	 // 0xfef9
- 3079,	 // 0x0c07
-    2,	 // 0x0002
-  519,	 // 0x0207
- 3587,	 // 0x0e03
- 4598,	 // 0x11f6
-65263,	 // 0xfeef
-62725,	 // 0xf505
- 2842,	 // 0x0b1a
- 2028,	 // 0x07ec
-  508,	 // 0x01fc
-64252,	 // 0xfafc
-   10,	 // 0x000a
- 4349,	 // 0x10fd
- 1524,	 // 0x05f4
-64505,	 // 0xfbf9
- 1153,	 // 0x0481
-64520,	 // 0xfc08
-64766,	 // 0xfcfe
- 2311,	 // 0x0907
-  243,	 // 0x00f3
-  261,	 // 0x0105
-61949,	 // 0xf1fd
- 7166,	 // 0x1bfe
-65012,	 // 0xfdf4
-60941,	 // 0xee0d
-62719,	 // 0xf4ff
- 6670,	 // 0x1a0e
-63732,	 // 0xf8f4
-  263,	 // 0x0107
-64004,	 // 0xfa04
-63983,	 // 0xf9ef
- 2579,	 // 0x0a13
-62740,	 // 0xf514
-63752,	 // 0xf908
-64004,	 // 0xfa04
-65276,	 // 0xfefc
-45822,	 // 0xb2fe
-64769,	 // 0xfd01
- 6660,	 // 0x1a04
- 3085,	 // 0x0c0d
- 3093,	 // 0x0c15
- 6881,	 // 0x1ae1
-64765,	 // 0xfcfd
- 3353,	 // 0x0d19
-64487,	 // 0xfbe7
-65036,	 // 0xfe0c
- 3584,	 // 0x0e00
-61201,	 // 0xef11
-61696,	 // 0xf100
-62717,	 // 0xf4fd
-64501,	 // 0xfbf5
-64517,	 // 0xfc05
-63750,	 // 0xf906
-56583,	 // 0xdd07
-10513,	 // 0x2911
-  766,	 // 0x02fe
- 6918,	 // 0x1b06
- 4627,	 // 0x1213
- 1285,	 // 0x0505
- 2433,	 // 0x0981
-60662,	 // 0xecf6
-65022,	 // 0xfdfe
-  767,	 // 0x02ff
- 1533,	 // 0x05fd
- 1040,	 // 0x0410
-59383,	 // 0xe7f7
- 2538,	 // 0x09ea
-63258,	 // 0xf71a
-  512,	 // 0x0200
- 4604,	 // 0x11fc
-56840,	 // 0xde08
- 1295,	 // 0x050f
-12786,	 // 0x31f2
-64007,	 // 0xfa07
- 2581,	 // 0x0a15
-62689,	 // 0xf4e1
-61159,	 // 0xeee7
-62976,	 // 0xf600
-  770,	 // 0x0302
-64256,	 // 0xfb00
-64510,	 // 0xfbfe
-  767,	 // 0x02ff
-58887,	 // 0xe607
-    1,	 // 0x0001
-65533,	 // 0xfffd
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-65024,	 // 0xfe00
- 3326,	 // 0x0cfe
-65280,	 // 0xff00
-  511,	 // 0x01ff
-65281,	 // 0xff01
-  254,	 // 0x00fe
-65280,	 // 0xff00
-65024,	 // 0xfe00
-  767,	 // 0x02ff
-    0,	 // 0x0000
-65287,	 // 0xff07
-65280,	 // 0xff00
- 1792,	 // 0x0700
-    2,	 // 0x0002
-  512,	 // 0x0200
-  498,	 // 0x01f2
-64897,	 // 0xfd81
-  259,	 // 0x0103
-65024,	 // 0xfe00
-  254,	 // 0x00fe
-  519,	 // 0x0207
-    3,	 // 0x0003
-    1,	 // 0x0001
-65499,	 // 0xffdb
-  249,	 // 0x00f9
-65280,	 // 0xff00
-65281,	 // 0xff01
-    0,	 // 0x0000
-  257,	 // 0x0101
-65292,	 // 0xff0c
- 2815,	 // 0x0aff
-  257,	 // 0x0101
-65281,	 // 0xff01
-    0,	 // 0x0000
-62721,	 // 0xf501
-65280,	 // 0xff00
-  766,	 // 0x02fe
-62463,	 // 0xf3ff
-65521,	 // 0xfff1
- 4355,	 // 0x1103
-63508,	 // 0xf814
-64260,	 // 0xfb04
-65047,	 // 0xfe17
- 4833,	 // 0x12e1
- 3845,	 // 0x0f05
- 2553,	 // 0x09f9
-62437,	 // 0xf3e5
-64775,	 // 0xfd07
- 3572,	 // 0x0df4
- 5358,	 // 0x14ee
-62453,	 // 0xf3f5
- 2299,	 // 0x08fb
-12286,	 // 0x2ffe
- 3072,	 // 0x0c00
-61672,	 // 0xf0e8
-65532,	 // 0xfffc
-   11,	 // 0x000b
-63752,	 // 0xf908
- 4079,	 // 0x0fef
-54012,	 // 0xd2fc
-64639,	 // 0xfc7f
- 1018,	 // 0x03fa
- 2838,	 // 0x0b16
- 5411,	 // 0x1523
- 2545,	 // 0x09f1
- 1815,	 // 0x0717
-63541,	 // 0xf835
- 5378,	 // 0x1502
-62496,	 // 0xf420
-62190,	 // 0xf2ee
-61449,	 // 0xf009
- 1580,	 // 0x062c
-64303,	 // 0xfb2f
-59395,	 // 0xe803
-58653,	 // 0xe51d
-58107,	 // 0xe2fb
- 5632,	 // 0x1600
-60188,	 // 0xeb1c
- 3840,	 // 0x0f00
- 5399,	 // 0x1517
-  774,	 // 0x0306
-38910,	 // 0x97fe
- 8145,	 // 0x1fd1
- 9232,	 // 0x2410
-  511,	 // 0x01ff
-64253,	 // 0xfafd
-    1,	 // 0x0001
-  513,	 // 0x0201
-  774,	 // 0x0306
- 1023,	 // 0x03ff
-65531,	 // 0xfffb
-  253,	 // 0x00fd
-  513,	 // 0x0201
-65026,	 // 0xfe02
-64510,	 // 0xfbfe
-64254,	 // 0xfafe
-  261,	 // 0x0105
- 1275,	 // 0x04fb
-    0,	 // 0x0000
-  258,	 // 0x0102
-  514,	 // 0x0202
-64767,	 // 0xfcff
-63733,	 // 0xf8f5
-65534,	 // 0xfffe
-  641,	 // 0x0281
-  253,	 // 0x00fd
-  260,	 // 0x0104
-  259,	 // 0x0103
-64254,	 // 0xfafe
-  264,	 // 0x0108
- 1793,	 // 0x0701
-  255,	 // 0x00ff
-  254,	 // 0x00fe
-64768,	 // 0xfd00
-65531,	 // 0xfffb
-    4,	 // 0x0004
-64505,	 // 0xfbf9
-  771,	 // 0x0303
- 1279,	 // 0x04ff
-    0,	 // 0x0000
-65280,	 // 0xff00
-64765,	 // 0xfcfd
-65282,	 // 0xff02
-65517,	 // 0xffed
-64257,	 // 0xfb01
-57601,	 // 0xe101
- 1541,	 // 0x0605
- 4608,	 // 0x1200
-60940,	 // 0xee0c
-64520,	 // 0xfc08
-65535,	 // 0xffff
-62200,	 // 0xf2f8
- 1593,	 // 0x0639
- 2820,	 // 0x0b04
- 3824,	 // 0x0ef0
- 3575,	 // 0x0df7
-  775,	 // 0x0307
-62456,	 // 0xf3f8
-56326,	 // 0xdc06
-64497,	 // 0xfbf1
- 4078,	 // 0x0fee
- 4620,	 // 0x120c
-58641,	 // 0xe511
-65036,	 // 0xfe0c
-63227,	 // 0xf6fb
-11002,	 // 0x2afa
-61949,	 // 0xf1fd
-62467,	 // 0xf403
-62053,	 // 0xf265
-61470,	 // 0xf01e
- 4324,	 // 0x10e4
-  751,	 // 0x02ef
-  265,	 // 0x0109
-63256,	 // 0xf718
-59891,	 // 0xe9f3
-58385,	 // 0xe411
-  511,	 // 0x01ff
-65006,	 // 0xfdee
-63999,	 // 0xf9ff
-64271,	 // 0xfb0f
-64775,	 // 0xfd07
- 1547,	 // 0x060b
-63478,	 // 0xf7f6
-62481,	 // 0xf411
- 5094,	 // 0x13e6
- 1507,	 // 0x05e3
-59159,	 // 0xe717
- 3827,	 // 0x0ef3
- 2324,	 // 0x0914
- 7424,	 // 0x1d00
- 1303,	 // 0x0517
-32533,	 // 0x7f15
-64239,	 // 0xfaef
- 4067,	 // 0x0fe3
-57899,	 // 0xe22b
-59410,	 // 0xe812
- 8199,	 // 0x2007
-59621,	 // 0xe8e5
-63982,	 // 0xf9ee
-  532,	 // 0x0214
-  275,	 // 0x0113
-  249,	 // 0x00f9
-  961,	 // 0x03c1
- 6662,	 // 0x1a06
-62459,	 // 0xf3fb
-59922,	 // 0xea12
-60909,	 // 0xeded
-51977,	 // 0xcb09
-10833,	 // 0x2a51
- 1846,	 // 0x0736
-60652,	 // 0xecec
-60943,	 // 0xee0f
-65001,	 // 0xfde9
-10755,	 // 0x2a03
-48851,	 // 0xbed3
- 3126,	 // 0x0c36
-58366,	 // 0xe3fe
-11777,	 // 0x2e01
- 1749,	 // 0x06d5
-14316,	 // 0x37ec
-   17,	 // 0x0011
-50933,	 // 0xc6f5
-30220,	 // 0x760c
-61171,	 // 0xeef3
- 3129,	 // 0x0c39
-57627,	 // 0xe11b
-12312,	 // 0x3018
-58084,	 // 0xe2e4
- 2583,	 // 0x0a17
-59394,	 // 0xe802
- 8446,	 // 0x20fe
-11786,	 // 0x2e0a
-59876,	 // 0xe9e4
-32523,	 // 0x7f0b
-62231,	 // 0xf317
-59364,	 // 0xe7e4
-48607,	 // 0xbddf
- 2034,	 // 0x07f2
- 4850,	 // 0x12f2
-  749,	 // 0x02ed
-25364,	 // 0x6314
-53496,	 // 0xd0f8
- 2277,	 // 0x08e5
-  991,	 // 0x03df
-11519,	 // 0x2cff
-12303,	 // 0x300f
-49736,	 // 0xc248
-  548,	 // 0x0224
- 2032,	 // 0x07f0
- 5118,	 // 0x13fe
-55828,	 // 0xda14
-57890,	 // 0xe222
-65230,	 // 0xfece
- 1796,	 // 0x0704
-60638,	 // 0xecde
-27159,	 // 0x6a17
-15134,	 // 0x3b1e
-37136,	 // 0x9110
-56361,	 // 0xdc29
-18683,	 // 0x48fb
- 5462,	 // 0x1556
-59886,	 // 0xe9ee
- 8934,	 // 0x22e6
- 1011,	 // 0x03f3
- 5600,	 // 0x15e0
-58325,	 // 0xe3d5
-32541,	 // 0x7f1d
-54521,	 // 0xd4f9
-15853,	 // 0x3ded
-60877,	 // 0xedcd
-54286,	 // 0xd40e
- 1305,	 // 0x0519
-15616,	 // 0x3d00
-53711,	 // 0xd1cf
- 6414,	 // 0x190e
-57828,	 // 0xe1e4
-58662,	 // 0xe526
- 1371,	 // 0x055b
-57579,	 // 0xe0eb
-24764,	 // 0x60bc
-64502,	 // 0xfbf6
-11093,	 // 0x2b55
-60139,	 // 0xeaeb
-15119,	 // 0x3b0f
- 5386,	 // 0x150a
- 6114,	 // 0x17e2
- 3286,	 // 0x0cd6
-62230,	 // 0xf316
-56592,	 // 0xdd10
-48391,	 // 0xbd07
- 3292,	 // 0x0cdc
-62456,	 // 0xf3f8
-  524,	 // 0x020c
-58115,	 // 0xe303
- 4959,	 // 0x135f
- 3328,	 // 0x0d00
-62958,	 // 0xf5ee
-51525,	 // 0xc945
-51430,	 // 0xc8e6
- 6097,	 // 0x17d1
-56599,	 // 0xdd17
-  466,	 // 0x01d2
-49368,	 // 0xc0d8
- 4313,	 // 0x10d9
-46330,	 // 0xb4fa
-26428,	 // 0x673c
-19975,	 // 0x4e07
-42741,	 // 0xa6f5
- 1785,	 // 0x06f9
-64544,	 // 0xfc20
-32533,	 // 0x7f15
-12332,	 // 0x302c
-22757,	 // 0x58e5
- 3868,	 // 0x0f1c
-17689,	 // 0x4519
-  511,	 // 0x01ff
-61189,	 // 0xef05
-58849,	 // 0xe5e1
-56272,	 // 0xdbd0
-59188,	 // 0xe734
-46605,	 // 0xb60d
-50091,	 // 0xc3ab
- 9199,	 // 0x23ef
-11229,	 // 0x2bdd
- 3066,	 // 0x0bfa
-63758,	 // 0xf90e
- 1785,	 // 0x06f9
-  272,	 // 0x0110
- 6909,	 // 0x1afd
-64010,	 // 0xfa0a
-62738,	 // 0xf512
-57585,	 // 0xe0f1
- 2838,	 // 0x0b16
- 2840,	 // 0x0b18
-    2,	 // 0x0002
-62709,	 // 0xf4f5
-64258,	 // 0xfb02
- 1289,	 // 0x0509
-61968,	 // 0xf210
-63221,	 // 0xf6f5
- 7126,	 // 0x1bd6
-62723,	 // 0xf503
-57866,	 // 0xe20a
- 1272,	 // 0x04f8
-  767,	 // 0x02ff
-64009,	 // 0xfa09
- 2546,	 // 0x09f2
-  236,	 // 0x00ec
- 1284,	 // 0x0504
-57099,	 // 0xdf0b
-  514,	 // 0x0202
-  254,	 // 0x00fe
-  754,	 // 0x02f2
- 2306,	 // 0x0902
-33272,	 // 0x81f8
-61177,	 // 0xeef9
-60455,	 // 0xec27
-  505,	 // 0x01f9
-64760,	 // 0xfcf8
-64008,	 // 0xfa08
-63989,	 // 0xf9f5
- 1792,	 // 0x0700
- 5374,	 // 0x14fe
-65520,	 // 0xfff0
-65032,	 // 0xfe08
-41983,	 // 0xa3ff
-63996,	 // 0xf9fc
-14073,	 // 0x36f9
-57095,	 // 0xdf07
-  257,	 // 0x0101
-64789,	 // 0xfd15
-58865,	 // 0xe5f1
-65324,	 // 0xff2c
- 1792,	 // 0x0700
-59124,	 // 0xe6f4
- 8173,	 // 0x1fed
- 3318,	 // 0x0cf6
-61178,	 // 0xeefa
-64503,	 // 0xfbf7
- 4077,	 // 0x0fed
-60922,	 // 0xedfa
-55314,	 // 0xd812
- 5597,	 // 0x15dd
- 3584,	 // 0x0e00
- 1262,	 // 0x04ee
-64236,	 // 0xfaec
-53804,	 // 0xd22c
-63993,	 // 0xf9f9
- 2319,	 // 0x090f
- 4119,	 // 0x1017
-  501,	 // 0x01f5
- 7939,	 // 0x1f03
-60967,	 // 0xee27
-60924,	 // 0xedfc
- 3080,	 // 0x0c08
- 3083,	 // 0x0c0b
-62486,	 // 0xf416
-60403,	 // 0xebf3
-25606,	 // 0x6406
-63980,	 // 0xf9ec
-64241,	 // 0xfaf1
-64517,	 // 0xfc05
- 9714,	 // 0x25f2
-61665,	 // 0xf0e1
- 4363,	 // 0x110b
-  761,	 // 0x02f9
-  771,	 // 0x0303
- 4845,	 // 0x12ed
-59401,	 // 0xe809
-33253,	 // 0x81e5
- 5377,	 // 0x1501
-13074,	 // 0x3312
-61709,	 // 0xf10d
- 3584,	 // 0x0e00
- 1266,	 // 0x04f2
-64256,	 // 0xfb00
-63458,	 // 0xf7e2
-64499,	 // 0xfbf3
-58113,	 // 0xe301
- 3332,	 // 0x0d04
- 1538,	 // 0x0602
-61193,	 // 0xef09
- 1769,	 // 0x06e9
- 3042,	 // 0x0be2
-  507,	 // 0x01fb
-63481,	 // 0xf7f9
-61692,	 // 0xf0fc
-64507,	 // 0xfbfb
- 4126,	 // 0x101e
-62482,	 // 0xf412
-53506,	 // 0xd102
-61443,	 // 0xf003
-57322,	 // 0xdfea
-64781,	 // 0xfd0d
-60935,	 // 0xee07
-63711,	 // 0xf8df
-63248,	 // 0xf710
-63496,	 // 0xf808
- 8954,	 // 0x22fa
-  260,	 // 0x0104
-65262,	 // 0xfeee
-64255,	 // 0xfaff
-54793,	 // 0xd609
-  249,	 // 0x00f9
- 3086,	 // 0x0c0e
-64232,	 // 0xfae8
- 5893,	 // 0x1705
-63220,	 // 0xf6f4
-65520,	 // 0xfff0
- 6127,	 // 0x17ef
-61444,	 // 0xf004
-64518,	 // 0xfc06
- 4359,	 // 0x1107
-33256,	 // 0x81e8
- 8967,	 // 0x2307
-15343,	 // 0x3bef
-  259,	 // 0x0103
-  771,	 // 0x0303
-65027,	 // 0xfe03
-61194,	 // 0xef0a
- 1522,	 // 0x05f2
-  773,	 // 0x0305
- 3593,	 // 0x0e09
- 3584,	 // 0x0e00
- 1532,	 // 0x05fc
-62221,	 // 0xf30d
- 1287,	 // 0x0507
- 2566,	 // 0x0a06
- 1279,	 // 0x04ff
-63491,	 // 0xf803
- 2548,	 // 0x09f4
-  257,	 // 0x0101
-61938,	 // 0xf1f2
-64002,	 // 0xfa02
- 3073,	 // 0x0c01
-65027,	 // 0xfe03
-64264,	 // 0xfb08
-65035,	 // 0xfe0b
- 1788,	 // 0x06fc
-63496,	 // 0xf808
-64001,	 // 0xfa01
-62206,	 // 0xf2fe
- 1032,	 // 0x0408
-61952,	 // 0xf200
-64518,	 // 0xfc06
- 3326,	 // 0x0cfe
-33028,	 // 0x8104
-  267,	 // 0x010b
-63748,	 // 0xf904
- 1792,	 // 0x0700
-60931,	 // 0xee03
- 1031,	 // 0x0407
-62473,	 // 0xf409
-   16,	 // 0x0010
-64242,	 // 0xfaf2
-62980,	 // 0xf604
-  508,	 // 0x01fc
-58871,	 // 0xe5f7
-64246,	 // 0xfaf6
- 6920,	 // 0x1b08
-14528,	 // 0x38c0
-10300,	 // 0x283c
-57846,	 // 0xe1f6
-55339,	 // 0xd82b
-20558,	 // 0x504e
-24074,	 // 0x5e0a
- 1505,	 // 0x05e1
-19142,	 // 0x4ac6
- 1566,	 // 0x061e
-26359,	 // 0x66f7
-18179,	 // 0x4703
- 5038,	 // 0x13ae
- 6616,	 // 0x19d8
-62773,	 // 0xf535
- 8004,	 // 0x1f44
- 4578,	 // 0x11e2
- 8912,	 // 0x22d0
-55937,	 // 0xda81
- 8928,	 // 0x22e0
- 7172,	 // 0x1c04
-57271,	 // 0xdfb7
-62215,	 // 0xf307
-50971,	 // 0xc71b
- 5111,	 // 0x13f7
- 2399,	 // 0x095f
-51759,	 // 0xca2f
-60157,	 // 0xeafd
-36626,	 // 0x8f12
- 8701,	 // 0x21fd
-10965,	 // 0x2ad5
-13765,	 // 0x35c5
-64545,	 // 0xfc21
-62172,	 // 0xf2dc
- 3611,	 // 0x0e1b
-61104,	 // 0xeeb0
-54818,	 // 0xd622
- 8941,	 // 0x22ed
-63188,	 // 0xf6d4
-58880,	 // 0xe600
-59864,	 // 0xe9d8
- 6325,	 // 0x18b5
-45725,	 // 0xb29d
- 5020,	 // 0x139c
-11187,	 // 0x2bb3
- 2812,	 // 0x0afc
-10976,	 // 0x2ae0
-64288,	 // 0xfb20
-57836,	 // 0xe1ec
-13012,	 // 0x32d4
-42526,	 // 0xa61e
-65097,	 // 0xfe49
-16383,	 // 0x3fff
-36397,	 // 0x8e2d
-10552,	 // 0x2938
-30410,	 // 0x76ca
-58586,	 // 0xe4da
- 7586,	 // 0x1da2
-23288,	 // 0x5af8
-60419,	 // 0xec03
-13394,	 // 0x3452
-11758,	 // 0x2dee
-61777,	 // 0xf151
-33054,	 // 0x811e
- 4580,	 // 0x11e4
-  165,	 // 0x00a5
-17664,	 // 0x4500
-55025,	 // 0xd6f1
-60473,	 // 0xec39
- 6462,	 // 0x193e
-61171,	 // 0xeef3
-26900,	 // 0x6914
-13852,	 // 0x361c
- 8148,	 // 0x1fd4
-56115,	 // 0xdb33
-60647,	 // 0xece7
-48552,	 // 0xbda8
-51203,	 // 0xc803
- 1563,	 // 0x061b
-13024,	 // 0x32e0
-  593,	 // 0x0251
-56333,	 // 0xdc0d
- 3857,	 // 0x0f11
- 2276,	 // 0x08e4
-30673,	 // 0x77d1
-14618,	 // 0x391a
-49347,	 // 0xc0c3
-41744,	 // 0xa310
- 1001,	 // 0x03e9
- 2839,	 // 0x0b17
-50971,	 // 0xc71b
- 7178,	 // 0x1c0a
- 2850,	 // 0x0b22
-18972,	 // 0x4a1c
-57833,	 // 0xe1e9
-56038,	 // 0xdae6
- 2806,	 // 0x0af6
- 4558,	 // 0x11ce
- 6910,	 // 0x1afe
- 3835,	 // 0x0efb
- 1021,	 // 0x03fd
- 1491,	 // 0x05d3
-46382,	 // 0xb52e
- 1267,	 // 0x04f3
-65488,	 // 0xffd0
-52968,	 // 0xcee8
- 1298,	 // 0x0512
-59913,	 // 0xea09
-15356,	 // 0x3bfc
-  800,	 // 0x0320
-57865,	 // 0xe209
-58586,	 // 0xe4da
-55091,	 // 0xd733
- 2310,	 // 0x0906
-62936,	 // 0xf5d8
-56848,	 // 0xde10
-12066,	 // 0x2f22
- 7968,	 // 0x1f20
- 4920,	 // 0x1338
-32747,	 // 0x7feb
- 2537,	 // 0x09e9
-57087,	 // 0xdeff
-  221,	 // 0x00dd
-48665,	 // 0xbe19
- 4598,	 // 0x11f6
-16423,	 // 0x4027
- 8919,	 // 0x22d7
- 1250,	 // 0x04e2
-57352,	 // 0xe008
-62460,	 // 0xf3fc
-52712,	 // 0xcde8
- 9776,	 // 0x2630
-65025,	 // 0xfe01
-62977,	 // 0xf601
- 6900,	 // 0x1af4
-64495,	 // 0xfbef
- 1793,	 // 0x0701
-61441,	 // 0xf001
- 2292,	 // 0x08f4
-62719,	 // 0xf4ff
- 4338,	 // 0x10f2
-60928,	 // 0xee00
- 3618,	 // 0x0e22
- 1302,	 // 0x0516
-64009,	 // 0xfa09
-63741,	 // 0xf8fd
-64517,	 // 0xfc05
- 2796,	 // 0x0aec
- 3060,	 // 0x0bf4
-62474,	 // 0xf40a
-65283,	 // 0xff03
-57618,	 // 0xe112
- 4080,	 // 0x0ff0
-65262,	 // 0xfeee
- 1538,	 // 0x0602
- 7149,	 // 0x1bed
-55813,	 // 0xda05
- 8992,	 // 0x2320
-62978,	 // 0xf602
-62978,	 // 0xf602
- 3329,	 // 0x0d01
- 3583,	 // 0x0dff
- 2811,	 // 0x0afb
-32521,	 // 0x7f09
-  761,	 // 0x02f9
-63735,	 // 0xf8f7
-64517,	 // 0xfc05
-59119,	 // 0xe6ef
-64007,	 // 0xfa07
-60918,	 // 0xedf6
-64510,	 // 0xfbfe
-65036,	 // 0xfe0c
- 1790,	 // 0x06fe
- 8429,	 // 0x20ed
-17670,	 // 0x4506
- 1777,	 // 0x06f1
- 2060,	 // 0x080c
-64523,	 // 0xfc0b
-64517,	 // 0xfc05
-  772,	 // 0x0304
-63737,	 // 0xf8f9
- 5116,	 // 0x13fc
-  247,	 // 0x00f7
-60423,	 // 0xec07
- 2555,	 // 0x09fb
- 3839,	 // 0x0eff
-62971,	 // 0xf5fb
-64251,	 // 0xfafb
- 3081,	 // 0x0c09
- 5885,	 // 0x16fd
-61952,	 // 0xf200
- 1037,	 // 0x040d
-65023,	 // 0xfdff
-65293,	 // 0xff0d
- 1272,	 // 0x04f8
- 2807,	 // 0x0af7
-  266,	 // 0x010a
-65025,	 // 0xfe01
- 2821,	 // 0x0b05
- 2287,	 // 0x08ef
-63226,	 // 0xf6fa
-63994,	 // 0xf9fa
-64750,	 // 0xfcee
-64000,	 // 0xfa00
-  506,	 // 0x01fa
-  761,	 // 0x02f9
-64758,	 // 0xfcf6
-32761,	 // 0x7ff9
-64004,	 // 0xfa04
-  505,	 // 0x01f9
-63225,	 // 0xf6f9
-63232,	 // 0xf700
-63245,	 // 0xf70d
-  513,	 // 0x0201
- 2306,	 // 0x0902
-  518,	 // 0x0206
- 1541,	 // 0x0605
-62970,	 // 0xf5fa
-61961,	 // 0xf209
- 1013,	 // 0x03f5
- 6910,	 // 0x1afe
- 2573,	 // 0x0a0d
-59393,	 // 0xe801
- 2828,	 // 0x0b0c
-64262,	 // 0xfb06
- 5622,	 // 0x15f6
- 4339,	 // 0x10f3
-65532,	 // 0xfffc
- 5364,	 // 0x14f4
- 4326,	 // 0x10e6
- 4637,	 // 0x121d
- 1270,	 // 0x04f6
-60683,	 // 0xed0b
- 2568,	 // 0x0a08
-62990,	 // 0xf60e
- 1794,	 // 0x0702
-62736,	 // 0xf510
-62211,	 // 0xf303
-60166,	 // 0xeb06
-62723,	 // 0xf503
-65525,	 // 0xfff5
-63487,	 // 0xf7ff
-61458,	 // 0xf012
-65287,	 // 0xff07
-63234,	 // 0xf702
- 1797,	 // 0x0705
-62720,	 // 0xf500
-  770,	 // 0x0302
-64008,	 // 0xfa08
-64012,	 // 0xfa0c
- 2576,	 // 0x0a10
-32756,	 // 0x7ff4
-  245,	 // 0x00f5
- 3805,	 // 0x0edd
- 4351,	 // 0x10ff
-61958,	 // 0xf206
-63214,	 // 0xf6ee
-64012,	 // 0xfa0c
-63469,	 // 0xf7ed
- 1287,	 // 0x0507
-  244,	 // 0x00f4
-61956,	 // 0xf204
-58635,	 // 0xe50b
- 4843,	 // 0x12eb
-13546,	 // 0x34ea
- 2301,	 // 0x08fd
- 1028,	 // 0x0404
- 1262,	 // 0x04ee
-60931,	 // 0xee03
-58638,	 // 0xe50e
-62203,	 // 0xf2fb
- 6146,	 // 0x1802
-63996,	 // 0xf9fc
-11795,	 // 0x2e13
-57622,	 // 0xe116
- 3850,	 // 0x0f0a
-59609,	 // 0xe8d9
- 2576,	 // 0x0a10
-60634,	 // 0xecda
-64997,	 // 0xfde5
- 2597,	 // 0x0a25
-58559,	 // 0xe4bf
-64793,	 // 0xfd19
-60133,	 // 0xeae5
-60168,	 // 0xeb08
-61956,	 // 0xf204
- 6657,	 // 0x1a01
-  256,	 // 0x0100
-57116,	 // 0xdf1c
- 3066,	 // 0x0bfa
-60406,	 // 0xebf6
-16163,	 // 0x3f23
-  505,	 // 0x01f9
- 3063,	 // 0x0bf7
- 2042,	 // 0x07fa
-33274,	 // 0x81fa
-59885,	 // 0xe9ed
- 6379,	 // 0x18eb
- 1805,	 // 0x070d
- 4606,	 // 0x11fe
-65031,	 // 0xfe07
-60946,	 // 0xee12
-62978,	 // 0xf602
-64767,	 // 0xfcff
-10487,	 // 0x28f7
- 1524,	 // 0x05f4
-44834,	 // 0xaf22
-65260,	 // 0xfeec
- 2550,	 // 0x09f6
-65277,	 // 0xfefd
-  511,	 // 0x01ff
-64767,	 // 0xfcff
-  253,	 // 0x00fd
-65279,	 // 0xfeff
-  513,	 // 0x0201
-65282,	 // 0xff02
- 2043,	 // 0x07fb
-65286,	 // 0xff06
-65281,	 // 0xff01
- 1277,	 // 0x04fd
-65533,	 // 0xfffd
-65024,	 // 0xfe00
-65278,	 // 0xfefe
-64518,	 // 0xfc06
- 1023,	 // 0x03ff
-63744,	 // 0xf900
-  509,	 // 0x01fd
-63745,	 // 0xf901
-  506,	 // 0x01fa
-65274,	 // 0xfefa
-  511,	 // 0x01ff
- 1019,	 // 0x03fb
-65275,	 // 0xfefb
- 1271,	 // 0x04f7
-    4,	 // 0x0004
-65279,	 // 0xfeff
-  762,	 // 0x02fa
-  255,	 // 0x00ff
-  517,	 // 0x0205
-32767,	 // 0x7fff
-63999,	 // 0xf9ff
- 1532,	 // 0x05fc
-  514,	 // 0x0202
-65278,	 // 0xfefe
-65534,	 // 0xfffe
-65278,	 // 0xfefe
- 1023,	 // 0x03ff
-    0,	 // 0x0000
-  766,	 // 0x02fe
-65287,	 // 0xff07
-63226,	 // 0xf6fa
-  256,	 // 0x0100
-  509,	 // 0x01fd
-63776,	 // 0xf920
-63480,	 // 0xf7f8
- 4626,	 // 0x1212
- 1014,	 // 0x03f6
- 3850,	 // 0x0f0a
-65527,	 // 0xfff7
-60171,	 // 0xeb0b
- 6121,	 // 0x17e9
-61177,	 // 0xeef9
-  759,	 // 0x02f7
-  235,	 // 0x00eb
- 4349,	 // 0x10fd
- 2310,	 // 0x0906
- 6408,	 // 0x1908
- 5104,	 // 0x13f0
-64501,	 // 0xfbf5
- 1320,	 // 0x0528
-65267,	 // 0xfef3
- 6370,	 // 0x18e2
-61943,	 // 0xf1f7
-  993,	 // 0x03e1
- 1039,	 // 0x040f
-62933,	 // 0xf5d5
- 3058,	 // 0x0bf2
-64511,	 // 0xfbff
- 2808,	 // 0x0af8
- 1762,	 // 0x06e2
-  993,	 // 0x03e1
-63235,	 // 0xf703
- 8725,	 // 0x2215
-32746,	 // 0x7fea
- 1793,	 // 0x0701
-59131,	 // 0xe6fb
- 1537,	 // 0x0601
-61680,	 // 0xf0f0
-60924,	 // 0xedfc
- 4369,	 // 0x1111
- 4587,	 // 0x11eb
- 6641,	 // 0x19f1
- 3345,	 // 0x0d11
-62962,	 // 0xf5f2
-14595,	 // 0x3903
-63781,	 // 0xf925
-13070,	 // 0x330e
- 2022,	 // 0x07e6
-64813,	 // 0xfd2d
-60150,	 // 0xeaf6
-  756,	 // 0x02f4
-51992,	 // 0xcb18
-55800,	 // 0xd9f8
-62666,	 // 0xf4ca
- 6145,	 // 0x1801
-57852,	 // 0xe1fc
- 9764,	 // 0x2624
-53258,	 // 0xd00a
-55792,	 // 0xd9f0
-57064,	 // 0xdee8
-61177,	 // 0xeef9
- 8414,	 // 0x20de
-57626,	 // 0xe11a
-64524,	 // 0xfc0c
-  786,	 // 0x0312
-60928,	 // 0xee00
-62197,	 // 0xf2f5
-46391,	 // 0xb537
-65016,	 // 0xfdf8
-65288,	 // 0xff08
-64477,	 // 0xfbdd
-65026,	 // 0xfe02
-60959,	 // 0xee1f
-60396,	 // 0xebec
- 6167,	 // 0x1817
-64023,	 // 0xfa17
- 4106,	 // 0x100a
-31706,	 // 0x7bda
-62977,	 // 0xf601
- 8460,	 // 0x210c
- 7938,	 // 0x1f02
-13800,	 // 0x35e8
- 1807,	 // 0x070f
- 6372,	 // 0x18e4
- 8968,	 // 0x2308
- 8673,	 // 0x21e1
-64765,	 // 0xfcfd
-58131,	 // 0xe313
- 8203,	 // 0x200b
-57337,	 // 0xdff9
-32725,	 // 0x7fd5
-  204,	 // 0x00cc
-15859,	 // 0x3df3
- 1528,	 // 0x05f8
- 4837,	 // 0x12e5
-  561,	 // 0x0231
- 5281,	 // 0x14a1
-63219,	 // 0xf6f3
- 5346,	 // 0x14e2
- 8163,	 // 0x1fe3
-17858,	 // 0x45c2
- 4855,	 // 0x12f7
- 2349,	 // 0x092d
-10506,	 // 0x290a
-11292,	 // 0x2c1c
-62616,	 // 0xf498
-60435,	 // 0xec13
-64553,	 // 0xfc29
-59977,	 // 0xea49
- 5305,	 // 0x14b9
- 9254,	 // 0x2426
-61364,	 // 0xefb4
-  258,	 // 0x0102
-59625,	 // 0xe8e9
-65116,	 // 0xfe5c
- 7706,	 // 0x1e1a
-56579,	 // 0xdd03
-56076,	 // 0xdb0c
-59866,	 // 0xe9da
- 5087,	 // 0x13df
- 6693,	 // 0x1a25
-61887,	 // 0xf1bf
- 7689,	 // 0x1e09
-11044,	 // 0x2b24
-55289,	 // 0xd7f9
-50916,	 // 0xc6e4
-60110,	 // 0xeace
-  495,	 // 0x01ef
- 9218,	 // 0x2402
- 4344,	 // 0x10f8
-15369,	 // 0x3c09
-64506,	 // 0xfbfa
-12051,	 // 0x2f13
- 2756,	 // 0x0ac4
-32729,	 // 0x7fd9
-10215,	 // 0x27e7
- 2026,	 // 0x07ea
-60972,	 // 0xee2c
-52498,	 // 0xcd12
- 6385,	 // 0x18f1
-51704,	 // 0xc9f8
-62202,	 // 0xf2fa
-10233,	 // 0x27f9
-58839,	 // 0xe5d7
-  262,	 // 0x0106
-58895,	 // 0xe60f
- 8722,	 // 0x2212
-65510,	 // 0xffe6
- 2041,	 // 0x07f9
-55054,	 // 0xd70e
- 4124,	 // 0x101c
- 5906,	 // 0x1712
- 3039,	 // 0x0bdf
-  489,	 // 0x01e9
-  529,	 // 0x0211
-62485,	 // 0xf415
-59699,	 // 0xe933
-58352,	 // 0xe3f0
-64537,	 // 0xfc19
- 6435,	 // 0x1923
-57115,	 // 0xdf1b
-58377,	 // 0xe409
- 2356,	 // 0x0934
-63735,	 // 0xf8f7
- 2275,	 // 0x08e3
-33277,	 // 0x81fd
- 7422,	 // 0x1cfe
-  812,	 // 0x032c
- 2814,	 // 0x0afe
-58102,	 // 0xe2f6
- 6375,	 // 0x18e7
- 2801,	 // 0x0af1
-60423,	 // 0xec07
- 4113,	 // 0x1011
- 2833,	 // 0x0b11
-64523,	 // 0xfc0b
-55595,	 // 0xd92b
- 6378,	 // 0x18ea
-15111,	 // 0x3b07
-63215,	 // 0xf6ef
- 7459,	 // 0x1d23
-57357,	 // 0xe00d
-60666,	 // 0xecfa
-11732,	 // 0x2dd4
- 4068,	 // 0x0fe4
-50178,	 // 0xc402
-62241,	 // 0xf321
-58648,	 // 0xe518
-50374,	 // 0xc4c6
-59110,	 // 0xe6e6
-61186,	 // 0xef02
- 7894,	 // 0x1ed6
-48373,	 // 0xbcf5
- 3640,	 // 0x0e38
-60130,	 // 0xeae2
- 4555,	 // 0x11cb
-60801,	 // 0xed81
- 5911,	 // 0x1717
-56345,	 // 0xdc19
-14631,	 // 0x3927
-63000,	 // 0xf618
-52716,	 // 0xcdec
-65280,	 // 0xff00
-60650,	 // 0xecea
- 8458,	 // 0x210a
-14826,	 // 0x39ea
-62245,	 // 0xf325
-65497,	 // 0xffd9
-53746,	 // 0xd1f2
-56551,	 // 0xdce7
-64055,	 // 0xfa37
-58340,	 // 0xe3e4
-23031,	 // 0x59f7
-  687,	 // 0x02af
-56062,	 // 0xdafe
-57820,	 // 0xe1dc
-63172,	 // 0xf6c4
-  742,	 // 0x02e6
-48884,	 // 0xbef4
-57098,	 // 0xdf0a
-49136,	 // 0xbff0
-55295,	 // 0xd7ff
- 5109,	 // 0x13f5
-62481,	 // 0xf411
- 1798,	 // 0x0706
-64231,	 // 0xfae7
- 3079,	 // 0x0c07
- 5855,	 // 0x16df
- 3848,	 // 0x0f08
- 2066,	 // 0x0812
- 6926,	 // 0x1b0e
-  988,	 // 0x03dc
- 3088,	 // 0x0c10
-60434,	 // 0xec12
- 3596,	 // 0x0e0c
-61701,	 // 0xf105
-  999,	 // 0x03e7
-61400,	 // 0xefd8
- 6920,	 // 0x1b08
-61961,	 // 0xf209
- 3844,	 // 0x0f04
-62992,	 // 0xf610
-62732,	 // 0xf50c
-  289,	 // 0x0121
- 1268,	 // 0x04f4
- 2821,	 // 0x0b05
-    4,	 // 0x0004
- 3855,	 // 0x0f0f
-61940,	 // 0xf1f4
-65029,	 // 0xfe05
- 7669,	 // 0x1df5
-65004,	 // 0xfdec
- 3857,	 // 0x0f11
-32752,	 // 0x7ff0
- 4901,	 // 0x1325
-62702,	 // 0xf4ee
- 4346,	 // 0x10fa
- 2802,	 // 0x0af2
-  744,	 // 0x02e8
-62469,	 // 0xf405
-62723,	 // 0xf503
- 1524,	 // 0x05f4
- 4841,	 // 0x12e9
- 3089,	 // 0x0c11
- 9486,	 // 0x250e
- 3588,	 // 0x0e04
- 4368,	 // 0x1110
-12820,	 // 0x3214
-64216,	 // 0xfad8
-63248,	 // 0xf710
-56310,	 // 0xdbf6
- 3301,	 // 0x0ce5
-64782,	 // 0xfd0e
- 9494,	 // 0x2516
-58626,	 // 0xe502
-63504,	 // 0xf810
-59142,	 // 0xe706
- 2044,	 // 0x07fc
-19220,	 // 0x4b14
- 6913,	 // 0x1b01
-57357,	 // 0xe00d
- 7431,	 // 0x1d07
-56064,	 // 0xdb00
-60947,	 // 0xee13
- 3601,	 // 0x0e11
- 3833,	 // 0x0ef9
-64493,	 // 0xfbed
-  276,	 // 0x0114
- 5358,	 // 0x14ee
-59926,	 // 0xea16
- 3579,	 // 0x0dfb
-57310,	 // 0xdfde
-   12,	 // 0x000c
- 2529,	 // 0x09e1
- 1810,	 // 0x0712
-64500,	 // 0xfbf4
-62981,	 // 0xf605
-33264,	 // 0x81f0
-60932,	 // 0xee04
-55057,	 // 0xd711
-  743,	 // 0x02e7
-58618,	 // 0xe4fa
-11250,	 // 0x2bf2
- 1282,	 // 0x0502
-60654,	 // 0xecee
-  534,	 // 0x0216
-64526,	 // 0xfc0e
-60899,	 // 0xede3
- 2801,	 // 0x0af1
- 9740,	 // 0x260c
-16123,	 // 0x3efb
- 4887,	 // 0x1317
- 7908,	 // 0x1ee4
- 3323,	 // 0x0cfb
-56844,	 // 0xde0c
- 4300,	 // 0x10cc
- 4389,	 // 0x1125
-54830,	 // 0xd62e
-51977,	 // 0xcb09
-58158,	 // 0xe32e
- 1571,	 // 0x0623
-11271,	 // 0x2c07
- 5133,	 // 0x140d
-12310,	 // 0x3016
- 5135,	 // 0x140f
-54655,	 // 0xd57f
-12850,	 // 0x3232
-42985,	 // 0xa7e9
-   12,	 // 0x000c
-55014,	 // 0xd6e6
- 4855,	 // 0x12f7
-61912,	 // 0xf1d8
-11754,	 // 0x2dea
-  242,	 // 0x00f2
-56246,	 // 0xdbb6
-16911,	 // 0x420f
-59724,	 // 0xe94c
- 6422,	 // 0x1916
-58044,	 // 0xe2bc
-56314,	 // 0xdbfa
-24601,	 // 0x6019
- 5876,	 // 0x16f4
-55522,	 // 0xd8e2
-62771,	 // 0xf533
-63750,	 // 0xf906
-57636,	 // 0xe124
- 5652,	 // 0x1614
- 2363,	 // 0x093b
- 3864,	 // 0x0f18
-58104,	 // 0xe2f8
-63921,	 // 0xf9b1
-58408,	 // 0xe428
-20425,	 // 0x4fc9
- 7067,	 // 0x1b9b
-22700,	 // 0x58ac
- 1792,	 // 0x0700
- 5126,	 // 0x1406
- 3569,	 // 0x0df1
-64014,	 // 0xfa0e
- 3556,	 // 0x0de4
-63502,	 // 0xf80e
-55038,	 // 0xd6fe
-62960,	 // 0xf5f0
-65321,	 // 0xff29
- 1292,	 // 0x050c
-60916,	 // 0xedf4
-64503,	 // 0xfbf7
- 2538,	 // 0x09ea
-64542,	 // 0xfc1e
- 2575,	 // 0x0a0f
-63740,	 // 0xf8fc
-  239,	 // 0x00ef
- 4382,	 // 0x111e
- 1286,	 // 0x0506
- 5382,	 // 0x1506
-62970,	 // 0xf5fa
- 3316,	 // 0x0cf4
-63464,	 // 0xf7e8
- 1532,	 // 0x05fc
-65006,	 // 0xfdee
-64254,	 // 0xfafe
-65534,	 // 0xfffe
-61442,	 // 0xf002
- 1036,	 // 0x040c
-61164,	 // 0xeeec
-33255,	 // 0x81e7
- 5124,	 // 0x1404
- 6915,	 // 0x1b03
- 1754,	 // 0x06da
- 4353,	 // 0x1101
-64294,	 // 0xfb26
-63739,	 // 0xf8fb
- 9170,	 // 0x23d2
- 1802,	 // 0x070a
- 4918,	 // 0x1336
-56343,	 // 0xdc17
-15121,	 // 0x3b11
- 2558,	 // 0x09fe
- 1252,	 // 0x04e4
-52671,	 // 0xcdbf
-32014,	 // 0x7d0e
-11438,	 // 0x2cae
-57358,	 // 0xe00e
- 1043,	 // 0x0413
-10768,	 // 0x2a10
-61908,	 // 0xf1d4
-56108,	 // 0xdb2c
- 8918,	 // 0x22d6
-62916,	 // 0xf5c4
-55567,	 // 0xd90f
-  739,	 // 0x02e3
-58885,	 // 0xe605
- 6905,	 // 0x1af9
-40766,	 // 0x9f3e
-  672,	 // 0x02a0
-53242,	 // 0xcffa
-11903,	 // 0x2e7f
-62750,	 // 0xf51e
-58914,	 // 0xe622
- 4555,	 // 0x11cb
- 4573,	 // 0x11dd
-64239,	 // 0xfaef
-62479,	 // 0xf40f
-10702,	 // 0x29ce
- 4845,	 // 0x12ed
-12850,	 // 0x3232
- 5382,	 // 0x1506
-64731,	 // 0xfcdb
-56963,	 // 0xde83
-20710,	 // 0x50e6
- 2473,	 // 0x09a9
-19449,	 // 0x4bf9
-13035,	 // 0x32eb
-  228,	 // 0x00e4
-59155,	 // 0xe713
-16885,	 // 0x41f5
-19711,	 // 0x4cff
- 3782,	 // 0x0ec6
-63261,	 // 0xf71d
-58085,	 // 0xe2e5
- 9806,	 // 0x264e
-22286,	 // 0x570e
-24569,	 // 0x5ff9
- 3281,	 // 0x0cd1
-13813,	 // 0x35f5
-  785,	 // 0x0311
-62719,	 // 0xf4ff
-  710,	 // 0x02c6
-65042,	 // 0xfe12
-65023,	 // 0xfdff
-58625,	 // 0xe501
-65522,	 // 0xfff2
-59387,	 // 0xe7fb
-54541,	 // 0xd50d
-55047,	 // 0xd707
- 3092,	 // 0x0c14
- 1802,	 // 0x070a
-  222,	 // 0x00de
- 7427,	 // 0x1d03
-60411,	 // 0xebfb
-59917,	 // 0xea0d
- 7405,	 // 0x1ced
-60686,	 // 0xed0e
-64017,	 // 0xfa11
- 2544,	 // 0x09f0
-54278,	 // 0xd406
-62199,	 // 0xf2f7
-55300,	 // 0xd804
-63439,	 // 0xf7cf
-61196,	 // 0xef0c
- 6403,	 // 0x1903
- 3544,	 // 0x0dd8
-61706,	 // 0xf10a
-56351,	 // 0xdc1f
-10555,	 // 0x293b
-55824,	 // 0xda10
-45021,	 // 0xafdd
- 2614,	 // 0x0a36
- 5877,	 // 0x16f5
-64502,	 // 0xfbf6
- 5901,	 // 0x170d
-65530,	 // 0xfffa
- 5932,	 // 0x172c
-57877,	 // 0xe215
-32576,	 // 0x7f40
- 1327,	 // 0x052f
-61151,	 // 0xeedf
- 2286,	 // 0x08ee
-63497,	 // 0xf809
-65527,	 // 0xfff7
-61184,	 // 0xef00
-62979,	 // 0xf603
- 2307,	 // 0x0903
- 4071,	 // 0x0fe7
-59632,	 // 0xe8f0
- 4378,	 // 0x111a
-57850,	 // 0xe1fa
-64274,	 // 0xfb12
- 1276,	 // 0x04fc
-58630,	 // 0xe506
-59919,	 // 0xea0f
- 2800,	 // 0x0af0
-61423,	 // 0xefef
- 1500,	 // 0x05dc
- 5388,	 // 0x150c
-64763,	 // 0xfcfb
-63509,	 // 0xf815
- 1546,	 // 0x060a
-63736,	 // 0xf8f8
- 7951,	 // 0x1f0f
-  498,	 // 0x01f2
-62439,	 // 0xf3e7
- 2818,	 // 0x0b02
-57600,	 // 0xe100
-65024,	 // 0xfe00
-65517,	 // 0xffed
-61187,	 // 0xef03
-33263,	 // 0x81ef
- 1782,	 // 0x06f6
-60674,	 // 0xed02
-  238,	 // 0x00ee
- 5118,	 // 0x13fe
- 2049,	 // 0x0801
- 2551,	 // 0x09f7
-59629,	 // 0xe8ed
-  512,	 // 0x0200
-   13,	 // 0x000d
- 1294,	 // 0x050e
-55064,	 // 0xd718
- 3346,	 // 0x0d12
- 6915,	 // 0x1b03
- 4595,	 // 0x11f3
- 7448,	 // 0x1d18
- 2555,	 // 0x09fb
-  252,	 // 0x00fc
- 4094,	 // 0x0ffe
-65284,	 // 0xff04
-  525,	 // 0x020d
- 4105,	 // 0x1009
-  251,	 // 0x00fb
- 1780,	 // 0x06f4
-65532,	 // 0xfffc
-63479,	 // 0xf7f7
- 2047,	 // 0x07ff
- 2308,	 // 0x0904
- 2558,	 // 0x09fe
-65287,	 // 0xff07
-59164,	 // 0xe71c
-63986,	 // 0xf9f2
-63226,	 // 0xf6fa
-61689,	 // 0xf0f9
-64267,	 // 0xfb0b
-61972,	 // 0xf214
-60441,	 // 0xec19
- 3593,	 // 0x0e09
- 4350,	 // 0x10fe
- 5106,	 // 0x13f2
-64002,	 // 0xfa02
-62209,	 // 0xf301
- 1295,	 // 0x050f
- 2313,	 // 0x0909
- 7439,	 // 0x1d0f
- 2044,	 // 0x07fc
- 6127,	 // 0x17ef
- 3579,	 // 0x0dfb
-61437,	 // 0xeffd
-  770,	 // 0x0302
-62714,	 // 0xf4fa
-62208,	 // 0xf300
-61926,	 // 0xf1e6
-63494,	 // 0xf806
-64507,	 // 0xfbfb
-32761,	 // 0x7ff9
-62473,	 // 0xf409
-62438,	 // 0xf3e6
-62223,	 // 0xf30f
-56588,	 // 0xdd0c
- 2316,	 // 0x090c
-62422,	 // 0xf3d6
- 6141,	 // 0x17fd
-63479,	 // 0xf7f7
-58632,	 // 0xe508
-62492,	 // 0xf41c
-54542,	 // 0xd50e
-60436,	 // 0xec14
-57092,	 // 0xdf04
- 4585,	 // 0x11e9
-15625,	 // 0x3d09
-61424,	 // 0xeff0
-58097,	 // 0xe2f1
- 7428,	 // 0x1d04
-  545,	 // 0x0221
-61950,	 // 0xf1fe
-63507,	 // 0xf813
-58142,	 // 0xe31e
- 6906,	 // 0x1afa
-63287,	 // 0xf737
-13872,	 // 0x3630
-52428,	 // 0xcccc
- 2063,	 // 0x080f
-60408,	 // 0xebf8
-56552,	 // 0xdce8
-65023,	 // 0xfdff
-  528,	 // 0x0210
-  768,	 // 0x0300
-32554,	 // 0x7f2a
- 4104,	 // 0x1008
-10748,	 // 0x29fc
-62992,	 // 0xf610
- 3320,	 // 0x0cf8
-56599,	 // 0xdd17
-62942,	 // 0xf5de
-60146,	 // 0xeaf2
-61957,	 // 0xf205
- 1287,	 // 0x0507
-61426,	 // 0xeff2
- 8669,	 // 0x21dd
-56597,	 // 0xdd15
- 3872,	 // 0x0f20
-64010,	 // 0xfa0a
-61432,	 // 0xeff8
-64252,	 // 0xfafc
-64002,	 // 0xfa02
- 2042,	 // 0x07fa
-60412,	 // 0xebfc
-62210,	 // 0xf302
- 1270,	 // 0x04f6
- 1009,	 // 0x03f1
- 3088,	 // 0x0c10
- 1800,	 // 0x0708
- 2050,	 // 0x0802
- 1538,	 // 0x0602
- 2310,	 // 0x0906
-62206,	 // 0xf2fe
-  258,	 // 0x0102
-62721,	 // 0xf501
-65311,	 // 0xff1f
- 3058,	 // 0x0bf2
- 1785,	 // 0x06f9
-59124,	 // 0xe6f4
- 5626,	 // 0x15fa
- 8649,	 // 0x21c9
-63229,	 // 0xf6fd
-  763,	 // 0x02fb
-61427,	 // 0xeff3
-62212,	 // 0xf304
-65019,	 // 0xfdfb
- 1539,	 // 0x0603
- 2824,	 // 0x0b08
-33265,	 // 0x81f1
- 3830,	 // 0x0ef6
-61466,	 // 0xf01a
-56834,	 // 0xde02
- 1045,	 // 0x0415
- 1287,	 // 0x0507
- 4361,	 // 0x1109
- 5389,	 // 0x150d
-61960,	 // 0xf208
- 2571,	 // 0x0a0b
- 3066,	 // 0x0bfa
-65287,	 // 0xff07
-  500,	 // 0x01f4
- 5891,	 // 0x1703
-59263,	 // 0xe77f
-12491,	 // 0x30cb
- 8224,	 // 0x2020
-24793,	 // 0x60d9
-54250,	 // 0xd3ea
- 7931,	 // 0x1efb
-53493,	 // 0xd0f5
-63958,	 // 0xf9d6
- 5021,	 // 0x139d
- 6195,	 // 0x1833
- 6623,	 // 0x19df
-11022,	 // 0x2b0e
-61462,	 // 0xf016
-12318,	 // 0x301e
- 1730,	 // 0x06c2
-61193,	 // 0xef09
-12791,	 // 0x31f7
- 3174,	 // 0x0c66
-42983,	 // 0xa7e7
- 7217,	 // 0x1c31
-50934,	 // 0xc6f6
-51383,	 // 0xc8b7
-56056,	 // 0xdaf8
-54309,	 // 0xd425
- 9724,	 // 0x25fc
-  440,	 // 0x01b8
-61943,	 // 0xf1f7
-62116,	 // 0xf2a4
-  988,	 // 0x03dc
-61676,	 // 0xf0ec
-18206,	 // 0x471e
-55841,	 // 0xda21
-52467,	 // 0xccf3
-58403,	 // 0xe423
-12919,	 // 0x3277
- 9967,	 // 0x26ef
-51214,	 // 0xc80e
- 9256,	 // 0x2428
-63482,	 // 0xf7fa
-64075,	 // 0xfa4b
-57024,	 // 0xdec0
-12291,	 // 0x3003
-10980,	 // 0x2ae4
-28183,	 // 0x6e17
- 3586,	 // 0x0e02
- 2058,	 // 0x080a
- 2315,	 // 0x090b
-62964,	 // 0xf5f4
- 3590,	 // 0x0e06
-64244,	 // 0xfaf4
-  762,	 // 0x02fa
- 3057,	 // 0x0bf1
-63477,	 // 0xf7f5
-59654,	 // 0xe906
-    3,	 // 0x0003
-63474,	 // 0xf7f2
-65018,	 // 0xfdfa
-  508,	 // 0x01fc
-   29,	 // 0x001d
- 2293,	 // 0x08f5
- 1017,	 // 0x03f9
-61712,	 // 0xf110
-62959,	 // 0xf5ef
-65009,	 // 0xfdf1
-  773,	 // 0x0305
-62201,	 // 0xf2f9
-60156,	 // 0xeafc
- 8171,	 // 0x1feb
- 1017,	 // 0x03f9
-65031,	 // 0xfe07
- 1541,	 // 0x0605
-64525,	 // 0xfc0d
-62466,	 // 0xf402
- 4377,	 // 0x1119
-32515,	 // 0x7f03
-  752,	 // 0x02f0
- 2303,	 // 0x08ff
-65296,	 // 0xff10
- 3826,	 // 0x0ef2
- 3071,	 // 0x0bff
- 1289,	 // 0x0509
-61954,	 // 0xf202
- 1285,	 // 0x0505
-60945,	 // 0xee11
-60413,	 // 0xebfd
-63219,	 // 0xf6f3
- 1300,	 // 0x0514
- 4100,	 // 0x1004
-62468,	 // 0xf404
-65030,	 // 0xfe06
-  759,	 // 0x02f7
- 2550,	 // 0x09f6
-57098,	 // 0xdf0a
-63235,	 // 0xf703
-64521,	 // 0xfc09
- 1540,	 // 0x0604
-63743,	 // 0xf8ff
-61962,	 // 0xf20a
-64762,	 // 0xfcfa
-  496,	 // 0x01f0
- 1795,	 // 0x0703
- 1533,	 // 0x05fd
-63241,	 // 0xf709
- 2808,	 // 0x0af8
- 1290,	 // 0x050a
-  781,	 // 0x030d
- 1795,	 // 0x0703
-63749,	 // 0xf905
-65031,	 // 0xfe07
- 4331,	 // 0x10eb
-61934,	 // 0xf1ee
-  260,	 // 0x0104
-62978,	 // 0xf602
-  256,	 // 0x0100
- 1524,	 // 0x05f4
- 1536,	 // 0x0600
-  503,	 // 0x01f7
-62980,	 // 0xf604
-32521,	 // 0x7f09
-  769,	 // 0x0301
-61728,	 // 0xf120
-62976,	 // 0xf600
- 1529,	 // 0x05f9
- 4599,	 // 0x11f7
- 4088,	 // 0x0ff8
- 1546,	 // 0x060a
-61937,	 // 0xf1f1
-64010,	 // 0xfa0a
-62724,	 // 0xf504
-10236,	 // 0x27fc
- 1554,	 // 0x0612
-64776,	 // 0xfd08
- 1269,	 // 0x04f5
- 3824,	 // 0x0ef0
-62979,	 // 0xf603
-  512,	 // 0x0200
- 3329,	 // 0x0d01
-  740,	 // 0x02e4
- 2804,	 // 0x0af4
- 2316,	 // 0x090c
-    6,	 // 0x0006
-63245,	 // 0xf70d
- 2567,	 // 0x0a07
- 2301,	 // 0x08fd
-65024,	 // 0xfe00
-  779,	 // 0x030b
-62434,	 // 0xf3e2
-58878,	 // 0xe5fe
-65036,	 // 0xfe0c
- 1828,	 // 0x0724
-62201,	 // 0xf2f9
-63235,	 // 0xf703
- 3326,	 // 0x0cfe
-62194,	 // 0xf2f2
- 2821,	 // 0x0b05
- 1280,	 // 0x0500
- 6389,	 // 0x18f5
- 1805,	 // 0x070d
-62213,	 // 0xf305
-  757,	 // 0x02f5
-  776,	 // 0x0308
- 2297,	 // 0x08f9
-32515,	 // 0x7f03
-63474,	 // 0xf7f2
-  507,	 // 0x01fb
-64246,	 // 0xfaf6
- 8207,	 // 0x200f
-61688,	 // 0xf0f8
- 1268,	 // 0x04f4
-61683,	 // 0xf0f3
-  532,	 // 0x0214
- 2310,	 // 0x0906
-  517,	 // 0x0205
- 9460,	 // 0x24f4
- 4864,	 // 0x1300
- 6920,	 // 0x1b08
-64265,	 // 0xfb09
-60663,	 // 0xecf7
-63525,	 // 0xf825
- 9473,	 // 0x2501
-51179,	 // 0xc7eb
- 6189,	 // 0x182d
-50953,	 // 0xc709
- 3056,	 // 0x0bf0
-58148,	 // 0xe324
-61974,	 // 0xf216
- 4860,	 // 0x12fc
-61906,	 // 0xf1d2
-63245,	 // 0xf70d
-63495,	 // 0xf807
-62257,	 // 0xf331
-61437,	 // 0xeffd
-11580,	 // 0x2d3c
-55525,	 // 0xd8e5
-14063,	 // 0x36ef
-63755,	 // 0xf90b
-54215,	 // 0xd3c7
-  789,	 // 0x0315
-64238,	 // 0xfaee
- 1296,	 // 0x0510
-54575,	 // 0xd52f
-65010,	 // 0xfdf2
-65509,	 // 0xffe5
- 3559,	 // 0x0de7
- 1511,	 // 0x05e7
-52194,	 // 0xcbe2
- 3836,	 // 0x0efc
- 8735,	 // 0x221f
-56594,	 // 0xdd12
-58626,	 // 0xe502
-  317,	 // 0x013d
-52750,	 // 0xce0e
-63226,	 // 0xf6fa
- 9421,	 // 0x24cd
-65318,	 // 0xff26
-61647,	 // 0xf0cf
- 3365,	 // 0x0d25
-32538,	 // 0x7f1a
-  494,	 // 0x01ee
- 1815,	 // 0x0717
- 6139,	 // 0x17fb
- 4578,	 // 0x11e2
- 2311,	 // 0x0907
- 2824,	 // 0x0b08
-62947,	 // 0xf5e3
- 5914,	 // 0x171a
-55057,	 // 0xd711
-  242,	 // 0x00f2
-61959,	 // 0xf207
- 8937,	 // 0x22e9
-62945,	 // 0xf5e1
- 1006,	 // 0x03ee
-55528,	 // 0xd8e8
-  246,	 // 0x00f6
-61957,	 // 0xf205
- 7671,	 // 0x1df7
-62444,	 // 0xf3ec
-  520,	 // 0x0208
-64769,	 // 0xfd01
-64225,	 // 0xfae1
-65033,	 // 0xfe09
- 3568,	 // 0x0df0
-64510,	 // 0xfbfe
-65295,	 // 0xff0f
- 1030,	 // 0x0406
- 2312,	 // 0x0908
- 4355,	 // 0x1103
-60910,	 // 0xedee
-64254,	 // 0xfafe
-62216,	 // 0xf308
-54273,	 // 0xd401
-63739,	 // 0xf8fb
-64262,	 // 0xfb06
-65534,	 // 0xfffe
- 2553,	 // 0x09f9
- 2526,	 // 0x09de
-58628,	 // 0xe504
-61189,	 // 0xef05
-62983,	 // 0xf607
-62736,	 // 0xf510
-64506,	 // 0xfbfa
-33256,	 // 0x81e8
-63757,	 // 0xf90d
-10992,	 // 0x2af0
- 1783,	 // 0x06f7
- 3595,	 // 0x0e0b
- 2553,	 // 0x09f9
- 5620,	 // 0x15f4
-60413,	 // 0xebfd
-58870,	 // 0xe5f6
- 2823,	 // 0x0b07
- 5111,	 // 0x13f7
- 2811,	 // 0x0afb
-57590,	 // 0xe0f6
-64002,	 // 0xfa02
-  792,	 // 0x0318
- 2559,	 // 0x09ff
- 4366,	 // 0x110e
-64229,	 // 0xfae5
-64020,	 // 0xfa14
- 3329,	 // 0x0d01
- 1263,	 // 0x04ef
- 5631,	 // 0x15ff
-59644,	 // 0xe8fc
- 1803,	 // 0x070b
-  249,	 // 0x00f9
-61959,	 // 0xf207
- 8203,	 // 0x200b
- 4091,	 // 0x0ffb
- 1301,	 // 0x0515
-56555,	 // 0xdceb
-62700,	 // 0xf4ec
-61424,	 // 0xeff0
- 4354,	 // 0x1102
-32523,	 // 0x7f0b
-64232,	 // 0xfae8
-64255,	 // 0xfaff
-64494,	 // 0xfbee
- 5394,	 // 0x1512
-58612,	 // 0xe4f4
- 5383,	 // 0x1507
-64540,	 // 0xfc1c
- 3833,	 // 0x0ef9
- 4898,	 // 0x1322
-64021,	 // 0xfa15
- 8445,	 // 0x20fd
- 3621,	 // 0x0e25
- 9716,	 // 0x25f4
-65033,	 // 0xfe09
- 2577,	 // 0x0a11
- 1320,	 // 0x0528
- 3335,	 // 0x0d07
- 9489,	 // 0x2511
-63454,	 // 0xf7de
- 2826,	 // 0x0b0a
-61202,	 // 0xef12
-62967,	 // 0xf5f7
-  799,	 // 0x031f
- 1284,	 // 0x0504
- 8203,	 // 0x200b
- 2317,	 // 0x090d
-60645,	 // 0xece5
-11275,	 // 0x2c0b
- 3579,	 // 0x0dfb
-63502,	 // 0xf80e
-64530,	 // 0xfc12
-62191,	 // 0xf2ef
-   21,	 // 0x0015
- 4329,	 // 0x10e9
-  248,	 // 0x00f8
-64508,	 // 0xfbfc
-62189,	 // 0xf2ed
-  476,	 // 0x01dc
-64508,	 // 0xfbfc
-65506,	 // 0xffe2
- 2808,	 // 0x0af8
- 1279,	 // 0x04ff
- 5864,	 // 0x16e8
-17915,	 // 0x45fb
-64531,	 // 0xfc13
- 7424,	 // 0x1d00
- 1797,	 // 0x0705
-62446,	 // 0xf3ee
-65309,	 // 0xff1d
-64520,	 // 0xfc08
- 3582,	 // 0x0dfe
- 2325,	 // 0x0915
-63992,	 // 0xf9f8
-61909,	 // 0xf1d5
-33271,	 // 0x81f7
-63199,	 // 0xf6df
-11022,	 // 0x2b0e
-60436,	 // 0xec14
-55790,	 // 0xd9ee
-59932,	 // 0xea1c
- 3835,	 // 0x0efb
-56108,	 // 0xdb2c
- 1781,	 // 0x06f5
-57078,	 // 0xdef6
-64699,	 // 0xfcbb
-11242,	 // 0x2bea
- 1244,	 // 0x04dc
-65502,	 // 0xffde
-62227,	 // 0xf313
-47101,	 // 0xb7fd
-58637,	 // 0xe50d
- 8703,	 // 0x21ff
-17908,	 // 0x45f4
-   14,	 // 0x000e
-62703,	 // 0xf4ef
-  774,	 // 0x0306
-63966,	 // 0xf9de
-61204,	 // 0xef14
- 8690,	 // 0x21f2
-56769,	 // 0xddc1
-60981,	 // 0xee35
-  515,	 // 0x0203
-10963,	 // 0x2ad3
- 5898,	 // 0x170a
- 2571,	 // 0x0a0b
- 2566,	 // 0x0a06
- 8713,	 // 0x2209
-10724,	 // 0x29e4
- 3355,	 // 0x0d1b
-55051,	 // 0xd70b
-59920,	 // 0xea10
-63486,	 // 0xf7fe
- 8173,	 // 0x1fed
-64050,	 // 0xfa32
-54065,	 // 0xd331
-60938,	 // 0xee0a
-  243,	 // 0x00f3
- 1529,	 // 0x05f9
-33047,	 // 0x8117
-61701,	 // 0xf105
- 5627,	 // 0x15fb
-57317,	 // 0xdfe5
-61929,	 // 0xf1e9
- 3059,	 // 0x0bf3
-65025,	 // 0xfe01
-    6,	 // 0x0006
-60138,	 // 0xeaea
- 8469,	 // 0x2115
- 7908,	 // 0x1ee4
- 1829,	 // 0x0725
- 2750,	 // 0x0abe
-61920,	 // 0xf1e0
-32553,	 // 0x7f29
-60936,	 // 0xee08
-59112,	 // 0xe6e8
-10699,	 // 0x29cb
- 6104,	 // 0x17d8
-64794,	 // 0xfd1a
- 4901,	 // 0x1325
-52479,	 // 0xccff
-61946,	 // 0xf1fa
-61724,	 // 0xf11c
- 6643,	 // 0x19f3
-64745,	 // 0xfce9
- 2568,	 // 0x0a08
-10986,	 // 0x2aea
-65518,	 // 0xffee
- 8651,	 // 0x21cb
- 2302,	 // 0x08fe
-63974,	 // 0xf9e6
- 5107,	 // 0x13f3
-15855,	 // 0x3def
-58306,	 // 0xe3c2
- 5670,	 // 0x1626
-  267,	 // 0x010b
-58891,	 // 0xe60b
-64499,	 // 0xfbf3
-18699,	 // 0x490b
-53775,	 // 0xd20f
- 7148,	 // 0x1bec
-63032,	 // 0xf638
-15334,	 // 0x3be6
-11280,	 // 0x2c10
- 1817,	 // 0x0719
-23291,	 // 0x5afb
- 7402,	 // 0x1cea
- 3573,	 // 0x0df5
-63741,	 // 0xf8fd
-65033,	 // 0xfe09
-65274,	 // 0xfefa
- 4102,	 // 0x1006
-62455,	 // 0xf3f7
- 1267,	 // 0x04f3
- 1780,	 // 0x06f4
-62210,	 // 0xf302
- 9460,	 // 0x24f4
- 5126,	 // 0x1406
- 2304,	 // 0x0900
-58620,	 // 0xe4fc
- 5627,	 // 0x15fb
-60175,	 // 0xeb0f
- 2799,	 // 0x0aef
-62750,	 // 0xf51e
-60395,	 // 0xebeb
-55063,	 // 0xd717
-64285,	 // 0xfb1d
- 3069,	 // 0x0bfd
-56085,	 // 0xdb15
-65287,	 // 0xff07
-64785,	 // 0xfd11
-  773,	 // 0x0305
- 6660,	 // 0x1a04
-56561,	 // 0xdcf1
- 2829,	 // 0x0b0d
- 6399,	 // 0x18ff
-42237,	 // 0xa4fd
-62475,	 // 0xf40b
-64222,	 // 0xfade
- 7943,	 // 0x1f07
-61968,	 // 0xf210
-62467,	 // 0xf403
-54538,	 // 0xd50a
-54804,	 // 0xd614
- 2799,	 // 0x0aef
-64262,	 // 0xfb06
-62965,	 // 0xf5f5
-33051,	 // 0x811b
- 2823,	 // 0x0b07
-30477,	 // 0x770d
-61701,	 // 0xf105
- 3077,	 // 0x0c05
- 4094,	 // 0x0ffe
-  751,	 // 0x02ef
- 3317,	 // 0x0cf5
- 2019,	 // 0x07e3
-13815,	 // 0x35f7
-64527,	 // 0xfc0f
-60161,	 // 0xeb01
- 3828,	 // 0x0ef4
- 1773,	 // 0x06ed
-56285,	 // 0xdbdd
- 7168,	 // 0x1c00
- 2294,	 // 0x08f6
-  270,	 // 0x010e
-64757,	 // 0xfcf5
-59657,	 // 0xe909
-61419,	 // 0xefeb
- 2050,	 // 0x0802
-64742,	 // 0xfce6
- 6139,	 // 0x17fb
- 3866,	 // 0x0f1a
-58099,	 // 0xe2f3
-56583,	 // 0xdd07
-65533,	 // 0xfffd
-63242,	 // 0xf70a
-65025,	 // 0xfe01
-  504,	 // 0x01f8
-64265,	 // 0xfb09
- 2056,	 // 0x0808
-15638,	 // 0x3d16
- 3834,	 // 0x0efa
-63225,	 // 0xf6f9
- 7428,	 // 0x1d04
-65031,	 // 0xfe07
-63734,	 // 0xf8f6
-63748,	 // 0xf904
- 6655,	 // 0x19ff
- 4348,	 // 0x10fc
- 1768,	 // 0x06e8
- 2054,	 // 0x0806
-33261,	 // 0x81ed
-64010,	 // 0xfa0a
-50946,	 // 0xc702
- 4114,	 // 0x1012
- 3590,	 // 0x0e06
- 1523,	 // 0x05f3
-59392,	 // 0xe800
-63764,	 // 0xf914
- 7670,	 // 0x1df6
- 3070,	 // 0x0bfe
- 3345,	 // 0x0d11
-10492,	 // 0x28fc
-57894,	 // 0xe226
- 2788,	 // 0x0ae4
-65514,	 // 0xffea
-13043,	 // 0x32f3
-  262,	 // 0x0106
-54783,	 // 0xd5ff
-62729,	 // 0xf509
- 1302,	 // 0x0516
-56809,	 // 0xdde9
-58641,	 // 0xe511
- 4100,	 // 0x1004
-58134,	 // 0xe316
-64276,	 // 0xfb14
- 1782,	 // 0x06f6
-60687,	 // 0xed0f
- 1269,	 // 0x04f5
-59947,	 // 0xea2b
-65282,	 // 0xff02
- 4327,	 // 0x10e7
- 5635,	 // 0x1603
- 3071,	 // 0x0bff
-26630,	 // 0x6806
- 1024,	 // 0x0400
-57587,	 // 0xe0f3
-55559,	 // 0xd907
-59690,	 // 0xe92a
-61433,	 // 0xeff9
- 1774,	 // 0x06ee
- 1556,	 // 0x0614
- 6663,	 // 0x1a07
-13795,	 // 0x35e3
- 2796,	 // 0x0aec
-32707,	 // 0x7fc3
-  490,	 // 0x01ea
- 8469,	 // 0x2115
- 2799,	 // 0x0aef
-61210,	 // 0xef1a
-  257,	 // 0x0101
- 5900,	 // 0x170c
-64009,	 // 0xfa09
-64519,	 // 0xfc07
-64750,	 // 0xfcee
- 4882,	 // 0x1312
-  522,	 // 0x020a
- 4855,	 // 0x12f7
-64019,	 // 0xfa13
-62696,	 // 0xf4e8
- 7154,	 // 0x1bf2
- 2049,	 // 0x0801
-59663,	 // 0xe90f
-60426,	 // 0xec0a
- 1292,	 // 0x050c
-64998,	 // 0xfde6
- 3589,	 // 0x0e05
-64996,	 // 0xfde4
-62709,	 // 0xf4f5
- 2836,	 // 0x0b14
- 4393,	 // 0x1129
-61162,	 // 0xeeea
- 2783,	 // 0x0adf
-59916,	 // 0xea0c
-60669,	 // 0xecfd
- 6391,	 // 0x18f7
-60687,	 // 0xed0f
- 1787,	 // 0x06fb
-32513,	 // 0x7f01
-60656,	 // 0xecf0
- 9464,	 // 0x24f8
- 4095,	 // 0x0fff
- 1282,	 // 0x0502
- 2833,	 // 0x0b11
-62720,	 // 0xf500
- 5092,	 // 0x13e4
-64512,	 // 0xfc00
-63209,	 // 0xf6e9
-64775,	 // 0xfd07
-37390,	 // 0x920e
- 3580,	 // 0x0dfc
-18162,	 // 0x46f2
-63467,	 // 0xf7eb
- 6136,	 // 0x17f8
-61163,	 // 0xeeeb
-62210,	 // 0xf302
-56068,	 // 0xdb04
-61995,	 // 0xf22b
-14573,	 // 0x38ed
-60669,	 // 0xecfd
- 1565,	 // 0x061d
-11012,	 // 0x2b04
- 1796,	 // 0x0704
-57078,	 // 0xdef6
-51691,	 // 0xc9eb
- 2054,	 // 0x0806
-62682,	 // 0xf4da
- 8202,	 // 0x200a
- 1729,	 // 0x06c1
-63502,	 // 0xf80e
-47400,	 // 0xb928
-60637,	 // 0xecdd
-61699,	 // 0xf103
-54754,	 // 0xd5e2
- 3888,	 // 0x0f30
-61171,	 // 0xeef3
-61700,	 // 0xf104
- 3095,	 // 0x0c17
-63015,	 // 0xf627
- 1509,	 // 0x05e5
-60904,	 // 0xede8
- 1857,	 // 0x0741
-33046,	 // 0x8116
- 2834,	 // 0x0b12
-58104,	 // 0xe2f8
-57657,	 // 0xe139
-13564,	 // 0x34fc
-13007,	 // 0x32cf
-49421,	 // 0xc10d
-61236,	 // 0xef34
-61519,	 // 0xf04f
-64756,	 // 0xfcf4
- 4101,	 // 0x1005
-60607,	 // 0xecbf
-61207,	 // 0xef17
-14846,	 // 0x39fe
-61182,	 // 0xeefe
-65282,	 // 0xff02
-65028,	 // 0xfe04
-56837,	 // 0xde05
- 3579,	 // 0x0dfb
-60659,	 // 0xecf3
-64249,	 // 0xfaf9
- 2805,	 // 0x0af5
- 4354,	 // 0x1102
-61456,	 // 0xf010
-60972,	 // 0xee2c
-59402,	 // 0xe80a
- 2303,	 // 0x08ff
-   12,	 // 0x000c
-64000,	 // 0xfa00
- 1798,	 // 0x0706
-61689,	 // 0xf0f9
-65032,	 // 0xfe08
-55317,	 // 0xd815
- 2827,	 // 0x0b0b
- 1815,	 // 0x0717
-56596,	 // 0xdd14
- 6652,	 // 0x19fc
-65007,	 // 0xfdef
-59936,	 // 0xea20
-54556,	 // 0xd51c
- 1322,	 // 0x052a
-60937,	 // 0xee09
-63716,	 // 0xf8e4
- 5618,	 // 0x15f2
-33250,	 // 0x81e2
-    0,	 // 0x0000
-63732,	 // 0xf8f4
-62990,	 // 0xf60e
-63981,	 // 0xf9ed
-  993,	 // 0x03e1
- 1553,	 // 0x0611
-63496,	 // 0xf808
- 4339,	 // 0x10f3
- 4095,	 // 0x0fff
-60663,	 // 0xecf7
-48141,	 // 0xbc0d
- 4865,	 // 0x1301
-18918,	 // 0x49e6
- 6888,	 // 0x1ae8
- 2318,	 // 0x090e
- 3301,	 // 0x0ce5
- 5366,	 // 0x14f6
-60940,	 // 0xee0c
-64265,	 // 0xfb09
-58866,	 // 0xe5f2
- 3091,	 // 0x0c13
- 9450,	 // 0x24ea
-61950,	 // 0xf1fe
-  506,	 // 0x01fa
-60661,	 // 0xecf5
-65040,	 // 0xfe10
-63243,	 // 0xf70b
-62440,	 // 0xf3e8
-57093,	 // 0xdf05
-65017,	 // 0xfdf9
-56588,	 // 0xdd0c
- 2024,	 // 0x07e8
- 2569,	 // 0x0a09
-53802,	 // 0xd22a
- 5113,	 // 0x13f9
- 2071,	 // 0x0817
-64256,	 // 0xfb00
- 5674,	 // 0x162a
-65532,	 // 0xfffc
- 3067,	 // 0x0bfb
-64236,	 // 0xfaec
-64267,	 // 0xfb0b
-63959,	 // 0xf9d7
-44798,	 // 0xaefe
- 2311,	 // 0x0907
-62713,	 // 0xf4f9
-62966,	 // 0xf5f6
- 5156,	 // 0x1424
-60669,	 // 0xecfd
-  734,	 // 0x02de
- 3088,	 // 0x0c10
-64761,	 // 0xfcf9
-61135,	 // 0xeecf
- 7688,	 // 0x1e08
-33034,	 // 0x810a
-64225,	 // 0xfae1
-17404,	 // 0x43fc
-17157,	 // 0x4305
- 3098,	 // 0x0c1a
-  767,	 // 0x02ff
-16135,	 // 0x3f07
- 6588,	 // 0x19bc
- 5346,	 // 0x14e2
- 7167,	 // 0x1bff
- 2806,	 // 0x0af6
- 1048,	 // 0x0418
-57083,	 // 0xdefb
-59149,	 // 0xe70d
-62446,	 // 0xf3ee
- 2049,	 // 0x0801
-61424,	 // 0xeff0
-  274,	 // 0x0112
-50937,	 // 0xc6f9
- 5883,	 // 0x16fb
-60684,	 // 0xed0c
-64006,	 // 0xfa06
- 3275,	 // 0x0ccb
-65294,	 // 0xff0e
-61716,	 // 0xf114
- 8692,	 // 0x21f4
-16835,	 // 0x41c3
- 2263,	 // 0x08d7
-60698,	 // 0xed1a
-  736,	 // 0x02e0
-61144,	 // 0xeed8
-62215,	 // 0xf307
- 6644,	 // 0x19f4
-39695,	 // 0x9b0f
- 7941,	 // 0x1f05
- 7430,	 // 0x1d06
-14829,	 // 0x39ed
- 5359,	 // 0x14ef
-64279,	 // 0xfb17
- 2260,	 // 0x08d4
-15597,	 // 0x3ced
-62495,	 // 0xf41f
- 8960,	 // 0x2300
-60447,	 // 0xec1f
-33260,	 // 0x81ec
-  457,	 // 0x01c9
-12037,	 // 0x2f05
-65282,	 // 0xff02
-59891,	 // 0xe9f3
-60693,	 // 0xed15
- 2557,	 // 0x09fd
- 3083,	 // 0x0c0b
-64786,	 // 0xfd12
-65037,	 // 0xfe0d
- 2831,	 // 0x0b0f
- 4081,	 // 0x0ff1
-61932,	 // 0xf1ec
-  513,	 // 0x0201
- 9979,	 // 0x26fb
-14610,	 // 0x3912
-60917,	 // 0xedf5
-60948,	 // 0xee14
-63471,	 // 0xf7ef
-62970,	 // 0xf5fa
-60414,	 // 0xebfe
-10489,	 // 0x28f9
- 3077,	 // 0x0c05
- 1277,	 // 0x04fd
-64010,	 // 0xfa0a
- 1545,	 // 0x0609
-64004,	 // 0xfa04
-63479,	 // 0xf7f7
-    2,	 // 0x0002
- 2021,	 // 0x07e5
-62223,	 // 0xf30f
- 2291,	 // 0x08f3
-59361,	 // 0xe7e1
-33049,	 // 0x8119
- 3076,	 // 0x0c04
- 5609,	 // 0x15e9
-62213,	 // 0xf305
-56822,	 // 0xddf6
- 2298,	 // 0x08fa
- 2318,	 // 0x090e
- 6896,	 // 0x1af0
-61169,	 // 0xeef1
-63496,	 // 0xf808
- 1233,	 // 0x04d1
-63991,	 // 0xf9f7
- 6134,	 // 0x17f6
-15110,	 // 0x3b06
- 1785,	 // 0x06f9
-63989,	 // 0xf9f5
-64766,	 // 0xfcfe
- 2806,	 // 0x0af6
-61192,	 // 0xef08
-  501,	 // 0x01f5
- 1285,	 // 0x0505
- 1269,	 // 0x04f5
-65033,	 // 0xfe09
- 3831,	 // 0x0ef7
-64511,	 // 0xfbff
-61947,	 // 0xf1fb
-58876,	 // 0xe5fc
- 3829,	 // 0x0ef5
- 1265,	 // 0x04f1
- 3332,	 // 0x0d04
-64527,	 // 0xfc0f
-63474,	 // 0xf7f2
- 2575,	 // 0x0a0f
-64502,	 // 0xfbf6
- 4090,	 // 0x0ffa
-63489,	 // 0xf801
-59152,	 // 0xe710
- 4619,	 // 0x120b
- 1792,	 // 0x0700
- 3840,	 // 0x0f00
-  774,	 // 0x0306
-64780,	 // 0xfd0c
-64012,	 // 0xfa0c
-63758,	 // 0xf90e
-28935,	 // 0x7107
- 2061,	 // 0x080d
-63487,	 // 0xf7ff
-62985,	 // 0xf609
-65273,	 // 0xfef9
-64235,	 // 0xfaeb
-63510,	 // 0xf816
-61187,	 // 0xef03
-62737,	 // 0xf511
-64016,	 // 0xfa10
- 5138,	 // 0x1412
-33277,	 // 0x81fd
-62222,	 // 0xf30e
- 8448,	 // 0x2100
-54786,	 // 0xd602
- 1276,	 // 0x04fc
-63475,	 // 0xf7f3
-64757,	 // 0xfcf5
- 2319,	 // 0x090f
- 3584,	 // 0x0e00
-60153,	 // 0xeaf9
- 4632,	 // 0x1218
-55561,	 // 0xd909
- 1801,	 // 0x0709
-59379,	 // 0xe7f3
- 2576,	 // 0x0a10
-62204,	 // 0xf2fc
- 2542,	 // 0x09ee
-62222,	 // 0xf30e
- 3888,	 // 0x0f30
-57849,	 // 0xe1f9
- 2567,	 // 0x0a07
- 2044,	 // 0x07fc
- 4603,	 // 0x11fb
- 1780,	 // 0x06f4
- 6147,	 // 0x1803
-57345,	 // 0xe001
-  509,	 // 0x01fd
-65516,	 // 0xffec
-64523,	 // 0xfc0b
-61423,	 // 0xefef
- 1034,	 // 0x040a
-61709,	 // 0xf10d
-57326,	 // 0xdfee
-32513,	 // 0x7f01
-59139,	 // 0xe703
- 3833,	 // 0x0ef9
- 4093,	 // 0x0ffd
- 2819,	 // 0x0b03
-62695,	 // 0xf4e7
-64005,	 // 0xfa05
- 4614,	 // 0x1206
- 5895,	 // 0x1707
- 3825,	 // 0x0ef1
-61692,	 // 0xf0fc
- 1256,	 // 0x04e8
-15860,	 // 0x3df4
-14100,	 // 0x3714
-55023,	 // 0xd6ef
-63823,	 // 0xf94f
-61448,	 // 0xf008
-64247,	 // 0xfaf7
-60916,	 // 0xedf4
-64515,	 // 0xfc03
-  223,	 // 0x00df
-64734,	 // 0xfcde
-63242,	 // 0xf70a
- 1495,	 // 0x05d7
- 2077,	 // 0x081d
-58885,	 // 0xe605
-64768,	 // 0xfd00
-  274,	 // 0x0112
-12019,	 // 0x2ef3
-62745,	 // 0xf519
- 7670,	 // 0x1df6
- 2323,	 // 0x0913
-58601,	 // 0xe4e9
-61447,	 // 0xf007
- 5382,	 // 0x1506
-60918,	 // 0xedf6
- 5102,	 // 0x13ee
- 7391,	 // 0x1cdf
- 3590,	 // 0x0e06
- 1032,	 // 0x0408
-55808,	 // 0xda00
-50428,	 // 0xc4fc
- 5902,	 // 0x170e
- 2789,	 // 0x0ae5
-33275,	 // 0x81fb
-  514,	 // 0x0202
- 1001,	 // 0x03e9
-64263,	 // 0xfb07
- 9988,	 // 0x2704
- 5376,	 // 0x1500
- 6123,	 // 0x17eb
- 6634,	 // 0x19ea
-60925,	 // 0xedfd
-61968,	 // 0xf210
- 9470,	 // 0x24fe
-54285,	 // 0xd40d
-61671,	 // 0xf0e7
-17940,	 // 0x4614
-17168,	 // 0x4310
-60174,	 // 0xeb0e
-63206,	 // 0xf6e6
-63961,	 // 0xf9d9
-54480,	 // 0xd4d0
-18738,	 // 0x4932
-32557,	 // 0x7f2d
- 8461,	 // 0x210d
- 6620,	 // 0x19dc
-53537,	 // 0xd121
-10208,	 // 0x27e0
-62214,	 // 0xf306
-51704,	 // 0xc9f8
-58637,	 // 0xe50d
- 3867,	 // 0x0f1b
- 8194,	 // 0x2002
-54844,	 // 0xd63c
-64980,	 // 0xfdd4
-62748,	 // 0xf51c
-60106,	 // 0xeaca
-51473,	 // 0xc911
-65284,	 // 0xff04
- 6162,	 // 0x1812
-10708,	 // 0x29d4
-60639,	 // 0xecdf
-59994,	 // 0xea5a
-65039,	 // 0xfe0f
-49183,	 // 0xc01f
-65041,	 // 0xfe11
-58379,	 // 0xe40b
-24345,	 // 0x5f19
-14356,	 // 0x3814
-62961,	 // 0xf5f1
-62716,	 // 0xf4fc
-13841,	 // 0x3611
-61991,	 // 0xf227
-12070,	 // 0x2f26
-62225,	 // 0xf311
-53755,	 // 0xd1fb
-58667,	 // 0xe52b
-63960,	 // 0xf9d8
- 3837,	 // 0x0efd
-10395,	 // 0x289b
- 2299,	 // 0x08fb
-60673,	 // 0xed01
- 9210,	 // 0x23fa
-65018,	 // 0xfdfa
- 1798,	 // 0x0706
-63732,	 // 0xf8f4
- 3332,	 // 0x0d04
-  259,	 // 0x0103
- 4060,	 // 0x0fdc
-63494,	 // 0xf806
- 1233,	 // 0x04d1
- 1242,	 // 0x04da
-56550,	 // 0xdce6
-64748,	 // 0xfcec
-  522,	 // 0x020a
-60927,	 // 0xedff
-63948,	 // 0xf9cc
- 6680,	 // 0x1a18
-58337,	 // 0xe3e1
-63746,	 // 0xf902
-63179,	 // 0xf6cb
-62985,	 // 0xf609
- 6618,	 // 0x19da
-57833,	 // 0xe1e9
-59655,	 // 0xe907
- 4846,	 // 0x12ee
-57841,	 // 0xe1f1
- 4625,	 // 0x1211
-50661,	 // 0xc5e5
-63996,	 // 0xf9fc
- 3603,	 // 0x0e13
-59891,	 // 0xe9f3
- 4098,	 // 0x1002
-60930,	 // 0xee02
- 1014,	 // 0x03f6
-64527,	 // 0xfc0f
- 2784,	 // 0x0ae0
- 7163,	 // 0x1bfb
-63735,	 // 0xf8f7
-51462,	 // 0xc906
-53510,	 // 0xd106
-51978,	 // 0xcb0a
-32542,	 // 0x7f1e
- 4871,	 // 0x1307
-30691,	 // 0x77e3
- 2560,	 // 0x0a00
-62486,	 // 0xf416
-  758,	 // 0x02f6
- 2046,	 // 0x07fe
- 3582,	 // 0x0dfe
- 2064,	 // 0x0810
-62451,	 // 0xf3f3
- 1273,	 // 0x04f9
-  764,	 // 0x02fc
-62485,	 // 0xf415
-63733,	 // 0xf8f5
- 6397,	 // 0x18fd
-  775,	 // 0x0307
-57608,	 // 0xe108
- 9981,	 // 0x26fd
- 3066,	 // 0x0bfa
- 1815,	 // 0x0717
-65532,	 // 0xfffc
- 1266,	 // 0x04f2
- 1544,	 // 0x0608
-  269,	 // 0x010d
-64256,	 // 0xfb00
- 1281,	 // 0x0501
-64512,	 // 0xfc00
-58607,	 // 0xe4ef
-  244,	 // 0x00f4
- 2038,	 // 0x07f6
- 1024,	 // 0x0400
-64252,	 // 0xfafc
-59130,	 // 0xe6fa
-33264,	 // 0x81f0
- 1801,	 // 0x0709
- 2554,	 // 0x09fa
- 2817,	 // 0x0b01
- 1543,	 // 0x0607
-59906,	 // 0xea02
- 2309,	 // 0x0905
-63484,	 // 0xf7fc
-63224,	 // 0xf6f8
- 3074,	 // 0x0c02
-63736,	 // 0xf8f8
- 3846,	 // 0x0f06
-64759,	 // 0xfcf7
- 6646,	 // 0x19f6
-63200,	 // 0xf6e0
- 6117,	 // 0x17e5
- 7438,	 // 0x1d0e
-62711,	 // 0xf4f7
- 1044,	 // 0x0414
-55278,	 // 0xd7ee
-51457,	 // 0xc901
-65496,	 // 0xffd8
- 8395,	 // 0x20cb
-54263,	 // 0xd3f7
-61191,	 // 0xef07
-59920,	 // 0xea10
-10520,	 // 0x2918
-55062,	 // 0xd716
-11213,	 // 0x2bcd
- 1018,	 // 0x03fa
-60416,	 // 0xec00
- 6658,	 // 0x1a02
- 6643,	 // 0x19f3
- 5921,	 // 0x1721
- 6930,	 // 0x1b12
- 4821,	 // 0x12d5
-53760,	 // 0xd200
-65085,	 // 0xfe3d
-58637,	 // 0xe50d
-65264,	 // 0xfef0
- 7680,	 // 0x1e00
-63013,	 // 0xf625
-61661,	 // 0xf0dd
- 1812,	 // 0x0714
- 1010,	 // 0x03f2
- 9014,	 // 0x2336
-55271,	 // 0xd7e7
-51168,	 // 0xc7e0
-61191,	 // 0xef07
- 1782,	 // 0x06f6
-60427,	 // 0xec0b
- 7204,	 // 0x1c24
- 2311,	 // 0x0907
- 6704,	 // 0x1a30
-65511,	 // 0xffe7
-33066,	 // 0x812a
-57399,	 // 0xe037
- 3291,	 // 0x0cdb
- 5363,	 // 0x14f3
- 6136,	 // 0x17f8
-58880,	 // 0xe600
- 1799,	 // 0x0707
-64461,	 // 0xfbcd
- 4108,	 // 0x100c
-49400,	 // 0xc0f8
-65514,	 // 0xffea
-64981,	 // 0xfdd5
-57376,	 // 0xe020
-62703,	 // 0xf4ef
-53239,	 // 0xcff7
-65505,	 // 0xffe1
-16631,	 // 0x40f7
- 4122,	 // 0x101a
- 5358,	 // 0x14ee
- 6707,	 // 0x1a33
-56316,	 // 0xdbfc
-57440,	 // 0xe060
- 2309,	 // 0x0905
-64261,	 // 0xfb05
- 2263,	 // 0x08d7
-56834,	 // 0xde02
- 3595,	 // 0x0e0b
-12357,	 // 0x3045
-63743,	 // 0xf8ff
-10511,	 // 0x290f
-57311,	 // 0xdfdf
- 3851,	 // 0x0f0b
-10537,	 // 0x2929
-32750,	 // 0x7fee
- 9740,	 // 0x260c
-44299,	 // 0xad0b
- 7437,	 // 0x1d0d
- 3058,	 // 0x0bf2
-56547,	 // 0xdce3
-64262,	 // 0xfb06
- 3051,	 // 0x0beb
- 3523,	 // 0x0dc3
-57353,	 // 0xe009
-60707,	 // 0xed23
-49953,	 // 0xc321
-59163,	 // 0xe71b
-18919,	 // 0x49e7
- 4372,	 // 0x1114
-64272,	 // 0xfb10
- 5412,	 // 0x1524
-   40,	 // 0x0028
- 5150,	 // 0x141e
-58106,	 // 0xe2fa
-61938,	 // 0xf1f2
- 4576,	 // 0x11e0
-11995,	 // 0x2edb
- 1040,	 // 0x0410
-61970,	 // 0xf212
-  266,	 // 0x010a
-62218,	 // 0xf30a
-57884,	 // 0xe21c
- 4809,	 // 0x12c9
- 2316,	 // 0x090c
-10049,	 // 0x2741
-58113,	 // 0xe301
-63512,	 // 0xf818
-61177,	 // 0xeef9
-  824,	 // 0x0338
- 4902,	 // 0x1326
-10510,	 // 0x290e
- 7181,	 // 0x1c0d
-61925,	 // 0xf1e5
-61947,	 // 0xf1fb
-56271,	 // 0xdbcf
- 5124,	 // 0x1404
-  517,	 // 0x0205
-63740,	 // 0xf8fc
-58899,	 // 0xe613
-62186,	 // 0xf2ea
-58598,	 // 0xe4e6
- 9430,	 // 0x24d6
- 4560,	 // 0x11d0
- 7394,	 // 0x1ce2
-63206,	 // 0xf6e6
- 1777,	 // 0x06f1
-14845,	 // 0x39fd
-59848,	 // 0xe9c8
-61665,	 // 0xf0e1
-33028,	 // 0x8104
-64238,	 // 0xfaee
-23526,	 // 0x5be6
-61698,	 // 0xf102
- 2010,	 // 0x07da
-60951,	 // 0xee17
- 3362,	 // 0x0d22
-62779,	 // 0xf53b
-61668,	 // 0xf0e4
-59379,	 // 0xe7f3
-61958,	 // 0xf206
-60933,	 // 0xee05
-64023,	 // 0xfa17
- 5612,	 // 0x15ec
-63985,	 // 0xf9f1
-62962,	 // 0xf5f2
-55552,	 // 0xd900
- 1537,	 // 0x0601
- 2828,	 // 0x0b0c
-60949,	 // 0xee15
-62954,	 // 0xf5ea
-60674,	 // 0xed02
-63212,	 // 0xf6ec
-64547,	 // 0xfc23
- 6408,	 // 0x1908
-63767,	 // 0xf917
- 5900,	 // 0x170c
-64038,	 // 0xfa26
-57633,	 // 0xe121
-13530,	 // 0x34da
-60672,	 // 0xed00
-63212,	 // 0xf6ec
-63733,	 // 0xf8f5
-32738,	 // 0x7fe2
-62475,	 // 0xf40b
- 8200,	 // 0x2008
- 1543,	 // 0x0607
-62992,	 // 0xf610
- 5841,	 // 0x16d1
- 3574,	 // 0x0df6
-63752,	 // 0xf908
- 8712,	 // 0x2208
-63732,	 // 0xf8f4
-61206,	 // 0xef16
- 2529,	 // 0x09e1
- 3304,	 // 0x0ce8
-14057,	 // 0x36e9
-51694,	 // 0xc9ee
- 9727,	 // 0x25ff
-60160,	 // 0xeb00
- 4857,	 // 0x12f9
-20224,	 // 0x4f00
-22278,	 // 0x5706
- 1042,	 // 0x0412
-61956,	 // 0xf204
-18895,	 // 0x49cf
-48330,	 // 0xbcca
-59626,	 // 0xe8ea
- 5879,	 // 0x16f7
-14628,	 // 0x3924
-41469,	 // 0xa1fd
-61692,	 // 0xf0fc
-56837,	 // 0xde05
-53729,	 // 0xd1e1
-61612,	 // 0xf0ac
- 5097,	 // 0x13e9
-65469,	 // 0xffbd
-14058,	 // 0x36ea
-10028,	 // 0x272c
-59628,	 // 0xe8ec
- 6637,	 // 0x19ed
-58306,	 // 0xe3c2
- 1545,	 // 0x0609
-59970,	 // 0xea42
- 6690,	 // 0x1a22
-50197,	 // 0xc415
-62121,	 // 0xf2a9
-47130,	 // 0xb81a
-  231,	 // 0x00e7
-32715,	 // 0x7fcb
-12251,	 // 0x2fdb
- 2540,	 // 0x09ec
- 4867,	 // 0x1303
-59404,	 // 0xe80c
-14633,	 // 0x3929
-56784,	 // 0xddd0
-51693,	 // 0xc9ed
-58819,	 // 0xe5c3
-57577,	 // 0xe0e9
-11653,	 // 0x2d85
-56795,	 // 0xdddb
-16165,	 // 0x3f25
- 2333,	 // 0x091d
-56118,	 // 0xdb36
-53725,	 // 0xd1dd
-64220,	 // 0xfadc
-22330,	 // 0x573a
- 3046,	 // 0x0be6
-63470,	 // 0xf7ee
-11301,	 // 0x2c25
-35568,	 // 0x8af0
-53995,	 // 0xd2eb
-60424,	 // 0xec08
-56292,	 // 0xdbe4
-54754,	 // 0xd5e2
- 1496,	 // 0x05d8
-51204,	 // 0xc804
-55206,	 // 0xd7a6
-12288,	 // 0x3000
-58376,	 // 0xe408
-64256,	 // 0xfb00
-16382,	 // 0x3ffe
-64515,	 // 0xfc03
-59154,	 // 0xe712
- 2306,	 // 0x0902
-63178,	 // 0xf6ca
-56320,	 // 0xdc00
- 2810,	 // 0x0afa
- 6096,	 // 0x17d0
-65042,	 // 0xfe12
-54788,	 // 0xd604
-37062,	 // 0x90c6
-59433,	 // 0xe829
-64027,	 // 0xfa1b
- 7877,	 // 0x1ec5
- 9731,	 // 0x2603
- 2004,	 // 0x07d4
- 4085,	 // 0x0ff5
-60890,	 // 0xedda
- 1065,	 // 0x0429
-54510,	 // 0xd4ee
- 3092,	 // 0x0c14
-33074,	 // 0x8132
-47323,	 // 0xb8db
- 4620,	 // 0x120c
- 4625,	 // 0x1211
-63238,	 // 0xf706
-62981,	 // 0xf605
- 1778,	 // 0x06f2
- 1525,	 // 0x05f5
-10484,	 // 0x28f4
-   20,	 // 0x0014
- 2037,	 // 0x07f5
- 1496,	 // 0x05d8
-64489,	 // 0xfbe9
- 7158,	 // 0x1bf6
- 1540,	 // 0x0604
- 3066,	 // 0x0bfa
-61950,	 // 0xf1fe
-59919,	 // 0xea0f
- 2805,	 // 0x0af5
-    2,	 // 0x0002
- 2247,	 // 0x08c7
- 6635,	 // 0x19eb
-63004,	 // 0xf61c
- 8692,	 // 0x21f4
-63486,	 // 0xf7fe
-  762,	 // 0x02fa
-61711,	 // 0xf10f
- 4095,	 // 0x0fff
-63990,	 // 0xf9f6
-64526,	 // 0xfc0e
- 3553,	 // 0x0de1
- 2316,	 // 0x090c
-63473,	 // 0xf7f1
- 4843,	 // 0x12eb
- 4099,	 // 0x1003
-64243,	 // 0xfaf3
- 2062,	 // 0x080e
-58104,	 // 0xe2f8
-58368,	 // 0xe400
-62729,	 // 0xf509
-60427,	 // 0xec0b
- 1319,	 // 0x0527
-62970,	 // 0xf5fa
- 3568,	 // 0x0df0
-33035,	 // 0x810b
-61707,	 // 0xf10b
-15614,	 // 0x3cfe
-58410,	 // 0xe42a
-62518,	 // 0xf436
-58083,	 // 0xe2e3
-65030,	 // 0xfe06
-  514,	 // 0x0202
-63764,	 // 0xf914
-  247,	 // 0x00f7
- 6351,	 // 0x18cf
- 7932,	 // 0x1efc
-15338,	 // 0x3bea
-53754,	 // 0xd1fa
-57591,	 // 0xe0f7
- 9475,	 // 0x2503
- 1066,	 // 0x042a
-63699,	 // 0xf8d3
- 2830,	 // 0x0b0e
-61659,	 // 0xf0db
-57352,	 // 0xe008
- 3341,	 // 0x0d0d
- 2816,	 // 0x0b00
-61938,	 // 0xf1f2
- 1050,	 // 0x041a
- 2556,	 // 0x09fc
-64001,	 // 0xfa01
-62741,	 // 0xf515
-60174,	 // 0xeb0e
- 3043,	 // 0x0be3
-63740,	 // 0xf8fc
-59397,	 // 0xe805
-63506,	 // 0xf812
-33311,	 // 0x821f
-10240,	 // 0x2800
-11787,	 // 0x2e0b
-57093,	 // 0xdf05
-59390,	 // 0xe7fe
- 7687,	 // 0x1e07
-52257,	 // 0xcc21
- 3358,	 // 0x0d1e
-57812,	 // 0xe1d4
-62734,	 // 0xf50e
- 4098,	 // 0x1002
-33044,	 // 0x8114
-54036,	 // 0xd314
- 9694,	 // 0x25de
-  798,	 // 0x031e
- 9465,	 // 0x24f9
-65509,	 // 0xffe5
- 2316,	 // 0x090c
- 1045,	 // 0x0415
- 8180,	 // 0x1ff4
-55289,	 // 0xd7f9
- 2544,	 // 0x09f0
-65049,	 // 0xfe19
- 1289,	 // 0x0509
-  770,	 // 0x0302
- 3320,	 // 0x0cf8
-49666,	 // 0xc202
-55313,	 // 0xd811
-11743,	 // 0x2ddf
- 3581,	 // 0x0dfd
- 1043,	 // 0x0413
-65312,	 // 0xff20
- 2799,	 // 0x0aef
- 5906,	 // 0x1712
-64519,	 // 0xfc07
- 5395,	 // 0x1513
-55592,	 // 0xd928
-62710,	 // 0xf4f6
-  787,	 // 0x0313
-58878,	 // 0xe5fe
-59376,	 // 0xe7f0
- 2811,	 // 0x0afb
-65287,	 // 0xff07
-  490,	 // 0x01ea
-16347,	 // 0x3fdb
- 5115,	 // 0x13fb
-63741,	 // 0xf8fd
-57304,	 // 0xdfd8
-59130,	 // 0xe6fa
- 4841,	 // 0x12e9
-63971,	 // 0xf9e3
-64486,	 // 0xfbe6
- 4630,	 // 0x1216
- 7706,	 // 0x1e1a
- 2856,	 // 0x0b28
-33034,	 // 0x810a
- 5117,	 // 0x13fd
- 6911,	 // 0x1aff
-55037,	 // 0xd6fd
-60371,	 // 0xebd3
-61969,	 // 0xf211
- 3060,	 // 0x0bf4
- 8204,	 // 0x200c
-63980,	 // 0xf9ec
-62722,	 // 0xf502
- 1808,	 // 0x0710
- 6361,	 // 0x18d9
-57864,	 // 0xe208
-59122,	 // 0xe6f2
-60417,	 // 0xec01
- 5154,	 // 0x1422
-64752,	 // 0xfcf0
-62468,	 // 0xf404
-11275,	 // 0x2c0b
-57849,	 // 0xe1f9
-53486,	 // 0xd0ee
-65036,	 // 0xfe0c
-63755,	 // 0xf90b
- 1040,	 // 0x0410
-   21,	 // 0x0015
- 7166,	 // 0x1bfe
-61968,	 // 0xf210
-55041,	 // 0xd701
- 1784,	 // 0x06f8
-56060,	 // 0xdafc
- 6679,	 // 0x1a17
-  494,	 // 0x01ee
-56851,	 // 0xde13
-32524,	 // 0x7f0c
- 4598,	 // 0x11f6
- 4105,	 // 0x1009
-60676,	 // 0xed04
-63248,	 // 0xf710
-63748,	 // 0xf904
- 2324,	 // 0x0914
- 3595,	 // 0x0e0b
-65271,	 // 0xfef7
-64756,	 // 0xfcf4
-61713,	 // 0xf111
- 6179,	 // 0x1823
-56836,	 // 0xde04
- 4872,	 // 0x1308
- 1032,	 // 0x0408
-65031,	 // 0xfe07
-  534,	 // 0x0216
-61956,	 // 0xf204
-  249,	 // 0x00f9
-64015,	 // 0xfa0f
- 4086,	 // 0x0ff6
-62962,	 // 0xf5f2
-60411,	 // 0xebfb
- 2800,	 // 0x0af0
- 2048,	 // 0x0800
- 1007,	 // 0x03ef
-61940,	 // 0xf1f4
-55054,	 // 0xd70e
- 3839,	 // 0x0eff
-62959,	 // 0xf5ef
-  959,	 // 0x03bf
- 2576,	 // 0x0a10
-58869,	 // 0xe5f5
-  514,	 // 0x0202
- 4366,	 // 0x110e
-64785,	 // 0xfd11
-65033,	 // 0xfe09
- 3327,	 // 0x0cff
-63990,	 // 0xf9f6
-65288,	 // 0xff08
-63497,	 // 0xf809
-61961,	 // 0xf209
-  759,	 // 0x02f7
-63225,	 // 0xf6f9
-32515,	 // 0x7f03
- 2567,	 // 0x0a07
-65291,	 // 0xff0b
- 4870,	 // 0x1306
-62973,	 // 0xf5fd
- 2305,	 // 0x0901
- 4104,	 // 0x1008
-62725,	 // 0xf505
-64507,	 // 0xfbfb
-    3,	 // 0x0003
- 2804,	 // 0x0af4
-50422,	 // 0xc4f6
-65291,	 // 0xff0b
-65026,	 // 0xfe02
- 5645,	 // 0x160d
-21567,	 // 0x543f
-56599,	 // 0xdd17
-58121,	 // 0xe309
-63224,	 // 0xf6f8
-15598,	 // 0x3cee
-  527,	 // 0x020f
- 2270,	 // 0x08de
-21954,	 // 0x55c2
-60105,	 // 0xeac9
- 4358,	 // 0x1106
-43476,	 // 0xa9d4
-58354,	 // 0xe3f2
-63472,	 // 0xf7f0
-54496,	 // 0xd4e0
-61716,	 // 0xf114
-56109,	 // 0xdb2d
-55064,	 // 0xd718
- 8480,	 // 0x2120
- 2335,	 // 0x091f
-51947,	 // 0xcaeb
- 2835,	 // 0x0b13
-15162,	 // 0x3b3a
-17181,	 // 0x431d
- 6942,	 // 0x1b1e
- 7450,	 // 0x1d1a
-57429,	 // 0xe055
-60886,	 // 0xedd6
- 5096,	 // 0x13e8
- 4113,	 // 0x1011
-42471,	 // 0xa5e7
-10227,	 // 0x27f3
- 3483,	 // 0x0d9b
-62476,	 // 0xf40c
- 4270,	 // 0x10ae
-10709,	 // 0x29d5
-57077,	 // 0xdef5
-59918,	 // 0xea0e
- 1254,	 // 0x04e6
-61162,	 // 0xeeea
-  265,	 // 0x0109
-33028,	 // 0x8104
-50964,	 // 0xc714
-21254,	 // 0x5306
-12791,	 // 0x31f7
-59142,	 // 0xe706
- 1555,	 // 0x0613
- 1548,	 // 0x060c
-  239,	 // 0x00ef
- 7151,	 // 0x1bef
- 8210,	 // 0x2012
-59912,	 // 0xea08
-   37,	 // 0x0025
-60408,	 // 0xebf8
-60644,	 // 0xece4
-10999,	 // 0x2af7
- 7436,	 // 0x1d0c
-61459,	 // 0xf013
-60966,	 // 0xee26
-56301,	 // 0xdbed
-60134,	 // 0xeae6
-  495,	 // 0x01ef
- 2021,	 // 0x07e5
- 2571,	 // 0x0a0b
-63227,	 // 0xf6fb
- 3104,	 // 0x0c20
-  767,	 // 0x02ff
- 7947,	 // 0x1f0b
-65270,	 // 0xfef6
- 3840,	 // 0x0f00
-62214,	 // 0xf306
- 4627,	 // 0x1213
-63242,	 // 0xf70a
- 1519,	 // 0x05ef
-10983,	 // 0x2ae7
-53986,	 // 0xd2e2
-60943,	 // 0xee0f
-64759,	 // 0xfcf7
- 1271,	 // 0x04f7
-  246,	 // 0x00f6
- 2284,	 // 0x08ec
-62941,	 // 0xf5dd
-64254,	 // 0xfafe
- 5900,	 // 0x170c
-63759,	 // 0xf90f
-33261,	 // 0x81ed
-65508,	 // 0xffe4
-16668,	 // 0x411c
-  780,	 // 0x030c
-62986,	 // 0xf60a
-64253,	 // 0xfafd
-  250,	 // 0x00fa
- 3316,	 // 0x0cf4
-60918,	 // 0xedf6
-63234,	 // 0xf702
-63748,	 // 0xf904
-    1,	 // 0x0001
-63772,	 // 0xf91c
-    1,	 // 0x0001
-  776,	 // 0x0308
- 1027,	 // 0x0403
-64259,	 // 0xfb03
- 4347,	 // 0x10fb
-62986,	 // 0xf60a
-62967,	 // 0xf5f7
- 2569,	 // 0x0a09
-  789,	 // 0x0315
- 1540,	 // 0x0604
-65027,	 // 0xfe03
-64756,	 // 0xfcf4
- 1023,	 // 0x03ff
-65031,	 // 0xfe07
-62473,	 // 0xf409
-61175,	 // 0xeef7
- 3845,	 // 0x0f05
- 6396,	 // 0x18fc
-65526,	 // 0xfff6
- 1800,	 // 0x0708
-33024,	 // 0x8100
-  770,	 // 0x0302
-63468,	 // 0xf7ec
-64005,	 // 0xfa05
-61692,	 // 0xf0fc
- 1275,	 // 0x04fb
-64500,	 // 0xfbf4
-57596,	 // 0xe0fc
- 4093,	 // 0x0ffd
- 2817,	 // 0x0b01
- 3851,	 // 0x0f0b
- 8952,	 // 0x22f8
-64255,	 // 0xfaff
-59658,	 // 0xe90a
- 2071,	 // 0x0817
- 3083,	 // 0x0c0b
-65265,	 // 0xfef1
- 2557,	 // 0x09fd
-55765,	 // 0xd9d5
- 6895,	 // 0x1aef
-55537,	 // 0xd8f1
- 9249,	 // 0x2421
- 5371,	 // 0x14fb
-62475,	 // 0xf40b
- 1742,	 // 0x06ce
-46792,	 // 0xb6c8
-11011,	 // 0x2b03
-60948,	 // 0xee14
- 8684,	 // 0x21ec
- 3324,	 // 0x0cfc
-   21,	 // 0x0015
-64255,	 // 0xfaff
-60933,	 // 0xee05
-58621,	 // 0xe4fd
-  781,	 // 0x030d
-11011,	 // 0x2b03
-58057,	 // 0xe2c9
-58889,	 // 0xe609
- 1805,	 // 0x070d
-60171,	 // 0xeb0b
- 9985,	 // 0x2701
- 4581,	 // 0x11e5
-65259,	 // 0xfeeb
-64528,	 // 0xfc10
- 9180,	 // 0x23dc
-65264,	 // 0xfef0
-50449,	 // 0xc511
- 6635,	 // 0x19eb
-62258,	 // 0xf332
-13068,	 // 0x330c
- 4355,	 // 0x1103
- 6386,	 // 0x18f2
- 5599,	 // 0x15df
- 7650,	 // 0x1de2
- 3330,	 // 0x0d02
-65011,	 // 0xfdf3
-59601,	 // 0xe8d1
-32526,	 // 0x7f0e
- 2557,	 // 0x09fd
-57872,	 // 0xe210
- 3075,	 // 0x0c03
- 7437,	 // 0x1d0d
-57332,	 // 0xdff4
-57327,	 // 0xdfef
-62968,	 // 0xf5f8
-64525,	 // 0xfc0d
-61957,	 // 0xf205
-  794,	 // 0x031a
- 5906,	 // 0x1712
-  766,	 // 0x02fe
-62190,	 // 0xf2ee
-  754,	 // 0x02f2
-65044,	 // 0xfe14
- 1271,	 // 0x04f7
-65532,	 // 0xfffc
- 1258,	 // 0x04ea
- 4351,	 // 0x10ff
- 5872,	 // 0x16f0
-53243,	 // 0xcffb
-60428,	 // 0xec0c
-10494,	 // 0x28fe
- 2030,	 // 0x07ee
- 3082,	 // 0x0c0a
-58134,	 // 0xe316
- 5363,	 // 0x14f3
-63237,	 // 0xf705
- 2553,	 // 0x09f9
- 4591,	 // 0x11ef
-32764,	 // 0x7ffc
-63752,	 // 0xf908
-61708,	 // 0xf10c
- 7668,	 // 0x1df4
-57579,	 // 0xe0eb
- 1298,	 // 0x0512
-62979,	 // 0xf603
-  999,	 // 0x03e7
- 1024,	 // 0x0400
- 3074,	 // 0x0c02
-    9,	 // 0x0009
-51167,	 // 0xc7df
- 5332,	 // 0x14d4
-18465,	 // 0x4821
- 3599,	 // 0x0e0f
- 4372,	 // 0x1114
-60922,	 // 0xedfa
- 3333,	 // 0x0d05
-    0,	 // 0x0000
-62716,	 // 0xf4fc
-65268,	 // 0xfef4
-60683,	 // 0xed0b
-50165,	 // 0xc3f5
-59640,	 // 0xe8f8
- 3578,	 // 0x0dfa
- 2041,	 // 0x07f9
- 1280,	 // 0x0500
-64244,	 // 0xfaf4
- 7430,	 // 0x1d06
-61197,	 // 0xef0d
- 6448,	 // 0x1930
-64772,	 // 0xfd04
-55582,	 // 0xd91e
-62209,	 // 0xf301
-57610,	 // 0xe10a
-14055,	 // 0x36e7
- 2838,	 // 0x0b16
- 6106,	 // 0x17da
- 2250,	 // 0x08ca
- 5646,	 // 0x160e
- 4069,	 // 0x0fe5
-60920,	 // 0xedf8
- 1270,	 // 0x04f6
-12301,	 // 0x300d
-32758,	 // 0x7ff6
- 1001,	 // 0x03e9
-65024,	 // 0xfe00
- 5382,	 // 0x1506
- 3317,	 // 0x0cf5
- 7157,	 // 0x1bf5
-60917,	 // 0xedf5
-63472,	 // 0xf7f0
-65512,	 // 0xffe8
-60958,	 // 0xee1e
-64261,	 // 0xfb05
-19484,	 // 0x4c1c
- 5389,	 // 0x150d
-14367,	 // 0x381f
-64293,	 // 0xfb25
-58105,	 // 0xe2f9
- 1019,	 // 0x03fb
- 2808,	 // 0x0af8
-59920,	 // 0xea10
- 3821,	 // 0x0eed
-61947,	 // 0xf1fb
-64498,	 // 0xfbf2
- 5860,	 // 0x16e4
-61956,	 // 0xf204
-    3,	 // 0x0003
- 3061,	 // 0x0bf5
- 1276,	 // 0x04fc
-51981,	 // 0xcb0d
-60922,	 // 0xedfa
-57318,	 // 0xdfe6
- 4107,	 // 0x100b
-62959,	 // 0xf5ef
- 4106,	 // 0x100a
-61192,	 // 0xef08
-48911,	 // 0xbf0f
-61695,	 // 0xf0ff
- 2035,	 // 0x07f3
-64257,	 // 0xfb01
-61168,	 // 0xeef0
-63213,	 // 0xf6ed
- 2293,	 // 0x08f5
- 4585,	 // 0x11e9
-65265,	 // 0xfef1
-63728,	 // 0xf8f0
-61188,	 // 0xef04
-62685,	 // 0xf4dd
-61431,	 // 0xeff7
-  771,	 // 0x0303
-64775,	 // 0xfd07
-  232,	 // 0x00e8
- 2831,	 // 0x0b0f
-59896,	 // 0xe9f8
- 1513,	 // 0x05e9
- 2062,	 // 0x080e
-58349,	 // 0xe3ed
-17154,	 // 0x4302
- 4870,	 // 0x1306
-32537,	 // 0x7f19
- 1265,	 // 0x04f1
-62716,	 // 0xf4fc
-64248,	 // 0xfaf8
- 4319,	 // 0x10df
- 1275,	 // 0x04fb
-58104,	 // 0xe2f8
- 2301,	 // 0x08fd
-62476,	 // 0xf40c
-60678,	 // 0xed06
-  770,	 // 0x0302
- 9780,	 // 0x2634
-  783,	 // 0x030f
-60418,	 // 0xec02
-63486,	 // 0xf7fe
- 3831,	 // 0x0ef7
-65278,	 // 0xfefe
-62958,	 // 0xf5ee
- 3327,	 // 0x0cff
- 8667,	 // 0x21db
-64522,	 // 0xfc0a
- 4072,	 // 0x0fe8
- 3828,	 // 0x0ef4
- 2045,	 // 0x07fd
- 6642,	 // 0x19f2
-65017,	 // 0xfdf9
- 5901,	 // 0x170d
-58137,	 // 0xe319
-   11,	 // 0x000b
- 8947,	 // 0x22f3
- 3855,	 // 0x0f0f
-32763,	 // 0x7ffb
-62978,	 // 0xf602
- 3367,	 // 0x0d27
- 6139,	 // 0x17fb
-61704,	 // 0xf108
- 2545,	 // 0x09f1
-60169,	 // 0xeb09
-59658,	 // 0xe90a
-64217,	 // 0xfad9
-63734,	 // 0xf8f6
-62720,	 // 0xf500
-55040,	 // 0xd700
- 6185,	 // 0x1829
- 7937,	 // 0x1f01
-56847,	 // 0xde0f
- 9714,	 // 0x25f2
-61177,	 // 0xeef9
- 6394,	 // 0x18fa
-64788,	 // 0xfd14
-63262,	 // 0xf71e
-62960,	 // 0xf5f0
- 2331,	 // 0x091b
-65291,	 // 0xff0b
-65030,	 // 0xfe06
-63496,	 // 0xf808
- 6140,	 // 0x17fc
-61687,	 // 0xf0f7
- 1274,	 // 0x04fa
-61412,	 // 0xefe4
-60949,	 // 0xee15
-57905,	 // 0xe231
- 4376,	 // 0x1118
-64004,	 // 0xfa04
-62983,	 // 0xf607
- 2566,	 // 0x0a06
-64499,	 // 0xfbf3
-14618,	 // 0x391a
-62720,	 // 0xf500
-59898,	 // 0xe9fa
- 4100,	 // 0x1004
- 3061,	 // 0x0bf5
- 4362,	 // 0x110a
- 1516,	 // 0x05ec
-61932,	 // 0xf1ec
-33256,	 // 0x81e8
-58109,	 // 0xe2fd
- 8921,	 // 0x22d9
- 4357,	 // 0x1105
-60149,	 // 0xeaf5
- 2052,	 // 0x0804
- 2548,	 // 0x09f4
-  513,	 // 0x0201
- 1529,	 // 0x05f9
- 6149,	 // 0x1805
-65019,	 // 0xfdfb
-23006,	 // 0x59de
-59418,	 // 0xe81a
- 5882,	 // 0x16fa
- 2536,	 // 0x09e8
-63985,	 // 0xf9f1
-63999,	 // 0xf9ff
- 4613,	 // 0x1205
- 5665,	 // 0x1621
- 3589,	 // 0x0e05
- 2288,	 // 0x08f0
- 8744,	 // 0x2228
- 3555,	 // 0x0de3
-  757,	 // 0x02f5
-61175,	 // 0xeef7
- 1002,	 // 0x03ea
-  770,	 // 0x0302
- 3560,	 // 0x0de8
-62742,	 // 0xf516
-62203,	 // 0xf2fb
-58113,	 // 0xe301
-65524,	 // 0xfff4
-61439,	 // 0xefff
- 2330,	 // 0x091a
- 3846,	 // 0x0f06
-65011,	 // 0xfdf3
-59918,	 // 0xea0e
-57082,	 // 0xdefa
- 3571,	 // 0x0df3
- 3076,	 // 0x0c04
-61705,	 // 0xf109
-64274,	 // 0xfb12
- 5113,	 // 0x13f9
-59903,	 // 0xe9ff
-60159,	 // 0xeaff
-59633,	 // 0xe8f1
- 6385,	 // 0x18f1
-60429,	 // 0xec0d
-64768,	 // 0xfd00
-60676,	 // 0xed04
-62968,	 // 0xf5f8
- 2305,	 // 0x0901
- 1270,	 // 0x04f6
- 3831,	 // 0x0ef7
- 8441,	 // 0x20f9
-54282,	 // 0xd40a
- 2056,	 // 0x0808
-32764,	 // 0x7ffc
-62378,	 // 0xf3aa
-38370,	 // 0x95e2
- 9500,	 // 0x251c
-60999,	 // 0xee47
-55202,	 // 0xd7a2
-12286,	 // 0x2ffe
-64571,	 // 0xfc3b
- 6346,	 // 0x18ca
- 9130,	 // 0x23aa
-44487,	 // 0xadc7
- 4633,	 // 0x1219
-64511,	 // 0xfbff
-42775,	 // 0xa717
- 1044,	 // 0x0414
-33322,	 // 0x822a
-45776,	 // 0xb2d0
- 2819,	 // 0x0b03
-42424,	 // 0xa5b8
-51482,	 // 0xc91a
-50417,	 // 0xc4f1
-58130,	 // 0xe312
-47120,	 // 0xb810
-49690,	 // 0xc21a
- 1244,	 // 0x04dc
- 9181,	 // 0x23dd
-12834,	 // 0x3222
-10298,	 // 0x283a
-55816,	 // 0xda08
-37903,	 // 0x940f
-61970,	 // 0xf212
- 6285,	 // 0x188d
- 2055,	 // 0x0807
-52710,	 // 0xcde6
-54532,	 // 0xd504
-45223,	 // 0xb0a7
- 6196,	 // 0x1834
-39483,	 // 0x9a3b
-17188,	 // 0x4324
-42806,	 // 0xa736
-56805,	 // 0xdde5
- 4861,	 // 0x12fd
-14294,	 // 0x37d6
-38101,	 // 0x94d5
- 2492,	 // 0x09bc
-64034,	 // 0xfa22
-13821,	 // 0x35fd
-58821,	 // 0xe5c5
-15013,	 // 0x3aa5
- 7983,	 // 0x1f2f
-56077,	 // 0xdb0d
- 7178,	 // 0x1c0a
-41210,	 // 0xa0fa
-46288,	 // 0xb4d0
- 3092,	 // 0x0c14
- 5352,	 // 0x14e8
-61683,	 // 0xf0f3
- 2043,	 // 0x07fb
-28195,	 // 0x6e23
-53713,	 // 0xd1d1
-55063,	 // 0xd717
- 9946,	 // 0x26da
-13102,	 // 0x332e
- 6830,	 // 0x1aae
-63306,	 // 0xf74a
-17909,	 // 0x45f5
-32760,	 // 0x7ff8
-43585,	 // 0xaa41
- 2050,	 // 0x0802
-18486,	 // 0x4836
-  266,	 // 0x010a
-53868,	 // 0xd26c
-48195,	 // 0xbc43
- 3315,	 // 0x0cf3
-14265,	 // 0x37b9
-25302,	 // 0x62d6
- 1565,	 // 0x061d
-12301,	 // 0x300d
- 7401,	 // 0x1ce9
-46302,	 // 0xb4de
-52001,	 // 0xcb21
- 7132,	 // 0x1bdc
-59956,	 // 0xea34
-51436,	 // 0xc8ec
-  842,	 // 0x034a
-  984,	 // 0x03d8
-56002,	 // 0xdac2
-51941,	 // 0xcae5
-19196,	 // 0x4afc
- 9976,	 // 0x26f8
-  767,	 // 0x02ff
-  776,	 // 0x0308
-61708,	 // 0xf10c
- 3309,	 // 0x0ced
- 2804,	 // 0x0af4
-58613,	 // 0xe4f5
- 5339,	 // 0x14db
-64267,	 // 0xfb0b
-  246,	 // 0x00f6
-  248,	 // 0x00f8
-  508,	 // 0x01fc
-56068,	 // 0xdb04
- 2564,	 // 0x0a04
- 3070,	 // 0x0bfe
-63490,	 // 0xf802
-64027,	 // 0xfa1b
-60413,	 // 0xebfd
-63979,	 // 0xf9eb
-  255,	 // 0x00ff
-61957,	 // 0xf205
- 3066,	 // 0x0bfa
- 3056,	 // 0x0bf0
- 5106,	 // 0x13f2
- 5116,	 // 0x13fc
- 8206,	 // 0x200e
- 2811,	 // 0x0afb
-63464,	 // 0xf7e8
-62965,	 // 0xf5f5
- 4879,	 // 0x130f
-23789,	 // 0x5ced
-59130,	 // 0xe6fa
-62999,	 // 0xf617
- 1049,	 // 0x0419
-61967,	 // 0xf20f
- 1274,	 // 0x04fa
- 2057,	 // 0x0809
-60395,	 // 0xebeb
-62211,	 // 0xf303
-63756,	 // 0xf90c
-64234,	 // 0xfaea
-32763,	 // 0x7ffb
-  266,	 // 0x010a
-65521,	 // 0xfff1
-58917,	 // 0xe625
-57391,	 // 0xe02f
- 1863,	 // 0x0747
-41704,	 // 0xa2e8
-37452,	 // 0x924c
-65119,	 // 0xfe5f
-14008,	 // 0x36b8
-15768,	 // 0x3d98
- 5878,	 // 0x16f6
-64544,	 // 0xfc20
-52185,	 // 0xcbd9
-60213,	 // 0xeb35
-38367,	 // 0x95df
-59892,	 // 0xe9f4
- 8174,	 // 0x1fee
-10421,	 // 0x28b5
- 7758,	 // 0x1e4e
-21296,	 // 0x5330
-53733,	 // 0xd1e5
-61459,	 // 0xf013
-41028,	 // 0xa044
-47651,	 // 0xba23
-20628,	 // 0x5094
-57891,	 // 0xe223
- 5101,	 // 0x13ed
-11043,	 // 0x2b23
-42320,	 // 0xa550
-60840,	 // 0xeda8
- 7137,	 // 0x1be1
-60750,	 // 0xed4e
-18660,	 // 0x48e4
- 2841,	 // 0x0b19
-60185,	 // 0xeb19
-58935,	 // 0xe637
-58644,	 // 0xe514
- 4561,	 // 0x11d1
- 4670,	 // 0x123e
-56921,	 // 0xde59
- 1786,	 // 0x06fa
-60765,	 // 0xed5d
-56282,	 // 0xdbda
-29455,	 // 0x730f
- 8528,	 // 0x2150
-32597,	 // 0x7f55
-  768,	 // 0x0300
- 1019,	 // 0x03fb
-65285,	 // 0xff05
- 1537,	 // 0x0601
- 2293,	 // 0x08f5
-64256,	 // 0xfb00
-  519,	 // 0x0207
-  768,	 // 0x0300
-  510,	 // 0x01fe
-  513,	 // 0x0201
-  254,	 // 0x00fe
-64775,	 // 0xfd07
-63491,	 // 0xf803
-  763,	 // 0x02fb
-  769,	 // 0x0301
- 2308,	 // 0x0904
-63727,	 // 0xf8ef
-64510,	 // 0xfbfe
-65533,	 // 0xfffd
-  254,	 // 0x00fe
- 1788,	 // 0x06fc
-64515,	 // 0xfc03
-65276,	 // 0xfefc
-64263,	 // 0xfb07
- 1029,	 // 0x0405
-  255,	 // 0x00ff
-  766,	 // 0x02fe
-63999,	 // 0xf9ff
-  511,	 // 0x01ff
- 1534,	 // 0x05fe
-33278,	 // 0x81fe
-64259,	 // 0xfb03
-64768,	 // 0xfd00
-64005,	 // 0xfa05
- 1024,	 // 0x0400
-65532,	 // 0xfffc
-65281,	 // 0xff01
-64004,	 // 0xfa04
-64001,	 // 0xfa01
-    2,	 // 0x0002
- 1018,	 // 0x03fa
-57338,	 // 0xdffa
-65022,	 // 0xfdfe
- 1281,	 // 0x0501
-63663,	 // 0xf8af
- 1060,	 // 0x0424
- 1752,	 // 0x06d8
- 5622,	 // 0x15f6
- 1014,	 // 0x03f6
- 3842,	 // 0x0f02
-65293,	 // 0xff0d
-50432,	 // 0xc500
-12839,	 // 0x3227
-65269,	 // 0xfef5
-64748,	 // 0xfcec
-64275,	 // 0xfb13
- 2078,	 // 0x081e
-50178,	 // 0xc402
-10271,	 // 0x281f
- 8955,	 // 0x22fb
-61366,	 // 0xefb6
-63509,	 // 0xf815
-59403,	 // 0xe80b
-10228,	 // 0x27f4
-17378,	 // 0x43e2
- 1270,	 // 0x04f6
-57407,	 // 0xe03f
- 5884,	 // 0x16fc
-48879,	 // 0xbeef
- 2039,	 // 0x07f7
- 7673,	 // 0x1df9
-62504,	 // 0xf428
-61703,	 // 0xf107
-45604,	 // 0xb224
-39408,	 // 0x99f0
-56292,	 // 0xdbe4
-  263,	 // 0x0107
-63760,	 // 0xf910
-14867,	 // 0x3a13
-65046,	 // 0xfe16
- 4857,	 // 0x12f9
-62732,	 // 0xf50c
-54242,	 // 0xd3e2
-58858,	 // 0xe5ea
-63482,	 // 0xf7fa
-33042,	 // 0x8112
-63991,	 // 0xf9f7
-23520,	 // 0x5be0
- 3583,	 // 0x0dff
- 9527,	 // 0x2537
-60182,	 // 0xeb16
-    4,	 // 0x0004
-  995,	 // 0x03e3
-56055,	 // 0xdaf7
-54014,	 // 0xd2fe
-61683,	 // 0xf0f3
- 2602,	 // 0x0a2a
-63497,	 // 0xf809
- 1285,	 // 0x0505
-59670,	 // 0xe916
- 3587,	 // 0x0e03
-59943,	 // 0xea27
- 4388,	 // 0x1124
-  728,	 // 0x02d8
- 1518,	 // 0x05ee
- 1073,	 // 0x0431
-60656,	 // 0xecf0
-63521,	 // 0xf821
-57334,	 // 0xdff6
-  526,	 // 0x020e
-16115,	 // 0x3ef3
-60360,	 // 0xebc8
-61147,	 // 0xeedb
-  261,	 // 0x0105
-64762,	 // 0xfcfa
-65267,	 // 0xfef3
- 9211,	 // 0x23fb
-65288,	 // 0xff08
-43475,	 // 0xa9d3
-62221,	 // 0xf30d
-62477,	 // 0xf40d
-60656,	 // 0xecf0
-15059,	 // 0x3ad3
- 9531,	 // 0x253b
-64210,	 // 0xfad2
- 7433,	 // 0x1d09
- 2294,	 // 0x08f6
- 1525,	 // 0x05f5
-56301,	 // 0xdbed
-33262,	 // 0x81ee
-56055,	 // 0xdaf7
-19691,	 // 0x4ceb
-    9,	 // 0x0009
- 7370,	 // 0x1cca
-62968,	 // 0xf5f8
-51966,	 // 0xcafe
- 3310,	 // 0x0cee
-65059,	 // 0xfe23
- 3047,	 // 0x0be7
- 4329,	 // 0x10e9
- 6651,	 // 0x19fb
-  224,	 // 0x00e0
- 5126,	 // 0x1406
- 4343,	 // 0x10f7
-62708,	 // 0xf4f4
- 2567,	 // 0x0a07
-54825,	 // 0xd629
-64244,	 // 0xfaf4
-64021,	 // 0xfa15
- 2243,	 // 0x08c3
-63222,	 // 0xf6f6
- 3809,	 // 0x0ee1
- 1532,	 // 0x05fc
-61931,	 // 0xf1eb
- 3529,	 // 0x0dc9
-65283,	 // 0xff03
- 5135,	 // 0x140f
-60155,	 // 0xeafb
-11835,	 // 0x2e3b
- 6652,	 // 0x19fc
- 1821,	 // 0x071d
- 1793,	 // 0x0701
-  256,	 // 0x0100
- 3855,	 // 0x0f0f
-62976,	 // 0xf600
- 2318,	 // 0x090e
-61213,	 // 0xef1d
- 1240,	 // 0x04d8
-59654,	 // 0xe906
- 6405,	 // 0x1905
- 4853,	 // 0x12f5
-62178,	 // 0xf2e2
- 3583,	 // 0x0dff
-32763,	 // 0x7ffb
-   36,	 // 0x0024
-28149,	 // 0x6df5
-63981,	 // 0xf9ed
-62736,	 // 0xf510
- 2325,	 // 0x0915
-58084,	 // 0xe2e4
-  253,	 // 0x00fd
-63752,	 // 0xf908
- 2810,	 // 0x0afa
-60415,	 // 0xebff
- 5110,	 // 0x13f6
- 2578,	 // 0x0a12
-60661,	 // 0xecf5
-  763,	 // 0x02fb
- 5632,	 // 0x1600
-64261,	 // 0xfb05
- 1531,	 // 0x05fb
-63988,	 // 0xf9f4
-63007,	 // 0xf61f
- 1552,	 // 0x0610
- 1031,	 // 0x0407
-63761,	 // 0xf911
- 4880,	 // 0x1310
- 1779,	 // 0x06f3
-65278,	 // 0xfefe
-  781,	 // 0x030d
-  252,	 // 0x00fc
-60924,	 // 0xedfc
- 3343,	 // 0x0d0f
-59118,	 // 0xe6ee
- 2554,	 // 0x09fa
- 1542,	 // 0x0606
-44035,	 // 0xac03
-65016,	 // 0xfdf8
- 5635,	 // 0x1603
-  775,	 // 0x0307
-63745,	 // 0xf901
-63232,	 // 0xf700
- 3333,	 // 0x0d05
-56556,	 // 0xdcec
-61159,	 // 0xeee7
-61184,	 // 0xef00
-57068,	 // 0xdeec
-33029,	 // 0x8105
-61961,	 // 0xf209
-20984,	 // 0x51f8
-  774,	 // 0x0306
-  515,	 // 0x0203
-64011,	 // 0xfa0b
-64261,	 // 0xfb05
-62466,	 // 0xf402
-62714,	 // 0xf4fa
-64249,	 // 0xfaf9
-64502,	 // 0xfbf6
- 3307,	 // 0x0ceb
-63738,	 // 0xf8fa
-65022,	 // 0xfdfe
-65036,	 // 0xfe0c
-63495,	 // 0xf807
-63240,	 // 0xf708
-62972,	 // 0xf5fc
-  509,	 // 0x01fd
-64517,	 // 0xfc05
-  753,	 // 0x02f1
-63999,	 // 0xf9ff
- 2564,	 // 0x0a04
-63740,	 // 0xf8fc
-65274,	 // 0xfefa
-64271,	 // 0xfb0f
-63772,	 // 0xf91c
- 2838,	 // 0x0b16
- 1773,	 // 0x06ed
-63235,	 // 0xf703
- 5901,	 // 0x170d
-63988,	 // 0xf9f4
-62978,	 // 0xf602
-32766,	 // 0x7ffe
-65037,	 // 0xfe0d
- 1015,	 // 0x03f7
-63235,	 // 0xf703
- 4084,	 // 0x0ff4
-63730,	 // 0xf8f2
-  249,	 // 0x00f9
-62969,	 // 0xf5f9
-    8,	 // 0x0008
-63730,	 // 0xf8f2
-64266,	 // 0xfb0a
-11795,	 // 0x2e13
-62726,	 // 0xf506
- 9459,	 // 0x24f3
-58625,	 // 0xe501
-10725,	 // 0x29e5
- 4389,	 // 0x1125
-10592,	 // 0x2960
- 4542,	 // 0x11be
-19434,	 // 0x4bea
-64344,	 // 0xfb58
- 8941,	 // 0x22ed
-44296,	 // 0xad08
-24053,	 // 0x5df5
-62756,	 // 0xf524
-  486,	 // 0x01e6
-13337,	 // 0x3419
-64515,	 // 0xfc03
-25293,	 // 0x62cd
-51970,	 // 0xcb02
-58427,	 // 0xe43b
-58068,	 // 0xe2d4
-56098,	 // 0xdb22
-63498,	 // 0xf80a
-55359,	 // 0xd83f
-43013,	 // 0xa805
- 6624,	 // 0x19e0
-51974,	 // 0xcb06
- 2833,	 // 0x0b11
-18133,	 // 0x46d5
- 1012,	 // 0x03f4
- 4360,	 // 0x1108
-64224,	 // 0xfae0
-14845,	 // 0x39fd
-33616,	 // 0x8350
- 2994,	 // 0x0bb2
-65473,	 // 0xffc1
- 3275,	 // 0x0ccb
-54956,	 // 0xd6ac
- 3334,	 // 0x0d06
-39944,	 // 0x9c08
-59315,	 // 0xe7b3
- 5871,	 // 0x16ef
-61408,	 // 0xefe0
-56059,	 // 0xdafb
- 8219,	 // 0x201b
- 7029,	 // 0x1b75
-32712,	 // 0x7fc8
-54004,	 // 0xd2f4
-46819,	 // 0xb6e3
-47576,	 // 0xb9d8
-64231,	 // 0xfae7
-47514,	 // 0xb99a
-   44,	 // 0x002c
-58634,	 // 0xe50a
- 1629,	 // 0x065d
-62702,	 // 0xf4ee
-33265,	 // 0x81f1
-10955,	 // 0x2acb
- 2784,	 // 0x0ae0
-41457,	 // 0xa1f1
-23755,	 // 0x5ccb
-52721,	 // 0xcdf1
- 4905,	 // 0x1329
- 1506,	 // 0x05e2
-   40,	 // 0x0028
-65518,	 // 0xffee
-59642,	 // 0xe8fa
-59615,	 // 0xe8df
- 9195,	 // 0x23eb
- 3011,	 // 0x0bc3
-62184,	 // 0xf2e8
- 4576,	 // 0x11e0
-57323,	 // 0xdfeb
-51173,	 // 0xc7e5
-45521,	 // 0xb1d1
- 8975,	 // 0x230f
-48659,	 // 0xbe13
-58513,	 // 0xe491
-58368,	 // 0xe400
-54287,	 // 0xd40f
-60644,	 // 0xece4
-64486,	 // 0xfbe6
- 8398,	 // 0x20ce
-58791,	 // 0xe5a7
- 4345,	 // 0x10f9
-57809,	 // 0xe1d1
- 3536,	 // 0x0dd0
-61076,	 // 0xee94
-  219,	 // 0x00db
-10261,	 // 0x2815
-56964,	 // 0xde84
-  221,	 // 0x00dd
-59363,	 // 0xe7e3
-   17,	 // 0x0011
-64992,	 // 0xfde0
- 3076,	 // 0x0c04
-61969,	 // 0xf211
-55550,	 // 0xd8fe
-56016,	 // 0xdad0
-60194,	 // 0xeb22
- 3333,	 // 0x0d05
-55792,	 // 0xd9f0
-61667,	 // 0xf0e3
-54513,	 // 0xd4f1
- 4279,	 // 0x10b7
-50685,	 // 0xc5fd
-63486,	 // 0xf7fe
-60396,	 // 0xebec
-60168,	 // 0xeb08
-65267,	 // 0xfef3
-61443,	 // 0xf003
-61197,	 // 0xef0d
- 5879,	 // 0x16f7
-62978,	 // 0xf602
-57114,	 // 0xdf1a
-58319,	 // 0xe3cf
- 7928,	 // 0x1ef8
-53012,	 // 0xcf14
-58619,	 // 0xe4fb
-65019,	 // 0xfdfb
-33262,	 // 0x81ee
-58304,	 // 0xe3c0
-64014,	 // 0xfa0e
-64770,	 // 0xfd02
-60669,	 // 0xecfd
-62993,	 // 0xf611
-60909,	 // 0xeded
-60110,	 // 0xeace
-61964,	 // 0xf20c
-61936,	 // 0xf1f0
-55306,	 // 0xd80a
-61678,	 // 0xf0ee
-60381,	 // 0xebdd
- 5385,	 // 0x1509
-44048,	 // 0xac10
-65005,	 // 0xfded
-61683,	 // 0xf0f3
- 5122,	 // 0x1402
-  481,	 // 0x01e1
- 6902,	 // 0x1af6
- 1549,	 // 0x060d
-59147,	 // 0xe70b
-61185,	 // 0xef01
-62203,	 // 0xf2fb
- 6920,	 // 0x1b08
-59385,	 // 0xe7f9
-63715,	 // 0xf8e3
-61178,	 // 0xeefa
- 8394,	 // 0x20ca
-49147,	 // 0xbffb
-62708,	 // 0xf4f4
-60903,	 // 0xede7
-63993,	 // 0xf9f9
-57852,	 // 0xe1fc
-59951,	 // 0xea2f
- 3841,	 // 0x0f01
- 1542,	 // 0x0606
-  533,	 // 0x0215
-63510,	 // 0xf816
-56547,	 // 0xdce3
- 1012,	 // 0x03f4
-60930,	 // 0xee02
-42994,	 // 0xa7f2
- 1528,	 // 0x05f8
-33269,	 // 0x81f5
-58823,	 // 0xe5c7
-60178,	 // 0xeb12
-64780,	 // 0xfd0c
-61697,	 // 0xf101
-  514,	 // 0x0202
-59634,	 // 0xe8f2
-60876,	 // 0xedcc
-63752,	 // 0xf908
-60174,	 // 0xeb0e
-53759,	 // 0xd1ff
-59145,	 // 0xe709
-60385,	 // 0xebe1
-53510,	 // 0xd106
-65029,	 // 0xfe05
-57066,	 // 0xdeea
-62225,	 // 0xf311
-64242,	 // 0xfaf2
- 3590,	 // 0x0e06
- 9965,	 // 0x26ed
- 7449,	 // 0x1d19
-50959,	 // 0xc70f
-  294,	 // 0x0126
-56810,	 // 0xddea
- 4873,	 // 0x1309
-60919,	 // 0xedf7
-63477,	 // 0xf7f5
-63498,	 // 0xf80a
-14547,	 // 0x38d3
-39685,	 // 0x9b05
-62443,	 // 0xf3eb
-59078,	 // 0xe6c6
-10471,	 // 0x28e7
-52702,	 // 0xcdde
-58619,	 // 0xe4fb
-12284,	 // 0x2ffc
-64264,	 // 0xfb08
-60175,	 // 0xeb0f
- 1295,	 // 0x050f
-58627,	 // 0xe503
-58631,	 // 0xe507
- 6862,	 // 0x1ace
-37901,	 // 0x940d
- 3769,	 // 0x0eb9
-49380,	 // 0xc0e4
-62337,	 // 0xf381
-65021,	 // 0xfdfd
- 2035,	 // 0x07f3
-60412,	 // 0xebfc
- 3063,	 // 0x0bf7
-61415,	 // 0xefe7
-58546,	 // 0xe4b2
-63732,	 // 0xf8f4
-64489,	 // 0xfbe9
-48636,	 // 0xbdfc
-57867,	 // 0xe20b
-57578,	 // 0xe0ea
-52459,	 // 0xcceb
-46068,	 // 0xb3f4
- 3087,	 // 0x0c0f
-64761,	 // 0xfcf9
-13301,	 // 0x33f5
-62195,	 // 0xf2f3
- 4848,	 // 0x12f0
- 6659,	 // 0x1a03
-60888,	 // 0xedd8
-   18,	 // 0x0012
- 4076,	 // 0x0fec
-39936,	 // 0x9c00
- 2554,	 // 0x09fa
-59114,	 // 0xe6ea
-62704,	 // 0xf4f0
- 2517,	 // 0x09d5
- 4362,	 // 0x110a
-59398,	 // 0xe806
- 1799,	 // 0x0707
-61196,	 // 0xef0c
-61685,	 // 0xf0f5
- 1793,	 // 0x0701
-63749,	 // 0xf905
-61190,	 // 0xef06
-64480,	 // 0xfbe0
-58381,	 // 0xe40d
-62963,	 // 0xf5f3
-57600,	 // 0xe100
-56068,	 // 0xdb04
- 1033,	 // 0x0409
-60401,	 // 0xebf1
-33271,	 // 0x81f7
-59646,	 // 0xe8fe
-65234,	 // 0xfed2
- 6140,	 // 0x17fc
-57312,	 // 0xdfe0
-60413,	 // 0xebfd
-65243,	 // 0xfedb
-58604,	 // 0xe4ec
-65018,	 // 0xfdfa
-64255,	 // 0xfaff
-61174,	 // 0xeef6
-58085,	 // 0xe2e5
-64771,	 // 0xfd03
-62951,	 // 0xf5e7
-53013,	 // 0xcf15
-63998,	 // 0xf9fe
- 2042,	 // 0x07fa
- 5876,	 // 0x16f4
-60935,	 // 0xee07
- 2300,	 // 0x08fc
-63756,	 // 0xf90c
-63714,	 // 0xf8e2
-  780,	 // 0x030c
-64996,	 // 0xfde4
-48884,	 // 0xbef4
-63480,	 // 0xf7f8
-60911,	 // 0xedef
-61678,	 // 0xf0ee
-  225,	 // 0x00e1
- 1547,	 // 0x060b
-57868,	 // 0xe20c
-  258,	 // 0x0102
-60918,	 // 0xedf6
-63487,	 // 0xf7ff
-  784,	 // 0x0310
-61185,	 // 0xef01
-61457,	 // 0xf011
-62430,	 // 0xf3de
-59651,	 // 0xe903
-61183,	 // 0xeeff
-65273,	 // 0xfef9
-50435,	 // 0xc503
- 3066,	 // 0x0bfa
- 2570,	 // 0x0a0a
-33024,	 // 0x8100
- 1753,	 // 0x06d9
- 1270,	 // 0x04f6
- 2053,	 // 0x0805
-61676,	 // 0xf0ec
-59899,	 // 0xe9fb
-64479,	 // 0xfbdf
-63215,	 // 0xf6ef
- 1289,	 // 0x0509
-62195,	 // 0xf2f3
-  253,	 // 0x00fd
-62948,	 // 0xf5e4
-64005,	 // 0xfa05
- 3825,	 // 0x0ef1
-56327,	 // 0xdc07
-60166,	 // 0xeb06
-65025,	 // 0xfe01
-59131,	 // 0xe6fb
-58629,	 // 0xe505
- 3070,	 // 0x0bfe
-60175,	 // 0xeb0f
-61158,	 // 0xeee6
-  254,	 // 0x00fe
-62176,	 // 0xf2e0
-43755,	 // 0xaaeb
-62211,	 // 0xf303
-  743,	 // 0x02e7
-60136,	 // 0xeae8
- 2035,	 // 0x07f3
-62986,	 // 0xf60a
-57341,	 // 0xdffd
-64784,	 // 0xfd10
-64226,	 // 0xfae2
-65017,	 // 0xfdf9
-65293,	 // 0xff0d
-60158,	 // 0xeafe
-60178,	 // 0xeb12
-61447,	 // 0xf007
-59905,	 // 0xea01
-61701,	 // 0xf105
- 1520,	 // 0x05f0
-60654,	 // 0xecee
-62961,	 // 0xf5f1
- 4101,	 // 0x1005
-33028,	 // 0x8104
-61369,	 // 0xefb9
- 5893,	 // 0x1705
- 2561,	 // 0x0a01
-64518,	 // 0xfc06
-62716,	 // 0xf4fc
- 2790,	 // 0x0ae6
-64735,	 // 0xfcdf
-65024,	 // 0xfe00
-59649,	 // 0xe901
- 2818,	 // 0x0b02
-64499,	 // 0xfbf3
-62731,	 // 0xf50b
- 3568,	 // 0x0df0
-57086,	 // 0xdefe
-63527,	 // 0xf827
-  757,	 // 0x02f5
- 8960,	 // 0x2300
- 5854,	 // 0x16de
-64491,	 // 0xfbeb
-59364,	 // 0xe7e4
-53991,	 // 0xd2e7
-63432,	 // 0xf7c8
-  495,	 // 0x01ef
-58339,	 // 0xe3e3
-62688,	 // 0xf4e0
- 6133,	 // 0x17f5
-55026,	 // 0xd6f2
- 3537,	 // 0x0dd1
-65242,	 // 0xfeda
- 3052,	 // 0x0bec
-62465,	 // 0xf401
- 4326,	 // 0x10e6
-62968,	 // 0xf5f8
-65494,	 // 0xffd6
- 3810,	 // 0x0ee2
-62944,	 // 0xf5e0
- 6672,	 // 0x1a10
-62434,	 // 0xf3e2
-63219,	 // 0xf6f3
-61673,	 // 0xf0e9
- 4106,	 // 0x100a
-46554,	 // 0xb5da
-62478,	 // 0xf40e
-33266,	 // 0x81f2
-62922,	 // 0xf5ca
- 6402,	 // 0x1902
-65035,	 // 0xfe0b
- 2548,	 // 0x09f4
-58330,	 // 0xe3da
-62988,	 // 0xf60c
- 1248,	 // 0x04e0
- 3076,	 // 0x0c04
-61946,	 // 0xf1fa
-62725,	 // 0xf505
-61969,	 // 0xf211
- 1784,	 // 0x06f8
-56323,	 // 0xdc03
- 3547,	 // 0x0ddb
-65298,	 // 0xff12
-64748,	 // 0xfcec
- 4590,	 // 0x11ee
- 6607,	 // 0x19cf
-63212,	 // 0xf6ec
-63234,	 // 0xf702
-52962,	 // 0xcee2
-58572,	 // 0xe4cc
-64262,	 // 0xfb06
-53478,	 // 0xd0e6
-63191,	 // 0xf6d7
- 1767,	 // 0x06e7
-62969,	 // 0xf5f9
- 2522,	 // 0x09da
- 2277,	 // 0x08e5
- 5102,	 // 0x13ee
- 3326,	 // 0x0cfe
-55035,	 // 0xd6fb
-61434,	 // 0xeffa
-62196,	 // 0xf2f4
- 3031,	 // 0x0bd7
-62691,	 // 0xf4e3
- 8977,	 // 0x2311
- 3306,	 // 0x0cea
-58600,	 // 0xe4e8
-64752,	 // 0xfcf0
-57089,	 // 0xdf01
-52723,	 // 0xcdf3
- 1291,	 // 0x050b
-33269,	 // 0x81f5
-61135,	 // 0xeecf
-  494,	 // 0x01ee
-65274,	 // 0xfefa
-63216,	 // 0xf6f0
-62684,	 // 0xf4dc
-  245,	 // 0x00f5
-  739,	 // 0x02e3
- 6164,	 // 0x1814
-63478,	 // 0xf7f6
-60945,	 // 0xee11
-59687,	 // 0xe927
- 1029,	 // 0x0405
-43531,	 // 0xaa0b
- 4041,	 // 0x0fc9
- 2552,	 // 0x09f8
-64499,	 // 0xfbf3
- 2513,	 // 0x09d1
- 4786,	 // 0x12b2
-54743,	 // 0xd5d7
- 6907,	 // 0x1afb
-53478,	 // 0xd0e6
-63428,	 // 0xf7c4
-63763,	 // 0xf913
-33279,	 // 0x81ff
-61886,	 // 0xf1be
-60130,	 // 0xeae2
- 3078,	 // 0x0c06
- 1506,	 // 0x05e2
-65284,	 // 0xff04
- 2527,	 // 0x09df
-65008,	 // 0xfdf0
-35332,	 // 0x8a04
- 1526,	 // 0x05f6
-62228,	 // 0xf314
- 1722,	 // 0x06ba
- 1760,	 // 0x06e0
-12305,	 // 0x3011
-64477,	 // 0xfbdd
-63985,	 // 0xf9f1
-64531,	 // 0xfc13
-59373,	 // 0xe7ed
-48372,	 // 0xbcf4
-  265,	 // 0x0109
-42748,	 // 0xa6fc
-61365,	 // 0xefb5
-55785,	 // 0xd9e9
-63217,	 // 0xf6f1
-56553,	 // 0xdce9
-54242,	 // 0xd3e2
-65267,	 // 0xfef3
- 1481,	 // 0x05c9
- 6413,	 // 0x190d
-64767,	 // 0xfcff
- 2576,	 // 0x0a10
-48872,	 // 0xbee8
-61694,	 // 0xf0fe
-51981,	 // 0xcb0d
-48826,	 // 0xbeba
-65036,	 // 0xfe0c
-60933,	 // 0xee05
-56575,	 // 0xdcff
- 1001,	 // 0x03e9
-65523,	 // 0xfff3
-60901,	 // 0xede5
-58339,	 // 0xe3e3
- 1246,	 // 0x04de
-63737,	 // 0xf8f9
-54779,	 // 0xd5fb
-61675,	 // 0xf0eb
- 5106,	 // 0x13f2
-48383,	 // 0xbcff
- 1993,	 // 0x07c9
-64259,	 // 0xfb03
- 3820,	 // 0x0eec
-60935,	 // 0xee07
- 5109,	 // 0x13f5
-63747,	 // 0xf903
-62700,	 // 0xf4ec
- 5099,	 // 0x13eb
-63221,	 // 0xf6f5
- 9726,	 // 0x25fe
-58347,	 // 0xe3eb
-65021,	 // 0xfdfd
-62705,	 // 0xf4f1
- 5869,	 // 0x16ed
-50668,	 // 0xc5ec
-62722,	 // 0xf502
-33278,	 // 0x81fe
-62924,	 // 0xf5cc
- 1789,	 // 0x06fd
- 3844,	 // 0x0f04
- 4098,	 // 0x1002
-54496,	 // 0xd4e0
-59396,	 // 0xe804
-64475,	 // 0xfbdb
-63746,	 // 0xf902
-61673,	 // 0xf0e9
-62722,	 // 0xf502
-62963,	 // 0xf5f3
-64503,	 // 0xfbf7
-60669,	 // 0xecfd
- 9699,	 // 0x25e3
-65275,	 // 0xfefb
-59395,	 // 0xe803
-58340,	 // 0xe3e4
- 4045,	 // 0x0fcd
-64494,	 // 0xfbee
-62947,	 // 0xf5e3
-53995,	 // 0xd2eb
-63690,	 // 0xf8ca
-63228,	 // 0xf6fc
-44802,	 // 0xaf02
-64453,	 // 0xfbc5
- 3043,	 // 0x0be3
-52219,	 // 0xcbfb
-65237,	 // 0xfed5
- 2797,	 // 0x0aed
- 6374,	 // 0x18e6
- 1015,	 // 0x03f7
-65274,	 // 0xfefa
-   14,	 // 0x000e
-  995,	 // 0x03e3
- 5841,	 // 0x16d1
-59368,	 // 0xe7e8
- 3349,	 // 0x0d15
-65528,	 // 0xfff8
-59144,	 // 0xe708
-61181,	 // 0xeefd
- 1789,	 // 0x06fd
-48368,	 // 0xbcf0
-64776,	 // 0xfd08
-33275,	 // 0x81fb
-64161,	 // 0xfaa1
-  245,	 // 0x00f5
- 3324,	 // 0x0cfc
-  772,	 // 0x0304
-51411,	 // 0xc8d3
-61422,	 // 0xefee
-63705,	 // 0xf8d9
-65289,	 // 0xff09
-62461,	 // 0xf3fd
-59925,	 // 0xea15
-58351,	 // 0xe3ef
-64231,	 // 0xfae7
-48649,	 // 0xbe09
-12760,	 // 0x31d8
-  241,	 // 0x00f1
-60652,	 // 0xecec
-62927,	 // 0xf5cf
-  698,	 // 0x02ba
-52949,	 // 0xced5
- 1778,	 // 0x06f2
-55549,	 // 0xd8fd
-63959,	 // 0xf9d7
-    5,	 // 0x0005
-36615,	 // 0x8f07
-58550,	 // 0xe4b6
-63964,	 // 0xf9dc
-54271,	 // 0xd3ff
-63982,	 // 0xf9ee
-65024,	 // 0xfe00
- 5344,	 // 0x14e0
-59899,	 // 0xe9fb
-44561,	 // 0xae11
-63497,	 // 0xf809
-64268,	 // 0xfb0c
-63152,	 // 0xf6b0
-63228,	 // 0xf6fc
-64272,	 // 0xfb10
-  742,	 // 0x02e6
-  264,	 // 0x0108
-65295,	 // 0xff0f
-65255,	 // 0xfee7
-63209,	 // 0xf6e9
- 3321,	 // 0x0cf9
-33274,	 // 0x81fa
-63641,	 // 0xf899
-51925,	 // 0xcad5
-  507,	 // 0x01fb
-61439,	 // 0xefff
-48851,	 // 0xbed3
- 4077,	 // 0x0fed
- 4799,	 // 0x12bf
-64518,	 // 0xfc06
-64777,	 // 0xfd09
-63753,	 // 0xf909
-57306,	 // 0xdfda
-62677,	 // 0xf4d5
-58881,	 // 0xe601
-51149,	 // 0xc7cd
-60431,	 // 0xec0f
-61167,	 // 0xeeef
-10480,	 // 0x28f0
-64518,	 // 0xfc06
-60930,	 // 0xee02
- 2313,	 // 0x0909
-65236,	 // 0xfed4
- 4868,	 // 0x1304
-  752,	 // 0x02f0
-45023,	 // 0xafdf
-60661,	 // 0xecf5
-56594,	 // 0xdd12
-62226,	 // 0xf312
-58821,	 // 0xe5c5
-60937,	 // 0xee09
-59381,	 // 0xe7f5
-60939,	 // 0xee0b
-58118,	 // 0xe306
-  222,	 // 0x00de
-52963,	 // 0xcee3
-64498,	 // 0xfbf2
-65015,	 // 0xfdf7
- 2758,	 // 0x0ac6
-56572,	 // 0xdcfc
-55281,	 // 0xd7f1
- 1531,	 // 0x05fb
-52990,	 // 0xcefe
-58870,	 // 0xe5f6
-63000,	 // 0xf618
-33234,	 // 0x81d2
-59323,	 // 0xe7bb
-64002,	 // 0xfa02
-63978,	 // 0xf9ea
-61195,	 // 0xef0b
-  519,	 // 0x0207
-58902,	 // 0xe616
-60102,	 // 0xeac6
-64494,	 // 0xfbee
- 3056,	 // 0x0bf0
-59162,	 // 0xe71a
-59112,	 // 0xe6e8
-62233,	 // 0xf319
-65267,	 // 0xfef3
- 6644,	 // 0x19f4
-58891,	 // 0xe60b
-65264,	 // 0xfef0
-57851,	 // 0xe1fb
- 2045,	 // 0x07fd
-62978,	 // 0xf602
-58375,	 // 0xe407
-65488,	 // 0xffd0
- 2828,	 // 0x0b0c
-  500,	 // 0x01f4
-40933,	 // 0x9fe5
-61173,	 // 0xeef5
-57096,	 // 0xdf08
-64262,	 // 0xfb06
-63445,	 // 0xf7d5
-63248,	 // 0xf710
-62952,	 // 0xf5e8
-61971,	 // 0xf213
-51464,	 // 0xc908
-64745,	 // 0xfce9
-55840,	 // 0xda20
-65027,	 // 0xfe03
-64506,	 // 0xfbfa
- 6865,	 // 0x1ad1
-56802,	 // 0xdde2
-55542,	 // 0xd8f6
-63739,	 // 0xf8fb
-48379,	 // 0xbcfb
-58608,	 // 0xe4f0
-60436,	 // 0xec14
-33244,	 // 0x81dc
-  716,	 // 0x02cc
- 3080,	 // 0x0c08
-63738,	 // 0xf8fa
-60418,	 // 0xec02
-62195,	 // 0xf2f3
-58644,	 // 0xe514
-62147,	 // 0xf2c3
- 3051,	 // 0x0beb
- 2061,	 // 0x080d
-64000,	 // 0xfa00
-61176,	 // 0xeef8
-60666,	 // 0xecfa
- 8203,	 // 0x200b
- 5359,	 // 0x14ef
-61719,	 // 0xf117
- 2299,	 // 0x08fb
-44812,	 // 0xaf0c
- 1013,	 // 0x03f5
-63471,	 // 0xf7ef
-52978,	 // 0xcef2
-61909,	 // 0xf1d5
-  242,	 // 0x00f2
-65004,	 // 0xfdec
-33260,	 // 0x81ec
-59119,	 // 0xe6ef
-63486,	 // 0xf7fe
-58871,	 // 0xe5f7
- 1294,	 // 0x050e
-61447,	 // 0xf007
-64743,	 // 0xfce7
-59152,	 // 0xe710
- 3074,	 // 0x0c02
-62192,	 // 0xf2f0
-59666,	 // 0xe912
- 1262,	 // 0x04ee
-64764,	 // 0xfcfc
-12276,	 // 0x2ff4
-54503,	 // 0xd4e7
-63232,	 // 0xf700
-  243,	 // 0x00f3
-57321,	 // 0xdfe9
-47081,	 // 0xb7e9
-63243,	 // 0xf70b
-35312,	 // 0x89f0
-63439,	 // 0xf7cf
- 5376,	 // 0x1500
-64249,	 // 0xfaf9
-65535,	 // 0xffff
-59621,	 // 0xe8e5
-58117,	 // 0xe305
-  680,	 // 0x02a8
- 3056,	 // 0x0bf0
-63994,	 // 0xf9fa
- 1004,	 // 0x03ec
-64012,	 // 0xfa0c
-63469,	 // 0xf7ed
- 3607,	 // 0x0e17
-64749,	 // 0xfced
-60923,	 // 0xedfb
-51709,	 // 0xc9fd
- 4873,	 // 0x1309
- 4850,	 // 0x12f2
-63205,	 // 0xf6e5
-62717,	 // 0xf4fd
-58120,	 // 0xe308
-60106,	 // 0xeaca
-62197,	 // 0xf2f5
-50145,	 // 0xc3e1
-60644,	 // 0xece4
-64234,	 // 0xfaea
-57333,	 // 0xdff5
- 1756,	 // 0x06dc
-58859,	 // 0xe5eb
-59140,	 // 0xe704
- 3026,	 // 0x0bd2
-63466,	 // 0xf7ea
- 2039,	 // 0x07f7
- 2782,	 // 0x0ade
- 1545,	 // 0x0609
-53223,	 // 0xcfe7
- 4366,	 // 0x110e
-65289,	 // 0xff09
-65259,	 // 0xfeeb
- 8168,	 // 0x1fe8
-57871,	 // 0xe20f
-48637,	 // 0xbdfd
-62959,	 // 0xf5ef
-33028,	 // 0x8104
-58804,	 // 0xe5b4
- 2299,	 // 0x08fb
-62489,	 // 0xf419
- 3832,	 // 0x0ef8
- 3309,	 // 0x0ced
-63996,	 // 0xf9fc
-63695,	 // 0xf8cf
-63466,	 // 0xf7ea
-62720,	 // 0xf500
-  288,	 // 0x0120
-61436,	 // 0xeffc
-54241,	 // 0xd3e1
-56049,	 // 0xdaf1
-64516,	 // 0xfc04
-59376,	 // 0xe7f0
-53508,	 // 0xd104
- 6678,	 // 0x1a16
- 4852,	 // 0x12f4
-63458,	 // 0xf7e2
-  538,	 // 0x021a
-63491,	 // 0xf803
-57777,	 // 0xe1b1
-62468,	 // 0xf404
-35824,	 // 0x8bf0
-58337,	 // 0xe3e1
-63966,	 // 0xf9de
-57854,	 // 0xe1fe
-63479,	 // 0xf7f7
-59342,	 // 0xe7ce
-61700,	 // 0xf104
- 1501,	 // 0x05dd
-52721,	 // 0xcdf1
-61193,	 // 0xef09
- 1773,	 // 0x06ed
-64254,	 // 0xfafe
-62947,	 // 0xf5e3
- 5901,	 // 0x170d
-  272,	 // 0x0110
-61644,	 // 0xf0cc
-14320,	 // 0x37f0
-49159,	 // 0xc007
-53269,	 // 0xd015
- 2028,	 // 0x07ec
-33264,	 // 0x81f0
-58793,	 // 0xe5a9
-  231,	 // 0x00e7
-64244,	 // 0xfaf4
-62976,	 // 0xf600
-60403,	 // 0xebf3
-  509,	 // 0x01fd
-64229,	 // 0xfae5
-61936,	 // 0xf1f0
-60143,	 // 0xeaef
-62969,	 // 0xf5f9
-63003,	 // 0xf61b
-60385,	 // 0xebe1
-54258,	 // 0xd3f2
-62463,	 // 0xf3ff
-61415,	 // 0xefe7
-61939,	 // 0xf1f3
- 7928,	 // 0x1ef8
- 3046,	 // 0x0be6
-62443,	 // 0xf3eb
- 1313,	 // 0x0521
-61944,	 // 0xf1f8
-55981,	 // 0xdaad
-57373,	 // 0xe01d
-33275,	 // 0x81fb
-58364,	 // 0xe3fc
-61152,	 // 0xeee0
-57847,	 // 0xe1f7
-61397,	 // 0xefd5
-56825,	 // 0xddf9
-61439,	 // 0xefff
-  491,	 // 0x01eb
-50689,	 // 0xc601
-  244,	 // 0x00f4
-63214,	 // 0xf6ee
-57606,	 // 0xe106
- 4333,	 // 0x10ed
-64751,	 // 0xfcef
-64014,	 // 0xfa0e
-  204,	 // 0x00cc
- 8697,	 // 0x21f9
-55029,	 // 0xd6f5
-52504,	 // 0xcd18
- 1010,	 // 0x03f2
-33520,	 // 0x82f0
-57485,	 // 0xe08d
-  262,	 // 0x0106
-  211,	 // 0x00d3
-60677,	 // 0xed05
-56567,	 // 0xdcf7
- 1524,	 // 0x05f4
-64205,	 // 0xfacd
-62208,	 // 0xf300
-58112,	 // 0xe300
-60153,	 // 0xeaf9
-63523,	 // 0xf823
-64220,	 // 0xfadc
- 3336,	 // 0x0d08
-49155,	 // 0xc003
-53756,	 // 0xd1fc
-56584,	 // 0xdd08
-60403,	 // 0xebf3
-62731,	 // 0xf50b
-  215,	 // 0x00d7
- 7960,	 // 0x1f18
-51999,	 // 0xcb1f
-62693,	 // 0xf4e5
-56026,	 // 0xdada
-33039,	 // 0x810f
-    1,	 // 0x0001
-60162,	 // 0xeb02
- 2275,	 // 0x08e3
-11692,	 // 0x2dac
-56319,	 // 0xdbff
-64480,	 // 0xfbe0
-59075,	 // 0xe6c3
-52190,	 // 0xcbde
- 1003,	 // 0x03eb
-62450,	 // 0xf3f2
- 9446,	 // 0x24e6
- 6396,	 // 0x18fc
-55747,	 // 0xd9c3
-57589,	 // 0xe0f5
-55259,	 // 0xd7db
-58118,	 // 0xe306
-59880,	 // 0xe9e8
-    8,	 // 0x0008
-57521,	 // 0xe0b1
-55816,	 // 0xda08
- 9246,	 // 0x241e
-64747,	 // 0xfceb
- 7941,	 // 0x1f05
-62457,	 // 0xf3f9
- 1496,	 // 0x05d8
-60126,	 // 0xeade
-64726,	 // 0xfcd6
-60391,	 // 0xebe7
- 5402,	 // 0x151a
-48644,	 // 0xbe04
-57554,	 // 0xe0d2
-64513,	 // 0xfc01
-51166,	 // 0xc7de
-63475,	 // 0xf7f3
-51439,	 // 0xc8ef
-58331,	 // 0xe3db
-53237,	 // 0xcff5
-58634,	 // 0xe50a
-54755,	 // 0xd5e3
-62728,	 // 0xf508
-57370,	 // 0xe01a
-53723,	 // 0xd1db
-49622,	 // 0xc1d6
-52976,	 // 0xcef0
-63998,	 // 0xf9fe
-63262,	 // 0xf71e
-59855,	 // 0xe9cf
-11649,	 // 0x2d81
-  779,	 // 0x030b
-59383,	 // 0xe7f7
-57273,	 // 0xdfb9
-40747,	 // 0x9f2b
-61932,	 // 0xf1ec
-61745,	 // 0xf131
-65261,	 // 0xfeed
- 5391,	 // 0x150f
-55183,	 // 0xd78f
-63957,	 // 0xf9d5
-54764,	 // 0xd5ec
-58608,	 // 0xe4f0
-59117,	 // 0xe6ed
-15601,	 // 0x3cf1
-60593,	 // 0xecb1
-34836,	 // 0x8814
-15106,	 // 0x3b02
-65250,	 // 0xfee2
-14572,	 // 0x38ec
-64499,	 // 0xfbf3
- 4292,	 // 0x10c4
-54479,	 // 0xd4cf
-61109,	 // 0xeeb5
-59631,	 // 0xe8ef
-60140,	 // 0xeaec
- 3333,	 // 0x0d05
-55528,	 // 0xd8e8
-  988,	 // 0x03dc
-63717,	 // 0xf8e5
- 6377,	 // 0x18e9
-51686,	 // 0xc9e6
-61109,	 // 0xeeb5
-59927,	 // 0xea17
-64252,	 // 0xfafc
-57582,	 // 0xe0ee
-57345,	 // 0xe001
-56602,	 // 0xdd1a
-51760,	 // 0xca30
-54474,	 // 0xd4ca
-37113,	 // 0x90f9
-63753,	 // 0xf909
-63731,	 // 0xf8f3
-45278,	 // 0xb0de
- 8909,	 // 0x22cd
- 4355,	 // 0x1103
-58116,	 // 0xe304
-51633,	 // 0xc9b1
- 4930,	 // 0x1342
-58836,	 // 0xe5d4
-59928,	 // 0xea18
-13315,	 // 0x3403
-60429,	 // 0xec0d
-62479,	 // 0xf40f
-63473,	 // 0xf7f1
-64495,	 // 0xfbef
- 1497,	 // 0x05d9
- 5132,	 // 0x140c
-57058,	 // 0xdee2
-63932,	 // 0xf9bc
-33275,	 // 0x81fb
- 5558,	 // 0x15b6
- 2281,	 // 0x08e9
- 9690,	 // 0x25da
- 3821,	 // 0x0eed
-57300,	 // 0xdfd4
-50434,	 // 0xc502
-54753,	 // 0xd5e1
-50180,	 // 0xc404
-58382,	 // 0xe40e
-  726,	 // 0x02d6
-53244,	 // 0xcffc
-  520,	 // 0x0208
-49862,	 // 0xc2c6
-57063,	 // 0xdee7
-64495,	 // 0xfbef
-  479,	 // 0x01df
-65036,	 // 0xfe0c
-64015,	 // 0xfa0f
- 2300,	 // 0x08fc
-60430,	 // 0xec0e
-60922,	 // 0xedfa
-62975,	 // 0xf5ff
-62736,	 // 0xf510
-33028,	 // 0x8104
-62205,	 // 0xf2fd
-61686,	 // 0xf0f6
-57845,	 // 0xe1f5
-64486,	 // 0xfbe6
-  255,	 // 0x00ff
-62969,	 // 0xf5f9
-62985,	 // 0xf609
- 2055,	 // 0x0807
- 1274,	 // 0x04fa
-63480,	 // 0xf7f8
-65504,	 // 0xffe0
-62450,	 // 0xf3f2
-65522,	 // 0xfff2
-62208,	 // 0xf300
-63203,	 // 0xf6e3
-63728,	 // 0xf8f0
-61196,	 // 0xef0c
-59401,	 // 0xe809
-  523,	 // 0x020b
-33546,	 // 0x830a
-61697,	 // 0xf101
-65530,	 // 0xfffa
- 2806,	 // 0x0af6
-64736,	 // 0xfce0
-  521,	 // 0x0209
-62731,	 // 0xf50b
-  485,	 // 0x01e5
-61673,	 // 0xf0e9
-62191,	 // 0xf2ef
-61155,	 // 0xeee3
-62729,	 // 0xf509
-62452,	 // 0xf3f4
-59649,	 // 0xe901
-63217,	 // 0xf6f1
-  241,	 // 0x00f1
- 2285,	 // 0x08ed
- 2319,	 // 0x090f
-60930,	 // 0xee02
- 1009,	 // 0x03f1
-62987,	 // 0xf60b
-55791,	 // 0xd9ef
-64257,	 // 0xfb01
-62972,	 // 0xf5fc
-33260,	 // 0x81ec
-59383,	 // 0xe7f7
-65019,	 // 0xfdfb
-55024,	 // 0xd6f0
-61887,	 // 0xf1bf
-63735,	 // 0xf8f7
-60655,	 // 0xecef
-64784,	 // 0xfd10
-63254,	 // 0xf716
-60932,	 // 0xee04
-62222,	 // 0xf30e
-61141,	 // 0xeed5
-64248,	 // 0xfaf8
-59904,	 // 0xea00
-65021,	 // 0xfdfd
-61414,	 // 0xefe6
-62697,	 // 0xf4e9
-58892,	 // 0xe60c
-36603,	 // 0x8efb
-63241,	 // 0xf709
-37882,	 // 0x93fa
-62182,	 // 0xf2e6
-64279,	 // 0xfb17
- 1794,	 // 0x0702
- 2515,	 // 0x09d3
- 3608,	 // 0x0e18
-61694,	 // 0xf0fe
-64729,	 // 0xfcd9
-58621,	 // 0xe4fd
-61439,	 // 0xefff
-58341,	 // 0xe3e5
-59417,	 // 0xe819
-64242,	 // 0xfaf2
-53767,	 // 0xd207
-65014,	 // 0xfdf6
-64497,	 // 0xfbf1
-65533,	 // 0xfffd
- 4347,	 // 0x10fb
-64770,	 // 0xfd02
-64249,	 // 0xfaf9
- 1286,	 // 0x0506
-60141,	 // 0xeaed
- 3344,	 // 0x0d10
-65017,	 // 0xfdf9
-33263,	 // 0x81ef
-64505,	 // 0xfbf9
-63489,	 // 0xf801
-62721,	 // 0xf501
-60637,	 // 0xecdd
-65028,	 // 0xfe04
-59394,	 // 0xe802
-62723,	 // 0xf503
- 3334,	 // 0x0d06
-62200,	 // 0xf2f8
-58634,	 // 0xe50a
-  221,	 // 0x00dd
-  512,	 // 0x0200
-64507,	 // 0xfbfb
- 1032,	 // 0x0408
-62462,	 // 0xf3fe
- 1280,	 // 0x0500
-63992,	 // 0xf9f8
-40947,	 // 0x9ff3
-   14,	 // 0x000e
- 1002,	 // 0x03ea
-60383,	 // 0xebdf
-65029,	 // 0xfe05
- 2542,	 // 0x09ee
- 1264,	 // 0x04f0
-  528,	 // 0x0210
-62710,	 // 0xf4f6
-60101,	 // 0xeac5
-61703,	 // 0xf107
-63210,	 // 0xf6ea
-59653,	 // 0xe905
-59385,	 // 0xe7f9
-62989,	 // 0xf60d
-57607,	 // 0xe107
-61947,	 // 0xf1fb
-  240,	 // 0x00f0
-  245,	 // 0x00f5
- 3579,	 // 0x0dfb
-61943,	 // 0xf1f7
- 1285,	 // 0x0505
- 5132,	 // 0x140c
-57614,	 // 0xe10e
- 1507,	 // 0x05e3
- 2031,	 // 0x07ef
-38130,	 // 0x94f2
- 1020,	 // 0x03fc
-62193,	 // 0xf2f1
-55529,	 // 0xd8e9
-63458,	 // 0xf7e2
- 1556,	 // 0x0614
- 2809,	 // 0x0af9
-61939,	 // 0xf1f3
- 1539,	 // 0x0603
- 2540,	 // 0x09ec
-64764,	 // 0xfcfc
-  251,	 // 0x00fb
-63228,	 // 0xf6fc
-59645,	 // 0xe8fd
-61175,	 // 0xeef7
-59386,	 // 0xe7fa
-  490,	 // 0x01ea
-58616,	 // 0xe4f8
-56582,	 // 0xdd06
-65024,	 // 0xfe00
-33272,	 // 0x81f8
- 1012,	 // 0x03f4
-62213,	 // 0xf305
- 2551,	 // 0x09f7
-61166,	 // 0xeeee
-63490,	 // 0xf802
- 4328,	 // 0x10e8
-65251,	 // 0xfee3
-58603,	 // 0xe4eb
-60162,	 // 0xeb02
-  770,	 // 0x0302
-63455,	 // 0xf7df
-57842,	 // 0xe1f2
- 2824,	 // 0x0b08
-60933,	 // 0xee05
-64256,	 // 0xfb00
-65034,	 // 0xfe0a
-64248,	 // 0xfaf8
-62970,	 // 0xf5fa
- 2559,	 // 0x09ff
-60681,	 // 0xed09
-61448,	 // 0xf008
-65009,	 // 0xfdf1
- 6896,	 // 0x1af0
-33258,	 // 0x81ea
-64763,	 // 0xfcfb
-65526,	 // 0xfff6
-54522,	 // 0xd4fa
-64753,	 // 0xfcf1
-63510,	 // 0xf816
-  776,	 // 0x0308
-63721,	 // 0xf8e9
-61186,	 // 0xef02
- 3051,	 // 0x0beb
-64008,	 // 0xfa08
- 1264,	 // 0x04f0
-62970,	 // 0xf5fa
-63724,	 // 0xf8ec
-61947,	 // 0xf1fb
-64248,	 // 0xfaf8
-62200,	 // 0xf2f8
-59896,	 // 0xe9f8
-57084,	 // 0xdefc
-65021,	 // 0xfdfd
-58367,	 // 0xe3ff
- 3014,	 // 0x0bc6
-64259,	 // 0xfb03
-65279,	 // 0xfeff
-64763,	 // 0xfcfb
-64007,	 // 0xfa07
-64748,	 // 0xfcec
-63456,	 // 0xf7e0
-60155,	 // 0xeafb
-60411,	 // 0xebfb
- 2556,	 // 0x09fc
-64507,	 // 0xfbfb
-56811,	 // 0xddeb
- 5358,	 // 0x14ee
-61446,	 // 0xf006
-64772,	 // 0xfd04
-62473,	 // 0xf409
-62976,	 // 0xf600
-64250,	 // 0xfafa
-65021,	 // 0xfdfd
-62984,	 // 0xf608
-60933,	 // 0xee05
-62212,	 // 0xf304
- 3819,	 // 0x0eeb
-33259,	 // 0x81eb
-63225,	 // 0xf6f9
-62710,	 // 0xf4f6
-59135,	 // 0xe6ff
-65512,	 // 0xffe8
-61974,	 // 0xf216
-64788,	 // 0xfd14
-  996,	 // 0x03e4
- 3836,	 // 0x0efc
- 2799,	 // 0x0aef
-64748,	 // 0xfcec
- 2300,	 // 0x08fc
-59124,	 // 0xe6f4
- 1532,	 // 0x05fc
-65532,	 // 0xfffc
- 2549,	 // 0x09f5
-65525,	 // 0xfff5
-63228,	 // 0xf6fc
-55811,	 // 0xda03
-65534,	 // 0xfffe
-65293,	 // 0xff0d
-64979,	 // 0xfdd3
- 2824,	 // 0x0b08
-63731,	 // 0xf8f3
- 3321,	 // 0x0cf9
- 1017,	 // 0x03f9
-62445,	 // 0xf3ed
-63191,	 // 0xf6d7
-62716,	 // 0xf4fc
-63488,	 // 0xf800
-65282,	 // 0xff02
-62463,	 // 0xf3ff
-56572,	 // 0xdcfc
-62706,	 // 0xf4f2
-53760,	 // 0xd200
-59620,	 // 0xe8e4
-63963,	 // 0xf9db
- 4605,	 // 0x11fd
-65521,	 // 0xfff1
-64780,	 // 0xfd0c
-63257,	 // 0xf719
-57856,	 // 0xe200
-59909,	 // 0xea05
-62957,	 // 0xf5ed
-33044,	 // 0x8114
-64509,	 // 0xfbfd
-  754,	 // 0x02f2
-60656,	 // 0xecf0
- 2250,	 // 0x08ca
- 1014,	 // 0x03f6
-61955,	 // 0xf203
-64498,	 // 0xfbf2
- 4101,	 // 0x1005
-61928,	 // 0xf1e8
-62958,	 // 0xf5ee
- 8442,	 // 0x20fa
-65268,	 // 0xfef4
-65268,	 // 0xfef4
-64264,	 // 0xfb08
-  256,	 // 0x0100
-64235,	 // 0xfaeb
- 9991,	 // 0x2707
-46307,	 // 0xb4e3
-65265,	 // 0xfef1
-35842,	 // 0x8c02
- 5602,	 // 0x15e2
-65013,	 // 0xfdf5
- 4860,	 // 0x12fc
- 2819,	 // 0x0b03
-60915,	 // 0xedf3
-59399,	 // 0xe807
-63712,	 // 0xf8e0
-59382,	 // 0xe7f6
-62215,	 // 0xf307
-64748,	 // 0xfcec
-58361,	 // 0xe3f9
-63723,	 // 0xf8eb
-59373,	 // 0xe7ed
-61173,	 // 0xeef5
-60378,	 // 0xebda
-63707,	 // 0xf8db
- 2811,	 // 0x0afb
-65027,	 // 0xfe03
-  240,	 // 0x00f0
-64283,	 // 0xfb1b
-58882,	 // 0xe602
-60401,	 // 0xebf1
-62701,	 // 0xf4ed
-33044,	 // 0x8114
-63214,	 // 0xf6ee
-65265,	 // 0xfef1
- 5101,	 // 0x13ed
- 1762,	 // 0x06e2
-  755,	 // 0x02f3
-63214,	 // 0xf6ee
- 2806,	 // 0x0af6
-61176,	 // 0xeef8
- 1255,	 // 0x04e7
-63481,	 // 0xf7f9
- 5380,	 // 0x1504
-63735,	 // 0xf8f7
-62983,	 // 0xf607
- 2819,	 // 0x0b03
-62199,	 // 0xf2f7
-60138,	 // 0xeaea
-62202,	 // 0xf2fa
-54741,	 // 0xd5d5
-63487,	 // 0xf7ff
-36363,	 // 0x8e0b
-64718,	 // 0xfcce
-  502,	 // 0x01f6
- 2309,	 // 0x0905
- 1533,	 // 0x05fd
-63233,	 // 0xf701
-62483,	 // 0xf413
-62689,	 // 0xf4e1
-59137,	 // 0xe701
-  753,	 // 0x02f1
-65279,	 // 0xfeff
-56584,	 // 0xdd08
-64246,	 // 0xfaf6
-50169,	 // 0xc3f9
- 5618,	 // 0x15f2
-60637,	 // 0xecdd
-65503,	 // 0xffdf
- 1796,	 // 0x0704
- 2840,	 // 0x0b18
-64237,	 // 0xfaed
-64785,	 // 0xfd11
-59904,	 // 0xea00
-61946,	 // 0xf1fa
-63481,	 // 0xf7f9
-33031,	 // 0x8107
-63733,	 // 0xf8f5
-60136,	 // 0xeae8
- 1266,	 // 0x04f2
-  480,	 // 0x01e0
- 3330,	 // 0x0d02
-62447,	 // 0xf3ef
-63738,	 // 0xf8fa
-60410,	 // 0xebfa
-65521,	 // 0xfff1
-63250,	 // 0xf712
- 1780,	 // 0x06f4
-63222,	 // 0xf6f6
- 4873,	 // 0x1309
- 1019,	 // 0x03fb
-64999,	 // 0xfde7
-64237,	 // 0xfaed
-59398,	 // 0xe806
-58613,	 // 0xe4f5
-64521,	 // 0xfc09
-53258,	 // 0xd00a
-61359,	 // 0xefaf
- 1510,	 // 0x05e6
- 2803,	 // 0x0af3
-  487,	 // 0x01e7
-64265,	 // 0xfb09
-64278,	 // 0xfb16
-64737,	 // 0xfce1
-62201,	 // 0xf2f9
-64747,	 // 0xfceb
-62970,	 // 0xf5fa
-57048,	 // 0xded8
-62448,	 // 0xf3f0
-53238,	 // 0xcff6
- 4080,	 // 0x0ff0
- 1501,	 // 0x05dd
-49165,	 // 0xc00d
-55780,	 // 0xd9e4
- 6599,	 // 0x19c7
- 4807,	 // 0x12c7
- 7665,	 // 0x1df1
-52763,	 // 0xce1b
-58878,	 // 0xe5fe
- 5116,	 // 0x13fc
- 3318,	 // 0x0cf6
- 6133,	 // 0x17f5
-  221,	 // 0x00dd
- 2562,	 // 0x0a02
- 6869,	 // 0x1ad5
-64774,	 // 0xfd06
-64782,	 // 0xfd0e
-62487,	 // 0xf417
-63482,	 // 0xf7fa
-47871,	 // 0xbaff
-65509,	 // 0xffe5
- 8876,	 // 0x22ac
-57581,	 // 0xe0ed
- 6648,	 // 0x19f8
-48056,	 // 0xbbb8
-57086,	 // 0xdefe
-48856,	 // 0xbed8
- 4875,	 // 0x130b
-48378,	 // 0xbcfa
-49949,	 // 0xc31d
-46608,	 // 0xb610
-52097,	 // 0xcb81
-58826,	 // 0xe5ca
-    4,	 // 0x0004
-58109,	 // 0xe2fd
-64750,	 // 0xfcee
- 6391,	 // 0x18f7
-54035,	 // 0xd313
-56301,	 // 0xdbed
- 1043,	 // 0x0413
- 5119,	 // 0x13ff
-55562,	 // 0xd90a
- 3584,	 // 0x0e00
-60104,	 // 0xeac8
-59354,	 // 0xe7da
-61177,	 // 0xeef9
-42705,	 // 0xa6d1
-64537,	 // 0xfc19
-  459,	 // 0x01cb
-65504,	 // 0xffe0
-59919,	 // 0xea0f
-56837,	 // 0xde05
- 2840,	 // 0x0b18
-63747,	 // 0xf903
- 9717,	 // 0x25f5
-60167,	 // 0xeb07
-65518,	 // 0xffee
-62699,	 // 0xf4eb
- 3580,	 // 0x0dfc
-64717,	 // 0xfccd
-  778,	 // 0x030a
- 4101,	 // 0x1005
-48397,	 // 0xbd0d
-50174,	 // 0xc3fe
-62469,	 // 0xf405
- 7889,	 // 0x1ed1
-61161,	 // 0xeee9
- 4875,	 // 0x130b
-56279,	 // 0xdbd7
-53475,	 // 0xd0e3
-63525,	 // 0xf825
-45275,	 // 0xb0db
-  260,	 // 0x0104
-46567,	 // 0xb5e7
-38926,	 // 0x980e
-55425,	 // 0xd881
-10458,	 // 0x28da
-  510,	 // 0x01fe
-60869,	 // 0xedc5
-  762,	 // 0x02fa
- 4353,	 // 0x1101
-63478,	 // 0xf7f6
-57860,	 // 0xe204
- 4834,	 // 0x12e2
- 4586,	 // 0x11ea
-60120,	 // 0xead8
- 7703,	 // 0x1e17
-57809,	 // 0xe1d1
-60914,	 // 0xedf2
-64010,	 // 0xfa0a
-60151,	 // 0xeaf7
- 4626,	 // 0x1212
-62438,	 // 0xf3e6
-  766,	 // 0x02fe
- 1532,	 // 0x05fc
-58616,	 // 0xe4f8
-  254,	 // 0x00fe
-63995,	 // 0xf9fb
-33030,	 // 0x8106
-64768,	 // 0xfd00
-63730,	 // 0xf8f2
-64255,	 // 0xfaff
- 2298,	 // 0x08fa
- 1034,	 // 0x040a
-63477,	 // 0xf7f5
- 3845,	 // 0x0f05
-62982,	 // 0xf606
-60154,	 // 0xeafa
-65017,	 // 0xfdf9
- 3069,	 // 0x0bfd
-60664,	 // 0xecf8
-65282,	 // 0xff02
-60667,	 // 0xecfb
-63209,	 // 0xf6e9
-63486,	 // 0xf7fe
-56054,	 // 0xdaf6
-64514,	 // 0xfc02
-58872,	 // 0xe5f8
-60157,	 // 0xeafd
-63699,	 // 0xf8d3
-  243,	 // 0x00f3
- 1526,	 // 0x05f6
-  487,	 // 0x01e7
-65023,	 // 0xfdff
- 1023,	 // 0x03ff
-61692,	 // 0xf0fc
-  773,	 // 0x0305
-65524,	 // 0xfff4
-65532,	 // 0xfffc
-61697,	 // 0xf101
-63495,	 // 0xf807
-64500,	 // 0xfbf4
- 3836,	 // 0x0efc
-64739,	 // 0xfce3
-60646,	 // 0xece6
-62928,	 // 0xf5d0
-64445,	 // 0xfbbd
-52951,	 // 0xced7
-65267,	 // 0xfef3
-55808,	 // 0xda00
-61655,	 // 0xf0d7
-65032,	 // 0xfe08
-36363,	 // 0x8e0b
-59065,	 // 0xe6b9
-62427,	 // 0xf3db
-54018,	 // 0xd302
- 1006,	 // 0x03ee
- 2809,	 // 0x0af9
- 3040,	 // 0x0be0
-60926,	 // 0xedfe
-45079,	 // 0xb017
-63746,	 // 0xf902
-  268,	 // 0x010c
-63154,	 // 0xf6b2
-63746,	 // 0xf902
-64271,	 // 0xfb0f
- 1260,	 // 0x04ec
- 3588,	 // 0x0e04
-64267,	 // 0xfb0b
-65006,	 // 0xfdee
-63475,	 // 0xf7f3
- 1515,	 // 0x05eb
-33278,	 // 0x81fe
-64153,	 // 0xfa99
-52177,	 // 0xcbd1
-  507,	 // 0x01fb
-61952,	 // 0xf200
-49368,	 // 0xc0d8
- 4598,	 // 0x11f6
- 1729,	 // 0x06c1
-63751,	 // 0xf907
-64521,	 // 0xfc09
-63503,	 // 0xf80f
-55769,	 // 0xd9d9
-63186,	 // 0xf6d2
-59148,	 // 0xe70c
-52688,	 // 0xcdd0
-64521,	 // 0xfc09
-61952,	 // 0xf200
-57088,	 // 0xdf00
-  237,	 // 0x00ed
-65519,	 // 0xffef
-60650,	 // 0xecea
-60905,	 // 0xede9
-63454,	 // 0xf7de
-63226,	 // 0xf6fa
-54781,	 // 0xd5fd
-60653,	 // 0xeced
- 5109,	 // 0x13f5
-48896,	 // 0xbf00
- 3276,	 // 0x0ccc
- 1025,	 // 0x0401
- 3056,	 // 0x0bf0
-60417,	 // 0xec01
- 4853,	 // 0x12f5
-64511,	 // 0xfbff
-62186,	 // 0xf2ea
- 4070,	 // 0x0fe6
-62712,	 // 0xf4f8
- 8958,	 // 0x22fe
-58351,	 // 0xe3ef
-64254,	 // 0xfafe
-61937,	 // 0xf1f1
- 5875,	 // 0x16f3
-51438,	 // 0xc8ee
-62192,	 // 0xf2f0
-33031,	 // 0x8107
-64459,	 // 0xfbcb
- 2811,	 // 0x0afb
- 3844,	 // 0x0f04
- 4879,	 // 0x130f
-55269,	 // 0xd7e5
-60930,	 // 0xee02
-64476,	 // 0xfbdc
-62719,	 // 0xf4ff
-60649,	 // 0xece9
-62987,	 // 0xf60b
-60402,	 // 0xebf2
-65014,	 // 0xfdf6
-61187,	 // 0xef03
-10217,	 // 0x27e9
-63734,	 // 0xf8f6
-58621,	 // 0xe4fd
-58844,	 // 0xe5dc
- 3542,	 // 0x0dd6
-64753,	 // 0xfcf1
-63462,	 // 0xf7e6
-55030,	 // 0xd6f6
-60106,	 // 0xeaca
-63744,	 // 0xf900
-44803,	 // 0xaf03
-63179,	 // 0xf6cb
- 3045,	 // 0x0be5
-52472,	 // 0xccf8
- 3032,	 // 0x0bd8
- 5358,	 // 0x14ee
- 5604,	 // 0x15e4
-  245,	 // 0x00f5
-63993,	 // 0xf9f9
-64263,	 // 0xfb07
-  745,	 // 0x02e9
- 4561,	 // 0x11d1
-60400,	 // 0xebf0
- 4887,	 // 0x1317
-65273,	 // 0xfef9
-59912,	 // 0xea08
-60412,	 // 0xebfc
- 1791,	 // 0x06ff
-48629,	 // 0xbdf5
-63222,	 // 0xf6f6
-33028,	 // 0x8104
-65440,	 // 0xffa0
-  244,	 // 0x00f4
- 2554,	 // 0x09fa
- 1806,	 // 0x070e
-51418,	 // 0xc8da
-62709,	 // 0xf4f5
-63450,	 // 0xf7da
-64515,	 // 0xfc03
-61181,	 // 0xeefd
-60697,	 // 0xed19
-55532,	 // 0xd8ec
-64750,	 // 0xfcee
-48911,	 // 0xbf0f
-14050,	 // 0x36e2
- 1006,	 // 0x03ee
-64242,	 // 0xfaf2
- 2510,	 // 0x09ce
- 4018,	 // 0x0fb2
-54494,	 // 0xd4de
- 5883,	 // 0x16fb
-53990,	 // 0xd2e6
-62147,	 // 0xf2c3
-64014,	 // 0xfa0e
-33278,	 // 0x81fe
-61630,	 // 0xf0be
-59620,	 // 0xe8e4
- 3338,	 // 0x0d0a
- 2272,	 // 0x08e0
- 3065,	 // 0x0bf9
- 1761,	 // 0x06e1
-65263,	 // 0xfeef
-35593,	 // 0x8b09
- 1778,	 // 0x06f2
-64023,	 // 0xfa17
- 1722,	 // 0x06ba
- 2281,	 // 0x08e9
-12304,	 // 0x3010
-64733,	 // 0xfcdd
-65516,	 // 0xffec
-64268,	 // 0xfb0c
-59375,	 // 0xe7ef
-48636,	 // 0xbdfc
-  500,	 // 0x01f4
-42501,	 // 0xa605
-62900,	 // 0xf5b4
-55525,	 // 0xd8e5
-63470,	 // 0xf7ee
-57585,	 // 0xe0f1
-53728,	 // 0xd1e0
- 1277,	 // 0x04fd
-64968,	 // 0xfdc8
- 4619,	 // 0x120b
-64511,	 // 0xfbff
- 2324,	 // 0x0914
-47848,	 // 0xbae8
-62717,	 // 0xf4fd
-52240,	 // 0xcc10
-49852,	 // 0xc2bc
-61216,	 // 0xef20
- 1267,	 // 0x04f3
- 8446,	 // 0x20fe
- 4580,	 // 0x11e4
-64746,	 // 0xfcea
-59880,	 // 0xe9e8
-55785,	 // 0xd9e9
-59848,	 // 0xe9c8
- 1782,	 // 0x06f6
-58094,	 // 0xe2ee
-62176,	 // 0xf2e0
- 5624,	 // 0x15f8
-55031,	 // 0xd6f7
- 4560,	 // 0x11d0
- 1503,	 // 0x05df
- 3305,	 // 0x0ce9
-62202,	 // 0xf2fa
- 4070,	 // 0x0fe6
-63213,	 // 0xf6ed
-64730,	 // 0xfcda
- 4580,	 // 0x11e4
-63717,	 // 0xf8e5
- 6669,	 // 0x1a0d
-61415,	 // 0xefe7
-63733,	 // 0xf8f5
-60643,	 // 0xece3
- 4108,	 // 0x100c
-46558,	 // 0xb5de
-64249,	 // 0xfaf9
-33278,	 // 0x81fe
-63177,	 // 0xf6c9
- 6144,	 // 0x1800
-65291,	 // 0xff0b
- 3322,	 // 0x0cfa
-59361,	 // 0xe7e1
-63244,	 // 0xf70c
-64736,	 // 0xfce0
-  262,	 // 0x0106
-62458,	 // 0xf3fa
-62989,	 // 0xf60d
-59920,	 // 0xea10
- 3319,	 // 0x0cf7
-56584,	 // 0xdd08
- 4068,	 // 0x0fe4
-62482,	 // 0xf412
-64492,	 // 0xfbec
- 5095,	 // 0x13e7
- 6610,	 // 0x19d2
-62699,	 // 0xf4eb
-64001,	 // 0xfa01
-53222,	 // 0xcfe6
-56524,	 // 0xdccc
-65032,	 // 0xfe08
-53487,	 // 0xd0ef
-62675,	 // 0xf4d3
- 1512,	 // 0x05e8
-62969,	 // 0xf5f9
- 3287,	 // 0x0cd7
- 4320,	 // 0x10e0
- 4589,	 // 0x11ed
- 4089,	 // 0x0ff9
-55551,	 // 0xd8ff
-61931,	 // 0xf1eb
-62195,	 // 0xf2f3
- 3544,	 // 0x0dd8
-63976,	 // 0xf9e8
- 9233,	 // 0x2411
- 3052,	 // 0x0bec
-59369,	 // 0xe7e9
-63216,	 // 0xf6f0
-57347,	 // 0xe003
-52718,	 // 0xcdee
-  511,	 // 0x01ff
-33279,	 // 0x81ff
-62414,	 // 0xf3ce
-  753,	 // 0x02f1
-  246,	 // 0x00f6
-63989,	 // 0xf9f5
-62686,	 // 0xf4de
-  509,	 // 0x01fd
-64482,	 // 0xfbe2
- 4365,	 // 0x110d
-65014,	 // 0xfdf6
-61969,	 // 0xf211
-57895,	 // 0xe227
- 2565,	 // 0x0a05
-43535,	 // 0xaa0f
- 4307,	 // 0x10d3
-60175,	 // 0xeb0f
- 3322,	 // 0x0cfa
-46099,	 // 0xb413
-65275,	 // 0xfefb
-63729,	 // 0xf8f1
-55289,	 // 0xd7f9
-60634,	 // 0xecda
-61426,	 // 0xeff2
-  746,	 // 0x02ea
-33257,	 // 0x81e9
-57836,	 // 0xe1ec
-62465,	 // 0xf401
-59129,	 // 0xe6f9
- 2318,	 // 0x090e
-63757,	 // 0xf90d
-  746,	 // 0x02ea
-59907,	 // 0xea03
- 2307,	 // 0x0903
-61426,	 // 0xeff2
-59665,	 // 0xe911
-  750,	 // 0x02ee
-64513,	 // 0xfc01
- 9715,	 // 0x25f3
-54504,	 // 0xd4e8
-60675,	 // 0xed03
-65525,	 // 0xfff5
-57325,	 // 0xdfed
-47594,	 // 0xb9ea
-62968,	 // 0xf5f8
-35834,	 // 0x8bfa
-65231,	 // 0xfecf
- 6136,	 // 0x17f8
-64258,	 // 0xfb02
- 1809,	 // 0x0711
-61927,	 // 0xf1e7
-58365,	 // 0xe3fd
-  180,	 // 0x00b4
- 1522,	 // 0x05f2
-64762,	 // 0xfcfa
- 1269,	 // 0x04f5
-62473,	 // 0xf409
-63720,	 // 0xf8e8
- 6167,	 // 0x1817
-65010,	 // 0xfdf2
-62985,	 // 0xf609
-59376,	 // 0xe7f0
- 9461,	 // 0x24f5
-62723,	 // 0xf503
-64521,	 // 0xfc09
- 4620,	 // 0x120c
-61403,	 // 0xefdb
-64260,	 // 0xfb04
- 5609,	 // 0x15e9
-44768,	 // 0xaee0
-62194,	 // 0xf2f2
-56587,	 // 0xdd0b
-61201,	 // 0xef11
-61123,	 // 0xeec3
-62473,	 // 0xf409
-61432,	 // 0xeff8
-60912,	 // 0xedf0
-58382,	 // 0xe40e
-63450,	 // 0xf7da
-54486,	 // 0xd4d6
-65015,	 // 0xfdf7
-65031,	 // 0xfe07
- 2499,	 // 0x09c3
-56561,	 // 0xdcf1
-52726,	 // 0xcdf6
- 4350,	 // 0x10fe
-52731,	 // 0xcdfb
-58610,	 // 0xe4f2
-62719,	 // 0xf4ff
-33249,	 // 0x81e1
-62394,	 // 0xf3ba
-65531,	 // 0xfffb
- 1264,	 // 0x04f0
-61206,	 // 0xef16
- 6135,	 // 0x17f7
-58632,	 // 0xe508
-58814,	 // 0xe5be
-63207,	 // 0xf6e7
- 4592,	 // 0x11f0
-59170,	 // 0xe722
-59625,	 // 0xe8e9
-62223,	 // 0xf30f
-63730,	 // 0xf8f2
- 7411,	 // 0x1cf3
-59401,	 // 0xe809
-64755,	 // 0xfcf3
-57602,	 // 0xe102
- 1025,	 // 0x0401
-62977,	 // 0xf601
-59918,	 // 0xea0e
-62424,	 // 0xf3d8
-63757,	 // 0xf90d
- 3054,	 // 0x0bee
-40674,	 // 0x9ee2
-61429,	 // 0xeff5
-57611,	 // 0xe10b
-63237,	 // 0xf705
-64212,	 // 0xfad4
-64274,	 // 0xfb12
-64490,	 // 0xfbea
-61957,	 // 0xf205
-52749,	 // 0xce0d
-62444,	 // 0xf3ec
-56857,	 // 0xde19
-  771,	 // 0x0303
-65282,	 // 0xff02
- 6863,	 // 0x1acf
-56291,	 // 0xdbe3
-53748,	 // 0xd1f4
-64508,	 // 0xfbfc
-48119,	 // 0xbbf7
-59126,	 // 0xe6f6
-60159,	 // 0xeaff
-33254,	 // 0x81e6
- 1997,	 // 0x07cd
- 3327,	 // 0x0cff
-63491,	 // 0xf803
-60946,	 // 0xee12
-65260,	 // 0xfeec
-57611,	 // 0xe10b
-60869,	 // 0xedc5
- 2026,	 // 0x07ea
- 2829,	 // 0x0b0d
-65277,	 // 0xfefd
-60918,	 // 0xedf6
-60915,	 // 0xedf3
- 6923,	 // 0x1b0b
- 5873,	 // 0x16f1
-  242,	 // 0x00f2
-63997,	 // 0xf9fd
- 3835,	 // 0x0efb
-64757,	 // 0xfcf5
- 1277,	 // 0x04fd
- 4612,	 // 0x1204
-60406,	 // 0xebf6
-65040,	 // 0xfe10
- 3062,	 // 0x0bf6
-33263,	 // 0x81ef
-65530,	 // 0xfffa
-63743,	 // 0xf8ff
-  765,	 // 0x02fd
-61150,	 // 0xeede
-65029,	 // 0xfe05
-61704,	 // 0xf108
-62698,	 // 0xf4ea
- 4101,	 // 0x1005
-60913,	 // 0xedf1
-59914,	 // 0xea0a
-  482,	 // 0x01e2
-  523,	 // 0x020b
-63480,	 // 0xf7f8
- 1797,	 // 0x0705
-61954,	 // 0xf202
- 3844,	 // 0x0f04
-63986,	 // 0xf9f2
-41964,	 // 0xa3ec
-63483,	 // 0xf7fb
-  757,	 // 0x02f5
-60894,	 // 0xedde
-63492,	 // 0xf804
- 4847,	 // 0x12ef
-65019,	 // 0xfdfb
- 4876,	 // 0x130c
-61424,	 // 0xeff0
-61123,	 // 0xeec3
-62462,	 // 0xf3fe
-63978,	 // 0xf9ea
-60427,	 // 0xec0b
-59900,	 // 0xe9fc
-63234,	 // 0xf702
-57346,	 // 0xe002
-62459,	 // 0xf3fb
- 3567,	 // 0x0def
-65517,	 // 0xffed
-   16,	 // 0x0010
-65525,	 // 0xfff5
- 1533,	 // 0x05fd
-64517,	 // 0xfc05
-59142,	 // 0xe706
-59647,	 // 0xe8ff
- 2323,	 // 0x0913
-33040,	 // 0x8110
-63483,	 // 0xf7fb
-64756,	 // 0xfcf4
-58354,	 // 0xe3f2
-  478,	 // 0x01de
- 2810,	 // 0x0afa
- 2295,	 // 0x08f7
-59900,	 // 0xe9fc
-  505,	 // 0x01f9
- 2300,	 // 0x08fc
- 2291,	 // 0x08f3
- 2536,	 // 0x09e8
-61427,	 // 0xeff3
-65529,	 // 0xfff9
-63228,	 // 0xf6fc
-63973,	 // 0xf9e5
- 1516,	 // 0x05ec
-61435,	 // 0xeffb
-58880,	 // 0xe600
-63987,	 // 0xf9f3
-33794,	 // 0x8402
-64506,	 // 0xfbfa
-63992,	 // 0xf9f8
- 6913,	 // 0x1b01
-60901,	 // 0xede5
- 3588,	 // 0x0e04
-63980,	 // 0xf9ec
-63205,	 // 0xf6e5
-60653,	 // 0xeced
-60911,	 // 0xedef
-60140,	 // 0xeaec
-62478,	 // 0xf40e
-62182,	 // 0xf2e6
-62458,	 // 0xf3fa
-64486,	 // 0xfbe6
- 2545,	 // 0x09f1
-65517,	 // 0xffed
- 3847,	 // 0x0f07
-63468,	 // 0xf7ec
- 3068,	 // 0x0bfc
- 2828,	 // 0x0b0c
-56823,	 // 0xddf7
-60673,	 // 0xed01
- 3061,	 // 0x0bf5
-33271,	 // 0x81f7
-60660,	 // 0xecf4
-65530,	 // 0xfffa
-62192,	 // 0xf2f0
-62657,	 // 0xf4c1
- 1274,	 // 0x04fa
-  501,	 // 0x01f5
-64757,	 // 0xfcf5
-62984,	 // 0xf608
-60929,	 // 0xee01
-63758,	 // 0xf90e
-62685,	 // 0xf4dd
-65276,	 // 0xfefc
-60669,	 // 0xecfd
-  769,	 // 0x0301
-62952,	 // 0xf5e8
-63980,	 // 0xf9ec
-58886,	 // 0xe606
-37875,	 // 0x93f3
-62441,	 // 0xf3e9
-38399,	 // 0x95ff
-63461,	 // 0xf7e5
-62227,	 // 0xf313
- 7172,	 // 0x1c04
-63959,	 // 0xf9d7
- 7703,	 // 0x1e17
-62439,	 // 0xf3e7
-63700,	 // 0xf8d4
-59132,	 // 0xe6fc
-60671,	 // 0xecff
-57578,	 // 0xe0ea
-60187,	 // 0xeb1b
-64995,	 // 0xfde3
-54789,	 // 0xd605
-  238,	 // 0x00ee
- 2795,	 // 0x0aeb
- 1770,	 // 0x06ea
- 2814,	 // 0x0afe
- 7143,	 // 0x1be7
-65010,	 // 0xfdf2
- 5632,	 // 0x1600
-58623,	 // 0xe4ff
-57538,	 // 0xe0c2
-60697,	 // 0xed19
-33038,	 // 0x810e
-64756,	 // 0xfcf4
-63190,	 // 0xf6d6
-  475,	 // 0x01db
- 2268,	 // 0x08dc
- 5885,	 // 0x16fd
- 6374,	 // 0x18e6
-60648,	 // 0xece8
-41708,	 // 0xa2ec
- 3307,	 // 0x0ceb
- 1044,	 // 0x0414
-12024,	 // 0x2ef8
-57810,	 // 0xe1d2
- 7687,	 // 0x1e07
- 3066,	 // 0x0bfa
-58849,	 // 0xe5e1
- 4587,	 // 0x11eb
-58859,	 // 0xe5eb
-49403,	 // 0xc0fb
- 3304,	 // 0x0ce8
-41483,	 // 0xa20b
-61619,	 // 0xf0b3
- 1257,	 // 0x04e9
- 6882,	 // 0x1ae2
-59111,	 // 0xe6e7
-60915,	 // 0xedf3
-60899,	 // 0xede3
-60125,	 // 0xeadd
-  505,	 // 0x01f9
- 1535,	 // 0x05ff
-62984,	 // 0xf608
-58345,	 // 0xe3e9
-64217,	 // 0xfad9
-53238,	 // 0xcff6
-51165,	 // 0xc7dd
-62709,	 // 0xf4f5
-65251,	 // 0xfee3
- 7162,	 // 0x1bfa
- 9452,	 // 0x24ec
- 6385,	 // 0x18f1
-59366,	 // 0xe7e6
-55274,	 // 0xd7ea
-65480,	 // 0xffc8
-58344,	 // 0xe3e8
-57326,	 // 0xdfee
-63723,	 // 0xf8eb
- 3549,	 // 0x0ddd
-56290,	 // 0xdbe2
- 4307,	 // 0x10d3
-64748,	 // 0xfcec
- 4078,	 // 0x0fee
-60398,	 // 0xebee
- 2536,	 // 0x09e8
-61164,	 // 0xeeec
-64720,	 // 0xfcd0
- 8422,	 // 0x20e6
-60902,	 // 0xede6
- 7673,	 // 0x1df9
-61673,	 // 0xf0e9
-64769,	 // 0xfd01
-64232,	 // 0xfae8
- 4607,	 // 0x11ff
-47346,	 // 0xb8f2
-61155,	 // 0xeee3
-33273,	 // 0x81f9
- 3275,	 // 0x0ccb
- 8955,	 // 0x22fb
- 2570,	 // 0x0a0a
- 5624,	 // 0x15f8
-56547,	 // 0xdce3
-57852,	 // 0xe1fc
-60129,	 // 0xeae1
- 4602,	 // 0x11fa
-62202,	 // 0xf2fa
- 2061,	 // 0x080d
-62733,	 // 0xf50d
-61674,	 // 0xf0ea
-54258,	 // 0xd3f2
- 4365,	 // 0x110d
-64252,	 // 0xfafc
-64745,	 // 0xfce9
- 2796,	 // 0x0aec
- 9974,	 // 0x26f6
- 3056,	 // 0x0bf0
-64763,	 // 0xfcfb
-54775,	 // 0xd5f7
-59340,	 // 0xe7cc
-60422,	 // 0xec06
-53495,	 // 0xd0f7
- 1509,	 // 0x05e5
- 6365,	 // 0x18dd
-63712,	 // 0xf8e0
- 2524,	 // 0x09dc
- 2020,	 // 0x07e4
- 6126,	 // 0x17ee
-  751,	 // 0x02ef
-55272,	 // 0xd7e8
-63477,	 // 0xf7f5
-61680,	 // 0xf0f0
-11250,	 // 0x2bf2
-59609,	 // 0xe8d9
- 9219,	 // 0x2403
- 1012,	 // 0x03f4
-56562,	 // 0xdcf2
- 1004,	 // 0x03ec
-57340,	 // 0xdffc
-52736,	 // 0xce00
-  240,	 // 0x00f0
-33029,	 // 0x8105
-  204,	 // 0x00cc
- 5867,	 // 0x16eb
- 5116,	 // 0x13fc
-65265,	 // 0xfef1
-56811,	 // 0xddeb
-56818,	 // 0xddf2
-58338,	 // 0xe3e2
- 6905,	 // 0x1af9
-63222,	 // 0xf6f6
-    6,	 // 0x0006
-57381,	 // 0xe025
-60672,	 // 0xed00
-44789,	 // 0xaef5
- 4343,	 // 0x10f7
-61181,	 // 0xeefd
- 2802,	 // 0x0af2
-44571,	 // 0xae1b
- 2300,	 // 0x08fc
- 5866,	 // 0x16ea
-55269,	 // 0xd7e5
-56791,	 // 0xddd7
- 1265,	 // 0x04f1
-55262,	 // 0xd7de
-33252,	 // 0x81e4
-59651,	 // 0xe903
-63208,	 // 0xf6e8
-59370,	 // 0xe7ea
- 4112,	 // 0x1010
-58630,	 // 0xe506
-63199,	 // 0xf6df
-60412,	 // 0xebfc
- 3326,	 // 0x0cfe
-64489,	 // 0xfbe9
-60944,	 // 0xee10
- 2020,	 // 0x07e4
-65274,	 // 0xfefa
-10987,	 // 0x2aeb
-56560,	 // 0xdcf0
-  503,	 // 0x01f7
-65265,	 // 0xfef1
-57064,	 // 0xdee8
-45572,	 // 0xb204
-61417,	 // 0xefe9
-34033,	 // 0x84f1
- 7372,	 // 0x1ccc
- 7926,	 // 0x1ef6
-64513,	 // 0xfc01
- 1798,	 // 0x0706
-58335,	 // 0xe3df
-57843,	 // 0xe1f3
-64422,	 // 0xfba6
- 2028,	 // 0x07ec
-60154,	 // 0xeafa
- 2281,	 // 0x08e9
-65038,	 // 0xfe0e
-65007,	 // 0xfdef
-64761,	 // 0xfcf9
-65039,	 // 0xfe0f
-57076,	 // 0xdef4
-60690,	 // 0xed12
- 8692,	 // 0x21f4
-    6,	 // 0x0006
-63220,	 // 0xf6f4
- 7940,	 // 0x1f04
-56026,	 // 0xdada
- 2564,	 // 0x0a04
-58078,	 // 0xe2de
-45798,	 // 0xb2e6
-55040,	 // 0xd700
-59390,	 // 0xe7fe
-60159,	 // 0xeaff
- 1217,	 // 0x04c1
-51464,	 // 0xc908
-59369,	 // 0xe7e9
-65511,	 // 0xffe7
-55812,	 // 0xda04
- 2281,	 // 0x08e9
-53719,	 // 0xd1d7
-64001,	 // 0xfa01
-  759,	 // 0x02f7
-  201,	 // 0x00c9
-55792,	 // 0xd9f0
-51948,	 // 0xcaec
-  477,	 // 0x01dd
-52978,	 // 0xcef2
-61451,	 // 0xf00b
-64014,	 // 0xfa0e
-33262,	 // 0x81ee
- 4796,	 // 0x12bc
-64755,	 // 0xfcf3
-64757,	 // 0xfcf5
-64262,	 // 0xfb06
- 2799,	 // 0x0aef
-63758,	 // 0xf90e
-64452,	 // 0xfbc4
-64983,	 // 0xfdd7
-64752,	 // 0xfcf0
-60683,	 // 0xed0b
-61415,	 // 0xefe7
- 2333,	 // 0x091d
- 2545,	 // 0x09f1
- 6146,	 // 0x1802
-58108,	 // 0xe2fc
-65534,	 // 0xfffe
-57086,	 // 0xdefe
- 4097,	 // 0x1001
- 2041,	 // 0x07f9
-62705,	 // 0xf4f1
-59350,	 // 0xe7d6
-  524,	 // 0x020c
-58346,	 // 0xe3ea
-42466,	 // 0xa5e2
-59406,	 // 0xe80e
-60414,	 // 0xebfe
-64760,	 // 0xfcf8
- 4054,	 // 0x0fd6
-57354,	 // 0xe00a
-60893,	 // 0xeddd
-63992,	 // 0xf9f8
-51206,	 // 0xc806
- 2804,	 // 0x0af4
-56101,	 // 0xdb25
-64761,	 // 0xfcf9
- 1026,	 // 0x0402
- 7377,	 // 0x1cd1
-57326,	 // 0xdfee
-54756,	 // 0xd5e4
-65267,	 // 0xfef3
-48624,	 // 0xbdf0
-59148,	 // 0xe70c
-61956,	 // 0xf204
-33257,	 // 0x81e9
- 6861,	 // 0x1acd
- 2544,	 // 0x09f0
-61949,	 // 0xf1fd
-62469,	 // 0xf405
-62696,	 // 0xf4e8
-61692,	 // 0xf0fc
-64706,	 // 0xfcc2
-63716,	 // 0xf8e4
-60685,	 // 0xed0d
- 2037,	 // 0x07f5
-61684,	 // 0xf0f4
-  253,	 // 0x00fd
- 5891,	 // 0x1703
- 5121,	 // 0x1401
-60921,	 // 0xedf9
-62996,	 // 0xf614
-10728,	 // 0x29e8
-  520,	 // 0x0208
-58607,	 // 0xe4ef
-13336,	 // 0x3418
-52718,	 // 0xcdee
- 5411,	 // 0x1523
-51684,	 // 0xc9e4
- 7151,	 // 0x1bef
-52196,	 // 0xcbe4
-57063,	 // 0xdee7
-62464,	 // 0xf400
-63691,	 // 0xf8cb
-38673,	 // 0x9711
-55009,	 // 0xd6e1
-62438,	 // 0xf3e6
- 5891,	 // 0x1703
-57581,	 // 0xe0ed
-54238,	 // 0xd3de
-65275,	 // 0xfefb
- 1520,	 // 0x05f0
-60188,	 // 0xeb1c
- 1545,	 // 0x0609
-56593,	 // 0xdd11
- 1256,	 // 0x04e8
- 6637,	 // 0x19ed
-40186,	 // 0x9cfa
-58371,	 // 0xe403
-43519,	 // 0xa9ff
- 2433,	 // 0x0981
- 5886,	 // 0x16fe
-64726,	 // 0xfcd6
- 1005,	 // 0x03ed
- 8963,	 // 0x2303
- 2813,	 // 0x0afd
-62875,	 // 0xf59b
-63201,	 // 0xf6e1
-65258,	 // 0xfeea
-49648,	 // 0xc1f0
-57865,	 // 0xe209
-  523,	 // 0x020b
-52457,	 // 0xcce9
-57365,	 // 0xe015
-63735,	 // 0xf8f7
-58354,	 // 0xe3f2
- 3088,	 // 0x0c10
-64503,	 // 0xfbf7
-61706,	 // 0xf10a
- 1050,	 // 0x041a
-54788,	 // 0xd604
-58062,	 // 0xe2ce
-   30,	 // 0x001e
- 6873,	 // 0x1ad9
-56821,	 // 0xddf5
-64757,	 // 0xfcf5
-55529,	 // 0xd8e9
-  954,	 // 0x03ba
-54023,	 // 0xd307
-62722,	 // 0xf502
- 2018,	 // 0x07e2
-63754,	 // 0xf90a
-11006,	 // 0x2afe
-57314,	 // 0xdfe2
-60950,	 // 0xee16
-53480,	 // 0xd0e8
-63765,	 // 0xf915
-63508,	 // 0xf814
- 1255,	 // 0x04e7
- 4340,	 // 0x10f4
-52491,	 // 0xcd0b
-58357,	 // 0xe3f5
-62221,	 // 0xf30d
-33065,	 // 0x8129
-59318,	 // 0xe7b6
- 5378,	 // 0x1502
-61408,	 // 0xefe0
-  224,	 // 0x00e0
-64744,	 // 0xfce8
-60910,	 // 0xedee
-63168,	 // 0xf6c0
-56057,	 // 0xdaf9
-62191,	 // 0xf2ef
-59364,	 // 0xe7e4
-64718,	 // 0xfcce
-56800,	 // 0xdde0
-61940,	 // 0xf1f4
-45306,	 // 0xb0fa
- 1532,	 // 0x05fc
-62480,	 // 0xf410
- 8205,	 // 0x200d
-62957,	 // 0xf5ed
-57856,	 // 0xe200
- 3352,	 // 0x0d18
-57592,	 // 0xe0f8
-61185,	 // 0xef01
-60162,	 // 0xeb02
-13295,	 // 0x33ef
-56568,	 // 0xdcf8
-63456,	 // 0xf7e0
-60660,	 // 0xecf4
-  454,	 // 0x01c6
-51711,	 // 0xc9ff
-58087,	 // 0xe2e7
-61427,	 // 0xeff3
-59653,	 // 0xe905
-62474,	 // 0xf40a
-57877,	 // 0xe215
-60166,	 // 0xeb06
-62448,	 // 0xf3f0
-64784,	 // 0xfd10
- 3607,	 // 0x0e17
-61673,	 // 0xf0e9
-64244,	 // 0xfaf4
-60925,	 // 0xedfd
-42237,	 // 0xa4fd
-59916,	 // 0xea0c
-33048,	 // 0x8118
-57283,	 // 0xdfc3
-  510,	 // 0x01fe
-  743,	 // 0x02e7
- 1002,	 // 0x03ea
- 3577,	 // 0x0df9
-62711,	 // 0xf4f7
-62400,	 // 0xf3c0
-57597,	 // 0xe0fd
-61198,	 // 0xef0e
-58862,	 // 0xe5ee
-59396,	 // 0xe804
-63715,	 // 0xf8e3
-56567,	 // 0xdcf7
- 5129,	 // 0x1409
-59629,	 // 0xe8ed
-  503,	 // 0x01f7
-11002,	 // 0x2afa
-60661,	 // 0xecf5
-65039,	 // 0xfe0f
- 8978,	 // 0x2312
-59135,	 // 0xe6ff
-64685,	 // 0xfcad
-58106,	 // 0xe2fa
-34037,	 // 0x84f5
-64517,	 // 0xfc05
- 1231,	 // 0x04cf
-55505,	 // 0xd8d1
-63424,	 // 0xf7c0
- 1306,	 // 0x051a
- 2030,	 // 0x07ee
- 2040,	 // 0x07f8
-46589,	 // 0xb5fd
-60400,	 // 0xebf0
-64496,	 // 0xfbf0
-63748,	 // 0xf904
-63481,	 // 0xf7f9
-62472,	 // 0xf408
-65231,	 // 0xfecf
-60898,	 // 0xede2
- 3049,	 // 0x0be9
-55005,	 // 0xd6dd
-53535,	 // 0xd11f
-  757,	 // 0x02f5
-33272,	 // 0x81f8
-56718,	 // 0xdd8e
-61703,	 // 0xf107
- 6074,	 // 0x17ba
-59873,	 // 0xe9e1
-60917,	 // 0xedf5
- 4823,	 // 0x12d7
-65485,	 // 0xffcd
-60154,	 // 0xeafa
-61440,	 // 0xf000
-62709,	 // 0xf4f5
-61467,	 // 0xf01b
-61168,	 // 0xeef0
-  281,	 // 0x0119
-48900,	 // 0xbf04
-52742,	 // 0xce06
-61453,	 // 0xf00d
- 9476,	 // 0x2504
-58117,	 // 0xe305
- 2814,	 // 0x0afe
-64268,	 // 0xfb0c
-58602,	 // 0xe4ea
- 3532,	 // 0x0dcc
-60678,	 // 0xed06
-50138,	 // 0xc3da
-65520,	 // 0xfff0
- 7370,	 // 0x1cca
-55527,	 // 0xd8e7
- 3261,	 // 0x0cbd
-64473,	 // 0xfbd9
-59632,	 // 0xe8f0
-63237,	 // 0xf705
-61378,	 // 0xefc2
-63986,	 // 0xf9f2
-65490,	 // 0xffd2
-62972,	 // 0xf5fc
-53005,	 // 0xcf0d
- 1802,	 // 0x070a
-59862,	 // 0xe9d6
-  766,	 // 0x02fe
-63971,	 // 0xf9e3
-57854,	 // 0xe1fe
-53748,	 // 0xd1f4
-63990,	 // 0xf9f6
-33279,	 // 0x81ff
-53173,	 // 0xcfb5
- 8706,	 // 0x2202
- 3593,	 // 0x0e09
-65525,	 // 0xfff5
- 4342,	 // 0x10f6
- 4581,	 // 0x11e5
- 1996,	 // 0x07cc
-  231,	 // 0x00e7
-61440,	 // 0xf000
-  287,	 // 0x011f
-62728,	 // 0xf508
-58331,	 // 0xe3db
-57059,	 // 0xdee3
-58133,	 // 0xe315
-53491,	 // 0xd0f3
-61970,	 // 0xf212
-16912,	 // 0x4210
-58380,	 // 0xe40c
-64272,	 // 0xfb10
-   16,	 // 0x0010
-58612,	 // 0xe4f4
- 2736,	 // 0x0ab0
-57358,	 // 0xe00e
-36326,	 // 0x8de6
-63472,	 // 0xf7f0
-10437,	 // 0x28c5
-50391,	 // 0xc4d7
-  731,	 // 0x02db
- 2013,	 // 0x07dd
-64744,	 // 0xfce8
- 5116,	 // 0x13fc
-48349,	 // 0xbcdd
-58101,	 // 0xe2f5
-65508,	 // 0xffe4
-62470,	 // 0xf406
-55789,	 // 0xd9ed
- 1044,	 // 0x0414
- 1997,	 // 0x07cd
-58847,	 // 0xe5df
- 1770,	 // 0x06ea
-49142,	 // 0xbff6
-52256,	 // 0xcc20
- 1523,	 // 0x05f3
-33272,	 // 0x81f8
-55207,	 // 0xd7a7
-62201,	 // 0xf2f9
- 7150,	 // 0x1bee
-61665,	 // 0xf0e1
-62437,	 // 0xf3e5
- 1505,	 // 0x05e1
-  477,	 // 0x01dd
- 2029,	 // 0x07ed
-62959,	 // 0xf5ef
-63239,	 // 0xf707
-61210,	 // 0xef1a
-61421,	 // 0xefed
-53234,	 // 0xcff2
-56838,	 // 0xde06
-    0,	 // 0x0000
-};
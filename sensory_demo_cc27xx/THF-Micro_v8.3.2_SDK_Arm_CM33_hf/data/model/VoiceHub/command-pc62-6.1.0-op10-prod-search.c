@@ -1,860 +0,0 @@
-/* Speech Recognition HMM Grammar file V62 for pc62 platform
- * Copyright (C) 2003-2022 Sensory, Inc. All Rights Reserved.
- * 
- *
- *            source: /tmp/tmp.hWpn9Ggwdv/trecs-en_US_12-13-6-0_0ffbd4a9d7b83946eebed70b249cfa4ebb845373.snsr
- *           created: Tue Nov 26 22:03:50 2024
- *   min lib version: 6.1.0
- *   operating point: 10
- *  production ready: yes
- *       license key: no
- *
- * Created by VoiceHub 2.11.3
- * Project: Toggle_on_and_off_LEDs_on_Launchpad_Example_command
- */
-
-#ifndef ALIGNED
-#ifndef _MSC_VER
-#define ALIGNED(x) __attribute__ ((aligned (x)))
-#else
-#define ALIGNED(x)
-#endif
-#endif
-
-const unsigned short gs_en_command_grammarLabel[] ALIGNED(4) = {
-   62,	 // 0x003e
-  217,	 // 0x00d9
-   69,	 // 0x0045
-    0,	 // 0x0000
-    2,	 // 0x0002
-   58,	 // 0x003a
-   32,	 // 0x0020
-    0,	 // 0x0000
-   32,	 // 0x0020
-  179,	 // 0x00b3
-  208,	 // 0x00d0
- 1000,	 // 0x03e8
-    0,	 // 0x0000
-   27,	 // 0x001b
-  200,	 // 0x00c8
- 1000,	 // 0x03e8
-  300,	 // 0x012c
-    2,	 // 0x0002
-   96,	 // 0x0060
-   32,	 // 0x0020
-    3,	 // 0x0003
-    3,	 // 0x0003
-   69,	 // 0x0045
-   69,	 // 0x0045
-    5,	 // 0x0005
-    2,	 // 0x0002
-    0,	 // 0x0000
-    5,	 // 0x0005
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-28771,	 // 0x7063
-  102,	 // 0x0066
-  106,	 // 0x006a
-  298,	 // 0x012a
-  362,	 // 0x016a
-  368,	 // 0x0170
-  374,	 // 0x0176
-  512,	 // 0x0200
-  650,	 // 0x028a
-  670,	 // 0x029e
-    0,	 // 0x0000
-  686,	 // 0x02ae
-  696,	 // 0x02b8
-  704,	 // 0x02c0
-    0,	 // 0x0000
-  980,	 // 0x03d4
- 2800,	 // 0x0af0
- 2700,	 // 0x0a8c
-    2,	 // 0x0002
-32769,	 // 0x8001
-    1,	 // 0x0001
-32768,	 // 0x8000
-    5,	 // 0x0005
-32772,	 // 0x8004
-    4,	 // 0x0004
-32771,	 // 0x8003
-    8,	 // 0x0008
-32775,	 // 0x8007
-    5,	 // 0x0005
-32770,	 // 0x8002
-    7,	 // 0x0007
-32774,	 // 0x8006
-   11,	 // 0x000b
-32778,	 // 0x800a
-   10,	 // 0x000a
-32777,	 // 0x8009
-   19,	 // 0x0013
-32784,	 // 0x8010
-   18,	 // 0x0012
-32783,	 // 0x800f
-   20,	 // 0x0014
-32785,	 // 0x8011
-   15,	 // 0x000f
-32781,	 // 0x800d
-   16,	 // 0x0010
-32780,	 // 0x800c
-   17,	 // 0x0011
-32782,	 // 0x800e
-   24,	 // 0x0018
-32790,	 // 0x8016
-   20,	 // 0x0014
-32787,	 // 0x8013
-   28,	 // 0x001c
-32794,	 // 0x801a
-   22,	 // 0x0016
-32789,	 // 0x8015
-   29,	 // 0x001d
-32795,	 // 0x801b
-   26,	 // 0x001a
-32791,	 // 0x8017
-   27,	 // 0x001b
-32793,	 // 0x8019
-   34,	 // 0x0022
-32800,	 // 0x8020
-   36,	 // 0x0024
-32801,	 // 0x8021
-   32,	 // 0x0020
-32798,	 // 0x801e
-   39,	 // 0x0027
-32805,	 // 0x8025
-   33,	 // 0x0021
-32799,	 // 0x801f
-   43,	 // 0x002b
-32808,	 // 0x8028
-   37,	 // 0x0025
-32803,	 // 0x8023
-   44,	 // 0x002c
-32810,	 // 0x802a
-   40,	 // 0x0028
-32806,	 // 0x8026
-   42,	 // 0x002a
-32809,	 // 0x8029
-   49,	 // 0x0031
-32816,	 // 0x8030
-   50,	 // 0x0032
-32815,	 // 0x802f
-   48,	 // 0x0030
-32813,	 // 0x802d
-   47,	 // 0x002f
-32814,	 // 0x802e
-   56,	 // 0x0038
-32821,	 // 0x8035
-   55,	 // 0x0037
-32822,	 // 0x8036
-   54,	 // 0x0036
-32820,	 // 0x8034
-   53,	 // 0x0035
-32819,	 // 0x8033
-   62,	 // 0x003e
-32827,	 // 0x803b
-   61,	 // 0x003d
-32828,	 // 0x803c
-   60,	 // 0x003c
-32826,	 // 0x803a
-   59,	 // 0x003b
-32825,	 // 0x8039
-   67,	 // 0x0043
-32833,	 // 0x8041
-   68,	 // 0x0044
-32834,	 // 0x8042
-   65,	 // 0x0041
-32831,	 // 0x803f
-   66,	 // 0x0042
-32832,	 // 0x8040
-  116,	 // 0x0074
-  111,	 // 0x006f
-  103,	 // 0x0067
-  103,	 // 0x0067
-  108,	 // 0x006c
-  101,	 // 0x0065
-   95,	 // 0x005f
-  103,	 // 0x0067
-  114,	 // 0x0072
-  101,	 // 0x0065
-  101,	 // 0x0065
-  110,	 // 0x006e
-   95,	 // 0x005f
-  108,	 // 0x006c
-  101,	 // 0x0065
-  100,	 // 0x0064
-    0,	 // 0x0000
-  116,	 // 0x0074
-  111,	 // 0x006f
-  103,	 // 0x0067
-  103,	 // 0x0067
-  108,	 // 0x006c
-  101,	 // 0x0065
-   95,	 // 0x005f
-  114,	 // 0x0072
-  101,	 // 0x0065
-  100,	 // 0x0064
-   95,	 // 0x005f
-  108,	 // 0x006c
-  101,	 // 0x0065
-  100,	 // 0x0064
-    0,	 // 0x0000
-   68,	 // 0x0044
-   67,	 // 0x0043
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-   17,	 // 0x0011
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
-22144,	 // 0x5680
- 3664,	 // 0x0e50
- 2891,	 // 0x0b4b
- 3104,	 // 0x0c20
- 3735,	 // 0x0e97
- 2632,	 // 0x0a48
- 3261,	 // 0x0cbd
- 3192,	 // 0x0c78
- 2669,	 // 0x0a6d
- 2960,	 // 0x0b90
- 2795,	 // 0x0aeb
- 2809,	 // 0x0af9
- 2767,	 // 0x0acf
- 3369,	 // 0x0d29
- 2645,	 // 0x0a55
- 3494,	 // 0x0da6
- 2518,	 // 0x09d6
- 2727,	 // 0x0aa7
- 2505,	 // 0x09c9
- 2594,	 // 0x0a22
- 2934,	 // 0x0b76
- 3128,	 // 0x0c38
- 3062,	 // 0x0bf6
- 2786,	 // 0x0ae2
- 2547,	 // 0x09f3
- 2971,	 // 0x0b9b
- 2806,	 // 0x0af6
- 2541,	 // 0x09ed
- 2830,	 // 0x0b0e
- 2664,	 // 0x0a68
- 2735,	 // 0x0aaf
- 2618,	 // 0x0a3a
- 2747,	 // 0x0abb
- 2545,	 // 0x09f1
- 3017,	 // 0x0bc9
- 2671,	 // 0x0a6f
- 2678,	 // 0x0a76
- 3076,	 // 0x0c04
- 2705,	 // 0x0a91
- 3140,	 // 0x0c44
- 2792,	 // 0x0ae8
- 3104,	 // 0x0c20
- 2802,	 // 0x0af2
- 2976,	 // 0x0ba0
- 3133,	 // 0x0c3d
- 3025,	 // 0x0bd1
- 3156,	 // 0x0c54
- 3034,	 // 0x0bda
- 2938,	 // 0x0b7a
- 3094,	 // 0x0c16
- 3272,	 // 0x0cc8
- 3095,	 // 0x0c17
- 3458,	 // 0x0d82
- 3248,	 // 0x0cb0
- 3440,	 // 0x0d70
- 3213,	 // 0x0c8d
- 3253,	 // 0x0cb5
- 3437,	 // 0x0d6d
- 3410,	 // 0x0d52
- 3256,	 // 0x0cb8
- 3423,	 // 0x0d5f
- 3297,	 // 0x0ce1
- 3511,	 // 0x0db7
- 3618,	 // 0x0e22
- 3450,	 // 0x0d7a
- 3553,	 // 0x0de1
- 3252,	 // 0x0cb4
- 3346,	 // 0x0d12
- 3106,	 // 0x0c22
- 3191,	 // 0x0c77
-    1,	 // 0x0001
-    2,	 // 0x0002
-    1,	 // 0x0001
-    3,	 // 0x0003
-    1,	 // 0x0001
-    4,	 // 0x0004
-    1,	 // 0x0001
-    5,	 // 0x0005
-    1,	 // 0x0001
-    6,	 // 0x0006
-  173,	 // 0x00ad
-    1,	 // 0x0001
-    3,	 // 0x0003
-    1,	 // 0x0001
-  173,	 // 0x00ad
-    1,	 // 0x0001
-    3,	 // 0x0003
-    2,	 // 0x0002
-   14,	 // 0x000e
-   12,	 // 0x000c
-    3,	 // 0x0003
-    0,	 // 0x0000
-65535,	 // 0xffff
- 3672,	 // 0x0e58
- 3672,	 // 0x0e58
- 3672,	 // 0x0e58
- 3672,	 // 0x0e58
-   32,	 // 0x0020
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  128,	 // 0x0080
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  118,	 // 0x0076
-   34,	 // 0x0022
-  184,	 // 0x00b8
-   32,	 // 0x0020
-  128,	 // 0x0080
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  232,	 // 0x00e8
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  118,	 // 0x0076
-   30,	 // 0x001e
-  196,	 // 0x00c4
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   40,	 // 0x0028
-  143,	 // 0x008f
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   30,	 // 0x001e
-  196,	 // 0x00c4
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   39,	 // 0x0027
-  172,	 // 0x00ac
-   39,	 // 0x0027
-  172,	 // 0x00ac
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   40,	 // 0x0028
-  143,	 // 0x008f
-   40,	 // 0x0028
-  143,	 // 0x008f
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  233,	 // 0x00e9
-   32,	 // 0x0020
-  233,	 // 0x00e9
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   33,	 // 0x0021
-  171,	 // 0x00ab
-   33,	 // 0x0021
-  171,	 // 0x00ab
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   25,	 // 0x0019
-    0,	 // 0x0000
-    9,	 // 0x0009
-32768,	 // 0x8000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-    8,	 // 0x0008
-    2,	 // 0x0002
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-    7,	 // 0x0007
-    6,	 // 0x0006
-32770,	 // 0x8002
-   25,	 // 0x0019
-    0,	 // 0x0000
-   12,	 // 0x000c
-32772,	 // 0x8004
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-   11,	 // 0x000b
-    5,	 // 0x0005
-    3,	 // 0x0003
-    0,	 // 0x0000
-    1,	 // 0x0001
-   10,	 // 0x000a
-    6,	 // 0x0006
-32774,	 // 0x8006
-   16,	 // 0x0010
-    0,	 // 0x0000
-   15,	 // 0x000f
-32776,	 // 0x8008
-32778,	 // 0x800a
-    0,	 // 0x0000
-    1,	 // 0x0001
-   14,	 // 0x000e
-    8,	 // 0x0008
-    6,	 // 0x0006
-    0,	 // 0x0000
-    0,	 // 0x0000
-   13,	 // 0x000d
-    9,	 // 0x0009
-32780,	 // 0x800c
-   16,	 // 0x0010
-    2,	 // 0x0002
-   24,	 // 0x0018
-32782,	 // 0x800e
-    8,	 // 0x0008
-    0,	 // 0x0000
-    1,	 // 0x0001
-   23,	 // 0x0017
-   11,	 // 0x000b
-    9,	 // 0x0009
-    0,	 // 0x0000
-    2,	 // 0x0002
-   22,	 // 0x0016
-   13,	 // 0x000d
-32784,	 // 0x8010
-   25,	 // 0x0019
-    1,	 // 0x0001
-   37,	 // 0x0025
-32786,	 // 0x8012
-65535,	 // 0xffff
-   16,	 // 0x0010
-    2,	 // 0x0002
-   30,	 // 0x001e
-32788,	 // 0x8014
-   11,	 // 0x000b
-   25,	 // 0x0019
-    1,	 // 0x0001
-   34,	 // 0x0022
-32790,	 // 0x8016
-65535,	 // 0xffff
-    0,	 // 0x0000
-    2,	 // 0x0002
-   29,	 // 0x001d
-   18,	 // 0x0012
-   13,	 // 0x000d
-    0,	 // 0x0000
-    0,	 // 0x0000
-   39,	 // 0x0027
-   19,	 // 0x0013
-   12,	 // 0x000c
-    0,	 // 0x0000
-    1,	 // 0x0001
-   36,	 // 0x0024
-   20,	 // 0x0014
-   14,	 // 0x000e
-    0,	 // 0x0000
-    2,	 // 0x0002
-   28,	 // 0x001c
-   23,	 // 0x0017
-32792,	 // 0x8018
-    0,	 // 0x0000
-    1,	 // 0x0001
-   38,	 // 0x0026
-   21,	 // 0x0015
-32794,	 // 0x801a
-    0,	 // 0x0000
-    1,	 // 0x0001
-   35,	 // 0x0023
-   21,	 // 0x0015
-32796,	 // 0x801c
-   16,	 // 0x0010
-    0,	 // 0x0000
-   40,	 // 0x0028
-32798,	 // 0x801e
-32800,	 // 0x8020
-    0,	 // 0x0000
-    1,	 // 0x0001
-   42,	 // 0x002a
-   24,	 // 0x0018
-   21,	 // 0x0015
-   16,	 // 0x0010
-    3,	 // 0x0003
-   21,	 // 0x0015
-32802,	 // 0x8022
-   18,	 // 0x0012
-    0,	 // 0x0000
-    0,	 // 0x0000
-   41,	 // 0x0029
-   25,	 // 0x0019
-32804,	 // 0x8024
-   16,	 // 0x0010
-    2,	 // 0x0002
-   43,	 // 0x002b
-32806,	 // 0x8026
-   24,	 // 0x0018
-    0,	 // 0x0000
-    3,	 // 0x0003
-   20,	 // 0x0014
-   28,	 // 0x001c
-   23,	 // 0x0017
-    0,	 // 0x0000
-    1,	 // 0x0001
-   45,	 // 0x002d
-   29,	 // 0x001d
-   25,	 // 0x0019
-    0,	 // 0x0000
-    3,	 // 0x0003
-   19,	 // 0x0013
-   31,	 // 0x001f
-32808,	 // 0x8028
-    0,	 // 0x0000
-    2,	 // 0x0002
-   44,	 // 0x002c
-   30,	 // 0x001e
-32810,	 // 0x802a
-   16,	 // 0x0010
-    1,	 // 0x0001
-   46,	 // 0x002e
-32812,	 // 0x802c
-   29,	 // 0x001d
-   16,	 // 0x0010
-    2,	 // 0x0002
-    3,	 // 0x0003
-32814,	 // 0x802e
-   28,	 // 0x001c
-    0,	 // 0x0000
-    0,	 // 0x0000
-   48,	 // 0x0030
-   34,	 // 0x0022
-   30,	 // 0x001e
-    0,	 // 0x0000
-    3,	 // 0x0003
-    2,	 // 0x0002
-   36,	 // 0x0024
-   31,	 // 0x001f
-    0,	 // 0x0000
-    1,	 // 0x0001
-   47,	 // 0x002f
-   35,	 // 0x0023
-32816,	 // 0x8030
-   16,	 // 0x0010
-    0,	 // 0x0000
-   49,	 // 0x0031
-32818,	 // 0x8032
-   34,	 // 0x0022
-    0,	 // 0x0000
-    2,	 // 0x0002
-    1,	 // 0x0001
-   38,	 // 0x0026
-32820,	 // 0x8034
-    0,	 // 0x0000
-    1,	 // 0x0001
-   51,	 // 0x0033
-   39,	 // 0x0027
-   35,	 // 0x0023
-   16,	 // 0x0010
-    1,	 // 0x0001
-   18,	 // 0x0012
-32822,	 // 0x8036
-   36,	 // 0x0024
-    0,	 // 0x0000
-    0,	 // 0x0000
-   50,	 // 0x0032
-   41,	 // 0x0029
-32824,	 // 0x8038
-    0,	 // 0x0000
-    2,	 // 0x0002
-   17,	 // 0x0011
-   43,	 // 0x002b
-   38,	 // 0x0026
-   16,	 // 0x0010
-    2,	 // 0x0002
-   52,	 // 0x0034
-32826,	 // 0x803a
-   39,	 // 0x0027
-    0,	 // 0x0000
-    3,	 // 0x0003
-   54,	 // 0x0036
-   44,	 // 0x002c
-   41,	 // 0x0029
-    0,	 // 0x0000
-    1,	 // 0x0001
-   16,	 // 0x0010
-   45,	 // 0x002d
-32828,	 // 0x803c
-    0,	 // 0x0000
-    2,	 // 0x0002
-   53,	 // 0x0035
-   46,	 // 0x002e
-32830,	 // 0x803e
-   16,	 // 0x0010
-    2,	 // 0x0002
-   27,	 // 0x001b
-32832,	 // 0x8040
-   43,	 // 0x002b
-   16,	 // 0x0010
-    2,	 // 0x0002
-   27,	 // 0x001b
-32834,	 // 0x8042
-   44,	 // 0x002c
-    0,	 // 0x0000
-    1,	 // 0x0001
-   26,	 // 0x001a
-   50,	 // 0x0032
-   46,	 // 0x002e
-    0,	 // 0x0000
-    1,	 // 0x0001
-   26,	 // 0x001a
-   49,	 // 0x0031
-   45,	 // 0x002d
-    0,	 // 0x0000
-    2,	 // 0x0002
-   25,	 // 0x0019
-   51,	 // 0x0033
-32836,	 // 0x8044
-    0,	 // 0x0000
-    2,	 // 0x0002
-   25,	 // 0x0019
-   52,	 // 0x0034
-32838,	 // 0x8046
-   16,	 // 0x0010
-    1,	 // 0x0001
-   55,	 // 0x0037
-32840,	 // 0x8048
-   49,	 // 0x0031
-   16,	 // 0x0010
-    1,	 // 0x0001
-   55,	 // 0x0037
-32842,	 // 0x804a
-   50,	 // 0x0032
-    0,	 // 0x0000
-    2,	 // 0x0002
-   57,	 // 0x0039
-   56,	 // 0x0038
-   51,	 // 0x0033
-    0,	 // 0x0000
-    2,	 // 0x0002
-   57,	 // 0x0039
-   55,	 // 0x0037
-   52,	 // 0x0034
-    0,	 // 0x0000
-    1,	 // 0x0001
-   56,	 // 0x0038
-   58,	 // 0x003a
-32844,	 // 0x804c
-    0,	 // 0x0000
-    1,	 // 0x0001
-   56,	 // 0x0038
-   57,	 // 0x0039
-32846,	 // 0x804e
-   16,	 // 0x0010
-    3,	 // 0x0003
-    6,	 // 0x0006
-32848,	 // 0x8050
-   56,	 // 0x0038
-   16,	 // 0x0010
-    3,	 // 0x0003
-    6,	 // 0x0006
-32850,	 // 0x8052
-   55,	 // 0x0037
-    0,	 // 0x0000
-    4,	 // 0x0004
-    5,	 // 0x0005
-   62,	 // 0x003e
-   57,	 // 0x0039
-    0,	 // 0x0000
-    4,	 // 0x0004
-    5,	 // 0x0005
-   61,	 // 0x003d
-   58,	 // 0x003a
-    0,	 // 0x0000
-    3,	 // 0x0003
-    4,	 // 0x0004
-   63,	 // 0x003f
-32852,	 // 0x8054
-    0,	 // 0x0000
-    3,	 // 0x0003
-    4,	 // 0x0004
-   64,	 // 0x0040
-32854,	 // 0x8056
-   16,	 // 0x0010
-    2,	 // 0x0002
-   33,	 // 0x0021
-32856,	 // 0x8058
-   61,	 // 0x003d
-   16,	 // 0x0010
-    2,	 // 0x0002
-   33,	 // 0x0021
-32858,	 // 0x805a
-   62,	 // 0x003e
-    0,	 // 0x0000
-    1,	 // 0x0001
-   32,	 // 0x0020
-   67,	 // 0x0043
-   63,	 // 0x003f
-    0,	 // 0x0000
-    1,	 // 0x0001
-   32,	 // 0x0020
-   68,	 // 0x0044
-   64,	 // 0x0040
-    0,	 // 0x0000
-    2,	 // 0x0002
-   31,	 // 0x001f
-65535,	 // 0xffff
-32860,	 // 0x805c
-    0,	 // 0x0000
-    2,	 // 0x0002
-   31,	 // 0x001f
-65535,	 // 0xffff
-32862,	 // 0x805e
-};
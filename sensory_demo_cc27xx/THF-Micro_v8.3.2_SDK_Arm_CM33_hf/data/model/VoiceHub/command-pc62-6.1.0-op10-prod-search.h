@@ -13,11 +13,14 @@
  * Project: Toggle_on_and_off_LEDs_on_Launchpad_Example_command
  */
 
-#ifndef CMDLABELEN
-#define CMDLABELEN
-extern const unsigned short gs_en_command_grammarLabel[];
-extern const unsigned short dnn_en_command_netLabel[];
-#endif
+/* Generated by tools/model_c2bin.py, do not edit. The data is in the .bin
+ * files next to this header, embedded by models.S. */
+
+#ifndef __COMMAND_PC62_6_1_0_OP10_PROD_SEARCH_H__
+#define __COMMAND_PC62_6_1_0_OP10_PROD_SEARCH_H__
+
+extern const unsigned short gs_en_command_grammarLabel[835];
+extern const unsigned short dnn_en_command_netLabel[33744];
 
 /* The following phrases (Hex format) correspond to the word IDs emitted by the recognizer. */
 #define COMMAND_PHRASE_COUNT 4
@@ -25,3 +28,6 @@ extern const unsigned short dnn_en_command_netLabel[];
 #define COMMAND_PHRASE_1 "\x74\x6F\x67\x67\x6C\x65\x5F\x67\x72\x65\x65\x6E\x5F\x6C\x65\x64"	/* Phrase: toggle_green_led */
 #define COMMAND_PHRASE_2 "\x74\x6F\x67\x67\x6C\x65\x5F\x72\x65\x64\x5F\x6C\x65\x64"	/* Phrase: toggle_red_led */
 #define COMMAND_PHRASE_3 "nota"	/* Legacy system phrase */
+#define COMMAND_PHRASES { COMMAND_PHRASE_0, COMMAND_PHRASE_1, COMMAND_PHRASE_2, COMMAND_PHRASE_3 }
+
+#endif // __COMMAND_PC62_6_1_0_OP10_PROD_SEARCH_H__
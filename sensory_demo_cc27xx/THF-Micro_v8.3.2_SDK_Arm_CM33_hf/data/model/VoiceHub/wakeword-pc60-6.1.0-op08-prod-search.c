@@ -1,434 +0,0 @@
-/* Speech Recognition HMM Grammar file V60 for pc60 platform
- * Copyright (C) 2003-2022 Sensory, Inc. All Rights Reserved.
- * 
- *
- *            source: /tmp/tmp.W4ChnvM4au/sensory-thf-enUS-voice_genie-e2aa3f897.snsr
- *           created: Fri Oct 11 17:40:23 2024
- *   min lib version: 6.1.0
- *   operating point: 8
- *  production ready: yes
- *       license key: no
- *
- * Created by VoiceHub 2.10.0
- * Project: Door_Lock_and_Unlock_in_English_wakeword
- */
-
-#ifndef ALIGNED
-#ifndef _MSC_VER
-#define ALIGNED(x) __attribute__ ((aligned (x)))
-#else
-#define ALIGNED(x)
-#endif
-#endif
-
-const unsigned short gs_wakeword_grammarLabel[] ALIGNED(4) = {
-   60,	 // 0x003c
-  217,	 // 0x00d9
-   30,	 // 0x001e
-    0,	 // 0x0000
-    1,	 // 0x0001
-   33,	 // 0x0021
-   32,	 // 0x0020
-    0,	 // 0x0000
-   32,	 // 0x0020
-   51,	 // 0x0033
-  195,	 // 0x00c3
- 1000,	 // 0x03e8
-    0,	 // 0x0000
-   27,	 // 0x001b
-  200,	 // 0x00c8
- 1000,	 // 0x03e8
-   90,	 // 0x005a
-    2,	 // 0x0002
-   50,	 // 0x0032
-   12,	 // 0x000c
-    3,	 // 0x0003
-    2,	 // 0x0002
-   30,	 // 0x001e
-   30,	 // 0x001e
-    6,	 // 0x0006
-    1,	 // 0x0001
-    0,	 // 0x0000
-    2,	 // 0x0002
-    4,	 // 0x0004
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-28771,	 // 0x7063
-  102,	 // 0x0066
-  106,	 // 0x006a
-  206,	 // 0x00ce
-  230,	 // 0x00e6
-  236,	 // 0x00ec
-  240,	 // 0x00f0
-  300,	 // 0x012c
-  360,	 // 0x0168
-  384,	 // 0x0180
-    0,	 // 0x0000
-  392,	 // 0x0188
-  396,	 // 0x018c
-  398,	 // 0x018e
-    0,	 // 0x0000
-  518,	 // 0x0206
-  630,	 // 0x0276
-  630,	 // 0x0276
-    2,	 // 0x0002
-32769,	 // 0x8001
-    1,	 // 0x0001
-32768,	 // 0x8000
-    5,	 // 0x0005
-32772,	 // 0x8004
-    7,	 // 0x0007
-32774,	 // 0x8006
-    4,	 // 0x0004
-32771,	 // 0x8003
-   10,	 // 0x000a
-32776,	 // 0x8008
-   11,	 // 0x000b
-32777,	 // 0x8009
-    8,	 // 0x0008
-32774,	 // 0x8006
-    9,	 // 0x0009
-32775,	 // 0x8007
-   14,	 // 0x000e
-32781,	 // 0x800d
-   11,	 // 0x000b
-32778,	 // 0x800a
-   18,	 // 0x0012
-32783,	 // 0x800f
-   13,	 // 0x000d
-32780,	 // 0x800c
-   17,	 // 0x0011
-32784,	 // 0x8010
-   16,	 // 0x0010
-32783,	 // 0x800f
-   20,	 // 0x0014
-32787,	 // 0x8013
-   17,	 // 0x0011
-32782,	 // 0x800e
-   19,	 // 0x0013
-32786,	 // 0x8012
-   23,	 // 0x0017
-32790,	 // 0x8016
-   25,	 // 0x0019
-32792,	 // 0x8018
-   22,	 // 0x0016
-32789,	 // 0x8015
-   28,	 // 0x001c
-32794,	 // 0x801a
-   29,	 // 0x001d
-32795,	 // 0x801b
-   26,	 // 0x001a
-32792,	 // 0x8018
-   27,	 // 0x001b
-32793,	 // 0x8019
-  118,	 // 0x0076
-  111,	 // 0x006f
-  105,	 // 0x0069
-   99,	 // 0x0063
-  101,	 // 0x0065
-   95,	 // 0x005f
-  103,	 // 0x0067
-  101,	 // 0x0065
-  110,	 // 0x006e
-  105,	 // 0x0069
-  101,	 // 0x0065
-    0,	 // 0x0000
-   29,	 // 0x001d
-   28,	 // 0x001c
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
-17024,	 // 0x4280
- 2863,	 // 0x0b2f
- 1697,	 // 0x06a1
- 2187,	 // 0x088b
- 2134,	 // 0x0856
- 1310,	 // 0x051e
- 1807,	 // 0x070f
- 1429,	 // 0x0595
- 1515,	 // 0x05eb
- 1549,	 // 0x060d
- 1430,	 // 0x0596
- 1218,	 // 0x04c2
- 1496,	 // 0x05d8
- 1358,	 // 0x054e
- 1471,	 // 0x05bf
- 1456,	 // 0x05b0
- 2089,	 // 0x0829
- 1954,	 // 0x07a2
- 1890,	 // 0x0762
- 1236,	 // 0x04d4
- 1211,	 // 0x04bb
- 1304,	 // 0x0518
- 1479,	 // 0x05c7
- 1554,	 // 0x0612
- 1676,	 // 0x068c
- 1789,	 // 0x06fd
- 1591,	 // 0x0637
- 1313,	 // 0x0521
- 1355,	 // 0x054b
- 1446,	 // 0x05a6
- 1323,	 // 0x052b
-    1,	 // 0x0001
-    5,	 // 0x0005
-    1,	 // 0x0001
-    4,	 // 0x0004
-    1,	 // 0x0001
-    3,	 // 0x0003
-    1,	 // 0x0001
-    2,	 // 0x0002
-    1,	 // 0x0001
-    7,	 // 0x0007
-    2,	 // 0x0002
-    7,	 // 0x0007
-  133,	 // 0x0085
-    1,	 // 0x0001
-    5,	 // 0x0005
-    1,	 // 0x0001
-    0,	 // 0x0000
-65535,	 // 0xffff
- 4127,	 // 0x101f
-   34,	 // 0x0022
-  232,	 // 0x00e8
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  184,	 // 0x00b8
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-   34,	 // 0x0022
-  232,	 // 0x00e8
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   46,	 // 0x002e
-  212,	 // 0x00d4
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-   80,	 // 0x0050
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   50,	 // 0x0032
-  310,	 // 0x0136
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   72,	 // 0x0048
-  335,	 // 0x014f
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   35,	 // 0x0023
-  118,	 // 0x0076
-   33,	 // 0x0021
-  128,	 // 0x0080
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   25,	 // 0x0019
-  768,	 // 0x0300
-   20,	 // 0x0014
-32768,	 // 0x8000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-   19,	 // 0x0013
-    2,	 // 0x0002
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   18,	 // 0x0012
-    3,	 // 0x0003
-32770,	 // 0x8002
-   16,	 // 0x0010
-  897,	 // 0x0381
-   23,	 // 0x0017
-32772,	 // 0x8004
-    2,	 // 0x0002
-    0,	 // 0x0000
-    1,	 // 0x0001
-   22,	 // 0x0016
-    5,	 // 0x0005
-    3,	 // 0x0003
-    0,	 // 0x0000
-    1,	 // 0x0001
-   21,	 // 0x0015
-32774,	 // 0x8006
-32776,	 // 0x8008
-   16,	 // 0x0010
-  642,	 // 0x0282
-   17,	 // 0x0011
-32778,	 // 0x800a
-    5,	 // 0x0005
-   16,	 // 0x0010
- 1280,	 // 0x0500
-   30,	 // 0x001e
-32780,	 // 0x800c
-    5,	 // 0x0005
-    0,	 // 0x0000
-    2,	 // 0x0002
-   16,	 // 0x0010
-   10,	 // 0x000a
-    6,	 // 0x0006
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-   11,	 // 0x000b
-    7,	 // 0x0007
-    0,	 // 0x0000
-    2,	 // 0x0002
-   15,	 // 0x000f
-   12,	 // 0x000c
-32782,	 // 0x800e
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-   12,	 // 0x000c
-32784,	 // 0x8010
-   16,	 // 0x0010
-  512,	 // 0x0200
-   14,	 // 0x000e
-32786,	 // 0x8012
-32788,	 // 0x8014
-    0,	 // 0x0000
-    0,	 // 0x0000
-   13,	 // 0x000d
-   14,	 // 0x000e
-   12,	 // 0x000c
-    0,	 // 0x0000
-    0,	 // 0x0000
-   12,	 // 0x000c
-32790,	 // 0x8016
-32792,	 // 0x8018
-   16,	 // 0x0010
-    3,	 // 0x0003
-    2,	 // 0x0002
-32794,	 // 0x801a
-   14,	 // 0x000e
-    0,	 // 0x0000
-    3,	 // 0x0003
-    1,	 // 0x0001
-   17,	 // 0x0011
-   15,	 // 0x000f
-    0,	 // 0x0000
-    3,	 // 0x0003
-    0,	 // 0x0000
-   18,	 // 0x0012
-32796,	 // 0x801c
-   16,	 // 0x0010
- 1028,	 // 0x0404
-   26,	 // 0x001a
-32798,	 // 0x801e
-32800,	 // 0x8020
-    0,	 // 0x0000
-    4,	 // 0x0004
-   25,	 // 0x0019
-   20,	 // 0x0014
-   18,	 // 0x0012
-    0,	 // 0x0000
-    4,	 // 0x0004
-   24,	 // 0x0018
-   21,	 // 0x0015
-32802,	 // 0x8022
-   16,	 // 0x0010
-  261,	 // 0x0105
-    8,	 // 0x0008
-32804,	 // 0x8024
-   20,	 // 0x0014
-    0,	 // 0x0000
-    5,	 // 0x0005
-    7,	 // 0x0007
-   23,	 // 0x0017
-   21,	 // 0x0015
-    0,	 // 0x0000
-    5,	 // 0x0005
-    6,	 // 0x0006
-32806,	 // 0x8026
-32808,	 // 0x8028
-   16,	 // 0x0010
-  386,	 // 0x0182
-   11,	 // 0x000b
-32810,	 // 0x802a
-   23,	 // 0x0017
-   16,	 // 0x0010
- 1154,	 // 0x0482
-   29,	 // 0x001d
-32812,	 // 0x802c
-   23,	 // 0x0017
-    0,	 // 0x0000
-    2,	 // 0x0002
-   10,	 // 0x000a
-   28,	 // 0x001c
-   24,	 // 0x0018
-    0,	 // 0x0000
-    2,	 // 0x0002
-   28,	 // 0x001c
-   29,	 // 0x001d
-   25,	 // 0x0019
-    0,	 // 0x0000
-    2,	 // 0x0002
-    9,	 // 0x0009
-65535,	 // 0xffff
-32814,	 // 0x802e
-    0,	 // 0x0000
-    2,	 // 0x0002
-   27,	 // 0x001b
-65535,	 // 0xffff
-32816,	 // 0x8030
-};
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== bench.c ========
+ *  Recognizer cost benchmark, replaces the demo's mainThread when
+ *  SENSORY_BENCHMARK is defined.
+ *
+ *  For every bundled model it measures the SensoryAlloc size, the cost of
+ *  SensoryProcessInit, of SensoryProcessData per brick on silence, noise and
+ *  a synthetic voiced signal, and of switching to the other model. Results
+ *  are printed as JSON between BENCH_JSON_BEGIN / BENCH_JSON_END lines, see
+ *  tools/bench_compare.py.
+ */
+#ifdef SENSORY_BENCHMARK
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sensorytypes.h"
+#include "sensorylib.h"
+#include "common.h"
+#include "osi_timestamp.h"
+#include "mem_place.h"
+#include "pc_prof.h"
+
+/* Display Header files */
+#include <ti/display/Display.h>
+#include <ti/display/DisplayUart2.h>
+
+#include "wakeword-pc60-6.1.0-op08-prod-search.h"
+#include "command-pc62-6.1.0-op10-prod-search.h"
+
+#define BENCH_TARGET            "cc27xx"
+#define BENCH_PRINT(...)        Display_printf(hSerial, 0, 0, __VA_ARGS__)
+
+#ifndef BENCH_BRICKS
+#define BENCH_BRICKS            400         // 6 s of audio per input
+#endif
+#ifndef BENCH_WARMUP_BRICKS
+#define BENCH_WARMUP_BRICKS     20
+#endif
+#ifndef BENCH_INIT_REPEAT
+#define BENCH_INIT_REPEAT       5
+#endif
+
+#define BENCH_2PI               6.2831853f
+
+typedef enum { BENCH_SILENCE, BENCH_NOISE, BENCH_SPEECH, BENCH_NUM_INPUTS } BenchInput_e;
+
+typedef struct {
+    const char *name;
+    const void *net;
+    const void *gram;
+} BenchModel_t;
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+} BenchStat_t;
+
+static const BenchModel_t gModels[] =
+{
+    { "wakeword-pc60-6.1.0-op08-prod-search", dnn_wakeword_netLabel,   gs_wakeword_grammarLabel },
+    { "command-pc62-6.1.0-op10-prod-search",  dnn_en_command_netLabel, gs_en_command_grammarLabel },
+};
+#define BENCH_NUM_MODELS    (sizeof(gModels) / sizeof(gModels[0]))
+
+static const char *gInputNames[BENCH_NUM_INPUTS] = { "silence", "noise", "speech" };
+
+static t2siStruct gBenchStruct;
+static SAMPLE     gBrick[FRAME_LEN];
+static uint32_t   gSeed;
+static uint32_t   gSample;
+static float      gPhase;
+
+/* from main.c, keeps the benchmark recognizer configured like the demo */
+extern bool setupAppStruct(t2siStruct *t);
+extern Display_Handle hSerial;
+
+static inline uint32_t cycles(void)
+{
+    return OSI_TS_CYCCNT;
+}
+
+static void statAdd(BenchStat_t *s, uint32_t value)
+{
+    if ((s->count == 0) || (value < s->min))
+    {
+        s->min = value;
+    }
+    if (value > s->max)
+    {
+        s->max = value;
+    }
+    s->sum += value;
+    s->count++;
+}
+
+static uint32_t statMean(const BenchStat_t *s)
+{
+    return s->count ? (uint32_t)(s->sum / s->count) : 0;
+}
+
+/*
+ * Deterministic inputs. "speech" is a voiced signal (pitch glide with
+ * harmonics) gated by a 4 Hz syllable envelope, which keeps the front end
+ * and the search busy the way talking does.
+ */
+static void benchFill(BenchInput_e input)
+{
+    uint32_t i;
+
+    for (i = 0; i < FRAME_LEN; i++, gSample++)
+    {
+        if (input == BENCH_SILENCE)
+        {
+            gBrick[i] = 0;
+        }
+        else if (input == BENCH_NOISE)
+        {
+            gSeed = gSeed * 1664525u + 1013904225u;
+            gBrick[i] = (SAMPLE)((int32_t)(gSeed >> 16) - 32768) / 16;
+        }
+        else
+        {
+            float t = (float)gSample / 16000.0f;
+            float f0 = 120.0f + 30.0f * sinf(BENCH_2PI * 0.5f * t);
+            float env = sinf(BENCH_2PI * 4.0f * t);
+            float v = 0.0f;
+            uint32_t h;
+
+            gPhase += BENCH_2PI * f0 / 16000.0f;
+            if (gPhase > BENCH_2PI)
+            {
+                gPhase -= BENCH_2PI;
+            }
+            for (h = 1; h <= 8; h++)
+            {
+                v += sinf(gPhase * h) / h;
+            }
+            gBrick[i] = (env > 0.0f) ? (SAMPLE)(v * env * 4000.0f) : 0;
+        }
+    }
+}
+
+static errors_t benchInit(t2siStruct *t, const BenchModel_t *m)
+{
+    t->net = (intptr_t) m->net;
+    t->gram = (intptr_t) m->gram;
+    return SensoryProcessInit(t);
+}
+
+static void benchModel(uint32_t idx, BOOL last)
+{
+    const BenchModel_t *m = &gModels[idx];
+    const BenchModel_t *other = &gModels[(idx + 1) % BENCH_NUM_MODELS];
+    t2siStruct *t = &gBenchStruct;
+    BenchStat_t initStat = { 0 }, switchStat = { 0 };
+    BenchStat_t brickStat[BENCH_NUM_INPUTS];
+    unsigned int sppSize = 0, otherSize = 0;
+    uint32_t i, n, start;
+    RecoResult *r;
+
+    memset(brickStat, 0, sizeof(brickStat));
+
+    /* The demo switches models on the same SPP, size it for both */
+    setupAppStruct(t);
+    t->net = (intptr_t) other->net;
+    t->gram = (intptr_t) other->gram;
+    SensoryAlloc(t, &otherSize);
+    t->net = (intptr_t) m->net;
+    t->gram = (intptr_t) m->gram;
+    if (SensoryAlloc(t, &sppSize) != ERR_OK)
+    {
+        BENCH_PRINT("  {\"model\": \"%s\", \"error\": \"alloc\"}%s\n", m->name, last ? "" : ",");
+        return;
+    }
+    t->spp = malloc((sppSize > otherSize) ? sppSize : otherSize);
+    if (t->spp == NULL)
+    {
+        BENCH_PRINT("  {\"model\": \"%s\", \"error\": \"no memory\"}%s\n", m->name, last ? "" : ",");
+        return;
+    }
+
+    for (i = 0; i < BENCH_INIT_REPEAT; i++)
+    {
+        start = cycles();
+        benchInit(t, m);
+        statAdd(&initStat, cycles() - start);
+
+        start = cycles();
+        benchInit(t, other);
+        statAdd(&switchStat, cycles() - start);
+        benchInit(t, m);
+    }
+
+    for (i = 0; i < BENCH_NUM_INPUTS; i++)
+    {
+        benchInit(t, m);
+        gSeed = 1;
+        gSample = 0;
+        gPhase = 0.0f;
+        for (n = 0; n < BENCH_WARMUP_BRICKS + BENCH_BRICKS; n++)
+        {
+            benchFill((BenchInput_e)i);
+            start = cycles();
+            r = SensoryProcessData(t, gBrick);
+            if (n >= BENCH_WARMUP_BRICKS)
+            {
+                statAdd(&brickStat[i], cycles() - start);
+            }
+            if (r->error == ERR_LICENSE)
+            {
+                BENCH_PRINT("Sensory Lib license error!\n");
+                break;
+            }
+            if (r->error != ERR_NOT_FINISHED)
+            {
+                benchInit(t, m);
+            }
+        }
+    }
+
+    BENCH_PRINT("  {\"model\": \"%s\", \"alloc_bytes\": %d,\n", m->name, sppSize);
+    BENCH_PRINT("   \"init_cycles\": %d, \"switch_cycles\": %d, \"switch_to\": \"%s\",\n",
+                statMean(&initStat), statMean(&switchStat), other->name);
+    for (i = 0; i < BENCH_NUM_INPUTS; i++)
+    {
+        BENCH_PRINT("   \"%s\": {\"brick_mean_cycles\": %d, \"brick_max_cycles\": %d,\n",
+                    gInputNames[i], statMean(&brickStat[i]), brickStat[i].max);
+        BENCH_PRINT("    \"brick_min_cycles\": %d, \"load_pct\": %d}%s\n", brickStat[i].min,
+                    (uint32_t)((uint64_t)statMean(&brickStat[i]) * 100 * 1000 / BRICK_SIZE_MS / configCPU_CLOCK_HZ),
+                    (i + 1 < BENCH_NUM_INPUTS) ? "," : "");
+    }
+    BENCH_PRINT("  }%s\n", last ? "" : ",");
+
+    free(t->spp);
+    t->spp = NULL;
+}
+
+void *mainThread(void *args)
+{
+    infoStruct_T isp;
+    Display_Params params;
+    uint32_t i;
+
+    Display_Params_init(&params);
+    params.lineClearMode = DISPLAY_CLEAR_NONE;
+    hSerial = Display_open(Display_Type_UART, &params);
+
+    OsiTs_init();
+    PcProf_init();
+
+    SensoryInfo(&isp);
+
+    BENCH_PRINT("BENCH_JSON_BEGIN\n");
+    BENCH_PRINT("{\"target\": \"%s\", \"cpu_hz\": %d, \"bricks\": %d,\n", BENCH_TARGET, configCPU_CLOCK_HZ, BENCH_BRICKS);
+    BENCH_PRINT(" \"thf_version\": \"%d.%d.%d\",\n",
+                (isp.version>>20)&0x00000fff, (isp.version>>12)&0x000000ff, isp.version&0x00000fff);
+    BENCH_PRINT(" \"hot_text_bytes\": %d, \"hot_data_bytes\": %d,\n", MemPlace_textBytes(), MemPlace_dataBytes());
+    BENCH_PRINT(" \"models\": [\n");
+    for (i = 0; i < BENCH_NUM_MODELS; i++)
+    {
+        benchModel(i, (i + 1) == BENCH_NUM_MODELS);
+    }
+    // Profile the recognizer only
+    PcProf_stop();
+    BENCH_PRINT(" ]}\n");
+    BENCH_PRINT("BENCH_JSON_END\n");
+    PcProf_dump();
+
+    return NULL;
+}
+
+#endif // SENSORY_BENCHMARK
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== boot_prof.c ========
+ *  Boot phase timestamps, see boot_prof.h.
+ */
+
+#include <stdint.h>
+
+#include <ti/display/Display.h>
+#include "ti/drivers/dpl/HwiP.h"
+#include "ti/drivers/dpl/ClockP.h"
+#include "osi_timestamp.h"
+#include "boot_prof.h"
+
+#define HWREG(x)                (*((volatile unsigned long *)(x)))
+#define DEMCR                   0xE000EDFC
+#define DEMCR_TRCENA            0x01000000
+#define DWT_CTRL                0xE0001000
+#define DWT_CTRL_CYCCNTENA      0x00000001
+
+typedef struct {
+    const char *name;
+    uint32_t    cycles;
+    uint32_t    ticks;          // system ticks, they keep counting while the core sleeps
+} BootStage_t;
+
+extern Display_Handle hSerial;
+
+static BootStage_t       gStage[BOOT_PROF_STAGES];
+static volatile uint32_t gCount;
+static uint32_t          gReported;
+
+void BootProf_init(void)
+{
+    // OsiTs_init() sets the same bits later and keeps the count running
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+    BootProf_mark("main");
+}
+
+void BootProf_mark(const char *name)
+{
+    // Stages are marked from several tasks, keep them in time order
+    uintptr_t key = HwiP_disable();
+
+    if (gCount < BOOT_PROF_STAGES) {
+        gStage[gCount].name = name;
+        gStage[gCount].cycles = OSI_TS_CYCCNT;
+        gStage[gCount].ticks = ClockP_getSystemTicks();
+        gCount++;
+    }
+    HwiP_restore(key);
+}
+
+/* Time from stage i - 1 to stage i */
+static uint32_t stageUs(uint32_t i)
+{
+    uint32_t tickUs = ClockP_getSystemTickPeriod();
+    // 32-bit difference, a stage takes far less than a counter wrap
+    uint32_t us = (uint32_t) OsiTs_toUs(gStage[i].cycles - gStage[i - 1].cycles);
+    uint32_t sleptUs = (gStage[i].ticks - gStage[i - 1].ticks) * tickUs;
+
+    // The cycle counter stops while the core sleeps; the ticks are only accurate to a tick, allow two
+    return (sleptUs > us + 2 * tickUs) ? sleptUs : us;
+}
+
+void BootProf_report(void)
+{
+    uint32_t n = gCount;
+    uint32_t total = 0;
+    uint32_t step;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        step = i ? stageUs(i) : 0;
+        total += step;
+        if (i < gReported) {
+            continue;
+        }
+        Display_printf(hSerial, 0, 0, "[boot] %-14s %7u us  +%u us", gStage[i].name, total, step);
+    }
+    gReported = n;
+}
@@ -76,6 +76,10 @@
 #include "sensorylib.h"
 #include "common.h"
 #include "SensoryDemoHelper.h"
+#include "osi_timestamp.h"
+#include "trace_log.h"
+#include "pc_prof.h"
+#include "boot_prof.h"
 
 // Sensory wakeword model from Voicehub
 #include "wakeword-pc60-6.1.0-op08-prod-search.h"
@@ -83,9 +87,6 @@
 // Sensory commands model from Voicehub
 #include "command-pc62-6.1.0-op10-prod-search.h"
 
-#define MIC_DC_OFFSET           1650
-#define MIC_DC_ATTENUATION      14
-
 t2siStruct  appStruct;
 
 typedef enum { RECOMODE_NONE, RECOMODE_WAKE, RECOMODE_COMMAND } RecoMode;
@@ -103,7 +104,7 @@ int commandCountdown = 0;
 #define COMMAND_COUNTDOWN_FRAMES_DURATION   (COMMAND_SEC_WAIT * 1000 / 15)
 
 
-char * cmdPhrases[10] = { COMMAND_PHRASE_0, COMMAND_PHRASE_1, COMMAND_PHRASE_2, COMMAND_PHRASE_3};
+char * cmdPhrases[10] = COMMAND_PHRASES;
 int16_t paramAOffsetWake = 0;     // Go negative if too many FA on wakeword, go positive if too many FR
 int16_t paramAOffsetCommand = 0;  // Go negative (by 100, 200, etc) if too many FA on command, go positive if too many FR
 int32_t glitchCount = 0;
@@ -111,12 +112,8 @@ int32_t glitchCount = 0;
 int16_t audioBuffer[AUDIO_BUFFER_LEN];
 int16_t raw_audio_samples_copy[NUM_AUDIO_SAMPLES];
 
-// Enables ease of calibration for the microphone
-uint32_t   microphoneAtten = MIC_DC_ATTENUATION;
-int32_t    microphoneOffset = MIC_DC_OFFSET;
-
-uint32_t getTick() {
-    return xTaskGetTickCount();
+uint64_t getTick() {
+    return OsiTs_cycles();
 }
 
 BOOL reInitProcess(t2siStruct* t, void *netMemory, void *grammarMemory) {
@@ -192,12 +189,12 @@ bool setupAppStruct(t2siStruct *t) {
 }
 
 
+#ifndef SENSORY_BENCHMARK
 /*
  *  ======== mainThread ========
  */
 void *mainThread(void *arg0)
 {
-    uint32_t i = 0;
     RecoResult * sensoryStatus;
     uint32_t elapsedAccum = 0;
     infoStruct_T isp;
@@ -205,9 +202,15 @@ void *mainThread(void *arg0)
     unsigned short * gs_command_grammarLabel;
     uint32_t greenLedState;
     uint32_t redLedState;
+    uint32_t heldCount, droppedCount;
+    bool catchingUp = true;
+    bool listening = false;
+    uint64_t brickTime;
 
     t2siStruct *t = &appStruct; // Where we look for return values
 
+    BootProf_mark("thread");
+
     // Initialize the values
     sdet_type = SDET_NONE; // use SDET_LPSD for Low Power Sound Detect
     paramAOffsetWake = 0;
@@ -217,17 +220,23 @@ void *mainThread(void *arg0)
     params.lineClearMode   = DISPLAY_CLEAR_NONE;
     hSerial = Display_open(Display_Type_UART, &params);
 
+    OsiTs_init();
+    BootProf_mark("console");
+
     /* Initialize peripherals for I2S MIC  */
     if (i2s_mic_init() != 0)
     {
         Display_printf(hSerial, 0, 0, "Failed to initialize I2S Microphone.\n");
         exit(-1);
     }
+    BootProf_mark("i2s");
 
     /* Check if the selected Display type was found and successfully opened */
     if (hSerial)
     {
         Display_printf(hSerial, 0, 0, "Hello Sensory!\n");
+        TraceLog_init();
+        PcProf_init();
     }
     else
     {
@@ -251,6 +260,9 @@ void *mainThread(void *arg0)
         exit(-1);
     }
     Display_printf(hSerial, 0, 0, "Recognizer init.\n");
+    BootProf_mark("recognizer");
+    // Bricks are still held, printing now does not lose audio
+    BootProf_report();
 
     commandCountdown = COMMAND_COUNTDOWN_FRAMES_DURATION;
 
@@ -259,29 +271,35 @@ void *mainThread(void *arg0)
 
     while (1)
     {
-        /* Wait for I2S data to be available */
-        if (sem_wait(&semDataReadyForTreatment) == 0)
+        PcProf_poll();
+
+        /* Bricks captured during init first, then wait for I2S data to be available */
+        bool held = catchingUp && i2s_mic_heldBrick(raw_audio_samples_copy, &brickTime);
+        if (catchingUp && !held)
+        {
+            catchingUp = false;
+            BootProf_mark("caught up");
+            BootProf_report();
+            i2s_mic_heldStats(&heldCount, &droppedCount);
+            Display_printf(hSerial, 0, 0, "[boot] %u bricks captured during init, %u dropped", heldCount, droppedCount);
+        }
+        if (held || sem_wait(&semDataReadyForTreatment) == 0)
         {
             /* This transaction should trigger every FRAME_LEN samples (240) to feed into Sensory */
-
-            /* Get the latest audio pointer triggered by the semaphore */
-            int32_t *buf          = latestAudioBufPtr.audioBufPtr;
-            /* bufSize is expressed in bytes but samples to consider are 16 bits long */
-            uint16_t numOfSamples = latestAudioBufPtr.numOfSamples;
-
-            uint32_t n = 0;
-
-            /* We only modify Left channel's samples () */
-            for (i = 0; i < numOfSamples; i = i + 3)
+            if (!held)
             {
-                /*
-                 * Shift the data down to 16-bits from 32-bits and then
-                 * remove the DC offset of the I2S microphone
-                 */
-                raw_audio_samples_copy[n++] = (int16_t) ((buf[i] >> microphoneAtten) + microphoneOffset);
+                /* Get the latest audio pointer triggered by the semaphore */
+                int32_t *buf          = latestAudioBufPtr.audioBufPtr;
+                /* bufSize is expressed in bytes but samples to consider are 16 bits long */
+                uint16_t numOfSamples = latestAudioBufPtr.numOfSamples;
+                /* Capture time of the brick, same timebase as getTick() */
+                brickTime             = latestAudioBufPtr.timestamp;
+
+                i2s_mic_convert(buf, numOfSamples, raw_audio_samples_copy);
             }
 
-            uint32_t counter1, counter2, elapsed;
+            uint64_t counter1, counter2;
+            uint32_t elapsed;
 
             if (commandCountdown > 0) {
                 // count down command duration
@@ -302,10 +320,13 @@ void *mainThread(void *arg0)
             counter1 = getTick();
             sensoryStatus = SensoryProcessData(t, (SAMPLE *) raw_audio_samples_copy);
             counter2 = getTick();
-            if (counter2 >= counter1) {
-                elapsed = counter2 - counter1;
-                elapsedAccum += elapsed;
+            if (!listening)
+            {
+                BootProf_mark("listening");
+                listening = true;
             }
+            elapsed = (uint32_t) OsiTs_toUs(counter2 - counter1);
+            elapsedAccum += elapsed;
 
             if (sensoryStatus->wordID && sensoryStatus->nnpqScore > 0) {
                 if (nnpqThresholdNew) {
@@ -315,8 +336,8 @@ void *mainThread(void *arg0)
                         sensoryStatus->nnpqPass = TRUE;
                     }
                 }
-                Display_printf(hSerial, 0, 0, "Recognition .. ? #%lu, wordID = %d  score: %d  elapsed_time: %dms\n", (uint32_t) t->brickCount, sensoryStatus->wordID, sensoryStatus->finalScore, elapsed);
-                Display_printf(hSerial, 0, 0, "NNPQ score= %d, NNPQ threshold= %d, NNPQ check pass= %d\n", sensoryStatus->nnpqScore, sensoryStatus->nnpqThreshold, sensoryStatus->nnpqPass);
+                TLOG("Recognition .. ? #%lu, wordID = %d  score: %d  elapsed_time: %dus\n", (uint32_t) t->brickCount, sensoryStatus->wordID, sensoryStatus->finalScore, elapsed);
+                TLOG("NNPQ score= %d, NNPQ threshold= %d, NNPQ check pass= %d\n", sensoryStatus->nnpqScore, sensoryStatus->nnpqThreshold, sensoryStatus->nnpqPass);
             }
 
             if (sensoryStatus->error == ERR_OK) {
@@ -352,7 +373,7 @@ void *mainThread(void *arg0)
                     GPIO_write(CONFIG_GPIO_LED_RED, redLedState);
 
                     Display_printf(hSerial, 0, 0, "\n= = = COMMAND %d: %s = = =\n", sensoryStatus->wordID, cmdPhrases[sensoryStatus->wordID]);
-                    Display_printf(hSerial, 0, 0, "*** Recognizer found wordID = %d, score = %d, at time %d, elapsed_time: %dms\n", sensoryStatus->wordID, sensoryStatus->finalScore, (uint32_t) t->brickCount, elapsed);
+                    Display_printf(hSerial, 0, 0, "*** Recognizer found wordID = %d, score = %d, at time %d, elapsed_time: %dus, latency: %dus\n", sensoryStatus->wordID, sensoryStatus->finalScore, (uint32_t) t->brickCount, elapsed, (uint32_t) OsiTs_toUs(counter2 - brickTime));
 
                     // Got an actual command
                     recoMode = RECOMODE_WAKE;
@@ -380,3 +401,4 @@ void *mainThread(void *arg0)
 
     return (void *) 1;
 }
+#endif // SENSORY_BENCHMARK
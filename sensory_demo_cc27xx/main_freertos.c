@@ -48,6 +48,9 @@
 
 #include <ti/drivers/Board.h>
 
+#include "mem_place.h"
+#include "boot_prof.h"
+
 extern void *mainThread(void *arg0);
 
 /* Stack size in bytes */
@@ -68,7 +71,11 @@ int main(void)
     __iar_Initlocks();
 #endif
 
+    BootProf_init();
     Board_init();
+    BootProf_mark("board");
+    MemPlace_init();
+    BootProf_mark("mem place");
 
     /* Initialize the attributes structure with default values */
     pthread_attr_init(&attrs);
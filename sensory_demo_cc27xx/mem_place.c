@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== mem_place.c ========
+ *  Copy of the hot sections, see mem_place.h.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "mem_place.h"
+
+/* lpf3_cc27xx_freertos.lds */
+extern uint8_t __hot_text_load__[], __hot_text_start__[], __hot_text_end__[];
+extern uint8_t __hot_data_load__[], __hot_data_start__[], __hot_data_end__[];
+
+void MemPlace_init(void)
+{
+    memcpy(__hot_text_start__, __hot_text_load__, MemPlace_textBytes());
+    memcpy(__hot_data_start__, __hot_data_load__, MemPlace_dataBytes());
+    // Code is fetched from SRAM on the system bus, make the copy visible to it
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+}
+
+uint32_t MemPlace_textBytes(void)
+{
+    return (uint32_t) (__hot_text_end__ - __hot_text_start__);
+}
+
+uint32_t MemPlace_dataBytes(void)
+{
+    return (uint32_t) (__hot_data_end__ - __hot_data_start__);
+}
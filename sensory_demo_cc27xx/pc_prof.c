@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== pc_prof.c ========
+ *  PC sampling profiler, see pc_prof.h.
+ *
+ *  Console format (hex, no separators):
+ *      #PP=<shift><samples><inHandler><outside>   header
+ *      #PP@<base><buckets>                         a range, in bucket order
+ *      #PP:<index><count>...                       non-zero buckets, 16 bits each
+ *      #PP.                                        end of the histogram
+ */
+#ifdef PC_PROFILE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <ti/display/Display.h>
+
+#include "pc_prof.h"
+
+#define SCB_ICSR                0xE000ED04
+#define SCB_ICSR_RETTOBASE      (1u << 11)  // no other exception was active
+#define FRAME_PC                6           // stacked PC, in words from the frame start
+#define PC_PROF_RANGES          2
+#define PC_PROF_PER_LINE        8
+
+#if PC_PROFILE_SAMPLES > 0xFFFF
+#error "PC_PROFILE_SAMPLES must fit the 16-bit counters"
+#endif
+#if PC_PROFILE_BUCKETS > 0x10000
+#error "bucket indexes are printed as 16 bits"
+#endif
+#if PC_PROFILE_TICK_HOOK && !configUSE_TICK_HOOK
+#error "set configUSE_TICK_HOOK to 1, or PC_PROFILE_TICK_HOOK to 0 and call PcProf_sample()"
+#endif
+
+typedef struct {
+    uintptr_t   base;
+    uint32_t    buckets;
+} PcProfRange_t;
+
+/* lpf3_cc27xx_freertos.lds */
+extern uint8_t __text_start__[], __etext[];
+extern uint8_t __hot_text_start__[], __hot_text_end__[];
+
+extern Display_Handle hSerial;
+
+static PcProfRange_t        gRanges[PC_PROF_RANGES];
+static uint16_t             gCounts[PC_PROFILE_BUCKETS];
+static uint32_t             gShift;
+static volatile uint32_t    gSamples;
+static volatile uint32_t    gInHandler;     // another exception was active
+static volatile uint32_t    gOutside;       // PC in neither range
+static volatile uint8_t     gRunning;
+static uint8_t              gDumped;
+
+static inline uint32_t *readPsp(void)
+{
+    uint32_t *psp;
+
+    __asm volatile ("mrs %0, psp" : "=r" (psp));
+    return psp;
+}
+
+static uint32_t bucketsFor(uintptr_t start, uintptr_t end, uint32_t shift)
+{
+    return (end > start) ? ((end - (start & ~((1u << shift) - 1))) >> shift) + 1 : 0;
+}
+
+void PcProf_init(void)
+{
+    uintptr_t start[PC_PROF_RANGES] = { (uintptr_t) __text_start__, (uintptr_t) __hot_text_start__ };
+    uintptr_t end[PC_PROF_RANGES] = { (uintptr_t) __etext, (uintptr_t) __hot_text_end__ };
+    uint32_t i, total;
+
+    gRunning = 0;
+    for (gShift = 2; ; gShift++) {
+        for (i = 0, total = 0; i < PC_PROF_RANGES; i++) {
+            total += bucketsFor(start[i], end[i], gShift);
+        }
+        if (total <= PC_PROFILE_BUCKETS) {
+            break;
+        }
+    }
+    for (i = 0; i < PC_PROF_RANGES; i++) {
+        gRanges[i].base = start[i] & ~((1u << gShift) - 1);
+        gRanges[i].buckets = bucketsFor(start[i], end[i], gShift);
+    }
+    for (i = 0; i < PC_PROFILE_BUCKETS; i++) {
+        gCounts[i] = 0;
+    }
+    gSamples = gInHandler = gOutside = 0;
+    gDumped = 0;
+    gRunning = 1;
+}
+
+void PcProf_sample(void)
+{
+    uintptr_t pc;
+    uint32_t i, first = 0;
+
+    if (!gRunning) {
+        return;
+    }
+
+    if (*(volatile uint32_t *) SCB_ICSR & SCB_ICSR_RETTOBASE) {
+        // Tasks run on the process stack, the exception frame is on top of it
+        pc = readPsp()[FRAME_PC];
+        for (i = 0; i < PC_PROF_RANGES; i++) {
+            uint32_t b = (pc - gRanges[i].base) >> gShift;
+
+            if ((pc >= gRanges[i].base) && (b < gRanges[i].buckets)) {
+                gCounts[first + b]++;
+                break;
+            }
+            first += gRanges[i].buckets;
+        }
+        if (i == PC_PROF_RANGES) {
+            gOutside++;
+        }
+    }
+    else {
+        gInHandler++;
+    }
+
+    if (++gSamples >= PC_PROFILE_SAMPLES) {
+        gRunning = 0;
+    }
+}
+
+#if PC_PROFILE_TICK_HOOK
+void vApplicationTickHook(void)
+{
+    PcProf_sample();
+}
+#endif
+
+void PcProf_stop(void)
+{
+    gRunning = 0;
+}
+
+void PcProf_poll(void)
+{
+    if (!gRunning && !gDumped && (gSamples >= PC_PROFILE_SAMPLES)) {
+        gDumped = 1;
+        PcProf_dump();
+    }
+}
+
+void PcProf_dump(void)
+{
+    char line[4 + 8 * PC_PROF_PER_LINE + 1];
+    uint32_t i, n = 0, total = 0;
+
+    Display_printf(hSerial, 0, 0, "#PP=%08x%08x%08x%08x", gShift, gSamples, gInHandler, gOutside);
+    for (i = 0; i < PC_PROF_RANGES; i++) {
+        Display_printf(hSerial, 0, 0, "#PP@%08x%08x", gRanges[i].base, gRanges[i].buckets);
+        total += gRanges[i].buckets;
+    }
+    for (i = 0; i < total; i++) {
+        if (gCounts[i] == 0) {
+            continue;
+        }
+        if (n == 0) {
+            memcpy(line, "#PP:", 4);
+        }
+        snprintf(&line[4 + 8 * n], 9, "%04x%04x", (unsigned) i, (unsigned) gCounts[i]);
+        if (++n == PC_PROF_PER_LINE) {
+            Display_printf(hSerial, 0, 0, "%s", line);
+            n = 0;
+        }
+    }
+    if (n) {
+        Display_printf(hSerial, 0, 0, "%s", line);
+    }
+    Display_printf(hSerial, 0, 0, "#PP.");
+}
+
+#endif // PC_PROFILE
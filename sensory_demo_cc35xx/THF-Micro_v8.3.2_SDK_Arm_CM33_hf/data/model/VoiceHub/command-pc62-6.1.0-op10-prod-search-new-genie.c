@@ -1,1569 +0,0 @@
-/* Speech Recognition HMM Grammar file V62 for pc62 platform
- * Copyright (C) 2003-2022 Sensory, Inc. All Rights Reserved.
- * 
- *
- *            source: /tmp/tmp.V7L6HpLQ2b/trecs-en_US_12-13-6-0_e08b648a1d28746116edfb0264cb05b3bf518dd8.snsr
- *           created: Mon Aug  4 18:52:09 2025
- *   min lib version: 6.1.0
- *   operating point: 10
- *  production ready: yes
- *       license key: no
- *
- * Created by VoiceHub 2.13.16
- * Project: Command_Set_command
- */
-
-#ifndef ALIGNED
-#ifndef _MSC_VER
-#define ALIGNED(x) __attribute__ ((aligned (x)))
-#else
-#define ALIGNED(x)
-#endif
-#endif
-
-//const char *command_phrases[] = {COMMAND_PHRASE_0, COMMAND_PHRASE_1, COMMAND_PHRASE_2, COMMAND_PHRASE_3, COMMAND_PHRASE_4, COMMAND_PHRASE_5};
-const unsigned short gs_en_command_grammarLabel[] ALIGNED(4) = {
-   62,	 // 0x003e
-  217,	 // 0x00d9
-  132,	 // 0x0084
-    0,	 // 0x0000
-    4,	 // 0x0004
-   97,	 // 0x0061
-   32,	 // 0x0020
-    0,	 // 0x0000
-   32,	 // 0x0020
-  179,	 // 0x00b3
-  219,	 // 0x00db
- 1000,	 // 0x03e8
-    0,	 // 0x0000
-   27,	 // 0x001b
-  200,	 // 0x00c8
- 1000,	 // 0x03e8
-  300,	 // 0x012c
-    4,	 // 0x0004
-  184,	 // 0x00b8
-   63,	 // 0x003f
-    5,	 // 0x0005
-    5,	 // 0x0005
-  132,	 // 0x0084
-  132,	 // 0x0084
-    5,	 // 0x0005
-    4,	 // 0x0004
-    0,	 // 0x0000
-    9,	 // 0x0009
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-28771,	 // 0x7063
-  102,	 // 0x0066
-  110,	 // 0x006e
-  478,	 // 0x01de
-  604,	 // 0x025c
-  614,	 // 0x0266
-  624,	 // 0x0270
-  888,	 // 0x0378
- 1152,	 // 0x0480
- 1172,	 // 0x0494
-    0,	 // 0x0000
- 1204,	 // 0x04b4
- 1222,	 // 0x04c6
- 1238,	 // 0x04d6
-    0,	 // 0x0000
- 1766,	 // 0x06e6
- 2350,	 // 0x092e
- 2700,	 // 0x0a8c
- 2400,	 // 0x0960
- 2200,	 // 0x0898
-    2,	 // 0x0002
-32769,	 // 0x8001
-    1,	 // 0x0001
-32768,	 // 0x8000
-    5,	 // 0x0005
-32772,	 // 0x8004
-    4,	 // 0x0004
-32771,	 // 0x8003
-    9,	 // 0x0009
-32776,	 // 0x8008
-    5,	 // 0x0005
-32770,	 // 0x8002
-   16,	 // 0x0010
-32779,	 // 0x800b
-    8,	 // 0x0008
-32774,	 // 0x8006
-   19,	 // 0x0013
-32781,	 // 0x800d
-   31,	 // 0x001f
-32792,	 // 0x8018
-   23,	 // 0x0017
-32786,	 // 0x8012
-   32,	 // 0x0020
-32795,	 // 0x801b
-   11,	 // 0x000b
-32775,	 // 0x8007
-   26,	 // 0x001a
-32789,	 // 0x8015
-   13,	 // 0x000d
-32778,	 // 0x800a
-   28,	 // 0x001c
-32790,	 // 0x8016
-   19,	 // 0x0013
-32784,	 // 0x8010
-   18,	 // 0x0012
-32782,	 // 0x800e
-   35,	 // 0x0023
-32797,	 // 0x801d
-   21,	 // 0x0015
-32785,	 // 0x8011
-   22,	 // 0x0016
-32788,	 // 0x8014
-   38,	 // 0x0026
-32802,	 // 0x8022
-   24,	 // 0x0018
-32780,	 // 0x800c
-   27,	 // 0x001b
-32783,	 // 0x800f
-   39,	 // 0x0027
-32804,	 // 0x8024
-   32,	 // 0x0020
-32791,	 // 0x8017
-   29,	 // 0x001d
-32793,	 // 0x8019
-   46,	 // 0x002e
-32809,	 // 0x8029
-   34,	 // 0x0022
-32798,	 // 0x801e
-   36,	 // 0x0024
-32801,	 // 0x8021
-   47,	 // 0x002f
-32811,	 // 0x802b
-   35,	 // 0x0023
-32799,	 // 0x801f
-   49,	 // 0x0031
-32813,	 // 0x802d
-   50,	 // 0x0032
-32816,	 // 0x8030
-   41,	 // 0x0029
-32805,	 // 0x8025
-   43,	 // 0x002b
-32808,	 // 0x8028
-   45,	 // 0x002d
-32810,	 // 0x802a
-   48,	 // 0x0030
-32812,	 // 0x802c
-   60,	 // 0x003c
-32823,	 // 0x8037
-   59,	 // 0x003b
-32822,	 // 0x8036
-   61,	 // 0x003d
-32825,	 // 0x8039
-   63,	 // 0x003f
-32826,	 // 0x803a
-   54,	 // 0x0036
-32820,	 // 0x8034
-   55,	 // 0x0037
-32819,	 // 0x8033
-   57,	 // 0x0039
-32821,	 // 0x8035
-   66,	 // 0x0042
-32832,	 // 0x8040
-   58,	 // 0x003a
-32824,	 // 0x8038
-   71,	 // 0x0047
-32836,	 // 0x8044
-   64,	 // 0x0040
-32830,	 // 0x803e
-   74,	 // 0x004a
-32837,	 // 0x8045
-   80,	 // 0x0050
-32843,	 // 0x804b
-   68,	 // 0x0044
-32833,	 // 0x8041
-   81,	 // 0x0051
-32845,	 // 0x804d
-   82,	 // 0x0052
-32846,	 // 0x804e
-   69,	 // 0x0045
-32835,	 // 0x8043
-   83,	 // 0x0053
-32847,	 // 0x804f
-   75,	 // 0x004b
-32838,	 // 0x8046
-   77,	 // 0x004d
-32840,	 // 0x8048
-   78,	 // 0x004e
-32841,	 // 0x8049
-   79,	 // 0x004f
-32844,	 // 0x804c
-   92,	 // 0x005c
-32856,	 // 0x8058
-   93,	 // 0x005d
-32857,	 // 0x8059
-   95,	 // 0x005f
-32858,	 // 0x805a
-   94,	 // 0x005e
-32859,	 // 0x805b
-   88,	 // 0x0058
-32852,	 // 0x8054
-   89,	 // 0x0059
-32853,	 // 0x8055
-   91,	 // 0x005b
-32855,	 // 0x8057
-   90,	 // 0x005a
-32854,	 // 0x8056
-  104,	 // 0x0068
-32868,	 // 0x8064
-  105,	 // 0x0069
-32869,	 // 0x8065
-  107,	 // 0x006b
-32870,	 // 0x8066
-  106,	 // 0x006a
-32871,	 // 0x8067
-  100,	 // 0x0064
-32864,	 // 0x8060
-  101,	 // 0x0065
-32865,	 // 0x8061
-  103,	 // 0x0067
-32867,	 // 0x8063
-  102,	 // 0x0066
-32866,	 // 0x8062
-  116,	 // 0x0074
-32880,	 // 0x8070
-  117,	 // 0x0075
-32881,	 // 0x8071
-  118,	 // 0x0076
-32882,	 // 0x8072
-  119,	 // 0x0077
-32883,	 // 0x8073
-  112,	 // 0x0070
-32876,	 // 0x806c
-  113,	 // 0x0071
-32877,	 // 0x806d
-  114,	 // 0x0072
-32878,	 // 0x806e
-  115,	 // 0x0073
-32879,	 // 0x806f
-  130,	 // 0x0082
-32892,	 // 0x807c
-  129,	 // 0x0081
-32893,	 // 0x807d
-  128,	 // 0x0080
-32894,	 // 0x807e
-  131,	 // 0x0083
-32895,	 // 0x807f
-  126,	 // 0x007e
-32890,	 // 0x807a
-  125,	 // 0x007d
-32889,	 // 0x8079
-  124,	 // 0x007c
-32888,	 // 0x8078
-  127,	 // 0x007f
-32891,	 // 0x807b
-  116,	 // 0x0074
-  111,	 // 0x006f
-  103,	 // 0x0067
-  103,	 // 0x0067
-  108,	 // 0x006c
-  101,	 // 0x0065
-   95,	 // 0x005f
-  103,	 // 0x0067
-  114,	 // 0x0072
-  101,	 // 0x0065
-  101,	 // 0x0065
-  110,	 // 0x006e
-   95,	 // 0x005f
-  108,	 // 0x006c
-  101,	 // 0x0065
-  100,	 // 0x0064
-    0,	 // 0x0000
-  116,	 // 0x0074
-  111,	 // 0x006f
-  103,	 // 0x0067
-  103,	 // 0x0067
-  108,	 // 0x006c
-  101,	 // 0x0065
-   95,	 // 0x005f
-  114,	 // 0x0072
-  101,	 // 0x0065
-  100,	 // 0x0064
-   95,	 // 0x005f
-  108,	 // 0x006c
-  101,	 // 0x0065
-  100,	 // 0x0064
-    0,	 // 0x0000
-  116,	 // 0x0074
-  111,	 // 0x006f
-  103,	 // 0x0067
-  103,	 // 0x0067
-  108,	 // 0x006c
-  101,	 // 0x0065
-   95,	 // 0x005f
-   98,	 // 0x0062
-  108,	 // 0x006c
-  117,	 // 0x0075
-  101,	 // 0x0065
-   95,	 // 0x005f
-  108,	 // 0x006c
-  101,	 // 0x0065
-  100,	 // 0x0064
-    0,	 // 0x0000
-  116,	 // 0x0074
-  111,	 // 0x006f
-  103,	 // 0x0067
-  103,	 // 0x0067
-  108,	 // 0x006c
-  101,	 // 0x0065
-   95,	 // 0x005f
-   97,	 // 0x0061
-  108,	 // 0x006c
-  108,	 // 0x006c
-   95,	 // 0x005f
-  108,	 // 0x006c
-  101,	 // 0x0065
-  100,	 // 0x0064
-    0,	 // 0x0000
-  131,	 // 0x0083
-  130,	 // 0x0082
-  129,	 // 0x0081
-  128,	 // 0x0080
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-   17,	 // 0x0011
-   32,	 // 0x0020
-   48,	 // 0x0030
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
-21376,	 // 0x5380
- 3189,	 // 0x0c75
- 2359,	 // 0x0937
- 2980,	 // 0x0ba4
- 3339,	 // 0x0d0b
- 2271,	 // 0x08df
- 2907,	 // 0x0b5b
- 2777,	 // 0x0ad9
- 3164,	 // 0x0c5c
- 2189,	 // 0x088d
- 2647,	 // 0x0a57
- 3107,	 // 0x0c23
- 2275,	 // 0x08e3
- 2989,	 // 0x0bad
- 2421,	 // 0x0975
- 3271,	 // 0x0cc7
- 3121,	 // 0x0c31
- 2917,	 // 0x0b65
- 2432,	 // 0x0980
- 2556,	 // 0x09fc
- 2914,	 // 0x0b62
- 2761,	 // 0x0ac9
- 2399,	 // 0x095f
- 2534,	 // 0x09e6
- 3100,	 // 0x0c1c
- 2400,	 // 0x0960
- 3169,	 // 0x0c61
- 2495,	 // 0x09bf
- 2610,	 // 0x0a32
- 2551,	 // 0x09f7
- 2295,	 // 0x08f7
- 2494,	 // 0x09be
- 2763,	 // 0x0acb
- 3019,	 // 0x0bcb
- 3022,	 // 0x0bce
- 2629,	 // 0x0a45
- 2847,	 // 0x0b1f
- 2746,	 // 0x0aba
- 2427,	 // 0x097b
- 2461,	 // 0x099d
- 2927,	 // 0x0b6f
- 2710,	 // 0x0a96
- 2440,	 // 0x0988
- 2770,	 // 0x0ad2
- 2400,	 // 0x0960
- 2332,	 // 0x091c
- 2604,	 // 0x0a2c
- 2486,	 // 0x09b6
- 2480,	 // 0x09b0
- 2612,	 // 0x0a34
- 2612,	 // 0x0a34
- 2661,	 // 0x0a65
- 2546,	 // 0x09f2
- 2404,	 // 0x0964
- 2460,	 // 0x099c
- 2610,	 // 0x0a32
- 2724,	 // 0x0aa4
- 2564,	 // 0x0a04
- 2493,	 // 0x09bd
- 2747,	 // 0x0abb
- 2352,	 // 0x0930
- 2765,	 // 0x0acd
- 2505,	 // 0x09c9
- 2415,	 // 0x096f
- 2700,	 // 0x0a8c
- 2249,	 // 0x08c9
- 2866,	 // 0x0b32
- 2518,	 // 0x09d6
- 2549,	 // 0x09f5
- 2962,	 // 0x0b92
- 2534,	 // 0x09e6
- 2660,	 // 0x0a64
- 3051,	 // 0x0beb
- 2455,	 // 0x0997
- 3256,	 // 0x0cb8
- 2596,	 // 0x0a24
- 2680,	 // 0x0a78
- 2659,	 // 0x0a63
- 2630,	 // 0x0a46
- 3200,	 // 0x0c80
- 2828,	 // 0x0b0c
- 2673,	 // 0x0a71
- 2817,	 // 0x0b01
- 3199,	 // 0x0c7f
- 2829,	 // 0x0b0d
- 2627,	 // 0x0a43
- 3110,	 // 0x0c26
- 2916,	 // 0x0b64
- 2761,	 // 0x0ac9
- 2577,	 // 0x0a11
- 3010,	 // 0x0bc2
- 2805,	 // 0x0af5
- 2673,	 // 0x0a71
- 2749,	 // 0x0abd
- 3230,	 // 0x0c9e
- 2880,	 // 0x0b40
- 2944,	 // 0x0b80
- 3078,	 // 0x0c06
- 3468,	 // 0x0d8c
- 2996,	 // 0x0bb4
- 3115,	 // 0x0c2b
- 2968,	 // 0x0b98
- 3426,	 // 0x0d62
- 2954,	 // 0x0b8a
- 3183,	 // 0x0c6f
- 3160,	 // 0x0c58
- 3470,	 // 0x0d8e
- 3251,	 // 0x0cb3
- 3084,	 // 0x0c0c
- 2970,	 // 0x0b9a
- 3379,	 // 0x0d33
- 3083,	 // 0x0c0b
- 2913,	 // 0x0b61
- 2963,	 // 0x0b93
- 3413,	 // 0x0d55
- 3100,	 // 0x0c1c
- 2879,	 // 0x0b3f
- 3168,	 // 0x0c60
- 3517,	 // 0x0dbd
- 3234,	 // 0x0ca2
- 3070,	 // 0x0bfe
- 3466,	 // 0x0d8a
- 3152,	 // 0x0c50
- 3021,	 // 0x0bcd
- 3158,	 // 0x0c56
- 3258,	 // 0x0cba
- 2958,	 // 0x0b8e
- 2781,	 // 0x0add
- 2926,	 // 0x0b6e
- 2636,	 // 0x0a4c
- 2816,	 // 0x0b00
- 3112,	 // 0x0c28
- 2762,	 // 0x0aca
-    1,	 // 0x0001
-    2,	 // 0x0002
-    1,	 // 0x0001
-    3,	 // 0x0003
-    1,	 // 0x0001
-    4,	 // 0x0004
-    1,	 // 0x0001
-    6,	 // 0x0006
-    1,	 // 0x0001
-    5,	 // 0x0005
-  167,	 // 0x00a7
-    1,	 // 0x0001
-    3,	 // 0x0003
-    1,	 // 0x0001
-  167,	 // 0x00a7
-    1,	 // 0x0001
-    3,	 // 0x0003
-    3,	 // 0x0003
-  167,	 // 0x00a7
-    1,	 // 0x0001
-    3,	 // 0x0003
-    4,	 // 0x0004
-  167,	 // 0x00a7
-    1,	 // 0x0001
-    3,	 // 0x0003
-    2,	 // 0x0002
-   25,	 // 0x0019
-   15,	 // 0x000f
-   14,	 // 0x000e
-   12,	 // 0x000c
-   10,	 // 0x000a
-    7,	 // 0x0007
-    3,	 // 0x0003
-    0,	 // 0x0000
-65535,	 // 0xffff
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
- 3984,	 // 0x0f90
-   32,	 // 0x0020
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  128,	 // 0x0080
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-   32,	 // 0x0020
-  128,	 // 0x0080
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  128,	 // 0x0080
-   32,	 // 0x0020
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  128,	 // 0x0080
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  184,	 // 0x00b8
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-   28,	 // 0x001c
-  251,	 // 0x00fb
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  232,	 // 0x00e8
-   34,	 // 0x0022
-  170,	 // 0x00aa
-   32,	 // 0x0020
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   34,	 // 0x0022
-  170,	 // 0x00aa
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   30,	 // 0x001e
-  196,	 // 0x00c4
-    0,	 // 0x0000
-    0,	 // 0x0000
-   31,	 // 0x001f
-  112,	 // 0x0070
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   35,	 // 0x0023
-  118,	 // 0x0076
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  233,	 // 0x00e9
-   40,	 // 0x0028
-  143,	 // 0x008f
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   30,	 // 0x001e
-  196,	 // 0x00c4
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   39,	 // 0x0027
-  172,	 // 0x00ac
-   39,	 // 0x0027
-  172,	 // 0x00ac
-   39,	 // 0x0027
-  172,	 // 0x00ac
-   39,	 // 0x0027
-  172,	 // 0x00ac
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   40,	 // 0x0028
-  143,	 // 0x008f
-   40,	 // 0x0028
-  143,	 // 0x008f
-   40,	 // 0x0028
-  143,	 // 0x008f
-   40,	 // 0x0028
-  143,	 // 0x008f
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   32,	 // 0x0020
-  233,	 // 0x00e9
-   32,	 // 0x0020
-  233,	 // 0x00e9
-   32,	 // 0x0020
-  233,	 // 0x00e9
-   32,	 // 0x0020
-  233,	 // 0x00e9
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   33,	 // 0x0021
-  171,	 // 0x00ab
-   33,	 // 0x0021
-  171,	 // 0x00ab
-   33,	 // 0x0021
-  171,	 // 0x00ab
-   33,	 // 0x0021
-  171,	 // 0x00ab
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-    0,	 // 0x0000
-   25,	 // 0x0019
-    0,	 // 0x0000
-   12,	 // 0x000c
-32768,	 // 0x8000
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-   11,	 // 0x000b
-    2,	 // 0x0002
-    0,	 // 0x0000
-    0,	 // 0x0000
-    1,	 // 0x0001
-   10,	 // 0x000a
-    6,	 // 0x0006
-32770,	 // 0x8002
-   25,	 // 0x0019
-    0,	 // 0x0000
-   15,	 // 0x000f
-32772,	 // 0x8004
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-   14,	 // 0x000e
-    5,	 // 0x0005
-    3,	 // 0x0003
-    0,	 // 0x0000
-    1,	 // 0x0001
-   13,	 // 0x000d
-    6,	 // 0x0006
-32774,	 // 0x8006
-   16,	 // 0x0010
-    0,	 // 0x0000
-   18,	 // 0x0012
-32776,	 // 0x8008
-32778,	 // 0x800a
-   25,	 // 0x0019
-    1,	 // 0x0001
-   43,	 // 0x002b
-32780,	 // 0x800c
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-   17,	 // 0x0011
-    9,	 // 0x0009
-    6,	 // 0x0006
-    0,	 // 0x0000
-    0,	 // 0x0000
-   16,	 // 0x0010
-   17,	 // 0x0011
-32782,	 // 0x800e
-   25,	 // 0x0019
-    1,	 // 0x0001
-   40,	 // 0x0028
-32784,	 // 0x8010
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-   45,	 // 0x002d
-   16,	 // 0x0010
-    7,	 // 0x0007
-   25,	 // 0x0019
-    2,	 // 0x0002
-   61,	 // 0x003d
-32786,	 // 0x8012
-65535,	 // 0xffff
-    0,	 // 0x0000
-    0,	 // 0x0000
-   42,	 // 0x002a
-   19,	 // 0x0013
-   10,	 // 0x000a
-   25,	 // 0x0019
-    3,	 // 0x0003
-   52,	 // 0x0034
-32788,	 // 0x8014
-65535,	 // 0xffff
-   25,	 // 0x0019
-    3,	 // 0x0003
-   58,	 // 0x003a
-32790,	 // 0x8016
-65535,	 // 0xffff
-    0,	 // 0x0000
-    1,	 // 0x0001
-   44,	 // 0x002c
-   20,	 // 0x0014
-32792,	 // 0x8018
-   16,	 // 0x0010
-    2,	 // 0x0002
-   49,	 // 0x0031
-32794,	 // 0x801a
-    9,	 // 0x0009
-    0,	 // 0x0000
-    1,	 // 0x0001
-   54,	 // 0x0036
-   23,	 // 0x0017
-   14,	 // 0x000e
-    0,	 // 0x0000
-    1,	 // 0x0001
-   41,	 // 0x0029
-   20,	 // 0x0014
-32796,	 // 0x801c
-   16,	 // 0x0010
-    0,	 // 0x0000
-   46,	 // 0x002e
-32798,	 // 0x801e
-32800,	 // 0x8020
-    0,	 // 0x0000
-    1,	 // 0x0001
-   51,	 // 0x0033
-   26,	 // 0x001a
-   17,	 // 0x0011
-    0,	 // 0x0000
-    1,	 // 0x0001
-   48,	 // 0x0030
-   28,	 // 0x001c
-   20,	 // 0x0014
-    0,	 // 0x0000
-    1,	 // 0x0001
-   53,	 // 0x0035
-   33,	 // 0x0021
-32802,	 // 0x8022
-    0,	 // 0x0000
-    0,	 // 0x0000
-   63,	 // 0x003f
-   31,	 // 0x001f
-   12,	 // 0x000c
-   25,	 // 0x0019
-    2,	 // 0x0002
-   55,	 // 0x0037
-32804,	 // 0x8024
-65535,	 // 0xffff
-    0,	 // 0x0000
-    2,	 // 0x0002
-   50,	 // 0x0032
-   37,	 // 0x0025
-32806,	 // 0x8026
-    0,	 // 0x0000
-    0,	 // 0x0000
-   60,	 // 0x003c
-   32,	 // 0x0020
-   15,	 // 0x000f
-    0,	 // 0x0000
-    0,	 // 0x0000
-   47,	 // 0x002f
-   30,	 // 0x001e
-32808,	 // 0x8028
-    0,	 // 0x0000
-    1,	 // 0x0001
-   57,	 // 0x0039
-   35,	 // 0x0023
-   25,	 // 0x0019
-   16,	 // 0x0010
-    2,	 // 0x0002
-   27,	 // 0x001b
-32810,	 // 0x802a
-   28,	 // 0x001c
-    0,	 // 0x0000
-    1,	 // 0x0001
-   62,	 // 0x003e
-   40,	 // 0x0028
-32812,	 // 0x802c
-    0,	 // 0x0000
-    1,	 // 0x0001
-   59,	 // 0x003b
-   33,	 // 0x0021
-32814,	 // 0x802e
-   16,	 // 0x0010
-    0,	 // 0x0000
-   64,	 // 0x0040
-32816,	 // 0x8030
-32818,	 // 0x8032
-    0,	 // 0x0000
-    1,	 // 0x0001
-   26,	 // 0x001a
-   38,	 // 0x0026
-   30,	 // 0x001e
-    0,	 // 0x0000
-    1,	 // 0x0001
-   56,	 // 0x0038
-   40,	 // 0x0028
-32820,	 // 0x8034
-    0,	 // 0x0000
-    1,	 // 0x0001
-   66,	 // 0x0042
-   39,	 // 0x0027
-   33,	 // 0x0021
-   16,	 // 0x0010
-    2,	 // 0x0002
-   33,	 // 0x0021
-32822,	 // 0x8036
-   26,	 // 0x001a
-    0,	 // 0x0000
-    2,	 // 0x0002
-   25,	 // 0x0019
-   44,	 // 0x002c
-32824,	 // 0x8038
-    0,	 // 0x0000
-    0,	 // 0x0000
-   65,	 // 0x0041
-   42,	 // 0x002a
-32826,	 // 0x803a
-   16,	 // 0x0010
-    0,	 // 0x0000
-   70,	 // 0x0046
-32828,	 // 0x803c
-32830,	 // 0x803e
-    0,	 // 0x0000
-    2,	 // 0x0002
-   32,	 // 0x0020
-   46,	 // 0x002e
-   37,	 // 0x0025
-   16,	 // 0x0010
-    2,	 // 0x0002
-   67,	 // 0x0043
-32832,	 // 0x8040
-   39,	 // 0x0027
-    0,	 // 0x0000
-    1,	 // 0x0001
-   72,	 // 0x0048
-   47,	 // 0x002f
-   40,	 // 0x0028
-   16,	 // 0x0010
-    3,	 // 0x0003
-   39,	 // 0x0027
-32834,	 // 0x8042
-   38,	 // 0x0026
-    0,	 // 0x0000
-    1,	 // 0x0001
-   69,	 // 0x0045
-   49,	 // 0x0031
-   42,	 // 0x002a
-    0,	 // 0x0000
-    2,	 // 0x0002
-   31,	 // 0x001f
-   51,	 // 0x0033
-32836,	 // 0x8044
-    0,	 // 0x0000
-    0,	 // 0x0000
-   71,	 // 0x0047
-   52,	 // 0x0034
-32838,	 // 0x8046
-    0,	 // 0x0000
-    4,	 // 0x0004
-   38,	 // 0x0026
-   50,	 // 0x0032
-   44,	 // 0x002c
-    0,	 // 0x0000
-    2,	 // 0x0002
-   68,	 // 0x0044
-   53,	 // 0x0035
-32840,	 // 0x8048
-    0,	 // 0x0000
-    3,	 // 0x0003
-   37,	 // 0x0025
-   56,	 // 0x0038
-32842,	 // 0x804a
-   16,	 // 0x0010
-    4,	 // 0x0004
-   24,	 // 0x0018
-32844,	 // 0x804c
-   46,	 // 0x002e
-   16,	 // 0x0010
-    2,	 // 0x0002
-   79,	 // 0x004f
-32846,	 // 0x804e
-   47,	 // 0x002f
-   16,	 // 0x0010
-    1,	 // 0x0001
-   76,	 // 0x004c
-32848,	 // 0x8050
-   49,	 // 0x0031
-    0,	 // 0x0000
-    1,	 // 0x0001
-   81,	 // 0x0051
-   59,	 // 0x003b
-   52,	 // 0x0034
-    0,	 // 0x0000
-    4,	 // 0x0004
-   23,	 // 0x0017
-   60,	 // 0x003c
-   51,	 // 0x0033
-   16,	 // 0x0010
-    2,	 // 0x0002
-   73,	 // 0x0049
-32850,	 // 0x8052
-   50,	 // 0x0032
-    0,	 // 0x0000
-    0,	 // 0x0000
-   78,	 // 0x004e
-   61,	 // 0x003d
-   53,	 // 0x0035
-    0,	 // 0x0000
-    1,	 // 0x0001
-   75,	 // 0x004b
-   63,	 // 0x003f
-   56,	 // 0x0038
-    0,	 // 0x0000
-    2,	 // 0x0002
-   80,	 // 0x0050
-   62,	 // 0x003e
-32852,	 // 0x8054
-    0,	 // 0x0000
-    4,	 // 0x0004
-   22,	 // 0x0016
-   65,	 // 0x0041
-32854,	 // 0x8056
-    0,	 // 0x0000
-    1,	 // 0x0001
-   77,	 // 0x004d
-   67,	 // 0x0043
-32856,	 // 0x8058
-   16,	 // 0x0010
-    2,	 // 0x0002
-   82,	 // 0x0052
-32858,	 // 0x805a
-   59,	 // 0x003b
-    0,	 // 0x0000
-    2,	 // 0x0002
-   74,	 // 0x004a
-   70,	 // 0x0046
-32860,	 // 0x805c
-    0,	 // 0x0000
-    1,	 // 0x0001
-   84,	 // 0x0054
-   66,	 // 0x0042
-   62,	 // 0x003e
-   16,	 // 0x0010
-    2,	 // 0x0002
-    3,	 // 0x0003
-32862,	 // 0x805e
-   60,	 // 0x003c
-    0,	 // 0x0000
-    2,	 // 0x0002
-   83,	 // 0x0053
-   72,	 // 0x0048
-32864,	 // 0x8060
-   16,	 // 0x0010
-    0,	 // 0x0000
-   85,	 // 0x0055
-32866,	 // 0x8062
-   61,	 // 0x003d
-    0,	 // 0x0000
-    4,	 // 0x0004
-    2,	 // 0x0002
-   71,	 // 0x0047
-   65,	 // 0x0041
-    0,	 // 0x0000
-    1,	 // 0x0001
-   87,	 // 0x0057
-   74,	 // 0x004a
-   67,	 // 0x0043
-   16,	 // 0x0010
-    1,	 // 0x0001
-    9,	 // 0x0009
-32868,	 // 0x8064
-   63,	 // 0x003f
-    0,	 // 0x0000
-    2,	 // 0x0002
-    1,	 // 0x0001
-   73,	 // 0x0049
-32870,	 // 0x8066
-   16,	 // 0x0010
-    4,	 // 0x0004
-    6,	 // 0x0006
-32872,	 // 0x8068
-   66,	 // 0x0042
-   16,	 // 0x0010
-    1,	 // 0x0001
-   21,	 // 0x0015
-32874,	 // 0x806a
-   71,	 // 0x0047
-    0,	 // 0x0000
-    0,	 // 0x0000
-   86,	 // 0x0056
-   76,	 // 0x004c
-32876,	 // 0x806c
-    0,	 // 0x0000
-    0,	 // 0x0000
-    8,	 // 0x0008
-   80,	 // 0x0050
-   70,	 // 0x0046
-   16,	 // 0x0010
-    2,	 // 0x0002
-   88,	 // 0x0058
-32878,	 // 0x806e
-   74,	 // 0x004a
-    0,	 // 0x0000
-    3,	 // 0x0003
-    5,	 // 0x0005
-   81,	 // 0x0051
-   72,	 // 0x0048
-    0,	 // 0x0000
-    2,	 // 0x0002
-   20,	 // 0x0014
-   82,	 // 0x0052
-   73,	 // 0x0049
-    0,	 // 0x0000
-    4,	 // 0x0004
-   90,	 // 0x005a
-   83,	 // 0x0053
-   76,	 // 0x004c
-    0,	 // 0x0000
-    1,	 // 0x0001
-    7,	 // 0x0007
-   84,	 // 0x0054
-32880,	 // 0x8070
-    0,	 // 0x0000
-    4,	 // 0x0004
-    4,	 // 0x0004
-   87,	 // 0x0057
-32882,	 // 0x8072
-    0,	 // 0x0000
-    1,	 // 0x0001
-   19,	 // 0x0013
-   85,	 // 0x0055
-32884,	 // 0x8074
-    0,	 // 0x0000
-    2,	 // 0x0002
-   89,	 // 0x0059
-   86,	 // 0x0056
-32886,	 // 0x8076
-   16,	 // 0x0010
-    2,	 // 0x0002
-   30,	 // 0x001e
-32888,	 // 0x8078
-   80,	 // 0x0050
-   16,	 // 0x0010
-    2,	 // 0x0002
-   30,	 // 0x001e
-32890,	 // 0x807a
-   82,	 // 0x0052
-   16,	 // 0x0010
-    2,	 // 0x0002
-   30,	 // 0x001e
-32892,	 // 0x807c
-   83,	 // 0x0053
-   16,	 // 0x0010
-    2,	 // 0x0002
-   30,	 // 0x001e
-32894,	 // 0x807e
-   81,	 // 0x0051
-    0,	 // 0x0000
-    1,	 // 0x0001
-   29,	 // 0x001d
-   92,	 // 0x005c
-   84,	 // 0x0054
-    0,	 // 0x0000
-    1,	 // 0x0001
-   29,	 // 0x001d
-   93,	 // 0x005d
-   85,	 // 0x0055
-    0,	 // 0x0000
-    1,	 // 0x0001
-   29,	 // 0x001d
-   95,	 // 0x005f
-   86,	 // 0x0056
-    0,	 // 0x0000
-    1,	 // 0x0001
-   29,	 // 0x001d
-   94,	 // 0x005e
-   87,	 // 0x0057
-    0,	 // 0x0000
-    2,	 // 0x0002
-   28,	 // 0x001c
-   96,	 // 0x0060
-32896,	 // 0x8080
-    0,	 // 0x0000
-    2,	 // 0x0002
-   28,	 // 0x001c
-   97,	 // 0x0061
-32898,	 // 0x8082
-    0,	 // 0x0000
-    2,	 // 0x0002
-   28,	 // 0x001c
-   98,	 // 0x0062
-32900,	 // 0x8084
-    0,	 // 0x0000
-    2,	 // 0x0002
-   28,	 // 0x001c
-   99,	 // 0x0063
-32902,	 // 0x8086
-   16,	 // 0x0010
-    1,	 // 0x0001
-   91,	 // 0x005b
-32904,	 // 0x8088
-   92,	 // 0x005c
-   16,	 // 0x0010
-    1,	 // 0x0001
-   91,	 // 0x005b
-32906,	 // 0x808a
-   93,	 // 0x005d
-   16,	 // 0x0010
-    1,	 // 0x0001
-   91,	 // 0x005b
-32908,	 // 0x808c
-   94,	 // 0x005e
-   16,	 // 0x0010
-    1,	 // 0x0001
-   91,	 // 0x005b
-32910,	 // 0x808e
-   95,	 // 0x005f
-    0,	 // 0x0000
-    2,	 // 0x0002
-   93,	 // 0x005d
-  104,	 // 0x0068
-   96,	 // 0x0060
-    0,	 // 0x0000
-    2,	 // 0x0002
-   93,	 // 0x005d
-  105,	 // 0x0069
-   97,	 // 0x0061
-    0,	 // 0x0000
-    2,	 // 0x0002
-   93,	 // 0x005d
-  107,	 // 0x006b
-   98,	 // 0x0062
-    0,	 // 0x0000
-    2,	 // 0x0002
-   93,	 // 0x005d
-  106,	 // 0x006a
-   99,	 // 0x0063
-    0,	 // 0x0000
-    1,	 // 0x0001
-   92,	 // 0x005c
-  108,	 // 0x006c
-32912,	 // 0x8090
-    0,	 // 0x0000
-    1,	 // 0x0001
-   92,	 // 0x005c
-  109,	 // 0x006d
-32914,	 // 0x8092
-    0,	 // 0x0000
-    1,	 // 0x0001
-   92,	 // 0x005c
-  110,	 // 0x006e
-32916,	 // 0x8094
-    0,	 // 0x0000
-    1,	 // 0x0001
-   92,	 // 0x005c
-  111,	 // 0x006f
-32918,	 // 0x8096
-   16,	 // 0x0010
-    4,	 // 0x0004
-   94,	 // 0x005e
-32920,	 // 0x8098
-  104,	 // 0x0068
-   16,	 // 0x0010
-    4,	 // 0x0004
-   94,	 // 0x005e
-32922,	 // 0x809a
-  105,	 // 0x0069
-   16,	 // 0x0010
-    4,	 // 0x0004
-   94,	 // 0x005e
-32924,	 // 0x809c
-  106,	 // 0x006a
-   16,	 // 0x0010
-    4,	 // 0x0004
-   94,	 // 0x005e
-32926,	 // 0x809e
-  107,	 // 0x006b
-    0,	 // 0x0000
-    3,	 // 0x0003
-   96,	 // 0x0060
-  116,	 // 0x0074
-  108,	 // 0x006c
-    0,	 // 0x0000
-    3,	 // 0x0003
-   96,	 // 0x0060
-  117,	 // 0x0075
-  109,	 // 0x006d
-    0,	 // 0x0000
-    3,	 // 0x0003
-   96,	 // 0x0060
-  118,	 // 0x0076
-  110,	 // 0x006e
-    0,	 // 0x0000
-    3,	 // 0x0003
-   96,	 // 0x0060
-  119,	 // 0x0077
-  111,	 // 0x006f
-    0,	 // 0x0000
-    4,	 // 0x0004
-   95,	 // 0x005f
-  121,	 // 0x0079
-32928,	 // 0x80a0
-    0,	 // 0x0000
-    4,	 // 0x0004
-   95,	 // 0x005f
-  120,	 // 0x0078
-32930,	 // 0x80a2
-    0,	 // 0x0000
-    4,	 // 0x0004
-   95,	 // 0x005f
-  123,	 // 0x007b
-32932,	 // 0x80a4
-    0,	 // 0x0000
-    4,	 // 0x0004
-   95,	 // 0x005f
-  122,	 // 0x007a
-32934,	 // 0x80a6
-   16,	 // 0x0010
-    2,	 // 0x0002
-   36,	 // 0x0024
-32936,	 // 0x80a8
-  117,	 // 0x0075
-   16,	 // 0x0010
-    2,	 // 0x0002
-   36,	 // 0x0024
-32938,	 // 0x80aa
-  116,	 // 0x0074
-   16,	 // 0x0010
-    2,	 // 0x0002
-   36,	 // 0x0024
-32940,	 // 0x80ac
-  119,	 // 0x0077
-   16,	 // 0x0010
-    2,	 // 0x0002
-   36,	 // 0x0024
-32942,	 // 0x80ae
-  118,	 // 0x0076
-    0,	 // 0x0000
-    1,	 // 0x0001
-   35,	 // 0x0023
-  130,	 // 0x0082
-  120,	 // 0x0078
-    0,	 // 0x0000
-    1,	 // 0x0001
-   35,	 // 0x0023
-  129,	 // 0x0081
-  121,	 // 0x0079
-    0,	 // 0x0000
-    1,	 // 0x0001
-   35,	 // 0x0023
-  128,	 // 0x0080
-  122,	 // 0x007a
-    0,	 // 0x0000
-    1,	 // 0x0001
-   35,	 // 0x0023
-  131,	 // 0x0083
-  123,	 // 0x007b
-    0,	 // 0x0000
-    2,	 // 0x0002
-   34,	 // 0x0022
-65535,	 // 0xffff
-32944,	 // 0x80b0
-    0,	 // 0x0000
-    2,	 // 0x0002
-   34,	 // 0x0022
-65535,	 // 0xffff
-32946,	 // 0x80b2
-    0,	 // 0x0000
-    2,	 // 0x0002
-   34,	 // 0x0022
-65535,	 // 0xffff
-32948,	 // 0x80b4
-    0,	 // 0x0000
-    2,	 // 0x0002
-   34,	 // 0x0022
-65535,	 // 0xffff
-32950,	 // 0x80b6
-};
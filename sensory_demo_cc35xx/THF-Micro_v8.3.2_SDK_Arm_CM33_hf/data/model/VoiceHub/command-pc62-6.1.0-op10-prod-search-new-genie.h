@@ -13,11 +13,14 @@
  * Project: Command_Set_command
  */
 
-extern const unsigned short gs_en_command_grammarLabel[];
-#ifndef CMDNETLABEL
-#define CMDNETLABEL
-extern const unsigned short dnn_en_command_netLabel[];
-#endif
+/* Generated by tools/model_c2bin.py, do not edit. The data is in the .bin
+ * files next to this header, embedded by models.S. */
+
+#ifndef __COMMAND_PC62_6_1_0_OP10_PROD_SEARCH_NEW_GENIE_H__
+#define __COMMAND_PC62_6_1_0_OP10_PROD_SEARCH_NEW_GENIE_H__
+
+extern const unsigned short gs_en_command_grammarLabel[1543];
+extern const unsigned short dnn_en_command_netLabel[35498];
 
 /* The following phrases (Hex format) correspond to the word IDs emitted by the recognizer. */
 #define COMMAND_PHRASE_COUNT 6
@@ -27,3 +30,6 @@ extern const unsigned short dnn_en_command_netLabel[];
 #define COMMAND_PHRASE_3 "\x74\x6F\x67\x67\x6C\x65\x5F\x62\x6C\x75\x65\x5F\x6C\x65\x64"	/* Phrase: toggle_blue_led */
 #define COMMAND_PHRASE_4 "\x74\x6F\x67\x67\x6C\x65\x5F\x61\x6C\x6C\x5F\x6C\x65\x64"	/* Phrase: toggle_all_led */
 #define COMMAND_PHRASE_5 "nota"	/* Legacy system phrase */
+#define COMMAND_PHRASES { COMMAND_PHRASE_0, COMMAND_PHRASE_1, COMMAND_PHRASE_2, COMMAND_PHRASE_3, COMMAND_PHRASE_4, COMMAND_PHRASE_5 }
+
+#endif // __COMMAND_PC62_6_1_0_OP10_PROD_SEARCH_NEW_GENIE_H__
@@ -13,14 +13,20 @@
  * Project: Door_Lock_and_Unlock_in_English_wakeword
  */
 
-extern const unsigned short gs_wakeword_grammarLabel[];
-#ifndef NETLABEL
-#define NETLABEL
-extern const unsigned short dnn_wakeword_netLabel[];
-#endif
+/* Generated by tools/model_c2bin.py, do not edit. The data is in the .bin
+ * files next to this header, embedded by models.S. */
+
+#ifndef __WAKEWORD_PC60_6_1_0_OP08_PROD_SEARCH_GENIE_H__
+#define __WAKEWORD_PC60_6_1_0_OP08_PROD_SEARCH_GENIE_H__
+
+extern const unsigned short gs_wakeword_grammarLabel[409];
+extern const unsigned short dnn_wakeword_netLabel[69131];
 
 /* The following phrases (Hex format) correspond to the word IDs emitted by the recognizer. */
 #define WAKEWORD_PHRASE_COUNT 3
 #define WAKEWORD_PHRASE_0 "SILENCE"	/* Legacy system phrase */
 #define WAKEWORD_PHRASE_1 "\x76\x6F\x69\x63\x65\x5F\x67\x65\x6E\x69\x65"	/* Phrase: voice_genie */
 #define WAKEWORD_PHRASE_2 "nota"	/* Legacy system phrase */
+#define WAKEWORD_PHRASES { WAKEWORD_PHRASE_0, WAKEWORD_PHRASE_1, WAKEWORD_PHRASE_2 }
+
+#endif // __WAKEWORD_PC60_6_1_0_OP08_PROD_SEARCH_GENIE_H__
@@ -38,6 +38,10 @@
 #include "ti/drivers/dpl/MessageQueueP.h"
 #include "ti/drivers/dpl/ClockP.h"
 #include "ti/drivers/dpl/HwiP.h"
+#include "uart_log.h"
+#include "osi_pool.h"
+#include "osi_heapprof.h"
+#include "osi_lockstat.h"
 #include "FreeRTOS.h"
 #include <time.h>
 
@@ -105,8 +109,9 @@ void ASSERT_GENERAL(unsigned int condition)
 
     if(FALSE == condition)
     {
-        osi_EnterCriticalSection();
         Report("\n\rASSSSEEEERRRTTT!!!! in 0x%x\n\r",lr);
+        UartLog_flush(); //the UART needs interrupts, send the log before masking them
+        osi_EnterCriticalSection();
         while(1);
     }
 }
@@ -213,6 +218,7 @@ OsiReturnVal_e osi_SyncObjDelete(OsiSyncObj_t* pSyncObj)
 
     SemaphoreP_Handle *pl_SyncObj = (SemaphoreP_Handle *)pSyncObj;
 
+    LockStat_forget(*pl_SyncObj);
     SemaphoreP_delete(*pl_SyncObj);
     return OSI_OK;
 }
@@ -293,7 +299,7 @@ OsiReturnVal_e osi_SyncObjWait(OsiSyncObj_t* pSyncObj , OsiTime_t Timeout)
     }
 
     SemaphoreP_Handle *pl_SyncObj = (SemaphoreP_Handle *)pSyncObj;
-    if(SemaphoreP_OK == SemaphoreP_pend(*pl_SyncObj, (uint32_t)Timeout))
+    if(SemaphoreP_OK == LockStat_pend(*pl_SyncObj, LOCK_STAT_SYNC, *pl_SyncObj, (uint32_t)Timeout))
     {
         return OSI_OK;
     }
@@ -388,6 +394,7 @@ OsiReturnVal_e osi_LockObjDelete(OsiLockObj_t* pLockObj)
 {
     SemaphoreP_Handle *pl_LockObj = (SemaphoreP_Handle *)pLockObj;
 
+    LockStat_forget(*pl_LockObj);
     SemaphoreP_delete(*pl_LockObj );
     return OSI_OK;
 }
@@ -429,7 +436,7 @@ OsiReturnVal_e osi_LockObjLock(OsiLockObj_t* pLockObj , OsiTime_t Timeout)
     }
 
     SemaphoreP_Handle *pl_LockObj = (SemaphoreP_Handle *)pLockObj;
-    if(SemaphoreP_OK == SemaphoreP_pend(*pl_LockObj, (uint32_t)Timeout))
+    if(SemaphoreP_OK == LockStat_pend(*pl_LockObj, LOCK_STAT_LOCK, *pl_LockObj, (uint32_t)Timeout))
     {
         return OSI_OK;
     }
@@ -458,6 +465,7 @@ OsiReturnVal_e osi_LockObjUnlock(OsiLockObj_t* pLockObj)
 	}
 	//Release Semaphore
     SemaphoreP_Handle *pl_LockObj = (SemaphoreP_Handle *)pLockObj;
+    LockStat_release(*pl_LockObj);
     SemaphoreP_post( *pl_LockObj );
 
    return OSI_OK;
@@ -645,6 +653,53 @@ BOOLEAN osi_MsgQIsEmpty(OsiMsgQ_t* pMsgQ)
 
 ********************************************************************************/
 
+/*!
+    \brief  Take memory from the block pools, or from the heap if no pool fits
+
+    \param  size - in bytes, not 0
+
+    \return - ptr to buffer or NULL
+    \note   The heap is only locked when the pools cannot serve the request
+*/
+static void *os_allocBlock(size_t size)
+{
+    uintptr_t sus_key;
+    void *ptr = NULL;
+
+#if OSI_POOL_ENABLE
+    ptr = OsiPool_alloc(size);
+    if(NULL != ptr)
+    {
+        return ptr;
+    }
+#endif
+    sus_key = TaskP_disableScheduler();
+    ptr = malloc(size);
+    TaskP_restoreScheduler(sus_key);
+
+    return ptr;
+}
+
+/*!
+    \brief  Usable size of a block from os_malloc() and friends
+
+    \param  ptr - block, not NULL
+
+    \return - size in bytes
+    \note   Heap blocks are read from the newlib chunk header, used by the heap
+            debug counters
+*/
+uint32_t os_blockSize(void *ptr)
+{
+    uint32_t size = (uint32_t)OsiPool_blockSize(ptr);
+
+    if(0 != size)
+    {
+        return size;
+    }
+    return (uint32_t)(*((uint32_t *)ptr-2)-1);
+}
+
 /*!
     \brief  Allocate dynamic memory
 
@@ -659,7 +714,12 @@ BOOLEAN osi_MsgQIsEmpty(OsiMsgQ_t* pMsgQ)
 #endif
 void *os_malloc(size_t size)
 {
+#ifdef HEAP_PROFILER
+    uint32_t prof_lr = (uint32_t)__get_LR();
+#endif
+#if defined(COLLECT_HEAP_DEBUG_INFO) || defined(PRINT_DBG_TOTAL_MALLOC_FREE)
     uintptr_t sus_key;
+#endif
     void *ptr = NULL;
 #ifdef COLLECT_HEAP_DEBUG_INFO //OSPREY_MX-17
     uint32_t local_dbg_offset, lr;
@@ -684,10 +744,8 @@ void *os_malloc(size_t size)
 #endif //PRINT_DBG_MALLOC_FREE
     if(0 != size)
     {
-        sus_key = TaskP_disableScheduler();
-        ptr = malloc(size);
-        TaskP_restoreScheduler(sus_key);
-
+        ptr = os_allocBlock(size);
+        HeapProf_alloc(prof_lr, ptr, size);
     }
 #ifdef PRINT_DBG_MALLOC_FREE
     Report("\n\r+++++++++++++MALLOC = 0x%x ++++++++++", (uint32_t)ptr);
@@ -703,7 +761,7 @@ void *os_malloc(size_t size)
 
 #ifdef PRINT_DBG_TOTAL_MALLOC_FREE
     sus_key = TaskP_disableScheduler();
-    totalloc  = totalloc + (uint32_t)(*((uint32_t *)ptr-2) - 1);
+    totalloc  = totalloc + os_blockSize(ptr);
     TaskP_restoreScheduler(sus_key);
     //Report("+++++++++++++ os_malloc total_allloc = %d\n\r", totalloc);
 #endif
@@ -720,7 +778,7 @@ void *os_malloc(size_t size)
     else
     {
         sus_key = TaskP_disableScheduler();
-        heapDbg_total_alloc += (uint32_t)(*((uint32_t *)ptr-2)-1)+8;//(8 overhead)
+        heapDbg_total_alloc += os_blockSize(ptr)+8;//(8 overhead)
         TaskP_restoreScheduler(sus_key);
     }
 #endif
@@ -741,6 +799,9 @@ void *os_malloc(size_t size)
 */
 void* os_realloc(void *ptr, size_t newsize)
 {
+#ifdef HEAP_PROFILER
+    uint32_t prof_lr = (uint32_t)__get_LR();
+#endif
     uintptr_t sus_key;
     void *ptrnew = NULL;
 #ifdef COLLECT_HEAP_DEBUG_INFO //OSPREY_MX-17
@@ -761,8 +822,8 @@ void* os_realloc(void *ptr, size_t newsize)
     heapdebug[local_dbg_offset].ptrOld = (uint32_t)ptr;
     if(ptr)
     {
-        heapdebug[local_dbg_offset].size =(uint32_t)(*((uint32_t *)ptr-2)-1);
-        sizeToRemove = (uint32_t)(*((uint32_t *)ptr-2)-1)+8;
+        heapdebug[local_dbg_offset].size =os_blockSize(ptr);
+        sizeToRemove = os_blockSize(ptr)+8;
     }
 #endif
 
@@ -774,14 +835,46 @@ void* os_realloc(void *ptr, size_t newsize)
 #ifdef PRINT_DBG_TOTAL_MALLOC_FREE
         if (ptr)
         {
-            vsus_key = TaskP_disableScheduler();
-            totalloc  = totalloc - (uint32_t)(*((uint32_t *)ptr-2) - 1);
+            sus_key = TaskP_disableScheduler();
+            totalloc  = totalloc - os_blockSize(ptr);
             TaskP_restoreScheduler(sus_key);
         }
 #endif
-        sus_key = TaskP_disableScheduler();
-        ptrnew = realloc(ptr,newsize);
-        TaskP_restoreScheduler(sus_key);
+#if OSI_POOL_ENABLE
+        size_t oldsize = OsiPool_blockSize(ptr);
+#endif
+        if(NULL == ptr)
+        {
+            //realloc(NULL, n) is malloc(n), small sizes come from the pools as well
+            ptrnew = os_allocBlock(newsize);
+        }
+#if OSI_POOL_ENABLE
+        else if(0 != oldsize)
+        {
+            //Pool block: keep it if the new size still fits, otherwise move
+            if(newsize <= oldsize)
+            {
+                ptrnew = ptr;
+            }
+            else if(NULL != (ptrnew = os_allocBlock(newsize)))
+            {
+                memcpy(ptrnew, ptr, oldsize);
+                OsiPool_free(ptr);
+            }
+        }
+#endif
+        else
+        {
+            sus_key = TaskP_disableScheduler();
+            ptrnew = realloc(ptr,newsize);
+            TaskP_restoreScheduler(sus_key);
+        }
+        //A moved or resized block is charged to the new caller, a failed one stays as it was
+        if(NULL != ptrnew)
+        {
+            HeapProf_free(ptr);
+        }
+        HeapProf_alloc(prof_lr, ptrnew, newsize);
     }
 #ifdef PRINT_DBG_MALLOC_FREE
     Report("\n\r+++++++++++++REALLOC old ptr 0x%x newptr = 0x%x ++++++++++", (uint32_t)ptr,ptrnew);
@@ -796,7 +889,7 @@ void* os_realloc(void *ptr, size_t newsize)
 #endif
 #ifdef PRINT_DBG_TOTAL_MALLOC_FREE
     sus_key = TaskP_disableScheduler();
-    totalloc  = totalloc + (uint32_t)(*((uint32_t *)ptrnew-2) - 1);
+    totalloc  = totalloc + os_blockSize(ptrnew);
     TaskP_restoreScheduler(sus_key);
         //Report("+++++++++++++ os_realloc total_alloc = %d\n\r", totalloc);
 #endif
@@ -814,7 +907,7 @@ void* os_realloc(void *ptr, size_t newsize)
     else
     {
         sus_key = TaskP_disableScheduler();
-        heapDbg_total_alloc +=  ((uint32_t)(*((uint32_t *)ptrnew-2)))+8 - sizeToRemove ;//(8 overhead)
+        heapDbg_total_alloc +=  os_blockSize(ptrnew)+8 - sizeToRemove ;//(8 overhead)
         TaskP_restoreScheduler(sus_key);
     }
 #endif
@@ -852,7 +945,12 @@ void * os_realloc_array(void *ptr, size_t nmemb, size_t size)
 */
 void *os_calloc(size_t nmemb, size_t size)
 {
+#ifdef HEAP_PROFILER
+    uint32_t prof_lr = (uint32_t)__get_LR();
+#endif
+#if defined(COLLECT_HEAP_DEBUG_INFO) || defined(PRINT_DBG_TOTAL_MALLOC_FREE)
     uintptr_t sus_key;
+#endif
     void *ptr = NULL;
 
 #ifdef COLLECT_HEAP_DEBUG_INFO //OSPREY_MX-17
@@ -877,11 +975,14 @@ void *os_calloc(size_t nmemb, size_t size)
 #ifdef PRINT_DBG_MALLOC_FREE   
     Report("\n\r+++++++++++++CALLOC  LR 0x%x ++++++++++", __get_LR());
 #endif //PRINT_DBG_MALLOC_FREE    
-    if(0 != size)
+    if((0 != size) && (0 != nmemb) && (nmemb <= (~(size_t) 0) / size))
     {
-        sus_key = TaskP_disableScheduler();
-        ptr = calloc(nmemb, size);
-        TaskP_restoreScheduler(sus_key);
+        ptr = os_allocBlock(nmemb * size);
+        if(NULL != ptr)
+        {
+            memset(ptr, 0, nmemb * size);
+        }
+        HeapProf_alloc(prof_lr, ptr, nmemb * size);
     }
 
 
@@ -897,7 +998,7 @@ void *os_calloc(size_t nmemb, size_t size)
 #endif
 #ifdef PRINT_DBG_TOTAL_MALLOC_FREE
     sus_key = TaskP_disableScheduler();
-    totalloc  = totalloc + (uint32_t)(*((uint32_t *)ptr-2) - 1);
+    totalloc  = totalloc + os_blockSize(ptr);
     TaskP_restoreScheduler(sus_key);
     //Report("+++++++++++++ os_calloc total_alloc = %d\n\r", totalloc);
 #endif
@@ -914,7 +1015,7 @@ void *os_calloc(size_t nmemb, size_t size)
     else
     {
         sus_key = TaskP_disableScheduler();
-        heapDbg_total_alloc +=  (uint32_t)(*((uint32_t *)ptr-2)-1)+8;
+        heapDbg_total_alloc +=  os_blockSize(ptr)+8;
         TaskP_restoreScheduler(sus_key);
     }
 #endif
@@ -933,7 +1034,12 @@ void *os_calloc(size_t nmemb, size_t size)
 */
 void* os_zalloc(size_t size)
 {
+#ifdef HEAP_PROFILER
+    uint32_t prof_lr = (uint32_t)__get_LR();
+#endif
+#if defined(COLLECT_HEAP_DEBUG_INFO) || defined(PRINT_DBG_TOTAL_MALLOC_FREE)
     uintptr_t sus_key;
+#endif
     void *ptr = NULL;
 
 #ifdef COLLECT_HEAP_DEBUG_INFO //OSPREY_MX-17 //OSPREY_MX-17
@@ -959,9 +1065,12 @@ void* os_zalloc(size_t size)
 #endif //
     if(0 != size)
     {
-        sus_key = TaskP_disableScheduler();
-        ptr = calloc(1,size);
-        TaskP_restoreScheduler(sus_key);
+        ptr = os_allocBlock(size);
+        if(NULL != ptr)
+        {
+            memset(ptr, 0, size);
+        }
+        HeapProf_alloc(prof_lr, ptr, size);
     }
 #ifdef PRINT_DBG_MALLOC_FREE
     Report("\n\r+++++++++++++ZALLOC = 0x%x ++++++++++", (uint32_t)ptr);
@@ -975,7 +1084,7 @@ void* os_zalloc(size_t size)
 #endif
 #ifdef PRINT_DBG_TOTAL_MALLOC_FREE
     sus_key = TaskP_disableScheduler();
-    totalloc  = totalloc + (uint32_t)(*((uint32_t *)ptr-2) - 1);
+    totalloc  = totalloc + os_blockSize(ptr);
     TaskP_restoreScheduler(sus_key);
     Report("\n\r+++++++++++++ os_malloc total_alloc = %d", totalloc);
 #endif
@@ -992,7 +1101,7 @@ void* os_zalloc(size_t size)
     else
     {
         sus_key = TaskP_disableScheduler();
-        heapDbg_total_alloc +=  (uint32_t)(*((uint32_t *)ptr-2)-1)+8;//(8 overhead)
+        heapDbg_total_alloc +=  os_blockSize(ptr)+8;//(8 overhead)
         TaskP_restoreScheduler(sus_key);
     }
 #endif
@@ -1022,12 +1131,12 @@ void os_free(void *ptr)
     dbg_offset++;
     dbg_offset = dbg_offset % HEAP_DBG_SIZE;
     local_dbg_offset = dbg_offset;
-    heapDbg_total_alloc -=  (uint32_t)(*((uint32_t *)ptr-2)-1)+8;//(8 overhead)
+    heapDbg_total_alloc -=  os_blockSize(ptr)+8;//(8 overhead)
     TaskP_restoreScheduler(sus_key);
     heapdebug[local_dbg_offset].isFree = 1;
     heapdebug[local_dbg_offset].isUsed = 1;
     heapdebug[local_dbg_offset].isfinshed = 0;
-    heapdebug[local_dbg_offset].size =(uint32_t)(*((uint32_t *)ptr-2)-1);
+    heapdebug[local_dbg_offset].size =os_blockSize(ptr);
     heapdebug[local_dbg_offset].ptr = (uint32_t)ptr;
     heapdebug[local_dbg_offset].funcId = 5;
     heapdebug[local_dbg_offset].allocFail = 0;
@@ -1040,7 +1149,7 @@ void os_free(void *ptr)
 
 #ifdef PRINT_DBG_TOTAL_MALLOC_FREE
     sus_key = TaskP_disableScheduler();
-    totalloc  = totalloc - (uint32_t)(*((uint32_t *)ptr-2) - 1);
+    totalloc  = totalloc - os_blockSize(ptr);
     TaskP_restoreScheduler(sus_key);
     if(totalloc < 0)
     {
@@ -1052,9 +1161,15 @@ void os_free(void *ptr)
         Report("\n\r+++++++++++++ 2 os_free total_alloc = %d", totalloc);
     }
 #endif
-    sus_key = TaskP_disableScheduler();
-    free(ptr);
-    TaskP_restoreScheduler(sus_key);
+    HeapProf_free(ptr);
+#if OSI_POOL_ENABLE
+    if(!OsiPool_free(ptr))
+#endif
+    {
+        sus_key = TaskP_disableScheduler();
+        free(ptr);
+        TaskP_restoreScheduler(sus_key);
+    }
 #ifdef PRINT_DBG_MALLOC_FREE
     Report("\n\r+++++++++++++FREE DONE = 0x%x ++++++++++", (uint32_t)ptr);
 #endif
@@ -1513,6 +1628,7 @@ OsiReturnVal_e osi_SemaphoreObjDelete(OsiSemaphoreObj_t* pSemaphoreObj)
         return OSI_INVALID_PARAMS;
     }
     SemaphoreP_Handle *pl_SemaphoreObj = (SemaphoreP_Handle *)pSemaphoreObj->Semaphore;
+    LockStat_forget(pSemaphoreObj->Semaphore);
     SemaphoreP_delete(*pl_SemaphoreObj);
     return OSI_OK;
 }
@@ -1549,7 +1665,7 @@ OsiReturnVal_e osi_SemaphoreObjObtain(OsiSemaphoreObj_t* pSemaphoreObj , OsiTime
     }
 
     SemaphoreP_Handle *pl_SemaphoreObj = (SemaphoreP_Handle *)pSemaphoreObj->Semaphore;
-    if(SemaphoreP_OK == SemaphoreP_pend(*pl_SemaphoreObj, (uint32_t)Timeout))
+    if(SemaphoreP_OK == LockStat_pend(pSemaphoreObj->Semaphore, LOCK_STAT_SEM, *pl_SemaphoreObj, (uint32_t)Timeout))
     {
         return OSI_OK;
     }
@@ -0,0 +1,34 @@
+/* Generated by tools/file_table_gen.py from osi_file_table.csv, do not edit */
+
+#ifndef __OSI_FILE_TABLE_H__
+#define __OSI_FILE_TABLE_H__
+
+#define OSI_FILE_HASH_SEED          0x00000011u
+#define OSI_FILE_HASH_BITS          4
+#define OSI_FILE_HASH_SLOTS         (1 << OSI_FILE_HASH_BITS)
+
+static inline uint32_t osiFileHash(const char *name)
+{
+    uint32_t h = OSI_FILE_HASH_SEED;
+
+    while(*name)
+    {
+        h = (h ^ (uint8_t)*name++) * 16777619u;
+    }
+    return h >> (32 - OSI_FILE_HASH_BITS);
+}
+
+static const osiFileDesc_t gOsiFileTable[OSI_FILE_HASH_SLOTS] =
+{
+    [0] = { "cccd", OSI_FILE_BLE_CCCD, NVINTF_SYSID_BLE, NVID_BLE_CCCD_OFFSET_IN_FLASH, 0 },
+    [1] = { "our_sec", OSI_FILE_BLE_OUR_SEC, NVINTF_SYSID_BLE, NVID_BLE_OUR_SEC_OFFSET_IN_FLASH, 0 },
+    [3] = { "cc33xx-conf", OSI_FILE_CONF, 0, 0, 0 },
+    [5] = { "profiles", OSI_FILE_WLAN_PROFILE, NVINTF_SYSID_WIFI, NVID_WLAN_PROFILES_OFFSET_IN_FLASH, 1 },
+    [6] = { "conn_p", OSI_FILE_WLAN_CONNECTION_POLICY, NVINTF_SYSID_WIFI, NVID_WLAN_CONNECTION_POLICY_OFFSET_IN_FLASH, 1 },
+    [7] = { "fw", OSI_FILE_CONNECTIVITY_FW_SLOT_1, 0, 0, 0 },
+    [12] = { ".fast", OSI_FILE_WLAN_FAST_CONNECT, NVINTF_SYSID_WIFI, NVID_WLAN_FAST_CONNECT_OFFSET_IN_FLASH, 1 },
+    [14] = { "peer_sec", OSI_FILE_BLE_PEER_SEC, NVINTF_SYSID_BLE, NVID_BLE_PEER_SEC_OFFSET_IN_FLASH, 0 },
+    [15] = { "rambtlr", OSI_FILE_RAMBTLR, 0, 0, 0 },
+};
+
+#endif // __OSI_FILE_TABLE_H__
@@ -42,6 +42,8 @@
 #include "ti/common/nv/nvintf.h"
 #include "ti/common/nv/nvocmp.h"
 #include "ti_flash_map_config.h"
+#include "osi_fwcache.h"
+#include "osi_nvlog.h"
 
 
 /*!
@@ -80,8 +82,35 @@ typedef struct
 {
     osiInternalType_e ftype;
     void *ptr;
+    NVINTF_itemID_t nvItem;     // ptr points here for NV files
+    uint8_t pooled;             // taken from gFilePool, not from the heap
+    uint8_t log;                // NV file stored as append-only records
 }osiFileP_t;
 
+typedef struct
+{
+    const char *name;
+    osiInternalType_e ftype;
+    uint8_t systemID;
+    uint16_t itemID;
+    uint8_t log;
+}osiFileDesc_t;
+
+/*
+ * File names are looked up in a perfect hash table generated from
+ * osi_file_table.csv by tools/file_table_gen.py: one hash and one strcmp
+ * per osi_fopen(). Open files come from a fixed pool of handles, the heap
+ * is only used when more than OSI_FILE_HANDLES files are open at once.
+ */
+#include "osi_file_table.h"
+
+#ifndef OSI_FILE_HANDLES
+#define OSI_FILE_HANDLES    8
+#endif
+#if OSI_FILE_HANDLES > 31
+#error "OSI_FILE_HANDLES must be less than 32"
+#endif
+
 #define IS_OSI_FILE(osiFileType) ((osiFileType) == OSI_FILE_BLE_OUR_SEC || \
                                     (osiFileType) == OSI_FILE_BLE_PEER_SEC || \
                                     (osiFileType) == OSI_FILE_BLE_CCCD || \
@@ -91,6 +120,9 @@ typedef struct
 
 XMEM_Handle        fwHandle;
 NVINTF_nvFuncts_t *nvFptrs  = NULL;
+static NVINTF_nvFuncts_t nvFuncts;
+static osiFileP_t  gFilePool[OSI_FILE_HANDLES];
+static uint32_t    gFilePoolFree = (1u << OSI_FILE_HANDLES) - 1;   // bit set = handle free
 uint32_t           Fwslot   = OSI_FLASH_CONNECTIVITY_FW_SLOT_1;
 uint32_t           FwGpeDataOffset = 0x101c;
 
@@ -123,6 +155,82 @@ int ATTRIBUTE osi_fget(osiFileGetType containerType, void *params)
     return 0;
 }
 
+static void osiNvInit(void)
+{
+    if(NULL == nvFptrs)
+    {
+        nvFptrs = &nvFuncts;
+        NVOCMP_loadApiPtrs(nvFptrs);
+        if (nvFptrs->initNV(NULL) != 0)
+        {
+            Report("\n\rInit NV failed\n\r");
+            ASSERT_GENERAL(0);
+        }
+    }
+}
+
+/* Readable bytes of a firmware slot, the file starts FwGpeDataOffset into the region */
+static size_t osiFwLength(osiInternalType_e ftype)
+{
+    uint32_t size = (ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_2) ? wifi_connectivity_slot_2_region_size :
+                                                                   wifi_connectivity_slot_1_region_size;
+
+    return (size > FwGpeDataOffset) ? (size - FwGpeDataOffset) : 0;
+}
+
+/* Bytes of a file of length total that a read of len at offset returns */
+static size_t osiClampRead(size_t total, size_t offset, size_t len)
+{
+    if(offset >= total)
+    {
+        return 0;
+    }
+    return (len < total - offset) ? len : (total - offset);
+}
+
+static osiFileP_t *osiFileAlloc(void)
+{
+    osiFileP_t *osiFile = NULL;
+    uint32_t key = osi_EnterCritical();
+
+    if(gFilePoolFree != 0)
+    {
+        uint32_t i = __builtin_ctz(gFilePoolFree);
+
+        gFilePoolFree &= ~(1u << i);
+        osiFile = &gFilePool[i];
+    }
+    osi_ExitCritical(key);
+
+    if(NULL != osiFile)
+    {
+        osiFile->pooled = 1;
+    }
+    else
+    {
+        osiFile = os_malloc(sizeof(osiFileP_t));
+        if(NULL != osiFile)
+        {
+            osiFile->pooled = 0;
+        }
+    }
+    return osiFile;
+}
+
+static void osiFileFree(osiFileP_t *osiFile)
+{
+    if(osiFile->pooled)
+    {
+        uint32_t key = osi_EnterCritical();
+        gFilePoolFree |= 1u << (osiFile - gFilePool);
+        osi_ExitCritical(key);
+    }
+    else
+    {
+        os_free(osiFile);
+    }
+}
+
 int ATTRIBUTE osi_fclose(FILE *_fp)
 {
     osiFileP_t *osiFile;
@@ -135,54 +243,45 @@ int ATTRIBUTE osi_fclose(FILE *_fp)
 
     if((osiFile->ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_1) || (osiFile->ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_2))
     {
+        FwCache_close();
         XMEMWFF3_close((XMEM_Handle)osiFile->ptr);
     }
     else if((osiFile->ftype == OSI_FILE_BLE_OUR_SEC) || (osiFile->ftype == OSI_FILE_BLE_PEER_SEC) || (osiFile->ftype == OSI_FILE_BLE_CCCD))
     {
-        if(osiFile->ptr != NULL)
-        {
-            nvFptrs->deleteItem((*(NVINTF_itemID_t *)osiFile->ptr));
-            os_free(osiFile->ptr);
-        }
+        nvFptrs->deleteItem(osiFile->nvItem);
     }
-    else if((osiFile->ftype == OSI_FILE_WLAN_FAST_CONNECT) || (osiFile->ftype == OSI_FILE_WLAN_CONNECTION_POLICY) || (osiFile->ftype == OSI_FILE_WLAN_PROFILE))
-    {
-        if(osiFile->ptr != NULL)
-        {
-            os_free(osiFile->ptr);
-        }
-    }
-    os_free(_fp);
+    osiFileFree(osiFile);
     return 0;
 }
 
 FILE * ATTRIBUTE osi_fopen(const char *_fname, const char *_mode)
 {
-    osiFileP_t      *osiFile = NULL;
-    NVINTF_itemID_t *nvItem = NULL;
-    XMEM_Params      params;
+    osiFileP_t          *osiFile = NULL;
+    const osiFileDesc_t *desc;
+    XMEM_Params          params;
 
-    if(NULL == nvFptrs)
+    osiNvInit();
+
+    desc = &gOsiFileTable[osiFileHash(_fname)];
+    if((NULL == desc->name) || (strcmp(desc->name, _fname) != 0))
     {
-        nvFptrs = os_malloc(sizeof(NVINTF_nvFuncts_t));
-        NVOCMP_loadApiPtrs(nvFptrs);
-        if (nvFptrs->initNV(NULL) != 0)
-        {
-            Report("\n\rInit NV failed\n\r");
-            ASSERT_GENERAL(0);
-        }
+        return (FILE *)(NULL);
     }
 
-    if(strcmp("rambtlr",_fname) == 0)
+    osiFile = osiFileAlloc();
+    if(NULL == osiFile)
+    {
+        return (FILE *)(NULL);
+    }
+    osiFile->ftype = desc->ftype;
+    osiFile->log = desc->log;
+
+    if(desc->ftype == OSI_FILE_RAMBTLR)
     {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        osiFile->ftype = OSI_FILE_RAMBTLR;
         osiFile->ptr = NULL;
-        return (FILE *)(osiFile);
     }
-    else if(strcmp("fw",_fname) == 0)
+    else if(desc->ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_1)
     {
-        osiFile = os_malloc(sizeof(osiFileP_t));
         if(Fwslot == OSI_FLASH_CONNECTIVITY_FW_SLOT_1)
         {
             osiFile->ftype = OSI_FILE_CONNECTIVITY_FW_SLOT_1;
@@ -191,6 +290,7 @@ FILE * ATTRIBUTE osi_fopen(const char *_fname, const char *_mode)
             params.regionSize = wifi_connectivity_slot_1_region_size;
             params.deviceNum = 0;
             fwHandle = XMEMWFF3_open(&params);
+            FwCache_open(fwHandle, params.regionSize);
         }
         else if(Fwslot == OSI_FLASH_CONNECTIVITY_FW_SLOT_2)
         {
@@ -200,85 +300,22 @@ FILE * ATTRIBUTE osi_fopen(const char *_fname, const char *_mode)
             params.regionSize = wifi_connectivity_slot_2_region_size;
             params.deviceNum = 0;
             fwHandle = XMEMWFF3_open(&params);
+            FwCache_open(fwHandle, params.regionSize);
         }
         osiFile->ptr = (void *)fwHandle;
-        return (FILE *)(osiFile);
     }
-    else if(strcmp("cc33xx-conf",_fname) == 0)
+    else if(desc->ftype == OSI_FILE_CONF)
     {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        osiFile->ftype = OSI_FILE_CONF;
         osiFile->ptr = (void *)gINIbuffer;
-        return (FILE *)(osiFile);
-    }
-    else if(strcmp("our_sec",_fname) == 0)
-    {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        nvItem = os_malloc(sizeof(NVINTF_itemID_t));
-        osiFile->ftype = OSI_FILE_BLE_OUR_SEC;
-        nvItem->itemID = NVID_BLE_OUR_SEC_OFFSET_IN_FLASH;
-        nvItem->systemID = NVINTF_SYSID_BLE;
-        nvItem->subID = 0;
-        osiFile->ptr = nvItem;
-        return (FILE *)(osiFile);
-    }
-    else if(strcmp("peer_sec",_fname) == 0)
-    {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        nvItem = os_malloc(sizeof(NVINTF_itemID_t));
-        osiFile->ftype = OSI_FILE_BLE_PEER_SEC;
-        nvItem->itemID = NVID_BLE_PEER_SEC_OFFSET_IN_FLASH;
-        nvItem->systemID = NVINTF_SYSID_BLE;
-        nvItem->subID = 0;
-        osiFile->ptr = nvItem;
-        return (FILE *)(osiFile);
-    }
-    else if(strcmp("cccd", _fname) == 0)
-    {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        nvItem = os_malloc(sizeof(NVINTF_itemID_t));
-        osiFile->ftype = OSI_FILE_BLE_CCCD;
-        nvItem->itemID = NVID_BLE_CCCD_OFFSET_IN_FLASH;
-        nvItem->systemID = NVINTF_SYSID_BLE;
-        nvItem->subID = 0;
-        osiFile->ptr = nvItem;
-        return (FILE *)(osiFile);
-    }
-    else if(strcmp("conn_p", _fname) == 0)
-    {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        nvItem = os_malloc(sizeof(NVINTF_itemID_t));
-        osiFile->ftype = OSI_FILE_WLAN_CONNECTION_POLICY;
-        nvItem->itemID = NVID_WLAN_CONNECTION_POLICY_OFFSET_IN_FLASH;
-        nvItem->systemID = NVINTF_SYSID_WIFI;
-        nvItem->subID = 0;
-        osiFile->ptr = nvItem;
-        return (FILE *)(osiFile);
     }
-    else if(strcmp("profiles", _fname) == 0)
+    else
     {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        nvItem = os_malloc(sizeof(NVINTF_itemID_t));
-        osiFile->ftype = OSI_FILE_WLAN_PROFILE;
-        nvItem->itemID = NVID_WLAN_PROFILES_OFFSET_IN_FLASH;
-        nvItem->systemID = NVINTF_SYSID_WIFI;
-        nvItem->subID = 0;
-        osiFile->ptr = nvItem;
-        return (FILE *)(osiFile);
-    }
-    else if(strcmp(".fast", _fname) == 0)
-    {
-        osiFile = os_malloc(sizeof(osiFileP_t));
-        nvItem = os_malloc(sizeof(NVINTF_itemID_t));
-        osiFile->ftype = OSI_FILE_WLAN_FAST_CONNECT;
-        nvItem->itemID = NVID_WLAN_FAST_CONNECT_OFFSET_IN_FLASH;
-        nvItem->systemID = NVINTF_SYSID_WIFI;
-        nvItem->subID = 0;
-        osiFile->ptr = nvItem;
-        return (FILE *)(osiFile);
+        osiFile->nvItem.itemID = desc->itemID;
+        osiFile->nvItem.systemID = desc->systemID;
+        osiFile->nvItem.subID = 0;
+        osiFile->ptr = &osiFile->nvItem;
     }
-
-    return (FILE *)(NULL);
+    return (FILE *)(osiFile);
 }
 
 size_t ATTRIBUTE osi_fread(void *_ptr, size_t len, size_t offset, FILE *_fp)
@@ -298,13 +335,29 @@ size_t ATTRIBUTE osi_fread(void *_ptr, size_t len, size_t offset, FILE *_fp)
     }
     else if((osiFile->ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_1) || (osiFile->ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_2))
     {
+        // Small sequential reads, served from the read-ahead cache
+        len = osiClampRead(osiFwLength(osiFile->ftype), offset, len);
+        if((len > 0) && (FwCache_read(FwGpeDataOffset + offset, (void*)_ptr, len) == 0))
+        {
+            return (len);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if(osiFile->log)
+    {
+        // Only the records overlapping [offset, offset + len) are read
+        int32_t total = NvLog_read(nvFptrs, osiFile->nvItem, offset, _ptr, len);
 
-        XMEMWFF3_read((XMEM_Handle)osiFile->ptr, FwGpeDataOffset + offset, (void*)_ptr, len, 0);
-
+        return (total < 0) ? 0 : osiClampRead(total, offset, len);
     }
     else if(IS_OSI_FILE(osiFile->ftype))
     {
-        if(nvFptrs->readItem((*(NVINTF_itemID_t *)osiFile->ptr), 0, len, _ptr) == 0)
+        // Partial reads at offset, so large items can be read in chunks
+        len = osiClampRead(nvFptrs->getItemLen(osiFile->nvItem), offset, len);
+        if((len > 0) && (nvFptrs->readItem(osiFile->nvItem, offset, len, _ptr) == 0))
         {
             return (len);
         }
@@ -327,7 +380,19 @@ size_t osi_fwrite(const void *_ptr, size_t _size, size_t _count, FILE *_fp)
         return 0;
     }
 
-    if(IS_OSI_FILE(osiFile->ftype))
+    if(osiFile->log)
+    {
+        // Writes only what changed, see osi_nvlog.h
+        if(NvLog_write(nvFptrs, osiFile->nvItem, _ptr, _size) == 0)
+        {
+            return (_size);
+        }
+        else
+        {
+            return (0);
+        }
+    }
+    else if(IS_OSI_FILE(osiFile->ftype))
     {
         nvFptrs->deleteItem((*(NVINTF_itemID_t *)osiFile->ptr));
         if(nvFptrs->writeItem((*(NVINTF_itemID_t *)osiFile->ptr), _size, (void *)_ptr) == 0)
@@ -355,6 +420,10 @@ int osi_fremove(FILE *_fp)
 
     if(osiFile->ftype == OSI_FILE_WLAN_FAST_CONNECT)
     {
+        if(osiFile->log)
+        {
+            return (NvLog_remove(nvFptrs, osiFile->nvItem) == 0) ? 0 : -1;
+        }
         if(nvFptrs->deleteItem((*(NVINTF_itemID_t *)osiFile->ptr)) == 0)
         {
             return 0;
@@ -370,24 +439,46 @@ int osi_fremove(FILE *_fp)
 }
 
 /*!
-    \brief initialize the SPI module
-    \param data - input buffer
-    \param length - length in bytes to read
-    \return 0 - success, -1 - failed
+    \brief length of a file in bytes
+    \param FileName - name as passed to osi_fopen
+    \return length, 0 for unknown names, missing NV items and the RAM files
+            (cc33xx-conf, rambtlr), whose size is not known here
     \note
-    1. if initializing all the MCU drivers at the beginning of the world, this function can stay empty.
-       this function is called in the wlan_start and will stay initialized even if used wlan_stop
-    2. the SPI must have the following parameters
-       - master
-       - 4 pin mode SPI
-       - chip select active low
-       - polarity 0 phase 0
-       - max frequency 40000000Hz
-       - data block 32bits
+    1. for the firmware file it is the readable part of the current slot
+    2. osi_fread at an offset returns at most length - offset bytes, so a file
+       can be read in chunks into a small buffer
     \warning
 */
 size_t ATTRIBUTE osi_filelength(const char * FileName)
 {
+    const osiFileDesc_t *desc = &gOsiFileTable[osiFileHash(FileName)];
+    NVINTF_itemID_t      nvItem;
+    int32_t              len;
+
+    if((NULL == desc->name) || (strcmp(desc->name, FileName) != 0))
+    {
+        return 0;
+    }
+
+    if(desc->ftype == OSI_FILE_CONNECTIVITY_FW_SLOT_1)
+    {
+        return osiFwLength((Fwslot == OSI_FLASH_CONNECTIVITY_FW_SLOT_2) ? OSI_FILE_CONNECTIVITY_FW_SLOT_2 :
+                                                                          OSI_FILE_CONNECTIVITY_FW_SLOT_1);
+    }
+    else if(IS_OSI_FILE(desc->ftype))
+    {
+        osiNvInit();
+        nvItem.itemID = desc->itemID;
+        nvItem.systemID = desc->systemID;
+        nvItem.subID = 0;
+        if(desc->log)
+        {
+            len = NvLog_length(nvFptrs, nvItem);
+            return (len < 0) ? 0 : (size_t)len;
+        }
+        return nvFptrs->getItemLen(nvItem);
+    }
+
     return 0;
 }
 //
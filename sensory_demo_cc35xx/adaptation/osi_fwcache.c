@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Connectivity firmware read cache, see osi_fwcache.h.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <osi_kernel.h>
+#include "uart_term.h"
+#include "osi_timestamp.h"
+#include "osi_fwcache.h"
+
+#define FW_CACHE_WINDOW     (OSI_FW_CACHE_SECTOR * OSI_FW_CACHE_SECTORS)
+
+#if (OSI_FW_CACHE_SECTOR & (OSI_FW_CACHE_SECTOR - 1))
+#error "OSI_FW_CACHE_SECTOR must be a power of 2"
+#endif
+
+static XMEM_Handle    gHandle;
+static uint32_t       gRegionSize;
+static uint64_t       gOpenTime;
+static FwCacheStats_t gStats;
+#if OSI_FW_CACHE
+static uint8_t        gWindow[FW_CACHE_WINDOW] __attribute__((aligned(4)));
+static uint32_t       gBase;            // region offset of gWindow[0]
+static uint32_t       gValid;           // bytes of gWindow holding data, 0 = empty
+#endif
+
+static int flashRead(uint32_t offset, void *dst, uint32_t len)
+{
+    gStats.transactions++;
+    gStats.bytesFlash += len;
+    return XMEMWFF3_read(gHandle, offset, dst, len, 0);
+}
+
+void FwCache_open(void *handle, uint32_t regionSize)
+{
+    gHandle = (XMEM_Handle)handle;
+    gRegionSize = regionSize;
+    memset(&gStats, 0, sizeof(gStats));
+#if OSI_FW_CACHE
+    gValid = 0;
+#endif
+    gOpenTime = OsiTs_cycles();
+}
+
+int FwCache_read(uint32_t offset, void *dst, size_t len)
+{
+#if OSI_FW_CACHE
+    uint8_t *out = (uint8_t *)dst;
+    int status;
+#endif
+
+    gStats.reads++;
+    gStats.bytesRequested += len;
+
+#if OSI_FW_CACHE
+    if(len >= FW_CACHE_WINDOW)
+    {
+        gStats.bypassed++;
+        return flashRead(offset, dst, len);
+    }
+
+    while(len > 0)
+    {
+        uint32_t n;
+
+        if((gValid == 0) || (offset < gBase) || (offset >= gBase + gValid))
+        {
+            // Reading on right after the window: fetch the whole next window
+            uint32_t sequential = (gValid != 0) && (offset == gBase + gValid);
+            uint32_t fill = sequential ? FW_CACHE_WINDOW : OSI_FW_CACHE_SECTOR;
+
+            gStats.misses++;
+            gBase = offset & ~(OSI_FW_CACHE_SECTOR - 1);
+            if((offset + len > gBase + fill) && !sequential)
+            {
+                // Spans a sector boundary, fill up to the window
+                fill = FW_CACHE_WINDOW;
+            }
+            if(gBase + fill > gRegionSize)
+            {
+                fill = (gBase < gRegionSize) ? (gRegionSize - gBase) : 0;
+            }
+            gValid = 0;
+            if(fill == 0)
+            {
+                return flashRead(offset, out, len);
+            }
+            status = flashRead(gBase, gWindow, fill);
+            if(status != 0)
+            {
+                return status;
+            }
+            gValid = fill;
+            if(sequential)
+            {
+                gStats.readAheads++;
+            }
+        }
+        else
+        {
+            gStats.hits++;
+        }
+
+        n = gBase + gValid - offset;
+        if(n > len)
+        {
+            n = len;
+        }
+        memcpy(out, &gWindow[offset - gBase], n);
+        out += n;
+        offset += n;
+        len -= n;
+    }
+    return 0;
+#else
+    return flashRead(offset, dst, len);
+#endif
+}
+
+void FwCache_close(void)
+{
+    gStats.loadUs = (uint32_t)OsiTs_toUs(OsiTs_cycles() - gOpenTime);
+#if OSI_FW_CACHE
+    gValid = 0;
+#endif
+    gHandle = NULL;
+#if OSI_FW_CACHE_REPORT
+    FwCache_dump();
+#endif
+}
+
+void FwCache_getStats(FwCacheStats_t *stats)
+{
+    *stats = gStats;
+}
+
+void FwCache_dump(void)
+{
+    Report("\n\rfw load: %d us, %d reads (%d bytes), %d hits, %d misses, %d read-aheads, %d bypassed, "
+           "%d flash reads (%d bytes), cache %s\n\r",
+           gStats.loadUs, gStats.reads, gStats.bytesRequested, gStats.hits, gStats.misses,
+           gStats.readAheads, gStats.bypassed, gStats.transactions, gStats.bytesFlash,
+           OSI_FW_CACHE ? "on" : "off");
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Heap fragmentation monitor, see osi_heapmon.h.
+ */
+
+#ifdef HEAP_MONITOR
+
+#include <stdint.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include <osi_kernel.h>
+#include "uart_term.h"
+#include "osi_heapmon.h"
+
+/* heap_4 block header, the allocated flag is the top bit of the size */
+typedef struct HeapBlock {
+    struct HeapBlock *next;
+    size_t size;
+} HeapBlock_t;
+
+#define HEAP_BLOCK_ALLOCATED    ((size_t)1 << (sizeof(size_t) * 8 - 1))
+#define HEAP_BLOCK_HEADER       ((sizeof(HeapBlock_t) + (portBYTE_ALIGNMENT - 1)) & ~((size_t)portBYTE_ALIGNMENT - 1))
+
+static HeapBlock_t      *gAnchor;
+static HeapMonCallback_t gCallback;
+static HeapMonStats_t    gLast;
+
+static uint32_t bucketOf(uint32_t size)
+{
+    uint32_t b = 31 - __builtin_clz(size | 1);
+
+    // 16..31 bytes in bucket 0, then one bucket per power of 2
+    b = (b > 4) ? b - 4 : 0;
+    return (b < HEAP_MON_BUCKETS) ? b : HEAP_MON_BUCKETS - 1;
+}
+
+#if HEAP_MON_WALK
+/* Walk the blocks from the anchor to the end marker (size 0) */
+static void heapWalk(HeapMonStats_t *stats)
+{
+    uint8_t *p = (uint8_t *)gAnchor;
+    uint8_t *limit = p + configTOTAL_HEAP_SIZE;
+
+    vTaskSuspendAll();
+    while(1)
+    {
+        size_t size = ((HeapBlock_t *)p)->size & ~HEAP_BLOCK_ALLOCATED;
+
+        if(size == 0)
+        {
+            break;
+        }
+        if((size < HEAP_BLOCK_HEADER) || (size & (portBYTE_ALIGNMENT - 1)) || (size > (size_t)(limit - p)))
+        {
+            stats->walkErrors++;
+            break;
+        }
+        if(!(((HeapBlock_t *)p)->size & HEAP_BLOCK_ALLOCATED))
+        {
+            stats->hist[bucketOf(size - HEAP_BLOCK_HEADER)]++;
+            stats->walkedFree++;
+        }
+        stats->walkedBytes += size;
+        p += size;
+    }
+    (void)xTaskResumeAll();
+}
+#endif
+
+void HeapMon_sample(HeapMonStats_t *stats)
+{
+    HeapStats_t hs;
+    uint32_t events = 0;
+    uint32_t walkErrors = gLast.walkErrors;
+
+    memset(stats, 0, sizeof(*stats));
+    vPortGetHeapStats(&hs);
+    stats->freeBytes = hs.xAvailableHeapSpaceInBytes;
+    stats->minEverFree = hs.xMinimumEverFreeBytesRemaining;
+    stats->largestFree = hs.xSizeOfLargestFreeBlockInBytes;
+    stats->smallestFree = hs.xSizeOfSmallestFreeBlockInBytes;
+    stats->freeBlocks = hs.xNumberOfFreeBlocks;
+    stats->fragPct = stats->freeBytes ? 100 - (uint32_t)((uint64_t)stats->largestFree * 100 / stats->freeBytes) : 0;
+    stats->walkErrors = walkErrors;
+#if HEAP_MON_WALK
+    if(NULL != gAnchor)
+    {
+        heapWalk(stats);
+    }
+#endif
+
+    if(stats->freeBytes < HEAP_MON_MIN_FREE)
+    {
+        events |= HEAP_MON_EVT_LOW_FREE;
+    }
+    if(stats->largestFree < HEAP_MON_MIN_LARGEST)
+    {
+        events |= HEAP_MON_EVT_LOW_LARGEST;
+    }
+    if(stats->fragPct > HEAP_MON_MAX_FRAG_PCT)
+    {
+        events |= HEAP_MON_EVT_FRAGMENTED;
+    }
+    stats->events = events;
+
+    if(events != gLast.events)
+    {
+        if(events & ~gLast.events)
+        {
+            Report("\n\rheap monitor: %s%s%s free %d, largest %d, fragmentation %d%%\n\r",
+                   (events & HEAP_MON_EVT_LOW_FREE) ? "LOW_FREE " : "",
+                   (events & HEAP_MON_EVT_LOW_LARGEST) ? "LOW_LARGEST " : "",
+                   (events & HEAP_MON_EVT_FRAGMENTED) ? "FRAGMENTED " : "",
+                   stats->freeBytes, stats->largestFree, stats->fragPct);
+        }
+        if(NULL != gCallback)
+        {
+            gCallback(events, stats);
+        }
+    }
+    gLast = *stats;
+}
+
+void HeapMon_dump(void)
+{
+    HeapMonStats_t *s = &gLast;
+    uint32_t i;
+
+    Report("\n\rheap: free %d (min ever %d), largest %d, smallest %d, %d free blocks, fragmentation %d%%",
+           s->freeBytes, s->minEverFree, s->largestFree, s->smallestFree, s->freeBlocks, s->fragPct);
+#if HEAP_MON_WALK
+    Report("\n\rfree blocks by size (walked %d bytes, %d free blocks below walk start, %d walk errors):",
+           s->walkedBytes, s->freeBlocks - s->walkedFree, s->walkErrors);
+    for(i = 0; i < HEAP_MON_BUCKETS; i++)
+    {
+        if(s->hist[i])
+        {
+            if(i == HEAP_MON_BUCKETS - 1)
+            {
+                Report("\n\r  >= %6d  %d", 16 << i, s->hist[i]);
+            }
+            else
+            {
+                Report("\n\r  <  %6d  %d", 32 << i, s->hist[i]);
+            }
+        }
+    }
+#endif
+    Report("\n\r");
+}
+
+void HeapMon_setCallback(HeapMonCallback_t cb)
+{
+    gCallback = cb;
+}
+
+static void *HeapMon_task(void *pParam)
+{
+    HeapMonStats_t stats;
+
+    while(1)
+    {
+        HeapMon_sample(&stats);
+        osi_Sleep(HEAP_MON_PERIOD_S);
+    }
+
+    return NULL;
+}
+
+void HeapMon_init(void)
+{
+    static OsiThread_t thread;
+
+#if HEAP_MON_WALK
+    // Never freed: a block header at a known, low address to start the walk from
+    uint8_t *anchor = pvPortMalloc(sizeof(uint32_t));
+
+    if(NULL != anchor)
+    {
+        gAnchor = (HeapBlock_t *)(anchor - HEAP_BLOCK_HEADER);
+    }
+#endif
+    osi_ThreadCreate(&thread, "HeapMon", 1024, 1, HeapMon_task, NULL);
+}
+
+#endif // HEAP_MONITOR
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Per call site heap profiler, see osi_heapprof.h.
+ */
+
+#ifdef HEAP_PROFILER
+
+#include <stdint.h>
+#include <string.h>
+#include "ti/drivers/dpl/HwiP.h"
+#include "ti/drivers/dpl/ClockP.h"
+#include <osi_kernel.h>
+#include "uart_term.h"
+#include "osi_heapprof.h"
+
+#if (HEAP_PROFILER_SITES & (HEAP_PROFILER_SITES - 1)) || (HEAP_PROFILER_BLOCKS & (HEAP_PROFILER_BLOCKS - 1))
+#error "HEAP_PROFILER_SITES and HEAP_PROFILER_BLOCKS must be powers of 2"
+#endif
+
+typedef struct {
+    uint32_t ptr;               // 0 = empty
+    uint32_t size;
+    uint32_t ticks;             // allocation time
+    uint16_t site;
+} HeapProfBlock_t;
+
+static HeapProfSite_t  gSite[HEAP_PROFILER_SITES];
+static HeapProfBlock_t gBlock[HEAP_PROFILER_BLOCKS];
+static uint32_t        gSitesFull;      // allocations from sites that found no free entry
+static uint32_t        gBlocksFull;     // allocations not tracked, block table full
+static uint32_t        gBlocksUsed;
+
+/* Fibonacci hashing, the low bits of addresses and LRs carry little information */
+static inline uint32_t hash(uint32_t key, uint32_t mask)
+{
+    return ((key * 2654435769u) >> 16) & mask;
+}
+
+/* Site entry for lr, created on first use; NULL when the table is full */
+static HeapProfSite_t *siteGet(uint32_t lr)
+{
+    uint32_t i = hash(lr, HEAP_PROFILER_SITES - 1);
+    uint32_t n;
+
+    for(n = 0; n < HEAP_PROFILER_SITES; n++, i = (i + 1) & (HEAP_PROFILER_SITES - 1))
+    {
+        if(gSite[i].lr == lr)
+        {
+            return &gSite[i];
+        }
+        if(gSite[i].lr == 0)
+        {
+            gSite[i].lr = lr;
+            return &gSite[i];
+        }
+    }
+    return NULL;
+}
+
+/* Index of the live block entry for ptr, or of the empty slot where it would go */
+static uint32_t blockFind(uint32_t ptr)
+{
+    uint32_t i = hash(ptr, HEAP_PROFILER_BLOCKS - 1);
+
+    while((gBlock[i].ptr != 0) && (gBlock[i].ptr != ptr))
+    {
+        i = (i + 1) & (HEAP_PROFILER_BLOCKS - 1);
+    }
+    return i;
+}
+
+/* Remove entry i, shifting back later entries of the same probe chain (no tombstones) */
+static void blockRemove(uint32_t i)
+{
+    uint32_t j = i;
+
+    while(1)
+    {
+        uint32_t home;
+
+        j = (j + 1) & (HEAP_PROFILER_BLOCKS - 1);
+        if(gBlock[j].ptr == 0)
+        {
+            break;
+        }
+        home = hash(gBlock[j].ptr, HEAP_PROFILER_BLOCKS - 1);
+        // Move j into the hole at i unless its home lies cyclically in (i, j]
+        if(((j - home) & (HEAP_PROFILER_BLOCKS - 1)) >= ((j - i) & (HEAP_PROFILER_BLOCKS - 1)))
+        {
+            gBlock[i] = gBlock[j];
+            i = j;
+        }
+    }
+    gBlock[i].ptr = 0;
+    gBlocksUsed--;
+}
+
+void HeapProf_alloc(uint32_t lr, void *ptr, size_t size)
+{
+    uintptr_t key = HwiP_disable();
+    HeapProfSite_t *site = siteGet(lr);
+
+    if(NULL == site)
+    {
+        gSitesFull++;
+    }
+    else if(NULL == ptr)
+    {
+        site->fails++;
+    }
+    else
+    {
+        site->allocs++;
+        // Keep the table at most 3/4 full so probe chains stay short
+        if(gBlocksUsed < HEAP_PROFILER_BLOCKS / 4 * 3)
+        {
+            uint32_t i = blockFind((uint32_t)ptr);
+
+            if(gBlock[i].ptr == 0)
+            {
+                gBlocksUsed++;
+            }
+            gBlock[i].ptr = (uint32_t)ptr;
+            gBlock[i].size = size;
+            gBlock[i].ticks = ClockP_getSystemTicks();
+            gBlock[i].site = site - gSite;
+            site->liveBlocks++;
+            site->liveBytes += size;
+            if(site->liveBytes > site->peakBytes)
+            {
+                site->peakBytes = site->liveBytes;
+            }
+        }
+        else
+        {
+            gBlocksFull++;
+        }
+    }
+    HwiP_restore(key);
+}
+
+void HeapProf_free(void *ptr)
+{
+    uintptr_t key;
+    uint32_t i;
+
+    if(NULL == ptr)
+    {
+        return;
+    }
+
+    key = HwiP_disable();
+    i = blockFind((uint32_t)ptr);
+    if(gBlock[i].ptr != 0)
+    {
+        HeapProfSite_t *site = &gSite[gBlock[i].site];
+
+        site->frees++;
+        site->liveBlocks--;
+        site->liveBytes -= gBlock[i].size;
+        site->lifetimeTicks += ClockP_getSystemTicks() - gBlock[i].ticks;
+        blockRemove(i);
+    }
+    HwiP_restore(key);
+}
+
+uint32_t HeapProf_snapshot(HeapProfSite_t *sites, uint32_t max)
+{
+    uint32_t i, n = 0;
+
+    for(i = 0; (i < HEAP_PROFILER_SITES) && (n < max); i++)
+    {
+        uintptr_t key = HwiP_disable();
+        if(gSite[i].lr != 0)
+        {
+            sites[n++] = gSite[i];
+        }
+        HwiP_restore(key);
+    }
+    return n;
+}
+
+void HeapProf_dump(void)
+{
+    static HeapProfSite_t snap[HEAP_PROFILER_SITES];
+    uint32_t tickUs = ClockP_getSystemTickPeriod();
+    uint32_t n, i, j;
+    uint32_t liveTotal = 0;
+
+    n = HeapProf_snapshot(snap, HEAP_PROFILER_SITES);
+
+    // Largest live bytes first, the table is small
+    for(i = 1; i < n; i++)
+    {
+        HeapProfSite_t s = snap[i];
+        for(j = i; (j > 0) && (snap[j - 1].liveBytes < s.liveBytes); j--)
+        {
+            snap[j] = snap[j - 1];
+        }
+        snap[j] = s;
+    }
+
+    Report("\n\rheap profile: %d sites, %d live blocks tracked, %d untracked, %d from overflowed sites",
+           n, gBlocksUsed, gBlocksFull, gSitesFull);
+    Report("\n\r        lr  live_bytes  peak_bytes  live_blk    allocs     frees  fails  avg_life_ms");
+    for(i = 0; i < n; i++)
+    {
+        HeapProfSite_t *s = &snap[i];
+        uint32_t lifeMs = s->frees ? (uint32_t)(s->lifetimeTicks * tickUs / 1000 / s->frees) : 0;
+
+        liveTotal += s->liveBytes;
+        Report("\n\r0x%08x  %10d  %10d  %8d  %8d  %8d  %5d  %11d",
+               s->lr, s->liveBytes, s->peakBytes, s->liveBlocks, s->allocs, s->frees, s->fails, lifeMs);
+    }
+    Report("\n\rlive bytes total: %d\n\r", liveTotal);
+}
+
+#if HEAP_PROFILER_PERIOD_S
+static void *HeapProf_task(void *pParam)
+{
+    while(1)
+    {
+        osi_Sleep(HEAP_PROFILER_PERIOD_S);
+        HeapProf_dump();
+    }
+
+    return NULL;
+}
+#endif
+
+void HeapProf_init(void)
+{
+#if HEAP_PROFILER_PERIOD_S
+    static OsiThread_t thread;
+
+    osi_ThreadCreate(&thread, "HeapProf", 1024, 1, HeapProf_task, NULL);
+#endif
+}
+
+#endif // HEAP_PROFILER
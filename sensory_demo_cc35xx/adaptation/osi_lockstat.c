@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Lock and semaphore contention statistics, see osi_lockstat.h.
+ */
+
+#ifdef LOCK_STATS
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ti/drivers/dpl/HwiP.h"
+#include <osi_kernel.h>
+#include "uart_term.h"
+#include "osi_timestamp.h"
+#include "osi_lockstat.h"
+
+#if (LOCK_STATS_OBJECTS & (LOCK_STATS_OBJECTS - 1))
+#error "LOCK_STATS_OBJECTS must be a power of 2"
+#endif
+
+static LockStat_t gStat[LOCK_STATS_OBJECTS];
+static uint32_t   gUsed;
+static uint32_t   gUntracked;       // acquisitions of objects that found no free entry
+
+static const char * const gKindName[] = { "lock", "sync", "sem", "posix" };
+
+/* Fibonacci hashing, the low bits of addresses carry little information */
+static inline uint32_t hash(const void *obj)
+{
+    return (((uint32_t)obj * 2654435769u) >> 16) & (LOCK_STATS_OBJECTS - 1);
+}
+
+/* Index of the entry for obj, or of the empty slot where it would go. One slot is always kept empty */
+static uint32_t statFind(const void *obj)
+{
+    uint32_t i = hash(obj);
+
+    while((gStat[i].obj != NULL) && (gStat[i].obj != obj))
+    {
+        i = (i + 1) & (LOCK_STATS_OBJECTS - 1);
+    }
+    return i;
+}
+
+/* Entry for obj, created on first use; NULL when the table is full. Call with interrupts disabled */
+static LockStat_t *statGet(const void *obj, uint32_t kind)
+{
+    uint32_t i = statFind(obj);
+
+    if(gStat[i].obj == NULL)
+    {
+        if(gUsed == LOCK_STATS_OBJECTS - 1)
+        {
+            return NULL;
+        }
+        memset(&gStat[i], 0, sizeof(gStat[i]));
+        gStat[i].obj = obj;
+        gStat[i].kind = kind;
+        gUsed++;
+    }
+    return &gStat[i];
+}
+
+/* Task name, truncated into buf */
+static void taskName(char *buf, TaskHandle_t task)
+{
+    buf[0] = '\0';
+    if(NULL != task)
+    {
+        strncpy(buf, pcTaskGetName(task), LOCK_STATS_NAME_LEN - 1);
+        buf[LOCK_STATS_NAME_LEN - 1] = '\0';
+    }
+}
+
+/* Account for one attempt on obj. wait is 0 when the object was free */
+static void record(const void *obj, uint32_t kind, int acquired, uint64_t wait, const char *holder)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    uintptr_t key = HwiP_disable();
+    LockStat_t *s = statGet(obj, kind);
+
+    if(NULL == s)
+    {
+        gUntracked++;
+        HwiP_restore(key);
+        return;
+    }
+    s->kind = kind;
+    if(acquired)
+    {
+        s->acquired++;
+        if(LOCK_STAT_LOCK == kind)
+        {
+            s->holder = self;
+        }
+    }
+    else
+    {
+        s->timeouts++;
+    }
+    if(wait)
+    {
+        s->contended++;
+        s->waitTotal += wait;
+        if(wait > s->waitMax)
+        {
+            s->waitMax = wait;
+            taskName(s->maxWaiter, self);
+            strcpy(s->maxHolder, holder);
+        }
+    }
+    HwiP_restore(key);
+}
+
+/* Name of the task holding a lock object, empty for other objects or when unknown */
+static void holderName(const void *obj, uint32_t kind, char *buf)
+{
+    TaskHandle_t holder;
+    uintptr_t key;
+
+    buf[0] = '\0';
+    if(LOCK_STAT_LOCK != kind)
+    {
+        return;
+    }
+    key = HwiP_disable();
+    holder = gStat[statFind(obj)].holder;
+    HwiP_restore(key);
+    taskName(buf, holder);
+}
+
+SemaphoreP_Status LockStat_pend(const void *obj, LockStatKind_e kind, SemaphoreP_Handle handle, uint32_t timeout)
+{
+    char holder[LOCK_STATS_NAME_LEN];
+    SemaphoreP_Status status = SemaphoreP_pend(handle, 0);
+    uint64_t start;
+
+    if((SemaphoreP_OK == status) || (0 == timeout))
+    {
+        record(obj, kind, SemaphoreP_OK == status, 0, "");
+        return status;
+    }
+
+    holderName(obj, kind, holder);
+    start = OsiTs_cycles();
+    status = SemaphoreP_pend(handle, timeout);
+    // At least one cycle, a zero wait means uncontended
+    record(obj, kind, SemaphoreP_OK == status, (OsiTs_cycles() - start) | 1, holder);
+    return status;
+}
+
+void LockStat_release(const void *obj)
+{
+    uintptr_t key = HwiP_disable();
+    LockStat_t *s = statGet(obj, LOCK_STAT_LOCK);
+
+    if(NULL != s)
+    {
+        s->holder = NULL;
+    }
+    HwiP_restore(key);
+}
+
+int LockStat_semWait(sem_t *sem)
+{
+    uint64_t start;
+    int ret;
+
+    if(0 == sem_trywait(sem))
+    {
+        record(sem, LOCK_STAT_POSIX, 1, 0, "");
+        return 0;
+    }
+
+    start = OsiTs_cycles();
+    ret = sem_wait(sem);
+    record(sem, LOCK_STAT_POSIX, 0 == ret, (OsiTs_cycles() - start) | 1, "");
+    return ret;
+}
+
+void LockStat_setName(const void *obj, const char *name)
+{
+    uintptr_t key = HwiP_disable();
+    LockStat_t *s = statGet(obj, LOCK_STAT_LOCK);
+
+    if(NULL != s)
+    {
+        s->name = name;
+    }
+    HwiP_restore(key);
+}
+
+void LockStat_forget(const void *obj)
+{
+    uintptr_t key = HwiP_disable();
+    uint32_t i = statFind(obj);
+    uint32_t j;
+
+    if(gStat[i].obj != NULL)
+    {
+        // Shift back later entries of the same probe chain (no tombstones)
+        for(j = i; ; )
+        {
+            uint32_t home;
+
+            j = (j + 1) & (LOCK_STATS_OBJECTS - 1);
+            if(gStat[j].obj == NULL)
+            {
+                break;
+            }
+            home = hash(gStat[j].obj);
+            if(((j - home) & (LOCK_STATS_OBJECTS - 1)) >= ((j - i) & (LOCK_STATS_OBJECTS - 1)))
+            {
+                gStat[i] = gStat[j];
+                i = j;
+            }
+        }
+        gStat[i].obj = NULL;
+        gStat[i].holder = NULL;
+        gUsed--;
+    }
+    HwiP_restore(key);
+}
+
+uint32_t LockStat_snapshot(LockStat_t *stats, uint32_t max)
+{
+    uint32_t i, n = 0;
+
+    for(i = 0; (i < LOCK_STATS_OBJECTS) && (n < max); i++)
+    {
+        uintptr_t key = HwiP_disable();
+        if(gStat[i].obj != NULL)
+        {
+            stats[n++] = gStat[i];
+        }
+        HwiP_restore(key);
+    }
+    return n;
+}
+
+void LockStat_reset(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < LOCK_STATS_OBJECTS; i++)
+    {
+        uintptr_t key = HwiP_disable();
+        gStat[i].acquired = 0;
+        gStat[i].contended = 0;
+        gStat[i].timeouts = 0;
+        gStat[i].waitTotal = 0;
+        gStat[i].waitMax = 0;
+        gStat[i].maxWaiter[0] = '\0';
+        gStat[i].maxHolder[0] = '\0';
+        HwiP_restore(key);
+    }
+    gUntracked = 0;
+}
+
+void LockStat_dump(void)
+{
+    static LockStat_t snap[LOCK_STATS_OBJECTS];
+    char addr[12];
+    uint32_t n, i, j;
+
+    // Copy first, Report() takes a lock object itself
+    n = LockStat_snapshot(snap, LOCK_STATS_OBJECTS);
+
+    // Longest wait first, the table is small
+    for(i = 1; i < n; i++)
+    {
+        LockStat_t s = snap[i];
+        for(j = i; (j > 0) && (snap[j - 1].waitMax < s.waitMax); j--)
+        {
+            snap[j] = snap[j - 1];
+        }
+        snap[j] = s;
+    }
+
+    Report("\n\rlock stats: %d objects, %d acquisitions untracked", n, gUntracked);
+    Report("\n\robject        kind    acquired  contended  timeouts  total_wait_us  max_wait_us  waiter       holder");
+    for(i = 0; i < n; i++)
+    {
+        LockStat_t *s = &snap[i];
+
+        if(NULL == s->name)
+        {
+            snprintf(addr, sizeof(addr), "0x%08x", (uint32_t)s->obj);
+        }
+        Report("\n\r%-12s  %-5s  %9d  %9d  %8d  %13d  %11d  %-11s  %s",
+               s->name ? s->name : addr, gKindName[s->kind], s->acquired, s->contended, s->timeouts,
+               (uint32_t)OsiTs_toUs(s->waitTotal), (uint32_t)OsiTs_toUs(s->waitMax),
+               s->maxWaiter, s->maxHolder);
+    }
+    Report("\n\r");
+}
+
+#if LOCK_STATS_PERIOD_S
+static void *LockStat_task(void *pParam)
+{
+    while(1)
+    {
+        osi_Sleep(LOCK_STATS_PERIOD_S);
+        LockStat_dump();
+    }
+
+    return NULL;
+}
+#endif
+
+void LockStat_init(void)
+{
+#if LOCK_STATS_PERIOD_S
+    static OsiThread_t thread;
+
+    osi_ThreadCreate(&thread, "LockStat", 1024, 1, LockStat_task, NULL);
+#endif
+}
+
+#endif // LOCK_STATS
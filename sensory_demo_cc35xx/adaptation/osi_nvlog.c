@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Append-only NV records, see osi_nvlog.h.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <osi_kernel.h>
+#include "osi_nvlog.h"
+
+#define NVLOG_BASE_SUBID(slot)      (slot)
+#define NVLOG_DELTA_SUBID(k)        (2 + (k))
+
+typedef struct {
+    uint32_t slot;              // sub ID of the current base
+    uint32_t legacy;            // base written without a header
+    uint32_t baseSeq;
+    uint32_t baseLen;           // payload bytes of the base
+    uint32_t deltas;            // valid deltas on the base
+    uint32_t seq;               // newest sequence number
+    uint32_t total;             // image length
+} NvLogState_t;
+
+static NvLogStats_t gStats;
+
+static NVINTF_itemID_t subItem(NVINTF_itemID_t item, uint32_t subID)
+{
+    item.subID = subID;
+    return item;
+}
+
+/* Header of a record, 0 if the record is missing or not in this format */
+static int readHdr(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t id, NvLogHdr_t *hdr)
+{
+    uint32_t itemLen = nv->getItemLen(id);
+
+    if((itemLen < sizeof(NvLogHdr_t)) || (nv->readItem(id, 0, sizeof(NvLogHdr_t), hdr) != NVINTF_SUCCESS))
+    {
+        return 0;
+    }
+    return (hdr->magic == OSI_NVLOG_MAGIC) && (itemLen == sizeof(NvLogHdr_t) + hdr->len);
+}
+
+/* Find the newest base and its deltas, -1 if the item has no records */
+static int scan(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item, NvLogState_t *st)
+{
+    NvLogHdr_t hdr[2];
+    int valid[2];
+    uint32_t slot, k;
+
+    memset(st, 0, sizeof(*st));
+    for(slot = 0; slot < 2; slot++)
+    {
+        valid[slot] = readHdr(nv, subItem(item, NVLOG_BASE_SUBID(slot)), &hdr[slot]) &&
+                      (hdr[slot].baseSeq == hdr[slot].seq) && (hdr[slot].offset == 0);
+    }
+
+    if(valid[0] || valid[1])
+    {
+        slot = (valid[0] && valid[1]) ? (hdr[1].seq > hdr[0].seq) : valid[1];
+        st->slot = slot;
+        st->baseSeq = st->seq = hdr[slot].seq;
+        st->baseLen = hdr[slot].len;
+        st->total = hdr[slot].total;
+    }
+    else
+    {
+        // An item from before the record format: the whole of sub ID 0 is the image
+        uint32_t len = nv->getItemLen(subItem(item, 0));
+
+        if(len == 0)
+        {
+            return -1;
+        }
+        st->legacy = 1;
+        st->baseLen = st->total = len;
+    }
+
+    for(k = 0; k < OSI_NVLOG_MAX_DELTAS; k++)
+    {
+        NvLogHdr_t d;
+
+        if(!readHdr(nv, subItem(item, NVLOG_DELTA_SUBID(k)), &d) ||
+           (d.baseSeq != st->baseSeq) || (d.seq != st->seq + 1))
+        {
+            break;
+        }
+        st->seq = d.seq;
+        st->total = d.total;
+        st->deltas++;
+    }
+    return 0;
+}
+
+/* Highest sequence number left in the delta sub IDs of an item with no base, 0 if none */
+static uint32_t staleSeq(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item)
+{
+    uint32_t seq = 0;
+    uint32_t k;
+
+    for(k = 0; k < OSI_NVLOG_MAX_DELTAS; k++)
+    {
+        NvLogHdr_t d;
+
+        if(readHdr(nv, subItem(item, NVLOG_DELTA_SUBID(k)), &d) && (d.seq > seq))
+        {
+            seq = d.seq;
+        }
+    }
+    return seq;
+}
+
+/* Apply the records found by scan() to the image bytes [offset, offset + len), stored at buf, -1 on a read error */
+static int rebuild(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item, const NvLogState_t *st,
+                   uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    uint32_t end = offset + len;
+    uint32_t k;
+
+    if(offset < st->baseLen)
+    {
+        uint32_t n = ((st->baseLen < end) ? st->baseLen : end) - offset;
+
+        if(nv->readItem(subItem(item, NVLOG_BASE_SUBID(st->slot)),
+                        (st->legacy ? 0 : sizeof(NvLogHdr_t)) + offset, n, buf) != NVINTF_SUCCESS)
+        {
+            return -1;
+        }
+    }
+    for(k = 0; k < st->deltas; k++)
+    {
+        NVINTF_itemID_t id = subItem(item, NVLOG_DELTA_SUBID(k));
+        NvLogHdr_t d;
+        uint32_t lo, hi;
+
+        if(nv->readItem(id, 0, sizeof(d), &d) != NVINTF_SUCCESS)
+        {
+            return -1;
+        }
+        lo = (d.offset > offset) ? d.offset : offset;
+        hi = (d.offset + d.len < end) ? d.offset + d.len : end;
+        if((lo < hi) && (nv->readItem(id, sizeof(d) + lo - d.offset, hi - lo, buf + lo - offset) != NVINTF_SUCCESS))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int writeRecord(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t id, uint8_t *rec, const NvLogHdr_t *hdr)
+{
+    memcpy(rec, hdr, sizeof(*hdr));
+    gStats.nvWrites++;
+    gStats.bytesWritten += sizeof(*hdr) + hdr->len;
+    return (nv->writeItem(id, sizeof(*hdr) + hdr->len, rec) == NVINTF_SUCCESS) ? 0 : -1;
+}
+
+static void deleteRecord(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t id)
+{
+    if(nv->deleteItem(id) == NVINTF_SUCCESS)
+    {
+        gStats.nvDeletes++;
+    }
+}
+
+int32_t NvLog_read(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item, uint32_t offset, void *buf, uint32_t len)
+{
+    NvLogState_t st;
+
+    if(scan(nv, item, &st) != 0)
+    {
+        return -1;
+    }
+    if((offset < st.total) &&
+       (rebuild(nv, item, &st, offset, (uint8_t *)buf, (st.total - offset < len) ? st.total - offset : len) != 0))
+    {
+        return -1;
+    }
+    return (int32_t)st.total;
+}
+
+int32_t NvLog_length(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item)
+{
+    NvLogState_t st;
+
+    if(scan(nv, item, &st) != 0)
+    {
+        return -1;
+    }
+    return (int32_t)st.total;
+}
+
+int32_t NvLog_write(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item, const void *data, uint32_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    NvLogState_t st;
+    NvLogHdr_t hdr;
+    uint8_t *old, *rec;
+    uint32_t first, last, k;
+    int32_t ret;
+
+    if(len > 0xFFFF)
+    {
+        return -1;
+    }
+    gStats.writes++;
+
+    if(scan(nv, item, &st) != 0)
+    {
+        // New item, the first base. Deltas a reset left behind from a removed
+        // item must not match it, so its sequence number starts past theirs.
+        rec = os_malloc(sizeof(NvLogHdr_t) + len);
+        if(NULL == rec)
+        {
+            return -1;
+        }
+        memcpy(rec + sizeof(NvLogHdr_t), src, len);
+        hdr.magic = OSI_NVLOG_MAGIC;
+        hdr.total = len;
+        hdr.seq = hdr.baseSeq = staleSeq(nv, item) + 1;
+        hdr.offset = 0;
+        hdr.len = len;
+        gStats.compactions++;
+        ret = writeRecord(nv, subItem(item, NVLOG_BASE_SUBID(0)), rec, &hdr);
+        os_free(rec);
+        return ret;
+    }
+
+    // One buffer: the current image, then the record to write
+    old = os_malloc(st.total + sizeof(NvLogHdr_t) + len);
+    if(NULL == old)
+    {
+        return -1;
+    }
+    rec = old + st.total;
+    if(rebuild(nv, item, &st, 0, old, st.total) != 0)
+    {
+        // Never diff against, or compact, an image that was not read
+        os_free(old);
+        return -1;
+    }
+
+    // Changed range; bytes past the end of the old image always count as changed
+    for(first = 0; (first < len) && (first < st.total) && (old[first] == src[first]); first++)
+    {
+    }
+    if(len > st.total)
+    {
+        last = len;
+    }
+    else
+    {
+        for(last = len; (last > first) && (old[last - 1] == src[last - 1]); last--)
+        {
+        }
+    }
+
+    hdr.magic = OSI_NVLOG_MAGIC;
+    hdr.total = len;
+    hdr.seq = st.seq + 1;
+    if((first == last) && (len == st.total))
+    {
+        gStats.unchanged++;
+        ret = 0;
+    }
+    else if((st.deltas < OSI_NVLOG_MAX_DELTAS) &&
+            ((sizeof(NvLogHdr_t) + last - first) * 100 <= (sizeof(NvLogHdr_t) + len) * OSI_NVLOG_DELTA_PCT))
+    {
+        hdr.baseSeq = st.baseSeq;
+        hdr.offset = first;
+        hdr.len = last - first;
+        memcpy(rec + sizeof(NvLogHdr_t), src + first, last - first);
+        gStats.deltas++;
+        ret = writeRecord(nv, subItem(item, NVLOG_DELTA_SUBID(st.deltas)), rec, &hdr);
+    }
+    else
+    {
+        // Compact: new base in the other slot first, then drop the old records
+        uint32_t slot = st.legacy ? 1 : !st.slot;
+
+        hdr.baseSeq = hdr.seq;
+        hdr.offset = 0;
+        hdr.len = len;
+        memcpy(rec + sizeof(NvLogHdr_t), src, len);
+        gStats.compactions++;
+        ret = writeRecord(nv, subItem(item, NVLOG_BASE_SUBID(slot)), rec, &hdr);
+        if(ret == 0)
+        {
+            deleteRecord(nv, subItem(item, NVLOG_BASE_SUBID(st.legacy ? 0 : st.slot)));
+            for(k = 0; k < st.deltas; k++)
+            {
+                deleteRecord(nv, subItem(item, NVLOG_DELTA_SUBID(k)));
+            }
+        }
+    }
+    os_free(old);
+    return ret;
+}
+
+int32_t NvLog_remove(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item)
+{
+    int32_t ret = -1;
+    uint32_t subID;
+
+    // Newest deltas first and the bases last, so a reset part way leaves
+    // either a readable item or deltas without a base
+    for(subID = NVLOG_DELTA_SUBID(OSI_NVLOG_MAX_DELTAS); subID-- > 0; )
+    {
+        if(nv->deleteItem(subItem(item, subID)) == NVINTF_SUCCESS)
+        {
+            gStats.nvDeletes++;
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
+void NvLog_getStats(NvLogStats_t *stats)
+{
+    *stats = gStats;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Size class block pools for os_malloc(), see osi_pool.h.
+ *
+ * All blocks live in one static arena, one class after the other, so the
+ * class of a block follows from its address. Free blocks of a class are kept
+ * on a singly linked list through their first word; taking or returning a
+ * block is a pointer swap under HwiP_disable(), which is also safe from ISRs.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "ti/drivers/dpl/HwiP.h"
+#include "osi_pool.h"
+
+typedef struct OsiPoolBlock_s {
+    struct OsiPoolBlock_s *next;
+} OsiPoolBlock_t;
+
+typedef struct {
+    uint8_t        *start;
+    uint8_t        *end;
+    OsiPoolBlock_t *freeList;
+    OsiPoolStats_t  stats;
+} OsiPoolClass_t;
+
+#define OSI_POOL_ARENA_SIZE (16 * OSI_POOL_BLOCKS_16 + 32 * OSI_POOL_BLOCKS_32 + 64 * OSI_POOL_BLOCKS_64 + \
+                             128 * OSI_POOL_BLOCKS_128 + 256 * OSI_POOL_BLOCKS_256 + 512 * OSI_POOL_BLOCKS_512)
+
+static const uint16_t gClassBlocks[OSI_POOL_NUM_CLASSES] =
+{
+    OSI_POOL_BLOCKS_16, OSI_POOL_BLOCKS_32, OSI_POOL_BLOCKS_64,
+    OSI_POOL_BLOCKS_128, OSI_POOL_BLOCKS_256, OSI_POOL_BLOCKS_512
+};
+
+static uint64_t       gArena[OSI_POOL_ARENA_SIZE / sizeof(uint64_t)];
+static OsiPoolClass_t gClass[OSI_POOL_NUM_CLASSES];
+static uint8_t        gReady;
+
+static void OsiPool_init(void)
+{
+    uint8_t *p = (uint8_t *)gArena;
+    uint32_t c, i;
+
+    for(c = 0; c < OSI_POOL_NUM_CLASSES; c++)
+    {
+        uint32_t size = 16u << c;
+        OsiPoolClass_t *pc = &gClass[c];
+
+        pc->start = p;
+        pc->freeList = NULL;
+        pc->stats.blockSize = size;
+        pc->stats.blocks = gClassBlocks[c];
+        // Build the list back to front so blocks are handed out in address order
+        for(i = gClassBlocks[c]; i > 0; i--)
+        {
+            OsiPoolBlock_t *b = (OsiPoolBlock_t *)(p + (i - 1) * size);
+            b->next = pc->freeList;
+            pc->freeList = b;
+        }
+        p += gClassBlocks[c] * size;
+        pc->end = p;
+    }
+    gReady = 1;
+}
+
+/* Smallest class holding size bytes, size must be 1..OSI_POOL_MAX_BLOCK */
+static inline uint32_t classOf(size_t size)
+{
+    return (size <= 16) ? 0 : (32 - 4 - __builtin_clz((uint32_t)size - 1));
+}
+
+void *OsiPool_alloc(size_t size)
+{
+    uintptr_t key;
+    uint32_t c;
+
+    if((0 == size) || (size > OSI_POOL_MAX_BLOCK))
+    {
+        return NULL;
+    }
+
+    key = HwiP_disable();
+    if(!gReady)
+    {
+        OsiPool_init();
+    }
+    // Use the next bigger class before giving up on the pools
+    for(c = classOf(size); c < OSI_POOL_NUM_CLASSES; c++)
+    {
+        OsiPoolClass_t *pc = &gClass[c];
+        OsiPoolBlock_t *b = pc->freeList;
+
+        if(b)
+        {
+            pc->freeList = b->next;
+            if(++pc->stats.inUse > pc->stats.highWater)
+            {
+                pc->stats.highWater = pc->stats.inUse;
+            }
+            HwiP_restore(key);
+            return b;
+        }
+        pc->stats.exhausted++;
+    }
+    HwiP_restore(key);
+
+    return NULL;
+}
+
+static OsiPoolClass_t *classOfBlock(const void *ptr)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    uint32_t c;
+
+    if((p < (const uint8_t *)gArena) || (p >= (const uint8_t *)gArena + sizeof(gArena)) || !gReady)
+    {
+        return NULL;
+    }
+    for(c = 0; c < OSI_POOL_NUM_CLASSES; c++)
+    {
+        if(p < gClass[c].end)
+        {
+            return &gClass[c];
+        }
+    }
+    return NULL;
+}
+
+int OsiPool_free(void *ptr)
+{
+    OsiPoolClass_t *pc = classOfBlock(ptr);
+    OsiPoolBlock_t *b = (OsiPoolBlock_t *)ptr;
+    uintptr_t key;
+
+    if(NULL == pc)
+    {
+        return 0;
+    }
+
+    key = HwiP_disable();
+    b->next = pc->freeList;
+    pc->freeList = b;
+    pc->stats.inUse--;
+    HwiP_restore(key);
+
+    return 1;
+}
+
+size_t OsiPool_blockSize(const void *ptr)
+{
+    OsiPoolClass_t *pc = classOfBlock(ptr);
+
+    return pc ? pc->stats.blockSize : 0;
+}
+
+void OsiPool_getStats(OsiPoolStats_t *stats)
+{
+    uintptr_t key;
+    uint32_t c;
+
+    key = HwiP_disable();
+    if(!gReady)
+    {
+        OsiPool_init();
+    }
+    for(c = 0; c < OSI_POOL_NUM_CLASSES; c++)
+    {
+        stats[c] = gClass[c].stats;
+    }
+    HwiP_restore(key);
+}
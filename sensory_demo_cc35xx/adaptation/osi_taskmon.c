@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Per task CPU load and stack headroom monitor, see osi_taskmon.h.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include <osi_kernel.h>
+#include "osi_timestamp.h"
+#include "osi_taskmon.h"
+
+/* Also built without TASK_MONITOR, the kernel configuration may refer to them */
+void TaskMon_runTimeInit(void)
+{
+    OsiTs_init();
+}
+
+uint64_t TaskMon_runTimeCounter(void)
+{
+    return OsiTs_cycles() >> TASK_MON_CLOCK_SHIFT;
+}
+
+#ifdef TASK_MONITOR
+
+#include "uart_term.h"
+
+#if !configUSE_TRACE_FACILITY || !configGENERATE_RUN_TIME_STATS
+#error "TASK_MONITOR needs configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS, see osi_taskmon.h"
+#endif
+
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME    "IDLE"
+#endif
+
+#define TASK_MON_LINE_LEN       240
+
+typedef struct {
+    uint32_t number;
+    uint32_t runTime;                   // low word of the task's run-time counter
+    uint8_t  warned;                    // stack warning printed
+} TaskMonPrev_t;
+
+static TaskStatus_t     gStatus[TASK_MON_MAX_TASKS];
+static TaskMonPrev_t    gPrev[TASK_MON_MAX_TASKS];
+static uint32_t         gNumPrev;
+static TaskMonStats_t   gLast;
+static OsiLockObj_t     gLock;
+
+static TaskMonPrev_t *findPrev(uint32_t number)
+{
+    uint32_t i;
+
+    for(i = 0; i < gNumPrev; i++)
+    {
+        if(gPrev[i].number == number)
+        {
+            return &gPrev[i];
+        }
+    }
+    return NULL;
+}
+
+void TaskMon_sample(TaskMonStats_t *stats)
+{
+    TaskMonPrev_t next[TASK_MON_MAX_TASKS];
+    uint32_t delta[TASK_MON_MAX_TASKS];
+    uint32_t total = 0;
+    uint32_t idle = 0;
+    uint32_t i, n;
+
+    osi_LockObjLock(&gLock, OSI_WAIT_FOREVER);
+    memset(stats, 0, sizeof(*stats));
+    n = uxTaskGetNumberOfTasks();
+    if(n > TASK_MON_MAX_TASKS)
+    {
+        stats->dropped = n - TASK_MON_MAX_TASKS;
+    }
+    // Also walks every stack for its high water mark, with the scheduler suspended
+    n = uxTaskGetSystemState(gStatus, TASK_MON_MAX_TASKS, NULL);
+
+    for(i = 0; i < n; i++)
+    {
+        TaskMonPrev_t *prev = findPrev(gStatus[i].xTaskNumber);
+        uint32_t runTime = (uint32_t)gStatus[i].ulRunTimeCounter;
+
+        // A task not seen before ran only since it was created
+        delta[i] = runTime - (prev ? prev->runTime : 0);
+        total += delta[i];
+        next[i].number = gStatus[i].xTaskNumber;
+        next[i].runTime = runTime;
+        next[i].warned = prev ? prev->warned : 0;
+    }
+
+    for(i = 0; i < n; i++)
+    {
+        TaskMonTask_t *t = &stats->tasks[i];
+
+        t->name = gStatus[i].pcTaskName;
+        t->number = gStatus[i].xTaskNumber;
+        t->priority = gStatus[i].uxCurrentPriority;
+        t->cpuPermille = total ? (uint32_t)((uint64_t)delta[i] * 1000 / total) : 0;
+        t->stackFree = gStatus[i].usStackHighWaterMark * sizeof(StackType_t);
+        if(0 == strcmp(t->name, configIDLE_TASK_NAME))
+        {
+            idle += t->cpuPermille;
+        }
+        if((t->stackFree < TASK_MON_STACK_WARN) && !next[i].warned)
+        {
+            next[i].warned = 1;
+            Report("\n\rtask monitor: %s has only %d bytes of stack left\n\r", t->name, t->stackFree);
+        }
+    }
+    stats->numTasks = n;
+    stats->idlePermille = idle;
+    stats->periodUs = (uint32_t)OsiTs_toUs((uint64_t)total << TASK_MON_CLOCK_SHIFT);
+
+    memcpy(gPrev, next, n * sizeof(next[0]));
+    gNumPrev = n;
+    gLast = *stats;
+    osi_LockObjUnlock(&gLock);
+}
+
+/* One line for the periodic record, the busiest tasks first */
+static void printRecord(const TaskMonStats_t *s)
+{
+    char line[TASK_MON_LINE_LEN];
+    uint8_t done[TASK_MON_MAX_TASKS] = { 0 };
+    uint32_t i, j, len;
+
+    len = snprintf(line, sizeof(line), "[tasks] idle %d.%d%%", s->idlePermille / 10, s->idlePermille % 10);
+    for(i = 0; (i < s->numTasks) && (len < sizeof(line)); i++)
+    {
+        uint32_t best = s->numTasks;
+
+        for(j = 0; j < s->numTasks; j++)
+        {
+            if(!done[j] && ((best == s->numTasks) || (s->tasks[j].cpuPermille > s->tasks[best].cpuPermille)))
+            {
+                best = j;
+            }
+        }
+        done[best] = 1;
+        if(0 == strcmp(s->tasks[best].name, configIDLE_TASK_NAME))
+        {
+            continue;
+        }
+        len += snprintf(&line[len], sizeof(line) - len, ", %s %d.%d%% %dB",
+                        s->tasks[best].name, s->tasks[best].cpuPermille / 10,
+                        s->tasks[best].cpuPermille % 10, s->tasks[best].stackFree);
+    }
+    Report("\n\r%s\n\r", line);
+}
+
+void TaskMon_dump(void)
+{
+    TaskMonStats_t *s = &gLast;
+    uint32_t i;
+
+    osi_LockObjLock(&gLock, OSI_WAIT_FOREVER);
+    Report("\n\rtasks: idle %d.%d%% over the last %d ms", s->idlePermille / 10, s->idlePermille % 10, s->periodUs / 1000);
+    Report("\n\r  %-12s %4s %4s %7s %10s", "name", "num", "prio", "cpu", "stack free");
+    for(i = 0; i < s->numTasks; i++)
+    {
+        Report("\n\r  %-12s %4d %4d %5d.%d%% %10d",
+               s->tasks[i].name, s->tasks[i].number, s->tasks[i].priority,
+               s->tasks[i].cpuPermille / 10, s->tasks[i].cpuPermille % 10, s->tasks[i].stackFree);
+    }
+    if(s->dropped)
+    {
+        Report("\n\r  %d more tasks, increase TASK_MON_MAX_TASKS", s->dropped);
+    }
+    Report("\n\r");
+    osi_LockObjUnlock(&gLock);
+}
+
+static void *TaskMon_task(void *pParam)
+{
+    static TaskMonStats_t stats;
+
+    while(1)
+    {
+        osi_Sleep(TASK_MON_PERIOD_S);
+        TaskMon_sample(&stats);
+        printRecord(&stats);
+    }
+
+    return NULL;
+}
+
+void TaskMon_init(void)
+{
+    static OsiThread_t thread;
+    static TaskMonStats_t stats;
+
+    osi_LockObjCreate(&gLock);
+    // Baseline, so the first record covers one period
+    TaskMon_sample(&stats);
+    osi_ThreadCreate(&thread, "TaskMon", 1024, 1, TaskMon_task, NULL);
+}
+
+#endif // TASK_MONITOR
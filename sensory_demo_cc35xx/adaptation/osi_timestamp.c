@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * 64-bit cycle timestamps, see osi_timestamp.h.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ti/drivers/dpl/HwiP.h"
+#include "ti/drivers/dpl/ClockP.h"
+#include "osi_timestamp.h"
+
+#define HWREG(x)                (*((volatile unsigned long *)(x)))
+#define DEMCR                   0xE000EDFC
+#define DEMCR_TRCENA            0x01000000
+#define DWT_CTRL                0xE0001000
+#define DWT_CTRL_CYCCNTENA      0x00000001
+
+static uint32_t      gLast;             // counter at the previous reading
+static uint32_t      gHigh;             // upper word of the extended counter
+static uint64_t      gSlept;            // cycles added for time the counter was stopped
+static uint64_t      gStartTicks;       // system ticks at OsiTs_init()
+static uint32_t      gStartCycles;      // counter at OsiTs_init()
+static uint32_t      gHz;
+static uint32_t      gCyclesPerTick;
+static ClockP_Handle gGuard;
+
+uint64_t OsiTs_cycles(void)
+{
+    uintptr_t key = HwiP_disable();
+    uint32_t now = OSI_TS_CYCCNT;
+    uint64_t cycles, expected;
+
+    if(now < gLast)
+    {
+        gHigh++;
+    }
+    gLast = now;
+    cycles = (((uint64_t)gHigh << 32) | now) + gSlept;
+
+    // The counter stops while the core sleeps, the system ticks do not: catch up
+    // at the first reading after wake-up, so the step never lands in a later interval.
+    // Tick based time is only accurate to a tick, allow two.
+    expected = gStartCycles + (ClockP_getSystemTicks64() - gStartTicks) * gCyclesPerTick;
+    if(cycles + 2 * gCyclesPerTick < expected)
+    {
+        gSlept += expected - cycles;
+        cycles = expected;
+    }
+    HwiP_restore(key);
+
+    return cycles;
+}
+
+/* Keeps the extension going when nobody else asks for the time */
+static void OsiTs_guard(uintptr_t arg)
+{
+    (void)OsiTs_cycles();
+}
+
+void OsiTs_init(void)
+{
+    ClockP_FreqHz freq;
+    ClockP_Params params;
+    uintptr_t key;
+
+    if(NULL != gGuard)
+    {
+        return;
+    }
+
+    ClockP_getCpuFreq(&freq);
+    gHz = freq.lo;
+    gCyclesPerTick = (uint32_t)((uint64_t)gHz * ClockP_getSystemTickPeriod() / 1000000);
+
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+
+    key = HwiP_disable();
+    gStartTicks = ClockP_getSystemTicks64();
+    gLast = OSI_TS_CYCCNT;
+    gStartCycles = gLast;
+    HwiP_restore(key);
+
+    ClockP_Params_init(&params);
+    params.period = OSI_TS_GUARD_MS * 1000 / ClockP_getSystemTickPeriod();
+    params.startFlag = true;
+    gGuard = ClockP_create(OsiTs_guard, params.period, &params);
+}
+
+uint32_t OsiTs_clockHz(void)
+{
+    return gHz;
+}
+
+uint64_t OsiTs_toUs(uint64_t cycles)
+{
+    return gHz ? cycles / (gHz / 1000000) : 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Zero-copy ownership passing queues, see osi_zcq.h.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include <osi_kernel.h>
+#include "ti/drivers/dpl/SemaphoreP.h"
+#include "ti/drivers/dpl/ClockP.h"
+#include "ti/drivers/dpl/HwiP.h"
+#include "osi_zcq.h"
+
+static void zcqFree(void *data, void *arg)
+{
+    os_free(data);
+}
+
+OsiReturnVal_e osi_ZcqCreate(OsiZcq_t *pZcq, uint32_t depth)
+{
+    SemaphoreP_Params params;
+
+    //Check for NULL
+    if((NULL == pZcq) || (depth == 0) || (depth & (depth - 1)))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    memset(pZcq, 0, sizeof(*pZcq));
+    pZcq->ring = os_malloc(depth * sizeof(OsiZcqBuf_t));
+    if(NULL == pZcq->ring)
+    {
+        return OSI_MEMORY_ALLOCATION_FAILURE;
+    }
+    pZcq->mask = depth - 1;
+
+    SemaphoreP_Params_init(&params);
+    params.mode = SemaphoreP_Mode_COUNTING;
+    pZcq->items = SemaphoreP_create(0, &params);
+    if(NULL == pZcq->items)
+    {
+        os_free(pZcq->ring);
+        pZcq->ring = NULL;
+        return OSI_OPERATION_FAILED;
+    }
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_ZcqDelete(OsiZcq_t *pZcq)
+{
+    OsiZcqBuf_t buf;
+
+    //Check for NULL
+    if((NULL == pZcq) || (NULL == pZcq->ring))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    while(OSI_OK == osi_ZcqReceive(pZcq, &buf, OSI_NO_WAIT))
+    {
+        osi_ZcqBufRelease(&buf);
+    }
+    SemaphoreP_delete((SemaphoreP_Handle)pZcq->items);
+    os_free(pZcq->ring);
+    pZcq->ring = NULL;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_ZcqPost(OsiZcq_t *pZcq, const OsiZcqBuf_t *pBuf)
+{
+    uintptr_t key;
+    uint32_t used;
+
+    //Check for NULL
+    if((NULL == pZcq) || (NULL == pBuf))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    key = HwiP_disable();
+    used = pZcq->head - pZcq->tail;
+    if(used > pZcq->mask)
+    {
+        pZcq->full++;
+        HwiP_restore(key);
+        return OSI_OPERATION_FAILED;
+    }
+    pZcq->ring[pZcq->head & pZcq->mask] = *pBuf;
+    pZcq->head++;
+    pZcq->posted++;
+    if(used + 1 > pZcq->highWater)
+    {
+        pZcq->highWater = used + 1;
+    }
+    HwiP_restore(key);
+
+    SemaphoreP_post((SemaphoreP_Handle)pZcq->items);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_ZcqReceive(OsiZcq_t *pZcq, OsiZcqBuf_t *pBuf, OsiTime_t Timeout)
+{
+    uintptr_t key;
+
+    //Check for NULL
+    if((NULL == pZcq) || (NULL == pBuf))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    if(Timeout == OSI_WAIT_FOREVER)
+    {
+        Timeout = portMAX_DELAY;
+    }
+    else
+    {
+        Timeout = (Timeout * 1000) / ClockP_getSystemTickPeriod();
+    }
+
+    if(SemaphoreP_OK != SemaphoreP_pend((SemaphoreP_Handle)pZcq->items, (uint32_t)Timeout))
+    {
+        return OSI_TIMEOUT;
+    }
+
+    // The count guarantees an entry, the lock only orders concurrent readers
+    key = HwiP_disable();
+    *pBuf = pZcq->ring[pZcq->tail & pZcq->mask];
+    pZcq->tail++;
+    HwiP_restore(key);
+    return OSI_OK;
+}
+
+uint32_t osi_ZcqCount(OsiZcq_t *pZcq)
+{
+    if(NULL == pZcq)
+    {
+        return 0;
+    }
+    return pZcq->head - pZcq->tail;
+}
+
+OsiReturnVal_e osi_ZcqBufAlloc(OsiZcqBuf_t *pBuf, uint32_t len)
+{
+    //Check for NULL
+    if(NULL == pBuf)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    pBuf->data = os_malloc(len);
+    if(NULL == pBuf->data)
+    {
+        return OSI_MEMORY_ALLOCATION_FAILURE;
+    }
+    pBuf->len = len;
+    pBuf->release = zcqFree;
+    pBuf->arg = NULL;
+    return OSI_OK;
+}
+
+void osi_ZcqBufRelease(OsiZcqBuf_t *pBuf)
+{
+    if((NULL != pBuf) && (NULL != pBuf->release))
+    {
+        pBuf->release(pBuf->data, pBuf->arg);
+    }
+}
@@ -0,0 +1,938 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Linux backend of the osi_* / os_* adaptation API (see adaptation/osi_dpl.c
+ * for the TI DPL / FreeRTOS one), so the code above it can be unit tested
+ * and benchmarked on a workstation:
+ *  - sync objects, locks and counting semaphores are futex based semaphores
+ *  - message queues copy into a ring guarded by a mutex and two semaphores
+ *  - timers are timerfds served by one epoll thread
+ *  - threads are pthreads; priorities are not applied, they need root
+ *  - times are CLOCK_MONOTONIC, the host tick is 1 ms
+ *  - the critical section is one process wide recursive mutex
+ *
+ * Build with -Iadaptation/posix ahead of any SDK include path so the host
+ * osi_kernel.h is used.
+ */
+
+#ifdef __linux__
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include "osi_kernel.h"
+
+/*******************************************************************************
+
+    DEFINES and SETTINGS
+
+********************************************************************************/
+
+typedef struct {
+    uint32_t count;             // futex word
+    uint32_t max;
+    uint32_t waiters;
+} PosixSem_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    PosixSem_t      items;
+    PosixSem_t      spaces;
+    uint32_t        msgSize;
+    uint32_t        maxMsgs;
+    uint32_t        head;
+    uint32_t        tail;
+    uint8_t         buf[];
+} PosixMsgQ_t;
+
+typedef struct PosixTimer {
+    int                             fd;         // -1 once deleted
+    P_TIMER_EXPIRY_LEGACY_FUNCTION  func;
+    void                            *param;
+    struct PosixTimer               *next;      // deleted timers waiting to be freed
+} PosixTimer_t;
+
+typedef struct {
+    P_THREAD_ENTRY_FUNCTION func;
+    void                    *param;
+    char                    name[16];
+} PosixThreadStart_t;
+
+static pthread_mutex_t gCritical = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static pthread_mutex_t gReportLock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_once_t  gTimerOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t gTimerLock = PTHREAD_MUTEX_INITIALIZER;     // guards the fds and gTimerDeleted
+static int             gTimerEpoll = -1;
+static PosixTimer_t    *gTimerDeleted;
+
+/*******************************************************************************
+
+    MISCELLANEOUS
+
+********************************************************************************/
+
+static struct timespec tsAddMs(struct timespec ts, uint32_t ms)
+{
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (long)(ms % 1000) * 1000000;
+    if(ts.tv_nsec >= 1000000000)
+    {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    return ts;
+}
+
+/* Time left until deadline, 0 if it has passed */
+static int tsRemaining(const struct timespec *deadline, struct timespec *left)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    left->tv_sec = deadline->tv_sec - now.tv_sec;
+    left->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+    if(left->tv_nsec < 0)
+    {
+        left->tv_sec--;
+        left->tv_nsec += 1000000000;
+    }
+    return (left->tv_sec > 0) || ((left->tv_sec == 0) && (left->tv_nsec > 0));
+}
+
+uint32_t TICK_TO_mSEC(uint32_t Tick)
+{
+    return Tick;
+}
+
+uint32_t mSEC_TO_TICK(uint32_t mSec)
+{
+    return mSec;
+}
+
+int Report(const char *pcFormat, ...)
+{
+    va_list args;
+    int ret;
+
+    pthread_mutex_lock(&gReportLock);
+    va_start(args, pcFormat);
+    ret = vprintf(pcFormat, args);
+    va_end(args);
+    fflush(stdout);
+    pthread_mutex_unlock(&gReportLock);
+    return ret;
+}
+
+int ReportNoLock(const char *pcFormat, ...)
+{
+    va_list args;
+    int ret;
+
+    va_start(args, pcFormat);
+    ret = vprintf(pcFormat, args);
+    va_end(args);
+    return ret;
+}
+
+void ASSERT_GENERAL(unsigned int condition)
+{
+    if(FALSE == condition)
+    {
+        fprintf(stderr, "\n\rASSSSEEEERRRTTT!!!! in %p\n\r", __builtin_return_address(0));
+        abort();
+    }
+}
+
+/*******************************************************************************
+
+    Critical section
+
+********************************************************************************/
+
+uint32_t osi_EnterCritical(void)
+{
+    pthread_mutex_lock(&gCritical);
+    return 0;
+}
+
+uint32_t osi_ExitCritical(uint32_t ulKey)
+{
+    pthread_mutex_unlock(&gCritical);
+    return 0;
+}
+
+/*******************************************************************************
+
+    FUTEX SEMAPHORE
+
+********************************************************************************/
+
+static PosixSem_t *semCreate(uint32_t initial, uint32_t max)
+{
+    PosixSem_t *sem = malloc(sizeof(PosixSem_t));
+
+    if(NULL != sem)
+    {
+        sem->count = initial;
+        sem->max = max;
+        sem->waiters = 0;
+    }
+    return sem;
+}
+
+static OsiReturnVal_e semWait(PosixSem_t *sem, OsiTime_t Timeout)
+{
+    struct timespec deadline, left;
+
+    if((Timeout != OSI_WAIT_FOREVER) && (Timeout != OSI_NO_WAIT))
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline = tsAddMs(deadline, Timeout);
+    }
+
+    while(1)
+    {
+        uint32_t count = __atomic_load_n(&sem->count, __ATOMIC_ACQUIRE);
+
+        while(count > 0)
+        {
+            if(__atomic_compare_exchange_n(&sem->count, &count, count - 1, 0,
+                                           __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return OSI_OK;
+            }
+        }
+        if(Timeout == OSI_NO_WAIT)
+        {
+            return OSI_TIMEOUT;
+        }
+        if((Timeout != OSI_WAIT_FOREVER) && !tsRemaining(&deadline, &left))
+        {
+            return OSI_TIMEOUT;
+        }
+
+        // Sleeps only while the count is still 0, so a post in between is not lost
+        __atomic_fetch_add(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+        syscall(SYS_futex, &sem->count, FUTEX_WAIT_PRIVATE, 0,
+                (Timeout == OSI_WAIT_FOREVER) ? NULL : &left, NULL, 0);
+        __atomic_fetch_sub(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+/* Returns 0 when the count is already at its maximum */
+static int semPost(PosixSem_t *sem)
+{
+    uint32_t count = __atomic_load_n(&sem->count, __ATOMIC_RELAXED);
+
+    do
+    {
+        if(count >= sem->max)
+        {
+            return 0;
+        }
+    } while(!__atomic_compare_exchange_n(&sem->count, &count, count + 1, 0,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+
+    if(__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST))
+    {
+        syscall(SYS_futex, &sem->count, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+    return 1;
+}
+
+/*******************************************************************************
+
+    SYNC
+
+********************************************************************************/
+
+OsiReturnVal_e osi_SyncObjCreate(OsiSyncObj_t* pSyncObj)
+{
+    //Check for NULL
+    if(NULL == pSyncObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    *pSyncObj = semCreate(0, 1);
+    return (NULL != *pSyncObj) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+OsiReturnVal_e osi_SyncObjDelete(OsiSyncObj_t* pSyncObj)
+{
+    //Check for NULL
+    if(NULL == pSyncObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    free(*pSyncObj);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_SyncObjSignal(OsiSyncObj_t* pSyncObj)
+{
+    //Check for NULL
+    if(NULL == pSyncObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    // Binary: signalling a signalled object is not an error
+    semPost((PosixSem_t *)*pSyncObj);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_SyncObjSignalFromISR(OsiSyncObj_t* pSyncObj)
+{
+    return osi_SyncObjSignal(pSyncObj);
+}
+
+OsiReturnVal_e osi_SyncObjWait(OsiSyncObj_t* pSyncObj, OsiTime_t Timeout)
+{
+    //Check for NULL
+    if(NULL == pSyncObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    return semWait((PosixSem_t *)*pSyncObj, Timeout);
+}
+
+OsiReturnVal_e osi_SyncObjClear(OsiSyncObj_t* pSyncObj)
+{
+    //Check for NULL
+    if(NULL == pSyncObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    return (OSI_OK == osi_SyncObjWait(pSyncObj, OSI_NO_WAIT)) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+/*******************************************************************************
+
+    LOCK
+
+********************************************************************************/
+
+OsiReturnVal_e osi_LockObjCreate(OsiLockObj_t* pLockObj)
+{
+    //Check for NULL
+    if(NULL == pLockObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    *pLockObj = semCreate(1, 1);
+    return (NULL != *pLockObj) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+OsiReturnVal_e osi_LockObjDelete(OsiLockObj_t* pLockObj)
+{
+    //Check for NULL
+    if(NULL == pLockObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    free(*pLockObj);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_LockObjLock(OsiLockObj_t* pLockObj, OsiTime_t Timeout)
+{
+    //Check for NULL
+    if(NULL == pLockObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    return semWait((PosixSem_t *)*pLockObj, Timeout);
+}
+
+OsiReturnVal_e osi_LockObjUnlock(OsiLockObj_t* pLockObj)
+{
+    //Check for NULL
+    if(NULL == pLockObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    return semPost((PosixSem_t *)*pLockObj) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+/*******************************************************************************
+
+    MESSAGE QUEUE
+
+********************************************************************************/
+
+OsiReturnVal_e osi_MsgQCreate(OsiMsgQ_t* pMsgQ, char* pMsgQName, uint32_t MsgSize, uint32_t MaxMsgs)
+{
+    PosixMsgQ_t *q;
+
+    //Check for NULL
+    if((NULL == pMsgQ) || (MsgSize == 0) || (MaxMsgs == 0))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    q = calloc(1, sizeof(PosixMsgQ_t) + (size_t)MsgSize * MaxMsgs);
+    if(NULL == q)
+    {
+        return OSI_OPERATION_FAILED;
+    }
+    pthread_mutex_init(&q->lock, NULL);
+    q->items.max = MaxMsgs;
+    q->spaces.count = MaxMsgs;
+    q->spaces.max = MaxMsgs;
+    q->msgSize = MsgSize;
+    q->maxMsgs = MaxMsgs;
+
+    *pMsgQ = q;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_MsgQDelete(OsiMsgQ_t* pMsgQ)
+{
+    //Check for NULL
+    if(NULL == pMsgQ)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    pthread_mutex_destroy(&((PosixMsgQ_t *)*pMsgQ)->lock);
+    free(*pMsgQ);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_MsgQWrite(OsiMsgQ_t* pMsgQ, void* pMsg, OsiTime_t Timeout, uint8_t flags)
+{
+    PosixMsgQ_t *q;
+
+    //Check for NULL
+    if((NULL == pMsgQ) || (NULL == pMsg))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+    q = (PosixMsgQ_t *)*pMsgQ;
+
+    if(OSI_OK != semWait(&q->spaces, Timeout))
+    {
+        return OSI_OPERATION_FAILED;
+    }
+    pthread_mutex_lock(&q->lock);
+    memcpy(&q->buf[(size_t)q->head * q->msgSize], pMsg, q->msgSize);
+    q->head = (q->head + 1) % q->maxMsgs;
+    pthread_mutex_unlock(&q->lock);
+    semPost(&q->items);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_MsgQRead(OsiMsgQ_t* pMsgQ, void* pMsg, OsiTime_t Timeout)
+{
+    PosixMsgQ_t *q;
+
+    //Check for NULL
+    if((NULL == pMsgQ) || (NULL == pMsg))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+    q = (PosixMsgQ_t *)*pMsgQ;
+
+    if(OSI_OK != semWait(&q->items, Timeout))
+    {
+        return OSI_OPERATION_FAILED;
+    }
+    pthread_mutex_lock(&q->lock);
+    memcpy(pMsg, &q->buf[(size_t)q->tail * q->msgSize], q->msgSize);
+    q->tail = (q->tail + 1) % q->maxMsgs;
+    pthread_mutex_unlock(&q->lock);
+    semPost(&q->spaces);
+    return OSI_OK;
+}
+
+uint32_t osi_MsgQCount(OsiMsgQ_t* pMsgQ)
+{
+    if(NULL == pMsgQ)
+    {
+        return 0;
+    }
+    return __atomic_load_n(&((PosixMsgQ_t *)*pMsgQ)->items.count, __ATOMIC_RELAXED);
+}
+
+BOOLEAN osi_MsgQIsEmpty(OsiMsgQ_t* pMsgQ)
+{
+    return (osi_MsgQCount(pMsgQ) == 0);
+}
+
+/*******************************************************************************
+
+    MEMORY
+
+********************************************************************************/
+
+void *os_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+void *os_realloc(void *ptr, size_t newsize)
+{
+    return realloc(ptr, newsize);
+}
+
+void *os_realloc_array(void *ptr, size_t nmemb, size_t size)
+{
+    if(size && (nmemb > (~(size_t)0) / size))
+    {
+        return NULL;
+    }
+    return realloc(ptr, nmemb * size);
+}
+
+void *os_calloc(size_t nmemb, size_t size)
+{
+    return calloc(nmemb, size);
+}
+
+void *os_zalloc(size_t size)
+{
+    return calloc(1, size);
+}
+
+void os_free(void *ptr)
+{
+    free(ptr);
+}
+
+uint32_t os_blockSize(void *ptr)
+{
+    return (uint32_t)malloc_usable_size(ptr);
+}
+
+size_t osi_GetFreeHeapSize(void)
+{
+    struct mallinfo2 mi = mallinfo2();
+
+    return mi.fordblks;
+}
+
+/*******************************************************************************
+
+    TIME
+
+********************************************************************************/
+
+static OsiReturnVal_e sleepNs(uint64_t ns)
+{
+    struct timespec ts = { .tv_sec = (time_t)(ns / 1000000000), .tv_nsec = (long)(ns % 1000000000) };
+
+    while(EINTR == clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts))
+    {
+    }
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_Sleep(OsiTime_t sec)
+{
+    return sleepNs((uint64_t)sec * 1000000000);
+}
+
+OsiReturnVal_e osi_uSleep(OsiTime_t usec)
+{
+    return sleepNs((uint64_t)usec * 1000);
+}
+
+uint32_t osi_GetTimeMS(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+uint64_t osi_GetDateTimeS(void)
+{
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return ts.tv_sec;
+}
+
+void osi_SetDateTimeS(uint64_t newtime)
+{
+    struct timespec ts = {0};
+
+    ts.tv_sec = newtime;
+    clock_settime(CLOCK_REALTIME, &ts);
+}
+
+/*******************************************************************************
+
+    TIMERS
+
+*******************************************************************************/
+
+/* Runs the expiry callbacks, one at a time like the target's timer task */
+static void *timerThread(void *pParam)
+{
+    struct epoll_event ev[8];
+    int n, i;
+
+    while(1)
+    {
+        n = epoll_wait(gTimerEpoll, ev, 8, -1);
+        for(i = 0; i < n; i++)
+        {
+            PosixTimer_t *t = ev[i].data.ptr;
+            uint64_t expirations;
+            int expired;
+
+            pthread_mutex_lock(&gTimerLock);
+            // A timer stopped or deleted after epoll_wait returned reads nothing
+            expired = (t->fd >= 0) && (sizeof(expirations) == read(t->fd, &expirations, sizeof(expirations)));
+            pthread_mutex_unlock(&gTimerLock);
+
+            // Without the lock, a callback may stop or delete its own timer; t is only freed below
+            if(expired)
+            {
+                t->func(t->param);
+            }
+        }
+
+        // Deleted timers can no longer be in a later epoll_wait result
+        pthread_mutex_lock(&gTimerLock);
+        while(NULL != gTimerDeleted)
+        {
+            PosixTimer_t *t = gTimerDeleted;
+            gTimerDeleted = t->next;
+            free(t);
+        }
+        pthread_mutex_unlock(&gTimerLock);
+    }
+
+    return NULL;
+}
+
+static void timerInit(void)
+{
+    pthread_t thread;
+
+    gTimerEpoll = epoll_create1(EPOLL_CLOEXEC);
+    if(gTimerEpoll >= 0)
+    {
+        pthread_create(&thread, NULL, timerThread, NULL);
+        pthread_detach(thread);
+        pthread_setname_np(thread, "osi_timers");
+    }
+}
+
+OsiReturnVal_e osi_TimerCreate(OsiTimer_t* pTimer, char* pTimerName, P_TIMER_EXPIRY_LEGACY_FUNCTION pExpiryFunc, void* pParam)
+{
+    struct epoll_event ev;
+    PosixTimer_t *t;
+
+    if((NULL == pTimer) || (NULL == pExpiryFunc))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    pthread_once(&gTimerOnce, timerInit);
+    if(gTimerEpoll < 0)
+    {
+        return OSI_OPERATION_FAILED;
+    }
+
+    t = malloc(sizeof(PosixTimer_t));
+    if(NULL == t)
+    {
+        return OSI_OPERATION_FAILED;
+    }
+    t->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    t->next = NULL;
+    t->func = pExpiryFunc;
+    t->param = pParam;
+    ev.events = EPOLLIN;
+    ev.data.ptr = t;
+    if((t->fd < 0) || (0 != epoll_ctl(gTimerEpoll, EPOLL_CTL_ADD, t->fd, &ev)))
+    {
+        if(t->fd >= 0)
+        {
+            close(t->fd);
+        }
+        free(t);
+        return OSI_OPERATION_FAILED;
+    }
+
+    pTimer->osTimerHandler = t;
+    pTimer->callBackFunc = pExpiryFunc;
+    pTimer->params = pParam;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_TimerDelete(OsiTimer_t* pTimer)
+{
+    PosixTimer_t *t;
+
+    if((NULL == pTimer) || (NULL == pTimer->osTimerHandler))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+    t = pTimer->osTimerHandler;
+
+    // The timer thread may still hold the pointer from epoll_wait, it frees it
+    pthread_mutex_lock(&gTimerLock);
+    epoll_ctl(gTimerEpoll, EPOLL_CTL_DEL, t->fd, NULL);
+    close(t->fd);
+    t->fd = -1;
+    t->next = gTimerDeleted;
+    gTimerDeleted = t;
+    pthread_mutex_unlock(&gTimerLock);
+    pTimer->osTimerHandler = NULL;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_TimerStart(OsiTimer_t* pTimer, OsiTime_t DurationMiliSec, BOOLEAN Periodic)
+{
+    struct itimerspec its = {0};
+
+    if((NULL == pTimer) || (NULL == pTimer->osTimerHandler))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    // A zero it_value would disarm the timer, expire as soon as possible instead
+    its.it_value.tv_sec = DurationMiliSec / 1000;
+    its.it_value.tv_nsec = DurationMiliSec ? (long)(DurationMiliSec % 1000) * 1000000 : 1;
+    if(Periodic)
+    {
+        its.it_interval = its.it_value;
+    }
+    timerfd_settime(((PosixTimer_t *)pTimer->osTimerHandler)->fd, 0, &its, NULL);
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_TimerStop(OsiTimer_t* pTimer)
+{
+    struct itimerspec its = {0};
+    uint64_t expirations;
+
+    if((NULL == pTimer) || (NULL == pTimer->osTimerHandler))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    timerfd_settime(((PosixTimer_t *)pTimer->osTimerHandler)->fd, 0, &its, NULL);
+    // Drop an expiry that is pending but not delivered yet
+    (void)!read(((PosixTimer_t *)pTimer->osTimerHandler)->fd, &expirations, sizeof(expirations));
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_TimerIsActive(OsiTimer_t* pTimer)
+{
+    struct itimerspec its;
+
+    if((NULL == pTimer) || (NULL == pTimer->osTimerHandler))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    timerfd_gettime(((PosixTimer_t *)pTimer->osTimerHandler)->fd, &its);
+    return (its.it_value.tv_sec || its.it_value.tv_nsec) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+OsiTime_t osi_TimerGetRemainingTime(OsiTimer_t* pTimer)
+{
+    struct itimerspec its;
+
+    if((NULL == pTimer) || (NULL == pTimer->osTimerHandler))
+    {
+        return 0;
+    }
+
+    timerfd_gettime(((PosixTimer_t *)pTimer->osTimerHandler)->fd, &its);
+    return (OsiTime_t)(its.it_value.tv_sec * 1000 + its.it_value.tv_nsec / 1000000);
+}
+
+/*******************************************************************************
+
+    THREADS
+
+********************************************************************************/
+
+static void *threadStart(void *pParam)
+{
+    PosixThreadStart_t start = *(PosixThreadStart_t *)pParam;
+
+    free(pParam);
+    pthread_setname_np(pthread_self(), start.name);
+    return start.func(start.param);
+}
+
+OsiReturnVal_e osi_ThreadCreate(OsiThread_t* pThread, char* pThreadName, uint32_t StackSize, uint32_t Priority,
+                                P_THREAD_ENTRY_FUNCTION pEntryFunc, void* pParam)
+{
+    PosixThreadStart_t *start;
+    pthread_attr_t attr;
+    pthread_t thread;
+    int ret;
+
+    if((NULL == pThread) ||
+       (StackSize < OSI_MIN_THREAD_STACK_SIZE) ||
+       (Priority >= 32) ||
+       (NULL == pEntryFunc))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    start = malloc(sizeof(PosixThreadStart_t));
+    if(NULL == start)
+    {
+        return OSI_MEMORY_ALLOCATION_FAILURE;
+    }
+    start->func = pEntryFunc;
+    start->param = pParam;
+    snprintf(start->name, sizeof(start->name), "%s", pThreadName ? pThreadName : "osi");
+
+    // StackSize is sized for the target, host code (libc, printf) keeps the default stack
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    ret = pthread_create(&thread, &attr, threadStart, start);
+    pthread_attr_destroy(&attr);
+    if(0 != ret)
+    {
+        free(start);
+        return OSI_OPERATION_FAILED;
+    }
+
+    *pThread = (OsiThread_t)thread;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_ThreadDelete(OsiThread_t* pThread)
+{
+    if(NULL == pThread)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    pthread_cancel((pthread_t)*pThread);
+    return OSI_OK;
+}
+
+OsiThread_t osi_GetCurrentThread(void)
+{
+    return (OsiThread_t)pthread_self();
+}
+
+/*******************************************************************************
+
+    SEMAPHORE
+
+********************************************************************************/
+
+OsiReturnVal_e osi_SemaphoreObjCreate(OsiSemaphoreObj_t* pSemaphoreObj, const char* pSemaphoreObjName,
+                                      const uint32 initialCount, const uint32 maxCount)
+{
+    //Check for NULL
+    if((NULL == pSemaphoreObj) || (initialCount > maxCount))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    pSemaphoreObj->max_count = maxCount;
+    pSemaphoreObj->Semaphore = semCreate(initialCount, maxCount);
+    return (NULL != pSemaphoreObj->Semaphore) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+OsiReturnVal_e osi_SemaphoreObjDelete(OsiSemaphoreObj_t* pSemaphoreObj)
+{
+    //Check for NULL
+    if(NULL == pSemaphoreObj)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    free(pSemaphoreObj->Semaphore);
+    pSemaphoreObj->Semaphore = NULL;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_SemaphoreObjObtain(OsiSemaphoreObj_t* pSemaphoreObj, OsiTime_t Timeout)
+{
+    //Check for NULL
+    if((NULL == pSemaphoreObj) || (NULL == pSemaphoreObj->Semaphore))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    return semWait((PosixSem_t *)pSemaphoreObj->Semaphore, Timeout);
+}
+
+OsiReturnVal_e osi_SemaphoreObjRelease(OsiSemaphoreObj_t* pSemaphoreObj)
+{
+    //Check for NULL
+    if((NULL == pSemaphoreObj) || (NULL == pSemaphoreObj->Semaphore))
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    return semPost((PosixSem_t *)pSemaphoreObj->Semaphore) ? OSI_OK : OSI_OPERATION_FAILED;
+}
+
+uint32_t osi_SemaphoreObjGetCount(OsiSemaphoreObj_t* pSemaphoreObj)
+{
+    //Check for NULL
+    if((NULL == pSemaphoreObj) || (NULL == pSemaphoreObj->Semaphore))
+    {
+        return 0;
+    }
+
+    return __atomic_load_n(&((PosixSem_t *)pSemaphoreObj->Semaphore)->count, __ATOMIC_RELAXED);
+}
+
+#endif // __linux__
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Host (Linux) stand-in for the SDK's osi_kernel.h, used together with
+ * osi_dpl_posix.c to build code written against the osi_* / os_* API on a
+ * workstation. It declares the subset implemented by adaptation/osi_dpl.c;
+ * keep the types and return codes in step with the SDK header.
+ */
+
+#ifndef __OSI_KERNEL_H__
+#define __OSI_KERNEL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef uint32_t    uint32;
+typedef int32_t     int32;
+typedef uint8_t     BOOLEAN;
+
+#ifndef TRUE
+#define TRUE        1
+#endif
+#ifndef FALSE
+#define FALSE       0
+#endif
+
+typedef uint32_t OsiTime_t;
+
+#define OSI_WAIT_FOREVER            (0xFFFFFFFF)
+#define OSI_NO_WAIT                 (0)
+#define OSI_MIN_THREAD_STACK_SIZE   (512)
+
+typedef enum
+{
+    OSI_OK                          = 0,
+    OSI_FAILURE                     = -1,
+    OSI_OPERATION_FAILED            = -2,
+    OSI_ABORTED                     = -3,
+    OSI_INVALID_PARAMS              = -4,
+    OSI_MEMORY_ALLOCATION_FAILURE   = -5,
+    OSI_TIMEOUT                     = -6
+} OsiReturnVal_e;
+
+typedef void *OsiSyncObj_t;
+typedef void *OsiLockObj_t;
+typedef void *OsiMsgQ_t;
+typedef void *OsiThread_t;
+
+typedef void (*P_TIMER_EXPIRY_LEGACY_FUNCTION)(void *pParam);
+typedef void *(*P_THREAD_ENTRY_FUNCTION)(void *pParam);
+
+typedef struct
+{
+    void                            *osTimerHandler;
+    P_TIMER_EXPIRY_LEGACY_FUNCTION  callBackFunc;
+    void                            *params;
+} OsiTimer_t;
+
+typedef struct
+{
+    void        *Semaphore;
+    uint32_t    max_count;
+} OsiSemaphoreObj_t;
+
+#define os_memcpy   memcpy
+#define os_memmove  memmove
+#define os_memset   memset
+
+#define osi_EnterCriticalSection()  osi_EnterCritical()
+
+int Report(const char *pcFormat, ...);
+int ReportNoLock(const char *pcFormat, ...);
+void ASSERT_GENERAL(unsigned int condition);
+
+uint32_t TICK_TO_mSEC(uint32_t Tick);
+uint32_t mSEC_TO_TICK(uint32_t mSec);
+
+uint32_t osi_EnterCritical(void);
+uint32_t osi_ExitCritical(uint32_t ulKey);
+
+OsiReturnVal_e osi_SyncObjCreate(OsiSyncObj_t *pSyncObj);
+OsiReturnVal_e osi_SyncObjDelete(OsiSyncObj_t *pSyncObj);
+OsiReturnVal_e osi_SyncObjSignal(OsiSyncObj_t *pSyncObj);
+OsiReturnVal_e osi_SyncObjSignalFromISR(OsiSyncObj_t *pSyncObj);
+OsiReturnVal_e osi_SyncObjWait(OsiSyncObj_t *pSyncObj, OsiTime_t Timeout);
+OsiReturnVal_e osi_SyncObjClear(OsiSyncObj_t *pSyncObj);
+
+OsiReturnVal_e osi_LockObjCreate(OsiLockObj_t *pLockObj);
+OsiReturnVal_e osi_LockObjDelete(OsiLockObj_t *pLockObj);
+OsiReturnVal_e osi_LockObjLock(OsiLockObj_t *pLockObj, OsiTime_t Timeout);
+OsiReturnVal_e osi_LockObjUnlock(OsiLockObj_t *pLockObj);
+
+OsiReturnVal_e osi_MsgQCreate(OsiMsgQ_t *pMsgQ, char *pMsgQName, uint32_t MsgSize, uint32_t MaxMsgs);
+OsiReturnVal_e osi_MsgQDelete(OsiMsgQ_t *pMsgQ);
+OsiReturnVal_e osi_MsgQWrite(OsiMsgQ_t *pMsgQ, void *pMsg, OsiTime_t Timeout, uint8_t flags);
+OsiReturnVal_e osi_MsgQRead(OsiMsgQ_t *pMsgQ, void *pMsg, OsiTime_t Timeout);
+uint32_t osi_MsgQCount(OsiMsgQ_t *pMsgQ);
+BOOLEAN osi_MsgQIsEmpty(OsiMsgQ_t *pMsgQ);
+
+void *os_malloc(size_t size);
+void *os_realloc(void *ptr, size_t newsize);
+void *os_realloc_array(void *ptr, size_t nmemb, size_t size);
+void *os_calloc(size_t nmemb, size_t size);
+void *os_zalloc(size_t size);
+void os_free(void *ptr);
+uint32_t os_blockSize(void *ptr);
+
+OsiReturnVal_e osi_Sleep(OsiTime_t sec);
+OsiReturnVal_e osi_uSleep(OsiTime_t usec);
+uint32_t osi_GetTimeMS(void);
+
+OsiReturnVal_e osi_TimerCreate(OsiTimer_t *pTimer, char *pTimerName, P_TIMER_EXPIRY_LEGACY_FUNCTION pExpiryFunc, void *pParam);
+OsiReturnVal_e osi_TimerDelete(OsiTimer_t *pTimer);
+OsiReturnVal_e osi_TimerStart(OsiTimer_t *pTimer, OsiTime_t DurationMiliSec, BOOLEAN Periodic);
+OsiReturnVal_e osi_TimerStop(OsiTimer_t *pTimer);
+OsiReturnVal_e osi_TimerIsActive(OsiTimer_t *pTimer);
+OsiTime_t osi_TimerGetRemainingTime(OsiTimer_t *pTimer);
+
+OsiReturnVal_e osi_ThreadCreate(OsiThread_t *pThread, char *pThreadName, uint32_t StackSize, uint32_t Priority,
+                                P_THREAD_ENTRY_FUNCTION pEntryFunc, void *pParam);
+OsiReturnVal_e osi_ThreadDelete(OsiThread_t *pThread);
+OsiThread_t osi_GetCurrentThread(void);
+
+size_t osi_GetFreeHeapSize(void);
+
+OsiReturnVal_e osi_SemaphoreObjCreate(OsiSemaphoreObj_t *pSemaphoreObj, const char *pSemaphoreObjName,
+                                      const uint32 initialCount, const uint32 maxCount);
+OsiReturnVal_e osi_SemaphoreObjDelete(OsiSemaphoreObj_t *pSemaphoreObj);
+OsiReturnVal_e osi_SemaphoreObjObtain(OsiSemaphoreObj_t *pSemaphoreObj, OsiTime_t Timeout);
+OsiReturnVal_e osi_SemaphoreObjRelease(OsiSemaphoreObj_t *pSemaphoreObj);
+uint32_t osi_SemaphoreObjGetCount(OsiSemaphoreObj_t *pSemaphoreObj);
+
+uint64_t osi_GetDateTimeS(void);
+void osi_SetDateTimeS(uint64_t newtime);
+
+#endif // __OSI_KERNEL_H__
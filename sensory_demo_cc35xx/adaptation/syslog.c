@@ -31,58 +31,101 @@
  */
 
 #include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
 #include "osi_kernel.h"
 #include "errors.h"
 #include "syslog.h"
+#include "syslog_pool.h"
+#include "uart_log.h"
 
 #include "ti/drivers/UART2.h"
 
 UART2_Handle logger = NULL;
 
-#define SYSLOG_STRING_LIMIT  500
+#if (SYSLOG_POOL_SLOTS < 1) || (SYSLOG_POOL_SLOTS > 32)
+#error "SYSLOG_POOL_SLOTS must be 1..32"
+#endif
+
+#define SYSLOG_ALL_SLOTS    ((uint32_t)(((uint64_t)1 << SYSLOG_POOL_SLOTS) - 1))
+
+static char gSlot[SYSLOG_POOL_SLOTS][SYSLOG_SLOT_SIZE];
+static uint32_t gSlotBusy;                          // bit per slot
+static int gLogMask = LOG_UPTO(SYSLOG_LEVEL);
+static SyslogStats_t gStats;
 
 
 int32 logger_write(char *buf, uint32 len);
 
 
-char* inner_report(const char *pcFormat, va_list arg)
+/* Claim a free message slot, returns -1 when all are in use */
+static int slot_get(void)
 {
-    int iRet = 0;
-    char        *pcTemp;
-    char        *pcBuff;
-    int iSize = 256;
+    uint32_t busy = __atomic_load_n(&gSlotBusy, __ATOMIC_RELAXED);
+    int idx;
 
-    pcBuff = (char*)os_zalloc(iSize);
-    if(pcBuff == NULL)
+    do
     {
-        return NULL;
+        if(busy == SYSLOG_ALL_SLOTS)
+        {
+            return -1;
+        }
+        idx = __builtin_ctz(~busy);
     }
+    while(!__atomic_compare_exchange_n(&gSlotBusy, &busy, busy | (1u << idx), 1,
+                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+    return idx;
+}
 
-    while(1)
+static void slot_put(int idx)
+{
+    __atomic_fetch_and(&gSlotBusy, ~(1u << idx), __ATOMIC_RELEASE);
+}
+
+/* Format a message with its line break into a pool slot and send it */
+static void pool_report(int priority, const char *pcFormat, va_list arg)
+{
+    static const char newLine[] = "\n\r";
+    int idx, iRet;
+    uint32 len;
+    char *pcBuff;
+
+    // Filter before anything is formatted, SYSLOG_LEVEL first and it is not counted
+    if(LOG_PRI(priority) > SYSLOG_LEVEL)
+    {
+        return;
+    }
+    if(!(LOG_MASK(LOG_PRI(priority)) & gLogMask))
     {
-        iRet = vsnprintf(pcBuff, iSize, pcFormat, arg);
+        __atomic_fetch_add(&gStats.filtered, 1, __ATOMIC_RELAXED);
+        return;
+    }
 
-        if((iRet > -1) && (iRet < iSize))
-        {
-            break;
-        }
-        else
-        {
-            iSize *= 2;
-            if((pcTemp = os_realloc(pcBuff, iSize)) == NULL)
-            {
-                os_free(pcBuff);
-                return NULL;
-            }
-            else
-            {
-                memset(pcTemp, 0, iSize);
-                pcBuff = pcTemp;
-            }
-        }
+    idx = slot_get();
+    if(idx < 0)
+    {
+        __atomic_fetch_add(&gStats.overflow, 1, __ATOMIC_RELAXED);
+        return;
     }
+    pcBuff = gSlot[idx];
 
-    return pcBuff;
+    iRet = vsnprintf(pcBuff, SYSLOG_SLOT_SIZE - (sizeof(newLine) - 1), pcFormat, arg);
+    if(iRet < 0)
+    {
+        slot_put(idx);
+        return;
+    }
+    len = strlen(pcBuff);
+    if(len < (uint32)iRet)
+    {
+        __atomic_fetch_add(&gStats.truncated, 1, __ATOMIC_RELAXED);
+    }
+    memcpy(pcBuff + len, newLine, sizeof(newLine));
+    len += sizeof(newLine) - 1;
+
+    logger_write(pcBuff, len);
+    __atomic_fetch_add(&gStats.messages, 1, __ATOMIC_RELAXED);
+    slot_put(idx);
 }
 
 
@@ -92,7 +135,6 @@ int32 logger_write(char *buf, uint32 len)
      {
          return len;
      }
-     buf[len-1] = '\0';
 #if UART_1    
     if (logger == NULL)
     {
@@ -115,8 +157,7 @@ int32 logger_write(char *buf, uint32 len)
     return written;
 
 #else
-    Report("\n\r");
-    Report(buf);
+    UartLog_write(buf, len);
     return len;
 #endif    
 }
@@ -128,6 +169,25 @@ void openlog(const char *ident, int option, int facility)
 
 }
 
+int setlogmask(int mask)
+{
+    int old = gLogMask;
+
+    if(mask != 0)
+    {
+        gLogMask = mask;
+    }
+    return old;
+}
+
+void syslog_getStats(SyslogStats_t *stats)
+{
+    if(stats)
+    {
+        *stats = gStats;
+    }
+}
+
 void syslog(int priority, const char *format, ...)
 {
     va_list list;
@@ -143,16 +203,7 @@ void closelog(void)
 
 void vsyslog(int priority, const char *format, va_list ap)
 {
-    char *pcBuff = inner_report(format, ap);
-    if (!pcBuff)
-    {
-        return;
-    }
-    char newLine[] = "\n\r";
-
-    logger_write(pcBuff, MIN(strlen(pcBuff),SYSLOG_STRING_LIMIT));
-    logger_write(newLine, sizeof(newLine) - 1);
-    os_free(pcBuff);
+    pool_report(priority, format, ap);
 }
 
 
@@ -160,20 +211,6 @@ void gtrace_report(int group, char *fmt, ...)
 {
     va_list list;
     va_start(list, fmt);
-    char *pcBuff = inner_report(fmt, list);
+    pool_report(LOG_DEBUG, fmt, list);
     va_end(list);
-
-    if (!pcBuff)
-    {
-        return;
-    }
-
-    char newLine[] = "\n\r";
-
-   
-    logger_write(pcBuff, MIN(strlen(pcBuff),SYSLOG_STRING_LIMIT));
-    logger_write(newLine, sizeof(newLine) - 1);
-   
-    os_free(pcBuff);
 }
-
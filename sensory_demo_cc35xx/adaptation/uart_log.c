@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Non blocking console transport.
+ *
+ * Producers (any task or ISR) reserve a record in gRing by advancing gHead
+ * with a compare-and-swap, copy their bytes in and then publish the record
+ * by setting UART_LOG_COMMIT in its header. The drain task walks committed
+ * records from gTail, hands each payload to UART2_write (the driver moves it
+ * with DMA while the task sleeps) and releases the space.
+ *
+ * Record layout, 4 byte aligned:
+ *   uint32_t header  - payload length (bits 0-15) | UART_LOG_COMMIT | UART_LOG_PAD
+ *   payload          - rounded up to 4 bytes
+ * A record never wraps; if it does not fit before the end of the ring a pad
+ * record covering the rest of the ring is written first. A pad header holds
+ * the number of bytes to skip instead of a payload length.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <osi_kernel.h>
+#include <ti/drivers/UART2.h>
+#include <ti/drivers/dpl/HwiP.h>
+#include "uart_log.h"
+#include "osi_lockstat.h"
+#include "trace_rec.h"
+
+#define UART_LOG_MASK           (UART_LOG_RING_SIZE - 1)
+#define UART_LOG_LEN_MASK       0x0000FFFFu
+#define UART_LOG_COMMIT         0x00010000u
+#define UART_LOG_PAD            0x00020000u
+#define UART_LOG_ALIGN(x)       (((x) + 3u) & ~3u)
+
+#if (UART_LOG_RING_SIZE & UART_LOG_MASK) || (UART_LOG_RING_SIZE < 2 * (UART_LOG_MAX_RECORD + 4))
+#error "UART_LOG_RING_SIZE must be a power of 2 that holds at least two records"
+#endif
+
+static uint32_t         gRing[UART_LOG_RING_SIZE / sizeof(uint32_t)];
+static volatile uint32_t gHead;         // next byte to reserve, never wraps (mod 2^32)
+static volatile uint32_t gTail;         // next byte to send
+static UartLogStats_t   gStats;
+static UART2_Handle     gUart;
+static OsiSyncObj_t     gSignal;
+static OsiThread_t      gThread;
+static volatile uint8_t gStarted;
+
+#define RING_WORD(pos)  (&gRing[((pos) & UART_LOG_MASK) / sizeof(uint32_t)])
+
+static void statAdd(volatile uint32_t *counter, uint32_t n)
+{
+    __atomic_fetch_add(counter, n, __ATOMIC_RELAXED);
+}
+
+/*
+ * Reserve room for a payload of len bytes, returns the ring position of the
+ * record header or -1 if the ring is full.
+ */
+static int32_t reserve(uint32_t len)
+{
+    uint32_t need = sizeof(uint32_t) + UART_LOG_ALIGN(len);
+    uint32_t head = __atomic_load_n(&gHead, __ATOMIC_RELAXED);
+    uint32_t pad, used, hwm;
+
+    do
+    {
+        uint32_t room = UART_LOG_RING_SIZE - (head & UART_LOG_MASK);
+
+        pad = (need > room) ? room : 0;
+        used = head - __atomic_load_n(&gTail, __ATOMIC_ACQUIRE);
+        if(used + pad + need > UART_LOG_RING_SIZE)
+        {
+            return -1;
+        }
+    }
+    while(!__atomic_compare_exchange_n(&gHead, &head, head + pad + need, 1,
+                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+    if(pad)
+    {
+        __atomic_store_n(RING_WORD(head), pad | UART_LOG_PAD | UART_LOG_COMMIT, __ATOMIC_RELEASE);
+        head += pad;
+    }
+
+    used += pad + need;
+    hwm = __atomic_load_n(&gStats.highWater, __ATOMIC_RELAXED);
+    while((used > hwm) &&
+          !__atomic_compare_exchange_n(&gStats.highWater, &hwm, used, 1,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return (int32_t)head;
+}
+
+/*
+ * Send committed records, returns when the ring is empty or the next record
+ * is still being written by its producer.
+ */
+static void drain(void)
+{
+    size_t written;
+
+    while(gTail != __atomic_load_n(&gHead, __ATOMIC_ACQUIRE))
+    {
+        uint32_t tail = gTail;
+        uint32_t *pHdr = RING_WORD(tail);
+        uint32_t hdr = __atomic_load_n(pHdr, __ATOMIC_ACQUIRE);
+        uint32_t len = hdr & UART_LOG_LEN_MASK;
+        uint32_t skip;
+
+        if(!(hdr & UART_LOG_COMMIT))
+        {
+            break;
+        }
+
+        if(hdr & UART_LOG_PAD)
+        {
+            skip = len;
+        }
+        else
+        {
+            TRACE_REC_BEGIN("UART2_write");
+            UART2_write(gUart, pHdr + 1, len, &written);
+            TRACE_REC_END("UART2_write");
+            statAdd(&gStats.bytesSent, len);
+            skip = sizeof(uint32_t) + UART_LOG_ALIGN(len);
+        }
+
+        // Space is handed back zeroed so a stale word is never read as a committed header
+        memset(pHdr, 0, skip);
+        __atomic_store_n(&gTail, tail + skip, __ATOMIC_RELEASE);
+    }
+}
+
+static void *UartLog_task(void *pParam)
+{
+    while(1)
+    {
+        osi_SyncObjWait(&gSignal, OSI_WAIT_FOREVER);
+        drain();
+    }
+
+    return NULL;
+}
+
+int UartLog_init(void *uartHandle)
+{
+    if((NULL == uartHandle) || gStarted)
+    {
+        return -1;
+    }
+
+    gUart = (UART2_Handle)uartHandle;
+    if(OSI_OK != osi_SyncObjCreate(&gSignal))
+    {
+        return -1;
+    }
+    LockStat_setName(gSignal, "UartLog");
+    if(OSI_OK != osi_ThreadCreate(&gThread, "UartLog", UART_LOG_TASK_STACK_SIZE,
+                                  UART_LOG_TASK_PRIORITY, UartLog_task, NULL))
+    {
+        osi_SyncObjDelete(&gSignal);
+        return -1;
+    }
+    gStarted = 1;
+    if(gTail != gHead)
+    {
+        osi_SyncObjSignal(&gSignal);
+    }
+    return 0;
+}
+
+size_t UartLog_write(const char *buf, size_t len)
+{
+    size_t queued = 0;
+
+    if(!gStarted && gUart)
+    {
+        // The task could not be started, write straight to the driver
+        UART2_write(gUart, buf, len, &queued);
+        return queued;
+    }
+
+    while(queued < len)
+    {
+        uint32_t chunk = len - queued;
+        int32_t pos;
+
+        if(chunk > UART_LOG_MAX_RECORD)
+        {
+            chunk = UART_LOG_MAX_RECORD;
+        }
+
+        pos = reserve(chunk);
+        if(pos < 0)
+        {
+            // Drop newest: keep what is already queued, lose the rest of this write
+            statAdd(&gStats.dropMessages, 1);
+            statAdd(&gStats.dropBytes, len - queued);
+            break;
+        }
+
+        memcpy(RING_WORD(pos) + 1, buf + queued, chunk);
+        __atomic_store_n(RING_WORD(pos), chunk | UART_LOG_COMMIT, __ATOMIC_RELEASE);
+        queued += chunk;
+    }
+
+    if(queued)
+    {
+        statAdd(&gStats.bytesQueued, queued);
+        // Before UartLog_init() the ring only fills up, the task sends it when it starts
+        if(gStarted)
+        {
+            osi_SyncObjSignal(&gSignal);
+        }
+    }
+    return queued;
+}
+
+void UartLog_flush(void)
+{
+    uint32_t waitMs;
+
+    if(!gStarted || HwiP_inISR())
+    {
+        return;
+    }
+
+    // Only the drain task writes to the UART, so the flush cannot interleave with it
+    for(waitMs = 0; (gTail != __atomic_load_n(&gHead, __ATOMIC_ACQUIRE)) &&
+                    (waitMs < UART_LOG_FLUSH_TIMEOUT_MS); waitMs++)
+    {
+        osi_SyncObjSignal(&gSignal);
+        osi_uSleep(1000);
+    }
+}
+
+void UartLog_getStats(UartLogStats_t *stats)
+{
+    if(stats)
+    {
+        *stats = gStats;
+    }
+}
@@ -39,6 +39,8 @@
 #include <string.h>
 #include <osi_kernel.h>
 #include "uart_term.h"
+#include "uart_log.h"
+#include "osi_lockstat.h"
 #include <ti/drivers/UART2.h>
 
 /* Driver configuration */
@@ -301,6 +303,7 @@ CompletionResult complete(char *input, uint8_t inputLen)
 //!
 //! This function
 //!        1. Configures the UART to be used.
+//!        2. Starts the task that drains the console output ring.
 //!
 //!        Note the UART is configured in the SySconfig
 //! \param  none
@@ -308,24 +311,33 @@ CompletionResult complete(char *input, uint8_t inputLen)
 //! \return none
 //
 //*****************************************************************************
+//Lets Report() queue output before InitTerm() opens the UART, it is sent once the UART is open
+void InitTermOutput(void)
+{
+    if(NULL == LockObj)
+    {
+        osi_LockObjCreate(&LockObj);
+        LockStat_setName(LockObj, "Report");
+    }
+}
+
 void InitTerm(void)
 {
     UART2_Params params;
-    osi_LockObjCreate(&LockObj);
+    InitTermOutput();
     UART2_Params_init(&params);
     params.baudRate = 115200;
     uartHandle = UART2_open(CONFIG_UART2_0, &params);
+    UartLog_init(uartHandle);
 }
 
 
+//Writes straight to the driver, bypassing the output ring
 void UART_writePolling(uint8_t *buffer, uint32_t len)
 {
-    uint8_t uartIter;
+    size_t bytesWritten;
 
-    for (uartIter=0; uartIter<len; uartIter++)
-    {
-        putch(buffer[uartIter]);
-    }
+    UART2_write(uartHandle, buffer, len, &bytesWritten);
 }
 
 //void UART_readPolling(UART_Handle handle, uint8_t *buffer, uint32_t len)
@@ -337,11 +349,10 @@ void UART_writePolling(uint8_t *buffer, uint32_t len)
 //}
 
 
+//Each write is queued as whole records, so no lock is needed to keep it in one piece
 void writeStrWithLen(const char *s, size_t len)
 {
-    osi_LockObjLock(&LockObj, OSI_WAIT_FOREVER);
-    UART_writePolling((uint8_t *)s, len);
-    osi_LockObjUnlock(&LockObj);
+    UartLog_write(s, len);
 }
 
 void writeStr(const char *s)
@@ -895,6 +906,9 @@ void pushCommand(char *cmd)
 //!
 //! \note If UART_NONPOLLING defined in than Message or UART write should be
 //!       called in task/thread context only.
+//! \note On CC35XX the string is queued to the output ring and the call
+//!       returns without waiting for the UART. If the ring is full the
+//!       message is dropped (see UartLog_getStats()).
 //
 //*****************************************************************************
 void Message(const char *str)
@@ -904,7 +918,7 @@ void Message(const char *str)
 #elif defined(CC33XX)
     UART_writePolling(uartHandle, (uint8_t *)str, strlen(str));
 #elif defined(CC35XX)
-    UART_writePolling((uint8_t *)str, strlen(str));
+    UartLog_write(str, strlen(str));
 #endif 
 }
 
@@ -990,6 +1004,5 @@ void getstr(uint32_t size, void* buffer)
 //*****************************************************************************
 void putch(char ch)
 {
-    size_t bytesWritten;
-    UART2_write(uartHandle, &ch, 1, &bytesWritten);
+    UartLog_write(&ch, 1);
 }
@@ -0,0 +1,539 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== bench.c ========
+ *  Recognizer cost benchmark, replaces the demo's mainThread when
+ *  SENSORY_BENCHMARK is defined.
+ *
+ *  For every bundled model it measures the SensoryAlloc size, the cost of
+ *  SensoryProcessInit, of SensoryProcessData per brick on silence, noise and
+ *  a synthetic voiced signal, and of switching to the other model. It also
+ *  times the allocators, the brick queues and publishing on the recognition
+ *  event bus. Results
+ *  are printed as JSON between BENCH_JSON_BEGIN / BENCH_JSON_END lines, see
+ *  tools/bench_compare.py.
+ */
+#ifdef SENSORY_BENCHMARK
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sensorytypes.h"
+#include "sensorylib.h"
+#include "common.h"
+
+#include "ti/drivers/dpl/TaskP.h"
+#include "osi_kernel.h"
+#include "osi_timestamp.h"
+#include "osi_zcq.h"
+#include "uart_term.h"
+#include "mem_place.h"
+#include "pc_prof.h"
+#include "trace_rec.h"
+#include "reco_bus.h"
+
+#include <wakeword-pc60-6.1.0-op08-prod-search-genie.h>
+#include <command-pc62-6.1.0-op10-prod-search-new-genie.h>
+
+#define BENCH_TARGET            "cc35xx"
+#define BENCH_PRINT             UART_PRINT
+
+#ifndef BENCH_BRICKS
+#define BENCH_BRICKS            400         // 6 s of audio per input
+#endif
+#ifndef BENCH_WARMUP_BRICKS
+#define BENCH_WARMUP_BRICKS     20
+#endif
+#ifndef BENCH_INIT_REPEAT
+#define BENCH_INIT_REPEAT       5
+#endif
+
+#ifndef BENCH_ALLOC_OPS
+#define BENCH_ALLOC_OPS         2000        // allocator benchmark: free + alloc pairs
+#endif
+#define BENCH_ALLOC_LIVE        48          // blocks held at once
+
+#ifndef BENCH_QUEUE_BRICKS
+#define BENCH_QUEUE_BRICKS      4000        // queue benchmark: bricks passed through
+#endif
+#define BENCH_QUEUE_DEPTH       8           // bricks queued before the reader drains them
+#ifndef BENCH_BUS_EVENTS
+#define BENCH_BUS_EVENTS        2000        // event bus benchmark: events published
+#endif
+#define BENCH_BUS_SUBSCRIBERS   4
+#define BENCH_BUS_PRIORITY      1
+#define BENCH_BUS_STACK         1536        // as the console subscriber, a lapped subscriber prints a warning
+
+#define BENCH_2PI               6.2831853f
+
+typedef enum { BENCH_SILENCE, BENCH_NOISE, BENCH_SPEECH, BENCH_NUM_INPUTS } BenchInput_e;
+
+typedef struct {
+    const char *name;
+    const void *net;
+    const void *gram;
+} BenchModel_t;
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+} BenchStat_t;
+
+static const BenchModel_t gModels[] =
+{
+    { "wakeword-pc60-6.1.0-op08-prod-search-genie",    dnn_wakeword_netLabel,   gs_wakeword_grammarLabel },
+    { "command-pc62-6.1.0-op10-prod-search-new-genie", dnn_en_command_netLabel, gs_en_command_grammarLabel },
+};
+#define BENCH_NUM_MODELS    (sizeof(gModels) / sizeof(gModels[0]))
+
+static const char *gInputNames[BENCH_NUM_INPUTS] = { "silence", "noise", "speech" };
+
+static t2siStruct gBenchStruct;
+static SAMPLE     gBrick[FRAME_LEN];
+static uint32_t   gSeed;
+static uint32_t   gSample;
+static float      gPhase;
+
+/* from wakeword.c, keeps the benchmark recognizer configured like the demo */
+extern BOOL setupAppStruct(t2siStruct *t);
+
+static inline uint32_t cycles(void)
+{
+    return OSI_TS_CYCCNT;
+}
+
+static void statAdd(BenchStat_t *s, uint32_t value)
+{
+    if ((s->count == 0) || (value < s->min))
+    {
+        s->min = value;
+    }
+    if (value > s->max)
+    {
+        s->max = value;
+    }
+    s->sum += value;
+    s->count++;
+}
+
+static uint32_t statMean(const BenchStat_t *s)
+{
+    return s->count ? (uint32_t)(s->sum / s->count) : 0;
+}
+
+/*
+ * Deterministic inputs. "speech" is a voiced signal (pitch glide with
+ * harmonics) gated by a 4 Hz syllable envelope, which keeps the front end
+ * and the search busy the way talking does.
+ */
+static void benchFill(BenchInput_e input)
+{
+    uint32_t i;
+
+    for (i = 0; i < FRAME_LEN; i++, gSample++)
+    {
+        if (input == BENCH_SILENCE)
+        {
+            gBrick[i] = 0;
+        }
+        else if (input == BENCH_NOISE)
+        {
+            gSeed = gSeed * 1664525u + 1013904225u;
+            gBrick[i] = (SAMPLE)((int32_t)(gSeed >> 16) - 32768) / 16;
+        }
+        else
+        {
+            float t = (float)gSample / 16000.0f;
+            float f0 = 120.0f + 30.0f * sinf(BENCH_2PI * 0.5f * t);
+            float env = sinf(BENCH_2PI * 4.0f * t);
+            float v = 0.0f;
+            uint32_t h;
+
+            gPhase += BENCH_2PI * f0 / 16000.0f;
+            if (gPhase > BENCH_2PI)
+            {
+                gPhase -= BENCH_2PI;
+            }
+            for (h = 1; h <= 8; h++)
+            {
+                v += sinf(gPhase * h) / h;
+            }
+            gBrick[i] = (env > 0.0f) ? (SAMPLE)(v * env * 4000.0f) : 0;
+        }
+    }
+}
+
+static errors_t benchInit(t2siStruct *t, const BenchModel_t *m)
+{
+    t->net = (intptr_t) m->net;
+    t->gram = (intptr_t) m->gram;
+    return SensoryProcessInit(t);
+}
+
+static void benchModel(uint32_t idx, BOOL last)
+{
+    const BenchModel_t *m = &gModels[idx];
+    const BenchModel_t *other = &gModels[(idx + 1) % BENCH_NUM_MODELS];
+    t2siStruct *t = &gBenchStruct;
+    BenchStat_t initStat = { 0 }, switchStat = { 0 };
+    BenchStat_t brickStat[BENCH_NUM_INPUTS];
+    unsigned int sppSize = 0, otherSize = 0;
+    uint32_t i, n, start;
+    RecoResult *r;
+
+    memset(brickStat, 0, sizeof(brickStat));
+
+    /* The demo switches models on the same SPP, size it for both */
+    setupAppStruct(t);
+    t->net = (intptr_t) other->net;
+    t->gram = (intptr_t) other->gram;
+    SensoryAlloc(t, &otherSize);
+    t->net = (intptr_t) m->net;
+    t->gram = (intptr_t) m->gram;
+    if (SensoryAlloc(t, &sppSize) != ERR_OK)
+    {
+        BENCH_PRINT("\r  {\"model\": \"%s\", \"error\": \"alloc\"}%s\r\n", m->name, last ? "" : ",");
+        return;
+    }
+    t->spp = malloc((sppSize > otherSize) ? sppSize : otherSize);
+    if (t->spp == NULL)
+    {
+        BENCH_PRINT("\r  {\"model\": \"%s\", \"error\": \"no memory\"}%s\r\n", m->name, last ? "" : ",");
+        return;
+    }
+
+    for (i = 0; i < BENCH_INIT_REPEAT; i++)
+    {
+        start = cycles();
+        benchInit(t, m);
+        statAdd(&initStat, cycles() - start);
+
+        start = cycles();
+        benchInit(t, other);
+        statAdd(&switchStat, cycles() - start);
+        benchInit(t, m);
+    }
+
+    for (i = 0; i < BENCH_NUM_INPUTS; i++)
+    {
+        benchInit(t, m);
+        gSeed = 1;
+        gSample = 0;
+        gPhase = 0.0f;
+        for (n = 0; n < BENCH_WARMUP_BRICKS + BENCH_BRICKS; n++)
+        {
+            benchFill((BenchInput_e)i);
+            start = cycles();
+            r = SensoryProcessData(t, gBrick);
+            if (n >= BENCH_WARMUP_BRICKS)
+            {
+                statAdd(&brickStat[i], cycles() - start);
+            }
+            if (r->error == ERR_LICENSE)
+            {
+                BENCH_PRINT("\rSensory Lib license error!\r\n");
+                break;
+            }
+            if (r->error != ERR_NOT_FINISHED)
+            {
+                benchInit(t, m);
+            }
+        }
+    }
+
+    BENCH_PRINT("\r  {\"model\": \"%s\", \"alloc_bytes\": %d,\r\n", m->name, sppSize);
+    BENCH_PRINT("\r   \"init_cycles\": %d, \"switch_cycles\": %d, \"switch_to\": \"%s\",\r\n",
+                statMean(&initStat), statMean(&switchStat), other->name);
+    for (i = 0; i < BENCH_NUM_INPUTS; i++)
+    {
+        BENCH_PRINT("\r   \"%s\": {\"brick_mean_cycles\": %d, \"brick_max_cycles\": %d,\r\n",
+                    gInputNames[i], statMean(&brickStat[i]), brickStat[i].max);
+        BENCH_PRINT("\r    \"brick_min_cycles\": %d, \"load_pct\": %d}%s\r\n", brickStat[i].min,
+                    (uint32_t)((uint64_t)statMean(&brickStat[i]) * 100 * 1000 / BRICK_SIZE_MS / configCPU_CLOCK_HZ),
+                    (i + 1 < BENCH_NUM_INPUTS) ? "," : "");
+    }
+    BENCH_PRINT("\r  }%s\r\n", last ? "" : ",");
+
+    free(t->spp);
+    t->spp = NULL;
+}
+
+/* The allocation path os_malloc() used before the block pools */
+static void *heapAlloc(size_t size)
+{
+    uintptr_t key = TaskP_disableScheduler();
+    void *ptr = malloc(size);
+    TaskP_restoreScheduler(key);
+    return ptr;
+}
+
+static void heapFree(void *ptr)
+{
+    uintptr_t key = TaskP_disableScheduler();
+    free(ptr);
+    TaskP_restoreScheduler(key);
+}
+
+/*
+ * Allocation latency under churn: BENCH_ALLOC_LIVE blocks are kept alive and
+ * a random one is replaced on every step. Sizes are mostly small, like the
+ * network stack's, with some above the largest pool class.
+ */
+static void benchAlloc(const char *name, void *(*allocFn)(size_t), void (*freeFn)(void *), BOOL last)
+{
+    void *live[BENCH_ALLOC_LIVE];
+    BenchStat_t allocStat, freeStat;
+    uint32_t seed = 1;
+    uint32_t n, k, size, start;
+
+    memset(live, 0, sizeof(live));
+    memset(&allocStat, 0, sizeof(allocStat));
+    memset(&freeStat, 0, sizeof(freeStat));
+
+    for (n = 0; n < BENCH_ALLOC_LIVE + BENCH_ALLOC_OPS; n++)
+    {
+        seed = seed * 1664525u + 1013904225u;
+        k = (seed >> 8) % BENCH_ALLOC_LIVE;
+        if ((seed >> 28) < 12)
+        {
+            size = 8 + (seed >> 16) % 121;          // 8..128
+        }
+        else if ((seed >> 28) < 15)
+        {
+            size = 129 + (seed >> 16) % 384;        // 129..512
+        }
+        else
+        {
+            size = 513 + (seed >> 16) % 1536;       // 513..2048
+        }
+
+        if (live[k])
+        {
+            start = cycles();
+            freeFn(live[k]);
+            statAdd(&freeStat, cycles() - start);
+        }
+        start = cycles();
+        live[k] = allocFn(size);
+        statAdd(&allocStat, cycles() - start);
+    }
+    for (k = 0; k < BENCH_ALLOC_LIVE; k++)
+    {
+        freeFn(live[k]);
+    }
+
+    BENCH_PRINT("\r  \"%s\": {\"alloc_mean_cycles\": %d, \"alloc_max_cycles\": %d,\r\n", name, statMean(&allocStat), allocStat.max);
+    BENCH_PRINT("\r   \"free_mean_cycles\": %d, \"free_max_cycles\": %d}%s\r\n", statMean(&freeStat), freeStat.max, last ? "" : ",");
+}
+
+/*
+ * Brick transport cost: BENCH_QUEUE_DEPTH bricks are queued, then drained,
+ * like a capture ISR running ahead of the recognizer task. The copying queue
+ * moves the 240 samples in and out of the MessageQueueP storage, the
+ * zero-copy queue takes a pool block, passes its descriptor and releases it.
+ */
+static void benchQueue(void)
+{
+    static SAMPLE rx[FRAME_LEN];
+    OsiMsgQ_t msgQ;
+    OsiZcq_t zcq;
+    OsiZcqBuf_t buf[BENCH_QUEUE_DEPTH];
+    BenchStat_t copyStat, zcqStat;
+    volatile SAMPLE sink = 0;
+    uint32_t n, k, start;
+
+    memset(&copyStat, 0, sizeof(copyStat));
+    memset(&zcqStat, 0, sizeof(zcqStat));
+    if ((OSI_OK != osi_MsgQCreate(&msgQ, "bench", sizeof(gBrick), BENCH_QUEUE_DEPTH)) ||
+        (OSI_OK != osi_ZcqCreate(&zcq, BENCH_QUEUE_DEPTH)))
+    {
+        BENCH_PRINT("\r \"queue\": {}}\r\n");
+        return;
+    }
+
+    for (n = 0; n < BENCH_QUEUE_BRICKS; n += BENCH_QUEUE_DEPTH)
+    {
+        start = cycles();
+        for (k = 0; k < BENCH_QUEUE_DEPTH; k++)
+        {
+            osi_MsgQWrite(&msgQ, gBrick, OSI_NO_WAIT, 0);
+        }
+        for (k = 0; k < BENCH_QUEUE_DEPTH; k++)
+        {
+            osi_MsgQRead(&msgQ, rx, OSI_NO_WAIT);
+            sink = rx[0];
+        }
+        statAdd(&copyStat, (cycles() - start) / BENCH_QUEUE_DEPTH);
+
+        start = cycles();
+        for (k = 0; k < BENCH_QUEUE_DEPTH; k++)
+        {
+            osi_ZcqBufAlloc(&buf[k], sizeof(gBrick));
+            osi_ZcqPost(&zcq, &buf[k]);
+        }
+        for (k = 0; k < BENCH_QUEUE_DEPTH; k++)
+        {
+            osi_ZcqReceive(&zcq, &buf[k], OSI_NO_WAIT);
+            sink = ((SAMPLE *)buf[k].data)[0];
+            osi_ZcqBufRelease(&buf[k]);
+        }
+        statAdd(&zcqStat, (cycles() - start) / BENCH_QUEUE_DEPTH);
+    }
+    (void)sink;
+
+    osi_MsgQDelete(&msgQ);
+    osi_ZcqDelete(&zcq);
+
+    BENCH_PRINT("\r \"queue\": {\r\n");
+    BENCH_PRINT("\r  \"msgq_copy\": {\"brick_mean_cycles\": %d, \"brick_max_cycles\": %d},\r\n",
+                statMean(&copyStat), copyStat.max);
+    BENCH_PRINT("\r  \"zcq\": {\"brick_mean_cycles\": %d, \"brick_max_cycles\": %d}\r\n",
+                statMean(&zcqStat), zcqStat.max);
+    BENCH_PRINT("\r },\r\n");
+}
+
+static volatile uint32_t gBusHandled;
+
+static void benchBusHandler(const RecoEvent_t *event, void *arg)
+{
+    __atomic_fetch_add(&gBusHandled, 1, __ATOMIC_RELAXED);
+}
+
+/*
+ * Publishing costs the same with or without subscribers, the dispatcher
+ * and the subscriber tasks run afterwards at lower priorities. The
+ * benchmark sleeps every half ring so that they keep up.
+ */
+static void benchBusPublish(uint32_t subscribers, BOOL last)
+{
+    RecoEvent_t event;
+    BenchStat_t stat;
+    uint32_t n, start;
+
+    memset(&event, 0, sizeof(event));
+    memset(&stat, 0, sizeof(stat));
+    event.type = RECO_EV_COMMAND;
+    gBusHandled = 0;
+
+    for (n = 0; n < BENCH_BUS_EVENTS; n++)
+    {
+        start = cycles();
+        RecoBus_publish(&event);
+        statAdd(&stat, cycles() - start);
+        if ((n % (RECO_BUS_EVENTS / 2)) == (RECO_BUS_EVENTS / 2 - 1))
+        {
+            osi_uSleep(1000);
+        }
+    }
+    osi_uSleep(1000);
+
+    BENCH_PRINT("\r  \"subscribers_%d\": {\"publish_mean_cycles\": %d, \"publish_max_cycles\": %d, \"missed\": %d}%s\r\n",
+                subscribers, statMean(&stat), stat.max,
+                subscribers * BENCH_BUS_EVENTS - gBusHandled, last ? "" : ",");
+}
+
+static void benchBus(void)
+{
+    static const char *names[BENCH_BUS_SUBSCRIBERS] = { "Bench0", "Bench1", "Bench2", "Bench3" };
+    uint32_t i, subscribed = 0;
+
+    if (RecoBus_init() != 0)
+    {
+        BENCH_PRINT("\r \"reco_bus\": {}}\r\n");
+        return;
+    }
+
+    BENCH_PRINT("\r \"reco_bus\": {\r\n");
+    benchBusPublish(0, FALSE);
+    for (i = 0; i < BENCH_BUS_SUBSCRIBERS; i++)
+    {
+        if (RecoBus_subscribe(names[i], BENCH_BUS_PRIORITY, BENCH_BUS_STACK, benchBusHandler, NULL) == 0)
+        {
+            subscribed++;
+        }
+    }
+    // Reported under the number of subscribers actually running
+    benchBusPublish(subscribed, TRUE);
+    BENCH_PRINT("\r }}\r\n");
+}
+
+void *mainThread(void *args)
+{
+    infoStruct_T isp;
+    uint32_t i;
+
+    InitTerm();
+
+    OsiTs_init();
+    PcProf_init();
+    TraceRec_init();
+
+    SensoryInfo(&isp);
+
+    BENCH_PRINT("\rBENCH_JSON_BEGIN\r\n");
+    BENCH_PRINT("\r{\"target\": \"%s\", \"cpu_hz\": %d, \"bricks\": %d,\r\n", BENCH_TARGET, configCPU_CLOCK_HZ, BENCH_BRICKS);
+    BENCH_PRINT("\r \"thf_version\": \"%d.%d.%d\",\r\n",
+                (isp.version>>20)&0x00000fff, (isp.version>>12)&0x000000ff, isp.version&0x00000fff);
+    BENCH_PRINT("\r \"hot_text_bytes\": %d, \"hot_data_bytes\": %d,\r\n", MemPlace_textBytes(), MemPlace_dataBytes());
+    BENCH_PRINT("\r \"models\": [\r\n");
+    for (i = 0; i < BENCH_NUM_MODELS; i++)
+    {
+        benchModel(i, (i + 1) == BENCH_NUM_MODELS);
+    }
+    // Profile the recognizer only
+    PcProf_stop();
+    BENCH_PRINT("\r ],\r\n");
+    BENCH_PRINT("\r \"allocator\": {\r\n");
+    benchAlloc("os_malloc", os_malloc, os_free, FALSE);
+    benchAlloc("heap", heapAlloc, heapFree, TRUE);
+    BENCH_PRINT("\r },\r\n");
+#ifdef TRACE_REC
+    // Compare brick costs with a build without TRACE_REC for the kernel hook overhead
+    BENCH_PRINT("\r \"trace\": {\"recorder\": {\"event_cycles\": %d}},\r\n", gTraceRec.eventCycles);
+#endif
+    benchQueue();
+    benchBus();
+    BENCH_PRINT("\rBENCH_JSON_END\r\n");
+    PcProf_dump();
+
+    return NULL;
+}
+
+#endif // SENSORY_BENCHMARK
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BOOT_PROF_H__
+#define __BOOT_PROF_H__
+
+#include <stdint.h>
+
+/*
+ * Boot phase timestamps
+ *
+ * BootProf_init() runs first thing in main() and starts the DWT cycle
+ * counter, so the stage times are close to the time since reset (the C
+ * startup before main() is not counted). Each BootProf_mark() stores the
+ * counter and a stage name, from any task, and BootProf_report() prints
+ * the new ones once the console is up, as time since main() and since the
+ * previous stage:
+ *
+ *     [boot] i2s            2104 us  +1890 us
+ *
+ * The DWT counter stops while the core sleeps, so each mark also stores the
+ * system tick count; a stage during which the core slept (waiting for the
+ * recognizer, for instance) is timed by the ticks, to a tick.
+ *
+ * The marks only take a few cycles and are always built in. Stages beyond
+ * BOOT_PROF_STAGES are not recorded.
+ */
+#ifndef BOOT_PROF_STAGES
+#define BOOT_PROF_STAGES            16
+#endif
+
+/*!
+ *  @brief  Start the cycle counter and mark the start of main()
+ */
+void BootProf_init(void);
+
+/*!
+ *  @brief  Mark the end of a boot stage, the name must stay valid (a string literal)
+ */
+void BootProf_mark(const char *name);
+
+/*!
+ *  @brief  Print the stages marked since the previous report
+ */
+void BootProf_report(void);
+
+#endif // __BOOT_PROF_H__
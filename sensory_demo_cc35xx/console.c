@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== console.c ========
+ *  Console commands, see console.h.
+ */
+#ifdef UART_CONSOLE
+
+#include <stdint.h>
+#include <string.h>
+
+#include <osi_kernel.h>
+
+#include "uart_term.h"
+#include "osi_heapmon.h"
+#include "osi_lockstat.h"
+#include "osi_taskmon.h"
+#include "trace_rec.h"
+#include "reco_bus.h"
+#include "console.h"
+
+typedef struct {
+    const char *name;
+    const char *help;
+    void (*run)(void);
+} ConsoleCmd_t;
+
+static void cmdHelp(void);
+
+static const ConsoleCmd_t gCmds[] = {
+#ifdef TASK_MONITOR
+    { "tasks",  "per task CPU load and stack headroom",  TaskMon_dump },
+#endif
+#ifdef HEAP_MONITOR
+    { "heap",   "heap usage and fragmentation",          HeapMon_dump },
+#endif
+#ifdef LOCK_STATS
+    { "locks",  "lock contention",                       LockStat_dump },
+#endif
+#ifdef TRACE_REC
+    { "trace",  "execution trace, for trace2chrome.py",  TraceRec_dump },
+#endif
+    { "events", "recognition event subscribers",         RecoBus_dump },
+    { "help",   "this list",                             cmdHelp },
+};
+
+#define CONSOLE_NUM_CMDS    (sizeof(gCmds) / sizeof(gCmds[0]))
+
+static void cmdHelp(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < CONSOLE_NUM_CMDS; i++) {
+        UART_PRINT("\r\n  %-8s %s", gCmds[i].name, gCmds[i].help);
+    }
+    UART_PRINT("\r\n");
+}
+
+static void *Console_task(void *args)
+{
+    char line[CONSOLE_LINE_LEN + 1];
+    uint32_t i;
+    int len;
+
+    while (1) {
+        len = GetCmd(line, CONSOLE_LINE_LEN, "> ");
+        if (len < 0) {
+            UART_PRINT("\r\ncommand too long\r\n");
+            continue;
+        }
+        line[len] = '\0';
+        // Ignore trailing blanks
+        while ((len > 0) && (line[len - 1] == ' ')) {
+            line[--len] = '\0';
+        }
+        for (i = 0; i < CONSOLE_NUM_CMDS; i++) {
+            if (strcmp(line, gCmds[i].name) == 0) {
+                gCmds[i].run();
+                break;
+            }
+        }
+        if ((i == CONSOLE_NUM_CMDS) && (len > 0)) {
+            UART_PRINT("\r\nunknown command \"%s\", try help\r\n", line);
+        }
+    }
+
+    return NULL;
+}
+
+void Console_init(void)
+{
+    static OsiThread_t thread;
+
+    osi_ThreadCreate(&thread, "Console", CONSOLE_STACK_SIZE, CONSOLE_PRIORITY, Console_task, NULL);
+}
+
+#endif // UART_CONSOLE
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+/*
+ * Console commands (build with UART_CONSOLE defined)
+ *
+ * A low priority task reads command lines from the terminal (GetCmd(), with
+ * history and line editing) and prints the state of the monitors that are
+ * built in:
+ *      tasks   per task CPU load and stack headroom (TASK_MONITOR)
+ *      heap    heap usage and fragmentation (HEAP_MONITOR)
+ *      locks   lock contention (LOCK_STATS)
+ *      trace   the execution trace recorded so far (TRACE_REC)
+ *      events  the recognition event subscribers, handled and missed events
+ *      help    the commands available
+ */
+#ifndef CONSOLE_PRIORITY
+#define CONSOLE_PRIORITY            1
+#endif
+#ifndef CONSOLE_STACK_SIZE
+#define CONSOLE_STACK_SIZE          1536
+#endif
+#define CONSOLE_LINE_LEN            48
+
+#ifdef UART_CONSOLE
+
+/*!
+ *  @brief  Start the console task, call after InitTerm()
+ */
+void Console_init(void);
+
+#else
+
+#define Console_init()
+
+#endif // UART_CONSOLE
+
+#endif // __CONSOLE_H__
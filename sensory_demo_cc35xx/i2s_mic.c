@@ -35,6 +35,7 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 /* Driver Header files */
 #include <ti/drivers/GPIO.h>
@@ -50,10 +51,14 @@
 #include <ti/display/DisplayUart2.h>
 #include <ti/drivers/I2S.h>
 #include <ti/drivers/i2s/I2SWFF3.h>
+#include <ti/drivers/dpl/HwiP.h>
 
 #include <i2s_mic.h>
 #include <THF-Micro_v8.3.2_SDK_Arm_CM33_hf/sensory/sensorylib.h>
 #include "common.h"
+#include "osi_timestamp.h"
+#include "osi_lockstat.h"
+#include "trace_rec.h"
 
 /* Total number of buffers to loop through */
 #define NUMBUFS 3
@@ -66,8 +71,18 @@
 
 /* I2S buffer size. Each buffer size is sized up to 15ms of voice data */
 #define BUFSIZE  ((BRICK_SIZE_MS * AUDIO_BUFFER_OFFSET * SAMPLE_RATE * sizeof(uint32_t)) / 1000)
+/* Left channel samples in a buffer */
+#define BRICK_SAMPLES  (BUFSIZE / sizeof(uint32_t) / AUDIO_BUFFER_OFFSET)
+
+#define MIC_DC_OFFSET           1650
+#define MIC_DC_ATTENUATION      14
+
 volatile uint32_t adc_overflow = 0;
 
+// Enables ease of calibration for the microphone
+uint32_t   microphoneAtten = MIC_DC_ATTENUATION;
+int32_t    microphoneOffset = MIC_DC_OFFSET;
+
 /*
  *  =============================== I2S ===============================
  */
@@ -102,6 +117,31 @@ static I2S_Transaction *i2sTransactionList[NUMBUFS] = {&i2sTransaction1,
                                                        &i2sTransaction2,
                                                        &i2sTransaction3};
 
+#if I2S_MIC_HELD_BRICKS
+/* Bricks captured while the recognizer starts, written by the read callback and read by i2s_mic_heldBrick() */
+static int16_t           heldBrick[I2S_MIC_HELD_BRICKS][BRICK_SAMPLES];
+static uint64_t          heldTime[I2S_MIC_HELD_BRICKS];
+static volatile uint32_t heldHead;
+static volatile uint32_t heldTail;
+static volatile uint32_t heldDropped;
+static volatile uint8_t  holding;
+
+static void holdBrick(const int32_t *buf, uint16_t numOfSamples, uint64_t timestamp)
+{
+    uint32_t head = heldHead;
+
+    if (head - heldTail == I2S_MIC_HELD_BRICKS)
+    {
+        // Keep the oldest, the start of what was said
+        heldDropped++;
+        return;
+    }
+    i2s_mic_convert(buf, numOfSamples, heldBrick[head % I2S_MIC_HELD_BRICKS]);
+    heldTime[head % I2S_MIC_HELD_BRICKS] = timestamp;
+    __atomic_store_n(&heldHead, head + 1, __ATOMIC_RELEASE);
+}
+#endif
+
 static void errCallbackFxn(I2S_Handle handle, int_fast16_t status, I2S_Transaction *transactionPtr)
 {
     /* The content of this callback is executed if an I2S error occurs */
@@ -118,6 +158,7 @@ static void readCallbackFxn(I2S_Handle handle, int_fast16_t status, I2S_Transact
     /* We must consider the previous transaction (the current one is not over) */
     I2S_Transaction *transactionFinished = (I2S_Transaction *)List_prev(&transactionPtr->queueElement);
 
+    TRACE_REC_ISR_ENTER();
     if (transactionFinished != NULL)
     {
         // No action needed as the transactions are in a ring list except make a copy of the last audio buffer pointer
@@ -126,10 +167,21 @@ static void readCallbackFxn(I2S_Handle handle, int_fast16_t status, I2S_Transact
         latestAudioBufPtr.audioBufPtr = transactionFinished->bufPtr;
         /* bufSize is expressed in bytes but samples to consider are 16 bits long */
         latestAudioBufPtr.numOfSamples = transactionFinished->bufSize / sizeof(uint32_t);
-
-        /* Start the treatment of the data */
-        sem_post(&semDataReadyForTreatment);
+        latestAudioBufPtr.timestamp = OsiTs_cycles();
+
+#if I2S_MIC_HELD_BRICKS
+        if (holding)
+        {
+            holdBrick(latestAudioBufPtr.audioBufPtr, latestAudioBufPtr.numOfSamples, latestAudioBufPtr.timestamp);
+        }
+        else
+#endif
+        {
+            /* Start the treatment of the data */
+            sem_post(&semDataReadyForTreatment);
+        }
     }
+    TRACE_REC_ISR_EXIT();
 }
 
 /* Initialize the peripherals for Collecting audio input via SPI MIC or BOOSTXL MIC */
@@ -141,6 +193,10 @@ int32_t i2s_mic_init(void)
     {
         return retc;
     }
+    LockStat_setName(&semDataReadyForTreatment, "brickReady");
+#if I2S_MIC_HELD_BRICKS
+    holding = 1;
+#endif
 
     /*
      *  Open the I2S driver
@@ -252,3 +308,64 @@ int32_t reinit_i2s_mic(void)
 
     return retc;
 }
+
+uint32_t i2s_mic_convert(const int32_t *buf, uint16_t numOfSamples, int16_t *out)
+{
+    uint32_t i;
+    uint32_t n = 0;
+
+    /* We only modify Left channel's samples () */
+    for (i = 0; i < numOfSamples; i = i + AUDIO_BUFFER_OFFSET)
+    {
+        /*
+         * Shift the data down to 16-bits from 32-bits and then
+         * remove the DC offset of the I2S microphone
+         */
+        out[n++] = (int16_t) ((buf[i] >> microphoneAtten) + microphoneOffset);
+    }
+    return n;
+}
+
+int i2s_mic_heldBrick(int16_t *out, uint64_t *timestamp)
+{
+#if I2S_MIC_HELD_BRICKS
+    uint32_t tail = heldTail;
+    uintptr_t key;
+
+    if (!holding)
+    {
+        return 0;
+    }
+    if (tail == __atomic_load_n(&heldHead, __ATOMIC_ACQUIRE))
+    {
+        // Caught up: from the next brick on, the callback signals the semaphore again
+        key = HwiP_disable();
+        if (tail == heldHead)
+        {
+            holding = 0;
+        }
+        HwiP_restore(key);
+        if (!holding)
+        {
+            return 0;
+        }
+    }
+    memcpy(out, heldBrick[tail % I2S_MIC_HELD_BRICKS], sizeof(heldBrick[0]));
+    *timestamp = heldTime[tail % I2S_MIC_HELD_BRICKS];
+    __atomic_store_n(&heldTail, tail + 1, __ATOMIC_RELEASE);
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void i2s_mic_heldStats(uint32_t *held, uint32_t *dropped)
+{
+#if I2S_MIC_HELD_BRICKS
+    *held = heldHead;
+    *dropped = heldDropped;
+#else
+    *held = 0;
+    *dropped = 0;
+#endif
+}
@@ -47,17 +47,38 @@
 
 #define SAMPLE_RATE   16000 /* Supported values: 8kHz, 16kHz, 32kHz and 44.1kHz */
 
+/*
+ * Bricks held at boot: from i2s_mic_init() until the recognizer has caught
+ * up, the read callback converts every brick into a ring instead of
+ * signalling semDataReadyForTreatment, so speech during the recognizer
+ * init is not lost. i2s_mic_heldBrick() returns them oldest first and
+ * switches back to the semaphore once the ring is empty. When the ring is
+ * full the newer bricks are dropped. 0 disables holding.
+ */
+#ifndef I2S_MIC_HELD_BRICKS
+#define I2S_MIC_HELD_BRICKS     32  /* 480 ms, 480 bytes each */
+#endif
+
 typedef struct {
     int32_t  * audioBufPtr;
     uint16_t   numOfSamples;
+    uint64_t   timestamp;       /* OsiTs_cycles() when the buffer was complete */
 } i2sAudioPtr_t;
 
 extern sem_t            semDataReadyForTreatment;
 extern i2sAudioPtr_t    latestAudioBufPtr;
+extern uint32_t         microphoneAtten;
+extern int32_t          microphoneOffset;
 
 /* Function definitions */
 int32_t i2s_mic_init(void);
 int32_t reinit_i2s_mic(void);
 void deinit_i2s_mic(void);
+/* Convert the left channel of a capture buffer to 16-bit samples, returns the sample count */
+uint32_t i2s_mic_convert(const int32_t *buf, uint16_t numOfSamples, int16_t *out);
+/* Next brick captured during init, 0 once all were returned */
+int i2s_mic_heldBrick(int16_t *out, uint64_t *timestamp);
+/* Bricks held since i2s_mic_init() and bricks dropped because the ring was full */
+void i2s_mic_heldStats(uint32_t *held, uint32_t *dropped);
 
 #endif // I2S_MIC_H_INCLUDED
@@ -47,10 +47,15 @@
 
 #include <ti/drivers/Board.h>
 
+#include "mem_place.h"
+#include "boot_prof.h"
+
 extern void *mainThread(void *arg0);
 
-/* Stack size in bytes */
+/* Stack size in bytes, a TASK_MONITOR build reports how much of it is used */
+#ifndef THREADSTACKSIZE
 #define THREADSTACKSIZE 6048
+#endif
 
 /*
  *  ======== main ========
@@ -67,7 +72,11 @@ int main(void)
     __iar_Initlocks();
 #endif
 
+    BootProf_init();
     Board_init();
+    BootProf_mark("board");
+    MemPlace_init();
+    BootProf_mark("mem place");
 
     /* Initialize the attributes structure with default values */
     pthread_attr_init(&attrs);
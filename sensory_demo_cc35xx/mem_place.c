@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== mem_place.c ========
+ *  Instruction cache setup and copy of the hot sections, see mem_place.h.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "mem_place.h"
+
+#define HWREG(x)                (*((volatile unsigned long *)(x)))
+
+#define ICACHE_BASE             0x41902000  // M33 instance, the M4 has a different address
+#define ICACHE_O_CTRL           0x84
+#define ICACHE_O_CFG            0x04
+#define ICACHE_CTRL_EN          0x00000001
+#define ICACHE_CFG_CRAM         0xC0000000  // cache with CRAM kept as RAM
+#define ICACHE_CFG_64K          0x80000000  // 64 KB cache instead of CRAM
+
+/* linker_GNU.lds */
+extern uint8_t __hot_text_load__[], __hot_text_start__[], __hot_text_end__[];
+extern uint8_t __hot_data_load__[], __hot_data_start__[], __hot_data_end__[];
+
+void MemPlace_init(void)
+{
+    // OSPREY_MX-38
+    HWREG(ICACHE_BASE + ICACHE_O_CTRL) |= ICACHE_CTRL_EN;
+    HWREG(ICACHE_BASE + ICACHE_O_CFG) |= ICACHE_CFG_CRAM;
+
+    memcpy(__hot_text_start__, __hot_text_load__, MemPlace_textBytes());
+    memcpy(__hot_data_start__, __hot_data_load__, MemPlace_dataBytes());
+    // The TCM is reached on the instruction bus, make the copy visible to it
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+}
+
+uint32_t MemPlace_textBytes(void)
+{
+    return (uint32_t) (__hot_text_end__ - __hot_text_start__);
+}
+
+uint32_t MemPlace_dataBytes(void)
+{
+    return (uint32_t) (__hot_data_end__ - __hot_data_start__);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PLACE_H__
+#define __MEM_PLACE_H__
+
+#include <stdint.h>
+
+/*
+ * Placement of hot recognizer code and model data in fast memory
+ *
+ * linker_GNU.lds puts the input sections listed in hot_text.lds.inc in
+ * .hot_text, which runs from the zero wait state code TCM, and those in
+ * hot_data.lds.inc (e.g. the wake word net, .rodata.model.<symbol>) in
+ * .hot_data in SRAM instead of the XIP flash. Both are loaded in flash and
+ * copied by MemPlace_init(). The lists are generated by
+ * tools/pcprof_report.py from a PC_PROFILE run and are empty by default.
+ *
+ * Only code that first runs after MemPlace_init() may be listed, i.e. the
+ * recognizer library and the demo code, not drivers used by Board_init().
+ */
+
+/*!
+ *  @brief  Configure the instruction cache and copy the hot sections to RAM
+ *
+ *  Call first thing in main(), after Board_init().
+ */
+void MemPlace_init(void);
+
+/*!
+ *  @brief  Bytes of code placed in the TCM
+ */
+uint32_t MemPlace_textBytes(void);
+
+/*!
+ *  @brief  Bytes of data placed in SRAM
+ */
+uint32_t MemPlace_dataBytes(void);
+
+#endif // __MEM_PLACE_H__
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== model_store.c ========
+ *  Command models loaded at run time from an external flash region, with a
+ *  small LRU cache in RAM. See model_store.h.
+ */
+#ifdef MODEL_STORE
+
+#include <stdint.h>
+#include <string.h>
+
+#include "osi_kernel.h"
+#include "osi_timestamp.h"
+#include "uart_term.h"
+#include "model_store.h"
+
+#if !defined(MODEL_STORE_PHYS_ADDR) || !defined(MODEL_STORE_LOGICAL_ADDR) || !defined(MODEL_STORE_SIZE)
+#error "MODEL_STORE needs MODEL_STORE_PHYS_ADDR, MODEL_STORE_LOGICAL_ADDR and MODEL_STORE_SIZE"
+#endif
+
+#define ALIGN4(x)       (((x) + 3u) & ~3u)
+
+typedef struct {
+    int32_t     entry;          // directory index, -1 = free
+    uint32_t    lastUse;
+    void       *mem;
+} ModelCacheSlot_t;
+
+static XMEM_Handle          gHandle;
+static int32_t              gCount = -1;
+static uint8_t              gOpenFailed;    // the region holds no valid store, not tried again
+static ModelStoreEntry_t    gDir[MODEL_STORE_MAX_MODELS];
+#ifdef MODEL_STORE_XIP
+static uint32_t             gVerified;      // models whose CRCs passed
+#else
+static ModelCacheSlot_t     gSlots[MODEL_STORE_CACHE_SLOTS];
+static uint32_t             gUseClock;
+#endif
+static ModelStoreStats_t    gStats;
+
+/* CRC-32 (IEEE 802.3, same as zlib), 4 bits at a time to keep the table small */
+static const uint32_t gCrcNibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static uint32_t crc32(const void *data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t crc = 0xFFFFFFFF;
+
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ gCrcNibble[crc & 0x0F];
+        crc = (crc >> 4) ^ gCrcNibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static int32_t checkModel(const ModelStoreEntry_t *e, const uint8_t *net, const uint8_t *grammar)
+{
+    if ((crc32(net, e->netSize) != e->netCrc) || (crc32(grammar, e->grammarSize) != e->grammarCrc)) {
+        gStats.crcErrors++;
+        UART_PRINT("\rmodel store: %s v%lu failed its checksum\r\n", e->name, (unsigned long) e->version);
+        return -1;
+    }
+    return 0;
+}
+
+#ifndef MODEL_STORE_XIP
+static void evict(ModelCacheSlot_t *slot)
+{
+    if (slot->mem != NULL) {
+        os_free(slot->mem);
+        slot->mem = NULL;
+        gStats.evictions++;
+    }
+    slot->entry = -1;
+}
+
+/* Least recently used slot, or a free one */
+static ModelCacheSlot_t *victim(void)
+{
+    ModelCacheSlot_t *best = &gSlots[0];
+    uint32_t i;
+
+    for (i = 0; i < MODEL_STORE_CACHE_SLOTS; i++) {
+        if (gSlots[i].entry < 0) {
+            return &gSlots[i];
+        }
+        if (gSlots[i].lastUse < best->lastUse) {
+            best = &gSlots[i];
+        }
+    }
+    return best;
+}
+
+/* Oldest slot still holding memory, NULL if none */
+static ModelCacheSlot_t *oldestUsed(void)
+{
+    ModelCacheSlot_t *best = NULL;
+    uint32_t i;
+
+    for (i = 0; i < MODEL_STORE_CACHE_SLOTS; i++) {
+        if ((gSlots[i].mem != NULL) && ((best == NULL) || (gSlots[i].lastUse < best->lastUse))) {
+            best = &gSlots[i];
+        }
+    }
+    return best;
+}
+#endif
+
+/* Reads and checks the directory, returns the number of models or -1 */
+static int32_t readDirectory(void)
+{
+    ModelStoreHdr_t hdr;
+    uint32_t i;
+
+    if ((XMEMWFF3_read(gHandle, 0, &hdr, sizeof(hdr), 0) != 0) ||
+        (hdr.magic != MODEL_STORE_MAGIC) || (hdr.format != MODEL_STORE_FORMAT) ||
+        (hdr.count == 0) || (hdr.count > MODEL_STORE_MAX_MODELS)) {
+        UART_PRINT("\rmodel store: no store in the region\r\n");
+        return -1;
+    }
+    if ((XMEMWFF3_read(gHandle, sizeof(hdr), gDir, hdr.count * sizeof(ModelStoreEntry_t), 0) != 0) ||
+        (crc32(gDir, hdr.count * sizeof(ModelStoreEntry_t)) != hdr.dirCrc)) {
+        UART_PRINT("\rmodel store: directory checksum error\r\n");
+        return -1;
+    }
+
+    for (i = 0; i < hdr.count; i++) {
+        ModelStoreEntry_t *e = &gDir[i];
+
+        e->name[MODEL_STORE_NAME_LEN - 1] = '\0';
+        if ((e->netOffset & 3) || (e->grammarOffset & 3) ||
+            (e->netOffset + e->netSize > MODEL_STORE_SIZE) ||
+            (e->grammarOffset + e->grammarSize > MODEL_STORE_SIZE)) {
+            UART_PRINT("\rmodel store: %s v%lu lies outside the region\r\n", e->name, (unsigned long) e->version);
+            return -1;
+        }
+    }
+    return hdr.count;
+}
+
+int32_t ModelStore_open(void)
+{
+    XMEM_Params params;
+    int32_t count;
+#ifndef MODEL_STORE_XIP
+    uint32_t i;
+#endif
+
+    if (gCount >= 0) {
+        return gCount;
+    }
+    if (gOpenFailed) {
+        return -1;
+    }
+
+#ifndef MODEL_STORE_XIP
+    for (i = 0; i < MODEL_STORE_CACHE_SLOTS; i++) {
+        gSlots[i].entry = -1;
+        gSlots[i].mem = NULL;
+    }
+#endif
+
+    params.regionBase = MODEL_STORE_PHYS_ADDR;
+    params.regionStartAddr = MODEL_STORE_LOGICAL_ADDR;
+    params.regionSize = MODEL_STORE_SIZE;
+    params.deviceNum = 0;
+    gHandle = XMEMWFF3_open(&params);
+    if (gHandle == NULL) {
+        gOpenFailed = 1;
+        return -1;
+    }
+
+    count = readDirectory();
+    if (count < 0) {
+        // Called on every wake word, fail once instead of reading flash each time
+        XMEMWFF3_close(gHandle);
+        gHandle = NULL;
+        gOpenFailed = 1;
+        return -1;
+    }
+
+    gCount = count;
+    return gCount;
+}
+
+const ModelStoreEntry_t *ModelStore_entry(uint32_t i)
+{
+    return ((gCount >= 0) && (i < (uint32_t) gCount)) ? &gDir[i] : NULL;
+}
+
+int32_t ModelStore_find(const char *name)
+{
+    int32_t best = -1;
+    int32_t i;
+
+    for (i = 0; i < gCount; i++) {
+        if ((strncmp(gDir[i].name, name, MODEL_STORE_NAME_LEN) == 0) &&
+            ((best < 0) || (gDir[i].version > gDir[best].version))) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+int32_t ModelStore_load(const char *name, const void **net, const void **grammar)
+{
+    const ModelStoreEntry_t *e;
+    int32_t idx;
+
+    if (ModelStore_open() < 0) {
+        return -1;
+    }
+    idx = ModelStore_find(name);
+    if (idx < 0) {
+        return -1;
+    }
+    e = &gDir[idx];
+    gStats.loads++;
+
+#ifdef MODEL_STORE_XIP
+    {
+        const uint8_t *base = (const uint8_t *) MODEL_STORE_LOGICAL_ADDR;
+
+        if (!(gVerified & (1u << idx))) {
+            if (checkModel(e, base + e->netOffset, base + e->grammarOffset) != 0) {
+                return -1;
+            }
+            gVerified |= 1u << idx;
+        }
+        else {
+            gStats.hits++;
+        }
+        *net = base + e->netOffset;
+        *grammar = base + e->grammarOffset;
+        return 0;
+    }
+#else
+    {
+        ModelCacheSlot_t *slot = NULL;
+        uint32_t size = ALIGN4(e->netSize) + e->grammarSize;
+        uint64_t start;
+        uint8_t *mem;
+        uint32_t i;
+
+        for (i = 0; i < MODEL_STORE_CACHE_SLOTS; i++) {
+            if (gSlots[i].entry == idx) {
+                slot = &gSlots[i];
+                break;
+            }
+        }
+
+        if (slot == NULL) {
+            start = OsiTs_cycles();
+
+            // Make room by dropping older models if the heap is short
+            while ((mem = (uint8_t *) os_malloc(size)) == NULL) {
+                ModelCacheSlot_t *old = oldestUsed();
+
+                if (old == NULL) {
+                    UART_PRINT("\rmodel store: no memory for %s (%lu bytes)\r\n", e->name, (unsigned long) size);
+                    return -1;
+                }
+                evict(old);
+            }
+
+            if ((XMEMWFF3_read(gHandle, e->netOffset, mem, e->netSize, 0) != 0) ||
+                (XMEMWFF3_read(gHandle, e->grammarOffset, mem + ALIGN4(e->netSize), e->grammarSize, 0) != 0) ||
+                (checkModel(e, mem, mem + ALIGN4(e->netSize)) != 0)) {
+                os_free(mem);
+                return -1;
+            }
+            // Only replace a cached model once the new one checked out
+            slot = victim();
+            evict(slot);
+            slot->entry = idx;
+            slot->mem = mem;
+            gStats.lastLoadUs = (uint32_t) OsiTs_toUs(OsiTs_cycles() - start);
+        }
+        else {
+            gStats.hits++;
+        }
+
+        slot->lastUse = ++gUseClock;
+        *net = slot->mem;
+        *grammar = (const uint8_t *) slot->mem + ALIGN4(e->netSize);
+        return 0;
+    }
+#endif
+}
+
+void ModelStore_getStats(ModelStoreStats_t *stats)
+{
+    *stats = gStats;
+}
+
+void ModelStore_dump(void)
+{
+    int32_t i;
+
+    UART_PRINT("\r\nmodel store: %ld models\r\n", (long) gCount);
+    for (i = 0; i < gCount; i++) {
+        const char *state = "";
+
+#ifdef MODEL_STORE_XIP
+        state = (gVerified & (1u << i)) ? " (verified)" : "";
+#else
+        uint32_t j;
+
+        for (j = 0; j < MODEL_STORE_CACHE_SLOTS; j++) {
+            if (gSlots[j].entry == i) {
+                state = " (in RAM)";
+            }
+        }
+#endif
+        UART_PRINT("\r  %-16s v%-4lu net %6lu B  grammar %5lu B%s\r\n", gDir[i].name,
+                   (unsigned long) gDir[i].version, (unsigned long) gDir[i].netSize,
+                   (unsigned long) gDir[i].grammarSize, state);
+    }
+    UART_PRINT("\r  %lu loads, %lu cache hits, %lu evictions, %lu CRC errors, last flash load %lu us\r\n",
+               (unsigned long) gStats.loads, (unsigned long) gStats.hits, (unsigned long) gStats.evictions,
+               (unsigned long) gStats.crcErrors, (unsigned long) gStats.lastLoadUs);
+}
+
+#endif // MODEL_STORE
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MODEL_STORE_H__
+#define __MODEL_STORE_H__
+
+#include <stdint.h>
+
+/*
+ * Model store (build with MODEL_STORE defined)
+ *
+ * Command models (net + grammar pairs) kept in an external flash region
+ * instead of being compiled in, so the command set can change without
+ * reflashing the application. The store is written by
+ * tools/model_store_pack.py and flashed to a reserved external flash region.
+ *
+ * ModelStore_load() copies a model into 4-byte aligned RAM and checks the
+ * CRC-32 of both parts. The last MODEL_STORE_CACHE_SLOTS models loaded stay
+ * in RAM (least recently used is dropped first), so switching back to one
+ * of them costs no flash read. Pointers returned by ModelStore_load() stay
+ * valid until that model is evicted. With MODEL_STORE_XIP the models are
+ * used in place through the memory mapped logical address: nothing is
+ * copied and the CRCs are checked on first use only.
+ *
+ * The flash map has no region for the store by default. Reserve one and
+ * define MODEL_STORE_PHYS_ADDR, MODEL_STORE_LOGICAL_ADDR and MODEL_STORE_SIZE
+ * (project compiler defines) to its physical address, logical address and
+ * size.
+ */
+#ifndef MODEL_STORE_CACHE_SLOTS
+#define MODEL_STORE_CACHE_SLOTS     2           // models kept in RAM
+#endif
+#ifndef MODEL_STORE_COMMAND_SET
+#define MODEL_STORE_COMMAND_SET     "command"   // model loaded on wake up
+#endif
+
+/*
+ * Store layout, all fields little endian:
+ *   ModelStoreHdr_t
+ *   ModelStoreEntry_t[count]
+ *   model data, each part 4-byte aligned
+ * dirCrc covers the entries. Offsets are from the start of the store.
+ */
+#define MODEL_STORE_MAGIC           0x4C444F4D  // "MODL"
+#define MODEL_STORE_FORMAT          1
+#define MODEL_STORE_MAX_MODELS      16
+#define MODEL_STORE_NAME_LEN        16
+
+typedef struct {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t count;
+    uint32_t dirCrc;
+    uint32_t reserved;
+} ModelStoreHdr_t;
+
+typedef struct {
+    char     name[MODEL_STORE_NAME_LEN];    // NUL padded
+    uint32_t version;
+    uint32_t netOffset;
+    uint32_t netSize;
+    uint32_t netCrc;
+    uint32_t grammarOffset;
+    uint32_t grammarSize;
+    uint32_t grammarCrc;
+    uint32_t reserved;
+} ModelStoreEntry_t;
+
+typedef struct {
+    uint32_t loads;
+    uint32_t hits;              // served from the RAM cache
+    uint32_t evictions;
+    uint32_t crcErrors;
+    uint32_t lastLoadUs;        // time of the last load that read flash
+} ModelStoreStats_t;
+
+#ifdef MODEL_STORE
+
+/*!
+ *  @brief  Read and check the store directory
+ *
+ *  The region is read once; after a failure the later calls fail at once.
+ *
+ *  @return  number of models, or -1 if the region holds no valid store
+ */
+int32_t ModelStore_open(void);
+
+/*!
+ *  @brief  Directory entry i, NULL past the end
+ */
+const ModelStoreEntry_t *ModelStore_entry(uint32_t i);
+
+/*!
+ *  @brief  Index of the newest version of the model called name, -1 if absent
+ */
+int32_t ModelStore_find(const char *name);
+
+/*!
+ *  @brief  Get the net and grammar of the newest model called name
+ *
+ *  @return  0 on success, -1 if the model is missing, does not fit in RAM
+ *           or fails its checksum
+ */
+int32_t ModelStore_load(const char *name, const void **net, const void **grammar);
+
+/*!
+ *  @brief  Copy the load counters
+ */
+void ModelStore_getStats(ModelStoreStats_t *stats);
+
+/*!
+ *  @brief  Print the directory, the cached models and the counters
+ */
+void ModelStore_dump(void);
+
+#endif // MODEL_STORE
+
+#endif // __MODEL_STORE_H__
@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== osi_bench.c ========
+ *  Contention and latency microbenchmarks of the osi_* adaptation API.
+ *
+ *  The same file runs on the target (OSI_BENCH build, replaces the demo's
+ *  mainThread) and on a Linux host against adaptation/posix/osi_dpl_posix.c:
+ *
+ *      gcc -O2 -pthread -DOSI_BENCH -Iadaptation/posix \
+ *          osi_bench.c adaptation/posix/osi_dpl_posix.c -o osi_bench
+ *
+ *  Results are printed as JSON between BENCH_JSON_BEGIN / BENCH_JSON_END
+ *  lines in nanoseconds, so tools/bench_compare.py can compare two runs of
+ *  the same backend, or the two backends with each other. The target also
+ *  times osi_fopen() / osi_fread() / osi_fclose() cycles and NV updates.
+ */
+#ifdef OSI_BENCH
+
+#include <stdint.h>
+#include <string.h>
+
+#include "osi_kernel.h"
+
+#ifdef __linux__
+#include <time.h>
+#define OSI_BENCH_TARGET        "linux"
+#define BENCH_PRINT             Report
+#else
+#include "osi_timestamp.h"
+#include "osi_nvlog.h"
+#include "uart_term.h"
+#define OSI_BENCH_TARGET        "cc35xx"
+#define BENCH_PRINT             UART_PRINT
+#endif
+
+#ifndef OSI_BENCH_ITER
+#define OSI_BENCH_ITER          10000       // round trips / lock pairs per test
+#endif
+#ifndef OSI_BENCH_THREADS
+#define OSI_BENCH_THREADS       4           // lock contention workers
+#endif
+#define OSI_BENCH_PRIORITY      2
+#define OSI_BENCH_STACK         2048
+#define OSI_BENCH_MSG_SIZE      32
+#define OSI_BENCH_TIMER_MS      10
+#define OSI_BENCH_TIMER_TICKS   50
+#define OSI_BENCH_FILE_ITER     1000
+#define OSI_BENCH_FILE_READ     64
+#define OSI_BENCH_NV_WRITES     100
+#define OSI_BENCH_NV_SIZE       256         // image size, like a Wi-Fi profile
+#define OSI_BENCH_NV_CHANGE     4           // bytes changed per update
+#define OSI_BENCH_NV_ITEM       0x7E        // scratch NV item, deleted afterwards
+
+typedef struct {
+    uint64_t max;
+    uint64_t sum;
+    uint32_t count;
+} BenchStat_t;
+
+static OsiLockObj_t      gLock;
+static OsiSyncObj_t      gPing, gPong;
+static OsiMsgQ_t         gPingQ, gPongQ;
+static OsiSemaphoreObj_t gDone;
+static volatile uint32_t gCounter;
+static volatile uint32_t gStop;
+static uint64_t          gTimerLast;
+static BenchStat_t       gTimerStat;
+static OsiSyncObj_t      gTimerDone;
+
+static uint64_t benchNs(void)
+{
+#ifdef __linux__
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    return OsiTs_cycles() * 1000 / (OsiTs_clockHz() / 1000000);
+#endif
+}
+
+static void statAdd(BenchStat_t *s, uint64_t value)
+{
+    if (value > s->max)
+    {
+        s->max = value;
+    }
+    s->sum += value;
+    s->count++;
+}
+
+static uint32_t statMean(const BenchStat_t *s)
+{
+    return s->count ? (uint32_t)(s->sum / s->count) : 0;
+}
+
+static void benchPrint(const char *name, const BenchStat_t *s, int last)
+{
+    BENCH_PRINT("\r  \"%s\": {\"mean_ns\": %u, \"max_ns\": %u}%s\r\n",
+                name, statMean(s), (uint32_t)s->max, last ? "" : ",");
+}
+
+/* Lock and unlock with nobody else around: the cost of the primitive */
+static void benchLockUncontended(BenchStat_t *s)
+{
+    uint64_t start;
+    uint32_t i;
+
+    for (i = 0; i < OSI_BENCH_ITER; i++)
+    {
+        start = benchNs();
+        osi_LockObjLock(&gLock, OSI_WAIT_FOREVER);
+        osi_LockObjUnlock(&gLock);
+        statAdd(s, benchNs() - start);
+    }
+}
+
+static void *lockWorker(void *pParam)
+{
+    BenchStat_t *s = pParam;
+    uint64_t start;
+    uint32_t i;
+
+    for (i = 0; i < OSI_BENCH_ITER; i++)
+    {
+        start = benchNs();
+        osi_LockObjLock(&gLock, OSI_WAIT_FOREVER);
+        statAdd(s, benchNs() - start);
+        gCounter++;
+        osi_LockObjUnlock(&gLock);
+    }
+    osi_SemaphoreObjRelease(&gDone);
+    return NULL;
+}
+
+/*
+ * OSI_BENCH_THREADS workers hammer one lock. The mean is the wall time per
+ * lock pair over all workers, the max the longest wait for the lock.
+ */
+static void benchLockContended(BenchStat_t *s)
+{
+    static BenchStat_t wait[OSI_BENCH_THREADS];
+    OsiThread_t thread;
+    uint64_t start;
+    uint32_t i;
+
+    gCounter = 0;
+    memset(wait, 0, sizeof(wait));
+    start = benchNs();
+    for (i = 0; i < OSI_BENCH_THREADS; i++)
+    {
+        osi_ThreadCreate(&thread, "lockWorker", OSI_BENCH_STACK, OSI_BENCH_PRIORITY, lockWorker, &wait[i]);
+    }
+    for (i = 0; i < OSI_BENCH_THREADS; i++)
+    {
+        osi_SemaphoreObjObtain(&gDone, OSI_WAIT_FOREVER);
+    }
+    s->sum = benchNs() - start;
+    s->count = OSI_BENCH_THREADS * OSI_BENCH_ITER;
+    for (i = 0; i < OSI_BENCH_THREADS; i++)
+    {
+        if (wait[i].max > s->max)
+        {
+            s->max = wait[i].max;
+        }
+    }
+    if (gCounter != OSI_BENCH_THREADS * OSI_BENCH_ITER)
+    {
+        BENCH_PRINT("\rlock lost updates: %u of %u\r\n", gCounter, OSI_BENCH_THREADS * OSI_BENCH_ITER);
+    }
+}
+
+static void *syncEcho(void *pParam)
+{
+    while (!gStop)
+    {
+        if (OSI_OK == osi_SyncObjWait(&gPing, OSI_WAIT_FOREVER))
+        {
+            osi_SyncObjSignal(&gPong);
+        }
+    }
+    osi_SemaphoreObjRelease(&gDone);
+    return NULL;
+}
+
+/* Signal another thread and wait for its answer: two wake-ups per round trip */
+static void benchSyncPingPong(BenchStat_t *s)
+{
+    OsiThread_t thread;
+    uint64_t start;
+    uint32_t i;
+
+    gStop = 0;
+    osi_ThreadCreate(&thread, "syncEcho", OSI_BENCH_STACK, OSI_BENCH_PRIORITY, syncEcho, NULL);
+    for (i = 0; i < OSI_BENCH_ITER; i++)
+    {
+        start = benchNs();
+        osi_SyncObjSignal(&gPing);
+        osi_SyncObjWait(&gPong, OSI_WAIT_FOREVER);
+        statAdd(s, benchNs() - start);
+    }
+    gStop = 1;
+    osi_SyncObjSignal(&gPing);
+    osi_SemaphoreObjObtain(&gDone, OSI_WAIT_FOREVER);
+}
+
+static void *msgEcho(void *pParam)
+{
+    uint8_t msg[OSI_BENCH_MSG_SIZE];
+
+    while (1)
+    {
+        osi_MsgQRead(&gPingQ, msg, OSI_WAIT_FOREVER);
+        if (msg[0])
+        {
+            break;
+        }
+        osi_MsgQWrite(&gPongQ, msg, OSI_WAIT_FOREVER, 0);
+    }
+    osi_SemaphoreObjRelease(&gDone);
+    return NULL;
+}
+
+/* Same round trip carrying an OSI_BENCH_MSG_SIZE byte message each way */
+static void benchMsgQPingPong(BenchStat_t *s)
+{
+    uint8_t msg[OSI_BENCH_MSG_SIZE];
+    OsiThread_t thread;
+    uint64_t start;
+    uint32_t i;
+
+    memset(msg, 0, sizeof(msg));
+    osi_ThreadCreate(&thread, "msgEcho", OSI_BENCH_STACK, OSI_BENCH_PRIORITY, msgEcho, NULL);
+    for (i = 0; i < OSI_BENCH_ITER; i++)
+    {
+        start = benchNs();
+        osi_MsgQWrite(&gPingQ, msg, OSI_WAIT_FOREVER, 0);
+        osi_MsgQRead(&gPongQ, msg, OSI_WAIT_FOREVER);
+        statAdd(s, benchNs() - start);
+    }
+    msg[0] = 1;
+    osi_MsgQWrite(&gPingQ, msg, OSI_WAIT_FOREVER, 0);
+    osi_SemaphoreObjObtain(&gDone, OSI_WAIT_FOREVER);
+}
+
+static void timerTick(void *pParam)
+{
+    uint64_t now = benchNs();
+
+    if (gTimerLast)
+    {
+        int64_t err = (int64_t)(now - gTimerLast) - (int64_t)OSI_BENCH_TIMER_MS * 1000000;
+        statAdd(&gTimerStat, (err < 0) ? -err : err);
+    }
+    gTimerLast = now;
+    if (gTimerStat.count == OSI_BENCH_TIMER_TICKS)
+    {
+        osi_SyncObjSignal(&gTimerDone);
+    }
+}
+
+/* Periodic timer: deviation of each period from OSI_BENCH_TIMER_MS */
+static void benchTimer(BenchStat_t *s)
+{
+    OsiTimer_t timer;
+
+    gTimerLast = 0;
+    memset(&gTimerStat, 0, sizeof(gTimerStat));
+    osi_TimerCreate(&timer, "bench", timerTick, NULL);
+    osi_TimerStart(&timer, OSI_BENCH_TIMER_MS, TRUE);
+    if (OSI_OK != osi_SyncObjWait(&gTimerDone, 4 * OSI_BENCH_TIMER_MS * OSI_BENCH_TIMER_TICKS))
+    {
+        BENCH_PRINT("\rtimer: %u of %u periods\r\n", gTimerStat.count, OSI_BENCH_TIMER_TICKS);
+    }
+    osi_TimerStop(&timer);
+    osi_TimerDelete(&timer);
+    *s = gTimerStat;
+}
+
+#ifndef __linux__
+/* osi_fopen() / osi_fread() / osi_fclose() of one file: name lookup, handle and read cost */
+static void benchFile(BenchStat_t *s, const char *name)
+{
+    uint8_t buf[OSI_BENCH_FILE_READ];
+    uint64_t start;
+    uint32_t i;
+    FILE *fp;
+
+    for (i = 0; i < OSI_BENCH_FILE_ITER; i++)
+    {
+        start = benchNs();
+        fp = osi_fopen(name, "r");
+        if (NULL == fp)
+        {
+            BENCH_PRINT("\rfile: cannot open %s\r\n", name);
+            return;
+        }
+        osi_fread(buf, sizeof(buf), 0, fp);
+        osi_fclose(fp);
+        statAdd(s, benchNs() - start);
+    }
+}
+
+extern NVINTF_nvFuncts_t *nvFptrs;
+
+/*
+ * Small updates of an NV image: delete + full write (the old osi_fwrite()
+ * path) against append-only records. Flash wear is counted as bytes
+ * written, the NVOCMP item overhead is left out for both.
+ */
+static void benchNvWrite(BenchStat_t *s, uint32_t *bytes, int useLog)
+{
+    static uint8_t image[OSI_BENCH_NV_SIZE];
+    NVINTF_itemID_t item = { NVINTF_SYSID_WIFI, OSI_BENCH_NV_ITEM, 0 };
+    NvLogStats_t before, after;
+    uint32_t seed = 12345;
+    uint64_t start;
+    uint32_t i, j;
+
+    memset(image, 0x5A, sizeof(image));
+    NvLog_getStats(&before);
+    for (i = 0; i < OSI_BENCH_NV_WRITES; i++)
+    {
+        for (j = 0; j < OSI_BENCH_NV_CHANGE; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+            image[(seed >> 16) % OSI_BENCH_NV_SIZE]++;
+        }
+        start = benchNs();
+        if (useLog)
+        {
+            NvLog_write(nvFptrs, item, image, sizeof(image));
+        }
+        else
+        {
+            nvFptrs->deleteItem(item);
+            nvFptrs->writeItem(item, sizeof(image), image);
+            *bytes += sizeof(image);
+        }
+        statAdd(s, benchNs() - start);
+    }
+    NvLog_getStats(&after);
+    if (useLog)
+    {
+        *bytes = after.bytesWritten - before.bytesWritten;
+        NvLog_remove(nvFptrs, item);
+    }
+    else
+    {
+        nvFptrs->deleteItem(item);
+    }
+}
+
+/*
+ * A reset part way through NvLog_remove() can leave deltas without a base.
+ * Deleting only the bases stands in for that: the item written next must
+ * read back as written, not with the leftover deltas applied.
+ */
+static void benchNvRemoveReset(void)
+{
+    static uint8_t image[OSI_BENCH_NV_SIZE];
+    static uint8_t check[OSI_BENCH_NV_SIZE];
+    NVINTF_itemID_t item = { NVINTF_SYSID_WIFI, OSI_BENCH_NV_ITEM, 0 };
+    NVINTF_itemID_t base = item;
+
+    memset(image, 0x5A, sizeof(image));
+    NvLog_write(nvFptrs, item, image, sizeof(image));
+    image[0]++;
+    NvLog_write(nvFptrs, item, image, sizeof(image));      // one delta
+    for (base.subID = 0; base.subID < 2; base.subID++)
+    {
+        nvFptrs->deleteItem(base);
+    }
+
+    memset(image, 0xA5, sizeof(image));
+    memset(check, 0, sizeof(check));
+    if ((NvLog_write(nvFptrs, item, image, sizeof(image)) != 0) ||
+        (NvLog_read(nvFptrs, item, 0, check, sizeof(check)) != (int32_t)sizeof(check)) ||
+        (memcmp(image, check, sizeof(image)) != 0))
+    {
+        BENCH_PRINT("\rnv: item rewritten after a partial remove reads back wrong\r\n");
+    }
+    NvLog_remove(nvFptrs, item);
+}
+#endif
+
+void OsiBench_run(void)
+{
+    BenchStat_t stat[9];
+#ifndef __linux__
+    uint32_t nvBytes[2] = { 0, 0 };
+#endif
+
+    memset(stat, 0, sizeof(stat));
+    osi_LockObjCreate(&gLock);
+    osi_SyncObjCreate(&gPing);
+    osi_SyncObjCreate(&gPong);
+    osi_SyncObjCreate(&gTimerDone);
+    osi_MsgQCreate(&gPingQ, "ping", OSI_BENCH_MSG_SIZE, 1);
+    osi_MsgQCreate(&gPongQ, "pong", OSI_BENCH_MSG_SIZE, 1);
+    osi_SemaphoreObjCreate(&gDone, "done", 0, OSI_BENCH_THREADS);
+
+    benchLockUncontended(&stat[0]);
+    benchLockContended(&stat[1]);
+    benchSyncPingPong(&stat[2]);
+    benchMsgQPingPong(&stat[3]);
+    benchTimer(&stat[4]);
+#ifndef __linux__
+    benchFile(&stat[5], "cc33xx-conf");
+    benchFile(&stat[6], "conn_p");      // also brings up NV
+    benchNvWrite(&stat[7], &nvBytes[0], 0);
+    benchNvWrite(&stat[8], &nvBytes[1], 1);
+    benchNvRemoveReset();
+#endif
+
+    BENCH_PRINT("\rBENCH_JSON_BEGIN\r\n");
+    BENCH_PRINT("\r{\"target\": \"%s\", \"iterations\": %u, \"threads\": %u,\r\n",
+                OSI_BENCH_TARGET, OSI_BENCH_ITER, OSI_BENCH_THREADS);
+    BENCH_PRINT("\r \"osi\": {\r\n");
+    benchPrint("lock_uncontended", &stat[0], 0);
+    benchPrint("lock_contended", &stat[1], 0);
+    benchPrint("sync_round_trip", &stat[2], 0);
+    benchPrint("msgq_round_trip", &stat[3], 0);
+#ifdef __linux__
+    benchPrint("timer_period_error", &stat[4], 1);
+#else
+    benchPrint("timer_period_error", &stat[4], 0);
+    benchPrint("file_conf_open_read_close", &stat[5], 0);
+    benchPrint("file_nv_open_read_close", &stat[6], 0);
+    benchPrint("nv_write_rewrite", &stat[7], 0);
+    benchPrint("nv_write_log", &stat[8], 0);
+    BENCH_PRINT("\r  \"nv_wear\": {\"rewrite_bytes\": %u, \"log_bytes\": %u}\r\n", nvBytes[0], nvBytes[1]);
+#endif
+    BENCH_PRINT("\r }}\r\n");
+    BENCH_PRINT("\rBENCH_JSON_END\r\n");
+}
+
+#ifdef __linux__
+int main(void)
+{
+    OsiBench_run();
+    return 0;
+}
+#else
+void *mainThread(void *args)
+{
+    InitTerm();
+    OsiTs_init();
+    OsiBench_run();
+    return NULL;
+}
+#endif
+
+#endif // OSI_BENCH
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_FWCACHE_H__
+#define __OSI_FWCACHE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//Defines
+
+/*
+ * Read cache in front of the XMEM handle of the connectivity firmware slot.
+ *
+ * The firmware download reads the "fw" file in many small pieces, each of
+ * which used to be a separate external flash transaction. Reads are now
+ * served from a window of OSI_FW_CACHE_SECTORS sector aligned sectors. A
+ * miss right after the window (the download reading on) refills the whole
+ * window in one transaction, other misses load only the sector they need.
+ * Reads of at least a full window bypass the cache.
+ *
+ * One firmware file is open at a time, from one task. FwCache_dump() prints
+ * the hit / miss counts, the bytes read from flash and the time from the
+ * last open of the file to its close, which is the firmware load time.
+ * Build with OSI_FW_CACHE=0 to measure the same without the cache.
+ */
+#ifndef OSI_FW_CACHE
+#define OSI_FW_CACHE                1
+#endif
+#ifndef OSI_FW_CACHE_SECTOR
+#define OSI_FW_CACHE_SECTOR         1024        // alignment and random miss fill size
+#endif
+#ifndef OSI_FW_CACHE_SECTORS
+#define OSI_FW_CACHE_SECTORS        4           // window, filled on a sequential miss
+#endif
+#ifndef OSI_FW_CACHE_REPORT
+#define OSI_FW_CACHE_REPORT         0           // FwCache_dump() when the file is closed
+#endif
+
+typedef struct {
+    uint32_t reads;                 // FwCache_read() calls
+    uint32_t hits;                  // served from the window
+    uint32_t misses;                // needed a flash transaction
+    uint32_t readAheads;            // misses that refilled the whole window
+    uint32_t bypassed;              // reads too large for the window
+    uint32_t bytesRequested;
+    uint32_t bytesFlash;            // bytes read from flash
+    uint32_t transactions;          // XMEM reads issued
+    uint32_t loadUs;                // last open to close
+} FwCacheStats_t;
+
+/*!
+ *  @brief  Start caching reads of handle, an XMEM handle of a region of regionSize bytes
+ */
+void FwCache_open(void *handle, uint32_t regionSize);
+
+/*!
+ *  @brief  Read len bytes at offset of the region into dst
+ *
+ *  @return  0 on success, the XMEM status otherwise
+ */
+int FwCache_read(uint32_t offset, void *dst, size_t len);
+
+/*!
+ *  @brief  Drop the cached data, record the load time
+ */
+void FwCache_close(void);
+
+/*!
+ *  @brief  Copy the counters of the last firmware load
+ */
+void FwCache_getStats(FwCacheStats_t *stats);
+
+/*!
+ *  @brief  Print the counters of the last firmware load
+ */
+void FwCache_dump(void);
+
+#endif // __OSI_FWCACHE_H__
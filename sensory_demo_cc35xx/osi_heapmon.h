@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_HEAPMON_H__
+#define __OSI_HEAPMON_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//Defines
+
+/*
+ * Heap fragmentation monitor, enabled with HEAP_MONITOR.
+ *
+ * A low priority task samples the FreeRTOS heap every HEAP_MON_PERIOD_S
+ * seconds: free bytes, largest and smallest free block, number of free
+ * blocks, minimum ever free bytes and a free block size histogram. The
+ * fragmentation index is the share of the free bytes that is not in the
+ * largest free block (0 = one contiguous free block, near 100 = only
+ * crumbs). When a threshold is crossed the registered callback is called
+ * (and a warning printed), so that e.g. a Wi-Fi or SPP restart can be
+ * deferred or the application restarted before an allocation fails.
+ *
+ * The totals come from vPortGetHeapStats(). The histogram walks the heap_4
+ * block headers from a small block allocated by HeapMon_init(), so call it
+ * as early as possible: free blocks below that block are only counted in
+ * the totals (reported as "below walk start").
+ */
+#ifndef HEAP_MON_PERIOD_S
+#define HEAP_MON_PERIOD_S           5
+#endif
+#ifndef HEAP_MON_MIN_FREE
+#define HEAP_MON_MIN_FREE           (16 * 1024)     // free bytes
+#endif
+#ifndef HEAP_MON_MIN_LARGEST
+#define HEAP_MON_MIN_LARGEST        (24 * 1024)     // largest free block, SPP and Wi-Fi buffers
+#endif
+#ifndef HEAP_MON_MAX_FRAG_PCT
+#define HEAP_MON_MAX_FRAG_PCT       75              // fragmentation index
+#endif
+#ifndef HEAP_MON_WALK
+#define HEAP_MON_WALK               1               // 0 = totals only, no histogram
+#endif
+
+#define HEAP_MON_BUCKETS            13              // free block sizes <32, <64, ... <64K, >=64K
+
+/* Threshold events, passed as a bit mask */
+#define HEAP_MON_EVT_LOW_FREE       (1 << 0)
+#define HEAP_MON_EVT_LOW_LARGEST    (1 << 1)
+#define HEAP_MON_EVT_FRAGMENTED     (1 << 2)
+
+typedef struct {
+    uint32_t freeBytes;
+    uint32_t minEverFree;
+    uint32_t largestFree;
+    uint32_t smallestFree;
+    uint32_t freeBlocks;
+    uint32_t fragPct;                   // 100 - largestFree * 100 / freeBytes
+    uint32_t events;                    // HEAP_MON_EVT_* currently active
+    uint32_t walkedBytes;               // heap bytes covered by the histogram
+    uint32_t walkedFree;                // free blocks found by the walk
+    uint32_t walkErrors;                // walks stopped on a corrupted header
+    uint32_t hist[HEAP_MON_BUCKETS];    // free blocks per size class
+} HeapMonStats_t;
+
+/*!
+ *  @brief  Threshold callback, called from the monitor task when the set of
+ *          active events changes (also when it becomes empty again)
+ */
+typedef void (*HeapMonCallback_t)(uint32_t events, const HeapMonStats_t *stats);
+
+#ifdef HEAP_MONITOR
+
+/*!
+ *  @brief  Allocate the walk anchor and start the monitor task
+ */
+void HeapMon_init(void);
+
+/*!
+ *  @brief  Register the threshold callback, NULL to only print warnings
+ */
+void HeapMon_setCallback(HeapMonCallback_t cb);
+
+/*!
+ *  @brief  Take a sample now and evaluate the thresholds
+ */
+void HeapMon_sample(HeapMonStats_t *stats);
+
+/*!
+ *  @brief  Print the last sample and the histogram on the console
+ */
+void HeapMon_dump(void);
+
+#else
+
+#define HeapMon_init()
+#define HeapMon_setCallback(cb)
+#define HeapMon_dump()
+
+#endif // HEAP_MONITOR
+
+#endif // __OSI_HEAPMON_H__
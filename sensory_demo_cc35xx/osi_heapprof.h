@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_HEAPPROF_H__
+#define __OSI_HEAPPROF_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//Defines
+
+/*
+ * Heap profiler, enabled with HEAP_PROFILER.
+ *
+ * Every os_malloc()/os_calloc()/os_zalloc()/os_realloc()/os_free() is
+ * charged to the return address of its caller. Per call site it keeps the
+ * live and peak bytes, allocation / free / failure counts and the mean
+ * lifetime of freed blocks. Live blocks are tracked in a fixed open
+ * addressing table keyed by address, call sites in a second one keyed by LR,
+ * so the profiler itself never allocates. Both updates run in one short
+ * interrupt lock.
+ *
+ * HeapProf_dump() prints a snapshot on the console; resolve the LRs with
+ *     arm-none-eabi-addr2line -f -e <app>.out <lr>
+ */
+#ifndef HEAP_PROFILER_SITES
+#define HEAP_PROFILER_SITES         64          // call sites, power of 2
+#endif
+#ifndef HEAP_PROFILER_BLOCKS
+#define HEAP_PROFILER_BLOCKS        1024        // live blocks tracked, power of 2
+#endif
+#ifndef HEAP_PROFILER_PERIOD_S
+#define HEAP_PROFILER_PERIOD_S      0           // periodic dump, 0 = only on request
+#endif
+
+typedef struct {
+    uint32_t lr;                // call site, 0 = unused entry
+    uint32_t liveBytes;
+    uint32_t peakBytes;
+    uint32_t liveBlocks;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t fails;
+    uint64_t lifetimeTicks;     // summed over freed blocks
+} HeapProfSite_t;
+
+#ifdef HEAP_PROFILER
+
+/*!
+ *  @brief  Record an allocation of size bytes made from lr, ptr NULL if it failed
+ */
+void HeapProf_alloc(uint32_t lr, void *ptr, size_t size);
+
+/*!
+ *  @brief  Record the release of a block recorded by HeapProf_alloc()
+ */
+void HeapProf_free(void *ptr);
+
+/*!
+ *  @brief  Print the call sites, largest live bytes first
+ */
+void HeapProf_dump(void);
+
+/*!
+ *  @brief  Copy up to max call sites into sites
+ *
+ *  @return  number of sites copied
+ */
+uint32_t HeapProf_snapshot(HeapProfSite_t *sites, uint32_t max);
+
+/*!
+ *  @brief  Start the periodic dump task when HEAP_PROFILER_PERIOD_S is set
+ */
+void HeapProf_init(void);
+
+#else
+
+#define HeapProf_alloc(lr, ptr, size)
+#define HeapProf_free(ptr)
+#define HeapProf_dump()
+#define HeapProf_init()
+
+#endif // HEAP_PROFILER
+
+#endif // __OSI_HEAPPROF_H__
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_LOCKSTAT_H__
+#define __OSI_LOCKSTAT_H__
+
+#include <stdint.h>
+#include <semaphore.h>
+#include "ti/drivers/dpl/SemaphoreP.h"
+
+//Defines
+
+/*
+ * Lock and semaphore contention statistics, enabled with LOCK_STATS.
+ *
+ * osi_LockObjLock(), osi_SyncObjWait() and osi_SemaphoreObjObtain() first
+ * try to take the object without blocking. Only when that fails is the
+ * wait timed with OsiTs_cycles(), so an uncontended acquisition costs one
+ * extra table lookup. Per object (keyed by its SemaphoreP handle) the table
+ * keeps the acquisition, contended and timeout counts and the total and
+ * longest wait. For the longest wait it also saves the name of the task
+ * that waited and, for lock objects, of the task that held the lock at the
+ * time, which is what shows a priority inversion.
+ *
+ * Objects are listed by address unless named with LockStat_setName().
+ * Deleting an object drops its entry. POSIX semaphores (the audio brick
+ * semaphore) are covered by waiting on them with LockStat_semWait().
+ */
+#ifndef LOCK_STATS_OBJECTS
+#define LOCK_STATS_OBJECTS          32          // objects tracked, power of 2
+#endif
+#ifndef LOCK_STATS_PERIOD_S
+#define LOCK_STATS_PERIOD_S         0           // periodic dump, 0 = only on request
+#endif
+#define LOCK_STATS_NAME_LEN         12          // task names are truncated to this
+
+typedef enum {
+    LOCK_STAT_LOCK,                 // OsiLockObj_t
+    LOCK_STAT_SYNC,                 // OsiSyncObj_t
+    LOCK_STAT_SEM,                  // OsiSemaphoreObj_t
+    LOCK_STAT_POSIX                 // sem_t
+} LockStatKind_e;
+
+typedef struct {
+    const void *obj;                // NULL = unused entry
+    const char *name;
+    uint32_t    kind;
+    uint32_t    acquired;
+    uint32_t    contended;          // had to block
+    uint32_t    timeouts;           // gave up, not counted as acquired
+    uint64_t    waitTotal;          // cycles, summed over contended waits
+    uint64_t    waitMax;            // cycles
+    char        maxWaiter[LOCK_STATS_NAME_LEN];
+    char        maxHolder[LOCK_STATS_NAME_LEN];
+    void       *holder;             // task holding a lock object, NULL if free
+} LockStat_t;
+
+#ifdef LOCK_STATS
+
+/*!
+ *  @brief  SemaphoreP_pend() on handle, recording the wait against obj
+ */
+SemaphoreP_Status LockStat_pend(const void *obj, LockStatKind_e kind, SemaphoreP_Handle handle, uint32_t timeout);
+
+/*!
+ *  @brief  Record that the lock object obj was released
+ */
+void LockStat_release(const void *obj);
+
+/*!
+ *  @brief  sem_wait() on sem, recording the wait
+ */
+int LockStat_semWait(sem_t *sem);
+
+/*!
+ *  @brief  Name shown for obj in the table, name must stay valid
+ */
+void LockStat_setName(const void *obj, const char *name);
+
+/*!
+ *  @brief  Drop the entry of a deleted object
+ */
+void LockStat_forget(const void *obj);
+
+/*!
+ *  @brief  Print the objects, longest wait first
+ */
+void LockStat_dump(void);
+
+/*!
+ *  @brief  Copy up to max entries into stats
+ *
+ *  @return  number of entries copied
+ */
+uint32_t LockStat_snapshot(LockStat_t *stats, uint32_t max);
+
+/*!
+ *  @brief  Clear the counters, the object names are kept
+ */
+void LockStat_reset(void);
+
+/*!
+ *  @brief  Start the periodic dump task when LOCK_STATS_PERIOD_S is set
+ */
+void LockStat_init(void);
+
+#else
+
+#define LockStat_pend(obj, kind, handle, timeout)   SemaphoreP_pend(handle, timeout)
+#define LockStat_release(obj)
+#define LockStat_semWait(sem)                       sem_wait(sem)
+#define LockStat_setName(obj, name)
+#define LockStat_forget(obj)
+#define LockStat_dump()
+#define LockStat_reset()
+#define LockStat_init()
+
+#endif // LOCK_STATS
+
+#endif // __OSI_LOCKSTAT_H__
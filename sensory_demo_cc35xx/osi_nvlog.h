@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_NVLOG_H__
+#define __OSI_NVLOG_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ti/common/nv/nvintf.h"
+
+//Defines
+
+/*
+ * Append-only record format for NV backed files, on top of NVOCMP.
+ *
+ * A file is a base record (the full image) followed by delta records, each
+ * in its own NV sub ID of the file's item:
+ *     sub ID 0, 1          base records, written alternately
+ *     sub ID 2 ...         deltas on the current base, in order
+ * Every record starts with NvLogHdr_t. A delta replaces one byte range of
+ * the image and carries the sequence number of the base it applies to, so
+ * deltas left over from an older base are ignored. An update that leaves
+ * the image unchanged writes nothing; a small update writes a delta; a
+ * large one, or one past OSI_NVLOG_MAX_DELTAS deltas, compacts: the full
+ * image goes to the other base slot with a higher sequence number before
+ * the old base and its deltas are deleted. NVOCMP writes each item
+ * atomically, so recovery after a reset is to take the valid base with the
+ * highest sequence number and apply its deltas while they are contiguous.
+ * Removing an item deletes the deltas before the bases, and a new item's
+ * first base takes a sequence number past any deltas still on flash.
+ * A sub ID 0 item without a header (written before this format) is read
+ * as a base record and converted by the next compaction.
+ */
+#ifndef OSI_NVLOG_MAX_DELTAS
+#define OSI_NVLOG_MAX_DELTAS        8
+#endif
+#ifndef OSI_NVLOG_DELTA_PCT
+#define OSI_NVLOG_DELTA_PCT         50          // largest delta, percent of a full rewrite
+#endif
+#define OSI_NVLOG_MAGIC             0x4C4E      // "NL"
+
+typedef struct {
+    uint16_t magic;
+    uint16_t total;             // image length once this record is applied
+    uint32_t seq;
+    uint32_t baseSeq;           // base the delta applies to, seq for a base
+    uint16_t offset;            // first byte replaced, 0 for a base
+    uint16_t len;               // payload bytes following the header
+} NvLogHdr_t;
+
+typedef struct {
+    uint32_t writes;            // NvLog_write() calls
+    uint32_t unchanged;         // nothing written
+    uint32_t deltas;
+    uint32_t compactions;
+    uint32_t nvWrites;          // NV items written
+    uint32_t nvDeletes;         // NV items deleted
+    uint32_t bytesWritten;      // headers and payload written to NV
+} NvLogStats_t;
+
+/*!
+ *  @brief  Copy up to len bytes of the newest image of item, from offset on, into buf
+ *
+ *  Only the records overlapping the requested range are read, so a large
+ *  image can be read in small chunks.
+ *
+ *  @return  image length, or -1 if the item does not exist or a record cannot be read
+ */
+int32_t NvLog_read(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item, uint32_t offset, void *buf, uint32_t len);
+
+/*!
+ *  @brief  Length of the newest image of item, -1 if the item does not exist
+ */
+int32_t NvLog_length(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item);
+
+/*!
+ *  @brief  Make data (len bytes) the new image of item
+ *
+ *  Nothing is written if the current image cannot be read.
+ *
+ *  @return  0 on success, -1 on failure
+ */
+int32_t NvLog_write(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item, const void *data, uint32_t len);
+
+/*!
+ *  @brief  Delete every record of item
+ *
+ *  @return  0 on success, -1 if the item did not exist
+ */
+int32_t NvLog_remove(NVINTF_nvFuncts_t *nv, NVINTF_itemID_t item);
+
+/*!
+ *  @brief  Copy the write counters
+ */
+void NvLog_getStats(NvLogStats_t *stats);
+
+#endif // __OSI_NVLOG_H__
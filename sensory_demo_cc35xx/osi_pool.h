@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_POOL_H__
+#define __OSI_POOL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//Defines
+
+/*
+ * Fixed-size block pools behind os_malloc()/os_calloc()/os_zalloc()/
+ * os_realloc()/os_free(). Requests up to the largest class are served from
+ * the smallest class with a free block in O(1) under a few instructions of
+ * interrupt lock; larger requests, or all classes exhausted, fall back to the
+ * newlib heap as before. os_free() tells pool blocks from heap blocks by
+ * address.
+ *
+ * Set OSI_POOL_ENABLE to 0 to route everything to the heap again.
+ */
+#ifndef OSI_POOL_ENABLE
+#define OSI_POOL_ENABLE         1
+#endif
+
+/* Blocks per size class, 16 bytes to 512 bytes */
+#ifndef OSI_POOL_BLOCKS_16
+#define OSI_POOL_BLOCKS_16      64
+#endif
+#ifndef OSI_POOL_BLOCKS_32
+#define OSI_POOL_BLOCKS_32      64
+#endif
+#ifndef OSI_POOL_BLOCKS_64
+#define OSI_POOL_BLOCKS_64      32
+#endif
+#ifndef OSI_POOL_BLOCKS_128
+#define OSI_POOL_BLOCKS_128     16
+#endif
+#ifndef OSI_POOL_BLOCKS_256
+#define OSI_POOL_BLOCKS_256     16
+#endif
+#ifndef OSI_POOL_BLOCKS_512
+#define OSI_POOL_BLOCKS_512     8
+#endif
+
+#define OSI_POOL_NUM_CLASSES    6
+#define OSI_POOL_MAX_BLOCK      512
+
+typedef struct {
+    uint16_t blockSize;
+    uint16_t blocks;
+    uint16_t inUse;
+    uint16_t highWater;         // most blocks in use at once
+    uint32_t exhausted;         // requests for this class that found it empty
+} OsiPoolStats_t;
+
+/*!
+ *  @brief  Take a block of at least size bytes
+ *
+ *  @return  block, or NULL if size is above OSI_POOL_MAX_BLOCK or no
+ *           class that fits has a free block
+ */
+void *OsiPool_alloc(size_t size);
+
+/*!
+ *  @brief  Return a block taken with OsiPool_alloc()
+ *
+ *  @return  1 if ptr was a pool block, 0 if it is not from the pools
+ */
+int OsiPool_free(void *ptr);
+
+/*!
+ *  @brief  Usable size of a pool block, 0 if ptr is not from the pools
+ */
+size_t OsiPool_blockSize(const void *ptr);
+
+/*!
+ *  @brief  Copy the per class counters, stats holds OSI_POOL_NUM_CLASSES entries
+ */
+void OsiPool_getStats(OsiPoolStats_t *stats);
+
+/*!
+ *  @brief  Usable size of a block from os_malloc() and friends, pool or heap
+ */
+uint32_t os_blockSize(void *ptr);
+
+#endif // __OSI_POOL_H__
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_TASKMON_H__
+#define __OSI_TASKMON_H__
+
+#include <stdint.h>
+
+//Defines
+
+/*
+ * Per task CPU load and stack headroom monitor, enabled with TASK_MONITOR.
+ *
+ * The CPU time comes from the FreeRTOS run-time stats, clocked by the
+ * 64-bit cycle timestamp (osi_timestamp.h) divided by
+ * 2^TASK_MON_CLOCK_SHIFT. The FreeRTOS configuration the kernel is built
+ * with needs:
+ *
+ *     #define configUSE_TRACE_FACILITY                    1
+ *     #define configGENERATE_RUN_TIME_STATS               1
+ *     #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    TaskMon_runTimeInit()
+ *     #define portGET_RUN_TIME_COUNTER_VALUE()            TaskMon_runTimeCounter()
+ *
+ * and prototypes of the two functions. A low priority task samples all
+ * tasks every TASK_MON_PERIOD_S seconds and prints a "[tasks]" record with
+ * the idle share and, per task, the CPU share over the period and the
+ * stack high water mark (the bytes never used, as uxTaskGetStackHighWaterMark
+ * reports them). A task whose headroom falls below TASK_MON_STACK_WARN
+ * bytes gets a warning. The idle share is the CPU left for the application
+ * and the connectivity stack; the headroom is what a stack can be shrunk by
+ * after a run that went through every code path.
+ */
+#ifndef TASK_MON_PERIOD_S
+#define TASK_MON_PERIOD_S           10
+#endif
+#ifndef TASK_MON_MAX_TASKS
+#define TASK_MON_MAX_TASKS          16
+#endif
+#ifndef TASK_MON_CLOCK_SHIFT
+#define TASK_MON_CLOCK_SHIFT        7               // 0.8 us at 160 MHz, 32-bit counters wrap after 57 min
+#endif
+#ifndef TASK_MON_STACK_WARN
+#define TASK_MON_STACK_WARN         256             // bytes of stack headroom
+#endif
+
+typedef struct {
+    const char *name;
+    uint32_t    number;                 // FreeRTOS task number, unique while the task lives
+    uint32_t    priority;
+    uint32_t    cpuPermille;            // share of the last period
+    uint32_t    stackFree;              // bytes never used since the task started
+} TaskMonTask_t;
+
+typedef struct {
+    uint32_t      periodUs;             // run time covered by the last sample
+    uint32_t      idlePermille;
+    uint32_t      numTasks;
+    uint32_t      dropped;              // tasks beyond TASK_MON_MAX_TASKS
+    TaskMonTask_t tasks[TASK_MON_MAX_TASKS];
+} TaskMonStats_t;
+
+/*!
+ *  @brief  Run-time stats clock, for portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+ */
+void TaskMon_runTimeInit(void);
+
+/*!
+ *  @brief  Run-time stats counter, for portGET_RUN_TIME_COUNTER_VALUE()
+ */
+uint64_t TaskMon_runTimeCounter(void);
+
+#ifdef TASK_MONITOR
+
+/*!
+ *  @brief  Start the monitor task
+ */
+void TaskMon_init(void);
+
+/*!
+ *  @brief  Sample all tasks now, the CPU shares cover the time since the previous sample
+ */
+void TaskMon_sample(TaskMonStats_t *stats);
+
+/*!
+ *  @brief  Print the last sample on the console, one line per task
+ */
+void TaskMon_dump(void);
+
+#else
+
+#define TaskMon_init()
+#define TaskMon_dump()
+
+#endif // TASK_MONITOR
+
+#endif // __OSI_TASKMON_H__
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_TIMESTAMP_H__
+#define __OSI_TIMESTAMP_H__
+
+#include <stdint.h>
+
+//Defines
+
+/*
+ * Monotonic 64-bit timestamps in CPU cycles, shared by the audio capture
+ * callback, the recognizer loop and the loggers so their times can be
+ * compared directly.
+ *
+ * The Cortex-M33 DWT cycle counter is 32 bits wide and has no overflow
+ * interrupt, so OsiTs_cycles() extends it in software: every call compares
+ * the counter with the previous reading and carries into the upper word.
+ * A ClockP callback reads it every OSI_TS_GUARD_MS so no wrap is missed
+ * when nobody else asks for the time. Every call also compares it with the
+ * system tick count, which keeps running in low power modes, and moves the
+ * timestamp forward by the time the core spent with its clock stopped; the
+ * first reading after wake-up takes the step, so intervals measured while
+ * the core was awake are never inflated by an earlier sleep.
+ *
+ * OsiTs_cycles() is a counter and a tick count read under a short interrupt
+ * lock and can be called from interrupts. OSI_TS_CYCCNT is the bare 32-bit counter (the low
+ * word of the same timebase) for code that only measures short intervals.
+ */
+#ifndef OSI_TS_GUARD_MS
+#define OSI_TS_GUARD_MS         1000        // well below the counter wrap (26 s at 160 MHz)
+#endif
+
+#define OSI_TS_CYCCNT           (*((volatile uint32_t *)0xE0001004))
+
+/*!
+ *  @brief  Enable the cycle counter and start the wrap guard, can be called more than once
+ */
+void OsiTs_init(void);
+
+/*!
+ *  @brief  Cycle count, ISR safe
+ */
+uint64_t OsiTs_cycles(void);
+
+/*!
+ *  @brief  Cycle counter frequency in Hz
+ */
+uint32_t OsiTs_clockHz(void);
+
+/*!
+ *  @brief  Convert a cycle count or difference to microseconds
+ */
+uint64_t OsiTs_toUs(uint64_t cycles);
+
+/*!
+ *  @brief  OsiTs_cycles() in microseconds, ISR safe
+ */
+static inline uint64_t OsiTs_us(void)
+{
+    return OsiTs_toUs(OsiTs_cycles());
+}
+
+#endif // __OSI_TIMESTAMP_H__
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OSI_ZCQ_H__
+#define __OSI_ZCQ_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <osi_kernel.h>
+
+//Defines
+
+/*
+ * Zero-copy queues.
+ *
+ * osi_MsgQWrite()/osi_MsgQRead() copy the whole message twice (into and out
+ * of the queue storage), so audio bricks or event payloads either go through
+ * the queue byte by byte or as an ad hoc pointer in a message. A zero-copy
+ * queue carries OsiZcqBuf_t descriptors: the data pointer, its length and the
+ * function that gives the buffer back. Posting moves the ownership of the
+ * buffer to the queue, receiving moves it to the reader, which calls
+ * osi_ZcqBufRelease() when done.
+ *
+ * osi_ZcqPost() never blocks and can be called from interrupts; when the
+ * queue is full it fails and the caller keeps the buffer.
+ */
+
+/*!
+ *  @brief  Gives a buffer back to where it came from, arg is OsiZcqBuf_t.arg
+ */
+typedef void (*OsiZcqRelease_t)(void *data, void *arg);
+
+typedef struct {
+    void            *data;
+    uint32_t        len;
+    OsiZcqRelease_t release;        // NULL if the buffer needs no release
+    void            *arg;
+} OsiZcqBuf_t;
+
+typedef struct {
+    OsiZcqBuf_t     *ring;
+    uint32_t        mask;           // depth - 1
+    uint32_t        head;           // next write, free running
+    uint32_t        tail;           // next read, free running
+    void            *items;         // counting semaphore, one count per queued buffer
+    uint32_t        posted;
+    uint32_t        full;           // posts refused, queue full
+    uint32_t        highWater;      // most buffers queued at once
+} OsiZcq_t;
+
+/*!
+    \brief  Create a zero-copy queue
+
+    \param  pZcq    -   queue object
+    \param  depth   -   buffers the queue can hold, power of 2
+
+    \return - OsiReturnVal_e
+*/
+OsiReturnVal_e osi_ZcqCreate(OsiZcq_t *pZcq, uint32_t depth);
+
+/*!
+    \brief  Delete a queue, buffers still queued are released
+
+    \param  pZcq    -   queue object
+
+    \return - OsiReturnVal_e
+*/
+OsiReturnVal_e osi_ZcqDelete(OsiZcq_t *pZcq);
+
+/*!
+    \brief  Pass a buffer to the queue, never blocks, callable from interrupts
+
+    \param  pZcq    -   queue object
+    \param  pBuf    -   buffer descriptor, copied into the queue
+
+    \return - OSI_OK when the queue owns the buffer, OSI_OPERATION_FAILED
+              when it is full and the caller still owns it
+*/
+OsiReturnVal_e osi_ZcqPost(OsiZcq_t *pZcq, const OsiZcqBuf_t *pBuf);
+
+/*!
+    \brief  Take the oldest buffer, the caller owns it afterwards
+
+    \param  pZcq    -   queue object
+    \param  pBuf    -   receives the buffer descriptor
+    \param  Timeout -   mSec to wait for a buffer, OSI_WAIT_FOREVER or OSI_NO_WAIT
+
+    \return - OsiReturnVal_e
+*/
+OsiReturnVal_e osi_ZcqReceive(OsiZcq_t *pZcq, OsiZcqBuf_t *pBuf, OsiTime_t Timeout);
+
+/*!
+    \brief  Number of buffers in the queue
+*/
+uint32_t osi_ZcqCount(OsiZcq_t *pZcq);
+
+/*!
+    \brief  Fill pBuf with a len byte block from os_malloc(), released with os_free()
+
+    \return - OsiReturnVal_e
+*/
+OsiReturnVal_e osi_ZcqBufAlloc(OsiZcqBuf_t *pBuf, uint32_t len);
+
+/*!
+    \brief  Give a received buffer back through its release function
+*/
+void osi_ZcqBufRelease(OsiZcqBuf_t *pBuf);
+
+#endif // __OSI_ZCQ_H__
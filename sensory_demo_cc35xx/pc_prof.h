@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __PC_PROF_H__
+#define __PC_PROF_H__
+
+#include <stdint.h>
+
+/*
+ * PC sampling profiler (build with PC_PROFILE defined)
+ *
+ * Samples the program counter of the interrupted task on every FreeRTOS
+ * tick (configUSE_TICK_HOOK must be 1; with PC_PROFILE_TICK_HOOK 0, call
+ * PcProf_sample() from another periodic interrupt instead) and counts the
+ * samples per 2^shift byte bucket of the flash text and of the hot text
+ * placed in RAM (hot_text.lds.inc), so it also sees the prebuilt
+ * libTHFMicro code that cannot be instrumented. The shift is the smallest
+ * that fits both in PC_PROFILE_BUCKETS counters.
+ *
+ * The tick interrupt has the lowest priority, so time spent in other
+ * interrupts is charged to the task code they interrupted. Samples stop
+ * after PC_PROFILE_SAMPLES; PcProf_poll() then prints the histogram once as
+ * "#PP" hex lines, which tools/pcprof_report.py maps to functions and turns
+ * into the hot section list for the linker.
+ */
+#ifndef PC_PROFILE_BUCKETS
+#define PC_PROFILE_BUCKETS          8192        // 16-bit counters
+#endif
+#ifndef PC_PROFILE_SAMPLES
+#define PC_PROFILE_SAMPLES          60000       // about a minute at a 1 kHz tick
+#endif
+#ifndef PC_PROFILE_TICK_HOOK
+#define PC_PROFILE_TICK_HOOK        1
+#endif
+
+#ifdef PC_PROFILE
+
+/*!
+ *  @brief  Clear the histogram and start sampling
+ */
+void PcProf_init(void);
+
+/*!
+ *  @brief  Take one sample, call from a single periodic interrupt
+ */
+void PcProf_sample(void);
+
+/*!
+ *  @brief  Stop sampling before PC_PROFILE_SAMPLES, e.g. at the end of a benchmark
+ */
+void PcProf_stop(void);
+
+/*!
+ *  @brief  Print the histogram once sampling has finished, call from the main loop
+ */
+void PcProf_poll(void);
+
+/*!
+ *  @brief  Print the histogram now
+ */
+void PcProf_dump(void);
+
+#else
+
+#define PcProf_init()
+#define PcProf_sample()
+#define PcProf_stop()
+#define PcProf_poll()
+#define PcProf_dump()
+
+#endif // PC_PROFILE
+
+#endif // __PC_PROF_H__
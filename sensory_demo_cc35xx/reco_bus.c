@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Recognition event bus, see reco_bus.h.
+ *
+ * The ring slots work as a sequence lock: the publisher clears the slot
+ * sequence number, writes the event and stores the new number last. A
+ * subscriber copies the event and compares the number before and after;
+ * if it changed, the publisher lapped the subscriber and the copy is
+ * discarded. There is a single publisher (the recognition loop), so gLast
+ * needs no read-modify-write.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <osi_kernel.h>
+#include "osi_timestamp.h"
+#include "osi_lockstat.h"
+#include "uart_term.h"
+#include "reco_bus.h"
+
+#define RECO_BUS_MASK       (RECO_BUS_EVENTS - 1)
+
+#if (RECO_BUS_EVENTS & RECO_BUS_MASK)
+#error "RECO_BUS_EVENTS must be a power of 2"
+#endif
+
+typedef struct
+{
+    volatile uint32_t seq;          // seq of the event in the slot, 0 while it is written
+    RecoEvent_t       event;
+} RecoBusSlot_t;
+
+typedef struct
+{
+    const char        *name;
+    RecoBusHandler_t  handler;
+    void              *arg;
+    OsiSyncObj_t      signal;
+    OsiThread_t       thread;
+    uint32_t          next;         // seq of the next event to handle
+    uint32_t          handled;
+    uint32_t          missed;
+    uint32_t          maxBacklog;   // most events waiting when the task ran
+    uint32_t          maxHandlerUs;
+} RecoBusSub_t;
+
+static RecoBusSlot_t     gRing[RECO_BUS_EVENTS];
+static volatile uint32_t gLast;         // seq of the last event published
+static RecoBusSub_t      gSub[RECO_BUS_MAX_SUBSCRIBERS];
+static volatile uint32_t gSubCount;
+static OsiSyncObj_t      gSignal;
+static OsiLockObj_t      gSubLock;      // serializes RecoBus_subscribe()
+static OsiThread_t       gThread;
+static uint8_t           gStarted;
+
+/* Copies event seq out of the ring, returns 0 if it was overwritten */
+static int readEvent(uint32_t seq, RecoEvent_t *pEvent)
+{
+    RecoBusSlot_t *slot = &gRing[seq & RECO_BUS_MASK];
+
+    if(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != seq)
+    {
+        return 0;
+    }
+    *pEvent = slot->event;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq);
+}
+
+static void *RecoBus_subscriberTask(void *pParam)
+{
+    RecoBusSub_t *sub = (RecoBusSub_t *)pParam;
+    RecoEvent_t event;
+    uint32_t last;
+    uint32_t oldest;
+    uint32_t us;
+    uint64_t start;
+
+    while(1)
+    {
+        osi_SyncObjWait(&sub->signal, OSI_WAIT_FOREVER);
+
+        last = __atomic_load_n(&gLast, __ATOMIC_ACQUIRE);
+        if((int32_t)(last - sub->next) >= 0 && (last - sub->next + 1) > sub->maxBacklog)
+        {
+            sub->maxBacklog = last - sub->next + 1;
+        }
+
+        while((int32_t)(last - sub->next) >= 0)
+        {
+            if(((last - sub->next) >= RECO_BUS_EVENTS) || !readEvent(sub->next, &event))
+            {
+                // Lapped by the publisher, go on from the oldest event still in the ring
+                last = __atomic_load_n(&gLast, __ATOMIC_ACQUIRE);
+                oldest = last - RECO_BUS_EVENTS + 1;
+                if((int32_t)(oldest - sub->next) <= 0)
+                {
+                    oldest = sub->next + 1;
+                }
+                Report("\n\revents: %s missed %d events\n\r", sub->name, oldest - sub->next);
+                sub->missed += oldest - sub->next;
+                sub->next = oldest;
+                continue;
+            }
+
+            start = OsiTs_cycles();
+            sub->handler(&event, sub->arg);
+            us = (uint32_t)OsiTs_toUs(OsiTs_cycles() - start);
+            if(us > sub->maxHandlerUs)
+            {
+                sub->maxHandlerUs = us;
+            }
+            sub->handled++;
+            sub->next++;
+            last = __atomic_load_n(&gLast, __ATOMIC_ACQUIRE);
+        }
+    }
+
+    return NULL;
+}
+
+static void *RecoBus_task(void *pParam)
+{
+    uint32_t i, count;
+
+    while(1)
+    {
+        osi_SyncObjWait(&gSignal, OSI_WAIT_FOREVER);
+
+        // Binary semaphores: several events published meanwhile give one wake up, the subscriber reads them all
+        count = __atomic_load_n(&gSubCount, __ATOMIC_ACQUIRE);
+        for(i = 0; i < count; i++)
+        {
+            osi_SyncObjSignal(&gSub[i].signal);
+        }
+    }
+
+    return NULL;
+}
+
+int RecoBus_init(void)
+{
+    if(gStarted)
+    {
+        return 0;
+    }
+    if(OSI_OK != osi_SyncObjCreate(&gSignal))
+    {
+        return -1;
+    }
+    LockStat_setName(gSignal, "RecoBus");
+    if(OSI_OK != osi_LockObjCreate(&gSubLock))
+    {
+        osi_SyncObjDelete(&gSignal);
+        return -1;
+    }
+    if(OSI_OK != osi_ThreadCreate(&gThread, "RecoBus", RECO_BUS_DISPATCH_STACK,
+                                  RECO_BUS_DISPATCH_PRIORITY, RecoBus_task, NULL))
+    {
+        osi_LockObjDelete(&gSubLock);
+        osi_SyncObjDelete(&gSignal);
+        return -1;
+    }
+    gStarted = 1;
+    return 0;
+}
+
+int RecoBus_subscribe(const char *name, uint32_t priority, uint32_t stackSize,
+                      RecoBusHandler_t handler, void *arg)
+{
+    RecoBusSub_t *sub;
+    uint32_t count;
+    int ret = -1;
+
+    if(!gStarted || (NULL == handler))
+    {
+        return -1;
+    }
+
+    osi_LockObjLock(&gSubLock, OSI_WAIT_FOREVER);
+    count = gSubCount;
+    if(count < RECO_BUS_MAX_SUBSCRIBERS)
+    {
+        sub = &gSub[count];
+        memset(sub, 0, sizeof(*sub));
+        sub->name = name;
+        sub->handler = handler;
+        sub->arg = arg;
+        sub->next = __atomic_load_n(&gLast, __ATOMIC_ACQUIRE) + 1;
+        if(OSI_OK == osi_SyncObjCreate(&sub->signal))
+        {
+            LockStat_setName(sub->signal, name);
+            if(OSI_OK == osi_ThreadCreate(&sub->thread, (char *)name, stackSize, priority,
+                                          RecoBus_subscriberTask, sub))
+            {
+                // The dispatcher only sees the subscriber once it is complete
+                __atomic_store_n(&gSubCount, count + 1, __ATOMIC_RELEASE);
+                ret = 0;
+            }
+            else
+            {
+                osi_SyncObjDelete(&sub->signal);
+            }
+        }
+    }
+    osi_LockObjUnlock(&gSubLock);
+    return ret;
+}
+
+void RecoBus_publish(RecoEvent_t *pEvent)
+{
+    uint32_t seq = gLast + 1;
+    RecoBusSlot_t *slot;
+
+    if(0 == seq)
+    {
+        seq = 1;                    // 0 marks a slot being written
+    }
+    slot = &gRing[seq & RECO_BUS_MASK];
+    pEvent->seq = seq;
+
+    __atomic_store_n(&slot->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->event = *pEvent;
+    __atomic_store_n(&slot->seq, seq, __ATOMIC_RELEASE);
+    __atomic_store_n(&gLast, seq, __ATOMIC_RELEASE);
+
+    if(gStarted)
+    {
+        osi_SyncObjSignal(&gSignal);
+    }
+}
+
+void RecoBus_dump(void)
+{
+    uint32_t i, count = __atomic_load_n(&gSubCount, __ATOMIC_ACQUIRE);
+    RecoBusSub_t *sub;
+
+    Report("\n\revents: %d published, ring of %d", gLast, RECO_BUS_EVENTS);
+    Report("\n\r  %-12s %8s %8s %8s %10s", "subscriber", "handled", "missed", "backlog", "max us");
+    for(i = 0; i < count; i++)
+    {
+        sub = &gSub[i];
+        Report("\n\r  %-12s %8d %8d %8d %10d", sub->name, sub->handled, sub->missed,
+               sub->maxBacklog, sub->maxHandlerUs);
+    }
+    Report("\n\r");
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __RECO_BUS_H__
+#define __RECO_BUS_H__
+
+#include <stdint.h>
+
+/*
+ * Recognition event bus
+ *
+ * The recognition loop publishes what it recognized as RecoEvent_t records
+ * and goes back to the audio; what to do about them (LEDs, console output,
+ * the application, the radio) is up to the subscribers, each running in its
+ * own task at its own priority.
+ *
+ * RecoBus_publish() writes the record into a ring of RECO_BUS_EVENTS slots
+ * and signals the dispatcher task, which wakes the subscribers. The
+ * publisher never waits and its cost does not depend on the number of
+ * subscribers. Every subscriber reads the ring with its own cursor; a
+ * subscriber that falls more than RECO_BUS_EVENTS events behind misses
+ * the oldest ones. RecoBus_dump() (console command "events") prints, per
+ * subscriber, the events handled and missed, the largest backlog and the
+ * longest handler run, so slow consumers show up before they miss events.
+ */
+#ifndef RECO_BUS_EVENTS
+#define RECO_BUS_EVENTS             16          // power of 2
+#endif
+#ifndef RECO_BUS_MAX_SUBSCRIBERS
+#define RECO_BUS_MAX_SUBSCRIBERS    6
+#endif
+#ifndef RECO_BUS_DISPATCH_PRIORITY
+#define RECO_BUS_DISPATCH_PRIORITY  4           // below the recognizer, above the subscribers
+#endif
+#define RECO_BUS_DISPATCH_STACK     768
+
+/* Event types */
+#define RECO_EV_WAKE                1           // wake word, the command model is loaded
+#define RECO_EV_COMMAND             2           // command, back to the wake word model
+#define RECO_EV_NO_COMMAND          3           // no command within the command window
+#define RECO_EV_TIMEOUT             4           // recognizer command timeout (ERR_DATACOL_TIMEOUT)
+#define RECO_EV_ERROR               5           // recognizer error, see error; the loop stops
+
+typedef struct {
+    uint32_t seq;                   // event number, from 1
+    uint8_t  type;                  // RECO_EV_*
+    uint8_t  reserved;
+    uint16_t wordID;                // index in the phrase table of the model
+    uint16_t finalScore;
+    uint16_t error;                 // errors_t
+    int32_t  nnpqScore;
+    uint32_t brickStart;            // bricks of the utterance
+    uint32_t brickEnd;
+    uint32_t brickCount;            // current brick
+    uint32_t processUs;             // SensoryProcessData() time for the last brick
+    uint64_t brickTime;             // capture time of the last brick, OsiTs_cycles()
+    uint64_t time;                  // when it was recognized
+} RecoEvent_t;
+
+/*!
+ *  @brief  Called in the subscriber task for each event, in order
+ */
+typedef void (*RecoBusHandler_t)(const RecoEvent_t *pEvent, void *arg);
+
+/*!
+ *  @brief  Start the dispatcher task, call before the first publish or subscribe
+ *
+ *  @return  0 - upon success, -1 upon error
+ */
+int RecoBus_init(void);
+
+/*!
+ *  @brief  Add a subscriber with its own task, it receives the events published from now on
+ *
+ *  @param[in] name         name of the task and in RecoBus_dump()
+ *  @param[in] priority     task priority, below the recognizer
+ *  @param[in] stackSize    task stack in bytes
+ *  @param[in] handler      called for each event
+ *  @param[in] arg          passed to the handler
+ *
+ *  @return  0 - upon success, -1 upon error
+ */
+int RecoBus_subscribe(const char *name, uint32_t priority, uint32_t stackSize,
+                      RecoBusHandler_t handler, void *arg);
+
+/*!
+ *  @brief  Publish an event, never blocks; seq is filled in
+ *
+ *  Called from one task only, the recognition loop.
+ */
+void RecoBus_publish(RecoEvent_t *pEvent);
+
+/*!
+ *  @brief  Print the per subscriber counters
+ */
+void RecoBus_dump(void);
+
+#endif // __RECO_BUS_H__
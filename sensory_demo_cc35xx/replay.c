@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== replay.c ========
+ *  Offline replay of recorded audio through the recognizer, used to tune
+ *  paramAOffset and the NNPQ threshold against a labelled corpus.
+ *  Replaces the microphone demo's mainThread when SENSORY_REPLAY is defined.
+ */
+#ifdef SENSORY_REPLAY
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <ti/drivers/UART2.h>
+#include <ti/drivers/dpl/ClockP.h>
+#include "ti_drivers_config.h"
+
+#include "sensorytypes.h"
+#include "sensorylib.h"
+#include "SensoryDemoHelper.h"
+#include "common.h"
+
+#include "osi_kernel.h"
+#include "osi_timestamp.h"
+#include "uart_term.h"
+#include "replay.h"
+#include "score_capture.h"
+
+#include <wakeword-pc60-6.1.0-op08-prod-search-genie.h>
+#include <command-pc62-6.1.0-op10-prod-search-new-genie.h>
+
+#define REPLAY_PATH_LEN         256
+
+typedef enum { REPLAY_SRC_FILE, REPLAY_SRC_STREAM, REPLAY_SRC_UART } ReplaySourceType_e;
+
+typedef struct {
+    ReplaySourceType_e  type;
+    audioData           audio;          // REPLAY_SRC_FILE
+    FILE               *stream;         // REPLAY_SRC_STREAM
+    UART2_Handle        uart;           // REPLAY_SRC_UART
+} ReplaySource_t;
+
+typedef struct {
+    t2siStruct          t;
+    ScoreCaptureLane_t  cfg;
+    BOOL                shared;         // fed by lane 0 through SensoryProcessFeatures
+    uint32_t            candidates;
+    uint32_t            detections;
+} ReplayLane_t;
+
+static const ScoreCaptureLane_t gLaneCfg[] = REPLAY_LANES;
+#define REPLAY_NUM_LANES    (sizeof(gLaneCfg) / sizeof(gLaneCfg[0]))
+
+static ReplayLane_t gLanes[REPLAY_NUM_LANES];
+static RecoResult  *gResults[REPLAY_NUM_LANES];
+static SAMPLE       gBrick[FRAME_LEN];
+static BOOL         gShareFeatures = FALSE;
+static uint64_t     gProcessCycles = 0;
+static uint32_t     gProcessBricks = 0;
+
+/* from wakeword.c, keeps the replay recognizer configured like the demo */
+extern BOOL setupAppStruct(t2siStruct *t);
+/* from librdimon, connects stdio to the debugger */
+extern void initialise_monitor_handles(void);
+
+static ReplaySourceType_e sourceType(const char *path)
+{
+    if (strncmp(path, REPLAY_STREAM_PREFIX, sizeof(REPLAY_STREAM_PREFIX) - 1) == 0)
+    {
+        return REPLAY_SRC_STREAM;
+    }
+    if (strncmp(path, REPLAY_UART_PREFIX, sizeof(REPLAY_UART_PREFIX) - 1) == 0)
+    {
+        return REPLAY_SRC_UART;
+    }
+    return REPLAY_SRC_FILE;
+}
+
+static BOOL sourceOpen(ReplaySource_t *src, const char *path)
+{
+    UART2_Params uartParams;
+
+    memset(src, 0, sizeof(ReplaySource_t));
+    src->type = sourceType(path);
+
+    switch (src->type)
+    {
+        case REPLAY_SRC_STREAM:
+            /* Pipes have no length, read until the writer closes */
+            src->stream = fopen(path + sizeof(REPLAY_STREAM_PREFIX) - 1, "rb");
+            return (src->stream != NULL);
+
+        case REPLAY_SRC_UART:
+            UART2_Params_init(&uartParams);
+            uartParams.baudRate = REPLAY_UART_BAUD;
+            uartParams.readMode = UART2_Mode_BLOCKING;
+            uartParams.readReturnMode = UART2_ReadReturnMode_FULL;
+            src->uart = UART2_open(REPLAY_UART_INDEX, &uartParams);
+            if (src->uart == NULL)
+            {
+                UART_PRINT("\rCannot open the replay UART\r\n");
+            }
+            return (src->uart != NULL);
+
+        default:
+            return openAudioFile(path, &src->audio);
+    }
+}
+
+/* Fill one brick, FALSE at the end of the source. A partial last brick is zero padded. */
+static BOOL sourceRead(ReplaySource_t *src, SAMPLE *brick)
+{
+    size_t count = 0;
+
+    switch (src->type)
+    {
+        case REPLAY_SRC_STREAM:
+            count = fread(brick, sizeof(SAMPLE), FRAME_LEN, src->stream) * sizeof(SAMPLE);
+            break;
+
+        case REPLAY_SRC_UART:
+            /* The stream ends when the sender has been quiet for REPLAY_UART_IDLE_MS */
+            UART2_readTimeout(src->uart, brick, FRAME_LEN * sizeof(SAMPLE), &count,
+                              REPLAY_UART_IDLE_MS * 1000 / ClockP_getSystemTickPeriod());
+            break;
+
+        default:
+            return getAudio(&src->audio, brick, FRAME_LEN);
+    }
+
+    if (count == 0)
+    {
+        return FALSE;
+    }
+    if (count < FRAME_LEN * sizeof(SAMPLE))
+    {
+        memset((uint8_t *)brick + count, 0, FRAME_LEN * sizeof(SAMPLE) - count);
+    }
+    return TRUE;
+}
+
+static void sourceClose(ReplaySource_t *src)
+{
+    switch (src->type)
+    {
+        case REPLAY_SRC_STREAM:
+            fclose(src->stream);
+            break;
+
+        case REPLAY_SRC_UART:
+            UART2_close(src->uart);
+            break;
+
+        default:
+            fclose(src->audio.file);
+            break;
+    }
+}
+
+static void laneModel(const ReplayLane_t *lane, void **net, void **gram)
+{
+    if (lane->cfg.model == SCAP_MODEL_COMMAND)
+    {
+        *net = (void *) dnn_en_command_netLabel;
+        *gram = (void *) gs_en_command_grammarLabel;
+    }
+    else
+    {
+        *net = (void *) dnn_wakeword_netLabel;
+        *gram = (void *) gs_wakeword_grammarLabel;
+    }
+}
+
+static int laneInit(ReplayLane_t *lane, const ScoreCaptureLane_t *cfg)
+{
+    void *net, *gram;
+
+    setupAppStruct(&lane->t);
+    /* Each lane needs its own audio buffer, let the library take it out of the SPP */
+    lane->t.audioBuffer = NULL;
+    lane->t.paramAOffset = cfg->paramAOffset;
+    lane->cfg = *cfg;
+    lane->candidates = 0;
+    lane->detections = 0;
+
+    laneModel(lane, &net, &gram);
+    return initProcess(&lane->t, net, gram) ? 0 : -1;
+}
+
+/*
+ * Lanes other than lane 0 reuse the front-end features of lane 0 when the
+ * models allow it. The connection does not survive SensoryProcessInit, so
+ * it is made again after every restart of either side.
+ */
+static void laneConnect(uint8_t idx)
+{
+    ReplayLane_t *lane = &gLanes[idx];
+
+    lane->shared = FALSE;
+    if (gShareFeatures && (idx > 0) && SensoryFeatureCompatible(&gLanes[0].t, &lane->t))
+    {
+        lane->shared = (SensoryConnectFeatures(&gLanes[0].t, &lane->t) == ERR_OK);
+    }
+}
+
+static int laneRestart(uint8_t idx)
+{
+    ReplayLane_t *lane = &gLanes[idx];
+    void *net, *gram;
+    uint8_t i;
+
+    laneModel(lane, &net, &gram);
+    lane->t.net = (intptr_t) net;
+    lane->t.gram = (intptr_t) gram;
+    if (SensoryProcessInit(&lane->t) != ERR_OK)
+    {
+        return -1;
+    }
+
+    if (idx > 0)
+    {
+        laneConnect(idx);
+    }
+    else
+    {
+        for (i = 1; i < REPLAY_NUM_LANES; i++)
+        {
+            laneConnect(i);
+        }
+    }
+    return 0;
+}
+
+/* Run every lane on gBrick, the feature producer (lane 0) first */
+static void lanesProcess(void)
+{
+    uint32_t start = OSI_TS_CYCCNT;
+    uint8_t i;
+
+    for (i = 0; i < REPLAY_NUM_LANES; i++)
+    {
+        if (gLanes[i].shared)
+        {
+            gResults[i] = SensoryProcessFeatures(&gLanes[i].t);
+        }
+        else
+        {
+            gResults[i] = SensoryProcessData(&gLanes[i].t, gBrick);
+        }
+    }
+
+    gProcessCycles += (uint32_t)(OSI_TS_CYCCNT - start);
+    gProcessBricks++;
+}
+
+static int lanesRestart(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < REPLAY_NUM_LANES; i++)
+    {
+        if (laneRestart(i) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Returns -1 when the run can not continue (license limit or init failure) */
+static int laneResult(uint8_t idx, RecoResult *r, uint32_t fileBrick)
+{
+    ReplayLane_t *lane = &gLanes[idx];
+
+    if (r->wordID && ((r->nnpqScore > 0) || (r->error == ERR_OK)))
+    {
+        lane->candidates++;
+        ScoreCapture_add(idx, r, fileBrick);
+    }
+
+    if (r->error == ERR_NOT_FINISHED)
+    {
+        return 0;
+    }
+
+    if (r->error == ERR_LICENSE)
+    {
+        UART_PRINT("\rSensory Lib license error!\r\n");
+        return -1;
+    }
+
+    if (r->error == ERR_OK)
+    {
+        lane->detections++;
+    }
+    else if (r->error != ERR_DATACOL_TIMEOUT)
+    {
+        UART_PRINT("\rLane %d: SensoryProcessData returned error code 0x%x\r\n", idx, r->error);
+    }
+
+    /* Same as the demo: every detection or timeout starts a fresh search */
+    return laneRestart(idx);
+}
+
+static int replayFile(uint32_t fileIdx, const char *path)
+{
+    ReplaySource_t src;
+    uint32_t  fileBrick = 0;
+    uint32_t  padBricks = REPLAY_TAIL_PAD_MS / FRAME_LEN_MS;
+    uint8_t   i;
+    int       status = 0;
+
+    if (!sourceOpen(&src, path))
+    {
+        return 0;   // skip unreadable files, the sweep only counts replayed ones
+    }
+
+    ScoreCapture_beginFile(fileIdx, path);
+
+    status = lanesRestart();
+
+    while (status == 0)
+    {
+        if (!sourceRead(&src, gBrick))
+        {
+            if (padBricks == 0)
+            {
+                break;
+            }
+            padBricks--;
+            memset(gBrick, 0, sizeof(gBrick));
+        }
+        fileBrick++;
+
+        /* All lanes consume the brick before any of them is restarted */
+        lanesProcess();
+        for (i = 0; (i < REPLAY_NUM_LANES) && (status == 0); i++)
+        {
+            status = laneResult(i, gResults[i], fileBrick);
+        }
+    }
+
+    sourceClose(&src);
+    ScoreCapture_endFile(fileBrick);
+    return status;
+}
+
+/*
+ * Feed the start of the first file through the lanes twice, once with every
+ * lane extracting its own features and once sharing the features of lane 0,
+ * and report the per brick cost of both. Results of these passes are dropped.
+ */
+static void replaySpeedup(const char *path)
+{
+    ReplaySource_t src;
+    uint64_t  cycles[2];
+    uint32_t  bricks = 0;
+    uint32_t  shared = 0;
+    uint8_t   pass, i;
+
+    for (pass = 0; pass < 2; pass++)
+    {
+        if (!sourceOpen(&src, path))
+        {
+            return;
+        }
+        gShareFeatures = (pass == 1);
+        gProcessCycles = 0;
+        gProcessBricks = 0;
+        if (lanesRestart() != 0)
+        {
+            sourceClose(&src);
+            return;
+        }
+        while ((gProcessBricks < REPLAY_SPEEDUP_BRICKS) && sourceRead(&src, gBrick))
+        {
+            lanesProcess();
+        }
+        sourceClose(&src);
+        cycles[pass] = gProcessCycles;
+        bricks = gProcessBricks;
+    }
+
+    for (i = 1; i < REPLAY_NUM_LANES; i++)
+    {
+        shared += gLanes[i].shared;
+    }
+
+    if (bricks && cycles[1])
+    {
+        UART_PRINT("\r%d lanes, %d sharing features: independent %d cycles/brick, shared %d cycles/brick, speedup x%d.%02d\r\n",
+                   REPLAY_NUM_LANES, shared, (uint32_t)(cycles[0] / bricks), (uint32_t)(cycles[1] / bricks),
+                   (uint32_t)(cycles[0] / cycles[1]), (uint32_t)((cycles[0] * 100 / cycles[1]) % 100));
+    }
+}
+
+int Replay_run(const char *listFile, const char *captureFile)
+{
+    char     path[REPLAY_PATH_LEN];
+    FILE    *list;
+    uint32_t fileIdx = 0;
+    uint32_t startTick;
+    uint8_t  i;
+    int      status = 0;
+
+    list = fopen(listFile, "r");
+    if (list == NULL)
+    {
+        UART_PRINT("\rCannot open replay list '%s'\r\n", listFile);
+        return -1;
+    }
+
+    for (i = 0; i < REPLAY_NUM_LANES; i++)
+    {
+        if (laneInit(&gLanes[i], &gLaneCfg[i]) != 0)
+        {
+            UART_PRINT("\rLane %d: recognizer init failed\r\n", i);
+            fclose(list);
+            return -1;
+        }
+    }
+
+    if (ScoreCapture_open(captureFile, gLaneCfg, REPLAY_NUM_LANES) != 0)
+    {
+        UART_PRINT("\rCannot create capture file '%s'\r\n", captureFile);
+        fclose(list);
+        return -1;
+    }
+
+    OsiTs_init();
+
+    startTick = xTaskGetTickCount();
+    while ((status == 0) && fgets(path, sizeof(path), list))
+    {
+        path[strcspn(path, "\r\n")] = '\0';
+        if ((path[0] == '\0') || (path[0] == '#'))
+        {
+            continue;
+        }
+        /* Streams can not be read twice, measure the speedup on files only */
+        if ((fileIdx == 0) && REPLAY_SHARE_FEATURES && (REPLAY_NUM_LANES > 1) &&
+            (sourceType(path) == REPLAY_SRC_FILE))
+        {
+            replaySpeedup(path);
+            gProcessCycles = 0;
+            gProcessBricks = 0;
+        }
+        gShareFeatures = REPLAY_SHARE_FEATURES;
+        status = replayFile(fileIdx, path);
+        if (status != 0)
+        {
+            UART_PRINT("\rReplay stopped at file #%d '%s'\r\n", fileIdx, path);
+        }
+        fileIdx++;
+    }
+    fclose(list);
+
+    UART_PRINT("\rReplayed %d files in %d ms, %d candidates captured\r\n",
+               fileIdx, (xTaskGetTickCount() - startTick) * 1000 / configTICK_RATE_HZ,
+               ScoreCapture_close());
+    if (gProcessBricks)
+    {
+        UART_PRINT("\rRecognizers: %d cycles/brick for %d lanes\r\n",
+                   (uint32_t)(gProcessCycles / gProcessBricks), REPLAY_NUM_LANES);
+    }
+    for (i = 0; i < REPLAY_NUM_LANES; i++)
+    {
+        UART_PRINT("\r  lane %d: model %d offset %d%s: %d candidates, %d detections\r\n", i,
+                   gLanes[i].cfg.model, gLanes[i].cfg.paramAOffset,
+                   gLanes[i].shared ? " (shared features)" : "",
+                   gLanes[i].candidates, gLanes[i].detections);
+    }
+    return status;
+}
+
+void *mainThread(void *args)
+{
+    initialise_monitor_handles();
+    InitTerm();
+
+    UART_PRINT("\rStarting replay of '%s'\r\n", REPLAY_LIST_FILE);
+    Replay_run(REPLAY_LIST_FILE, REPLAY_CAPTURE_FILE);
+
+    return NULL;
+}
+
+#endif // SENSORY_REPLAY
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __REPLAY_H__
+#define __REPLAY_H__
+
+#include <stdint.h>
+#include "score_capture.h"
+
+/*
+ * Replay harness (build with SENSORY_REPLAY defined)
+ *
+ * Feeds recorded 16 kHz / 16-bit mono files (.raw or .wav) through one or more
+ * recognizer "lanes" instead of the I2S microphone and logs every candidate
+ * detection to a score capture file. Files are accessed on the host through
+ * semihosting, so the replay build must be linked with --specs=rdimon.specs.
+ *
+ * All lanes see the same audio in lockstep; giving each lane a different
+ * paramAOffset or model evaluates them all in a single pass over the corpus.
+ */
+#ifndef REPLAY_LIST_FILE
+#define REPLAY_LIST_FILE        "replay_list.txt"      // one audio file per line
+#endif
+#ifndef REPLAY_CAPTURE_FILE
+#define REPLAY_CAPTURE_FILE     "replay_scores.scap"
+#endif
+/*
+ * Besides file names the list accepts two streaming sources, so long generated
+ * workloads (tools/workload_gen.py) never have to be stored as files:
+ *  "stream:<path>"  raw PCM read until end of file, e.g. from a named pipe
+ *  "uart:"          raw PCM received on REPLAY_UART_INDEX until the sender is
+ *                   quiet for REPLAY_UART_IDLE_MS
+ */
+#define REPLAY_STREAM_PREFIX    "stream:"
+#define REPLAY_UART_PREFIX      "uart:"
+#ifndef REPLAY_UART_INDEX
+#define REPLAY_UART_INDEX       CONFIG_UART2_1
+#endif
+#ifndef REPLAY_UART_BAUD
+#define REPLAY_UART_BAUD        921600
+#endif
+#ifndef REPLAY_UART_IDLE_MS
+#define REPLAY_UART_IDLE_MS     2000
+#endif
+#ifndef REPLAY_TAIL_PAD_MS
+#define REPLAY_TAIL_PAD_MS      1000                   // silence fed after each file
+#endif
+
+/*
+ * With REPLAY_SHARE_FEATURES set, lane 0 extracts the front-end features and
+ * every compatible lane runs SensoryProcessFeatures on them instead of
+ * processing the audio again. The start of the first file is then also run
+ * both ways to report the speedup over independent lanes.
+ */
+#ifndef REPLAY_SHARE_FEATURES
+#define REPLAY_SHARE_FEATURES   1
+#endif
+#ifndef REPLAY_SPEEDUP_BRICKS
+#define REPLAY_SPEEDUP_BRICKS   2000                   // 30 s of audio
+#endif
+
+/* Lane table: { model, paramAOffset }, at most SCAP_MAX_LANES entries */
+#ifndef REPLAY_LANES
+#define REPLAY_LANES                    \
+    {                                   \
+        { SCAP_MODEL_WAKE,    0 },      \
+        { SCAP_MODEL_COMMAND, 0 },      \
+    }
+#endif
+
+/*!
+ *  @brief  Replay every file of a list through the lane table
+ *
+ *  @param[in] listFile     text file with one audio path per line,
+ *                          empty lines and lines starting with '#' are skipped
+ *  @param[in] captureFile  score capture file to create
+ *
+ *  @return  0 - upon success, -1 upon error
+ */
+int Replay_run(const char *listFile, const char *captureFile);
+
+#endif // __REPLAY_H__
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== score_capture.c ========
+ *  Column oriented log of every candidate detection seen during a replay run,
+ *  so NNPQ threshold settings can be evaluated offline.
+ */
+#ifdef SENSORY_REPLAY
+
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "score_capture.h"
+
+typedef struct {
+    uint32_t fileIdx[SCAP_CHUNK_ROWS];
+    int32_t  nnpqScore[SCAP_CHUNK_ROWS];
+    int32_t  stage3Score[SCAP_CHUNK_ROWS];
+    uint32_t brickStart[SCAP_CHUNK_ROWS];
+    uint32_t brickEnd[SCAP_CHUNK_ROWS];
+    uint32_t brickNow[SCAP_CHUNK_ROWS];
+    uint16_t wordID[SCAP_CHUNK_ROWS];
+    uint16_t finalScore[SCAP_CHUNK_ROWS];
+    uint16_t garbageScore[SCAP_CHUNK_ROWS];
+    uint16_t nnpqThreshold[SCAP_CHUNK_ROWS];
+    int16_t  nnpqPass[SCAP_CHUNK_ROWS];
+    uint8_t  lane[SCAP_CHUNK_ROWS];
+    uint8_t  accepted[SCAP_CHUNK_ROWS];
+} ScoreChunk_t;
+
+#define SCAP_COLUMN_NAME_LEN    16
+
+typedef struct {
+    char     name[SCAP_COLUMN_NAME_LEN];
+    char     code;              // python struct format character
+    uint8_t  size;
+    uint16_t offset;            // offset of the column in ScoreChunk_t
+} ScoreColumn_t;
+
+#define SCAP_COLUMN(_name, _code, _field) \
+    { _name, _code, sizeof(((ScoreChunk_t *)0)->_field[0]), offsetof(ScoreChunk_t, _field) }
+
+static const ScoreColumn_t gColumns[] =
+{
+    SCAP_COLUMN("file",          'I', fileIdx),
+    SCAP_COLUMN("lane",          'B', lane),
+    SCAP_COLUMN("accepted",      'B', accepted),
+    SCAP_COLUMN("wordID",        'H', wordID),
+    SCAP_COLUMN("finalScore",    'H', finalScore),
+    SCAP_COLUMN("garbageScore",  'H', garbageScore),
+    SCAP_COLUMN("nnpqScore",     'i', nnpqScore),
+    SCAP_COLUMN("nnpqThreshold", 'H', nnpqThreshold),
+    SCAP_COLUMN("nnpqPass",      'h', nnpqPass),
+    SCAP_COLUMN("stage3Score",   'i', stage3Score),
+    SCAP_COLUMN("brickStart",    'I', brickStart),
+    SCAP_COLUMN("brickEnd",      'I', brickEnd),
+    SCAP_COLUMN("brickNow",      'I', brickNow),
+};
+#define SCAP_NUM_COLUMNS    (sizeof(gColumns) / sizeof(gColumns[0]))
+
+static FILE        *gCapFile = NULL;
+static ScoreChunk_t gChunk;
+static uint16_t     gChunkRows = 0;
+static uint32_t     gFileIdx = 0;
+static uint32_t     gTotalRows = 0;
+
+static void writeRecord(const char tag[4], uint32_t len, const void *payload)
+{
+    fwrite(tag, 1, 4, gCapFile);
+    fwrite(&len, sizeof(len), 1, gCapFile);
+    if (len)
+    {
+        fwrite(payload, 1, len, gCapFile);
+    }
+}
+
+static void flushChunk(void)
+{
+    uint32_t len = sizeof(uint16_t);
+    uint32_t c;
+
+    if (gChunkRows == 0)
+    {
+        return;
+    }
+
+    for (c = 0; c < SCAP_NUM_COLUMNS; c++)
+    {
+        len += gColumns[c].size * gChunkRows;
+    }
+
+    fwrite("SCCH", 1, 4, gCapFile);
+    fwrite(&len, sizeof(len), 1, gCapFile);
+    fwrite(&gChunkRows, sizeof(gChunkRows), 1, gCapFile);
+    for (c = 0; c < SCAP_NUM_COLUMNS; c++)
+    {
+        fwrite((uint8_t *)&gChunk + gColumns[c].offset, gColumns[c].size, gChunkRows, gCapFile);
+    }
+    gChunkRows = 0;
+}
+
+int ScoreCapture_open(const char *fileName, const ScoreCaptureLane_t *lanes, uint8_t numLanes)
+{
+    /* version, column count, lane count, columns (name + code), lanes (model + offset) */
+    uint8_t  header[4 + SCAP_NUM_COLUMNS * (SCAP_COLUMN_NAME_LEN + 1) + SCAP_MAX_LANES * 3];
+    uint32_t pos = 0;
+    uint32_t i;
+
+    if ((numLanes == 0) || (numLanes > SCAP_MAX_LANES))
+    {
+        return -1;
+    }
+
+    gCapFile = fopen(fileName, "wb");
+    if (gCapFile == NULL)
+    {
+        return -1;
+    }
+
+    header[pos++] = SCAP_VERSION;
+    header[pos++] = 0;
+    header[pos++] = SCAP_NUM_COLUMNS;
+    header[pos++] = numLanes;
+    for (i = 0; i < SCAP_NUM_COLUMNS; i++)
+    {
+        memcpy(&header[pos], gColumns[i].name, SCAP_COLUMN_NAME_LEN);
+        pos += SCAP_COLUMN_NAME_LEN;
+        header[pos++] = (uint8_t)gColumns[i].code;
+    }
+    for (i = 0; i < numLanes; i++)
+    {
+        header[pos++] = lanes[i].model;
+        header[pos++] = (uint8_t)(lanes[i].paramAOffset & 0xFF);
+        header[pos++] = (uint8_t)((uint16_t)lanes[i].paramAOffset >> 8);
+    }
+    writeRecord("SCAP", pos, header);
+
+    gChunkRows = 0;
+    gTotalRows = 0;
+    return 0;
+}
+
+void ScoreCapture_beginFile(uint32_t fileIdx, const char *name)
+{
+    uint8_t  payload[4 + 128];
+    uint32_t nameLen = strlen(name);
+
+    if (gCapFile == NULL)
+    {
+        return;
+    }
+
+    if (nameLen > sizeof(payload) - 4)
+    {
+        /* keep the tail, it holds the part that tells files apart */
+        name += nameLen - (sizeof(payload) - 4);
+        nameLen = sizeof(payload) - 4;
+    }
+
+    flushChunk();
+    gFileIdx = fileIdx;
+    memcpy(payload, &fileIdx, 4);
+    memcpy(&payload[4], name, nameLen);
+    writeRecord("SCFN", 4 + nameLen, payload);
+}
+
+void ScoreCapture_add(uint8_t lane, const RecoResult *r, uint32_t fileBrick)
+{
+    uint16_t row = gChunkRows;
+    uint32_t now = (uint32_t)r->brickCount;
+
+    if (gCapFile == NULL)
+    {
+        return;
+    }
+
+    gChunk.fileIdx[row]       = gFileIdx;
+    gChunk.lane[row]          = lane;
+    gChunk.accepted[row]      = (r->error == ERR_OK);
+    gChunk.wordID[row]        = r->wordID;
+    gChunk.finalScore[row]    = r->finalScore;
+    gChunk.garbageScore[row]  = r->garbageScore;
+    gChunk.nnpqScore[row]     = r->nnpqScore;
+    gChunk.nnpqThreshold[row] = r->nnpqThreshold;
+    gChunk.nnpqPass[row]      = r->nnpqPass;
+    gChunk.stage3Score[row]   = r->stage3Score;
+    /* The recognizer counts bricks since its last init, rebase on the file */
+    gChunk.brickStart[row]    = fileBrick - (now - (uint32_t)r->brickStart);
+    gChunk.brickEnd[row]      = fileBrick - (now - (uint32_t)r->brickEnd);
+    gChunk.brickNow[row]      = fileBrick;
+
+    gTotalRows++;
+    if (++gChunkRows == SCAP_CHUNK_ROWS)
+    {
+        flushChunk();
+    }
+}
+
+void ScoreCapture_endFile(uint32_t numBricks)
+{
+    uint32_t payload[2];
+
+    if (gCapFile == NULL)
+    {
+        return;
+    }
+
+    flushChunk();
+    payload[0] = gFileIdx;
+    payload[1] = numBricks;
+    writeRecord("SCFE", sizeof(payload), payload);
+}
+
+uint32_t ScoreCapture_close(void)
+{
+    if (gCapFile != NULL)
+    {
+        flushChunk();
+        fclose(gCapFile);
+        gCapFile = NULL;
+    }
+    return gTotalRows;
+}
+
+#endif // SENSORY_REPLAY
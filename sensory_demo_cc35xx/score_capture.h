@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SCORE_CAPTURE_H__
+#define __SCORE_CAPTURE_H__
+
+#include <stdint.h>
+#include "sensorylib.h"
+
+/*
+ * Score capture file (.scap)
+ *
+ * A little-endian stream of tagged records, each "TAG" (4 chars) + u32 length
+ * followed by the payload:
+ *
+ *  "SCAP"  version, column descriptors (name + python struct code) and the
+ *          lane table (model, paramAOffset) of the replay run
+ *  "SCFN"  u32 file index + file name, emitted when a replay file starts
+ *  "SCCH"  u16 row count followed by every column stored contiguously
+ *  "SCFE"  u32 file index + u32 number of bricks fed, emitted at end of file
+ *
+ * tools/score_sweep.py reads this format.
+ */
+#define SCAP_VERSION            1
+#define SCAP_CHUNK_ROWS         128
+#define SCAP_MAX_LANES          8
+
+typedef enum { SCAP_MODEL_WAKE = 1, SCAP_MODEL_COMMAND = 2 } ScoreCaptureModel_e;
+
+typedef struct {
+    uint8_t  model;             // ScoreCaptureModel_e
+    int16_t  paramAOffset;
+} ScoreCaptureLane_t;
+
+/*!
+ *  @brief  Create the capture file and write the header record
+ *
+ *  @param[in] fileName     path of the capture file (host path when semihosted)
+ *  @param[in] lanes        lane table of the replay run
+ *  @param[in] numLanes     number of entries in lanes, up to SCAP_MAX_LANES
+ *
+ *  @return  0 - upon success, -1 upon error
+ */
+int ScoreCapture_open(const char *fileName, const ScoreCaptureLane_t *lanes, uint8_t numLanes);
+
+/*!
+ *  @brief  Mark the start of a replay file; following rows refer to it
+ */
+void ScoreCapture_beginFile(uint32_t fileIdx, const char *name);
+
+/*!
+ *  @brief  Append one candidate detection
+ *
+ *  @param[in] lane         lane index in the table given to ScoreCapture_open()
+ *  @param[in] r            result returned by the recognizer
+ *  @param[in] fileBrick    bricks fed for the current file, including this one
+ *
+ *  Brick indices of the result are rebased on fileBrick so they are relative
+ *  to the start of the file even if the lane was re-initialized in between.
+ */
+void ScoreCapture_add(uint8_t lane, const RecoResult *r, uint32_t fileBrick);
+
+/*!
+ *  @brief  Mark the end of the current replay file
+ */
+void ScoreCapture_endFile(uint32_t numBricks);
+
+/*!
+ *  @brief  Flush pending rows and close the capture file
+ *
+ *  @return  number of rows written
+ */
+uint32_t ScoreCapture_close(void);
+
+#endif // __SCORE_CAPTURE_H__
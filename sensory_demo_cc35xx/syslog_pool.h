@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SYSLOG_POOL_H__
+#define __SYSLOG_POOL_H__
+
+#include <stdint.h>
+#include "syslog.h"
+
+//Defines
+
+/*
+ * syslog()/vsyslog() format into one of SYSLOG_POOL_SLOTS static buffers
+ * instead of the heap. Longer messages are truncated; a message that finds
+ * every slot busy is dropped. Both are counted, see syslog_getStats().
+ */
+#ifndef SYSLOG_POOL_SLOTS
+#define SYSLOG_POOL_SLOTS       4           // at most 32
+#endif
+#ifndef SYSLOG_SLOT_SIZE
+#define SYSLOG_SLOT_SIZE        256         // bytes per message, including the line break
+#endif
+
+/*
+ * Least important priority that is logged. syslog() is still called for
+ * messages above it, but returns before any formatting; the runtime mask
+ * (setlogmask) can only narrow it.
+ */
+#ifndef SYSLOG_LEVEL
+#define SYSLOG_LEVEL            LOG_DEBUG
+#endif
+
+#ifndef LOG_PRIMASK
+#define LOG_PRIMASK             0x07
+#endif
+#ifndef LOG_PRI
+#define LOG_PRI(p)              ((p) & LOG_PRIMASK)
+#endif
+#ifndef LOG_MASK
+#define LOG_MASK(pri)           (1 << (pri))
+#endif
+#ifndef LOG_UPTO
+#define LOG_UPTO(pri)           ((1 << ((pri) + 1)) - 1)
+#endif
+
+typedef struct {
+    uint32_t messages;          // messages written
+    uint32_t truncated;         // written but cut at SYSLOG_SLOT_SIZE
+    uint32_t overflow;          // dropped, no free slot
+    uint32_t filtered;          // dropped by the runtime mask
+} SyslogStats_t;
+
+/*!
+ *  @brief  Set the priorities that are logged, e.g. setlogmask(LOG_UPTO(LOG_WARNING))
+ *
+ *  @return  the previous mask, a mask of 0 only reads it
+ */
+int setlogmask(int mask);
+
+void syslog_getStats(SyslogStats_t *stats);
+
+#endif // __SYSLOG_POOL_H__
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Deferred binary trace logging, see trace_log.h.
+ *
+ * Console format, one record per line (hex, no separators):
+ *     #TL=<clockHz>                      stream header
+ *     #TL:<seq><fmt><time><arg>...       record, one word per argument
+ *     #TL!<count>                        records overwritten before they were sent
+ */
+
+#ifdef TRACE_LOG
+
+#include <stdint.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "osi_kernel.h"
+#include "uart_log.h"
+#include "osi_timestamp.h"
+#include "trace_log.h"
+
+#define TRACE_LOG_TASK_PRIORITY     1
+#define TRACE_LOG_TASK_STACK_SIZE   1024
+#define TRACE_LOG_LINE_LEN          (4 + 8 * (3 + TRACE_LOG_MAX_ARGS) + 2)
+
+#if (TRACE_LOG_SLOTS & (TRACE_LOG_SLOTS - 1))
+#error "TRACE_LOG_SLOTS must be a power of 2"
+#endif
+
+TraceLog_t gTraceLog = { .magic = TRACE_LOG_MAGIC, .slots = TRACE_LOG_SLOTS, .clockHz = configCPU_CLOCK_HZ };
+
+static uint32_t    gFlushed;           // records already sent
+static OsiThread_t gThread;
+
+static char *putHex(char *p, uint32_t v)
+{
+    static const char hex[] = "0123456789abcdef";
+    int i;
+
+    for(i = 28; i >= 0; i -= 4)
+    {
+        *p++ = hex[(v >> i) & 0xF];
+    }
+    return p;
+}
+
+static void sendLine(char tag, uint32_t v)
+{
+    char line[4 + 8 + 2];
+    char *p = line;
+
+    *p++ = '#';
+    *p++ = 'T';
+    *p++ = 'L';
+    *p++ = tag;
+    p = putHex(p, v);
+    *p++ = '\r';
+    *p++ = '\n';
+    UartLog_write(line, p - line);
+}
+
+void TraceLog_flush(void)
+{
+    uint32_t end = __atomic_load_n(&gTraceLog.index, __ATOMIC_ACQUIRE);
+    char line[TRACE_LOG_LINE_LEN];
+
+    if(end - gFlushed > TRACE_LOG_SLOTS)
+    {
+        sendLine('!', end - TRACE_LOG_SLOTS - gFlushed);
+        gFlushed = end - TRACE_LOG_SLOTS;
+    }
+
+    while(gFlushed != end)
+    {
+        TraceLogSlot_t *s = &gTraceLog.slot[gFlushed & (TRACE_LOG_SLOTS - 1)];
+        TraceLogSlot_t copy;
+        uint32_t seq = __atomic_load_n(&s->seq, __ATOMIC_ACQUIRE);
+        uint32_t n, i;
+        char *p = line;
+
+        if((0 == seq) || ((int32_t)(seq - (gFlushed + 1)) < 0))
+        {
+            // Still being written, send it next time
+            break;
+        }
+        memcpy(&copy, s, sizeof(copy));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if((seq != gFlushed + 1) || (__atomic_load_n(&s->seq, __ATOMIC_RELAXED) != seq))
+        {
+            // Overwritten by a newer record while we got here
+            sendLine('!', 1);
+            gFlushed++;
+            continue;
+        }
+
+        n = copy.fmt & 7;
+        if(n > TRACE_LOG_MAX_ARGS)
+        {
+            n = TRACE_LOG_MAX_ARGS;
+        }
+        memcpy(p, "#TL:", 4);
+        p = putHex(p + 4, seq);
+        p = putHex(p, copy.fmt);
+        p = putHex(p, copy.time);
+        for(i = 0; i < n; i++)
+        {
+            p = putHex(p, copy.arg[i]);
+        }
+        *p++ = '\r';
+        *p++ = '\n';
+        UartLog_write(line, p - line);
+        gFlushed++;
+    }
+}
+
+static void *TraceLog_task(void *pParam)
+{
+    while(1)
+    {
+        osi_uSleep(TRACE_LOG_FLUSH_MS * 1000);
+        TraceLog_flush();
+    }
+
+    return NULL;
+}
+
+int TraceLog_init(void)
+{
+    OsiTs_init();
+    gTraceLog.clockHz = OsiTs_clockHz();
+
+    sendLine('=', gTraceLog.clockHz);
+    if(OSI_OK != osi_ThreadCreate(&gThread, "TraceLog", TRACE_LOG_TASK_STACK_SIZE,
+                                  TRACE_LOG_TASK_PRIORITY, TraceLog_task, NULL))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+#endif // TRACE_LOG
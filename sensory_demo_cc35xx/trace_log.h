@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __TRACE_LOG_H__
+#define __TRACE_LOG_H__
+
+#include <stdint.h>
+#include "osi_timestamp.h"
+
+/*
+ * Deferred binary trace logging
+ *
+ *     TLOG("\rRecognition #%lu, wordID = %d\r\n", brick, wordID);
+ *
+ * With TRACE_LOG defined the call site stores the address of its format
+ * string, a DWT cycle count and up to TRACE_LOG_MAX_ARGS raw argument words
+ * in a RAM ring; no formatting happens on the target. The format strings are
+ * placed in the .tlog_fmt section, which the linker script keeps in the ELF
+ * file but does not load (like .log_data). A low priority task sends new
+ * records to the console as "#TL:" hex lines, and tools/tlog_decode.py turns
+ * a console capture (or a memory dump of gTraceLog) back into text using the
+ * ELF file.
+ *
+ * Arguments are stored as 32-bit words: integers, characters and pointers
+ * work as is, floats must be wrapped in TLOG_F(), and "%s" is only resolved
+ * for strings in flash (the decoder reads them from the ELF file). 64-bit
+ * arguments are not supported.
+ *
+ * Without TRACE_LOG, TLOG() prints with UART_PRINT.
+ */
+
+//Defines
+
+#ifndef TRACE_LOG_SLOTS
+#define TRACE_LOG_SLOTS         256         // records, power of 2
+#endif
+#ifndef TRACE_LOG_FLUSH_MS
+#define TRACE_LOG_FLUSH_MS      200         // how often new records are sent to the console
+#endif
+#define TRACE_LOG_MAX_ARGS      4
+#define TRACE_LOG_MAGIC         0x474F4C54  // "TLOG"
+
+typedef struct {
+    volatile uint32_t seq;                  // record index + 1, 0 while the record is written
+    uint32_t fmt;                           // format string address | number of arguments
+    uint32_t time;                          // DWT cycle count
+    uint32_t arg[TRACE_LOG_MAX_ARGS];
+} TraceLogSlot_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t slots;
+    uint32_t clockHz;
+    volatile uint32_t index;                // records written so far
+    TraceLogSlot_t slot[TRACE_LOG_SLOTS];
+} TraceLog_t;
+
+#ifdef TRACE_LOG
+
+extern TraceLog_t gTraceLog;
+
+/* Low word of the OsiTs_cycles() timebase */
+#ifndef TRACE_LOG_CYCCNT
+#define TRACE_LOG_CYCCNT        OSI_TS_CYCCNT
+#endif
+
+/* Format strings are 8 byte aligned so the low bits of the address can hold the argument count */
+#define TLOG_FMT_ATTR           __attribute__((section(".tlog_fmt"), aligned(8), used))
+
+#define TLOG_NARGS(...)         TLOG_NARGS_(__VA_ARGS__, 4, 3, 2, 1, 0, _)
+#define TLOG_NARGS_(f, _1, _2, _3, _4, n, ...) n
+#define TLOG_FMT(f, ...)        f
+#define TLOG_CAT(a, b)          TLOG_CAT_(a, b)
+#define TLOG_CAT_(a, b)         a##b
+#define TLOG_W(x)               ((uint32_t)(uintptr_t)(x))
+/* Reinterpret a float argument as a 32-bit word */
+#define TLOG_F(x)               (((union { float f; uint32_t u; }){ .f = (float)(x) }).u)
+#define TLOG_ARGS_0(f)                  0, 0, 0, 0
+#define TLOG_ARGS_1(f, a)               TLOG_W(a), 0, 0, 0
+#define TLOG_ARGS_2(f, a, b)            TLOG_W(a), TLOG_W(b), 0, 0
+#define TLOG_ARGS_3(f, a, b, c)         TLOG_W(a), TLOG_W(b), TLOG_W(c), 0
+#define TLOG_ARGS_4(f, a, b, c, d)      TLOG_W(a), TLOG_W(b), TLOG_W(c), TLOG_W(d)
+
+#define TLOG(...)               TLOG_(TLOG_NARGS(__VA_ARGS__), __VA_ARGS__)
+#define TLOG_(n, ...)                                                               \
+    do {                                                                            \
+        static const char tlogFmt[] TLOG_FMT_ATTR = TLOG_FMT(__VA_ARGS__, _);       \
+        TraceLog_put((uint32_t)(uintptr_t)tlogFmt | n,                              \
+                     TLOG_CAT(TLOG_ARGS_, n)(__VA_ARGS__));                         \
+    } while (0)
+
+static inline void TraceLog_put(uint32_t fmt, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    uint32_t idx = __atomic_fetch_add(&gTraceLog.index, 1, __ATOMIC_RELAXED);
+    TraceLogSlot_t *s = &gTraceLog.slot[idx & (TRACE_LOG_SLOTS - 1)];
+
+    // Sequence lock: a flush that copies the slot meanwhile sees seq change
+    __atomic_store_n(&s->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    s->fmt = fmt;
+    s->time = TRACE_LOG_CYCCNT;
+    s->arg[0] = a0;
+    s->arg[1] = a1;
+    s->arg[2] = a2;
+    s->arg[3] = a3;
+    __atomic_store_n(&s->seq, idx + 1, __ATOMIC_RELEASE);
+}
+
+/*!
+ *  @brief  Enable the cycle counter and start the console flush task
+ *
+ *  @return  0 - upon success, -1 upon error
+ */
+int TraceLog_init(void);
+
+/*!
+ *  @brief  Send the records written since the last flush to the console
+ *
+ *  Called periodically by the flush task, can also be called directly
+ *  before a reset.
+ */
+void TraceLog_flush(void);
+
+#else
+
+#define TLOG(...)               UART_PRINT(__VA_ARGS__)
+#define TLOG_F(x)               ((double)(x))
+static inline int TraceLog_init(void) { return 0; }
+static inline void TraceLog_flush(void) { }
+
+#endif // TRACE_LOG
+
+#endif // __TRACE_LOG_H__
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Execution trace recorder, see trace_rec.h.
+ *
+ * Console format (hex, no separators):
+ *     #TR=<clockHz><eventCycles><written><events>  header, written = events recorded since the start
+ *     #TRn<tcb><name>                                a task, the name as text
+ *     #TR:<time><info><obj>...                       up to TRACE_REC_PER_LINE events, oldest first
+ *     #TR.                                           end of the dump
+ */
+
+#ifdef TRACE_REC
+
+#include <stdint.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "osi_kernel.h"
+#include "uart_log.h"
+#include "osi_timestamp.h"
+#include "trace_rec.h"
+
+#define TRACE_REC_PER_LINE          4
+#define TRACE_REC_MAX_TASKS         16
+#define TRACE_REC_CALIBRATE         32          // events timed by TraceRec_init()
+#define TRACE_REC_LINE_LEN          (4 + 24 * TRACE_REC_PER_LINE + 2)
+
+#if (TRACE_REC_EVENTS & (TRACE_REC_EVENTS - 1))
+#error "TRACE_REC_EVENTS must be a power of 2"
+#endif
+#if !configUSE_TRACE_FACILITY
+#error "TRACE_REC needs configUSE_TRACE_FACILITY for the task names"
+#endif
+
+TraceRec_t gTraceRec = { .magic = TRACE_REC_MAGIC, .events = TRACE_REC_EVENTS, .clockHz = configCPU_CLOCK_HZ };
+
+static char *putHex(char *p, uint32_t v)
+{
+    static const char hex[] = "0123456789abcdef";
+    int i;
+
+    for(i = 28; i >= 0; i -= 4)
+    {
+        *p++ = hex[(v >> i) & 0xF];
+    }
+    return p;
+}
+
+/* The dump is much larger than the console ring, wait for room instead of dropping lines */
+static void sendLine(char *line, char *p)
+{
+    *p++ = '\r';
+    *p++ = '\n';
+    while(0 == UartLog_write(line, p - line))
+    {
+        osi_uSleep(10000);
+    }
+}
+
+void TraceRec_start(void)
+{
+    gTraceRec.enabled = 0;
+    __atomic_store_n(&gTraceRec.index, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&gTraceRec.enabled, 1, __ATOMIC_RELEASE);
+}
+
+void TraceRec_stop(void)
+{
+    __atomic_store_n(&gTraceRec.enabled, 0, __ATOMIC_RELEASE);
+}
+
+void TraceRec_init(void)
+{
+    uint32_t start, i;
+
+    OsiTs_init();
+    gTraceRec.clockHz = OsiTs_clockHz();
+
+    // Time a burst of events, including the loop, as the per event cost
+    taskENTER_CRITICAL();
+    gTraceRec.enabled = 1;
+    start = OSI_TS_CYCCNT;
+    for(i = 0; i < TRACE_REC_CALIBRATE; i++)
+    {
+        TraceRec_put(TRACE_REC_EV_SPAN_BEGIN, 0, NULL);
+    }
+    gTraceRec.eventCycles = (OSI_TS_CYCCNT - start + TRACE_REC_CALIBRATE / 2) / TRACE_REC_CALIBRATE;
+    taskEXIT_CRITICAL();
+
+    TraceRec_start();
+}
+
+void TraceRec_dump(void)
+{
+    static TaskStatus_t tasks[TRACE_REC_MAX_TASKS];
+    char line[TRACE_REC_LINE_LEN + configMAX_TASK_NAME_LEN];
+    uint32_t written, count, first, i, n;
+    char *p;
+
+    TraceRec_stop();
+    written = __atomic_load_n(&gTraceRec.index, __ATOMIC_ACQUIRE);
+    count = (written < TRACE_REC_EVENTS) ? written : TRACE_REC_EVENTS;
+    first = TRACE_REC_STOP_WHEN_FULL ? 0 : written - count;
+
+    memcpy(line, "#TR=", 4);
+    p = putHex(line + 4, gTraceRec.clockHz);
+    p = putHex(p, gTraceRec.eventCycles);
+    p = putHex(p, written);
+    p = putHex(p, TRACE_REC_EVENTS);
+    sendLine(line, p);
+
+    n = uxTaskGetSystemState(tasks, TRACE_REC_MAX_TASKS, NULL);
+    for(i = 0; i < n; i++)
+    {
+        size_t len = strnlen(tasks[i].pcTaskName, configMAX_TASK_NAME_LEN);
+
+        memcpy(line, "#TRn", 4);
+        p = putHex(line + 4, (uint32_t)(uintptr_t)tasks[i].xHandle);
+        memcpy(p, tasks[i].pcTaskName, len);
+        sendLine(line, p + len);
+    }
+
+    for(i = 0; i < count; i++)
+    {
+        TraceRecEvent_t *e = &gTraceRec.event[(first + i) & (TRACE_REC_EVENTS - 1)];
+
+        if((i % TRACE_REC_PER_LINE) == 0)
+        {
+            memcpy(line, "#TR:", 4);
+            p = line + 4;
+        }
+        p = putHex(p, e->time);
+        p = putHex(p, e->info);
+        p = putHex(p, e->obj);
+        if(((i + 1) % TRACE_REC_PER_LINE == 0) || (i + 1 == count))
+        {
+            sendLine(line, p);
+        }
+    }
+
+    memcpy(line, "#TR.", 4);
+    sendLine(line, line + 4);
+    TraceRec_start();
+}
+
+#endif // TRACE_REC
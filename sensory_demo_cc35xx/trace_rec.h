@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __TRACE_REC_H__
+#define __TRACE_REC_H__
+
+#include <stdint.h>
+#include "osi_timestamp.h"
+
+/*
+ * Execution trace recorder (build with TRACE_REC defined)
+ *
+ * Records scheduling and synchronization events in a RAM ring, for
+ * tools/trace2chrome.py to turn into a Chrome / Perfetto trace:
+ *  - task switches and queue / semaphore / mutex operations, from the
+ *    FreeRTOS trace macros in trace_rec_freertos.h, which the kernel
+ *    configuration (FreeRTOSConfig.h) must include at its end;
+ *  - interrupt handlers that call TRACE_REC_ISR_ENTER() / _EXIT();
+ *  - named spans of code between TRACE_REC_BEGIN("name") and
+ *    TRACE_REC_END("name"). The name must be a string literal; only its
+ *    address is stored and the host tool reads it from the ELF file.
+ *
+ * An event is three words (DWT cycle count, type and argument, object
+ * address) written with one atomic increment and no lock or loop, so its
+ * cost is fixed; TraceRec_init() measures it and the dump reports it. By
+ * default the ring keeps the last TRACE_REC_EVENTS events; with
+ * TRACE_REC_STOP_WHEN_FULL it keeps the first ones instead.
+ *
+ * TraceRec_dump() stops recording, prints the ring as "#TR" hex lines and
+ * starts again (the "trace" console command). The ring can also be saved
+ * from the debugger: it is the gTraceRec structure.
+ */
+
+//Defines
+
+#ifndef TRACE_REC_EVENTS
+#define TRACE_REC_EVENTS            1024        // power of 2, 12 bytes each
+#endif
+#ifndef TRACE_REC_STOP_WHEN_FULL
+#define TRACE_REC_STOP_WHEN_FULL    0
+#endif
+#define TRACE_REC_MAGIC             0x43455254  // "TREC"
+
+/* Event types, the top byte of TraceRecEvent_t.info */
+#define TRACE_REC_EV_TASK_IN        1           // obj = TCB of the task switched in
+#define TRACE_REC_EV_ISR_ENTER      2           // arg = exception number
+#define TRACE_REC_EV_ISR_EXIT       3
+#define TRACE_REC_EV_QUEUE_SEND     4           // obj = queue (semaphores and mutexes are queues)
+#define TRACE_REC_EV_QUEUE_RECEIVE  5
+#define TRACE_REC_EV_BLOCK_SEND     6           // the caller blocks until there is room
+#define TRACE_REC_EV_BLOCK_RECV     7           // the caller blocks until there is data
+#define TRACE_REC_EV_SPAN_BEGIN     8           // obj = name
+#define TRACE_REC_EV_SPAN_END       9
+#define TRACE_REC_EV_FROM_ISR       0x800000    // arg flag, queue operation from an interrupt
+
+typedef struct {
+    uint32_t time;                              // DWT cycle count
+    uint32_t info;                              // type << 24 | arg
+    uint32_t obj;
+} TraceRecEvent_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t events;
+    uint32_t clockHz;
+    uint32_t eventCycles;                       // measured cost of one event
+    volatile uint32_t index;                    // events written so far
+    volatile uint32_t enabled;
+    TraceRecEvent_t event[TRACE_REC_EVENTS];
+} TraceRec_t;
+
+#ifdef TRACE_REC
+
+extern TraceRec_t gTraceRec;
+
+static inline void TraceRec_put(uint32_t type, uint32_t arg, const void *obj)
+{
+    uint32_t idx;
+    TraceRecEvent_t *e;
+
+    if (!gTraceRec.enabled) {
+        return;
+    }
+#if TRACE_REC_STOP_WHEN_FULL
+    if (gTraceRec.index >= TRACE_REC_EVENTS) {
+        return;
+    }
+#endif
+    idx = __atomic_fetch_add(&gTraceRec.index, 1, __ATOMIC_RELAXED);
+#if TRACE_REC_STOP_WHEN_FULL
+    if (idx >= TRACE_REC_EVENTS) {
+        return;
+    }
+#endif
+    e = &gTraceRec.event[idx & (TRACE_REC_EVENTS - 1)];
+    e->time = OSI_TS_CYCCNT;
+    e->info = (type << 24) | arg;
+    e->obj = (uint32_t)(uintptr_t)obj;
+}
+
+static inline uint32_t TraceRec_ipsr(void)
+{
+    uint32_t ipsr;
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+    return ipsr & 0x1FF;
+}
+
+#define TRACE_REC_BEGIN(name)       TraceRec_put(TRACE_REC_EV_SPAN_BEGIN, 0, "" name)
+#define TRACE_REC_END(name)         TraceRec_put(TRACE_REC_EV_SPAN_END, 0, "" name)
+#define TRACE_REC_ISR_ENTER()       TraceRec_put(TRACE_REC_EV_ISR_ENTER, TraceRec_ipsr(), 0)
+#define TRACE_REC_ISR_EXIT()        TraceRec_put(TRACE_REC_EV_ISR_EXIT, TraceRec_ipsr(), 0)
+
+/*!
+ *  @brief  Measure the cost of an event and start recording
+ */
+void TraceRec_init(void);
+
+/*!
+ *  @brief  Clear the ring and start recording
+ */
+void TraceRec_start(void);
+
+/*!
+ *  @brief  Stop recording, e.g. right after the event of interest
+ */
+void TraceRec_stop(void);
+
+/*!
+ *  @brief  Stop, print the ring and the task names on the console and start again
+ */
+void TraceRec_dump(void);
+
+#else
+
+#define TRACE_REC_BEGIN(name)
+#define TRACE_REC_END(name)
+#define TRACE_REC_ISR_ENTER()
+#define TRACE_REC_ISR_EXIT()
+#define TraceRec_init()
+#define TraceRec_start()
+#define TraceRec_stop()
+#define TraceRec_dump()
+
+#endif // TRACE_REC
+
+#endif // __TRACE_REC_H__
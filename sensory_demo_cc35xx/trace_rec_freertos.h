@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __TRACE_REC_FREERTOS_H__
+#define __TRACE_REC_FREERTOS_H__
+
+/*
+ * FreeRTOS trace macros for the execution trace recorder (trace_rec.h).
+ * Include at the end of the FreeRTOSConfig.h the kernel is built with:
+ *
+ *     #include "trace_rec_freertos.h"
+ *
+ * Without TRACE_REC it defines nothing and the kernel keeps its empty
+ * defaults.
+ */
+
+#if defined(TRACE_REC) && !defined(__ASSEMBLER__)
+
+#include "trace_rec.h"
+
+#define traceTASK_SWITCHED_IN()                 TraceRec_put(TRACE_REC_EV_TASK_IN, 0, pxCurrentTCB)
+
+#define traceQUEUE_SEND(pxQueue)                TraceRec_put(TRACE_REC_EV_QUEUE_SEND, 0, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)       TraceRec_put(TRACE_REC_EV_QUEUE_SEND, TRACE_REC_EV_FROM_ISR, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)             TraceRec_put(TRACE_REC_EV_QUEUE_RECEIVE, 0, pxQueue)
+#define traceQUEUE_SEMAPHORE_RECEIVE(pxQueue)   TraceRec_put(TRACE_REC_EV_QUEUE_RECEIVE, 0, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)    TraceRec_put(TRACE_REC_EV_QUEUE_RECEIVE, TRACE_REC_EV_FROM_ISR, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)    TraceRec_put(TRACE_REC_EV_BLOCK_SEND, 0, pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) TraceRec_put(TRACE_REC_EV_BLOCK_RECV, 0, pxQueue)
+
+#endif // TRACE_REC && !__ASSEMBLER__
+
+#endif // __TRACE_REC_FREERTOS_H__
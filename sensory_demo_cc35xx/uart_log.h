@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __UART_LOG_H__
+#define __UART_LOG_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//Defines
+
+/*
+ * Console output is queued in a lock-free ring and sent to the UART by a low
+ * priority task, so Report()/UART_PRINT never wait for the 115200 baud line.
+ * Writers from any task or ISR reserve space with a compare-and-swap; when
+ * the ring is full the new message is dropped and counted.
+ */
+#ifndef UART_LOG_RING_SIZE
+#define UART_LOG_RING_SIZE          4096        // bytes, power of 2
+#endif
+#ifndef UART_LOG_MAX_RECORD
+#define UART_LOG_MAX_RECORD         256         // longer writes are split
+#endif
+#ifndef UART_LOG_TASK_PRIORITY
+#define UART_LOG_TASK_PRIORITY      1
+#endif
+#ifndef UART_LOG_TASK_STACK_SIZE
+#define UART_LOG_TASK_STACK_SIZE    1024
+#endif
+#ifndef UART_LOG_FLUSH_TIMEOUT_MS
+#define UART_LOG_FLUSH_TIMEOUT_MS   500         // UartLog_flush() gives up after this
+#endif
+
+typedef struct {
+    uint32_t bytesQueued;       // payload bytes accepted
+    uint32_t bytesSent;         // payload bytes handed to the UART driver
+    uint32_t dropMessages;      // writes (or parts of writes) dropped because the ring was full
+    uint32_t dropBytes;
+    uint32_t highWater;         // maximum ring occupancy in bytes
+} UartLogStats_t;
+
+/*!
+ *  @brief  Start the drain task, output goes to the already opened UART
+ *
+ *  @return  0 - upon success, -1 upon error
+ */
+int UartLog_init(void *uartHandle);
+
+/*!
+ *  @brief  Queue bytes for the console, never blocks
+ *
+ *  May be called from tasks and ISRs. Bytes written before UartLog_init()
+ *  stay in the ring and are sent once the task starts.
+ *
+ *  @return  number of bytes queued, less than len if the ring was full
+ */
+size_t UartLog_write(const char *buf, size_t len);
+
+/*!
+ *  @brief  Wait until everything queued is sent, up to UART_LOG_FLUSH_TIMEOUT_MS
+ *
+ *  For fatal paths (asserts), before they mask interrupts for good: the
+ *  drain task sends the ring, the UART driver needs its interrupts. Does
+ *  nothing when called from an interrupt.
+ */
+void UartLog_flush(void);
+
+void UartLog_getStats(UartLogStats_t *stats);
+
+#endif // __UART_LOG_H__
@@ -50,6 +50,8 @@
 void initCompletionArray(char **strings, uint8_t numStrings);
 void freeCompletionArray();
 
+void InitTermOutput(void);
+
 void InitTerm(void);
 
 int Report(const char *pcFormat,...);
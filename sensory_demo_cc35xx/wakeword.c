@@ -72,13 +72,32 @@
 // Adaptation
 #include "osi_kernel.h"
 #include "uart_term.h"
+#include "osi_timestamp.h"
+#include "trace_log.h"
+#include "osi_heapprof.h"
+#include "osi_heapmon.h"
+#include "osi_lockstat.h"
+#include "model_store.h"
+#include "pc_prof.h"
+#include "osi_taskmon.h"
+#include "console.h"
+#include "trace_rec.h"
+#include "boot_prof.h"
+#include "reco_bus.h"
 
 // Sensory model from Voicehub
 #include <wakeword-pc60-6.1.0-op08-prod-search-genie.h>
 #include <command-pc62-6.1.0-op10-prod-search-new-genie.h>
 
-#define MIC_DC_OFFSET           1650
-#define MIC_DC_ATTENUATION      14
+/* Runs the init that can wait until the recognizer listens, below the recognizer priority */
+#define DEFERRED_INIT_PRIORITY      2
+#define DEFERRED_INIT_STACK_SIZE    2048
+
+/* Subscribers of the recognition events, below the recognizer and the bus dispatcher */
+#define LED_EVENTS_PRIORITY         3
+#define LED_EVENTS_STACK_SIZE       768
+#define CONSOLE_EVENTS_PRIORITY     2
+#define CONSOLE_EVENTS_STACK_SIZE   1536
 
 t2siStruct  appStruct;
 
@@ -95,7 +114,7 @@ int commandCountdown = 0;
 #define COMMAND_COUNTDOWN_FRAMES_DURATION   (COMMAND_SEC_WAIT * 1000 / 15)
 //#define NUM_AUDIO_SAMPLES AUDIO_BUFFER_LEN
 
-char * cmdPhrases[20] = { COMMAND_PHRASE_0, COMMAND_PHRASE_1, COMMAND_PHRASE_2, COMMAND_PHRASE_3, COMMAND_PHRASE_4, COMMAND_PHRASE_5 };
+char * cmdPhrases[20] = COMMAND_PHRASES;
 int16_t paramAOffsetWake = 0;     // Go negative if too many FA on wakeword, go positive if too many FR
 int16_t paramAOffsetCommand = 0;  // Go negative (by 100, 200, etc) if too many FA on command, go positive if too many FR
 int32_t glitchCount = 0;
@@ -103,12 +122,11 @@ int32_t glitchCount = 0;
 int16_t audioBuffer[AUDIO_BUFFER_LEN];
 int16_t raw_audio_samples_copy[NUM_AUDIO_SAMPLES];
 
-// Enables ease of calibration for the microphone
-uint32_t   microphoneAtten = MIC_DC_ATTENUATION;
-int32_t    microphoneOffset = MIC_DC_OFFSET;
+static OsiThread_t      deferredThread;
+static OsiSyncObj_t     caughtUp;
 
-uint32_t getTick() {
-    return xTaskGetTickCount();
+uint64_t getTick() {
+    return OsiTs_cycles();
 }
 
 BOOL reInitProcess(t2siStruct* t, void *netMemory, void *grammarMemory) {
@@ -182,20 +200,131 @@ BOOL setupAppStruct(t2siStruct *t) {
     return TRUE;
 }
 
-//OSPREY_MX-38
-#define HWREG(x)                                                              \
-        (*((volatile unsigned long *)(x))) //TODO temporary need to be removed
-#define ICACHE_BASE 0x41902000  //TODO temporary need to be removed, only for M3, M$ has different address
+/* Fills in an event from the recognizer state and publishes it, status is NULL without a result */
+static void publishEvent(uint8_t type, t2siStruct *t, RecoResult *status, uint32_t elapsed,
+                         uint64_t brickTime, uint64_t time)
+{
+    RecoEvent_t event;
+
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    if (status) {
+        event.wordID = status->wordID;
+        event.finalScore = status->finalScore;
+        event.error = status->error;
+        event.nnpqScore = status->nnpqScore;
+        event.brickStart = (uint32_t) status->brickStart;
+        event.brickEnd = (uint32_t) status->brickEnd;
+    }
+    event.brickCount = (uint32_t) t->brickCount;
+    event.processUs = elapsed;
+    event.brickTime = brickTime;
+    event.time = time;
+    RecoBus_publish(&event);
+}
+
+/* Console output of the recognition results, printing never delays the audio */
+static void consoleEvents(const RecoEvent_t *event, void *arg)
+{
+    switch (event->type) {
+    case RECO_EV_WAKE:
+        UART_PRINT("Waking up!\n");
+        break;
+    case RECO_EV_COMMAND:
+        UART_PRINT("\r\n= = = COMMAND %d: %s = = =\r\n", event->wordID, cmdPhrases[event->wordID]);
+        UART_PRINT("\r*** Recognizer found wordID = %d, score = %d, at time %d, elapsed_time: %dus, latency: %dus\r\n", event->wordID, event->finalScore, event->brickCount, event->processUs, (uint32_t) OsiTs_toUs(event->time - event->brickTime));
+        break;
+    case RECO_EV_NO_COMMAND:
+        UART_PRINT("\nNo command found.\n");
+        break;
+    case RECO_EV_TIMEOUT:
+        UART_PRINT("Sensory automatic command timeout\n");
+        UART_PRINT("ERR_DATACOL_TIMEOUT\n");
+        break;
+    case RECO_EV_ERROR:
+        if (event->error == ERR_LICENSE) {
+            UART_PRINT("Sensory Lib license error!\n");
+        } else {
+            UART_PRINT("SensoryProcessData returned error code 0x%x, wordID= %d\n", event->error, event->wordID);
+        }
+        break;
+    }
+}
 
+static void ledEvents(const RecoEvent_t *event, void *arg)
+{
+    if (event->type != RECO_EV_COMMAND) {
+        return;
+    }
+
+    switch (event->wordID)
+    {
+        case 1:
+        {
+            // Toggle greed LED
+            LED_IF_toggle(GREEN_LED, 100);
+            break;
+        }
+        case 2:
+        {
+            // Toggle red LED
+            LED_IF_toggle(RED_LED, 100);
+            break;
+        }
+        case 3:
+        {
+            // Toggle blue LED
+            LED_IF_toggle(BLUE_LED, 100);
+            break;
+        }
+        case 4:
+        {
+            // Toggle all LEDs
+            LED_IF_toggle(GREEN_LED, 100);
+            LED_IF_toggle(RED_LED, 100);
+            LED_IF_toggle(BLUE_LED, 100);
+            break;
+        }
+    }
+}
+
+/*
+ * Console, LEDs and the diagnostics that print. Started before the
+ * microphone, it only gets the CPU once the recognizer is initialized and
+ * waits for audio. Connectivity init belongs here as well.
+ */
+static void *deferredInit(void *args)
+{
+    uint32_t held, dropped;
+
+    InitTerm();
+    BootProf_mark("console");
+    LED_IF_init();
+    // Commands recognized before this are not replayed to the LEDs
+    RecoBus_subscribe("RecoLeds", LED_EVENTS_PRIORITY, LED_EVENTS_STACK_SIZE, ledEvents, NULL);
+    BootProf_mark("leds");
+    // Application and radio consumers of the results subscribe the same way
+    TraceLog_init();
+    TaskMon_init();
+    Console_init();
+
+    UART_PRINT("\rStarting Project\n");
+
+    // Report once the bricks captured during init are processed
+    osi_SyncObjWait(&caughtUp, OSI_WAIT_FOREVER);
+    osi_SyncObjDelete(&caughtUp);
+    BootProf_report();
+    i2s_mic_heldStats(&held, &dropped);
+    UART_PRINT("\r[boot] %u bricks captured during init, %u dropped\r\n", held, dropped);
+
+    osi_ThreadDelete(&deferredThread);
+    return NULL;
+}
 
 void *wakeword_demo(void *args)
 {
     int32_t             RetVal = -1;
-    HWREG(ICACHE_BASE + 0x84) |= 0x00000001  ;//OSPREY_MX-38
-    HWREG(ICACHE_BASE + 0x4) |= 0xc0000000  ;//OSPREY_MX-38
-    //HWREG(ICACHE_BASE + 0x4) |= 0x80000000  ;//OSPREY_MX-38, this is for 64M cache, instead CRAM
-    
-    uint32_t i = 0;
+
     RecoResult * sensoryStatus;
     uint32_t elapsedAccum = 0;
     infoStruct_T isp;
@@ -203,20 +332,41 @@ void *wakeword_demo(void *args)
     unsigned short * gs_command_grammarLabel;
 
     t2siStruct *t = &appStruct; // Where we look for return values
+    BOOL catchingUp = TRUE;
+    BOOL listening = FALSE;
+    uint64_t brickTime;
+
+    // Board_init() already ran in main()
+    BootProf_mark("thread");
+    HeapMon_init();
+    // Output is queued until the deferred init opens the UART
+    InitTermOutput();
+    OsiTs_init();
+    HeapProf_init();
+    LockStat_init();
+    PcProf_init();
+    TraceRec_init();
+
+    // Results go out through the bus, the console prints them from its own task
+    if (RecoBus_init() != 0 ||
+        RecoBus_subscribe("RecoConsole", CONSOLE_EVENTS_PRIORITY, CONSOLE_EVENTS_STACK_SIZE, consoleEvents, NULL) != 0)
+    {
+        exit(-1);
+    }
 
-    Board_init();
-    
-    // init the terminal
-    InitTerm();
-
-    LED_IF_init();
-
-    UART_PRINT("\rStarting Project\n");
+    if (OSI_OK != osi_SyncObjCreate(&caughtUp) ||
+        OSI_OK != osi_ThreadCreate(&deferredThread, "DeferredInit", DEFERRED_INIT_STACK_SIZE,
+                                   DEFERRED_INIT_PRIORITY, deferredInit, NULL))
+    {
+        exit(-1);
+    }
 
+    // Capture first, bricks are held until the recognizer is ready for them
     if (i2s_mic_init() != 0)
     {
         exit(-1);
     }
+    BootProf_mark("i2s");
 
     UART_PRINT("\rMicrophone Initialized\n");
 
@@ -235,34 +385,47 @@ void *wakeword_demo(void *args)
     }
 
     UART_PRINT("\rRecognizer init.\r\n");
+    BootProf_mark("recognizer");
+
+#ifdef MODEL_STORE
+    if (ModelStore_open() > 0) {
+        ModelStore_dump();
+    }
+#endif
 
     commandCountdown = COMMAND_COUNTDOWN_FRAMES_DURATION;
 
     while (1)
     {
-        /* Wait for I2S data to be available */
-        if (sem_wait(&semDataReadyForTreatment) == 0)
+        PcProf_poll();
+
+        /* Bricks captured during init first, then wait for I2S data to be available */
+        BOOL held = catchingUp && i2s_mic_heldBrick(raw_audio_samples_copy, &brickTime);
+        if (catchingUp && !held)
+        {
+            catchingUp = FALSE;
+            BootProf_mark("caught up");
+            osi_SyncObjSignal(&caughtUp);
+        }
+        if (held || LockStat_semWait(&semDataReadyForTreatment) == 0)
         {
             /* This transaction should trigger every FRAME_LEN samples (240) to feed into Sensory */
-
-            /* Get the latest audio pointer triggered by the semaphore */
-            int32_t *buf          = latestAudioBufPtr.audioBufPtr;
-            /* bufSize is expressed in bytes but samples to consider are 16 bits long */
-            uint16_t numOfSamples = latestAudioBufPtr.numOfSamples;
-
-            uint32_t n = 0;
-
-            /* We only modify Left channel's samples () */
-            for (i = 0; i < numOfSamples; i = i + 3)
+            if (!held)
             {
-                /*
-                    * Shift the data down to 16-bits from 32-bits and then
-                    * remove the DC offset of the I2S microphone
-                    */
-                raw_audio_samples_copy[n++] = (int16_t) ((buf[i] >> microphoneAtten) + microphoneOffset);
+                /* Get the latest audio pointer triggered by the semaphore */
+                int32_t *buf          = latestAudioBufPtr.audioBufPtr;
+                /* bufSize is expressed in bytes but samples to consider are 16 bits long */
+                uint16_t numOfSamples = latestAudioBufPtr.numOfSamples;
+                /* Capture time of the brick, same timebase as getTick() */
+                brickTime             = latestAudioBufPtr.timestamp;
+
+                TRACE_REC_BEGIN("convert");
+                i2s_mic_convert(buf, numOfSamples, raw_audio_samples_copy);
+                TRACE_REC_END("convert");
             }
 
-            uint32_t counter1, counter2, elapsed;
+            uint64_t counter1, counter2;
+            uint32_t elapsed;
 
             if (commandCountdown > 0) 
             {
@@ -271,9 +434,11 @@ void *wakeword_demo(void *args)
                 if (commandCountdown == 0) {
                     if (recoMode != RECOMODE_WAKE) {
                         t->paramAOffset = paramAOffsetWake;
+                        TRACE_REC_BEGIN("reInitProcess");
                         reInitProcess(t, (void *) dnn_wakeword_netLabel, (void *) gs_wakeword_grammarLabel);
+                        TRACE_REC_END("reInitProcess");
                         recoMode = RECOMODE_WAKE;
-                        UART_PRINT("\nNo command found.\n");
+                        publishEvent(RECO_EV_NO_COMMAND, t, NULL, 0, brickTime, getTick());
                     }
                     // Reset the counter
                     commandCountdown = COMMAND_COUNTDOWN_FRAMES_DURATION;
@@ -281,13 +446,17 @@ void *wakeword_demo(void *args)
             }
 
             counter1 = getTick();
+            TRACE_REC_BEGIN("SensoryProcessData");
             sensoryStatus = SensoryProcessData(t, (SAMPLE *) raw_audio_samples_copy);
+            TRACE_REC_END("SensoryProcessData");
             counter2 = getTick();
-            if (counter2 >= counter1) 
+            if (!listening)
             {
-                elapsed = counter2 - counter1;
-                elapsedAccum += elapsed;
+                BootProf_mark("listening");
+                listening = TRUE;
             }
+            elapsed = (uint32_t) OsiTs_toUs(counter2 - counter1);
+            elapsedAccum += elapsed;
 
             if (sensoryStatus->wordID && sensoryStatus->nnpqScore > 0) 
             {
@@ -301,8 +470,8 @@ void *wakeword_demo(void *args)
                     }
                 }
 
-                UART_PRINT("\rRecognition .. ? #%lu, wordID = %d  score: %d  elapsed_time: %dms\r\n", (uint32_t) t->brickCount, sensoryStatus->wordID, sensoryStatus->finalScore, elapsed);
-                UART_PRINT("\rNNPQ score= %d, NNPQ threshold= %d, NNPQ check pass= %d\r\n", sensoryStatus->nnpqScore, sensoryStatus->nnpqThreshold, sensoryStatus->nnpqPass);
+                TLOG("\rRecognition .. ? #%lu, wordID = %d  score: %d  elapsed_time: %dus\r\n", (uint32_t) t->brickCount, sensoryStatus->wordID, sensoryStatus->finalScore, elapsed);
+                TLOG("\rNNPQ score= %d, NNPQ threshold= %d, NNPQ check pass= %d\r\n", sensoryStatus->nnpqScore, sensoryStatus->nnpqThreshold, sensoryStatus->nnpqPass);
             }
 
             if (sensoryStatus->error == ERR_OK) 
@@ -311,69 +480,54 @@ void *wakeword_demo(void *args)
                 {
                     dnn_command_netLabel = (unsigned short *) dnn_en_command_netLabel;
                     gs_command_grammarLabel = (unsigned short *) gs_en_command_grammarLabel;
+#ifdef MODEL_STORE
+                    {
+                        const void *storeNet, *storeGrammar;
+
+                        // Prefer the command set in the model store, the built-in one is the fallback
+                        if (ModelStore_load(MODEL_STORE_COMMAND_SET, &storeNet, &storeGrammar) == 0) {
+                            dnn_command_netLabel = (unsigned short *) storeNet;
+                            gs_command_grammarLabel = (unsigned short *) storeGrammar;
+                        }
+                    }
+#endif
                     // Enter command mode
                     t->paramAOffset = paramAOffsetCommand;
+                    TRACE_REC_BEGIN("reInitProcess");
                     reInitProcess(t, (void *) dnn_command_netLabel, (void *) gs_command_grammarLabel);
-                    UART_PRINT("Waking up!\n");
+                    TRACE_REC_END("reInitProcess");
+                    publishEvent(RECO_EV_WAKE, t, sensoryStatus, elapsed, brickTime, counter2);
                     recoMode = RECOMODE_COMMAND;
                 }
                 else if (recoMode == RECOMODE_COMMAND) 
                 {
-                    switch (sensoryStatus->wordID)
-                    {
-                        case 1:
-                        {
-                            // Toggle greed LED
-                            LED_IF_toggle(GREEN_LED, 100);
-                            break;
-                        }
-                        case 2:
-                        {
-                            // Toggle red LED
-                            LED_IF_toggle(RED_LED, 100);
-                            break;
-                        }
-                        case 3:
-                        {
-                            // Toggle blue LED
-                            LED_IF_toggle(BLUE_LED, 100);
-                            break;
-                        }
-                        case 4:
-                        {
-                            // Toggle all LEDs
-                            LED_IF_toggle(GREEN_LED, 100);
-                            LED_IF_toggle(RED_LED, 100);
-                            LED_IF_toggle(BLUE_LED, 100);
-                            break;
-                        }
-                    }
-
-                    UART_PRINT("\r\n= = = COMMAND %d: %s = = =\r\n", sensoryStatus->wordID, cmdPhrases[sensoryStatus->wordID]);
-                    UART_PRINT("\r*** Recognizer found wordID = %d, score = %d, at time %d, elapsed_time: %dms\r\n", sensoryStatus->wordID, sensoryStatus->finalScore, (uint32_t) t->brickCount, elapsed);
+                    publishEvent(RECO_EV_COMMAND, t, sensoryStatus, elapsed, brickTime, counter2);
 
                     // Got an actual command
                     recoMode = RECOMODE_WAKE;
                     t->paramAOffset = paramAOffsetWake;
+                    TRACE_REC_BEGIN("reInitProcess");
                     reInitProcess(t, (void *) dnn_wakeword_netLabel, (void *) gs_wakeword_grammarLabel);
+                    TRACE_REC_END("reInitProcess");
                 }
 
                 commandCountdown = COMMAND_COUNTDOWN_FRAMES_DURATION;  // Wait approx N seconds for a command
 
             } else if (sensoryStatus->error == ERR_LICENSE) 
             {
-                UART_PRINT("Sensory Lib license error!\n");
+                publishEvent(RECO_EV_ERROR, t, sensoryStatus, elapsed, brickTime, counter2);
                 break;
             } else if (sensoryStatus->error == ERR_DATACOL_TIMEOUT) 
             {
-                UART_PRINT("Sensory automatic command timeout\n");
+                publishEvent(RECO_EV_TIMEOUT, t, sensoryStatus, elapsed, brickTime, counter2);
                 // Go back to wakeword on command timeout (if there was an automatic command timeout)
                 t->paramAOffset = paramAOffsetWake;
+                TRACE_REC_BEGIN("reInitProcess");
                 reInitProcess(t, (void *) dnn_wakeword_netLabel, (void *) gs_wakeword_grammarLabel);
-                UART_PRINT("ERR_DATACOL_TIMEOUT\n");
+                TRACE_REC_END("reInitProcess");
             } else if (sensoryStatus->error != ERR_NOT_FINISHED) 
             {
-                UART_PRINT("SensoryProcessData returned error code 0x%x, wordID= %d\n", sensoryStatus->error, sensoryStatus->wordID);
+                publishEvent(RECO_EV_ERROR, t, sensoryStatus, elapsed, brickTime, counter2);
                 break;
             }
         }
@@ -383,10 +537,10 @@ void *wakeword_demo(void *args)
 }
 
 
-#ifdef CC35XX
+#if defined(CC35XX) && !defined(SENSORY_REPLAY) && !defined(SENSORY_BENCHMARK) && !defined(OSI_BENCH)
 void *mainThread(void *args)
 {
     wakeword_demo(NULL);
     return NULL;
 }
-#endif // CC35XX
+#endif // CC35XX && !SENSORY_REPLAY && !SENSORY_BENCHMARK && !OSI_BENCH
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Compare two recognizer benchmark runs and flag regressions.
+
+Inputs are the console logs of SENSORY_BENCHMARK builds (the JSON between the
+BENCH_JSON_BEGIN / BENCH_JSON_END lines is extracted) or the bare JSON.
+All metrics are costs, so only increases beyond the threshold are flagged.
+Exits with status 1 when a regression is found.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+ANSI = re.compile(r"\x1b\[[0-9;?]*[A-Za-z]")
+
+# Worst case costs depend on interrupts and are compared separately
+NOISY = ("brick_max_cycles", "alloc_max_cycles", "free_max_cycles", "max_ns")
+SKIP = ("brick_min_cycles", "load_pct", "bricks", "cpu_hz", "iterations", "threads")
+
+
+def load(path):
+    with open(path, errors="replace") as f:
+        text = ANSI.sub("", f.read()).replace("\r", "")
+    begin = text.rfind("BENCH_JSON_BEGIN")
+    if begin >= 0:
+        end = text.find("BENCH_JSON_END", begin)
+        if end < 0:
+            sys.exit("%s: BENCH_JSON_END missing, run not finished?" % path)
+        text = text[begin + len("BENCH_JSON_BEGIN"):end]
+    return json.loads(text)
+
+
+def metrics(run):
+    out = {}
+    for model in run.get("models", []):
+        name = model["model"]
+        for key, value in model.items():
+            if isinstance(value, dict):
+                for sub, v in value.items():
+                    if sub not in SKIP:
+                        out["%s/%s/%s" % (name, key, sub)] = v
+            elif isinstance(value, (int, float)) and key not in SKIP:
+                out["%s/%s" % (name, key)] = value
+    for section in ("allocator", "queue", "reco_bus", "osi", "trace"):
+        for path, values in run.get(section, {}).items():
+            for key, value in values.items():
+                out["%s/%s/%s" % (section, path, key)] = value
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("baseline")
+    ap.add_argument("current")
+    ap.add_argument("-t", "--threshold", type=float, default=5.0,
+                    help="allowed increase in percent (default %(default)s)")
+    ap.add_argument("--max-threshold", type=float, default=25.0,
+                    help="allowed increase of worst case brick cost in percent (default %(default)s)")
+    ap.add_argument("-v", "--verbose", action="store_true", help="list unchanged metrics too")
+    args = ap.parse_args()
+
+    base_run, cur_run = load(args.baseline), load(args.current)
+    for key in ("target", "cpu_hz", "thf_version", "hot_text_bytes", "hot_data_bytes"):
+        if base_run.get(key) != cur_run.get(key):
+            print("note: %s differs: %s -> %s" % (key, base_run.get(key), cur_run.get(key)))
+
+    base, cur = metrics(base_run), metrics(cur_run)
+    regressions = 0
+    for key in sorted(set(base) | set(cur)):
+        if key not in cur or key not in base:
+            print("%-70s %s" % (key, "missing in current" if key not in cur else "new"))
+            continue
+        b, c = base[key], cur[key]
+        pct = (c - b) * 100.0 / b if b else (0.0 if c == b else float("inf"))
+        limit = args.max_threshold if key.endswith(NOISY) else args.threshold
+        flag = ""
+        if pct > limit:
+            flag = "REGRESSION"
+            regressions += 1
+        elif pct < -limit:
+            flag = "improved"
+        if flag or args.verbose:
+            print("%-70s %12d -> %12d %+7.1f%% %s" % (key, b, c, pct, flag))
+
+    print("%d metrics compared, %d regressions" % (len(set(base) & set(cur)), regressions))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
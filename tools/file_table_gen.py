@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Generate the perfect hash file table used by osi_fopen().
+
+Reads the file list (CSV: name,type,system,item,log) and writes a C header with
+a collision free FNV-1a hash of the names and the descriptor table indexed
+by it, so osi_fopen() finds a file with one hash and one strcmp. The seed
+is searched for the smallest power of 2 table that has no collisions.
+system and item are the NV item of the file, empty for files that are not
+stored in NV. log is 1 for NV files kept as append-only records
+(osi_nvlog.h) instead of being rewritten on every write. Rerun after changing the list:
+
+    python3 tools/file_table_gen.py sensory_demo_cc35xx/adaptation/osi_file_table.csv \\
+        -o sensory_demo_cc35xx/adaptation/osi_file_table.h
+"""
+
+import argparse
+import csv
+import os
+import sys
+
+FNV_PRIME = 16777619
+MAX_SEEDS = 1 << 20
+
+
+def fnv1a(name, seed):
+    h = seed
+    for c in name.encode():
+        h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def slot_of(name, seed, bits):
+    # Top bits: the low bits of an FNV-1a hash depend only on the low bits of the seed
+    return fnv1a(name, seed) >> (32 - bits)
+
+
+def find_seed(names, bits):
+    for seed in range(1, MAX_SEEDS):
+        used = set()
+        for name in names:
+            slot = slot_of(name, seed, bits)
+            if slot in used:
+                break
+            used.add(slot)
+        else:
+            return seed
+    return None
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("table", help="file list CSV")
+    ap.add_argument("-o", "--output", required=True, help="header to write")
+    ap.add_argument("--max-slots", type=int, default=256, help="largest table to try (default %(default)s)")
+    args = ap.parse_args()
+
+    with open(args.table, newline="") as f:
+        rows = [r for r in csv.DictReader(f) if r["name"].strip()]
+    names = [r["name"].strip() for r in rows]
+    if len(set(names)) != len(names):
+        sys.exit("%s: duplicate file names" % args.table)
+
+    bits = 1
+    while (1 << bits) < len(names):
+        bits += 1
+    seed = None
+    while (1 << bits) <= args.max_slots:
+        seed = find_seed(names, bits)
+        if seed is not None:
+            break
+        bits += 1
+    if seed is None:
+        sys.exit("no collision free seed up to %d slots" % args.max_slots)
+
+    table = {}
+    for row, name in zip(rows, names):
+        table[slot_of(name, seed, bits)] = (name, row["type"].strip(),
+                                                 row["system"].strip() or "0", row["item"].strip() or "0",
+                                                 (row.get("log") or "").strip() or "0")
+
+    guard = "__" + os.path.basename(args.output).upper().replace(".", "_") + "__"
+    with open(args.output, "w") as out:
+        out.write("/* Generated by tools/file_table_gen.py from %s, do not edit */\n\n"
+                  % os.path.basename(args.table))
+        out.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        out.write("#define OSI_FILE_HASH_SEED          0x%08xu\n" % seed)
+        out.write("#define OSI_FILE_HASH_BITS          %d\n" % bits)
+        out.write("#define OSI_FILE_HASH_SLOTS         (1 << OSI_FILE_HASH_BITS)\n\n")
+        out.write("static inline uint32_t osiFileHash(const char *name)\n{\n")
+        out.write("    uint32_t h = OSI_FILE_HASH_SEED;\n\n")
+        out.write("    while(*name)\n    {\n")
+        out.write("        h = (h ^ (uint8_t)*name++) * %du;\n    }\n" % FNV_PRIME)
+        out.write("    return h >> (32 - OSI_FILE_HASH_BITS);\n}\n\n")
+        out.write("static const osiFileDesc_t gOsiFileTable[OSI_FILE_HASH_SLOTS] =\n{\n")
+        for slot in sorted(table):
+            out.write("    [%d] = { \"%s\", %s, %s, %s, %s },\n" % ((slot,) + table[slot]))
+        out.write("};\n\n#endif // %s\n" % guard)
+    print("%d files in %d slots, seed 0x%08x" % (len(names), 1 << bits, seed))
+
+
+if __name__ == "__main__":
+    main()
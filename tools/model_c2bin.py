@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""Convert VoiceHub model sources into binary blobs embedded with .incbin.
+
+VoiceHub exports every net and grammar as a C array with one value per line
+(the wake word net alone is 69k lines), which makes clean builds slow and
+model updates impossible to review. This tool turns a VoiceHub export into:
+
+  - <source>.bin for each .c file: the array as little endian 16-bit words;
+  - models.S: pulls the .bin files in with .incbin, one 4-byte aligned
+    .rodata.model.<symbol> section per array, under the original symbol
+    names, so the application code does not change;
+  - <header>.h for each VoiceHub .h file: the symbols declared with their
+    sizes (sizeof works on them), the phrase strings and a <PREFIX>_PHRASES
+    initializer with all of them.
+
+The .bin files are found through the assembler include path, so the output
+directory must be on it (the project adds the VoiceHub directory with -I).
+Drop the VoiceHub .c files from the project after converting them:
+
+    VH=sensory_demo_cc35xx/THF-Micro_v8.3.2_SDK_Arm_CM33_hf/data/model/VoiceHub
+    python3 tools/model_c2bin.py export/*.c export/*.h -o $VH
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+ARRAY = re.compile(r"^const\s+unsigned\s+short\s+(\w+)\s*\[\s*\]\s*(?:ALIGNED\s*\(\s*\d+\s*\))?\s*=\s*\{(.*?)\}",
+                   re.S | re.M)
+EXTERN = re.compile(r"^extern\s+const\s+unsigned\s+short\s+(\w+)\s*\[\s*\d*\s*\]\s*;", re.M)
+PHRASE = re.compile(r"^#define\s+(\w+)_PHRASE_(\d+)\s+(\"(?:[^\"\\]|\\.)*\")(.*)$", re.M)
+COUNT = re.compile(r"^#define\s+(\w+)_PHRASE_COUNT\s+(\d+)", re.M)
+BANNER = re.compile(r"\A\s*(/\*.*?\*/)", re.S)
+
+
+def strip_comments(text):
+    return re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S)
+
+
+def parse_source(path):
+    """Returns (symbol, bytes) of the array in a VoiceHub .c file."""
+    with open(path) as f:
+        text = f.read()
+    arrays = ARRAY.findall(text)
+    if len(arrays) != 1:
+        sys.exit("%s: expected one unsigned short array, found %d" % (path, len(arrays)))
+    sym, body = arrays[0]
+    words = [int(w, 0) for w in (t.strip() for t in strip_comments(body).split(",")) if w]
+    if any(w > 0xFFFF for w in words):
+        sys.exit("%s: value out of range" % path)
+    return sym, struct.pack("<%dH" % len(words), *words)
+
+
+def parse_header(path):
+    """Returns (banner, symbols, prefix, phrases) of a VoiceHub .h file."""
+    with open(path) as f:
+        text = f.read()
+    m = BANNER.match(text)
+    banner = m.group(1) if m else ""
+    symbols = []
+    for sym in EXTERN.findall(text):
+        if sym not in symbols:
+            symbols.append(sym)
+    phrases = sorted((int(n), prefix, value, rest.strip()) for prefix, n, value, rest in PHRASE.findall(text))
+    prefixes = {p for _, p, _, _ in phrases}
+    if len(prefixes) > 1:
+        sys.exit("%s: phrases with several prefixes %s" % (path, sorted(prefixes)))
+    prefix = prefixes.pop() if prefixes else None
+    count = COUNT.search(text)
+    if phrases and (count is None or int(count.group(2)) != len(phrases) or
+                    [n for n, *_ in phrases] != list(range(len(phrases)))):
+        sys.exit("%s: phrase count does not match the phrases" % path)
+    return banner, symbols, prefix, [(value, rest) for _, _, value, rest in phrases]
+
+
+def write_if_changed(path, data):
+    """Keeps the timestamp of unchanged outputs, so the build does not redo them."""
+    mode = "wb" if isinstance(data, bytes) else "w"
+    try:
+        with open(path, "rb" if mode == "wb" else "r") as f:
+            if f.read() == data:
+                return False
+    except OSError:
+        pass
+    with open(path, mode) as f:
+        f.write(data)
+    return True
+
+
+def gen_header(name, banner, symbols, sizes, prefix, phrases):
+    guard = "__%s__" % re.sub(r"\W", "_", name).upper()
+    out = []
+    if banner:
+        out += [banner, ""]
+    out += ["/* Generated by tools/model_c2bin.py, do not edit. The data is in the .bin",
+            " * files next to this header, embedded by models.S. */",
+            "",
+            "#ifndef %s" % guard,
+            "#define %s" % guard,
+            ""]
+    for sym in symbols:
+        if sym not in sizes:
+            sys.exit("%s declares %s, but no .c file defines it" % (name, sym))
+        out.append("extern const unsigned short %s[%d];" % (sym, sizes[sym] // 2))
+    if phrases:
+        out += ["",
+                "/* The following phrases (Hex format) correspond to the word IDs emitted by the recognizer. */",
+                "#define %s_PHRASE_COUNT %d" % (prefix, len(phrases))]
+        for i, (value, rest) in enumerate(phrases):
+            out.append(("#define %s_PHRASE_%d %s\t%s" % (prefix, i, value, rest)).rstrip())
+        out.append("#define %s_PHRASES { %s }"
+                   % (prefix, ", ".join("%s_PHRASE_%d" % (prefix, i) for i in range(len(phrases)))))
+    out += ["", "#endif // %s" % guard, ""]
+    return "\n".join(out)
+
+
+def gen_asm(blobs):
+    out = ["/* Generated by tools/model_c2bin.py, do not edit.",
+           " * Recognizer models, embedded from the .bin files found on the include path. */",
+           ""]
+    for sym, binname, size in blobs:
+        out += ["    .section .rodata.model.%s, \"a\"" % sym,
+                "    .balign 4",
+                "    .global %s" % sym,
+                "    .type %s, %%object" % sym,
+                "%s:" % sym,
+                "    .incbin \"%s\"" % binname,
+                "    .size %s, . - %s" % (sym, sym),
+                "    .if (. - %s) != %d" % (sym, size),
+                "    .error \"%s does not match the size in its header, rerun tools/model_c2bin.py\"" % binname,
+                "    .endif",
+                ""]
+    return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("inputs", nargs="+", help="VoiceHub .c and .h files")
+    ap.add_argument("-o", "--output", required=True, help="directory for the .bin, .h and models.S files")
+    args = ap.parse_args()
+
+    sources = sorted(p for p in args.inputs if p.endswith(".c"))
+    headers = sorted(p for p in args.inputs if p.endswith(".h"))
+    if not sources:
+        sys.exit("no .c files given")
+
+    os.makedirs(args.output, exist_ok=True)
+    sizes, blobs, written = {}, [], 0
+    for path in sources:
+        sym, data = parse_source(path)
+        if sym in sizes:
+            sys.exit("%s: %s is defined twice" % (path, sym))
+        binname = os.path.splitext(os.path.basename(path))[0] + ".bin"
+        sizes[sym] = len(data)
+        blobs.append((sym, binname, len(data)))
+        written += write_if_changed(os.path.join(args.output, binname), data)
+
+    for path in headers:
+        name = os.path.basename(path)
+        banner, symbols, prefix, phrases = parse_header(path)
+        written += write_if_changed(os.path.join(args.output, name),
+                                    gen_header(name, banner, symbols, sizes, prefix, phrases))
+
+    written += write_if_changed(os.path.join(args.output, "models.S"), gen_asm(blobs))
+    for sym, binname, size in blobs:
+        print("%-28s %-48s %7d bytes" % (sym, binname, size), file=sys.stderr)
+    print("%d files updated" % written, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
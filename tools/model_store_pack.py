@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Build the model store image read by model_store.c (MODEL_STORE builds).
+
+Each --model gives a name, a version and the net and grammar of one command
+model. A part is either a raw .bin file (as written by model_c2bin.py) or a
+VoiceHub C source (the first unsigned short array in it is used).
+Several versions of a model may be stored; the target loads the highest.
+
+    python3 tools/model_store_pack.py -o store.bin \\
+        --model command:1:$VH/command-pc62-6.1.0-op10-prod-net-new-genie.bin:$VH/command-pc62-6.1.0-op10-prod-search-new-genie.bin
+
+The image is flashed to the region given by MODEL_STORE_PHYS_ADDR, and must
+fit in MODEL_STORE_SIZE (--region-size checks it). --list prints the
+directory of an existing image.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4C444F4D              # "MODL"
+FORMAT = 1
+MAX_MODELS = 16
+NAME_LEN = 16
+HDR = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<%dsIIIIIIII" % NAME_LEN)
+
+ARRAY = re.compile(r"unsigned\s+short\s+(\w+)\s*\[\s*\]\s*(?:ALIGNED\s*\(\s*\d+\s*\))?\s*=\s*\{(.*?)\}", re.S)
+
+
+def align4(n):
+    return (n + 3) & ~3
+
+
+def read_part(path):
+    if not path.endswith(".c"):
+        with open(path, "rb") as f:
+            return f.read()
+    with open(path) as f:
+        text = f.read()
+    m = ARRAY.search(text)
+    if not m:
+        sys.exit("%s: no unsigned short array found" % path)
+    body = re.sub(r"//[^\n]*|/\*.*?\*/", "", m.group(2), flags=re.S)
+    words = [int(w, 0) for w in (t.strip() for t in body.split(",")) if w]
+    return struct.pack("<%dH" % len(words), *words)
+
+
+def parse_model(text):
+    parts = text.split(":", 3)
+    if len(parts) != 4:
+        raise argparse.ArgumentTypeError("expected name:version:net:grammar")
+    name, version, net, grammar = parts
+    if not name or len(name.encode()) >= NAME_LEN:
+        raise argparse.ArgumentTypeError("name must be 1 to %d characters" % (NAME_LEN - 1))
+    return name, int(version, 0), net, grammar
+
+
+def build(models):
+    if not models or len(models) > MAX_MODELS:
+        sys.exit("need 1 to %d models" % MAX_MODELS)
+    seen = set()
+    offset = HDR.size + ENTRY.size * len(models)
+    entries, blobs = [], []
+    for name, version, net_path, grammar_path in models:
+        if (name, version) in seen:
+            sys.exit("%s v%d is given twice" % (name, version))
+        seen.add((name, version))
+        net, grammar = read_part(net_path), read_part(grammar_path)
+        net_off = align4(offset)
+        grammar_off = align4(net_off + len(net))
+        offset = grammar_off + len(grammar)
+        entries.append(ENTRY.pack(name.encode(), version, net_off, len(net), zlib.crc32(net),
+                                  grammar_off, len(grammar), zlib.crc32(grammar), 0))
+        blobs.append((net_off, net))
+        blobs.append((grammar_off, grammar))
+    directory = b"".join(entries)
+    image = bytearray(HDR.pack(MAGIC, FORMAT, len(models), zlib.crc32(directory), 0) + directory)
+    for off, data in blobs:
+        image.extend(b"\xff" * (off - len(image)))      # erased flash
+        image.extend(data)
+    return bytes(image)
+
+
+def list_image(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, fmt, count, dir_crc, _ = HDR.unpack_from(data, 0)
+    if magic != MAGIC or fmt != FORMAT:
+        sys.exit("%s: not a model store image" % path)
+    directory = data[HDR.size:HDR.size + ENTRY.size * count]
+    print("%d models, directory CRC %s" % (count, "ok" if zlib.crc32(directory) == dir_crc else "BAD"))
+    for i in range(count):
+        name, version, noff, nsize, ncrc, goff, gsize, gcrc, _ = ENTRY.unpack_from(directory, i * ENTRY.size)
+        ok = zlib.crc32(data[noff:noff + nsize]) == ncrc and zlib.crc32(data[goff:goff + gsize]) == gcrc
+        print("  %-16s v%-4d net %7d B @0x%06x  grammar %6d B @0x%06x  %s"
+              % (name.rstrip(b"\0").decode(), version, nsize, noff, gsize, goff, "ok" if ok else "BAD CRC"))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("-o", "--output", help="image to write")
+    ap.add_argument("--model", type=parse_model, action="append", default=[],
+                    help="name:version:net:grammar, repeat for each model")
+    ap.add_argument("--region-size", type=lambda s: int(s, 0), help="fail if the image is larger")
+    ap.add_argument("--list", metavar="IMAGE", help="print the directory of an image and exit")
+    args = ap.parse_args()
+
+    if args.list:
+        list_image(args.list)
+        return
+    if not args.output:
+        ap.error("-o is required")
+    image = build(args.model)
+    if args.region_size is not None and len(image) > args.region_size:
+        sys.exit("image is %d bytes, the region only %d" % (len(image), args.region_size))
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print("%s: %d models, %d bytes" % (args.output, len(args.model), len(image)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Map a PC_PROFILE histogram to functions and pick the code to run from RAM.
+
+A PC_PROFILE build prints its sample histogram as "#PP" lines (see
+pc_prof.c). Given the console capture, the ELF file of the same build and
+its GNU ld map file, this prints the functions where the time goes, and:
+
+  --hot-text FILE   writes the linker list of the input sections with the
+                    most samples per byte that fit in --budget bytes
+                    (hot_text.lds.inc, run from TCM/SRAM);
+  --hot-data FILE   writes the list of the model blobs given with --model
+                    (hot_data.lds.inc, copied to SRAM).
+
+By default only libTHFMicro code is picked (--only), the demo and driver
+code is mostly run once. Rebuild after writing the lists; the addresses
+change, so profile the new build again before refining the list.
+
+    python3 tools/pcprof_report.py Debug/demo.out Debug/demo.map capture.txt \\
+        --hot-text sensory_demo_cc35xx/hot_text.lds.inc --budget 24576 \\
+        --hot-data sensory_demo_cc35xx/hot_data.lds.inc --model dnn_wakeword_netLabel
+"""
+
+import argparse
+import bisect
+import os
+import re
+import struct
+import sys
+
+STT_FUNC = 2
+STT_OBJECT = 1
+SHT_SYMTAB = 2
+
+INPUT = re.compile(r"^ (\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$")
+WRAPPED = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+MEMBER = re.compile(r"^(?:.*[/\\])?([^/\\()]+\.a)\((.+)\)$")
+
+
+def read_symbols(path):
+    """Returns [(addr, size, name, kind)] of the function and object symbols."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF":
+        sys.exit("%s: not an ELF file" % path)
+    end = "<" if data[5] == 1 else ">"
+    if data[4] == 1:
+        shoff, = struct.unpack_from(end + "I", data, 0x20)
+        shentsize, shnum = struct.unpack_from(end + "HH", data, 0x2E)
+        hdr, sym, symsize = end + "IIIIIIIIII", end + "IIIBBH", 16
+    else:
+        shoff, = struct.unpack_from(end + "Q", data, 0x28)
+        shentsize, shnum = struct.unpack_from(end + "HH", data, 0x3A)
+        hdr, sym, symsize = end + "IIQQQQIIQQ", end + "IBBHQQ", 24
+    sections = [struct.unpack_from(hdr, data, shoff + i * shentsize) for i in range(shnum)]
+    out = []
+    for _, kind, _, _, offset, size, link, *_ in sections:
+        if kind != SHT_SYMTAB:
+            continue
+        strtab = sections[link][4]
+        for i in range(size // symsize):
+            fields = struct.unpack_from(sym, data, offset + i * symsize)
+            if data[4] == 1:
+                name, value, length, info = fields[:4]
+            else:
+                name, info, _, _, value, length = fields
+            if (info & 0xF) not in (STT_FUNC, STT_OBJECT) or not length:
+                continue
+            stop = data.index(b"\0", strtab + name)
+            label = data[strtab + name:stop].decode(errors="replace")
+            # Thumb functions have bit 0 set
+            out.append((value & ~1 if (info & 0xF) == STT_FUNC else value, length, label, info & 0xF))
+    if not out:
+        sys.exit("%s: no symbols, was it stripped?" % path)
+    return sorted(out)
+
+
+def read_map(path):
+    """Returns [(addr, size, section, archive, member)] of the input sections."""
+    out = []
+    pending = None
+    started = False
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\r\n")
+            if not started:
+                started = line.startswith("Linker script and memory map")
+                continue
+            if pending:
+                m = WRAPPED.match(line)
+                if m:
+                    m = (pending,) + m.groups()
+                pending = None
+            else:
+                m = INPUT.match(line)
+                if m and m.group(2) is None:
+                    pending = m.group(1)    # long name, the rest is on the next line
+                    continue
+                m = m.groups() if m else None
+            if not m:
+                continue
+            section, addr, size, origin = m[0], int(m[1], 16), int(m[2], 16), m[3].strip()
+            if not size or origin.startswith("load address"):
+                continue
+            member = MEMBER.match(origin)
+            archive, obj = member.groups() if member else (None, os.path.basename(origin))
+            out.append((addr, size, section, archive, obj))
+    if not out:
+        sys.exit("%s: no input sections, is it a GNU ld map file?" % path)
+    return sorted(out, key=lambda s: s[0])
+
+
+def read_capture(path):
+    """Returns the last complete histogram: (header, [(base, buckets)], {index: count})."""
+    line_re = re.compile(r"#PP([=@:.])([0-9a-f]*)")
+    result = None
+    header, ranges, counts = None, [], {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = line_re.search(line)
+            if not m:
+                continue
+            tag, hexs = m.groups()
+            if tag == "=":
+                header = tuple(int(hexs[i:i + 8], 16) for i in range(0, 32, 8)) if len(hexs) >= 32 else None
+                ranges, counts = [], {}
+            elif header is None:
+                continue
+            elif tag == "@" and len(hexs) >= 16:
+                ranges.append((int(hexs[:8], 16), int(hexs[8:16], 16)))
+            elif tag == ":":
+                for i in range(0, len(hexs) - 7, 8):
+                    counts[int(hexs[i:i + 4], 16)] = int(hexs[i + 4:i + 8], 16)
+            elif tag == ".":
+                result = (header, ranges, counts)
+                header = None
+    if result is None:
+        sys.exit("%s: no complete #PP histogram found" % path)
+    return result
+
+
+def bucket_spans(header, ranges, counts):
+    """Yields (start, end, samples) of the non-empty buckets."""
+    shift = header[0]
+    first = 0
+    for base, buckets in ranges:
+        for b in range(buckets):
+            n = counts.get(first + b)
+            if n:
+                start = base + (b << shift)
+                yield start, start + (1 << shift), n
+        first += buckets
+
+
+def attribute(spans, items):
+    """Splits the samples of each bucket over the items (addr, size, ...) it overlaps."""
+    totals = [0.0] * len(items)
+    unknown = 0.0
+    starts = [it[0] for it in items]
+    longest = max((it[1] for it in items), default=0)
+    for start, end, n in spans:
+        placed = 0.0
+        # Items are sorted by address, walk back over those that may reach the bucket
+        i = bisect.bisect_left(starts, end) - 1
+        while i >= 0 and items[i][0] + longest > start:
+            lo, hi = max(start, items[i][0]), min(end, items[i][0] + items[i][1])
+            if hi > lo:
+                share = n * (hi - lo) / (end - start)
+                totals[i] += share
+                placed += share
+            i -= 1
+        unknown += n - placed
+    return totals, unknown
+
+
+def write_list(path, lines, comment):
+    with open(path, "w") as f:
+        f.write("/* %s\n * Generated by tools/pcprof_report.py. */\n" % comment)
+        for line in lines:
+            f.write(line + "\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("elf", help="ELF file of the profiled build")
+    ap.add_argument("map", help="GNU ld map file of the same build")
+    ap.add_argument("capture", help="console capture with the #PP lines")
+    ap.add_argument("--top", type=int, default=25, help="functions to print (default 25)")
+    ap.add_argument("--hot-text", metavar="FILE", help="write the hot input sections to FILE")
+    ap.add_argument("--budget", type=lambda s: int(s, 0), default=16384,
+                    help="bytes of code that may be placed (default 16384)")
+    ap.add_argument("--only", default="THFMicro",
+                    help="only pick sections whose archive or object name contains this ('' for all)")
+    ap.add_argument("--hot-data", metavar="FILE", help="write the .rodata.model sections of --model to FILE")
+    ap.add_argument("--model", action="append", default=[], help="model symbol for --hot-data, repeat")
+    ap.add_argument("--data-budget", type=lambda s: int(s, 0), help="fail if the models are larger")
+    args = ap.parse_args()
+
+    header, ranges, counts = read_capture(args.capture)
+    shift, samples, in_handler, outside = header
+    spans = list(bucket_spans(header, ranges, counts))
+    symbols = read_symbols(args.elf)
+    functions = list({s[0]: s for s in reversed(symbols) if s[3] == STT_FUNC}.values())    # one name per address
+    functions.sort()
+    inputs = [s for s in read_map(args.map) if s[2].startswith((".text", ".TI.ramfunc"))]
+
+    total = samples or 1
+    print("%d samples, %d in interrupt handlers, %d outside the text, %d byte buckets"
+          % (samples, in_handler, outside, 1 << shift))
+    func_samples, unknown = attribute(spans, functions)
+    ranked = sorted(((n, f) for n, f in zip(func_samples, functions) if n), reverse=True)
+    print("%9s %6s %10s %6s  %s" % ("samples", "%", "address", "size", "function"))
+    for n, (addr, size, name, _) in ranked[:args.top]:
+        print("%9.0f %5.1f%% 0x%08x %6d  %s" % (n, 100.0 * n / total, addr, size, name))
+    if unknown:
+        print("%9.0f %5.1f%% in code without a symbol" % (unknown, 100.0 * unknown / total))
+
+    if args.hot_text:
+        sec_samples, _ = attribute(spans, inputs)
+        picked, used = [], 0
+        candidates = sorted(((n / size, n, size, section, archive, obj)
+                             for n, (_, size, section, archive, obj) in zip(sec_samples, inputs)
+                             if n and args.only in "%s %s" % (archive or "", obj)), reverse=True)
+        for _, n, size, section, archive, obj in candidates:
+            aligned = (size + 3) & ~3
+            if used + aligned > args.budget:
+                continue
+            used += aligned
+            picked.append((n, size, section, archive, obj))
+        lines = ["*%s(%s)" % ("%s:%s" % (archive, obj) if archive else obj, section)
+                 for _, _, section, archive, obj in picked]
+        covered = sum(n for n, *_ in picked)
+        write_list(args.hot_text, lines, "Input sections run from RAM, %d bytes, %.1f%% of the samples."
+                   % (used, 100.0 * covered / total))
+        print("%s: %d sections, %d of %d bytes, %.1f%% of the samples"
+              % (args.hot_text, len(picked), used, args.budget, 100.0 * covered / total), file=sys.stderr)
+
+    if args.hot_data:
+        sizes = {name: size for _, size, name, kind in symbols if kind == STT_OBJECT}
+        missing = [m for m in args.model if m not in sizes]
+        if missing:
+            sys.exit("%s: no such model symbol %s" % (args.elf, ", ".join(missing)))
+        used = sum((sizes[m] + 3) & ~3 for m in args.model)
+        if args.data_budget is not None and used > args.data_budget:
+            sys.exit("models are %d bytes, the budget only %d" % (used, args.data_budget))
+        write_list(args.hot_data, ["*(.rodata.model.%s)" % m for m in args.model],
+                   "Model blobs copied to SRAM, %d bytes." % used)
+        print("%s: %d models, %d bytes" % (args.hot_data, len(args.model), used), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
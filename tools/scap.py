@@ -0,0 +1,87 @@
+"""Reader for the score capture (.scap) files written by score_capture.c.
+
+A capture is a little-endian stream of records, each a 4 character tag, a u32
+payload length and the payload (see score_capture.h for the record list).
+"""
+
+import struct
+from array import array
+
+MODEL_NAMES = {1: "wake", 2: "command"}
+BRICK_MS = 15
+
+
+class Capture:
+    def __init__(self, path):
+        self.path = path
+        self.version = 0
+        self.columns = []           # [(name, struct code)]
+        self.lanes = []             # [(model name, paramAOffset)]
+        self.files = {}             # file index -> name
+        self.file_bricks = {}       # file index -> bricks replayed
+        self.rows = {}              # column name -> list of values
+        self._load()
+
+    def __len__(self):
+        return len(self.rows.get("file", ()))
+
+    @property
+    def hours(self):
+        return sum(self.file_bricks.values()) * BRICK_MS / 3600000.0
+
+    def _load(self):
+        with open(self.path, "rb") as f:
+            data = f.read()
+        pos = 0
+        while pos + 8 <= len(data):
+            tag = data[pos:pos + 4]
+            (length,) = struct.unpack_from("<I", data, pos + 4)
+            payload = data[pos + 8:pos + 8 + length]
+            if len(payload) != length:
+                break           # truncated tail of an interrupted run
+            pos += 8 + length
+            if tag == b"SCAP":
+                self._header(payload)
+            elif tag == b"SCFN":
+                (idx,) = struct.unpack_from("<I", payload)
+                self.files[idx] = payload[4:].decode("utf-8", "replace")
+            elif tag == b"SCFE":
+                idx, bricks = struct.unpack_from("<II", payload)
+                self.file_bricks[idx] = bricks
+            elif tag == b"SCCH":
+                self._chunk(payload)
+        if not self.columns:
+            raise ValueError("%s: not a score capture file" % self.path)
+
+    def _header(self, payload):
+        self.version, _, ncols, nlanes = struct.unpack_from("<BBBB", payload)
+        pos = 4
+        for _ in range(ncols):
+            name = payload[pos:pos + 16].split(b"\0", 1)[0].decode()
+            code = chr(payload[pos + 16])
+            self.columns.append((name, code))
+            self.rows[name] = array(code)
+            pos += 17
+        for _ in range(nlanes):
+            model, offset = struct.unpack_from("<Bh", payload, pos)
+            self.lanes.append((MODEL_NAMES.get(model, str(model)), offset))
+            pos += 3
+
+    def _chunk(self, payload):
+        (nrows,) = struct.unpack_from("<H", payload)
+        pos = 2
+        for name, code in self.columns:
+            size = struct.calcsize(code)
+            col = array(code)
+            col.frombytes(payload[pos:pos + size * nrows])
+            self.rows[name].extend(col)
+            pos += size * nrows
+
+    def lane_rows(self, lane):
+        """Row dicts of one lane, in capture order."""
+        names = [n for n, _ in self.columns]
+        cols = [self.rows[n] for n in names]
+        lanes = self.rows["lane"]
+        for i in range(len(self)):
+            if lanes[i] == lane:
+                yield {n: c[i] for n, c in zip(names, cols)}
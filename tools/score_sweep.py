@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Offline NNPQ threshold sweep over replay score captures.
+
+Every candidate detection of a replay run is in the capture, so whether it
+would have been accepted at another NNPQ threshold only needs a comparison.
+Each capture lane (model + paramAOffset) is swept against the labels and the
+lanes of all captures given are evaluated in parallel.
+
+Labels are a CSV file with the columns
+    file,start_ms,end_ms,model,word_id
+where file is the replayed path (or its base name), model is "wake" or
+"command" and word_id 0 matches any phrase.
+"""
+
+import argparse
+import bisect
+import csv
+import math
+import os
+import sys
+import time
+from concurrent.futures import ProcessPoolExecutor
+
+from scap import BRICK_MS, Capture
+
+
+def load_labels(path):
+    labels = []
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            labels.append((row["file"].strip(), float(row["start_ms"]), float(row["end_ms"]),
+                           row["model"].strip().lower(), int(row.get("word_id") or 0)))
+    return labels
+
+
+def parse_range(spec):
+    start, stop, step = (int(v) for v in spec.split(":"))
+    return list(range(start, stop + 1, step))
+
+
+def candidate_score(row, mode):
+    """Score compared against the threshold, inf means always accepted."""
+    if row["nnpqScore"] <= 0:
+        return math.inf if row["accepted"] else -math.inf
+    if mode == "lower-only" and row["nnpqPass"]:
+        # nnpqThresholdNew in wakeword.c can only accept more, never reject
+        return math.inf
+    return row["nnpqScore"]
+
+
+def sweep_lane(job):
+    path, lane, labels, thresholds, args = job
+    cap = Capture(path)
+    model, offset = cap.lanes[lane]
+
+    by_name = {}
+    for idx, name in cap.files.items():
+        by_name[name] = idx
+        by_name.setdefault(os.path.basename(name), idx)
+    windows = {}
+    for name, start, end, lmodel, word in labels:
+        if lmodel == model and name in by_name:
+            windows.setdefault(by_name[name], []).append([start - args.tolerance_ms,
+                                                         end + args.tolerance_ms, word, -math.inf])
+
+    false_cands = {}
+    for row in cap.lane_rows(lane):
+        score = candidate_score(row, args.mode)
+        start_ms = (row["brickStart"] - 1) * BRICK_MS
+        end_ms = row["brickEnd"] * BRICK_MS
+        hit = False
+        for w in windows.get(row["file"], ()):
+            if start_ms <= w[1] and end_ms >= w[0] and (w[2] == 0 or w[2] == row["wordID"]):
+                w[3] = max(w[3], score)
+                hit = True
+        if not hit:
+            false_cands.setdefault(row["file"], []).append((end_ms, score))
+
+    # Candidates closer than the refractory time are one false accept event
+    fa_scores = []
+    for cands in false_cands.values():
+        cands.sort()
+        last_end = None
+        for end_ms, score in cands:
+            if last_end is not None and end_ms - last_end < args.refractory_ms:
+                fa_scores[-1] = max(fa_scores[-1], score)
+            else:
+                fa_scores.append(score)
+            last_end = end_ms
+
+    label_scores = sorted(w[3] for ws in windows.values() for w in ws)
+    fa_scores.sort()
+    hours = cap.hours
+    results = []
+    for thr in thresholds:
+        hits = len(label_scores) - bisect.bisect_left(label_scores, thr)
+        fa = len(fa_scores) - bisect.bisect_left(fa_scores, thr)
+        misses = len(label_scores) - hits
+        results.append((thr, hits, misses,
+                        misses / len(label_scores) if label_scores else 0.0,
+                        fa, fa / hours if hours else 0.0))
+    return path, lane, model, offset, hours, results
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("captures", nargs="+", help="score capture files (.scap)")
+    ap.add_argument("-l", "--labels", required=True, help="ground truth CSV")
+    ap.add_argument("-t", "--thresholds", default="0:32768:8", help="start:stop:step (default %(default)s)")
+    ap.add_argument("--mode", choices=("replace", "lower-only"), default="replace",
+                    help="replace: accept if nnpqScore >= threshold; lower-only: also accept "
+                         "what the model threshold passed, like nnpqThresholdNew in wakeword.c")
+    ap.add_argument("--tolerance-ms", type=float, default=500, help="label window slack (default %(default)s)")
+    ap.add_argument("--refractory-ms", type=float, default=1000,
+                    help="false candidates closer than this count once (default %(default)s)")
+    ap.add_argument("--target-fa", type=float, help="report the lowest FRR with FA/h at or below this")
+    ap.add_argument("-o", "--output", help="CSV output (default stdout)")
+    ap.add_argument("-j", "--jobs", type=int, default=os.cpu_count())
+    args = ap.parse_args()
+
+    labels = load_labels(args.labels)
+    thresholds = parse_range(args.thresholds)
+    jobs = [(path, lane, labels, thresholds, args)
+            for path in args.captures for lane in range(len(Capture(path).lanes))]
+
+    t0 = time.perf_counter()
+    with ProcessPoolExecutor(max_workers=args.jobs) as pool:
+        lanes = list(pool.map(sweep_lane, jobs))
+    elapsed = time.perf_counter() - t0
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    w = csv.writer(out)
+    w.writerow(["capture", "lane", "model", "paramAOffset", "threshold",
+                "hits", "misses", "frr", "fa", "fa_per_hour"])
+    for path, lane, model, offset, _, results in lanes:
+        for thr, hits, misses, frr, fa, fah in results:
+            w.writerow([path, lane, model, offset, thr, hits, misses, "%.4f" % frr, fa, "%.3f" % fah])
+    if out is not sys.stdout:
+        out.close()
+
+    print("%d lanes x %d thresholds in %.1f ms" % (len(lanes), len(thresholds), elapsed * 1000),
+          file=sys.stderr)
+    if args.target_fa is not None:
+        for path, lane, model, offset, hours, results in lanes:
+            ok = [r for r in results if r[5] <= args.target_fa]
+            if not ok:
+                print("%s lane %d (%s, offset %d): no threshold reaches %.3f FA/h"
+                      % (path, lane, model, offset, args.target_fa), file=sys.stderr)
+                continue
+            thr, _, _, frr, fa, fah = min(ok, key=lambda r: (r[3], r[0]))
+            print("%s lane %d (%s, offset %d, %.2f h): threshold %d FRR %.2f%% FA %d (%.3f/h)"
+                  % (path, lane, model, offset, hours, thr, frr * 100, fa, fah), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
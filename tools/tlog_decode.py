@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Turn TLOG() trace records back into text.
+
+A TRACE_LOG build stores only the format string address, a cycle count and
+the raw argument words of each TLOG() call. The format strings live in the
+.tlog_fmt section of the ELF file (not loaded on the target), so decoding
+needs the ELF of the exact build that produced the trace.
+
+Inputs:
+  - a console capture containing the "#TL" lines sent by the flush task
+    (other console text is ignored, or passed through with --all), or
+  - with --raw, a memory dump of the gTraceLog structure (e.g. saved from
+    the debugger), which also recovers records not sent yet.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+TLOG_MAGIC = 0x474F4C54
+SLOT_WORDS = 7                  # seq, fmt, time, arg[4]
+MAX_ARGS = 4
+SHT_NOBITS = 8
+
+CONV = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diouxXcspfeEgG%])")
+
+
+class Elf:
+    """Just enough of an ELF reader to look up section contents by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            sys.exit("%s: not an ELF file" % path)
+        cls, enc = self.data[4], self.data[5]
+        self.end = "<" if enc == 1 else ">"
+        if cls == 1:
+            shoff, = struct.unpack_from(self.end + "I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.end + "HHH", self.data, 0x2E)
+            hdr = self.end + "IIIIIIIIII"
+        else:
+            shoff, = struct.unpack_from(self.end + "Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.end + "HHH", self.data, 0x3A)
+            hdr = self.end + "IIQQQQIIQQ"
+        raw = [struct.unpack_from(hdr, self.data, shoff + i * shentsize) for i in range(shnum)]
+        names = raw[shstrndx][4]
+        self.sections = {}
+        for name, kind, _, addr, offset, size, *_ in raw:
+            end = self.data.index(b"\0", names + name)
+            self.sections[self.data[names + name:end].decode()] = (kind, addr, offset, size)
+
+    def read_string(self, addr):
+        """C string at a target address, None if no section holds it."""
+        for kind, base, offset, size in self.sections.values():
+            if kind != SHT_NOBITS and base and base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.find(b"\0", start, offset + size)
+                return self.data[start:end if end >= 0 else offset + size].decode(errors="replace")
+        return None
+
+
+def format_record(elf, fmt_word, args):
+    fmt = elf.read_string(fmt_word & ~7)
+    if fmt is None:
+        return "<unknown format 0x%08x> %s" % (fmt_word, " ".join("0x%08x" % a for a in args))
+    args = list(args)
+
+    def conv(m):
+        flags, width, prec, _, kind = m.groups()
+        if kind == "%":
+            return "%"
+        word = args.pop(0) if args else 0
+        spec = "%" + flags + width + ("." + prec if prec is not None else "")
+        if kind in "di":
+            return (spec + "d") % (word - (1 << 32) if word & 0x80000000 else word)
+        if kind == "u":
+            return (spec + "d") % word
+        if kind == "p":
+            return (spec + "s") % ("0x%08x" % word)
+        if kind == "s":
+            text = elf.read_string(word)
+            return (spec + "s") % (text if text is not None else "<0x%08x>" % word)
+        if kind in "feEgG":
+            return (spec + kind) % struct.unpack("<f", struct.pack("<I", word))[0]
+        return (spec + kind) % word
+
+    return CONV.sub(conv, fmt).strip("\r\n")
+
+
+def parse_console(path, keep_text):
+    """Yields ("rec", seq, fmt, time, args), ("lost", n), ("clock", hz) or ("text", line)."""
+    line_re = re.compile(r"#TL([:=!])([0-9a-f]+)")
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = line_re.search(line)
+            if not m:
+                if keep_text and line.strip():
+                    yield ("text", line.strip("\r\n"))
+                continue
+            tag, hexs = m.groups()
+            if tag == ":":
+                words = [int(hexs[i:i + 8], 16) for i in range(0, len(hexs) - 7, 8)]
+                if len(words) < 3 or len(words) - 3 != min(words[1] & 7, MAX_ARGS):
+                    continue            # line mangled by interleaved output
+                yield ("rec", words[0], words[1], words[2], words[3:])
+            elif tag == "=":
+                yield ("clock", int(hexs[:8], 16))
+            else:
+                yield ("lost", int(hexs[:8], 16))
+
+
+def parse_raw(path, big_endian):
+    with open(path, "rb") as f:
+        data = f.read()
+    end = ">" if big_endian else "<"
+    magic, slots, clock_hz, index = struct.unpack_from(end + "IIII", data, 0)
+    if magic != TLOG_MAGIC:
+        sys.exit("%s: does not start with the gTraceLog header" % path)
+    yield ("clock", clock_hz)
+    recs = []
+    for i in range(slots):
+        seq, fmt, time, *args = struct.unpack_from(end + "%dI" % SLOT_WORDS, data, 16 + i * SLOT_WORDS * 4)
+        if seq:
+            recs.append((seq, fmt, time, args[:min(fmt & 7, MAX_ARGS)]))
+    recs.sort()
+    if recs and recs[0][0] > 1:
+        yield ("lost", recs[0][0] - 1)
+    for rec in recs:
+        yield ("rec",) + rec
+    if index > (recs[-1][0] if recs else 0):
+        print("%d records were still being written" % (index - (recs[-1][0] if recs else 0)), file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("elf", help="ELF file of the build that produced the trace")
+    ap.add_argument("capture", help="console capture, or memory dump with --raw")
+    ap.add_argument("--raw", action="store_true", help="capture is a binary dump of gTraceLog")
+    ap.add_argument("--big-endian", action="store_true", help="byte order of the --raw dump")
+    ap.add_argument("--clock-hz", type=int, help="cycle counter frequency (default from the stream header)")
+    ap.add_argument("--all", action="store_true", help="also print the other console lines")
+    args = ap.parse_args()
+
+    elf = Elf(args.elf)
+    if ".tlog_fmt" not in elf.sections:
+        print("warning: %s has no .tlog_fmt section, was it built with TRACE_LOG?" % args.elf, file=sys.stderr)
+    source = parse_raw(args.capture, args.big_endian) if args.raw else parse_console(args.capture, args.all)
+
+    clock_hz = args.clock_hz
+    last_seq = last_time = None
+    cycles = 0
+    lost = 0
+    for ev in source:
+        if ev[0] == "clock":
+            clock_hz = args.clock_hz or ev[1]
+            last_seq = last_time = None
+            cycles = 0
+        elif ev[0] == "text":
+            print(ev[1])
+        elif ev[0] == "lost":
+            lost += ev[1]
+            print("--- %d records lost ---" % ev[1])
+        else:
+            _, seq, fmt, time, words = ev
+            if last_seq is not None and seq != last_seq + 1 and seq > last_seq:
+                # A gap the target did not report (e.g. capture started late)
+                print("--- %d records missing ---" % (seq - last_seq - 1))
+            # 32-bit cycle counter, assumes consecutive records are less than one wrap apart
+            if last_time is not None:
+                cycles += (time - last_time) & 0xFFFFFFFF
+            last_seq, last_time = seq, time
+            stamp = "%12.6f" % (cycles / clock_hz) if clock_hz else "%12d" % cycles
+            print("[%s] %s" % (stamp, format_record(elf, fmt, words)))
+    if lost:
+        print("%d records lost in total, increase TRACE_LOG_SLOTS or flush more often" % lost, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Turn a TRACE_REC execution trace into a Chrome / Perfetto trace.
+
+A TRACE_REC build records task switches, queue operations, instrumented
+interrupt handlers and TRACE_REC_BEGIN/END spans in a RAM ring (see
+trace_rec.h). This converts the ring into the Chrome trace event JSON
+format, which chrome://tracing and https://ui.perfetto.dev open: one row
+per task and per interrupt, queue operations as instant markers and spans
+nested in the row of the task that ran them.
+
+Inputs:
+  - a console capture containing the "#TR" lines printed by the "trace"
+    console command (TraceRec_dump()), or
+  - with --raw, a memory dump of the gTraceRec structure (e.g. saved from
+    the debugger); the task names are not in it, the rows are named by
+    their TCB address.
+
+Span names are only stored as addresses; give the ELF file of the build
+with --elf to read them back.
+
+    python3 tools/trace2chrome.py capture.txt -o trace.json --elf Debug/demo.out
+
+The summary on stderr includes the share of the CPU time spent recording
+(events times the measured cost of one event).
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+from tlog_decode import Elf
+
+TRACE_REC_MAGIC = 0x43455254
+HEADER_WORDS = 6                # magic, events, clockHz, eventCycles, index, enabled
+EVENT_WORDS = 3                 # time, info, obj
+
+EV_TASK_IN = 1
+EV_ISR_ENTER = 2
+EV_ISR_EXIT = 3
+EV_QUEUE_SEND = 4
+EV_QUEUE_RECEIVE = 5
+EV_BLOCK_SEND = 6
+EV_BLOCK_RECV = 7
+EV_SPAN_BEGIN = 8
+EV_SPAN_END = 9
+EV_FROM_ISR = 0x800000
+
+INSTANTS = {
+    EV_QUEUE_SEND: "send",
+    EV_QUEUE_RECEIVE: "receive",
+    EV_BLOCK_SEND: "block on send",
+    EV_BLOCK_RECV: "block on receive",
+}
+
+PID = 1
+TID_IDLE = 0                    # before the first task switch
+TID_ISR = 1                     # + exception number, TCB addresses are larger
+
+
+def parse_console(path):
+    """Returns the last complete dump: (clock_hz, event_cycles, written, {tcb: name}, [(time, info, obj)])."""
+    line_re = re.compile(r"#TR([=n:.])([0-9a-f]*)(.*)")
+    result = None
+    header, names, events = None, {}, []
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = line_re.search(line.rstrip("\r\n"))
+            if not m:
+                continue
+            tag, hexs, rest = m.groups()
+            if tag == "=":
+                words = [int(hexs[i:i + 8], 16) for i in range(0, len(hexs) - 7, 8)]
+                header = words if len(words) == 4 else None
+                names, events = {}, []
+            elif header is None:
+                continue
+            elif tag == "n" and len(hexs) >= 8:
+                # The name is text and may itself start with hex digits
+                names[int(hexs[:8], 16)] = (hexs[8:] + rest).strip()
+            elif tag == ":":
+                words = [int(hexs[i:i + 8], 16) for i in range(0, len(hexs) - 7, 8)]
+                if len(words) % EVENT_WORDS:
+                    continue            # line mangled by interleaved output
+                events.extend(tuple(words[i:i + EVENT_WORDS]) for i in range(0, len(words), EVENT_WORDS))
+            elif tag == ".":
+                clock_hz, event_cycles, written, _ = header
+                result = (clock_hz, event_cycles, written, names, events)
+                header = None
+    if result is None:
+        sys.exit("%s: no complete #TR dump found" % path)
+    return result
+
+
+def parse_raw(path, big_endian):
+    with open(path, "rb") as f:
+        data = f.read()
+    end = ">" if big_endian else "<"
+    magic, size, clock_hz, event_cycles, written, _ = struct.unpack_from(end + "%dI" % HEADER_WORDS, data, 0)
+    if magic != TRACE_REC_MAGIC:
+        sys.exit("%s: does not start with the gTraceRec header" % path)
+    if len(data) < (HEADER_WORDS + size * EVENT_WORDS) * 4:
+        sys.exit("%s: dump is shorter than the %d events of the ring" % (path, size))
+    count = min(written, size)
+    # Wrapped ring: the oldest event is the next one to be overwritten
+    first = written - count if written > size else 0
+    events = [struct.unpack_from(end + "%dI" % EVENT_WORDS, data,
+                                 (HEADER_WORDS + ((first + i) % size) * EVENT_WORDS) * 4) for i in range(count)]
+    return clock_hz, event_cycles, written, {}, events
+
+
+def convert(events, clock_hz, names, elf):
+    """Returns (trace events, {tid: busy cycles}, total cycles, {tid: row name})."""
+    out = []
+    tids = {TID_IDLE: "(before the first switch)"}
+    busy = {}
+    spans = {}                  # tid: [names] of the open spans
+    isrs = []                   # [(tid, start)] of the interrupts being handled
+    task, task_start = TID_IDLE, 0
+    cycles, last = 0, None
+
+    def us(c):
+        return c * 1e6 / clock_hz
+
+    def span_name(obj):
+        name = elf.read_string(obj) if elf else None
+        return name if name is not None else "span 0x%08x" % obj
+
+    for time, info, obj in events:
+        # 32-bit cycle counter, assumes consecutive events are less than one wrap apart
+        if last is not None:
+            cycles += (time - last) & 0xFFFFFFFF
+        last = time
+        kind, arg = info >> 24, info & 0xFFFFFF
+        here = isrs[-1][0] if isrs else task
+
+        if kind == EV_TASK_IN:
+            if obj == task:
+                continue
+            if cycles > task_start:
+                out.append({"ph": "X", "name": tids[task], "pid": PID, "tid": task,
+                            "ts": us(task_start), "dur": us(cycles - task_start)})
+                busy[task] = busy.get(task, 0) + cycles - task_start
+            task, task_start = obj, cycles
+            tids.setdefault(task, names.get(obj, "task 0x%08x" % obj))
+        elif kind == EV_ISR_ENTER:
+            tid = TID_ISR + arg
+            tids.setdefault(tid, "ISR %d" % arg)
+            isrs.append((tid, cycles))
+        elif kind == EV_ISR_EXIT:
+            if isrs and isrs[-1][0] == TID_ISR + arg:
+                tid, start = isrs.pop()
+                out.append({"ph": "X", "name": tids[tid], "pid": PID, "tid": tid,
+                            "ts": us(start), "dur": us(cycles - start)})
+        elif kind in INSTANTS:
+            tid = here
+            if arg & EV_FROM_ISR and not isrs:
+                # From a handler without TRACE_REC_ISR_ENTER
+                tid = TID_ISR
+                tids.setdefault(tid, "ISR")
+            out.append({"ph": "i", "s": "t", "name": INSTANTS[kind], "pid": PID, "tid": tid,
+                        "ts": us(cycles), "args": {"queue": "0x%08x" % obj}})
+        elif kind == EV_SPAN_BEGIN:
+            name = span_name(obj)
+            spans.setdefault(here, []).append(name)
+            out.append({"ph": "B", "name": name, "pid": PID, "tid": here, "ts": us(cycles)})
+        elif kind == EV_SPAN_END:
+            # A wrapped ring may have lost the beginning
+            if spans.get(here):
+                out.append({"ph": "E", "name": spans[here].pop(), "pid": PID, "tid": here, "ts": us(cycles)})
+
+    if cycles > task_start:
+        out.append({"ph": "X", "name": tids[task], "pid": PID, "tid": task,
+                    "ts": us(task_start), "dur": us(cycles - task_start)})
+        busy[task] = busy.get(task, 0) + cycles - task_start
+    used = {e["tid"] for e in out}
+    for tid, name in tids.items():
+        if tid not in used:
+            continue
+        out.append({"ph": "M", "name": "thread_name", "pid": PID, "tid": tid, "args": {"name": name}})
+        # Interrupts on top
+        out.append({"ph": "M", "name": "thread_sort_index", "pid": PID, "tid": tid,
+                    "args": {"sort_index": -1 if TID_ISR <= tid <= TID_ISR + 0x1FF else 0}})
+    return out, busy, cycles, tids
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("capture", help="console capture, or memory dump with --raw")
+    ap.add_argument("-o", "--output", required=True, help="Chrome trace JSON file to write")
+    ap.add_argument("--elf", help="ELF file of the build, for the span names")
+    ap.add_argument("--raw", action="store_true", help="capture is a binary dump of gTraceRec")
+    ap.add_argument("--big-endian", action="store_true", help="byte order of the --raw dump")
+    ap.add_argument("--clock-hz", type=int, help="cycle counter frequency (default from the dump header)")
+    args = ap.parse_args()
+
+    if args.raw:
+        clock_hz, event_cycles, written, names, events = parse_raw(args.capture, args.big_endian)
+    else:
+        clock_hz, event_cycles, written, names, events = parse_console(args.capture)
+    clock_hz = args.clock_hz or clock_hz
+    if not clock_hz:
+        sys.exit("unknown clock frequency, give --clock-hz")
+    elf = Elf(args.elf) if args.elf else None
+
+    trace, busy, cycles, tids = convert(events, clock_hz, names, elf)
+    with open(args.output, "w") as f:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ns"}, f)
+
+    print("%d events over %.3f ms, %d recorded since the start%s"
+          % (len(events), cycles * 1e3 / clock_hz, written,
+             ", the oldest were overwritten" if written > len(events) else ""), file=sys.stderr)
+    for tid, n in sorted(busy.items(), key=lambda t: -t[1]):
+        print("  %5.1f%%  %s" % (100.0 * n / (cycles or 1), tids[tid]), file=sys.stderr)
+    if cycles:
+        print("recording cost %d cycles per event, %.2f%% of the time"
+              % (event_cycles, 100.0 * len(events) * event_cycles / cycles), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+"""Deterministic synthetic workload for the replay harness.
+
+Streams 16 kHz / 16-bit mono raw PCM made of recorded phrases mixed into a
+noise bed, and writes the matching ground truth labels (score_sweep.py
+format) as it goes. The same seed and options always give the same stream.
+
+Phrase recordings are listed in a CSV file:
+    path,model,word_id
+    rec/genie_01.wav,wake,1
+    rec/green_01.wav,command,1
+where model is "wake" or "command". Every --period seconds (plus --jitter) a
+wake phrase is inserted, followed after --command-gap by a command phrase
+with probability --command-prob.
+
+The output is written block by block, so a 24 h workload can go to a named
+pipe (replay list entry "stream:<path>"), stdout or a serial port (replay
+list entry "uart:") without being stored anywhere.
+"""
+
+import argparse
+import csv
+import math
+import os
+import random
+import stat
+import sys
+import time
+import wave
+from array import array
+
+RATE = 16000
+BLOCK = RATE            # samples generated per write
+
+
+def parse_duration(text):
+    units = {"h": 3600, "m": 60, "s": 1}
+    if text[-1] in units:
+        return float(text[:-1]) * units[text[-1]]
+    return float(text)
+
+
+def parse_span(text):
+    """"10" or "5:20" (uniform between the two)"""
+    lo, _, hi = text.partition(":")
+    return float(lo), float(hi or lo)
+
+
+def read_pcm(path):
+    if path.lower().endswith(".wav"):
+        with wave.open(path, "rb") as w:
+            if w.getframerate() != RATE or w.getnchannels() != 1 or w.getsampwidth() != 2:
+                sys.exit("%s: need 16 kHz mono 16-bit audio" % path)
+            data = w.readframes(w.getnframes())
+    else:
+        with open(path, "rb") as f:
+            data = f.read()
+    pcm = array("h")
+    pcm.frombytes(data[:len(data) & ~1])
+    if sys.byteorder == "big":
+        pcm.byteswap()
+    return pcm
+
+
+def rms(pcm):
+    return math.sqrt(sum(s * s for s in pcm) / len(pcm)) if pcm else 0.0
+
+
+def active_rms(pcm, frame=240):
+    """RMS over the louder half of the 15 ms frames, so leading and trailing
+    silence of a recording does not change its level."""
+    frames = sorted(rms(pcm[i:i + frame]) for i in range(0, len(pcm) - frame + 1, frame))
+    loud = frames[len(frames) // 2:] or [rms(pcm)]
+    return math.sqrt(sum(v * v for v in loud) / len(loud))
+
+
+def noise_bed(args, rng):
+    """Noise looped under the whole stream, scaled to --noise-dbfs."""
+    if args.noise:
+        bed = array("h")
+        for path in args.noise:
+            bed.extend(read_pcm(path))
+    elif args.noise_type == "silence":
+        return array("h", bytes(2 * RATE))
+    else:
+        # 7.3 s of generated noise, an odd length so the loop point drifts against the schedule
+        n = int(RATE * 7.3)
+        bed = array("h", [0]) * n
+        b0 = b1 = b2 = 0.0
+        for i in range(n):
+            white = rng.uniform(-1.0, 1.0)
+            if args.noise_type == "pink":
+                # Paul Kellet's economy pink filter
+                b0 = 0.99765 * b0 + white * 0.0990460
+                b1 = 0.96300 * b1 + white * 0.2965164
+                b2 = 0.57000 * b2 + white * 1.0526913
+                white = (b0 + b1 + b2 + white * 0.1848) * 0.2
+            bed[i] = int(max(-1.0, min(1.0, white)) * 32767)
+    level = rms(bed)
+    gain = 32768 * 10 ** (args.noise_dbfs / 20.0) / level if level else 0.0
+    return array("h", (int(s * gain) for s in bed))
+
+
+def load_clips(path):
+    clips = {"wake": [], "command": []}
+    base = os.path.dirname(os.path.abspath(path))
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            model = row["model"].strip().lower()
+            if model not in clips:
+                sys.exit("%s: unknown model '%s'" % (path, model))
+            pcm = read_pcm(os.path.join(base, row["path"].strip()))
+            clips[model].append((pcm, active_rms(pcm), int(row.get("word_id") or 0)))
+    if not clips["wake"]:
+        sys.exit("%s: no wake phrase recordings" % path)
+    return clips
+
+
+def configure_tty(fd, baud):
+    import termios
+    speed = getattr(termios, "B%d" % baud, None)
+    if speed is None:
+        sys.exit("unsupported baud rate %d" % baud)
+    attr = termios.tcgetattr(fd)
+    attr[0] = 0                                             # iflag: raw
+    attr[1] = 0                                             # oflag: no post processing
+    attr[2] = termios.CS8 | termios.CREAD | termios.CLOCAL  # cflag
+    attr[3] = 0                                             # lflag
+    attr[4] = attr[5] = speed
+    termios.tcsetattr(fd, termios.TCSANOW, attr)
+
+
+class Schedule:
+    """Produces the phrase events in time order and logs their labels."""
+
+    def __init__(self, args, clips, noise_level, rng, labels_file, name):
+        self.args, self.clips, self.rng = args, clips, rng
+        self.noise_level = noise_level
+        self.labels_file, self.name = labels_file, name
+        self.labels = csv.writer(labels_file)
+        self.labels.writerow(["file", "start_ms", "end_ms", "model", "word_id"])
+        self.next_start = args.period / 2
+        self.events = []        # [start sample, scaled pcm]
+        self.count = 0
+
+    def _scaled(self, clip):
+        pcm, level, _ = clip
+        if self.noise_level and level:
+            snr = self.rng.uniform(*self.args.snr)
+            gain = self.noise_level * 10 ** (snr / 20.0) / level
+        else:
+            gain = 32768 * 10 ** (self.args.speech_dbfs / 20.0) / level if level else 0.0
+        return array("h", (max(-32768, min(32767, int(s * gain))) for s in pcm))
+
+    def _add(self, start, model, clip):
+        pcm = self._scaled(clip)
+        self.events.append([start, pcm])
+        self.labels.writerow([self.name, "%d" % (start * 1000 // RATE),
+                              "%d" % ((start + len(pcm)) * 1000 // RATE), model, clip[2]])
+        return start + len(pcm)
+
+    def fill(self, until, total):
+        """Schedule every event that may start before sample 'until'.
+
+        Jitter moves an event up to args.jitter early, so the ones not
+        scheduled yet never start in audio that is already written."""
+        while (self.next_start - self.args.jitter) * RATE < until:
+            start = int((self.next_start + self.rng.uniform(-self.args.jitter, self.args.jitter)) * RATE)
+            wake = self.rng.choice(self.clips["wake"])
+            if start + len(wake[0]) < total:
+                end = self._add(max(0, start), "wake", wake)
+                if self.clips["command"] and self.rng.random() < self.args.command_prob:
+                    cmd = self.rng.choice(self.clips["command"])
+                    start = end + int(self.rng.uniform(*self.args.command_gap) * RATE)
+                    if start + len(cmd[0]) < total:
+                        self._add(start, "command", cmd)
+                self.count += 1
+            self.next_start += self.args.period
+        # Labels stay in step with the audio even if the run is interrupted
+        self.labels_file.flush()
+
+    def mix(self, block, pos):
+        end = pos + len(block)
+        for ev in self.events:
+            start, pcm = ev
+            lo, hi = max(start, pos), min(start + len(pcm), end)
+            for i in range(lo, hi):
+                v = block[i - pos] + pcm[i - start]
+                block[i - pos] = 32767 if v > 32767 else (-32768 if v < -32768 else v)
+        self.events = [ev for ev in self.events if ev[0] + len(ev[1]) > end]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--clips", required=True, help="CSV of phrase recordings (path,model,word_id)")
+    ap.add_argument("--noise", nargs="*", help="noise recordings looped under the stream")
+    ap.add_argument("--noise-type", choices=("pink", "white", "silence"), default="pink",
+                    help="generated noise when no recordings are given (default %(default)s)")
+    ap.add_argument("--noise-dbfs", type=float, default=-50.0, help="noise level (default %(default)s)")
+    ap.add_argument("--snr", type=parse_span, default=(10.0, 25.0),
+                    help="phrase SNR in dB, N or LO:HI (default 10:25)")
+    ap.add_argument("--speech-dbfs", type=float, default=-26.0,
+                    help="phrase level when there is no noise (default %(default)s)")
+    ap.add_argument("-d", "--duration", type=parse_duration, default=parse_duration("1h"),
+                    help="stream length, e.g. 24h, 90m, 600 (default 1h)")
+    ap.add_argument("--period", type=float, default=5.0, help="seconds between wake phrases (default %(default)s)")
+    ap.add_argument("--jitter", type=float, default=0.5, help="+/- seconds on each event (default %(default)s)")
+    ap.add_argument("--command-prob", type=float, default=1.0,
+                    help="probability of a command after a wake phrase (default %(default)s)")
+    ap.add_argument("--command-gap", type=parse_span, default=(0.3, 1.0),
+                    help="seconds from wake phrase end to command, N or LO:HI (default 0.3:1.0)")
+    ap.add_argument("--seed", type=int, default=1)
+    ap.add_argument("-o", "--output", default="-", help="raw PCM output: file, named pipe, tty or - (default)")
+    ap.add_argument("--baud", type=int, default=921600, help="baud rate when the output is a tty")
+    ap.add_argument("--speed", type=float, default=0.0,
+                    help="pace output at N x real time (0 = as fast as possible, use 1 for UART)")
+    ap.add_argument("-l", "--labels", required=True, help="labels CSV to write")
+    ap.add_argument("--name", help="file name used in the labels, the replay list entry "
+                                   "(default: stream:<output>, or uart: for a tty)")
+    args = ap.parse_args()
+
+    rng = random.Random(args.seed)
+    clips = load_clips(args.clips)
+    bed = noise_bed(args, rng)
+    noise_level = rms(bed)
+
+    if args.output == "-":
+        out = sys.stdout.buffer
+        name = args.name or "stream:-"
+    else:
+        out = open(args.output, "wb", buffering=0)
+        is_tty = os.isatty(out.fileno())
+        if is_tty:
+            configure_tty(out.fileno(), args.baud)
+        if args.name:
+            name = args.name
+        elif is_tty:
+            name = "uart:"
+        elif stat.S_ISFIFO(os.fstat(out.fileno()).st_mode):
+            name = "stream:" + args.output
+        else:
+            name = args.output
+
+    labels_file = open(args.labels, "w", newline="")
+    sched = Schedule(args, clips, noise_level, rng, labels_file, name)
+
+    total = int(args.duration * RATE)
+    pos = bed_pos = 0
+    t0 = time.monotonic()
+    try:
+        while pos < total:
+            n = min(BLOCK, total - pos)
+            block = array("h")
+            while len(block) < n:
+                take = min(n - len(block), len(bed) - bed_pos)
+                block.extend(bed[bed_pos:bed_pos + take])
+                bed_pos = (bed_pos + take) % len(bed)
+            sched.fill(pos + n, total)
+            sched.mix(block, pos)
+            if sys.byteorder == "big":
+                block.byteswap()
+            out.write(block.tobytes())
+            pos += n
+            if args.speed > 0:
+                ahead = pos / (RATE * args.speed) - (time.monotonic() - t0)
+                if ahead > 0:
+                    time.sleep(ahead)
+    except BrokenPipeError:
+        print("reader closed the stream at %.1f s" % (pos / RATE), file=sys.stderr)
+    finally:
+        labels_file.close()
+        if out is not sys.stdout.buffer:
+            out.close()
+    print("%.1f s of audio, %d wake events, labels for '%s'" % (pos / RATE, sched.count, name),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()